@@ -13,8 +13,9 @@ import pandas as pd
 import matplotlib.pyplot as plt
 import os
 import torch
-from training.train_gesture_classification import GestureClassificationNet, read_and_interpolate_features
-from training.create_training_data import next_vals, default_vals, save_csv
+from training.train_gesture_classification import GestureClassificationNet, interpolate_features
+from training.create_training_data import next_vals, default_vals
+from training.serial_frames import read_msg_list, read_gesture_record, read_gesture_frame
 from flask import Flask, json, jsonify
 import time
 import threading
@@ -25,29 +26,47 @@ def make_prediction(model, features):
     with torch.no_grad():
         score = model(features)
     return torch.argmax(score, dim=1).cpu().item()
-def prediction_loop(current_prediction_dict, model, port, baud_rate, root_dir, device, dtype, sample_size_min=20):
+def vals_to_features(val_list):
+    # Same tensor read_and_interpolate_features gives for the csv save_csv would write, without the file round trip:
+    # samples with an 'ovf' value are dropped like pandas' dropna(axis=1)
+    rows = [[float('nan') if value == 'ovf' else float(value) for value in vals.rstrip(',').split(',')] for vals in val_list]
+    features = torch.tensor(rows, dtype=torch.float64)
+    features = features[:, ~torch.any(torch.isnan(features), dim=0)]
+    return interpolate_features(features)
+def open_receiver(port, baud_rate, binary_output, gesture_records=False):
     vr_handheld_controller_receiver = serial.Serial(port=port, baudrate=baud_rate)
+    if gesture_records:
+        # Receiver reads this during its startup prompt and switches to gesture records
+        vr_handheld_controller_receiver.write(b'g')
+    elif binary_output:
+        # Receiver reads this during its startup prompt and switches to binary frames
+        vr_handheld_controller_receiver.write(b'b')
+    return vr_handheld_controller_receiver
+def prediction_loop(current_prediction_dict, model, port, baud_rate, device, dtype, sample_size_min=20, binary_output=False):
+    vr_handheld_controller_receiver = open_receiver(port, baud_rate, binary_output)
     val_list = [''] * 9 # acc_x, acc_y, acc_z, gyr_x, gyr_y, gry_z, mag_x, mag_y, mag_z
-    temp_filepath = os.path.join(root_dir,'current_reading_tempfile.csv')
     while True:
         try:
-            msg = vr_handheld_controller_receiver.read_until()
-            msg = msg.decode('utf-8')
-            if msg is None or msg == '':
-                # print('msg is none or empty str')
-                continue
-            msg_list = msg.rstrip('\r\n').split(';')
-            if len(msg_list) != 10:
-                print(msg)
-                continue
+            if binary_output:
+                msg_list = read_msg_list(vr_handheld_controller_receiver)
+                if msg_list is None:
+                    continue
+            else:
+                msg = vr_handheld_controller_receiver.read_until()
+                msg = msg.decode('utf-8')
+                if msg is None or msg == '':
+                    # print('msg is none or empty str')
+                    continue
+                msg_list = msg.rstrip('\r\n').split(';')
+                if len(msg_list) != 10:
+                    print(msg)
+                    continue
             if msg_list[0] == '1':
                 val_list = next_vals(val_list, msg_list)
             else:
                 if len(val_list[0])  > sample_size_min:
-                    save_csv(temp_filepath, val_list)
-                    features = torch.unsqueeze(read_and_interpolate_features(temp_filepath),dim=0)
+                    features = torch.unsqueeze(vals_to_features(val_list),dim=0)
                     features = features.to(device=device, dtype=dtype)
-                    os.remove(temp_filepath)
                     current_prediction_dict['currentprediction'] = make_prediction(model, features)
                     print('Gesture detected, predicted gesture = {0}'.format(current_prediction_dict['currentprediction']))
                 val_list = default_vals()
@@ -55,7 +74,39 @@ def prediction_loop(current_prediction_dict, model, port, baud_rate, root_dir, d
             print('Connection ended')
             vr_handheld_controller_receiver.close()
             time.sleep(5)
-            vr_handheld_controller_receiver = serial.Serial(port=port, baudrate=baud_rate)
+            vr_handheld_controller_receiver = open_receiver(port, baud_rate, binary_output)
+def gesture_record_prediction_loop(current_prediction_dict, model, port, baud_rate, device, dtype):
+    # The receiver segments and resamples gestures itself, each record is already the model input
+    vr_handheld_controller_receiver = open_receiver(port, baud_rate, False, gesture_records=True)
+    while True:
+        try:
+            info, channels = read_gesture_record(vr_handheld_controller_receiver)
+            features = torch.unsqueeze(torch.tensor(channels), dim=0).to(device=device, dtype=dtype)
+            current_prediction_dict['currentprediction'] = make_prediction(model, features)
+            current_prediction_dict['controller'] = info['controller']
+            print('Gesture {0} detected ({1} samples), predicted gesture = {2}'.format(info['number'], info['num_samples'], current_prediction_dict['currentprediction']))
+        except:
+            print('Connection ended')
+            vr_handheld_controller_receiver.close()
+            time.sleep(5)
+            vr_handheld_controller_receiver = open_receiver(port, baud_rate, False, gesture_records=True)
+def device_prediction_loop(current_prediction_dict, port, baud_rate):
+    # The receiver classifies gestures itself (needs weights exported with training/export_gesture_model.py) and
+    # reports them as gesture frames in its binary output, no model runs on the host
+    vr_handheld_controller_receiver = open_receiver(port, baud_rate, True)
+    while True:
+        try:
+            gesture = read_gesture_frame(vr_handheld_controller_receiver)
+            if gesture['label'] < 0:
+                continue
+            current_prediction_dict['currentprediction'] = gesture['label']
+            current_prediction_dict['controller'] = gesture['controller']
+            print('Gesture {0} detected, predicted gesture = {1} (confidence {2:.2f}, inference {3} us)'.format(gesture['number'], gesture['label'], gesture['confidence'], gesture['inference_us']))
+        except:
+            print('Connection ended')
+            vr_handheld_controller_receiver.close()
+            time.sleep(5)
+            vr_handheld_controller_receiver = open_receiver(port, baud_rate, True)
 
 
 current_prediction_dict = {'currentprediction':-1}
@@ -82,7 +133,6 @@ def run_app_server():
     app.run(debug=False, threaded=True, host=server_ip, port=server_port)
 def gesture_prediction_loop():
     global current_prediction_dict
-    training_root_dir = './training'
     models_path = './training/models'
     device = torch.device("cuda:0" if torch.cuda.is_available() else "cpu")
     dtype = torch.float32
@@ -95,7 +145,15 @@ def gesture_prediction_loop():
     port = '/dev/tty.usbmodem11301'
     baud_rate = 15200
     sample_size_min = 20
-    prediction_loop(current_prediction_dict, gesture_classification_model, port, baud_rate, training_root_dir, device=device, dtype=dtype, sample_size_min=sample_size_min)
+    binary_output = False # True to read binary frames, the receiver must be (re)started so it sees the request
+    gesture_records = False # True to let the receiver segment and resample gestures, same restart requirement
+    device_predictions = False # True to use the receiver's own classification, same restart requirement
+    if device_predictions:
+        device_prediction_loop(current_prediction_dict, port, baud_rate)
+    elif gesture_records:
+        gesture_record_prediction_loop(current_prediction_dict, gesture_classification_model, port, baud_rate, device=device, dtype=dtype)
+    else:
+        prediction_loop(current_prediction_dict, gesture_classification_model, port, baud_rate, device=device, dtype=dtype, sample_size_min=sample_size_min, binary_output=binary_output)
 
 if __name__=="__main__":
     app_server_thread = threading.Thread(target=run_app_server)
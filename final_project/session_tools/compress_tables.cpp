@@ -0,0 +1,168 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Generates the compressed simulation tables of the VRduino firmware (vr_application/vrduino/simulatedImuTable.h and
+simulatedLighthouseTable.h) from simulatedImuData.h and simulatedLighthouseData.h, in the delta + varint encoding of
+vr_application/vrduino/SimulatedTable.h.
+
+IMU values are stored in units of 0.001 (the precision they were recorded with), clock ticks as they are. Every
+value is decoded again and compared with the source table, nothing is written if a value would change.
+
+Run again whenever a source table changes.
+
+Usage: compress_tables [output directory, default ../vr_application/vrduino]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "../vr_application/vrduino/simulatedImuData.h"
+#include "../vr_application/vrduino/simulatedLighthouseData.h"
+#include "../vr_application/vrduino/SimulatedTable.h"
+
+#define IMU_COLUMNS 6
+#define LIGHTHOUSE_COLUMNS 8
+#define IMU_SCALE 1000 // units per deg/s and m/s^2
+#define MAX_ENCODED_LENGTH (5 * (nImuSamples > nLighthouseSamples ? nImuSamples : nLighthouseSamples))
+
+static uint8_t encoded[MAX_ENCODED_LENGTH];
+
+// Delta + varint encodes rows of columns values, returns the encoded length
+static int encodeTable(const int32_t *values, int count, int columns)
+{
+    int32_t previous[SimulatedTableDecoder::kMaxColumns] = {0};
+    int length = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int column = i % columns;
+        length += encodeSimulatedTableValue((int32_t)((uint32_t)values[i] - (uint32_t)previous[column]), encoded + length);
+        previous[column] = values[i];
+    }
+    return length;
+}
+
+static bool checkTable(const int32_t *values, int count, int length, int columns)
+{
+    SimulatedTableDecoder decoder(encoded, length, count / columns, columns);
+    int32_t row[SimulatedTableDecoder::kMaxColumns];
+    for (int i = 0; i < count; i += columns)
+    {
+        decoder.nextRow(row);
+        for (int j = 0; j < columns; j++)
+        {
+            if (row[j] != values[i + j])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Shortest decimal representation that reads back as value
+static const char *formatDouble(double value, char *out, int size)
+{
+    for (int precision = 1; precision <= 17; precision++)
+    {
+        snprintf(out, size, "%.*g", precision, value);
+        if (strtod(out, NULL) == value)
+        {
+            break;
+        }
+    }
+    return out;
+}
+
+static bool writeTable(const char *directory, const char *file_name, const char *description, const char *name,
+                       int length, int rows, int columns, const char *extra)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", directory, file_name);
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "can't create %s\n", path);
+        return false;
+    }
+    fprintf(file, "#pragma once\n\n");
+    fprintf(file, "/**\n * %s\n", description);
+    fprintf(file, " * generated by session_tools/compress_tables, don't edit.\n");
+    fprintf(file, " * decode with SimulatedTableDecoder (SimulatedTable.h)\n */\n\n");
+    fprintf(file, "#include <stdint.h>\n\n");
+    fprintf(file, "%s", extra);
+    fprintf(file, "const int %sRows = %d;\n", name, rows);
+    fprintf(file, "const int %sColumns = %d;\n", name, columns);
+    fprintf(file, "const int %sLength = %d;\n", name, length);
+    fprintf(file, "const uint8_t %sData[%sLength] = {\n", name, name);
+    for (int i = 0; i < length; i++)
+    {
+        fprintf(file, "0x%02x,%s", encoded[i], (i % 16 == 15 || i == length - 1) ? "\n" : " ");
+    }
+    fprintf(file, "};\n");
+    bool written = fclose(file) == 0;
+    if (written)
+    {
+        printf("%s: %d rows, %d bytes (%d uncompressed)\n", path, rows, length, rows * columns * 4);
+    }
+    return written;
+}
+
+int main(int argc, char **argv)
+{
+    const char *directory = argc > 1 ? argv[1] : "../vr_application/vrduino";
+
+    static int32_t imu[nImuSamples];
+    for (int i = 0; i < nImuSamples; i++)
+    {
+        imu[i] = (int32_t)lround(imuData[i] * (double)IMU_SCALE);
+        if ((float)imu[i] / (float)IMU_SCALE != imuData[i])
+        {
+            fprintf(stderr, "imuData[%d] = %f has more than 3 decimals\n", i, imuData[i]);
+            return 1;
+        }
+    }
+    int imu_length = encodeTable(imu, nImuSamples, IMU_COLUMNS);
+    if (!checkTable(imu, nImuSamples, imu_length, IMU_COLUMNS))
+    {
+        fprintf(stderr, "IMU table doesn't decode to its source\n");
+        return 1;
+    }
+    char imu_extra[256];
+    snprintf(imu_extra, sizeof(imu_extra),
+             "/** values are in units of 1/imuTableScale, order is gyr x,y,z, acc x,y,z */\n"
+             "const float imuTableScale = %d.0f;\n\n", IMU_SCALE);
+    if (!writeTable(directory, "simulatedImuTable.h", "simulated imu data of simulatedImuData.h, compressed",
+                    "imuTable", imu_length, nImuSamples / IMU_COLUMNS, IMU_COLUMNS, imu_extra))
+    {
+        return 1;
+    }
+
+    static int32_t ticks[nLighthouseSamples];
+    for (int i = 0; i < nLighthouseSamples; i++)
+    {
+        ticks[i] = (int32_t)clockTicksData[i];
+    }
+    int lighthouse_length = encodeTable(ticks, nLighthouseSamples, LIGHTHOUSE_COLUMNS);
+    if (!checkTable(ticks, nLighthouseSamples, lighthouse_length, LIGHTHOUSE_COLUMNS))
+    {
+        fprintf(stderr, "lighthouse table doesn't decode to its source\n");
+        return 1;
+    }
+    char pitch[32];
+    char roll[32];
+    char lighthouse_extra[256];
+    snprintf(lighthouse_extra, sizeof(lighthouse_extra),
+             "/** base station pitch/roll in degrees during the recording */\n"
+             "const double lighthouseTablePitch = %s;\n"
+             "const double lighthouseTableRoll = %s;\n\n"
+             "/** clock ticks, order is sensor0 hori, sensor0 verti, ... sensor3 verti */\n",
+             formatDouble(baseStationPitchSim, pitch, sizeof(pitch)), formatDouble(baseStationRollSim, roll, sizeof(roll)));
+    if (!writeTable(directory, "simulatedLighthouseTable.h",
+                    "simulated clock ticks of simulatedLighthouseData.h, compressed", "lighthouseTable",
+                    lighthouse_length, nLighthouseSamples / LIGHTHOUSE_COLUMNS, LIGHTHOUSE_COLUMNS, lighthouse_extra))
+    {
+        return 1;
+    }
+    return 0;
+}
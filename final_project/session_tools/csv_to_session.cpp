@@ -0,0 +1,157 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Converts recorded gestures (training/vr_handheld_controller_gesture_data.csv and the files in
+training/data_files) into a session log (vr_handheld_lib/SessionLog/SessionLog.h).
+
+Each gesture becomes controller records with the button held, spread evenly over the gesture's duration, between
+a SESSION_MARKER_GESTURE_START and a SESSION_MARKER_GESTURE_END marker carrying its label. Gestures follow each other
+one second apart.
+
+Usage: csv_to_session <gesture_data.csv> <output.vrsession>
+    Data file paths in the CSV are relative to the CSV's directory.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <SessionLog.h>
+
+#define MAX_GESTURE_SAMPLES 4096
+#define GESTURE_GAP_US 1000000
+#define LINE_LENGTH 65536
+
+static char line[LINE_LENGTH];
+
+// Reads the 9 rows (acc x,y,z, gyr x,y,z, mag x,y,z) of a data file, returns the number of samples or -1
+static int readGesture(const char *path, float values[9][MAX_GESTURE_SAMPLES])
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    int count = -1;
+    int row = 0;
+    while (row < 9 && fgets(line, sizeof(line), file) != NULL)
+    {
+        int n = 0;
+        char *end;
+        for (char *p = line; n < MAX_GESTURE_SAMPLES; p = end + 1)
+        {
+            float value = strtof(p, &end);
+            if (end == p)
+            {
+                break;
+            }
+            values[row][n++] = value;
+            if (*end != ',')
+            {
+                break;
+            }
+        }
+        if (n == 0)
+        {
+            continue;
+        }
+        if (count >= 0 && n != count)
+        {
+            count = -1;
+            break;
+        }
+        count = n;
+        row++;
+    }
+    fclose(file);
+    return row == 9 ? count : -1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <gesture_data.csv> <output.vrsession>\n", argv[0]);
+        return 2;
+    }
+    FILE *index = fopen(argv[1], "r");
+    if (index == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", argv[1]);
+        return 1;
+    }
+    char directory[1024] = ".";
+    const char *slash = strrchr(argv[1], '/');
+    if (slash != NULL)
+    {
+        snprintf(directory, sizeof(directory), "%.*s", (int)(slash - argv[1]), argv[1]);
+    }
+
+    SessionLogWriter writer;
+    if (!writer.open(argv[2], "handheld gestures"))
+    {
+        fprintf(stderr, "can't create %s\n", argv[2]);
+        fclose(index);
+        return 1;
+    }
+
+    static float values[9][MAX_GESTURE_SAMPLES];
+    char entry[1024];
+    uint64_t now_us = 0;
+    uint16_t sequence = 0;
+    int gestures = 0;
+    int skipped = 0;
+    bool ok = true;
+    while (ok && fgets(entry, sizeof(entry), index) != NULL)
+    {
+        char file_name[512];
+        int label;
+        double duration;
+        if (sscanf(entry, " %511[^,], %d, %lf", file_name, &label, &duration) != 3)
+        {
+            continue;
+        }
+        char path[2048];
+        snprintf(path, sizeof(path), "%s/%s", directory, file_name);
+        int count = readGesture(path, values);
+        if (count <= 0)
+        {
+            fprintf(stderr, "skipping %s, not 9 rows of numbers\n", path);
+            skipped++;
+            continue;
+        }
+
+        uint64_t period_us = count > 1 ? (uint64_t)(duration*1e6 / (count - 1)) : 0;
+        SessionMarkerRecord marker = {SESSION_MARKER_GESTURE_START, label};
+        ok = writer.add(SESSION_CHANNEL_MARKER, now_us, &marker);
+        for (int n = 0; ok && n < count; n++)
+        {
+            uint64_t timestamp_us = now_us + n*period_us;
+            SessionControllerRecord record;
+            record.sample_us = (uint32_t)timestamp_us;
+            record.sequence = sequence++;
+            record.flags = SESSION_CONTROLLER_BUTTON_PRESSED;
+            record.controller = 0;
+            for (int i = 0; i < 3; i++)
+            {
+                record.acc[i] = values[i][n];
+                record.gyr[i] = values[3 + i][n];
+                record.mag[i] = values[6 + i][n];
+            }
+            ok = writer.add(SESSION_CHANNEL_CONTROLLER, timestamp_us, &record);
+        }
+        now_us += (count - 1)*period_us;
+        marker.kind = SESSION_MARKER_GESTURE_END;
+        ok = ok && writer.add(SESSION_CHANNEL_MARKER, now_us, &marker);
+        now_us += GESTURE_GAP_US;
+        gestures++;
+    }
+    fclose(index);
+    if (!writer.close() || !ok)
+    {
+        fprintf(stderr, "writing %s failed\n", argv[2]);
+        return 1;
+    }
+    printf("%d gestures written to %s, %d skipped\n", gestures, argv[2], skipped);
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Converts a capture of the VRduino's recorder output (vr_application/vrduino/SessionRecorder.h, frames in
+RecorderFrame.h) into a session log (vr_handheld_lib/SessionLog/SessionLog.h).
+
+    IMU readings   -> SESSION_CHANNEL_IMU, bias corrected with the bias of the start frame like the simulation tables
+                      (recorders before RECORDER_FRAME_VERSION 2 sent them corrected already)
+    sweeps         -> SESSION_CHANNEL_SWEEP, and every vertical sweep of the tracked base station also as a
+                      SESSION_CHANNEL_LIGHTHOUSE frame, which PoseTracker::setSimulatedLighthouse() replays
+    sequence gaps  -> SESSION_MARKER_IMU_DROPPED / SESSION_MARKER_SWEEP_DROPPED markers
+
+Timestamps are the VRduino's micros(), unwrapped and counted from the first frame. The tracked base station is the
+mode in the start frame, or slot 0 while the mode of a station isn't known. Anything between frames, such as the text
+of the VRduino's tests, is skipped.
+
+Usage: frames_to_session <capture.bin> <output.vrsession>
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <SessionLog.h>
+#include "../vr_application/vrduino/RecorderFrame.h"
+
+struct Converter {
+    SessionLogWriter writer;
+    bool ok;
+    bool started;
+    uint32_t last_us;
+    uint64_t time_us;
+    int base_station_mode;
+    bool base_station_set;
+    float gyr_bias[3]; // subtracted from the IMU readings, 0 until a version 2 start frame
+    float acc_bias[3];
+    bool imu_seen;
+    bool sweep_seen;
+    uint16_t next_imu;
+    uint16_t next_sweep;
+    unsigned long frames;
+    unsigned long imu_gaps;
+    unsigned long sweep_gaps;
+    RecorderStatus status;
+    bool status_seen;
+};
+
+// Session time of a micros() value, which wraps every 71 minutes
+static uint64_t sessionTime(Converter &converter, uint32_t time_us)
+{
+    if (!converter.started)
+    {
+        converter.started = true;
+        converter.last_us = time_us;
+        converter.time_us = 0;
+    }
+    converter.time_us += (uint32_t)(time_us - converter.last_us);
+    converter.last_us = time_us;
+    return converter.time_us;
+}
+
+static void addGap(Converter &converter, uint64_t timestamp_us, int kind, uint16_t sequence, uint16_t &next,
+                   bool &seen, unsigned long &gaps)
+{
+    uint16_t missing = sequence - next;
+    if (seen && missing != 0)
+    {
+        SessionMarkerRecord marker = {(uint32_t)kind, missing};
+        converter.ok = converter.ok && converter.writer.add(SESSION_CHANNEL_MARKER, timestamp_us, &marker);
+        gaps += missing;
+    }
+    seen = true;
+    next = sequence + 1;
+}
+
+static void convertFrame(Converter &converter, const RecorderFrame &frame)
+{
+    converter.frames++;
+    if (frame.type == RECORDER_FRAME_START)
+    {
+        converter.base_station_mode = frame.start.baseStationMode;
+        for (int i = 0; i < 3; i++)
+        {
+            converter.gyr_bias[i] = frame.version >= 2 ? frame.start.gyrBias[i] : 0.0f;
+            converter.acc_bias[i] = frame.version >= 2 ? frame.start.accBias[i] : 0.0f;
+        }
+        sessionTime(converter, frame.start.timeUs);
+    }
+    else if (frame.type == RECORDER_FRAME_IMU)
+    {
+        uint64_t timestamp_us = sessionTime(converter, frame.imu.timeUs);
+        addGap(converter, timestamp_us, SESSION_MARKER_IMU_DROPPED, frame.imu.sequence, converter.next_imu,
+               converter.imu_seen, converter.imu_gaps);
+        SessionImuRecord record;
+        for (int i = 0; i < 3; i++)
+        {
+            record.gyr[i] = frame.imu.gyr[i] - converter.gyr_bias[i];
+            record.acc[i] = frame.imu.acc[i] - converter.acc_bias[i];
+        }
+        converter.ok = converter.ok && converter.writer.add(SESSION_CHANNEL_IMU, timestamp_us, &record);
+    }
+    else if (frame.type == RECORDER_FRAME_SWEEP)
+    {
+        const RecorderSweep &sweep = frame.sweep;
+        uint64_t timestamp_us = sessionTime(converter, sweep.timeUs);
+        addGap(converter, timestamp_us, SESSION_MARKER_SWEEP_DROPPED, sweep.sequence, converter.next_sweep,
+               converter.sweep_seen, converter.sweep_gaps);
+        SessionSweepRecord record = {};
+        record.station = sweep.station;
+        record.mode = sweep.mode;
+        record.axis = sweep.axis;
+        record.pitch = sweep.pitch;
+        record.roll = sweep.roll;
+        for (int i = 0; i < 8; i++)
+        {
+            record.clock_ticks[i] = sweep.clockTicks[i];
+            record.num_pulse_detections[i] = sweep.numPulseDetections[i];
+            record.pulse_width[i] = sweep.pulseWidth[i];
+        }
+        converter.ok = converter.ok && converter.writer.add(SESSION_CHANNEL_SWEEP, timestamp_us, &record);
+
+        // The read-out holds the latest ticks of both axes, so a vertical sweep completes a frame
+        bool tracked = sweep.mode >= 0 ? sweep.mode == converter.base_station_mode : sweep.station == 0;
+        if (tracked && sweep.axis == 1)
+        {
+            SessionLighthouseRecord frame_record;
+            for (int i = 0; i < 8; i++)
+            {
+                frame_record.clock_ticks[i] = sweep.clockTicks[i];
+            }
+            converter.ok = converter.ok && converter.writer.add(SESSION_CHANNEL_LIGHTHOUSE, timestamp_us, &frame_record);
+            if (!converter.base_station_set && sweep.mode >= 0)
+            {
+                converter.writer.setBaseStation(sweep.pitch, sweep.roll);
+                converter.base_station_set = true;
+            }
+        }
+    }
+    else if (frame.type == RECORDER_FRAME_STATUS)
+    {
+        sessionTime(converter, frame.status.timeUs);
+        converter.status = frame.status;
+        converter.status_seen = true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <capture.bin> <output.vrsession>\n", argv[0]);
+        return 2;
+    }
+    FILE *capture = fopen(argv[1], "rb");
+    if (capture == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", argv[1]);
+        return 1;
+    }
+    static Converter converter;
+    if (!converter.writer.open(argv[2], "vrduino recording"))
+    {
+        fprintf(stderr, "can't create %s\n", argv[2]);
+        fclose(capture);
+        return 1;
+    }
+    converter.ok = true;
+    converter.base_station_mode = -1;
+
+    // Split at the zero delimiters, chunks that aren't frames are counted and skipped
+    uint8_t chunk[RECORDER_FRAME_MAX_LENGTH];
+    int length = 0;
+    bool overlong = false;
+    unsigned long skipped = 0;
+    int c;
+    while ((c = fgetc(capture)) != EOF)
+    {
+        if (c != 0)
+        {
+            if (length < (int)sizeof(chunk))
+            {
+                chunk[length++] = c;
+            }
+            else
+            {
+                overlong = true;
+            }
+            continue;
+        }
+        RecorderFrame frame;
+        if (!overlong && decodeRecorderFrame(chunk, length, frame))
+        {
+            convertFrame(converter, frame);
+        }
+        else
+        {
+            skipped++;
+        }
+        length = 0;
+        overlong = false;
+    }
+    fclose(capture);
+
+    if (!converter.writer.close() || !converter.ok)
+    {
+        fprintf(stderr, "writing %s failed\n", argv[2]);
+        return 1;
+    }
+    printf("%lu frames written to %s, %lu chunks skipped, gaps: %lu IMU readings, %lu sweeps\n", converter.frames,
+           argv[2], skipped, converter.imu_gaps, converter.sweep_gaps);
+    if (converter.status_seen)
+    {
+        printf("recorder: %lu IMU readings (%lu dropped), %lu sweeps (%lu dropped), buffer high water %u bytes\n",
+               (unsigned long)converter.status.imuRecorded, (unsigned long)converter.status.imuDropped,
+               (unsigned long)converter.status.sweepsRecorded, (unsigned long)converter.status.sweepsDropped,
+               converter.status.bufferHighWater);
+    }
+    return 0;
+}
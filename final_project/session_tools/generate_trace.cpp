@@ -0,0 +1,661 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Generates a synthetic VRduino session with ground truth (vr_handheld_lib/SessionLog/SessionLog.h) from a scripted
+6-DoF trajectory: lighthouse sweeps as the VRduino would read them out, matching IMU readings and the true pose.
+
+The trajectory is a list of keyframes, one per line (# starts a comment):
+    time_s  x_mm y_mm z_mm  yaw_deg pitch_deg roll_deg  [label]
+Positions are in the frame of base station 0 (PoseTracker::getPosition(), z points away from the board), the
+rotation of the board is R = Ry(yaw) Rx(pitch) Rz(roll). Keyframes are joined with cubic Hermite splines (Catmull-Rom
+tangents, at rest at the first and last keyframe). Without --script a built-in trajectory of translations, rotations
+and a fast shake is used. The label of a keyframe is written as a SESSION_MARKER_SEGMENT marker when it changes.
+
+Sweeps follow the lighthouse timing: 120 sweeps a second alternating horizontal and vertical. With --two-stations,
+base stations B (slot 0) and C (slot 1) take turns, each sweeping both axes, as in LighthouseInputCapture.h. Station 1
+stands 1 m to the right of station 0, turned 45 degrees towards the board. Each diode (positionRef of PoseTracker) is
+projected into the station and its angle turned into clock ticks with the inverse of convertTicksTo2DPositions().
+Diodes that face away from a station or are outside its 120 degree field of view have no detection.
+
+Knobs:
+    --tick-noise <ticks>       gaussian noise of each sweep time (default 10)
+    --occlusion <p>            probability that a visible diode is covered for a sweep (default 0)
+    --occlusion-sweeps <n>     sweeps a covered diode stays covered (default 1)
+    --reflections <p>          probability of an inter-reflection: 2 pulse detections, and half of the time the
+                               reported time is the reflection's (default 0)
+    --drift <ppm>              VRduino clock drift, scales clock ticks and timestamps (default 0)
+    --imu-rate <hz>            IMU readings per second (default 1000)
+    --gyr-noise <deg/s>        gaussian gyro noise (default 0.1)
+    --gyr-bias <deg/s>         standard deviation of the random constant gyro bias (default 0)
+    --acc-noise <m/s^2>        gaussian accelerometer noise (default 0.02)
+    --pitch <deg> --roll <deg> tilt of base station 0 against gravity (default 0)
+    --duration <s>             length of the trace (default: up to the last keyframe)
+    --seed <n>                 random seed (default 1)
+
+Written channels: SESSION_CHANNEL_IMU, SESSION_CHANNEL_SWEEP, SESSION_CHANNEL_LIGHTHOUSE (frames of station 0, for
+PoseTracker::setSimulatedLighthouse()), SESSION_CHANNEL_POSE (true pose in the frame of each station at every IMU
+reading) and SESSION_CHANNEL_MARKER.
+
+Usage: generate_trace [knobs] [--script <trajectory.txt>] [--two-stations] <output.vrsession>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <SessionLog.h>
+
+#define CLOCKS_PER_SECOND 48000000.0 // CLOCKS_PER_SECOND of PoseMath.h on the Teensy 3.2 and LC
+#define SWEEP_PERIOD_US (1000000.0 / 120.0)
+#define STATION_OFFSET_US (20000.0 / 48.0) // sync pulse offset of the second station
+#define FIELD_OF_VIEW_DEG 60.0             // half angle of a sweep
+#define DIODE_MAX_ANGLE_DEG 80.0           // diodes don't see a station further off their normal
+#define DIODE_SIZE_MM 3.0
+#define GRAVITY 9.81
+#define MAX_KEYFRAMES 1024
+#define DEG (M_PI / 180.0)
+
+static const double positionRef[8] = {-42.0, 25.0, 42.0, 25.0, 42.0, -25.0, -42.0, -25.0};
+
+struct Keyframe {
+    double t;
+    double values[6]; // x, y, z, yaw, pitch, roll
+    int label;
+};
+
+struct Pose {
+    double R[3][3];
+    double t[3];
+};
+
+// Default trajectory: still, translations, rotations about each axis, a fast shake, still
+static const char *DEFAULT_SCRIPT =
+    "0    0    0    -1000    0   0   0   0\n"
+    "1    0    0    -1000    0   0   0   1\n"
+    "2    300  0    -1000    0   0   0   1\n"
+    "3   -300  0    -1000    0   0   0   1\n"
+    "4    0    200  -800     0   0   0   1\n"
+    "5    0   -200  -1400    0   0   0   1\n"
+    "6    0    0    -1000    0   0   0   2\n"
+    "7    0    0    -1000    40  0   0   2\n"
+    "8    0    0    -1000   -40  0   0   2\n"
+    "9    0    0    -1000    0   30  0   2\n"
+    "10   0    0    -1000    0  -30  0   2\n"
+    "11   0    0    -1000    0   0   45  2\n"
+    "12   0    0    -1000    0   0  -45  2\n"
+    "13   0    0    -1000    0   0   0   3\n"
+    "13.25 60  20   -980     15  5   10  3\n"
+    "13.5 -60 -20   -1020   -15 -5  -10  3\n"
+    "13.75 60  20   -980     15  5   10  3\n"
+    "14   0    0    -1000    0   0   0   3\n"
+    "15   0    0    -1000    0   0   0   0\n";
+
+// xorshift64* with Box-Muller for gaussian noise, so traces are the same on every host
+static uint64_t random_state = 1;
+
+static double uniform()
+{
+    random_state ^= random_state >> 12;
+    random_state ^= random_state << 25;
+    random_state ^= random_state >> 27;
+    return ((random_state * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double gaussian(double sigma)
+{
+    if (sigma <= 0.0)
+    {
+        return 0.0;
+    }
+    double u = uniform();
+    double v = uniform();
+    return sigma * sqrt(-2.0 * log(u > 0.0 ? u : 1e-300)) * cos(2.0 * M_PI * v);
+}
+
+static void rotationX(double angle, double R[3][3])
+{
+    double c = cos(angle), s = sin(angle);
+    double M[3][3] = {{1, 0, 0}, {0, c, -s}, {0, s, c}};
+    memcpy(R, M, sizeof(M));
+}
+
+static void rotationY(double angle, double R[3][3])
+{
+    double c = cos(angle), s = sin(angle);
+    double M[3][3] = {{c, 0, s}, {0, 1, 0}, {-s, 0, c}};
+    memcpy(R, M, sizeof(M));
+}
+
+static void rotationZ(double angle, double R[3][3])
+{
+    double c = cos(angle), s = sin(angle);
+    double M[3][3] = {{c, -s, 0}, {s, c, 0}, {0, 0, 1}};
+    memcpy(R, M, sizeof(M));
+}
+
+static void multiply(const double A[3][3], const double B[3][3], double C[3][3])
+{
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j];
+        }
+    }
+}
+
+// out = R v, or R^T v when transposed
+static void rotate(const double R[3][3], const double v[3], double out[3], bool transposed)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        out[i] = transposed ? R[0][i] * v[0] + R[1][i] * v[1] + R[2][i] * v[2]
+                            : R[i][0] * v[0] + R[i][1] * v[1] + R[i][2] * v[2];
+    }
+}
+
+// Quaternion w,x,y,z of a rotation matrix with w >= 0
+static void quaternionFromRotation(const double R[3][3], double q[4])
+{
+    double trace = R[0][0] + R[1][1] + R[2][2];
+    if (trace > 0.0)
+    {
+        double s = 2.0 * sqrt(1.0 + trace);
+        q[0] = 0.25 * s;
+        q[1] = (R[2][1] - R[1][2]) / s;
+        q[2] = (R[0][2] - R[2][0]) / s;
+        q[3] = (R[1][0] - R[0][1]) / s;
+    }
+    else if (R[0][0] > R[1][1] && R[0][0] > R[2][2])
+    {
+        double s = 2.0 * sqrt(1.0 + R[0][0] - R[1][1] - R[2][2]);
+        q[0] = (R[2][1] - R[1][2]) / s;
+        q[1] = 0.25 * s;
+        q[2] = (R[0][1] + R[1][0]) / s;
+        q[3] = (R[0][2] + R[2][0]) / s;
+    }
+    else if (R[1][1] > R[2][2])
+    {
+        double s = 2.0 * sqrt(1.0 + R[1][1] - R[0][0] - R[2][2]);
+        q[0] = (R[0][2] - R[2][0]) / s;
+        q[1] = (R[0][1] + R[1][0]) / s;
+        q[2] = 0.25 * s;
+        q[3] = (R[1][2] + R[2][1]) / s;
+    }
+    else
+    {
+        double s = 2.0 * sqrt(1.0 + R[2][2] - R[0][0] - R[1][1]);
+        q[0] = (R[1][0] - R[0][1]) / s;
+        q[1] = (R[0][2] + R[2][0]) / s;
+        q[2] = (R[1][2] + R[2][1]) / s;
+        q[3] = 0.25 * s;
+    }
+    if (q[0] < 0.0)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            q[i] = -q[i];
+        }
+    }
+}
+
+static int parseScript(const char *script, Keyframe *keyframes)
+{
+    int count = 0;
+    const char *line = script;
+    while (line != NULL && *line != '\0' && count < MAX_KEYFRAMES)
+    {
+        Keyframe &k = keyframes[count];
+        k.label = count > 0 ? keyframes[count - 1].label : 0;
+        if (line[strspn(line, " \t")] != '#' &&
+            sscanf(line, "%lf %lf %lf %lf %lf %lf %lf %d", &k.t, &k.values[0], &k.values[1], &k.values[2],
+                   &k.values[3], &k.values[4], &k.values[5], &k.label) >= 7 &&
+            (count == 0 || k.t > keyframes[count - 1].t))
+        {
+            count++;
+        }
+        line = strchr(line, '\n');
+        if (line != NULL)
+        {
+            line++;
+        }
+    }
+    return count;
+}
+
+// Values of the trajectory at time t and the label of the segment
+static int evaluate(const Keyframe *keyframes, int count, double t, double values[6])
+{
+    if (t <= keyframes[0].t || count == 1)
+    {
+        memcpy(values, keyframes[0].values, sizeof(keyframes[0].values));
+        return keyframes[0].label;
+    }
+    if (t >= keyframes[count - 1].t)
+    {
+        memcpy(values, keyframes[count - 1].values, sizeof(keyframes[0].values));
+        return keyframes[count - 1].label;
+    }
+    int k = 0;
+    while (keyframes[k + 1].t <= t)
+    {
+        k++;
+    }
+    const Keyframe &a = keyframes[k];
+    const Keyframe &b = keyframes[k + 1];
+    double duration = b.t - a.t;
+    double u = (t - a.t) / duration;
+    double h00 = 2 * u * u * u - 3 * u * u + 1;
+    double h10 = u * u * u - 2 * u * u + u;
+    double h01 = -2 * u * u * u + 3 * u * u;
+    double h11 = u * u * u - u * u;
+    for (int i = 0; i < 6; i++)
+    {
+        double ma = k > 0 ? (b.values[i] - keyframes[k - 1].values[i]) / (b.t - keyframes[k - 1].t) : 0.0;
+        double mb = k + 2 < count ? (keyframes[k + 2].values[i] - a.values[i]) / (keyframes[k + 2].t - a.t) : 0.0;
+        values[i] = h00 * a.values[i] + h10 * duration * ma + h01 * b.values[i] + h11 * duration * mb;
+    }
+    return a.label;
+}
+
+static Pose boardPose(const Keyframe *keyframes, int count, double t)
+{
+    double values[6];
+    evaluate(keyframes, count, t, values);
+    double Ry[3][3], Rx[3][3], Rz[3][3], Ryx[3][3];
+    rotationY(values[3] * DEG, Ry);
+    rotationX(values[4] * DEG, Rx);
+    rotationZ(values[5] * DEG, Rz);
+    multiply(Ry, Rx, Ryx);
+    Pose pose;
+    multiply(Ryx, Rz, pose.R);
+    memcpy(pose.t, values, sizeof(pose.t));
+    return pose;
+}
+
+// Pose of the board in the frame of a station placed at stationPose in the frame of station 0
+static Pose poseInStation(const Pose &board, const Pose &station)
+{
+    Pose pose;
+    double d[3] = {board.t[0] - station.t[0], board.t[1] - station.t[1], board.t[2] - station.t[2]};
+    rotate(station.R, d, pose.t, true);
+    for (int j = 0; j < 3; j++)
+    {
+        double column[3] = {board.R[0][j], board.R[1][j], board.R[2][j]};
+        double rotated[3];
+        rotate(station.R, column, rotated, true);
+        for (int i = 0; i < 3; i++)
+        {
+            pose.R[i][j] = rotated[i];
+        }
+    }
+    return pose;
+}
+
+struct Options {
+    const char *script_path;
+    const char *output_path;
+    bool two_stations;
+    double tick_noise;
+    double occlusion;
+    int occlusion_sweeps;
+    double reflections;
+    double drift_ppm;
+    double imu_rate;
+    double gyr_noise;
+    double gyr_bias;
+    double acc_noise;
+    double pitch;
+    double roll;
+    double duration;
+    unsigned long seed;
+};
+
+// State of the read-out buffers of one station, as Lighthouse::readStationSweepTimings() returns them
+struct StationState {
+    Pose pose; // in the frame of station 0
+    int mode;
+    SessionSweepRecord readout;
+    int covered[4]; // sweeps each diode stays covered
+};
+
+struct Counts {
+    unsigned long sweeps;
+    unsigned long hits;
+    unsigned long missed;
+    unsigned long covered;
+    unsigned long reflections;
+};
+
+static void sweep(const Options &options, const Keyframe *keyframes, int count, StationState &station, int axis,
+                  double t_s, Counts &counts)
+{
+    Pose board = poseInStation(boardPose(keyframes, count, t_s), station.pose);
+    double scale = CLOCKS_PER_SECOND * (1.0 + options.drift_ppm * 1e-6);
+    double normal[3] = {board.R[0][2], board.R[1][2], board.R[2][2]};
+    for (int i = 0; i < 4; i++)
+    {
+        int index = 2 * i + axis;
+        double ref[3] = {positionRef[2 * i], positionRef[2 * i + 1], 0.0};
+        double p[3];
+        rotate(board.R, ref, p, false);
+        for (int j = 0; j < 3; j++)
+        {
+            p[j] += board.t[j];
+        }
+        double distance = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        double facing = -(normal[0] * p[0] + normal[1] * p[1] + normal[2] * p[2]) / distance;
+        double angle = (axis == 0 ? atan2(p[0], -p[2]) : atan2(p[1], -p[2])) / DEG;
+        bool visible = p[2] < 0.0 && fabs(angle) < FIELD_OF_VIEW_DEG && facing > cos(DIODE_MAX_ANGLE_DEG * DEG);
+
+        if (visible && station.covered[i] == 0 && options.occlusion > 0.0 && uniform() < options.occlusion)
+        {
+            station.covered[i] = options.occlusion_sweeps;
+        }
+        if (!visible || station.covered[i] > 0)
+        {
+            station.readout.num_pulse_detections[index] = 0;
+            if (visible)
+            {
+                station.covered[i]--;
+                counts.covered++;
+            }
+            else
+            {
+                counts.missed++;
+            }
+            continue;
+        }
+
+        // inverse of convertTicksTo2DPositions()
+        double seconds = axis == 0 ? (90.0 - angle) / (60.0 * 360.0) : (angle + 90.0) / (60.0 * 360.0);
+        double ticks = seconds * scale + gaussian(options.tick_noise);
+        uint32_t detections = 1;
+        if (options.reflections > 0.0 && uniform() < options.reflections)
+        {
+            detections = 2;
+            counts.reflections++;
+            if (uniform() < 0.5)
+            {
+                ticks += (uniform() - 0.5) * 4000.0;
+            }
+        }
+        station.readout.clock_ticks[index] = (uint32_t)lround(ticks > 0.0 ? ticks : 0.0);
+        station.readout.num_pulse_detections[index] = detections;
+        station.readout.pulse_width[index] =
+            (uint32_t)lround(scale * (DIODE_SIZE_MM * facing / distance) / (2.0 * M_PI * 60.0));
+        counts.hits++;
+    }
+    station.readout.axis = axis;
+    counts.sweeps++;
+}
+
+static bool parseOptions(int argc, char **argv, Options &options)
+{
+    options = Options();
+    options.tick_noise = 10.0;
+    options.occlusion_sweeps = 1;
+    options.imu_rate = 1000.0;
+    options.gyr_noise = 0.1;
+    options.acc_noise = 0.02;
+    options.duration = -1.0;
+    options.seed = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "--two-stations") == 0)
+        {
+            options.two_stations = true;
+        }
+        else if (strcmp(arg, "--script") == 0 && has_value)
+        {
+            options.script_path = argv[++i];
+        }
+        else if (strncmp(arg, "--", 2) == 0 && has_value)
+        {
+            double value = atof(argv[++i]);
+            if (strcmp(arg, "--tick-noise") == 0)
+                options.tick_noise = value;
+            else if (strcmp(arg, "--occlusion") == 0)
+                options.occlusion = value;
+            else if (strcmp(arg, "--occlusion-sweeps") == 0)
+                options.occlusion_sweeps = value >= 1.0 ? (int)value : 1;
+            else if (strcmp(arg, "--reflections") == 0)
+                options.reflections = value;
+            else if (strcmp(arg, "--drift") == 0)
+                options.drift_ppm = value;
+            else if (strcmp(arg, "--imu-rate") == 0 && value > 0.0)
+                options.imu_rate = value;
+            else if (strcmp(arg, "--gyr-noise") == 0)
+                options.gyr_noise = value;
+            else if (strcmp(arg, "--gyr-bias") == 0)
+                options.gyr_bias = value;
+            else if (strcmp(arg, "--acc-noise") == 0)
+                options.acc_noise = value;
+            else if (strcmp(arg, "--pitch") == 0)
+                options.pitch = value;
+            else if (strcmp(arg, "--roll") == 0)
+                options.roll = value;
+            else if (strcmp(arg, "--duration") == 0)
+                options.duration = value;
+            else if (strcmp(arg, "--seed") == 0)
+                options.seed = (unsigned long)value;
+            else
+                return false;
+        }
+        else if (options.output_path == NULL && strncmp(arg, "--", 2) != 0)
+        {
+            options.output_path = arg;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return options.output_path != NULL;
+}
+
+static char *readFile(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *text = (char *)malloc(length + 1);
+    if (text != NULL)
+    {
+        text[fread(text, 1, length, file)] = '\0';
+    }
+    fclose(file);
+    return text;
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        fprintf(stderr, "usage: %s [knobs] [--script <trajectory.txt>] [--two-stations] <output.vrsession>\n"
+                        "knobs are listed at the top of generate_trace.cpp\n", argv[0]);
+        return 2;
+    }
+    random_state = options.seed != 0 ? options.seed : 1;
+
+    char *script = options.script_path != NULL ? readFile(options.script_path) : NULL;
+    if (options.script_path != NULL && script == NULL)
+    {
+        fprintf(stderr, "can't read %s\n", options.script_path);
+        return 1;
+    }
+    static Keyframe keyframes[MAX_KEYFRAMES];
+    int count = parseScript(script != NULL ? script : DEFAULT_SCRIPT, keyframes);
+    free(script);
+    if (count == 0)
+    {
+        fprintf(stderr, "no keyframes in %s\n", options.script_path);
+        return 1;
+    }
+    double duration = options.duration >= 0.0 ? options.duration : keyframes[count - 1].t;
+
+    SessionLogWriter writer;
+    if (!writer.open(options.output_path, options.two_stations ? "synthetic, two stations" : "synthetic"))
+    {
+        fprintf(stderr, "can't create %s\n", options.output_path);
+        return 1;
+    }
+    writer.setBaseStation(options.pitch, options.roll);
+
+    StationState stations[2] = {};
+    int num_stations = options.two_stations ? 2 : 1;
+    for (int s = 0; s < 2; s++)
+    {
+        StationState &station = stations[s];
+        rotationY(s == 0 ? 0.0 : 45.0 * DEG, station.pose.R);
+        station.pose.t[0] = s == 0 ? 0.0 : 1000.0;
+        station.mode = options.two_stations ? 1 + s : 0; // B and C, or A
+        station.readout.station = s;
+        station.readout.mode = station.mode;
+        station.readout.pitch = s == 0 ? options.pitch : 0.0;
+        station.readout.roll = s == 0 ? options.roll : 0.0;
+    }
+
+    // Gravity in the frame of station 0, tilted by its pitch (about x) and roll (about z)
+    double Rx[3][3], Rz[3][3], tilt[3][3];
+    rotationX(options.pitch * DEG, Rx);
+    rotationZ(options.roll * DEG, Rz);
+    multiply(Rx, Rz, tilt);
+    double world_up[3] = {0.0, 1.0, 0.0};
+    double up[3];
+    rotate(tilt, world_up, up, true);
+
+    double gyr_bias[3];
+    for (int i = 0; i < 3; i++)
+    {
+        gyr_bias[i] = gaussian(options.gyr_bias);
+    }
+
+    // VRduino timestamps run fast or slow with the drift of its clock
+    double clock = 1.0 + options.drift_ppm * 1e-6;
+    double imu_period = 1.0 / options.imu_rate;
+    long imu_index = 0;
+    long sweep_index = 0;
+    int label = -1;
+    Counts counts = {};
+    bool ok = true;
+
+    while (ok)
+    {
+        double imu_t = imu_index * imu_period;
+        // sweep slots: single station H,V,H,V..., two stations 0H,0V,1H,1V,...
+        int slot = options.two_stations ? sweep_index % 4 : sweep_index % 2;
+        int s = slot / 2;
+        int axis = slot % 2;
+        double sweep_start = sweep_index * SWEEP_PERIOD_US * 1e-6 + (s == 1 ? STATION_OFFSET_US * 1e-6 : 0.0);
+        double sweep_end = sweep_start + SWEEP_PERIOD_US * 1e-6; // read out at the next sync pulse
+        if (imu_t > duration && sweep_end > duration)
+        {
+            break;
+        }
+
+        if (imu_t <= sweep_end)
+        {
+            double values[6];
+            int segment = evaluate(keyframes, count, imu_t, values);
+            uint64_t timestamp_us = (uint64_t)llround(imu_t * clock * 1e6);
+            if (segment != label)
+            {
+                SessionMarkerRecord marker = {SESSION_MARKER_SEGMENT, segment};
+                ok = ok && writer.add(SESSION_CHANNEL_MARKER, timestamp_us, &marker);
+                label = segment;
+            }
+
+            // angular rate from neighbouring orientations, acceleration from neighbouring positions
+            const double h = 1e-3;
+            Pose before = boardPose(keyframes, count, imu_t - h);
+            Pose now = boardPose(keyframes, count, imu_t);
+            Pose after = boardPose(keyframes, count, imu_t + h);
+            double delta[3][3];
+            double before_T[3][3];
+            for (int i = 0; i < 3; i++)
+            {
+                for (int j = 0; j < 3; j++)
+                {
+                    before_T[i][j] = before.R[j][i];
+                }
+            }
+            multiply(before_T, after.R, delta);
+            double q[4];
+            quaternionFromRotation(delta, q);
+            double angle = 2.0 * atan2(sqrt(q[1] * q[1] + q[2] * q[2] + q[3] * q[3]), q[0]);
+            double norm = sqrt(q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+            double acc_station[3];
+            for (int i = 0; i < 3; i++)
+            {
+                acc_station[i] = (after.t[i] - 2.0 * now.t[i] + before.t[i]) / (h * h) * 1e-3 + GRAVITY * up[i];
+            }
+            SessionImuRecord imu;
+            double acc_body[3];
+            rotate(now.R, acc_station, acc_body, true);
+            for (int i = 0; i < 3; i++)
+            {
+                double rate = norm > 0.0 ? q[1 + i] / norm * angle / (2.0 * h) : 0.0;
+                imu.gyr[i] = (float)(rate / DEG + gyr_bias[i] + gaussian(options.gyr_noise));
+                imu.acc[i] = (float)(acc_body[i] + gaussian(options.acc_noise));
+            }
+            ok = ok && writer.add(SESSION_CHANNEL_IMU, timestamp_us, &imu);
+
+            for (int station = 0; station < num_stations; station++)
+            {
+                Pose pose = poseInStation(now, stations[station].pose);
+                SessionPoseRecord record = {};
+                record.station = station;
+                double q_pose[4];
+                quaternionFromRotation(pose.R, q_pose);
+                for (int i = 0; i < 3; i++)
+                {
+                    record.position[i] = (float)pose.t[i];
+                }
+                for (int i = 0; i < 4; i++)
+                {
+                    record.quaternion[i] = (float)q_pose[i];
+                }
+                ok = ok && writer.add(SESSION_CHANNEL_POSE, timestamp_us, &record);
+            }
+            imu_index++;
+        }
+        else
+        {
+            // the rotor passes the board about half way through the sweep
+            StationState &station = stations[s];
+            sweep(options, keyframes, count, station, axis, sweep_start + 0.5 * SWEEP_PERIOD_US * 1e-6, counts);
+            uint64_t timestamp_us = (uint64_t)llround(sweep_end * clock * 1e6);
+            ok = ok && writer.add(SESSION_CHANNEL_SWEEP, timestamp_us, &station.readout);
+            if (s == 0 && axis == 1)
+            {
+                SessionLighthouseRecord frame;
+                memcpy(frame.clock_ticks, station.readout.clock_ticks, sizeof(frame.clock_ticks));
+                ok = ok && writer.add(SESSION_CHANNEL_LIGHTHOUSE, timestamp_us, &frame);
+            }
+            sweep_index++;
+        }
+    }
+
+    if (!writer.close() || !ok)
+    {
+        fprintf(stderr, "writing %s failed\n", options.output_path);
+        return 1;
+    }
+    unsigned long diodes = counts.hits + counts.missed + counts.covered;
+    printf("%.2f s, %ld IMU readings, %lu sweeps written to %s\n", duration, imu_index, counts.sweeps,
+           options.output_path);
+    printf("diode sweeps: %lu hit, %lu out of view, %lu covered, %lu inter-reflections (%.1f%% hit)\n", counts.hits,
+           counts.missed, counts.covered, counts.reflections, diodes > 0 ? 100.0 * counts.hits / diodes : 0.0);
+    return 0;
+}
@@ -0,0 +1,17 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Stand-in for the Adafruit ICM20948 driver, see Adafruit_ICM20X.h in this directory.
+*/
+
+#ifndef HOST_ADAFRUIT_ICM20948_H
+#define HOST_ADAFRUIT_ICM20948_H
+
+#include "Adafruit_ICM20X.h"
+
+class Adafruit_ICM20948 : public Adafruit_ICM20X {
+public:
+    bool begin_I2C(uint8_t, TwoWire *) { return false; }
+};
+
+#endif
@@ -0,0 +1,30 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Stand-in for the Adafruit ICM20X driver, see Arduino.h in this directory. There is no sensor on the host: events are
+zero and getEvent() returns false, the trackers are fed with simulated readings instead.
+*/
+
+#ifndef HOST_ADAFRUIT_ICM20X_H
+#define HOST_ADAFRUIT_ICM20X_H
+
+#include "Adafruit_Sensor.h"
+#include "Wire.h"
+
+class Adafruit_ICM20X {
+public:
+    bool getEvent(sensors_event_t *accel, sensors_event_t *gyro, sensors_event_t *temp, sensors_event_t *mag = NULL)
+    {
+        sensors_event_t *events[4] = {accel, gyro, temp, mag};
+        for (int i = 0; i < 4; i++)
+        {
+            if (events[i] != NULL)
+            {
+                memset(events[i], 0, sizeof(sensors_event_t));
+            }
+        }
+        return false;
+    }
+};
+
+#endif
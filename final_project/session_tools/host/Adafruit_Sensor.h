@@ -0,0 +1,24 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Stand-in for the Adafruit unified sensor types that OrientationTracker reads the ICM20948 with, see Arduino.h in this
+directory.
+*/
+
+#ifndef HOST_ADAFRUIT_SENSOR_H
+#define HOST_ADAFRUIT_SENSOR_H
+
+struct sensors_vec_t {
+    float x;
+    float y;
+    float z;
+};
+
+struct sensors_event_t {
+    sensors_vec_t acceleration; // m/s^2
+    sensors_vec_t gyro;         // rad/s
+    sensors_vec_t magnetic;     // uT
+    float temperature;          // degrees C
+};
+
+#endif
@@ -0,0 +1,13 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+The objects of the Arduino stand-ins, see Arduino.h in this directory.
+*/
+
+#include "Arduino.h"
+#include "Wire.h"
+
+HostSerial Serial;
+
+TwoWire Wire;
+TwoWire Wire1;
@@ -0,0 +1,81 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+The parts of the Arduino core that the VRduino's trackers (PoseTracker, OrientationTracker, Lighthouse) and their math
+use, so that they compile unchanged on the host for pose_benchmark. KINETISL is defined because PulsePosition.h only
+declares its classes for it, F_PLL is set so that the timing still matches a Teensy 3.2: CLOCKS_PER_SECOND in
+PoseMath.h and CLOCKS_PER_MICROSECOND in PulsePosition.h count 48 MHz. Pins and interrupts do nothing, Serial output
+is dropped.
+
+micros() is the host clock, which only moves when set with hostMicros(), e.g. to the timestamp of a replayed record.
+delay() returns at once.
+
+Include system headers before this one, min/max/abs are macros as in the Arduino core.
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARDUINO 100
+#define KINETISL 1
+#define F_PLL 96000000
+#define F_BUS 48000000
+
+#define PI 3.1415926535897932384626433832795
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define FALLING 2
+#define RISING 3
+
+#define HEX 16
+#define BIN 2
+
+#undef abs
+#define abs(x) ((x) > 0 ? (x) : -(x))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+inline unsigned long &hostMicros()
+{
+    static unsigned long now_us = 0;
+    return now_us;
+}
+
+inline unsigned long micros() { return hostMicros(); }
+inline unsigned long millis() { return hostMicros() / 1000; }
+inline void delay(unsigned long) {}
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+
+class String {
+public:
+    String(const char *text = "") : text(text) {}
+    const char *c_str() const { return text; }
+
+private:
+    const char *text;
+};
+
+class HostSerial {
+public:
+    template <typename T> void print(const T &) {}
+    template <typename T> void print(const T &, int) {}
+    template <typename T> void println(const T &) {}
+    template <typename T> void println(const T &, int) {}
+    void println() {}
+};
+
+extern HostSerial Serial; // defined in Arduino.cpp
+
+#endif
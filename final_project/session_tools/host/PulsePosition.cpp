@@ -0,0 +1,28 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Stand-in for the VRduino's PulsePosition.cpp, see Arduino.h in this directory. There are no input capture timers on
+the host, so the photodiode inputs of Lighthouse never see a pulse: its timings only change when recorded sweeps are
+replayed with Lighthouse::replaySweepTimings().
+*/
+
+#include "../../vr_application/vrduino/PulsePosition.h"
+
+PulsePositionInput::PulsePositionInput(void) : available_flag(false) {}
+
+PulsePositionInput::PulsePositionInput(int) : available_flag(false) {}
+
+bool PulsePositionInput::begin(uint8_t)
+{
+    return true;
+}
+
+int PulsePositionInput::available(void)
+{
+    return -1;
+}
+
+float PulsePositionInput::read(uint8_t)
+{
+    return 0.0f;
+}
@@ -0,0 +1,7 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Pre-1.0 name of Arduino.h, which MatrixMath.h includes when ARDUINO isn't defined yet.
+*/
+
+#include "Arduino.h"
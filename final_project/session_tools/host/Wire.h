@@ -0,0 +1,25 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Stand-in for the Arduino Wire library, see Arduino.h in this directory. There is no bus on the host, the calls do
+nothing.
+*/
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+    void begin() {}
+    void begin(uint8_t) {}
+    void setSCL(uint8_t) {}
+    void setSDA(uint8_t) {}
+};
+
+// defined in Arduino.cpp
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif
@@ -0,0 +1,323 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Link report of the controllers streaming to vr_handheld_controller_receiver: runs LinkStats
+(vr_handheld_lib/VRHandheld/LinkStats.h) over the receiver's binary sample frames (SerialFrame.h) and prints the
+latency percentiles, interarrival jitter, drop rate and clock drift of every controller.
+
+The frames carry the controller's timestamp of each sample but not when it reached the receiver, so arrivals are
+stamped on the host when the bytes are read from the serial port: the latencies then also hold the USB transfer to
+the host (polled every 1 ms at full speed), frames read together share their arrival time like the samples of one
+notification do. Latencies are counted once LinkStats' clock offset estimate settled, after the first 2 s. Sequence
+gaps count every sample lost between the controller and the host.
+
+Input is one of:
+    a serial port   read until Ctrl-C (or --seconds), 'b' is sent first to select binary output, the receiver has to
+                    be waiting for it at startup. --save writes a timestamped capture of the frames.
+    a timestamped capture written by --save, replayed with its arrival times
+    a raw capture (e.g. `cat /dev/ttyACM0 > capture.bin`), which has no arrival times: only sample counts and drops
+                    are reported
+
+Anything between frames, such as the receiver's status text and gesture frames, is skipped.
+
+Usage: link_report [--seconds <s>] [--save <link.capture>] <serial port | link.capture | capture.bin>
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <LinkStats.h>
+#include <SerialFrame.h>
+
+#define LINK_CAPTURE_MAGIC "VRLINK1\n"
+#define LINK_CAPTURE_MAGIC_LENGTH 8
+#define LINK_CAPTURE_RECORD_LENGTH (4 + SERIAL_FRAME_LENGTH_BYTES - 1) // uint32 arrival + frame without delimiter
+
+struct Controller {
+    bool seen;
+    LinkStats stats;
+};
+
+struct Report {
+    Controller controllers[SERIAL_FRAME_MAX_CONTROLLER + 1];
+    bool timed; // arrival times are known
+    unsigned long frames;
+    unsigned long skipped;
+    FILE *save;
+    bool save_ok;
+};
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void requestStop(int)
+{
+    stop_requested = 1;
+}
+
+static uint32_t hostMicros()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000u + now.tv_nsec / 1000);
+}
+
+static void writeUint32(uint8_t *out, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        out[i] = (uint8_t)(value >> (8*i));
+    }
+}
+
+static uint32_t readUint32(const uint8_t *in)
+{
+    return in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+// Feeds one chunk between delimiters, arrival_us is ignored for untimed input
+static void addChunk(Report &report, const uint8_t *chunk, int length, uint32_t arrival_us)
+{
+    ImuSample sample;
+    uint8_t controller;
+    if (!decodeSampleFrame(chunk, length, sample, controller))
+    {
+        report.skipped++;
+        return;
+    }
+    report.frames++;
+    report.controllers[controller].seen = true;
+    // Without arrival times the samples arrive right when they are taken, which keeps the drop count and nothing else
+    report.controllers[controller].stats.add(sample, report.timed ? arrival_us : sample.timestamp_us);
+    if (report.save)
+    {
+        uint8_t record[LINK_CAPTURE_RECORD_LENGTH];
+        writeUint32(record, arrival_us);
+        memcpy(record + 4, chunk, length);
+        report.save_ok = report.save_ok && fwrite(record, 1, sizeof(record), report.save) == sizeof(record);
+    }
+}
+
+// Splits a byte stream at the zero delimiters, keeps the partial chunk between calls
+struct Splitter {
+    uint8_t chunk[SERIAL_FRAME_LENGTH_BYTES];
+    int length;
+    bool overlong;
+};
+
+static void splitBytes(Report &report, Splitter &splitter, const uint8_t *data, int count, uint32_t arrival_us)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (data[i] != 0)
+        {
+            if (splitter.length < (int)sizeof(splitter.chunk))
+            {
+                splitter.chunk[splitter.length++] = data[i];
+            }
+            else
+            {
+                splitter.overlong = true;
+            }
+            continue;
+        }
+        if (splitter.overlong)
+        {
+            report.skipped++;
+        }
+        else
+        {
+            addChunk(report, splitter.chunk, splitter.length, arrival_us);
+        }
+        splitter.length = 0;
+        splitter.overlong = false;
+    }
+}
+
+static bool readPort(Report &report, const char *path, double seconds)
+{
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "can't open %s\n", path);
+        return false;
+    }
+    struct termios tty;
+    if (tcgetattr(fd, &tty) == 0)
+    {
+        cfmakeraw(&tty);
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 1; // return at least every 100 ms so Ctrl-C and --seconds are seen
+        tcsetattr(fd, TCSANOW, &tty);
+        tcflush(fd, TCIFLUSH);
+    }
+    const uint8_t select_binary = 'b';
+    if (write(fd, &select_binary, 1) != 1)
+    {
+        fprintf(stderr, "can't write to %s\n", path);
+    }
+    signal(SIGINT, requestStop);
+    fprintf(stderr, "reading %s, Ctrl-C to stop\n", path);
+
+    static Splitter splitter;
+    uint8_t buffer[4096];
+    uint32_t start_us = hostMicros();
+    while (!stop_requested && (seconds <= 0 || (hostMicros() - start_us) < seconds * 1e6))
+    {
+        ssize_t count = read(fd, buffer, sizeof(buffer));
+        if (count < 0)
+        {
+            break;
+        }
+        splitBytes(report, splitter, buffer, (int)count, hostMicros());
+    }
+    close(fd);
+    return true;
+}
+
+static bool readCapture(Report &report, const char *path)
+{
+    FILE *capture = fopen(path, "rb");
+    if (capture == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", path);
+        return false;
+    }
+    uint8_t magic[LINK_CAPTURE_MAGIC_LENGTH];
+    size_t count = fread(magic, 1, sizeof(magic), capture);
+    report.timed = count == sizeof(magic) && memcmp(magic, LINK_CAPTURE_MAGIC, sizeof(magic)) == 0;
+    if (report.timed)
+    {
+        uint8_t record[LINK_CAPTURE_RECORD_LENGTH];
+        while (fread(record, 1, sizeof(record), capture) == sizeof(record))
+        {
+            addChunk(report, record + 4, SERIAL_FRAME_LENGTH_BYTES - 1, readUint32(record));
+        }
+    }
+    else
+    {
+        static Splitter splitter;
+        splitBytes(report, splitter, magic, (int)count, 0);
+        uint8_t buffer[4096];
+        while ((count = fread(buffer, 1, sizeof(buffer), capture)) > 0)
+        {
+            splitBytes(report, splitter, buffer, (int)count, 0);
+        }
+    }
+    fclose(capture);
+    return true;
+}
+
+static void printReport(const Report &report)
+{
+    printf("%lu sample frames, %lu chunks skipped%s\n", report.frames, report.skipped,
+           report.timed ? "" : ", no arrival times in a raw capture: latency and jitter not measured");
+    for (int id = 0; id <= SERIAL_FRAME_MAX_CONTROLLER; id++)
+    {
+        const Controller &controller = report.controllers[id];
+        if (!controller.seen)
+        {
+            continue;
+        }
+        const LinkStats &stats = controller.stats;
+        printf("controller %d: received %lu, dropped %lu (%.3f%%)\n", id, (unsigned long)stats.received(),
+               (unsigned long)stats.dropped(), 100.0f * stats.dropRate());
+        if (!report.timed)
+        {
+            continue;
+        }
+        const LatencyHistogram &latency = stats.latency();
+        // Percentiles are the upper bounds of power of two buckets, see LatencyHistogram.h
+        printf("  latency us: n=%lu mean=%.0f p50<=%lu p90<=%lu p99<=%lu p99.9<=%lu max=%lu\n",
+               (unsigned long)latency.count(), latency.meanUs(), (unsigned long)latency.percentileUs(50),
+               (unsigned long)latency.percentileUs(90), (unsigned long)latency.percentileUs(99),
+               (unsigned long)latency.percentileUs(99.9f), (unsigned long)latency.maxUs());
+        printf("  jitter us: %.0f, drift ppm: %.1f\n", stats.jitterUs(), stats.driftPpm());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 0.0;
+    const char *save_path = NULL;
+    const char *input = NULL;
+    bool usage = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+        {
+            seconds = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc)
+        {
+            save_path = argv[++i];
+        }
+        else if (argv[i][0] != '-' && input == NULL)
+        {
+            input = argv[i];
+        }
+        else
+        {
+            usage = true;
+        }
+    }
+    if (usage || input == NULL)
+    {
+        fprintf(stderr, "usage: %s [--seconds <s>] [--save <link.capture>] <serial port | link.capture | capture.bin>\n",
+                argv[0]);
+        return 2;
+    }
+
+    static Report report;
+    int fd = open(input, O_RDONLY | O_NOCTTY | O_NONBLOCK);
+    bool port = fd >= 0 && isatty(fd);
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    if (save_path != NULL)
+    {
+        if (!port)
+        {
+            fprintf(stderr, "--save needs a serial port\n");
+            return 2;
+        }
+        report.save = fopen(save_path, "wb");
+        if (report.save == NULL)
+        {
+            fprintf(stderr, "can't create %s\n", save_path);
+            return 1;
+        }
+        report.save_ok = fwrite(LINK_CAPTURE_MAGIC, 1, LINK_CAPTURE_MAGIC_LENGTH, report.save) == LINK_CAPTURE_MAGIC_LENGTH;
+    }
+
+    bool ok;
+    if (port)
+    {
+        report.timed = true;
+        ok = readPort(report, input, seconds);
+    }
+    else
+    {
+        ok = readCapture(report, input);
+    }
+    if (report.save)
+    {
+        if (fclose(report.save) != 0 || !report.save_ok)
+        {
+            fprintf(stderr, "writing %s failed\n", save_path);
+            ok = false;
+        }
+    }
+    if (!ok)
+    {
+        return 1;
+    }
+    printReport(report);
+    return 0;
+}
@@ -0,0 +1,684 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Runs every pose and orientation pipeline of the VRduino over session logs (vr_handheld_lib/SessionLog/SessionLog.h)
+and reports accuracy against the ground truth of generated traces (generate_trace) next to the cost of each update,
+so changes to the tracking math can be judged by numbers instead of by eye in the visualizer.
+
+The trackers of vr_application/vrduino run unchanged, compiled for the host with the stand-ins in host/. Recorded
+sweeps go in through PoseTracker::replayStationSweep() as if the photodiodes had just seen them, IMU readings through
+OrientationTracker::setSimulatedImu(), and micros() reads the timestamp of the record being replayed:
+    homography    PoseTracker::processLighthouse(), one homography solve per sweep of the tracked station
+    sweep-ekf     same with setSweepUpdate(true)
+    two-station   same with setTrackBothStations(true), poses of both stations fused in the frame of station 0
+    imu-gyro      OrientationTracker::processImu(), quaternionGyr
+    imu-comp-0.9  OrientationTracker::processImu(), quaternionComp with alpha 0.9 (vrduino.ino)
+    imu-comp-0.99 same with alpha 0.99
+The tracked station is station 0, its mode is taken from the trace. Pipelines whose input isn't in a trace are
+skipped: sessions converted from the simulation tables only have lighthouse frames, which homography replays with
+the tracker's simulation mode (setSimulatedLighthouse()) that takes all of them as valid.
+
+Columns:
+    updates      updates that produced an estimate, of all attempts (tracker calls with new timings or IMU readings,
+                 plus readings the recorder dropped)
+    dropout      share of attempts without an estimate
+    position     RMS distance to the true position in mm
+    angle        RMS angle to the true orientation in degrees. Orientation trackers start at identity and can't
+                 observe their heading, so their estimates are turned about gravity to match the heading of the
+                 first one with the truth. Their tilt is scored as it is, converging from identity included.
+    ns/update    host time of one tracker call, the fastest of --repeat runs
+Estimates are compared with the ground truth at the time they become available, so latency counts as error. Traces
+without ground truth only report dropout and cost.
+
+--csv writes the results in machine readable form. --baseline compares with such a file and exits with 1 if any
+pipeline got worse than the baseline by more than --tolerance (relative, default 0.1) in position, angle or dropout,
+or by more than --cost-tolerance in cost if given (cost depends on the host, so it isn't checked by default).
+
+Usage: pose_benchmark [--csv <results.csv>] [--baseline <baseline.csv>] [--tolerance <t>] [--cost-tolerance <t>]
+                      [--repeat <n>] <trace.vrsession>...
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <SessionLog.h>
+#include "../vr_application/vrduino/PoseTracker.h"
+
+#define MAX_RESULTS 1024
+#define TRACE_NAME_LENGTH 64
+
+// Floors of the regression check, so that noise on near perfect results doesn't fail it
+#define POSITION_FLOOR_MM 0.01
+#define ANGLE_FLOOR_DEG 0.01
+#define DROPOUT_FLOOR 0.001
+
+// alpha of the complementary filter in vrduino.ino, the pose pipelines don't use it
+#define IMU_FILTER_ALPHA 0.9
+
+// True pose of the board in the frame of station 0
+struct GroundTruth {
+    int count;
+    uint64_t *timestamps_us;
+    double *positions; // x,y,z per record
+    Quaternion *quaternions;
+    Quaternion tilt; // turns the vertical of the orientation trackers (y) into gravity in the frame of station 0
+};
+
+struct Result {
+    char trace[TRACE_NAME_LENGTH];
+    const char *variant;
+    unsigned long attempts;
+    unsigned long updates;
+    unsigned long compared;
+    unsigned long angles_compared;
+    double position_sq;
+    double angle_sq;
+    double seconds;
+    bool aligned;
+    Quaternion alignment;
+};
+
+struct Variant {
+    const char *name;
+    // returns false if the trace doesn't have the input of the pipeline
+    bool (*run)(const SessionLogReader &reader, const GroundTruth &truth, double parameter, Result &result);
+    double parameter;
+};
+
+static double seconds()
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static bool loadGroundTruth(const SessionLogReader &reader, GroundTruth &truth)
+{
+    uint64_t count = reader.recordCount(SESSION_CHANNEL_POSE);
+    truth.count = 0;
+    // gravity is y tilted by the pitch (about x) and roll (about z) of station 0, as in generate_trace
+    double pitch = reader.header().base_station_pitch * M_PI / 180.0;
+    double roll = reader.header().base_station_roll * M_PI / 180.0;
+    double up[3] = {cos(pitch) * sin(roll), cos(pitch) * cos(roll), -sin(pitch)};
+    truth.tilt = Quaternion(1.0 + up[1], up[2], 0.0, -up[0]).normalize();
+    truth.timestamps_us = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    truth.positions = (double *)malloc((count + 1) * 3 * sizeof(double));
+    truth.quaternions = new Quaternion[count + 1];
+    if (truth.timestamps_us == NULL || truth.positions == NULL)
+    {
+        return false;
+    }
+    for (int i = 0; i < reader.chunkCount(); i++)
+    {
+        SessionChunk chunk = reader.chunk(i);
+        if (chunk.channel != SESSION_CHANNEL_POSE)
+        {
+            continue;
+        }
+        const SessionPoseRecord *poses = sessionPoseRecords(chunk);
+        for (uint32_t j = 0; j < chunk.count; j++)
+        {
+            if (poses[j].station != 0)
+            {
+                continue;
+            }
+            truth.timestamps_us[truth.count] = chunk.timestamps_us[j];
+            for (int k = 0; k < 3; k++)
+            {
+                truth.positions[3 * truth.count + k] = poses[j].position[k];
+            }
+            truth.quaternions[truth.count] = Quaternion(poses[j].quaternion[0], poses[j].quaternion[1],
+                                                        poses[j].quaternion[2], poses[j].quaternion[3]);
+            truth.count++;
+        }
+    }
+    return true;
+}
+
+static void freeGroundTruth(GroundTruth &truth)
+{
+    free(truth.timestamps_us);
+    free(truth.positions);
+    delete[] truth.quaternions;
+}
+
+// True pose at timestamp_us, position interpolated, orientation of the closest record before
+static bool groundTruthAt(const GroundTruth &truth, uint64_t timestamp_us, double position[3], Quaternion &q)
+{
+    if (truth.count == 0 || timestamp_us < truth.timestamps_us[0] ||
+        timestamp_us > truth.timestamps_us[truth.count - 1])
+    {
+        return false;
+    }
+    int low = 0;
+    int high = truth.count - 1;
+    while (low < high)
+    {
+        int middle = (low + high + 1) / 2;
+        if (truth.timestamps_us[middle] <= timestamp_us)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+    int next = low + 1 < truth.count ? low + 1 : low;
+    uint64_t span = truth.timestamps_us[next] - truth.timestamps_us[low];
+    double t = span > 0 ? (double)(timestamp_us - truth.timestamps_us[low]) / span : 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        position[i] = (1.0 - t) * truth.positions[3 * low + i] + t * truth.positions[3 * next + i];
+    }
+    q = truth.quaternions[low];
+    return true;
+}
+
+static double angleBetween(const Quaternion &a, const Quaternion &b)
+{
+    double dot = fabs(a.q[0] * b.q[0] + a.q[1] * b.q[1] + a.q[2] * b.q[2] + a.q[3] * b.q[3]);
+    return 2.0 * acos(dot < 1.0 ? dot : 1.0) * 180.0 / M_PI;
+}
+
+// Adds the error of an estimate, position is NULL for orientation trackers
+static void compare(Result &result, const GroundTruth &truth, uint64_t timestamp_us, const double *position,
+                    Quaternion q)
+{
+    double true_position[3];
+    Quaternion true_q;
+    if (!groundTruthAt(truth, timestamp_us, true_position, true_q))
+    {
+        return;
+    }
+    q.normalize();
+    if (position != NULL)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            double error = position[i] - true_position[i];
+            result.position_sq += error * error;
+        }
+        result.compared++;
+    }
+    else
+    {
+        if (!result.aligned)
+        {
+            // the trackers can't observe their heading, only the turn about gravity that brings the first estimate
+            // closest to the truth is taken out, so errors in tilt still count
+            Quaternion tilt = truth.tilt;
+            Quaternion offset = Quaternion().multiply(Quaternion().multiply(tilt.clone().inverse(), true_q),
+                                                      q.clone().inverse());
+            Quaternion heading(offset.q[0], 0.0, offset.q[2], 0.0);
+            if (heading.length() > 1e-9)
+            {
+                heading.normalize();
+            }
+            else
+            {
+                heading = Quaternion();
+            }
+            result.alignment = Quaternion().multiply(truth.tilt, heading);
+            result.aligned = true;
+        }
+        q = Quaternion().multiply(result.alignment, q);
+    }
+    double angle = angleBetween(q, true_q);
+    result.angle_sq += angle * angle;
+    result.angles_compared++;
+}
+
+// Copies the records of a channel into one array with their timestamps, the trackers replay them from there
+static uint8_t *gatherRecords(const SessionLogReader &reader, int channel, int record_length, uint64_t **timestamps_us)
+{
+    uint64_t count = reader.recordCount(channel);
+    uint8_t *records = (uint8_t *)malloc((count + 1) * record_length);
+    *timestamps_us = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    if (records == NULL || *timestamps_us == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    uint64_t n = 0;
+    for (int i = 0; i < reader.chunkCount(); i++)
+    {
+        SessionChunk chunk = reader.chunk(i);
+        if (chunk.channel != channel)
+        {
+            continue;
+        }
+        for (uint32_t j = 0; j < chunk.count; j++, n++)
+        {
+            memcpy(records + n * record_length, chunk.records + (size_t)j * chunk.record_length, record_length);
+            (*timestamps_us)[n] = chunk.timestamps_us[j];
+        }
+    }
+    return records;
+}
+
+// Mode of station 0 once the trace knows it, the tracker follows that station like vrduino.ino does its baseStationMode
+static int trackedMode(const SessionLogReader &reader)
+{
+    SessionCursor cursor(reader, 1u << SESSION_CHANNEL_SWEEP);
+    SessionRecord record;
+    while (cursor.next(record))
+    {
+        const SessionSweepRecord *sweep = (const SessionSweepRecord *)record.data;
+        if (sweep->station == 0 && sweep->mode >= 0)
+        {
+            return sweep->mode;
+        }
+    }
+    return -1;
+}
+
+static bool hasStation(const SessionLogReader &reader, int station)
+{
+    SessionCursor cursor(reader, 1u << SESSION_CHANNEL_SWEEP);
+    SessionRecord record;
+    while (cursor.next(record))
+    {
+        if (((const SessionSweepRecord *)record.data)->station == station)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Adds the outcome of one PoseTracker::processLighthouse(), -2 means there were no new timings for it
+static void addPose(Result &result, const GroundTruth &truth, uint64_t timestamp_us, const PoseTracker &tracker,
+                    int updated)
+{
+    if (updated == -2)
+    {
+        return;
+    }
+    result.attempts++;
+    if (updated == 1)
+    {
+        result.updates++;
+        compare(result, truth, timestamp_us, tracker.getPosition(), tracker.getQuaternionHm());
+    }
+}
+
+// Feeds every sweep of both stations to the tracker and runs processLighthouse() after each one, as the main loop does
+// after each sync pulse
+static void replaySweeps(const SessionLogReader &reader, const GroundTruth &truth, PoseTracker &tracker,
+                         Result &result)
+{
+    SessionCursor cursor(reader, 1u << SESSION_CHANNEL_SWEEP);
+    SessionRecord record;
+    while (cursor.next(record))
+    {
+        const SessionSweepRecord *sweep = (const SessionSweepRecord *)record.data;
+        if (sweep->station > 1)
+        {
+            continue;
+        }
+        unsigned long ticks[8];
+        unsigned long detections[8];
+        unsigned long widths[8];
+        for (int i = 0; i < 8; i++)
+        {
+            ticks[i] = sweep->clock_ticks[i];
+            detections[i] = sweep->num_pulse_detections[i];
+            widths[i] = sweep->pulse_width[i];
+        }
+        tracker.replayStationSweep(sweep->station, ticks, detections, widths, sweep->pitch, sweep->roll, sweep->mode,
+                                   sweep->axis);
+        hostMicros() = record.timestamp_us;
+        double start = seconds();
+        int updated = tracker.processLighthouse();
+        result.seconds += seconds() - start;
+        addPose(result, truth, record.timestamp_us, tracker, updated);
+    }
+}
+
+static bool runHomography(const SessionLogReader &reader, const GroundTruth &truth, double, Result &result)
+{
+    if (reader.recordCount(SESSION_CHANNEL_SWEEP) > 0)
+    {
+        PoseTracker tracker(IMU_FILTER_ALPHA, trackedMode(reader));
+        replaySweeps(reader, truth, tracker, result);
+        return true;
+    }
+    int count = (int)reader.recordCount(SESSION_CHANNEL_LIGHTHOUSE);
+    if (count == 0)
+    {
+        return false;
+    }
+    // frames without detection counts, replayed with the tracker's simulation mode which takes all of them as valid
+    uint64_t *timestamps_us;
+    uint8_t *ticks = gatherRecords(reader, SESSION_CHANNEL_LIGHTHOUSE, sizeof(SessionLighthouseRecord), &timestamps_us);
+    PoseTracker tracker(IMU_FILTER_ALPHA, 0, true);
+    tracker.setSimulatedLighthouse((const uint32_t *)ticks, count, reader.header().base_station_pitch,
+                                   reader.header().base_station_roll);
+    for (int n = 0; n < count; n++)
+    {
+        hostMicros() = timestamps_us[n];
+        double start = seconds();
+        int updated = tracker.processLighthouse();
+        result.seconds += seconds() - start;
+        addPose(result, truth, timestamps_us[n], tracker, updated);
+    }
+    free(ticks);
+    free(timestamps_us);
+    return true;
+}
+
+static bool runSweepFilter(const SessionLogReader &reader, const GroundTruth &truth, double, Result &result)
+{
+    if (reader.recordCount(SESSION_CHANNEL_SWEEP) == 0)
+    {
+        return false;
+    }
+    PoseTracker tracker(IMU_FILTER_ALPHA, trackedMode(reader));
+    tracker.setSweepUpdate(true);
+    replaySweeps(reader, truth, tracker, result);
+    return true;
+}
+
+static bool runTwoStations(const SessionLogReader &reader, const GroundTruth &truth, double, Result &result)
+{
+    if (!hasStation(reader, 1))
+    {
+        return false;
+    }
+    PoseTracker tracker(IMU_FILTER_ALPHA, trackedMode(reader));
+    tracker.setTrackBothStations(true);
+    replaySweeps(reader, truth, tracker, result);
+    return true;
+}
+
+// parameter: alpha of the complementary filter, or a negative value for the gyro only quaternion
+static bool runOrientation(const SessionLogReader &reader, const GroundTruth &truth, double alpha, Result &result)
+{
+    int count = (int)reader.recordCount(SESSION_CHANNEL_IMU);
+    if (count == 0)
+    {
+        return false;
+    }
+    uint64_t *timestamps_us;
+    float *samples = (float *)gatherRecords(reader, SESSION_CHANNEL_IMU, sizeof(SessionImuRecord), &timestamps_us);
+    OrientationTracker tracker(alpha < 0.0 ? IMU_FILTER_ALPHA : alpha, true);
+    tracker.setSimulatedImu(samples, count, timestamps_us);
+
+    // the tracker replays the readings in the order of the cursor, markers only count the dropped ones
+    SessionCursor cursor(reader, (1u << SESSION_CHANNEL_IMU) | (1u << SESSION_CHANNEL_MARKER));
+    SessionRecord record;
+    while (cursor.next(record))
+    {
+        if (record.channel == SESSION_CHANNEL_MARKER)
+        {
+            const SessionMarkerRecord *marker = (const SessionMarkerRecord *)record.data;
+            if (marker->kind == SESSION_MARKER_IMU_DROPPED)
+            {
+                result.attempts += marker->value;
+            }
+            continue;
+        }
+        result.attempts++;
+        hostMicros() = record.timestamp_us;
+        double start = seconds();
+        bool read = tracker.processImu();
+        result.seconds += seconds() - start;
+        const Quaternion &q = alpha < 0.0 ? tracker.getQuaternionGyr() : tracker.getQuaternionComp();
+        if (read && isfinite(q.q[0]))
+        {
+            result.updates++;
+            compare(result, truth, record.timestamp_us, NULL, q);
+        }
+    }
+    free(samples);
+    free(timestamps_us);
+    return true;
+}
+
+static const Variant variants[] = {
+    {"homography", runHomography, 0.0},   {"sweep-ekf", runSweepFilter, 0.0},
+    {"two-station", runTwoStations, 0.0}, {"imu-gyro", runOrientation, -1.0},
+    {"imu-comp-0.9", runOrientation, 0.9}, {"imu-comp-0.99", runOrientation, 0.99},
+};
+
+static double dropout(const Result &result)
+{
+    return result.attempts > 0 ? 1.0 - (double)result.updates / result.attempts : 0.0;
+}
+
+static double rmsPosition(const Result &result)
+{
+    return result.compared > 0 ? sqrt(result.position_sq / result.compared) : NAN;
+}
+
+static double rmsAngle(const Result &result)
+{
+    return result.angles_compared > 0 ? sqrt(result.angle_sq / result.angles_compared) : NAN;
+}
+
+static double nsPerUpdate(const Result &result)
+{
+    return result.attempts > 0 ? result.seconds * 1e9 / result.attempts : NAN;
+}
+
+static void printValue(double value, const char *format)
+{
+    if (isnan(value))
+    {
+        printf("%10s", "-");
+    }
+    else
+    {
+        printf(format, value);
+    }
+}
+
+static void printRow(const Result &result)
+{
+    printf("%-24s %-14s %8lu/%-8lu %7.2f%%", result.trace, result.variant, result.updates, result.attempts,
+           100.0 * dropout(result));
+    printValue(rmsPosition(result), "%10.2f");
+    printValue(rmsAngle(result), "%10.3f");
+    printValue(nsPerUpdate(result), "%10.0f");
+    printf("\n");
+}
+
+static const char *CSV_HEADER = "trace,variant,attempts,updates,dropout,rms_position_mm,rms_angle_deg,ns_per_update";
+
+static bool writeCsv(const char *path, const Result *results, int count)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+    fprintf(file, "%s\n", CSV_HEADER);
+    for (int i = 0; i < count; i++)
+    {
+        const Result &result = results[i];
+        fprintf(file, "%s,%s,%lu,%lu,%.6f,%.6f,%.6f,%.1f\n", result.trace, result.variant, result.attempts,
+                result.updates, dropout(result), rmsPosition(result), rmsAngle(result), nsPerUpdate(result));
+    }
+    return fclose(file) == 0;
+}
+
+static bool worse(double current, double baseline, double tolerance, double floor)
+{
+    if (isnan(baseline))
+    {
+        return false;
+    }
+    return isnan(current) || current > baseline * (1.0 + tolerance) + floor;
+}
+
+// Returns the number of regressions, or -1 if the baseline can't be read
+static int checkBaseline(const char *path, const Result *results, int count, double tolerance,
+                         double cost_tolerance)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    int regressions = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char trace[TRACE_NAME_LENGTH];
+        char variant[32];
+        unsigned long attempts, updates;
+        double base_dropout, base_position, base_angle, base_cost;
+        if (sscanf(line, "%63[^,],%31[^,],%lu,%lu,%lf,%lf,%lf,%lf", trace, variant, &attempts, &updates,
+                   &base_dropout, &base_position, &base_angle, &base_cost) != 8)
+        {
+            continue;
+        }
+        const Result *result = NULL;
+        for (int i = 0; i < count && result == NULL; i++)
+        {
+            if (strcmp(results[i].trace, trace) == 0 && strcmp(results[i].variant, variant) == 0)
+            {
+                result = &results[i];
+            }
+        }
+        if (result == NULL)
+        {
+            continue;
+        }
+        const char *metric = NULL;
+        double current = 0.0, baseline = 0.0;
+        if (worse(dropout(*result), base_dropout, tolerance, DROPOUT_FLOOR))
+        {
+            metric = "dropout", current = dropout(*result), baseline = base_dropout;
+        }
+        else if (worse(rmsPosition(*result), base_position, tolerance, POSITION_FLOOR_MM))
+        {
+            metric = "rms position", current = rmsPosition(*result), baseline = base_position;
+        }
+        else if (worse(rmsAngle(*result), base_angle, tolerance, ANGLE_FLOOR_DEG))
+        {
+            metric = "rms angle", current = rmsAngle(*result), baseline = base_angle;
+        }
+        else if (cost_tolerance > 0.0 && worse(nsPerUpdate(*result), base_cost, cost_tolerance, 0.0))
+        {
+            metric = "ns/update", current = nsPerUpdate(*result), baseline = base_cost;
+        }
+        if (metric != NULL)
+        {
+            printf("regression: %s %s %s %g, baseline %g\n", trace, variant, metric, current, baseline);
+            regressions++;
+        }
+    }
+    fclose(file);
+    return regressions;
+}
+
+int main(int argc, char **argv)
+{
+    const char *csv_path = NULL;
+    const char *baseline_path = NULL;
+    double tolerance = 0.1;
+    double cost_tolerance = 0.0;
+    int repeat = 3;
+    const char *traces[MAX_RESULTS];
+    int trace_count = 0;
+    bool usage = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--csv") == 0 && has_value)
+            csv_path = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && has_value)
+            baseline_path = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && has_value)
+            tolerance = atof(argv[++i]);
+        else if (strcmp(argv[i], "--cost-tolerance") == 0 && has_value)
+            cost_tolerance = atof(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+        else if (strncmp(argv[i], "--", 2) != 0 && trace_count < MAX_RESULTS)
+            traces[trace_count++] = argv[i];
+        else
+            usage = true;
+    }
+    if (usage || trace_count == 0)
+    {
+        fprintf(stderr,
+                "usage: %s [--csv <results.csv>] [--baseline <baseline.csv>] [--tolerance <t>] "
+                "[--cost-tolerance <t>] [--repeat <n>] <trace.vrsession>...\n",
+                argv[0]);
+        return 2;
+    }
+
+    static Result results[MAX_RESULTS];
+    int result_count = 0;
+    printf("%-24s %-14s %17s %8s %10s %10s %10s\n", "trace", "pipeline", "updates", "dropout", "pos mm",
+           "angle deg", "ns/update");
+    for (int t = 0; t < trace_count; t++)
+    {
+        SessionLogReader reader;
+        if (!reader.open(traces[t]))
+        {
+            fprintf(stderr, "%s is not a complete session log\n", traces[t]);
+            return 1;
+        }
+        GroundTruth truth;
+        if (!loadGroundTruth(reader, truth))
+        {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        const char *name = strrchr(traces[t], '/') != NULL ? strrchr(traces[t], '/') + 1 : traces[t];
+
+        for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]) && result_count < MAX_RESULTS; v++)
+        {
+            // errors are the same every run, only the fastest run counts for the cost
+            Result best;
+            bool applicable = false;
+            for (int r = 0; r < repeat; r++)
+            {
+                Result result = Result();
+                applicable = variants[v].run(reader, truth, variants[v].parameter, result);
+                if (!applicable)
+                {
+                    break;
+                }
+                if (r == 0 || result.seconds < best.seconds)
+                {
+                    best = result;
+                }
+            }
+            if (!applicable)
+            {
+                continue;
+            }
+            snprintf(best.trace, sizeof(best.trace), "%s", name);
+            best.variant = variants[v].name;
+            results[result_count++] = best;
+            printRow(best);
+        }
+        freeGroundTruth(truth);
+    }
+
+    if (csv_path != NULL && !writeCsv(csv_path, results, result_count))
+    {
+        fprintf(stderr, "can't write %s\n", csv_path);
+        return 1;
+    }
+    if (baseline_path != NULL)
+    {
+        int regressions = checkBaseline(baseline_path, results, result_count, tolerance, cost_tolerance);
+        if (regressions < 0)
+        {
+            fprintf(stderr, "can't read %s\n", baseline_path);
+            return 1;
+        }
+        printf("%d regressions against %s\n", regressions, baseline_path);
+        return regressions > 0 ? 1 : 0;
+    }
+    return 0;
+}
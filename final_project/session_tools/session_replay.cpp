@@ -0,0 +1,173 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Prints a session log (vr_handheld_lib/SessionLog/SessionLog.h): the header, records per channel and the chunk
+index, or with --csv every record merged in time order.
+
+Usage: session_replay <session.vrsession> [--from <seconds>] [--csv]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SessionLog.h>
+
+static const char *channelName(int channel)
+{
+    switch (channel)
+    {
+    case SESSION_CHANNEL_IMU:
+        return "imu";
+    case SESSION_CHANNEL_LIGHTHOUSE:
+        return "lighthouse";
+    case SESSION_CHANNEL_CONTROLLER:
+        return "controller";
+    case SESSION_CHANNEL_MARKER:
+        return "marker";
+    case SESSION_CHANNEL_SWEEP:
+        return "sweep";
+    case SESSION_CHANNEL_POSE:
+        return "pose";
+    default:
+        return "unknown";
+    }
+}
+
+static void printRecord(const SessionRecord &record)
+{
+    printf("%llu,%s", (unsigned long long)record.timestamp_us, channelName(record.channel));
+    if (record.channel == SESSION_CHANNEL_IMU)
+    {
+        const SessionImuRecord *imu = (const SessionImuRecord *)record.data;
+        printf(",%f,%f,%f,%f,%f,%f", imu->gyr[0], imu->gyr[1], imu->gyr[2], imu->acc[0], imu->acc[1], imu->acc[2]);
+    }
+    else if (record.channel == SESSION_CHANNEL_LIGHTHOUSE)
+    {
+        const SessionLighthouseRecord *lighthouse = (const SessionLighthouseRecord *)record.data;
+        for (int i = 0; i < 8; i++)
+        {
+            printf(",%lu", (unsigned long)lighthouse->clock_ticks[i]);
+        }
+    }
+    else if (record.channel == SESSION_CHANNEL_CONTROLLER)
+    {
+        const SessionControllerRecord *sample = (const SessionControllerRecord *)record.data;
+        printf(",%u,%u,%u", sample->controller, sample->sequence, sample->flags);
+        for (int i = 0; i < 3; i++)
+        {
+            printf(",%f", sample->acc[i]);
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            printf(",%f", sample->gyr[i]);
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            printf(",%f", sample->mag[i]);
+        }
+    }
+    else if (record.channel == SESSION_CHANNEL_SWEEP)
+    {
+        const SessionSweepRecord *sweep = (const SessionSweepRecord *)record.data;
+        printf(",%u,%d,%u,%f,%f", sweep->station, sweep->mode, sweep->axis, sweep->pitch, sweep->roll);
+        for (int i = 0; i < 8; i++)
+        {
+            printf(",%lu", (unsigned long)sweep->clock_ticks[i]);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            printf(",%lu", (unsigned long)sweep->num_pulse_detections[i]);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            printf(",%lu", (unsigned long)sweep->pulse_width[i]);
+        }
+    }
+    else if (record.channel == SESSION_CHANNEL_POSE)
+    {
+        const SessionPoseRecord *pose = (const SessionPoseRecord *)record.data;
+        printf(",%u,%f,%f,%f,%f,%f,%f,%f", pose->station, pose->position[0], pose->position[1], pose->position[2],
+               pose->quaternion[0], pose->quaternion[1], pose->quaternion[2], pose->quaternion[3]);
+    }
+    else if (record.channel == SESSION_CHANNEL_MARKER)
+    {
+        const SessionMarkerRecord *marker = (const SessionMarkerRecord *)record.data;
+        printf(",%lu,%ld", (unsigned long)marker->kind, (long)marker->value);
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    double from_s = 0.0;
+    bool csv = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+        {
+            csv = true;
+        }
+        else if (strcmp(argv[i], "--from") == 0 && i + 1 < argc)
+        {
+            from_s = atof(argv[++i]);
+        }
+        else if (path == NULL)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            path = NULL;
+            break;
+        }
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "usage: %s <session.vrsession> [--from <seconds>] [--csv]\n", argv[0]);
+        return 2;
+    }
+
+    SessionLogReader reader;
+    if (!reader.open(path))
+    {
+        fprintf(stderr, "%s is not a complete session log\n", path);
+        return 1;
+    }
+
+    if (!csv)
+    {
+        const SessionFileHeader &header = reader.header();
+        printf("%s: \"%s\", version %u, base station pitch %.3f roll %.3f\n", path, header.description,
+               header.version, header.base_station_pitch, header.base_station_roll);
+        for (int channel = 1; channel < SESSION_MAX_CHANNELS; channel++)
+        {
+            if (reader.recordCount(channel) > 0)
+            {
+                printf("  %-10s %8llu records\n", channelName(channel), (unsigned long long)reader.recordCount(channel));
+            }
+        }
+        printf("%d chunks:\n", reader.chunkCount());
+        for (int i = 0; i < reader.chunkCount(); i++)
+        {
+            const SessionIndexEntry &entry = reader.indexEntry(i);
+            printf("  %8llu %-10s %5lu records %10.6f - %10.6f s\n", (unsigned long long)entry.offset,
+                   channelName(entry.channel), (unsigned long)entry.count, entry.first_us/1e6, entry.last_us/1e6);
+        }
+        reader.close();
+        return 0;
+    }
+
+    SessionCursor cursor(reader, ~0u);
+    if (from_s > 0.0)
+    {
+        cursor.seek((uint64_t)(from_s*1e6));
+    }
+    SessionRecord record;
+    while (cursor.next(record))
+    {
+        printRecord(record);
+    }
+    reader.close();
+    return 0;
+}
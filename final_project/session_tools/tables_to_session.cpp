@@ -0,0 +1,66 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Converts the VRduino simulation tables (vr_application/vrduino/simulatedImuData.h and simulatedLighthouseData.h) into
+a session log (vr_handheld_lib/SessionLog/SessionLog.h).
+
+The tables don't store timestamps: IMU rows are OrientationTracker's 2 ms simulation step apart and lighthouse rows
+one 120 Hz sweep frame apart, both starting at 0.
+
+Usage: tables_to_session <output.vrsession>
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <SessionLog.h>
+#include "../vr_application/vrduino/simulatedImuData.h"
+#include "../vr_application/vrduino/simulatedLighthouseData.h"
+
+#define IMU_PERIOD_US 2000
+#define LIGHTHOUSE_PERIOD_US 8333
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <output.vrsession>\n", argv[0]);
+        return 2;
+    }
+
+    SessionLogWriter writer;
+    if (!writer.open(argv[1], "vrduino simulation"))
+    {
+        fprintf(stderr, "can't create %s\n", argv[1]);
+        return 1;
+    }
+    writer.setBaseStation(baseStationPitchSim, baseStationRollSim);
+
+    // Interleaved by timestamp, so chunks of both channels are spread over the file in time order
+    const int imu_rows = nImuSamples / 6;
+    const int lighthouse_rows = nLighthouseSamples / 8;
+    int imu = 0;
+    int lighthouse = 0;
+    bool ok = true;
+    while (ok && (imu < imu_rows || lighthouse < lighthouse_rows))
+    {
+        uint64_t imu_us = (uint64_t)imu*IMU_PERIOD_US;
+        uint64_t lighthouse_us = (uint64_t)lighthouse*LIGHTHOUSE_PERIOD_US;
+        if (lighthouse == lighthouse_rows || (imu < imu_rows && imu_us <= lighthouse_us))
+        {
+            ok = writer.add(SESSION_CHANNEL_IMU, imu_us, &imuData[6*imu]);
+            imu++;
+        }
+        else
+        {
+            ok = writer.add(SESSION_CHANNEL_LIGHTHOUSE, lighthouse_us, &clockTicksData[8*lighthouse]);
+            lighthouse++;
+        }
+    }
+    if (!writer.close() || !ok)
+    {
+        fprintf(stderr, "writing %s failed\n", argv[1]);
+        return 1;
+    }
+    printf("%d IMU and %d lighthouse records written to %s\n", imu_rows, lighthouse_rows, argv[1]);
+    return 0;
+}
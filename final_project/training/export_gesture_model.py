@@ -0,0 +1,92 @@
+# Exports a trained GestureClassificationNet as const float arrays for the receiver's GestureClassifier
+# (vr_handheld_lib/VRHandheld/GestureClassifier.h).
+# Run from the training directory: python export_gesture_model.py models/<model>.pt
+#
+# Each BatchNorm1d follows a ReLU and is followed by average pooling, both act per channel, so in eval mode
+# pool(bn(x)) = scale*pool(x) + shift per channel. That affine map is folded into the weights and biases of the next
+# layer (conv2 for the first batch norm, fc for the second) and the receiver doesn't compute the batch norms at all.
+# The accuracy of the model on all labelled gestures is written along with the weights, the host build of the
+# receiver's tests checks its own accuracy against it (pio test -e native).
+
+import os
+import sys
+import torch
+from train_gesture_classification import GestureClassificationNet, GestureDataset, lookup_filepath
+
+weights_filepath = '../vr_handheld_lib/VRHandheld/GestureModelWeights.h'
+
+def batch_norm_scale_shift(batch_norm):
+    scale = batch_norm.weight / torch.sqrt(batch_norm.running_var + batch_norm.eps)
+    shift = batch_norm.bias - batch_norm.running_mean * scale
+    return scale, shift
+
+def fold_batch_norm(weight, bias, scale, shift):
+    # weight is out x in_channels x taps, the next layer sees scale*x + shift on each input channel
+    folded_weight = weight * scale[None, :, None]
+    folded_bias = bias + torch.sum(weight, dim=2) @ shift
+    return folded_weight, folded_bias
+
+def folded_parameters(model):
+    conv1 = model.conv1[0]
+    conv2 = model.conv2[0]
+    fc = model.fc[1]
+    scale1, shift1 = batch_norm_scale_shift(model.conv1[2])
+    scale2, shift2 = batch_norm_scale_shift(model.conv2[2])
+    conv2_weight, conv2_bias = fold_batch_norm(conv2.weight, conv2.bias, scale1, shift1)
+    # Flatten orders the fc inputs channel major, channel c covers inputs c*12 .. c*12+11
+    fc_weight = fc.weight.reshape(fc.out_features, scale2.shape[0], -1)
+    fc_weight, fc_bias = fold_batch_norm(fc_weight, fc.bias, scale2, shift2)
+    return [
+        ('GESTURE_CONV1_WEIGHT', conv1.weight),
+        ('GESTURE_CONV1_BIAS', conv1.bias),
+        ('GESTURE_CONV2_WEIGHT', conv2_weight),
+        ('GESTURE_CONV2_BIAS', conv2_bias),
+        ('GESTURE_FC_WEIGHT', fc_weight),
+        ('GESTURE_FC_BIAS', fc_bias),
+    ]
+
+def reference_accuracy(model):
+    dataset = GestureDataset(lookup_filepath)
+    num_correct = 0
+    with torch.no_grad():
+        for idx in range(len(dataset)):
+            features, label = dataset[idx]
+            score = model(torch.unsqueeze(features, dim=0).to(dtype=torch.float32))
+            num_correct += int(torch.argmax(score, dim=1).item() == label.item())
+    return num_correct, len(dataset)
+
+def format_array(name, tensor):
+    values = tensor.detach().flatten().tolist()
+    lines = []
+    for i in range(0, len(values), 8):
+        lines.append('    ' + ', '.join('{0:.9g}f'.format(value) for value in values[i:i+8]) + ',')
+    return 'static const float {0}[{1}] = {{\n{2}\n}};\n'.format(name, len(values), '\n'.join(lines))
+
+def export_model(model_filepath):
+    model = GestureClassificationNet()
+    model.load_state_dict(torch.load(model_filepath, map_location='cpu'))
+    model.eval()
+    num_correct, num_total = reference_accuracy(model)
+    with torch.no_grad():
+        arrays = [format_array(name, tensor) for name, tensor in folded_parameters(model)]
+
+    with open(weights_filepath, 'w') as f:
+        f.write('/*\nRyan Dalby- CS 6360 Virtual Reality Final Project\n\n')
+        f.write('Weights of GestureClassificationNet for GestureClassifier.\n\n')
+        f.write('Generated by training/export_gesture_model.py from {0}, batch norms folded into the next layer.\n'.format(os.path.basename(model_filepath)))
+        f.write('Do not edit, export the model again instead.\n\n')
+        f.write('The arrays are static. Include this header from exactly one .cpp of a program, GestureClassifier.cpp,\n')
+        f.write('since every other .cpp that includes it gets its own copy of the weights. Host tests that need the\n')
+        f.write('GESTURE_MODEL_* macros are the only exception.\n*/\n\n')
+        f.write('#ifndef GESTURE_MODEL_WEIGHTS_H\n#define GESTURE_MODEL_WEIGHTS_H\n\n')
+        f.write('#define GESTURE_MODEL_EXPORTED 1\n')
+        f.write('#define GESTURE_MODEL_NAME "{0}"\n'.format(os.path.basename(model_filepath)))
+        f.write('// PyTorch predictions matching the label, over all gestures in {0}\n'.format(os.path.basename(lookup_filepath)))
+        f.write('#define GESTURE_MODEL_REFERENCE_CORRECT {0}\n'.format(num_correct))
+        f.write('#define GESTURE_MODEL_REFERENCE_TOTAL {0}\n\n'.format(num_total))
+        f.write('\n'.join(arrays))
+        f.write('\n#endif\n')
+    print('Exported {0} to {1}, reference accuracy {2}/{3}'.format(model_filepath, weights_filepath, num_correct, num_total))
+
+if __name__ == '__main__':
+    export_model(sys.argv[1])
@@ -0,0 +1,103 @@
+# Decoder for the binary serial output of vr_handheld_controller_receiver (selected by sending 'b' at its startup).
+# Frame layout is documented in vr_handheld_lib/VRHandheld/SerialFrame.h: a fixed size payload, COBS encoded and
+# terminated by a zero byte.
+
+import struct
+
+FRAME_TYPE_SAMPLE = 0x01
+FRAME_TYPE_GESTURE = 0x02
+FRAME_PAYLOAD_LENGTH = 28
+FRAME_LENGTH = FRAME_PAYLOAD_LENGTH + 2 # COBS overhead byte + zero delimiter
+PAYLOAD_FORMAT = '<BHIB9hH'
+GESTURE_PAYLOAD_FORMAT = '<BHIIHbfIB3xH'
+
+# Raw sensor units to g, deg/s and muT (same scales as vr_handheld_lib/VRHandheld/ImuCodec.h)
+SCALES = [4.0/32768.0]*3 + [2000.0/32768.0]*3 + [400.0/32768.0]*3
+
+def crc16_ccitt(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i+code-1]
+        i += code - 1
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+def decode_sample_frame(frame):
+    # frame without its zero delimiter, returns (sequence, timestamp_us, button_pressed, [9 values], controller id) or None
+    if len(frame) != FRAME_LENGTH - 1:
+        return None
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) != FRAME_PAYLOAD_LENGTH:
+        return None
+    fields = struct.unpack(PAYLOAD_FORMAT, payload)
+    if fields[0] != FRAME_TYPE_SAMPLE or fields[-1] != crc16_ccitt(payload[:-2]):
+        return None
+    values = [raw*scale for raw, scale in zip(fields[4:13], SCALES)]
+    return fields[1], fields[2], (fields[3] & 1) != 0, values, fields[3] >> 1
+
+def decode_gesture_frame(frame):
+    # frame without its zero delimiter, returns a dict with the receiver's classification of a gesture or None
+    if len(frame) != FRAME_LENGTH - 1:
+        return None
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) != FRAME_PAYLOAD_LENGTH:
+        return None
+    fields = struct.unpack(GESTURE_PAYLOAD_FORMAT, payload)
+    if fields[0] != FRAME_TYPE_GESTURE or fields[-1] != crc16_ccitt(payload[:-2]):
+        return None
+    keys = ['number', 'start_us', 'duration_us', 'num_samples', 'label', 'confidence', 'inference_us', 'controller']
+    return dict(zip(keys, fields[1:-1]))
+
+def read_gesture_frame(serial_port):
+    # Blocks until the receiver sends a gesture frame, sample frames in between are skipped
+    while True:
+        frame = serial_port.read_until(b'\x00')
+        gesture = decode_gesture_frame(frame[:-1])
+        if gesture is not None:
+            return gesture
+
+def read_msg_list(serial_port, controller=0):
+    # Reads one frame and returns it as the 10 fields of a text line (button;acc;gyr;mag), None if the frame is invalid
+    # or belongs to another controller
+    frame = serial_port.read_until(b'\x00')
+    sample = decode_sample_frame(frame[:-1])
+    if sample is None or sample[4] != controller:
+        return None
+    _, _, button_pressed, values, _ = sample
+    return ['1' if button_pressed else '0'] + ['{0:.6g}'.format(value) for value in values]
+
+# Gesture records written by the receiver when 'g' is sent at its startup, see
+# vr_handheld_lib/VRHandheld/GestureSegmenter.h for the layout
+GESTURE_RECORD_MAGIC = b'GSTR'
+GESTURE_INFO_FORMAT = '<HIIHBHB'
+GESTURE_INFO_LENGTH = struct.calcsize(GESTURE_INFO_FORMAT)
+
+def read_gesture_record(serial_port):
+    # Blocks until a valid record is read, returns (info dict, list of channels each a list of floats)
+    while True:
+        serial_port.read_until(GESTURE_RECORD_MAGIC)
+        payload_length, = struct.unpack('<H', serial_port.read(2))
+        payload = serial_port.read(payload_length)
+        crc, = struct.unpack('<H', serial_port.read(2))
+        if len(payload) != payload_length or payload_length < GESTURE_INFO_LENGTH or crc != crc16_ccitt(payload):
+            continue
+        number, start_us, duration_us, num_samples, channels, signal_length, controller = struct.unpack(GESTURE_INFO_FORMAT, payload[:GESTURE_INFO_LENGTH])
+        if payload_length != GESTURE_INFO_LENGTH + 4*channels*signal_length:
+            continue
+        values = struct.unpack('<{0}f'.format(channels*signal_length), payload[GESTURE_INFO_LENGTH:])
+        info = {'number': number, 'start_us': start_us, 'duration_us': duration_us, 'num_samples': num_samples, 'controller': controller}
+        return info, [list(values[i*signal_length:(i+1)*signal_length]) for i in range(channels)]
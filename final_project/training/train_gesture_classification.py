@@ -22,11 +22,14 @@ dtype = torch.float32
 device = torch.device("cuda:0" if torch.cuda.is_available() else "cpu")
 
 # %%
-def read_and_interpolate_features(filepath, signal_length=150):
-    features = torch.tensor(pd.read_csv(filepath, header=None, dtype=float, na_values=['ovf']).dropna(axis=1).to_numpy())
+def interpolate_features(features, signal_length=150):
     features_idx_interp = F.interpolate(torch.unsqueeze(features, dim=0), size=signal_length)
     return torch.squeeze(features_idx_interp, dim=0)
 
+def read_and_interpolate_features(filepath, signal_length=150):
+    features = torch.tensor(pd.read_csv(filepath, header=None, dtype=float, na_values=['ovf']).dropna(axis=1).to_numpy())
+    return interpolate_features(features, signal_length=signal_length)
+
 # %%
 class GestureDataset(Dataset):
     def __init__(self, lookup_filepath, signal_set_length=150):
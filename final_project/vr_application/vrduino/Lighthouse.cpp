@@ -28,6 +28,15 @@ Lighthouse::Lighthouse() :
 bool Lighthouse::readTimings(int baseStationMode, unsigned long values[8], unsigned long numPulseDetections[8],
   unsigned long pulseWidth[8], double &pitch, double &roll) {
 
+  int axis;
+  return readSweepTimings(baseStationMode, values, numPulseDetections, pulseWidth, pitch, roll, axis);
+
+}
+
+
+bool Lighthouse::readSweepTimings(int baseStationMode, unsigned long values[8], unsigned long numPulseDetections[8],
+  unsigned long pulseWidth[8], double &pitch, double &roll, int &axis) {
+
   //disable interrupts so that pulses aren't updated in between reads
   __disable_irq();
 
@@ -42,21 +51,112 @@ bool Lighthouse::readTimings(int baseStationMode, unsigned long values[8], unsig
   bool success = pid >= 0;
 
   if (success) {
+    axis = pulseData.station[pid].dataAxis;
+    copyStationTimings(pid, values, numPulseDetections, pulseWidth, pitch, roll);
+  }
 
-    for (int i = 0; i < 8; i++) {
-      //copy values from pulseData into output buffers
-      values[i] = pulseData.station[pid].sweepPulseTicks[i];
-      numPulseDetections[i] = pulseData.station[pid].numPulseDetections[i];
-      pulseWidth[i] = pulseData.station[pid].sweepPulseWidth[i];
-    }
+  __enable_irq();
+
+  return success;
+
+}
+
+
+bool Lighthouse::readStationTimings(int stationIndex, unsigned long values[8], unsigned long numPulseDetections[8],
+  unsigned long pulseWidth[8], double &pitch, double &roll, int &mode) {
+
+  //disable interrupts so that pulses aren't updated in between reads
+  __disable_irq();
 
-    pitch = pulseData.station[pid].pitch;
-    roll = pulseData.station[pid].roll;
+  bool success = pulseData.station[stationIndex].dataAvailable;
 
-    //we have read, so set dataAvailable to false
-    //to prevent multiple reads of the same values
-    pulseData.station[pid].dataAvailable = false;
+  if (success) {
+    copyStationTimings(stationIndex, values, numPulseDetections, pulseWidth, pitch, roll);
+    mode = pulseData.station[stationIndex].mode;
+  }
+
+  __enable_irq();
+
+  return success;
+
+}
+
+
+bool Lighthouse::readStationSweepTimings(int stationIndex, unsigned long values[8], unsigned long numPulseDetections[8],
+  unsigned long pulseWidth[8], double &pitch, double &roll, int &mode, int &axis) {
+
+  __disable_irq();
+
+  bool success = pulseData.station[stationIndex].dataAvailable;
+
+  if (success) {
+    axis = pulseData.station[stationIndex].dataAxis;
+    mode = pulseData.station[stationIndex].mode;
+    copyStationTimings(stationIndex, values, numPulseDetections, pulseWidth, pitch, roll);
+  }
 
+  __enable_irq();
+
+  return success;
+
+}
+
+
+void Lighthouse::replaySweepTimings(int stationIndex, const unsigned long values[8],
+  const unsigned long numPulseDetections[8], const unsigned long pulseWidth[8], double pitch, double roll,
+  int mode, int axis) {
+
+  __disable_irq();
+
+  //same as the sync pulse in LighthouseInputCapture::callback()
+  for (int i = 0; i < 4; i++) {
+    int j = 2*i + axis;
+    pulseData.station[stationIndex].sweepPulseTicks[j] = values[j];
+    pulseData.station[stationIndex].numPulseDetections[j] = numPulseDetections[j];
+    pulseData.station[stationIndex].sweepPulseWidth[j] = pulseWidth[j];
+  }
+
+  pulseData.station[stationIndex].pitch = pitch;
+  pulseData.station[stationIndex].roll = roll;
+  pulseData.station[stationIndex].mode = mode;
+  pulseData.station[stationIndex].dataAxis = axis;
+  pulseData.station[stationIndex].dataAvailable = true;
+
+  __enable_irq();
+
+}
+
+
+void Lighthouse::copyStationTimings(int pid, unsigned long values[8], unsigned long numPulseDetections[8],
+  unsigned long pulseWidth[8], double &pitch, double &roll) {
+
+  for (int i = 0; i < 8; i++) {
+    //copy values from pulseData into output buffers
+    values[i] = pulseData.station[pid].sweepPulseTicks[i];
+    numPulseDetections[i] = pulseData.station[pid].numPulseDetections[i];
+    pulseWidth[i] = pulseData.station[pid].sweepPulseWidth[i];
+  }
+
+  pitch = pulseData.station[pid].pitch;
+  roll = pulseData.station[pid].roll;
+
+  //we have read, so set dataAvailable to false
+  //to prevent multiple reads of the same values
+  pulseData.station[pid].dataAvailable = false;
+
+}
+
+
+bool Lighthouse::getBaseStationInfo(int baseStationMode, BaseStationInfo &info) {
+
+  __disable_irq();
+
+  bool success = false;
+  for (int i = 0; i < 2; i++) {
+    if (pulseData.station[i].ootx.isOOTXInfoAvailable() && baseStationMode == pulseData.station[i].mode) {
+      info = pulseData.station[i].ootx.getBaseStationInfo();
+      success = true;
+    }
   }
 
   __enable_irq();
@@ -38,8 +38,63 @@ class Lighthouse {
     bool readTimings(int baseStationMode, unsigned long values[8], unsigned long numPulseDetections[8],
       unsigned long pulseWidth[8], double &pitch, double &roll);
 
+    /**
+     * same as readTimings(), but selects the station by its slot in pulseData
+     * instead of by mode, so that both synced base stations can be read out
+     * every frame.
+     * @param [in] stationIndex - slot of the station (0 or 1). the order is
+     *   arbitrary, check mode to see which base station it is
+     * @param [out] mode - mode of the base station (0:A, 1:B, 2:C), -1 if the
+     *   OOTX frame has not been decoded yet
+     * @returns true if new data is available from this station
+     */
+    bool readStationTimings(int stationIndex, unsigned long values[8], unsigned long numPulseDetections[8],
+      unsigned long pulseWidth[8], double &pitch, double &roll, int &mode);
+
+    /**
+     * same as readTimings(), but also reports which axis was swept since the
+     * last read-out. only the entries of that axis are new, the others are
+     * from the previous sweep.
+     * @param [out] axis - 0: horizontal sweep, 1: vertical sweep
+     */
+    bool readSweepTimings(int baseStationMode, unsigned long values[8], unsigned long numPulseDetections[8],
+      unsigned long pulseWidth[8], double &pitch, double &roll, int &axis);
+
+    /**
+     * same as readStationTimings(), but also reports which axis was swept
+     * since the last read-out, e.g. to record every sweep of both stations
+     * @param [out] axis - 0: horizontal sweep, 1: vertical sweep
+     */
+    bool readStationSweepTimings(int stationIndex, unsigned long values[8], unsigned long numPulseDetections[8],
+      unsigned long pulseWidth[8], double &pitch, double &roll, int &mode, int &axis);
+
+    /**
+     * stores the timings of a recorded sweep as the sync pulse after it
+     * would, so that sessions (SessionRecorder.h) can be replayed through the
+     * read-out functions without base stations. only the entries of the
+     * swept axis are taken, same arguments as readStationSweepTimings()
+     */
+    void replaySweepTimings(int stationIndex, const unsigned long values[8], const unsigned long numPulseDetections[8],
+      const unsigned long pulseWidth[8], double pitch, double roll, int mode, int axis);
+
+    /**
+     * get the full decoded OOTX payload (factory calibration, id, ...) of the
+     * base station with the given mode
+     * @param [in] baseStationMode - mode of desired base station (0:A, 1:B, 2:C)
+     * @param [out] info - decoded payload
+     * @returns true if a frame with a valid CRC was received from this station
+     */
+    bool getBaseStationInfo(int baseStationMode, BaseStationInfo &info);
+
   private:
 
+    /**
+     * copies the permanent buffers of station pid into the output buffers
+     * and clears its dataAvailable flag. interrupts must be disabled.
+     */
+    void copyStationTimings(int pid, unsigned long values[8], unsigned long numPulseDetections[8],
+      unsigned long pulseWidth[8], double &pitch, double &roll);
+
     /** the pins of of the sensors */
     int sensor0_pin_rising  = 5;
     int sensor0_pin_falling = 6;
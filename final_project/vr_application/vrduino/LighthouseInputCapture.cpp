@@ -1,5 +1,4 @@
 #include "LighthouseInputCapture.h"
-#define CLOCKS_PER_MICROSECOND 
 
 LighthouseInputCapture::LighthouseInputCapture( int pinIn, int polarityIn, int sensorIndexIn, PulseData* pulseDataIn) :
 
@@ -114,13 +113,19 @@ void LighthouseInputCapture::callback(uint32_t value) {
 
       pid = (sweepPulsePeriod >= 40000) ? 0 : 1;
 
-      pulseData->station[pid].ootx.addBit(dataBit);
+      //once a frame with a valid CRC was decoded, the info is cached
+      //and there is nothing left to do for the databits
+      if (!pulseData->station[pid].ootx.isOOTXInfoAvailable()) {
 
-      pulseData->station[pid].ootx.getBaseStationInfo(
-        pulseData->station[pid].pitch,
-        pulseData->station[pid].roll,
-        pulseData->station[pid].mode
-      );
+        pulseData->station[pid].ootx.addBit(dataBit);
+
+        pulseData->station[pid].ootx.getBaseStationInfo(
+          pulseData->station[pid].pitch,
+          pulseData->station[pid].roll,
+          pulseData->station[pid].mode
+        );
+
+      }
 
     }
 
@@ -139,6 +144,7 @@ void LighthouseInputCapture::callback(uint32_t value) {
 
       }
 
+      pulseData->station[pid].dataAxis = pulseData->station[pid].axis;
       pulseData->station[pid].dataAvailable = true;
 
     }
@@ -26,6 +26,18 @@ LighthouseOOTX::LighthouseOOTX() {
   complete      = 0;
   length        = 0;
   bCompleteOnce = false;
+  crcErrors     = 0;
+  memset(&info, 0, sizeof(info));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// drop the cached frame, the next valid frame will be decoded again
+
+void LighthouseOOTX::invalidate() {
+  reset();
+  waiting_for_length = 1;
+  complete      = 0;
+  bCompleteOnce = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +56,11 @@ void LighthouseOOTX::reset() {
 
 void LighthouseOOTX::addBit(unsigned long bit) {
 
+  // the base station repeats the same frame, nothing to do once a valid one was decoded
+  if (bCompleteOnce) {
+    return;
+  }
+
   if (bit != 0 && bit != 1) {
     // something is wrong.  dump what we have received so far
     reset();
@@ -145,6 +162,56 @@ void LighthouseOOTX::add_word(unsigned long word) {
     return;
 
   // we are at the end!
+  waiting_for_length  = 1;
+
+  // the CRC32 (little endian) follows the payload and the padding byte, if any
+  unsigned payloadLength = length - 4;
+  const unsigned char *crcBytes = bytes + payloadLength + padding;
+  unsigned long crcReceived = (unsigned long)crcBytes[0] | ((unsigned long)crcBytes[1] << 8) |
+    ((unsigned long)crcBytes[2] << 16) | ((unsigned long)crcBytes[3] << 24);
+
+  if (crc32(bytes, payloadLength) != crcReceived) {
+    crcErrors++;
+    reset();
+    return;
+  }
+
+  decode_payload();
+
+  complete            = 1;
+  bCompleteOnce       = true;
+
+  // reset to wait for a preamble
+  reset();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// decode the payload of a frame that passed the CRC check
+// layout: https://github.com/nairol/LighthouseRedox/blob/master/docs/Base%20Station.md
+
+void LighthouseOOTX::decode_payload() {
+
+  unsigned short first16bitvariable = (bytes[1] << 8) + bytes[0];
+  info.firmwareVersion = (first16bitvariable & 0xFFC0) >> 6;
+  info.protocolVersion = (first16bitvariable & 0x3F);
+  info.id = (unsigned long)bytes[2] | ((unsigned long)bytes[3] << 8) |
+    ((unsigned long)bytes[4] << 16) | ((unsigned long)bytes[5] << 24);
+  info.hardwareVersion = bytes[15];
+
+  for (int i = 0; i < 2; i++) {
+    info.rotor[i].phase    = halfToFloat(bytes + 6  + 2*i);
+    info.rotor[i].tilt     = halfToFloat(bytes + 10 + 2*i);
+    info.rotor[i].curve    = halfToFloat(bytes + 16 + 2*i);
+    info.rotor[i].gibPhase = halfToFloat(bytes + 23 + 2*i);
+    info.rotor[i].gibMag   = halfToFloat(bytes + 27 + 2*i);
+  }
+
+  info.accel[0] = int8_t(bytes[20]);
+  info.accel[1] = int8_t(bytes[21]);
+  info.accel[2] = int8_t(bytes[22]);
+
+  info.mode   = bytes[31];
+  info.faults = bytes[32];
 
   // save base station pitch and roll from bytes 20 and 22
   //accelerometer acc axis: z points back, y is normal to top face
@@ -165,13 +232,41 @@ void LighthouseOOTX::add_word(unsigned long word) {
 
   //baseStationRoll     = 90.0 * double(int8_t(bytes[20]))/127.0;
   //baseStationPitch    = -90.0 * double(int8_t(bytes[22]))/127.0;
+}
 
-  complete            = 1;
-  bCompleteOnce       = true;
-  waiting_for_length  = 1;
+//////////////////////////////////////////////////////////////////////////////////////////
+// bitwise CRC32, reflected polynomial 0xEDB88320. only runs once per received frame,
+// so a lookup table is not worth the flash
+
+unsigned long LighthouseOOTX::crc32(const unsigned char *data, unsigned len) {
+  unsigned long crc = 0xFFFFFFFF;
+  for (unsigned i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc & 0xFFFFFFFF;
+}
 
-  // reset to wait for a preamble
-  reset();
+//////////////////////////////////////////////////////////////////////////////////////////
+// IEEE 754 half precision (1 sign, 5 exponent, 10 mantissa bits), little endian
+
+float LighthouseOOTX::halfToFloat(const unsigned char *data) {
+  unsigned short h = (data[1] << 8) | data[0];
+  int sign     = (h >> 15) & 0x1;
+  int exponent = (h >> 10) & 0x1F;
+  int mantissa = h & 0x3FF;
+
+  float value;
+  if (exponent == 0) {
+    value = ldexpf(float(mantissa), -24);                 // subnormal
+  } else if (exponent == 31) {
+    value = mantissa ? NAN : INFINITY;
+  } else {
+    value = ldexpf(float(mantissa + 1024), exponent - 25);
+  }
+  return sign ? -value : value;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
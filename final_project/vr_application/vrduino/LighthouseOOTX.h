@@ -10,6 +10,11 @@
  *              and the code !!
  *              https://github.com/nairol/LighthouseRedox/blob/master/docs/Light%20Emissions.md
  *
+ *  Frames are only trusted if the CRC32 at the end of the payload matches. Once a valid
+ *  frame was received, the decoded info is cached and further databits are ignored (the
+ *  base station repeats the same frame over and over), so the sync-pulse ISR does not
+ *  pay for decoding anymore. Call invalidate() to decode a fresh frame.
+ *
  *  Gordon Wetzstein
  *  gordon.wetzstein@stanford.edu
  *  Stanford University
@@ -21,6 +26,42 @@
 
 #include <Wire.h>
 
+/**
+ * factory calibration of one rotor (axis) of the base station, from the OOTX payload.
+ * see https://github.com/nairol/LighthouseRedox/blob/master/docs/Base%20Station.md
+ * all values are in radians (phase, gibbous phase) or radians per radian (tilt, curve,
+ * gibbous magnitude)
+ */
+struct BaseStationRotorCalibration {
+  float phase;
+  float tilt;
+  float curve;
+  float gibPhase;
+  float gibMag;
+};
+
+/**
+ * decoded content of the OOTX payload (base station info block)
+ */
+struct BaseStationInfo {
+
+  unsigned short firmwareVersion;
+  unsigned short protocolVersion;
+  unsigned long id;
+  unsigned char hardwareVersion;
+
+  /** arbitrarily scaled accelerometer direction, z points back, y is normal to top face */
+  signed char accel[3];
+
+  /** 0:A, 1:B, 2:C */
+  unsigned char mode;
+  unsigned char faults;
+
+  /** rotor 0 sweeps horizontally, rotor 1 vertically */
+  BaseStationRotorCalibration rotor[2];
+
+};
+
 class LighthouseOOTX {
 
   //////////////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +105,12 @@ class LighthouseOOTX {
 
     int baseStationMode;
 
+    // decoded payload of the last frame with a valid CRC
+    BaseStationInfo info;
+
+    // number of frames dropped because of a CRC mismatch
+    unsigned crcErrors;
+
   //////////////////////////////////////////////////////////////////////////////////////////
   // public variables
 
@@ -80,6 +127,15 @@ class LighthouseOOTX {
     // flip the order of the last two bytes in this 32 bit sequence (do not reverse bit order)
     unsigned long flipByteOrder(unsigned long bitsequence);
 
+    // CRC32 (IEEE 802.3, as used by zlib) of the first len bytes of data
+    static unsigned long crc32(const unsigned char *data, unsigned len);
+
+    // convert a little endian IEEE 754 half precision float in the payload to float
+    static float halfToFloat(const unsigned char *data);
+
+    // decode the payload of a frame with a valid CRC into info, pitch, roll and mode
+    void decode_payload();
+
   //////////////////////////////////////////////////////////////////////////////////////////
   // public functions
   public:
@@ -96,6 +152,15 @@ class LighthouseOOTX {
     // see if OOTX info is available
     bool isOOTXInfoAvailable(void) { return bCompleteOnce; }
 
+    // drop the cached info and decode the next valid frame
+    void invalidate(void);
+
+    // full decoded payload (only valid if isOOTXInfoAvailable() is true)
+    const BaseStationInfo& getBaseStationInfo(void) const { return info; }
+
+    // number of frames that were dropped because of a CRC mismatch
+    unsigned getCrcErrors(void) const { return crcErrors; }
+
     // get pitch and roll angles of the base station from the OOTX frame - this is reported in degrees
     void getBaseStationPitchAndRoll(volatile double &pitch, volatile double &roll);
 
@@ -1,4 +1,7 @@
 #include "OrientationTracker.h"
+#if VRDUINO_SIMULATED_TABLES
+#include "simulatedImuTable.h"
+#endif
 
 //TODO: fill in from hw 4 as necessary
 
@@ -7,6 +10,8 @@ OrientationTracker::OrientationTracker(double imuFilterAlphaIn,  bool simulateIm
   imu(),
   gyr{0,0,0},
   acc{0,0,0},
+  rawGyr{0,0,0},
+  rawAcc{0,0,0},
   gyrBias{0,0,0},
   gyrVariance{0,0,0},
   accBias{0,0,0},
@@ -16,6 +21,12 @@ OrientationTracker::OrientationTracker(double imuFilterAlphaIn,  bool simulateIm
   deltaT(0.0),
   simulateImu(simulateImuIn),
   simulateImuCounter(0),
+  simulatedImu(NULL),
+  nSimulatedImu(0),
+#if VRDUINO_SIMULATED_TABLES
+  imuTable(imuTableData, imuTableLength, imuTableRows, imuTableColumns),
+#endif
+  simulatedImuTimestamps(NULL),
   flatlandRollGyr(0),
   flatlandRollAcc(0),
   flatlandRollComp(0),
@@ -141,10 +152,31 @@ void OrientationTracker::resetOrientation() {
 
 bool OrientationTracker::processImu() {
 
+  if (!readImu()) {
+    return false;
+  }
+
+  //run orientation tracking algorithms
+  updateOrientation();
+
+  return true;
+
+}
+
+bool OrientationTracker::readImu() {
+
   if (simulateImu) {
 
     //get imu values from simulation
-    updateImuVariablesFromSimulation();
+    if (!updateImuVariablesFromSimulation()) {
+      return false;
+    }
+
+    //simulated values are already corrected, keep gyr = rawGyr - gyrBias
+    for (int i = 0; i < 3; i++) {
+      rawGyr[i] = gyr[i] + gyrBias[i];
+      rawAcc[i] = acc[i] + accBias[i];
+    }
 
   } else {
 
@@ -158,30 +190,59 @@ bool OrientationTracker::processImu() {
 
   }
 
-  //run orientation tracking algorithms
-  updateOrientation();
-
   return true;
 
 }
 
-void OrientationTracker::updateImuVariablesFromSimulation() {
+void OrientationTracker::setSimulatedImu(const float* samples, int count, const uint64_t* timestampsUs) {
+
+  simulatedImu = samples;
+  nSimulatedImu = count * 6;
+  simulatedImuTimestamps = timestampsUs;
+  simulateImuCounter = 0;
+
+}
+
+bool OrientationTracker::updateImuVariablesFromSimulation() {
 
     deltaT = 0.002;
+
+    if (simulatedImu == NULL) {
+#if VRDUINO_SIMULATED_TABLES
+      //decode the next row of the compiled in table
+      int32_t values[6];
+      imuTable.nextRow(values);
+      for (int i = 0; i < 3; i++) {
+        gyr[i] = values[i] / imuTableScale;
+        acc[i] = values[3 + i] / imuTableScale;
+      }
+      delay(1);
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    int row = simulateImuCounter / 6;
+    if (simulatedImuTimestamps != NULL && row > 0) {
+      deltaT = (simulatedImuTimestamps[row] - simulatedImuTimestamps[row - 1]) / 1000000.0;
+    }
     //get simulated imu values from external file
     for (int i = 0; i < 3; i++) {
-      gyr[i] = imuData[simulateImuCounter + i];
+      gyr[i] = simulatedImu[simulateImuCounter + i];
     }
     simulateImuCounter += 3;
     for (int i = 0; i < 3; i++) {
-      acc[i] = imuData[simulateImuCounter + i];
+      acc[i] = simulatedImu[simulateImuCounter + i];
     }
     simulateImuCounter += 3;
-    simulateImuCounter = simulateImuCounter % nImuSamples;
+    simulateImuCounter = simulateImuCounter % nSimulatedImu;
 
     //simulate delay
     delay(1);
 
+    return true;
+
 }
 
 /**
@@ -210,14 +271,19 @@ bool OrientationTracker::updateImuVariables() {
   //gyr[0], ...
   //acc[0], ...
 
-  // You also need to appropriately modify the update of gyr as instructed in (2.1.3).
-  gyr[0] = gyro.gyro.x - gyrBias[0];
-  gyr[1] = gyro.gyro.y - gyrBias[1];
-  gyr[2] = gyro.gyro.z - gyrBias[2];
+  rawGyr[0] = gyro.gyro.x;
+  rawGyr[1] = gyro.gyro.y;
+  rawGyr[2] = gyro.gyro.z;
 
-  acc[0] = accel.acceleration.x - accBias[0];
-  acc[1] = accel.acceleration.y - accBias[1];
-  acc[2] = accel.acceleration.z - accBias[2];
+  rawAcc[0] = accel.acceleration.x;
+  rawAcc[1] = accel.acceleration.y;
+  rawAcc[2] = accel.acceleration.z;
+
+  // You also need to appropriately modify the update of gyr as instructed in (2.1.3).
+  for (int i = 0; i < 3; i++) {
+    gyr[i] = rawGyr[i] - gyrBias[i];
+    acc[i] = rawAcc[i] - accBias[i];
+  }
 
   return true;
 
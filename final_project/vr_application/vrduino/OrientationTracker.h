@@ -27,7 +27,8 @@
 #include <Wire.h>
 #include "Quaternion.h"
 #include "OrientationMath.h"
-#include "simulatedImuData.h"
+#include "SimulationConfig.h"
+#include "SimulatedTable.h"
 
 #define ICM_ADR 0x68
 #define ICM_SCL 16
@@ -55,6 +56,16 @@ class OrientationTracker {
     bool processImu();
 
 
+    /**
+     * samples the imu (or the simulation) like processImu() but leaves the
+     * orientation estimates alone. afterwards getGyr()/getAcc() hold the
+     * bias corrected values and getRawGyr()/getRawAcc() the readings before
+     * bias subtraction
+     * @returns true if a new reading was available
+     */
+    bool readImu();
+
+
     /** initializes Imu */
     void initImu();
 
@@ -83,6 +94,26 @@ class OrientationTracker {
     void setImuBias(double bias[3]);
 
 
+    /**
+     * replays imu values from the given array instead of the compiled in
+     * table (SimulationConfig.h) when simulating. the array is used in place, e.g. the records of an
+     * imu chunk of a mapped session log (SessionLog.h) or a table in flash.
+     * @param [in] samples - count rows of gyr x,y,z (deg/s), acc x,y,z (m/s^2)
+     * @param [in] count - number of rows, replay wraps around after the last
+     * @param [in] timestampsUs - time of each row in microseconds, deltaT is
+     *   taken from their differences. if NULL, rows are 2 ms apart
+     */
+    void setSimulatedImu(const float* samples, int count, const uint64_t* timestampsUs = NULL);
+
+
+    /**
+     * @returns false if simulateImu is set but there is nothing to replay:
+     * no array was set with setSimulatedImu() and the table is not compiled
+     * in (SimulationConfig.h). processImu() never gets a reading then
+     */
+    bool simulationReady() const { return !simulateImu || simulatedImu != NULL || VRDUINO_SIMULATED_TABLES; };
+
+
     /**
      * resets orientation estimates to 0
      */
@@ -140,6 +171,20 @@ class OrientationTracker {
     const double* getGyr() const { return gyr; };
 
 
+    /**
+     * @returns read-only reference to the accelerometer values of the last
+     * reading before bias subtraction, order is ax,ay,az
+     */
+    const double* getRawAcc() const { return rawAcc; };
+
+
+    /**
+     * @returns read-only reference to the gyroscope values of the last
+     * reading before bias subtraction, order is wx, wy, wz
+     */
+    const double* getRawGyr() const { return rawGyr; };
+
+
     /**
      * @returns read-only reference to gyroscope bias values
      * order is wx, wy, wz
@@ -193,8 +238,10 @@ class OrientationTracker {
     /**
      * gets imu variables from simulation, instead of sampling from the imu.
      * updates acc, gyr, deltaT
+     * @returns false if there is nothing to replay: no array was set with
+     *   setSimulatedImu() and the table is not compiled in
      */
-    void updateImuVariablesFromSimulation();
+    bool updateImuVariablesFromSimulation();
 
 
     /**
@@ -243,6 +290,14 @@ class OrientationTracker {
     double acc[3];
 
 
+    /**
+     * gyr and acc of the last reading before bias subtraction. for
+     * simulated values, which are already corrected, the bias is added back
+     */
+    double rawGyr[3];
+    double rawAcc[3];
+
+
     /**
      * gyro bias values. order is: (wx,wy,wz)
      */
@@ -300,6 +355,27 @@ class OrientationTracker {
     int simulateImuCounter;
 
 
+    /**
+     * simulated imu values set with setSimulatedImu(), 6 per row, and the
+     * number of values. NULL to replay the compiled in table
+     */
+    const float* simulatedImu;
+    int nSimulatedImu;
+
+#if VRDUINO_SIMULATED_TABLES
+    /**
+     * decoder of the compiled in table (simulatedImuTable.h)
+     */
+    SimulatedTableDecoder imuTable;
+#endif
+
+
+    /**
+     * time of each simulated row in microseconds, NULL for a fixed 2 ms
+     */
+    const uint64_t* simulatedImuTimestamps;
+
+
     /**
      * estimate of flatland roll from gyro values
      */
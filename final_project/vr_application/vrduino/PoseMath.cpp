@@ -8,15 +8,103 @@ void convertTicksTo2DPositions(uint32_t clockTicks[8], double pos2D[8])
   //use variable CLOCKS_PER_SECOND defined in PoseMath.h
   //for number of clock ticks a second
 
+  for (int i = 0; i < 4; i++) {
+
+    //time since sync pulse in s, rotor spins at 60 Hz
+    double deltaTH = double(clockTicks[2*i]) / CLOCKS_PER_SECOND;
+    double deltaTV = double(clockTicks[2*i + 1]) / CLOCKS_PER_SECOND;
+
+    //sweep angles in degrees
+    double alpha = -deltaTH * 60.0 * 360.0 + 90.0;
+    double beta = deltaTV * 60.0 * 360.0 - 90.0;
+
+    pos2D[2*i] = tan(alpha * PI / 180.0);
+    pos2D[2*i + 1] = tan(beta * PI / 180.0);
+
+  }
+
+}
+
+void precomputeLighthouseCorrection(const BaseStationInfo& info, LighthouseCorrection& correction) {
+
+  for (int i = 0; i < 2; i++) {
+    correction.phase[i] = info.rotor[i].phase;
+    correction.tanTilt[i] = tan(info.rotor[i].tilt);
+    correction.curve[i] = info.rotor[i].curve;
+    correction.gibMag[i] = info.rotor[i].gibMag;
+    correction.cosGibPhase[i] = cos(info.rotor[i].gibPhase);
+    correction.sinGibPhase[i] = sin(info.rotor[i].gibPhase);
+  }
 
 }
 
+
+void convertTicksTo2DPositions(uint32_t clockTicks[8], const LighthouseCorrection& correction,
+  double pos2D[8]) {
+
+  for (int i = 0; i < 4; i++) {
+
+    //measured sweep angles in radians, same as the ideal model
+    double measured[2] = {
+      (90.0 - double(clockTicks[2*i]) / CLOCKS_PER_SECOND * 60.0 * 360.0) * PI / 180.0,
+      (double(clockTicks[2*i + 1]) / CLOCKS_PER_SECOND * 60.0 * 360.0 - 90.0) * PI / 180.0
+    };
+
+    double angle[2] = {measured[0], measured[1]};
+
+    for (int iteration = 0; iteration < 2; iteration++) {
+
+      double next[2];
+
+      for (int axis = 0; axis < 2; axis++) {
+
+        double other = angle[1 - axis];
+
+        //sin(angle + gibPhase) without another call to sin() for the phase
+        double gib = sin(angle[axis]) * correction.cosGibPhase[axis] +
+          cos(angle[axis]) * correction.sinGibPhase[axis];
+
+        next[axis] = measured[axis] - correction.phase[axis]
+          - correction.tanTilt[axis] * other
+          - correction.curve[axis] * other * other
+          - correction.gibMag[axis] * gib;
+
+      }
+
+      angle[0] = next[0];
+      angle[1] = next[1];
+
+    }
+
+    pos2D[2*i] = tan(angle[0]);
+    pos2D[2*i + 1] = tan(angle[1]);
+
+  }
+
+}
+
+
 /**
  * TODO: see header file for documentation
  */
 void formA(double pos2D[8], double posRef[8], double Aout[8][8]) {
 
+  for (int i = 0; i < 4; i++) {
 
+    double x = posRef[2*i];
+    double y = posRef[2*i + 1];
+    double xn = pos2D[2*i];
+    double yn = pos2D[2*i + 1];
+
+    double rowX[8] = {x, y, 1, 0, 0, 0, -x * xn, -y * xn};
+    double rowY[8] = {0, 0, 0, x, y, 1, -x * yn, -y * yn};
+
+    for (int j = 0; j < 8; j++) {
+      Aout[2*i][j] = rowX[j];
+      Aout[2*i + 1][j] = rowY[j];
+    }
+
+  }
 
 }
 
@@ -30,8 +118,16 @@ bool solveForH(double A[8][8], double b[8], double hOut[8]) {
   //int inv = Matrix.Invert((double*)A, 8);
   //if inverse fails (Invert returns 0), return false
 
+  double Ainv[8][8];
+  Matrix.Copy((double*)A, 8, 8, (double*)Ainv);
+
+  if (Matrix.Invert((double*)Ainv, 8) == 0) {
+    return false;
+  }
 
-  return false;
+  Matrix.Multiply((double*)Ainv, b, 8, 8, 1, hOut);
+
+  return true;
 
 }
 
@@ -41,6 +137,41 @@ bool solveForH(double A[8][8], double b[8], double hOut[8]) {
  */
 void getRtFromH(double h[8], double ROut[3][3], double pos3DOut[3]) {
 
+  //scale factor from the lengths of the first two columns
+  double norm1 = sqrt(h[0]*h[0] + h[3]*h[3] + h[6]*h[6]);
+  double norm2 = sqrt(h[1]*h[1] + h[4]*h[4] + h[7]*h[7]);
+  double s = 2.0 / (norm1 + norm2);
+
+  pos3DOut[0] = s * h[2];
+  pos3DOut[1] = s * h[5];
+  pos3DOut[2] = -s;
+
+  //first column of R
+  double r1[3] = {h[0] / norm1, h[3] / norm1, -h[6] / norm1};
+
+  //second column, orthogonalized against the first
+  double r2[3] = {h[1], h[4], -h[7]};
+  double dot = r1[0]*r2[0] + r1[1]*r2[1] + r1[2]*r2[2];
+  for (int i = 0; i < 3; i++) {
+    r2[i] -= dot * r1[i];
+  }
+  double norm2Orth = sqrt(r2[0]*r2[0] + r2[1]*r2[1] + r2[2]*r2[2]);
+  for (int i = 0; i < 3; i++) {
+    r2[i] /= norm2Orth;
+  }
+
+  //third column is the cross product
+  double r3[3] = {
+    r1[1]*r2[2] - r1[2]*r2[1],
+    r1[2]*r2[0] - r1[0]*r2[2],
+    r1[0]*r2[1] - r1[1]*r2[0]
+  };
+
+  for (int i = 0; i < 3; i++) {
+    ROut[i][0] = r1[i];
+    ROut[i][1] = r2[i];
+    ROut[i][2] = r3[i];
+  }
 
 }
 
@@ -51,6 +182,234 @@ void getRtFromH(double h[8], double ROut[3][3], double pos3DOut[3]) {
  */
 Quaternion getQuaternionFromRotationMatrix(double R[3][3]) {
 
-  return Quaternion();
+  //Shepperd's method: divide by the largest of the four components, so
+  //rotations near 180 degrees (trace <= -1) don't divide by zero
+  double trace = R[0][0] + R[1][1] + R[2][2];
+
+  if (trace >= R[0][0] && trace >= R[1][1] && trace >= R[2][2]) {
+    double s = 2.0 * sqrt(1.0 + trace); // 4*q0
+    return Quaternion(
+      s / 4.0,
+      (R[2][1] - R[1][2]) / s,
+      (R[0][2] - R[2][0]) / s,
+      (R[1][0] - R[0][1]) / s
+    ).normalize();
+  }
+
+  if (R[0][0] >= R[1][1] && R[0][0] >= R[2][2]) {
+    double s = 2.0 * sqrt(1.0 + R[0][0] - R[1][1] - R[2][2]); // 4*q1
+    return Quaternion(
+      (R[2][1] - R[1][2]) / s,
+      s / 4.0,
+      (R[0][1] + R[1][0]) / s,
+      (R[0][2] + R[2][0]) / s
+    ).normalize();
+  }
+
+  if (R[1][1] >= R[2][2]) {
+    double s = 2.0 * sqrt(1.0 - R[0][0] + R[1][1] - R[2][2]); // 4*q2
+    return Quaternion(
+      (R[0][2] - R[2][0]) / s,
+      (R[0][1] + R[1][0]) / s,
+      s / 4.0,
+      (R[1][2] + R[2][1]) / s
+    ).normalize();
+  }
+
+  double s = 2.0 * sqrt(1.0 - R[0][0] - R[1][1] + R[2][2]); // 4*q3
+  return Quaternion(
+    (R[1][0] - R[0][1]) / s,
+    (R[0][2] + R[2][0]) / s,
+    (R[1][2] + R[2][1]) / s,
+    s / 4.0
+  ).normalize();
+
+}
+
+
+double computeHomographyResidual(double h[8]) {
+
+  //for a rigid board, the first two columns of [R|t] are orthonormal.
+  //4 diodes determine h exactly, so noise shows up as a violation of that
+  double c1[3] = {h[0], h[3], -h[6]};
+  double c2[3] = {h[1], h[4], -h[7]};
+
+  double norm1 = sqrt(c1[0]*c1[0] + c1[1]*c1[1] + c1[2]*c1[2]);
+  double norm2 = sqrt(c2[0]*c2[0] + c2[1]*c2[1] + c2[2]*c2[2]);
+  double dot = c1[0]*c2[0] + c1[1]*c2[1] + c1[2]*c2[2];
+
+  double scaleError = 2.0 * fabs(norm1 - norm2) / (norm1 + norm2);
+  double orthoError = fabs(dot) / (norm1 * norm2);
+
+  return scaleError + orthoError;
+
+}
+
+
+double computePoseWeight(double residual, double pos3D[3]) {
+
+  //residual floor, so a perfect fit does not get infinite weight
+  const double minResidual = 1e-3;
+
+  //angular error scales to position error with the distance
+  double distance = sqrt(pos3D[0]*pos3D[0] + pos3D[1]*pos3D[1] + pos3D[2]*pos3D[2]);
+  double sigma = (residual + minResidual) * distance;
+
+  return 1.0 / (sigma * sigma);
+
+}
+
+
+Quaternion blendQuaternions(const Quaternion& q0, const Quaternion& q1, double t) {
+
+  //q and -q are the same rotation, take the short way
+  double dot = q0.q[0]*q1.q[0] + q0.q[1]*q1.q[1] + q0.q[2]*q1.q[2] + q0.q[3]*q1.q[3];
+  double sign = (dot < 0) ? -1.0 : 1.0;
+
+  Quaternion q;
+  for (int i = 0; i < 4; i++) {
+    q.q[i] = (1.0 - t) * q0.q[i] + t * sign * q1.q[i];
+  }
+
+  return q.normalize();
+
+}
+
+
+void transformPose(const Quaternion& qT, double tT[3], const Quaternion& qIn,
+  double posIn[3], Quaternion& qOut, double posOut[3]) {
+
+  Quaternion p = Quaternion(0, posIn[0], posIn[1], posIn[2]).rotate(qT);
+
+  for (int i = 0; i < 3; i++) {
+    posOut[i] = p.q[i + 1] + tT[i];
+  }
+
+  qOut = Quaternion().multiply(qT, qIn).normalize();
+
+}
+
+
+void getRelativeTransform(const Quaternion& q0, double pos0[3], const Quaternion& q1,
+  double pos1[3], Quaternion& qOut, double posOut[3]) {
+
+  //T_01 = T_0 * T_1^-1
+  Quaternion q1Inv = Quaternion(q1.q[0], q1.q[1], q1.q[2], q1.q[3]).inverse();
+  qOut = Quaternion().multiply(q0, q1Inv).normalize();
+
+  Quaternion p = Quaternion(0, pos1[0], pos1[1], pos1[2]).rotate(qOut);
+
+  for (int i = 0; i < 3; i++) {
+    posOut[i] = pos0[i] - p.q[i + 1];
+  }
+
+}
+
+
+void predictPoseCovariance(double P[6][6], double deltaT, double rotationNoise,
+  double positionNoise) {
+
+  for (int i = 0; i < 3; i++) {
+    P[i][i] += rotationNoise * deltaT;
+    P[i + 3][i + 3] += positionNoise * deltaT;
+  }
+
+}
+
+
+int updatePoseFromSweep(double pos2D[8], bool useDiode[4], int axis, double posRef[8],
+  double measurementVariance, double pos3D[3], Quaternion& q, double P[6][6]) {
+
+  //measurement residuals and jacobian w.r.t. the error state
+  double r[4];
+  double J[4][6];
+  int m = 0;
+
+  for (int i = 0; i < 4; i++) {
+
+    if (!useDiode[i]) {
+      continue;
+    }
+
+    //diode position in the base station frame: p = R * pRef + t
+    Quaternion pr = Quaternion(0, posRef[2*i], posRef[2*i + 1], 0).rotate(q);
+    double rp[3] = {pr.q[1], pr.q[2], pr.q[3]};
+    double p[3] = {rp[0] + pos3D[0], rp[1] + pos3D[1], rp[2] + pos3D[2]};
+
+    //board has to be in front of the base station
+    double w = -p[2];
+    if (w <= 0) {
+      return 0;
+    }
+
+    //normalized coordinate along the swept axis: x/-z or y/-z
+    double u = p[axis] / w;
+    r[m] = pos2D[2*i + axis] - u;
+
+    //du/dp
+    double dudp[3] = {0, 0, u / w};
+    dudp[axis] = 1.0 / w;
+
+    //dp/drotation = -[R*pRef]x, dp/dposition = I
+    double dpdr[3][3] = {
+      {0, rp[2], -rp[1]},
+      {-rp[2], 0, rp[0]},
+      {rp[1], -rp[0], 0}
+    };
+
+    for (int j = 0; j < 3; j++) {
+      J[m][j] = dudp[0] * dpdr[0][j] + dudp[1] * dpdr[1][j] + dudp[2] * dpdr[2][j];
+      J[m][j + 3] = dudp[j];
+    }
+
+    m++;
+
+  }
+
+  if (m == 0) {
+    return 0;
+  }
+
+  //S = J P J^T + R
+  double JT[6][4];
+  double PJT[6][4];
+  double S[4][4];
+  Matrix.Transpose((double*)J, m, 6, (double*)JT);
+  Matrix.Multiply((double*)P, (double*)JT, 6, 6, m, (double*)PJT);
+  Matrix.Multiply((double*)J, (double*)PJT, m, 6, m, (double*)S);
+  for (int i = 0; i < m; i++) {
+    S[0][i * m + i] += measurementVariance;
+  }
+
+  if (Matrix.Invert((double*)S, m) == 0) {
+    return 0;
+  }
+
+  //K = P J^T S^-1, dx = K r
+  double K[6][4];
+  double dx[6];
+  Matrix.Multiply((double*)PJT, (double*)S, 6, m, m, (double*)K);
+  Matrix.Multiply((double*)K, r, 6, m, 1, dx);
+
+  //P = (I - K J) P
+  double KJ[6][6];
+  double KJP[6][6];
+  Matrix.Multiply((double*)K, (double*)J, 6, m, 6, (double*)KJ);
+  Matrix.Multiply((double*)KJ, (double*)P, 6, 6, 6, (double*)KJP);
+  Matrix.Subtract((double*)P, (double*)KJP, 6, 6, (double*)P);
+
+  //apply the correction: rotation on the left (base station frame), then position
+  double angle = sqrt(dx[0]*dx[0] + dx[1]*dx[1] + dx[2]*dx[2]);
+  if (angle > 1e-12) {
+    Quaternion dq = Quaternion().setFromAngleAxis(angle * 180.0 / PI,
+      dx[0] / angle, dx[1] / angle, dx[2] / angle);
+    q = Quaternion().multiply(dq, q).normalize();
+  }
+
+  for (int i = 0; i < 3; i++) {
+    pos3D[i] += dx[i + 3];
+  }
+
+  return m;
 
 }
@@ -7,6 +7,7 @@
 #include <Wire.h>
 #include "MatrixMath.h"
 #include "Quaternion.h"
+#include "LighthouseOOTX.h"
 
 
 #if defined(KINETISK)
@@ -30,6 +31,48 @@
 void convertTicksTo2DPositions(uint32_t *clockTicks, double *pos2D);
 
 
+/**
+ * factory calibration of a base station, in the form used per frame by
+ * convertTicksTo2DPositions(). everything that only depends on the
+ * calibration (tangent of the tilt, sine/cosine of the gibbous phase) is
+ * precomputed once, so a corrected frame costs the same every time.
+ * index 0: horizontal sweep (rotor 0), 1: vertical sweep (rotor 1)
+ */
+struct LighthouseCorrection {
+  double phase[2];
+  double tanTilt[2];
+  double curve[2];
+  double gibMag[2];
+  double cosGibPhase[2];
+  double sinGibPhase[2];
+};
+
+
+/**
+ * precompute the correction from the decoded OOTX payload
+ * @param [in] info - base station info, see LighthouseOOTX
+ * @param [out] correction - precomputed correction
+ */
+void precomputeLighthouseCorrection(const BaseStationInfo& info, LighthouseCorrection& correction);
+
+
+/**
+ * convert RAW clock ticks to 2D positions, correcting the sweep angles
+ * for the factory calibration of the base station. follows the model of
+ * libsurvive: the measured angle of one rotor is the ideal angle plus
+ * phase + tan(tilt) * other + curve * other^2 + gibMag * sin(angle + gibPhase),
+ * where other is the angle of the other rotor. the model is inverted with
+ * two fixed-point iterations.
+ * @param [in] clockTicks - raw ticks of timing values in x and y
+ *  for each of the 4 photodiodes
+ * @param [in] correction - see precomputeLighthouseCorrection()
+ * @param [out] pos2D positions of measurements on plane at
+ *   unit distance
+ */
+void convertTicksTo2DPositions(uint32_t *clockTicks, const LighthouseCorrection& correction,
+  double *pos2D);
+
+
 /**
  * form matrix A, that maps sensor positions, b, to homography parameters, h:
  *  b = Ah
@@ -73,7 +116,98 @@ void getRtFromH(double h[8], double ROut[3][3], double pos3DOut[3]);
  * extract a quaternion from a 3x3 rotation matrix
  * follows algorithm here:
  * see http://www.ee.ucr.edu/~farrell/AidedNavigation/D_App_Quaternions/Rot2Quat.pdf
+ * branching on the largest component (Shepperd's method), so it is also
+ * defined for rotations near 180 degrees
  * @param [in] R - 3x3 rotation matrix
  * @returns output quaternion
  */
 Quaternion getQuaternionFromRotationMatrix(double R[3][3]);
+
+
+/**
+ * residual of the homography fit. the four diodes determine h exactly,
+ * so measurement noise shows up as a violation of the rigid body
+ * constraint instead: the first two columns of [R|t] should have the
+ * same length and be orthogonal.
+ * @param [in] h - 8x1 array of homography parameters
+ * @returns relative scale mismatch plus cosine between the columns
+ *  (0 for a perfect rigid fit)
+ */
+double computeHomographyResidual(double h[8]);
+
+
+/**
+ * inverse-variance weight of a pose estimate, used to fuse poses from
+ * multiple base stations. the angular residual of the fit is scaled by
+ * the distance to the base station, since the same angular error moves
+ * the position further the further the board is away.
+ * @param [in] residual - see computeHomographyResidual()
+ * @param [in] pos3D - position of the board in the base station frame, in mm
+ * @returns weight (larger is better)
+ */
+double computePoseWeight(double residual, double pos3D[3]);
+
+
+/**
+ * normalized linear interpolation between two quaternions
+ * @param [in] q0 - quaternion at t = 0
+ * @param [in] q1 - quaternion at t = 1
+ * @param [in] t - interpolation weight [0,1]
+ * @returns normalized blended quaternion
+ */
+Quaternion blendQuaternions(const Quaternion& q0, const Quaternion& q1, double t);
+
+
+/**
+ * applies a rigid transform (qT, tT) to a pose (qIn, posIn):
+ *  posOut = qT * posIn * qT^-1 + tT, qOut = qT * qIn
+ */
+void transformPose(const Quaternion& qT, double tT[3], const Quaternion& qIn,
+  double posIn[3], Quaternion& qOut, double posOut[3]);
+
+
+/**
+ * computes the rigid transform from frame 1 to frame 0, given the
+ * pose of the same board in both frames
+ * @param [in] q0, pos0 - pose of the board in frame 0
+ * @param [in] q1, pos1 - pose of the board in frame 1
+ * @param [out] qOut, posOut - transform that maps frame 1 to frame 0
+ */
+void getRelativeTransform(const Quaternion& q0, double pos0[3], const Quaternion& q1,
+  double pos1[3], Quaternion& qOut, double posOut[3]);
+
+
+/**
+ * grows the covariance of a running pose estimate by a random walk
+ * of the orientation and position over deltaT.
+ * the error state is [rotation x,y,z (rad), position x,y,z (mm)]
+ * @param [in,out] P - 6x6 covariance of the pose error state
+ * @param [in] deltaT - time since the last update in s
+ * @param [in] rotationNoise - rotation random walk in rad^2/s
+ * @param [in] positionNoise - position random walk in mm^2/s
+ */
+void predictPoseCovariance(double P[6][6], double deltaT, double rotationNoise,
+  double positionNoise);
+
+
+/**
+ * corrects a running pose estimate with the measurements of a single sweep,
+ * i.e. one normalized 2D coordinate (x for a horizontal, y for a vertical
+ * sweep) per diode. each diode contributes a 1D angle constraint, so a pose
+ * can be refined every sweep instead of every full horizontal+vertical cycle,
+ * and diodes that are occluded can be left out.
+ * this is the measurement update of an extended Kalman filter on the
+ * error state [rotation x,y,z (rad), position x,y,z (mm)].
+ * @param [in] pos2D - normalized 2D positions, see convertTicksTo2DPositions().
+ *  only the entries of the swept axis are used
+ * @param [in] useDiode - true for each diode (0-3) with a valid detection
+ * @param [in] axis - 0: horizontal sweep, 1: vertical sweep
+ * @param [in] posRef - actual 2D positions of photodiodes in mm
+ * @param [in] measurementVariance - variance of a normalized coordinate
+ * @param [in,out] pos3D - position estimate in mm
+ * @param [in,out] q - orientation estimate
+ * @param [in,out] P - 6x6 covariance of the error state
+ * @returns number of diodes used, 0 if the update failed
+ */
+int updatePoseFromSweep(double pos2D[8], bool useDiode[4], int axis, double posRef[8],
+  double measurementVariance, double pos3D[3], Quaternion& q, double P[6][6]);
@@ -1,4 +1,7 @@
 #include "PoseTracker.h"
+#if VRDUINO_SIMULATED_TABLES
+#include "simulatedLighthouseTable.h"
+#endif
 #include <Wire.h>
 
 PoseTracker::PoseTracker(double alphaImuFilterIn, int baseStationModeIn, bool simulateLighthouseIn) :
@@ -7,6 +10,17 @@ PoseTracker::PoseTracker(double alphaImuFilterIn, int baseStationModeIn, bool si
   lighthouse(),
   simulateLighthouse(simulateLighthouseIn),
   simulateLighthouseCounter(0),
+  simulatedTicks(NULL),
+#if VRDUINO_SIMULATED_TABLES
+  nSimulatedTicks(lighthouseTableRows * 8),
+  lighthouseTable(lighthouseTableData, lighthouseTableLength, lighthouseTableRows, lighthouseTableColumns),
+  simulatedPitch(lighthouseTablePitch),
+  simulatedRoll(lighthouseTableRoll),
+#else
+  nSimulatedTicks(0),
+  simulatedPitch(0),
+  simulatedRoll(0),
+#endif
   position{0,0,-500},
   baseStationPitch(0),
   baseStationRoll(0),
@@ -14,7 +28,21 @@ PoseTracker::PoseTracker(double alphaImuFilterIn, int baseStationModeIn, bool si
   position2D{0,0,0,0,0,0,0,0},
   clockTicks{0,0,0,0,0,0,0,0},
   numPulseDetections{0,0,0,0,0,0,0,0},
-  pulseWidth{0,0,0,0,0,0,0,0}
+  pulseWidth{0,0,0,0,0,0,0,0},
+  trackBothStations(false),
+  stationPose{StationPose(), StationPose()},
+  stationQuaternion(),
+  stationTranslation{0,0,0},
+  stationTransformCount(0),
+  referenceStation(0),
+  sweepUpdate(false),
+  sweepAxis(0),
+  sweepFilterInitialized(false),
+  sweepCovariance{{0}},
+  sweepTimeUs(0),
+  sweepMisses(0),
+  calibrationCorrection(false),
+  correctionAvailable{false, false, false}
 
   {
 
@@ -24,23 +52,51 @@ int PoseTracker::processLighthouse() {
 
   if (simulateLighthouse) {
   //if in simulation mode, get data from external file
-    for (int i = 0; i < 8; i++) {
-      clockTicks[i] = clockTicksData[(simulateLighthouseCounter*8 + i) % nLighthouseSamples];
-      numPulseDetections[i] = 0;
+    if (simulatedTicks != NULL) {
+      for (int i = 0; i < 8; i++) {
+        clockTicks[i] = simulatedTicks[(simulateLighthouseCounter*8 + i) % nSimulatedTicks];
+        numPulseDetections[i] = 0;
+      }
+    } else {
+#if VRDUINO_SIMULATED_TABLES
+      //decode the next row of the compiled in table
+      int32_t ticks[8];
+      lighthouseTable.nextRow(ticks);
+      for (int i = 0; i < 8; i++) {
+        clockTicks[i] = ticks[i];
+        numPulseDetections[i] = 0;
+      }
+#else
+      //nothing to replay
+      return -2;
+#endif
     }
 
     //base station pitch/roll values remain the same throughout the simulation
     if (simulateLighthouseCounter == 0) {
-      baseStationPitch = baseStationPitchSim;
-      baseStationRoll = baseStationRollSim;
+      baseStationPitch = simulatedPitch;
+      baseStationRoll = simulatedRoll;
     }
 
     //data wraps around after end of array is reached
-    simulateLighthouseCounter = (simulateLighthouseCounter + 1) % nLighthouseSamples;
+    simulateLighthouseCounter = (simulateLighthouseCounter + 1) % nSimulatedTicks;
 
     //slight delay to simulate delay between sensor readings (not exactly 120 Hz)
     delay(1);
 
+  } else if (trackBothStations) {
+
+    return processLighthouseBothStations();
+
+  } else if (sweepUpdate) {
+
+    if (!lighthouse.readSweepTimings(baseStationMode, clockTicks, numPulseDetections, pulseWidth,
+      baseStationPitch, baseStationRoll, sweepAxis)) {
+      return -2;
+    }
+
+    return updatePoseFromSweepData();
+
   } else {
     //check data is available
     if (!lighthouse.readTimings(baseStationMode, clockTicks, numPulseDetections, pulseWidth,
@@ -66,25 +122,321 @@ int PoseTracker::processLighthouse() {
  */
 int PoseTracker::updatePose() {
 
-  // call functions in PoseMath.cpp to get a new position
-  // and orientation estimate.
-  //
-  // you will need to use the following class variables:
-  // - clockTicks
-  // - position2D
-  // - positionRef
-  // - position
-  // - quaternionHm
-  //
-  // - position and quaternionHm should hold the your position
-  // and orientation estimates at the end of this function
-  //
-  // return 0 if errors occur, return 1 if successful
+  double residual;
+
+  return solvePose(clockTicks, baseStationMode, position2D, position, quaternionHm, residual);
+
+}
+
+
+void PoseTracker::setSimulatedLighthouse(const uint32_t* ticks, int count, double pitch, double roll) {
+
+  simulatedTicks = ticks;
+  nSimulatedTicks = count * 8;
+  simulatedPitch = pitch;
+  simulatedRoll = roll;
+  simulateLighthouseCounter = 0;
+
+}
+
+
+void PoseTracker::setBaseStationCalibration(int mode, const BaseStationInfo& info) {
+
+  if (mode < 0 || mode >= 3) {
+    return;
+  }
+
+  precomputeLighthouseCorrection(info, correction[mode]);
+  correctionAvailable[mode] = true;
+
+}
+
+
+void PoseTracker::convertTicks(const unsigned long ticks[8], int mode, double pos2D[8]) {
+
+  uint32_t ticks32[8];
+  for (int i = 0; i < 8; i++) {
+    ticks32[i] = ticks[i];
+  }
+
+  if (calibrationCorrection && mode >= 0 && mode < 3) {
+
+    //pick up the calibration once the OOTX frame of this station was decoded
+    if (!correctionAvailable[mode] && !simulateLighthouse) {
+      BaseStationInfo info;
+      if (lighthouse.getBaseStationInfo(mode, info)) {
+        setBaseStationCalibration(mode, info);
+      }
+    }
+
+    if (correctionAvailable[mode]) {
+      convertTicksTo2DPositions(ticks32, correction[mode], pos2D);
+      return;
+    }
+
+  }
+
+  convertTicksTo2DPositions(ticks32, pos2D);
+
+}
+
+
+int PoseTracker::solvePose(const unsigned long ticks[8], int mode, double pos2D[8], double pos3D[3],
+  Quaternion& quaternion, double &residual) {
+
+  convertTicks(ticks, mode, pos2D);
+
+  double A[8][8];
+  formA(pos2D, positionRef, A);
+
+  double h[8];
+  if (!solveForH(A, pos2D, h)) {
+    return 0;
+  }
+
+  double R[3][3];
+  getRtFromH(h, R, pos3D);
+  quaternion = getQuaternionFromRotationMatrix(R);
+  residual = computeHomographyResidual(h);
+
+  return 1;
+
+}
+
+
+int PoseTracker::processLighthouseBothStations() {
+
+  int result = -2;
+
+  for (int i = 0; i < 2; i++) {
+
+    StationPose& station = stationPose[i];
+
+    if (!lighthouse.readStationTimings(i, station.clockTicks, station.numPulseDetections,
+      station.pulseWidth, station.pitch, station.roll, station.mode)) {
+      continue;
+    }
+
+    //same check as for a single station: every diode needs exactly one detection
+    int stationResult = 1;
+    for (int j = 0; j < 8; j++) {
+      if (station.numPulseDetections[j] != 1) {
+        stationResult = -1;
+      }
+    }
+
+    if (stationResult == 1) {
+      stationResult = solvePose(station.clockTicks, station.mode, station.position2D, station.position,
+        station.quaternionHm, station.residual);
+    }
+
+    //a failed frame keeps the last pose, which ages out in fuseStationPoses()
+    if (stationResult == 1) {
+      station.valid = true;
+      station.weight = computePoseWeight(station.residual, station.position);
+      station.timeUs = micros();
+    }
+
+    if (stationResult > result) {
+      result = stationResult;
+    }
+
+  }
+
+  //a fresh station pose doesn't always give a fused one, e.g. the other
+  //station's while the transform is not calibrated yet
+  if (result == 1 && !fuseStationPoses()) {
+    result = 0;
+  }
+
+  return result;
+
+}
+
 
+int PoseTracker::getReferenceStation() const {
 
+  //the station with the requested mode, slot 0 until the modes are decoded
+  return (stationPose[1].mode == baseStationMode) ? 1 : 0;
 
+}
+
+
+bool PoseTracker::isStationPoseFresh(int i, unsigned long now) const {
+
+  return stationPose[i].valid && (now - stationPose[i].timeUs) < kStationPoseTimeoutUs;
+
+}
+
+
+double PoseTracker::getStationFusionWeight(int i, unsigned long now) const {
+
+  //the board moves on while a pose ages, add the distance it may have moved
+  //to the standard deviation of the pose
+  double drift = kStationPoseDriftMmPerUs * (double)(now - stationPose[i].timeUs);
+
+  return 1.0 / (1.0 / stationPose[i].weight + drift * drift);
+
+}
+
+
+bool PoseTracker::fuseStationPoses() {
+
+  unsigned long now = micros();
+
+  int ref = getReferenceStation();
+  int other = 1 - ref;
+
+  //the reference moves to slot 1 once its mode is decoded as baseStationMode.
+  //a transform averaged with the other slot as reference is inverted, start over
+  if (ref != referenceStation) {
+    referenceStation = ref;
+    stationQuaternion = Quaternion();
+    for (int i = 0; i < 3; i++) {
+      stationTranslation[i] = 0;
+    }
+    stationTransformCount = 0;
+  }
+
+  const StationPose& refPose = stationPose[ref];
+  const StationPose& otherPose = stationPose[other];
+
+  bool refFresh = isStationPoseFresh(ref, now);
+  bool otherFresh = isStationPoseFresh(other, now);
+
+  //estimate the station-to-station transform from two nearly simultaneous
+  //poses, and keep it once calibrated: a moving board makes later pairs noisy
+  if (!isStationTransformCalibrated() && refFresh && otherFresh &&
+    (unsigned long)labs((long)(refPose.timeUs - otherPose.timeUs)) < kStationPairMaxAgeUs) {
+
+    Quaternion q;
+    double t[3];
+    getRelativeTransform(refPose.quaternionHm, (double*)refPose.position,
+      otherPose.quaternionHm, (double*)otherPose.position, q, t);
+
+    //running average of the first kStationTransformMinFrames pairs
+    stationTransformCount++;
+    double rate = 1.0 / stationTransformCount;
+
+    stationQuaternion = blendQuaternions(stationQuaternion, q, rate);
+    for (int i = 0; i < 3; i++) {
+      stationTranslation[i] += rate * (t[i] - stationTranslation[i]);
+    }
+
+  }
+
+  if (!isStationTransformCalibrated()) {
+    otherFresh = false;
+  }
+
+  if (!refFresh && !otherFresh) {
+    return false;
+  }
+
+  //pose of the other station in the reference frame
+  Quaternion otherQuaternion;
+  double otherPosition[3];
+  if (otherFresh) {
+    transformPose(stationQuaternion, stationTranslation, otherPose.quaternionHm,
+      (double*)otherPose.position, otherQuaternion, otherPosition);
+  }
+
+  double wRef = refFresh ? getStationFusionWeight(ref, now) : 0;
+  double wOther = otherFresh ? getStationFusionWeight(other, now) : 0;
+  double tOther = wOther / (wRef + wOther);
+
+  for (int i = 0; i < 3; i++) {
+    double pRef = refFresh ? refPose.position[i] : 0;
+    double pOther = otherFresh ? otherPosition[i] : 0;
+    position[i] = (1.0 - tOther) * pRef + tOther * pOther;
+  }
+
+  if (!otherFresh) {
+    quaternionHm = refPose.quaternionHm;
+  } else if (!refFresh) {
+    quaternionHm = otherQuaternion;
+  } else {
+    quaternionHm = blendQuaternions(refPose.quaternionHm, otherQuaternion, tOther);
+  }
+
+  //report raw data and base station info of the reference station
+  for (int i = 0; i < 8; i++) {
+    clockTicks[i] = refPose.clockTicks[i];
+    numPulseDetections[i] = refPose.numPulseDetections[i];
+    pulseWidth[i] = refPose.pulseWidth[i];
+    position2D[i] = refPose.position2D[i];
+  }
+
+  baseStationPitch = refPose.pitch;
+  baseStationRoll = refPose.roll;
+
+  return true;
+
+}
+
+
+int PoseTracker::updatePoseFromSweepData() {
+
+  unsigned long now = micros();
+
+  //(re-)initialize with a full solve, which needs all diodes on both axes
+  if (!sweepFilterInitialized || sweepMisses >= kSweepMaxMisses) {
+
+    for (int i = 0; i < 8; i++) {
+      if (numPulseDetections[i] != 1) {
+        return -1;
+      }
+    }
+
+    if (!updatePose()) {
+      return 0;
+    }
+
+    for (int i = 0; i < 6; i++) {
+      for (int j = 0; j < 6; j++) {
+        sweepCovariance[i][j] = 0;
+      }
+    }
+    for (int i = 0; i < 3; i++) {
+      sweepCovariance[i][i] = kSweepInitialRotationVariance;
+      sweepCovariance[i + 3][i + 3] = kSweepInitialPositionVariance;
+    }
+
+    sweepFilterInitialized = true;
+    sweepMisses = 0;
+    sweepTimeUs = now;
+
+    return 1;
+
+  }
+
+  //use every diode that saw exactly one pulse on this axis
+  bool useDiode[4];
+  int numDiodes = 0;
+  for (int i = 0; i < 4; i++) {
+    useDiode[i] = (numPulseDetections[2*i + sweepAxis] == 1);
+    numDiodes += useDiode[i];
+  }
+
+  predictPoseCovariance(sweepCovariance, (now - sweepTimeUs) / 1000000.0,
+    kSweepRotationNoise, kSweepPositionNoise);
+  sweepTimeUs = now;
+
+  if (numDiodes < 2) {
+    sweepMisses++;
+    return -1;
+  }
+
+  convertTicks(clockTicks, baseStationMode, position2D);
+
+  if (!updatePoseFromSweep(position2D, useDiode, sweepAxis, positionRef,
+    kSweepMeasurementVariance, position, quaternionHm, sweepCovariance)) {
+    sweepMisses++;
+    return 0;
+  }
 
+  sweepMisses = 0;
 
-  return 0;
+  return 1;
 
 }
@@ -6,13 +6,31 @@
  * Low-level timing and sampling is performed by the Lighthouse and Imu classes.
  * All the math is done in PoseMath.h
  *
+ * With two synced base stations (modes B and C), setTrackBothStations(true)
+ * solves a pose for each station every frame instead of dropping the frames
+ * of the station that doesn't match baseStationMode. The pose of the other
+ * station is mapped into the frame of the baseStationMode station with a
+ * station-to-station transform that is estimated on the fly from the first
+ * frames where both stations see the board, and the two poses are fused
+ * weighted by distance, the residual of each homography fit and the age of
+ * each pose.
+ *
+ * setSweepUpdate(true) refines a running pose with every single sweep
+ * (8.33 ms) instead of re-solving the homography once per frame. Each
+ * diode that was hit contributes a 1D angle constraint along the swept
+ * axis to an extended Kalman filter, see updatePoseFromSweep() in PoseMath.
+ * The homography is only used to (re-)initialize the filter.
+ *
+ * setCalibrationCorrection(true) corrects the sweep angles for the factory
+ * calibration each base station broadcasts in its OOTX frame. Leave it off
+ * to compare against the ideal model, e.g. on recorded traces.
+ *
  */
 
 #pragma once
 #include "Lighthouse.h"
 #include "OrientationTracker.h"
 #include "PoseMath.h"
-#include "simulatedLighthouseData.h"
 
 class PoseTracker : public OrientationTracker {
 
@@ -25,7 +43,7 @@ class PoseTracker : public OrientationTracker {
      * @param [in] int baseStationMode - 0:A, 1:B, 2:C. Only responde to measurements
      *   from specified base station
      * @param [in] simulateLighthouseIn - if true, get lighthouse timings from external file
-     *   and ignore lighthouse sensor, and IMU readings.
+     *   and ignore lighthouse sensor, and IMU readings. see SimulationConfig.h
      */
     PoseTracker(double alphaImuFilterIn, int baseStationMode, bool simulateLighthouseIn=false) ;
 
@@ -38,11 +56,122 @@ class PoseTracker : public OrientationTracker {
      *   - -1: lighthouse timing available, but invalid data because at
      *         least 1 diode has 0 detections
      *   -  0: timing available and all diodes have detections,
-     *         but homography estimation fails
+     *         but homography estimation fails, or when tracking both
+     *         stations, no station could contribute to the fused pose
      *   -  1: timing available, diodes have detections, and pose updated
      */
     int processLighthouse();
 
+    /**
+     * if true, process the timings of both base stations every frame and
+     * report a fused pose in getPosition()/getQuaternionHm(). the frame of the
+     * fused pose is the one of the station with mode baseStationMode.
+     */
+    void setTrackBothStations(bool enable) { trackBothStations = enable; };
+
+    /**
+     * x,y,z position of board from base station in slot i (0 or 1), in the
+     * frame of that station. units is mm
+     */
+    const double * getStationPosition(int i) const { return stationPose[i].position; };
+
+    /**
+     * quaternion of board from base station in slot i (0 or 1)
+     */
+    const Quaternion& getStationQuaternionHm(int i) const { return stationPose[i].quaternionHm; };
+
+    /**
+     * mode of base station in slot i (0:A, 1:B, 2:C, -1: unknown)
+     */
+    int getStationMode(int i) const { return stationPose[i].mode; };
+
+    /**
+     * weight of the last pose from base station in slot i, see
+     * computePoseWeight(). 0 if the station has not produced a pose yet
+     */
+    double getStationWeight(int i) const { return stationPose[i].valid ? stationPose[i].weight : 0; };
+
+    /**
+     * true once the transform between the two base stations is known,
+     * so that both can contribute to the fused pose
+     */
+    bool isStationTransformCalibrated() const { return stationTransformCount >= kStationTransformMinFrames; };
+
+    /**
+     * if true, correct the pose with each single-axis sweep as it arrives.
+     * only applies to tracking a single base station
+     */
+    void setSweepUpdate(bool enable) { sweepUpdate = enable; sweepFilterInitialized = false; };
+
+    /**
+     * axis of the most recent sweep (0: horizontal, 1: vertical)
+     */
+    int getSweepAxis() const { return sweepAxis; };
+
+    /**
+     * if true, correct the sweep angles with the factory calibration of the
+     * base station. the calibration is taken from the OOTX frame once it has
+     * been received, or from setBaseStationCalibration()
+     */
+    void setCalibrationCorrection(bool enable) { calibrationCorrection = enable; };
+
+    /**
+     * set the calibration of a base station by hand, e.g. for recorded traces
+     * where no OOTX frame is available
+     * @param [in] mode - mode of the base station (0:A, 1:B, 2:C)
+     * @param [in] info - base station info with the rotor calibration
+     */
+    void setBaseStationCalibration(int mode, const BaseStationInfo& info);
+
+    /**
+     * true if a calibration for the base station with this mode is available
+     */
+    bool hasBaseStationCalibration(int mode) const { return mode >= 0 && mode < 3 && correctionAvailable[mode]; };
+
+    /**
+     * replays clock ticks from the given array instead of the compiled in
+     * table (SimulationConfig.h) when simulating. the array is used in place,
+     * e.g. the records of a lighthouse chunk of a mapped session log
+     * (SessionLog.h) or a table in flash.
+     * @param [in] ticks - count rows of 8 clock ticks, same order as clockTicks
+     * @param [in] count - number of rows
+     * @param [in] pitch - base station pitch in degrees during the recording
+     * @param [in] roll - base station roll in degrees during the recording
+     */
+    void setSimulatedLighthouse(const uint32_t* ticks, int count, double pitch, double roll);
+
+    /**
+     * same as OrientationTracker::simulationReady(), and also false if
+     * simulateLighthouse is set without ticks from setSimulatedLighthouse()
+     * or the compiled in table. processLighthouse() returns -2 then
+     */
+    bool simulationReady() const {
+      return OrientationTracker::simulationReady() &&
+        (!simulateLighthouse || simulatedTicks != NULL || VRDUINO_SIMULATED_TABLES);
+    };
+
+    /**
+     * reads the raw timings of the most recent sweep of a base station
+     * without updating the pose, e.g. to record them (SessionRecorder.h).
+     * see Lighthouse::readStationSweepTimings()
+     * @param [in] stationIndex - slot of the station (0 or 1)
+     * @returns true if a new sweep of this station was available
+     */
+    bool readStationSweep(int stationIndex, unsigned long ticks[8], unsigned long detections[8],
+      unsigned long widths[8], double &pitch, double &roll, int &mode, int &axis) {
+      return lighthouse.readStationSweepTimings(stationIndex, ticks, detections, widths, pitch, roll, mode, axis);
+    };
+
+    /**
+     * feeds a recorded sweep to the next processLighthouse() as if the
+     * photodiodes had just seen it, e.g. to replay a session log on the
+     * host. leave simulateLighthouse off. see Lighthouse::replaySweepTimings()
+     */
+    void replayStationSweep(int stationIndex, const unsigned long ticks[8], const unsigned long detections[8],
+      const unsigned long widths[8], double pitch, double roll, int mode, int axis) {
+      lighthouse.replaySweepTimings(stationIndex, ticks, detections, widths, pitch, roll, mode, axis);
+    };
+
     /**
      * x,y,z position of board from base station. units is mm
      */
@@ -122,6 +251,59 @@ class PoseTracker : public OrientationTracker {
      */
     int updatePose();
 
+    /**
+     * homography pipeline shared by updatePose() and the per-station update:
+     * clock ticks -> 2D positions -> h -> R,t -> quaternion
+     * @param [out] residual - rigid body residual of h, see computeHomographyResidual()
+     * @returns 0 if the matrix inversion failed, 1 if successful
+     */
+    int solvePose(const unsigned long ticks[8], int mode, double pos2D[8], double pos3D[3],
+      Quaternion& quaternion, double &residual);
+
+    /**
+     * converts ticks to 2D positions with convertTicksTo2DPositions(),
+     * applying the calibration of the base station with this mode if
+     * calibrationCorrection is set
+     */
+    void convertTicks(const unsigned long ticks[8], int mode, double pos2D[8]);
+
+    /**
+     * reads and solves the pose of both stations, then fuses them.
+     * same return values as processLighthouse()
+     */
+    int processLighthouseBothStations();
+
+    /**
+     * updates the station-to-station transform if both stations have a
+     * fresh pose, and writes the fused pose into position/quaternionHm
+     * @returns false if no station can contribute a pose
+     */
+    bool fuseStationPoses();
+
+    /**
+     * slot of the station whose frame the fused pose is reported in
+     */
+    int getReferenceStation() const;
+
+    /**
+     * true if the pose of station i is valid and recent enough to be fused
+     */
+    bool isStationPoseFresh(int i, unsigned long now) const;
+
+    /**
+     * fusion weight of the pose of station i at time now: its inverse
+     * variance from computePoseWeight(), with the distance the board may
+     * have moved since (kStationPoseDriftMmPerUs) added to the deviation
+     */
+    double getStationFusionWeight(int i, unsigned long now) const;
+
+    /**
+     * corrects the running pose with the sweep that just arrived, or
+     * initializes it with a full homography solve.
+     * same return values as processLighthouse()
+     */
+    int updatePoseFromSweepData();
+
     /** lighthouse object for sampling from lighthouse */
     Lighthouse lighthouse;
 
@@ -137,6 +319,26 @@ class PoseTracker : public OrientationTracker {
      */
     int simulateLighthouseCounter;
 
+    /**
+     * simulated clock ticks set with setSimulatedLighthouse(), 8 per row,
+     * and the number of ticks. NULL to replay the compiled in table
+     */
+    const uint32_t* simulatedTicks;
+    int nSimulatedTicks;
+
+#if VRDUINO_SIMULATED_TABLES
+    /**
+     * decoder of the compiled in table (simulatedLighthouseTable.h)
+     */
+    SimulatedTableDecoder lighthouseTable;
+#endif
+
+    /**
+     * base station pitch/roll of the simulated clock ticks
+     */
+    double simulatedPitch;
+    double simulatedRoll;
+
     /**
      * most recent estimate of translation (ordrer: x,y,z) in mm
      */
@@ -203,5 +405,160 @@ class PoseTracker : public OrientationTracker {
      */
     unsigned long pulseWidth[8];
 
+    /**
+     * per-station data when tracking both base stations
+     */
+    struct StationPose {
+
+      /** raw timings, same order as clockTicks */
+      unsigned long clockTicks[8];
+      unsigned long numPulseDetections[8];
+      unsigned long pulseWidth[8];
+
+      /** 2D normalized coordinates, same order as position2D */
+      double position2D[8];
+
+      /** pose of the board in the frame of this station */
+      double position[3];
+      Quaternion quaternionHm;
+
+      /** rigid body residual of the homography and resulting fusion weight */
+      double residual;
+      double weight;
+
+      /** base station pitch/roll in degrees and mode (0:A, 1:B, 2:C) */
+      double pitch;
+      double roll;
+      int mode;
+
+      /** true once a frame of this station produced a pose. a failed frame
+       *  keeps the last one, which ages out in fuseStationPoses() */
+      bool valid;
+
+      /** micros() when the pose was updated */
+      unsigned long timeUs;
+
+      StationPose() :
+        clockTicks{0,0,0,0,0,0,0,0},
+        numPulseDetections{0,0,0,0,0,0,0,0},
+        pulseWidth{0,0,0,0,0,0,0,0},
+        position2D{0,0,0,0,0,0,0,0},
+        position{0,0,-500},
+        quaternionHm(),
+        residual(0),
+        weight(0),
+        pitch(0),
+        roll(0),
+        mode(-1),
+        valid(false),
+        timeUs(0)
+      {}
+
+    };
+
+    /**
+     * if true, use both base stations. see setTrackBothStations()
+     */
+    bool trackBothStations;
+
+    /**
+     * most recent pose from each station slot
+     */
+    StationPose stationPose[2];
+
+    /**
+     * transform from the frame of the non-reference station to the frame of
+     * the reference station, see getReferenceStation()
+     */
+    Quaternion stationQuaternion;
+    double stationTranslation[3];
+
+    /**
+     * number of frames that went into the station-to-station transform
+     */
+    int stationTransformCount;
+
+    /**
+     * reference slot the transform was estimated for, see getReferenceStation()
+     */
+    int referenceStation;
+
+    /**
+     * frames needed before the other station contributes to the fused pose
+     */
+    static const int kStationTransformMinFrames = 30;
+
+    /**
+     * station poses further apart in time than this are not used to update
+     * the station-to-station transform (the same or neighbouring sweeps)
+     */
+    static const unsigned long kStationPairMaxAgeUs = 9000;
+
+    /**
+     * station poses older than this are not fused (a few missed frames)
+     */
+    static const unsigned long kStationPoseTimeoutUs = 100000;
+
+    /**
+     * how far the board may move per microsecond (1 m/s), so how fast the
+     * standard deviation of a station pose grows with its age
+     */
+    static constexpr double kStationPoseDriftMmPerUs = 0.001;
+
+    /**
+     * if true, update the pose per sweep. see setSweepUpdate()
+     */
+    bool sweepUpdate;
+
+    /**
+     * axis of the most recent sweep (0: horizontal, 1: vertical)
+     */
+    int sweepAxis;
+
+    /**
+     * true once the running pose was initialized with a homography solve
+     */
+    bool sweepFilterInitialized;
+
+    /**
+     * 6x6 covariance of the running pose, error state is
+     * [rotation x,y,z (rad), position x,y,z (mm)]
+     */
+    double sweepCovariance[6][6];
+
+    /**
+     * micros() of the previous sweep update
+     */
+    unsigned long sweepTimeUs;
+
+    /**
+     * number of consecutive sweeps that could not be used. the filter is
+     * re-initialized after kSweepMaxMisses
+     */
+    int sweepMisses;
+
+    static const int kSweepMaxMisses = 8;
+
+    /**
+     * noise parameters of the sweep filter. the random walk is tuned for
+     * fast head motion, the measurement variance is that of a normalized
+     * coordinate (~0.05 deg angular noise)
+     */
+    static constexpr double kSweepRotationNoise = 4.0;      // rad^2/s
+    static constexpr double kSweepPositionNoise = 2.5e5;    // mm^2/s
+    static constexpr double kSweepMeasurementVariance = 1e-6;
+    static constexpr double kSweepInitialRotationVariance = 1e-3;  // rad^2
+    static constexpr double kSweepInitialPositionVariance = 100.0; // mm^2
+
+    /**
+     * if true, correct for the base station calibration. see setCalibrationCorrection()
+     */
+    bool calibrationCorrection;
+
+    /**
+     * precomputed calibration per base station mode (0:A, 1:B, 2:C)
+     */
+    LighthouseCorrection correction[3];
+    bool correctionAvailable[3];
 
 };
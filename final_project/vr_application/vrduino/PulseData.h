@@ -77,6 +77,12 @@ struct PulseData {
     /** 0 if horizontal, 1 if vertical */
     volatile int axis;
 
+    /**
+     * axis of the sweep that was moved to the permanent buffers at the last
+     * sync pulse, i.e. the entries of sweepPulseTicks that are new
+     */
+    volatile int dataAxis;
+
     /** true if current period has a skip bit. (laser turns off for sweep)  */
     volatile bool skip;
 
@@ -102,6 +108,7 @@ struct PulseData {
       minPulseDifferences{0,0,0,0,0,0,0,0},
       dataAvailable(false),
       axis(0),
+      dataAxis(0),
       skip(true),
       pitch(0.0),
       roll(0.0),
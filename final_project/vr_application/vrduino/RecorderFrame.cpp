@@ -0,0 +1,253 @@
+#include "RecorderFrame.h"
+#include <string.h>
+
+/**
+ * sequential little endian writer/reader of a payload. the VRduino and the
+ * host are both little endian, so fields are copied as they are
+ */
+struct PayloadCursor {
+  uint8_t* data;
+  int position;
+
+  template <typename T> void put(T value) {
+    memcpy(data + position, &value, sizeof(T));
+    position += sizeof(T);
+  }
+
+  template <typename T> T get() {
+    T value;
+    memcpy(&value, data + position, sizeof(T));
+    position += sizeof(T);
+    return value;
+  }
+};
+
+
+/** CRC-16/CCITT-FALSE, same as crc16Ccitt() in SerialFrame.cpp */
+static uint16_t recorderCrc16(const uint8_t* data, int length) {
+
+  uint16_t crc = 0xFFFF;
+  for (int i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+
+}
+
+
+/**
+ * appends the CRC to the payload, COBS encodes it into out and adds the
+ * zero delimiter. payloads are shorter than 254 bytes, so there is a single
+ * COBS block per zero byte
+ */
+static int finishFrame(uint8_t* payload, PayloadCursor& cursor, uint8_t* out) {
+
+  cursor.put<uint16_t>(recorderCrc16(payload, cursor.position));
+
+  int codeIndex = 0;
+  int outIndex = 1;
+  uint8_t code = 1;
+  for (int i = 0; i < cursor.position; i++) {
+    if (payload[i] == 0) {
+      out[codeIndex] = code;
+      codeIndex = outIndex++;
+      code = 1;
+    } else {
+      out[outIndex++] = payload[i];
+      code++;
+    }
+  }
+  out[codeIndex] = code;
+  out[outIndex++] = 0;
+
+  return outIndex;
+
+}
+
+
+int encodeRecorderStart(const RecorderStart& start, uint8_t* out) {
+
+  uint8_t payload[RECORDER_PAYLOAD_MAX_LENGTH];
+  PayloadCursor cursor = {payload, 0};
+  cursor.put<uint8_t>(RECORDER_FRAME_START);
+  cursor.put<uint8_t>(RECORDER_FRAME_VERSION);
+  cursor.put<uint32_t>(start.timeUs);
+  cursor.put<int8_t>(start.baseStationMode);
+  for (int i = 0; i < 3; i++) {
+    cursor.put<float>(start.gyrBias[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    cursor.put<float>(start.accBias[i]);
+  }
+  return finishFrame(payload, cursor, out);
+
+}
+
+
+int encodeRecorderImu(const RecorderImu& imu, uint8_t* out) {
+
+  uint8_t payload[RECORDER_PAYLOAD_MAX_LENGTH];
+  PayloadCursor cursor = {payload, 0};
+  cursor.put<uint8_t>(RECORDER_FRAME_IMU);
+  cursor.put<uint16_t>(imu.sequence);
+  cursor.put<uint32_t>(imu.timeUs);
+  for (int i = 0; i < 3; i++) {
+    cursor.put<float>(imu.gyr[i]);
+  }
+  for (int i = 0; i < 3; i++) {
+    cursor.put<float>(imu.acc[i]);
+  }
+  return finishFrame(payload, cursor, out);
+
+}
+
+
+int encodeRecorderSweep(const RecorderSweep& sweep, uint8_t* out) {
+
+  uint8_t payload[RECORDER_PAYLOAD_MAX_LENGTH];
+  PayloadCursor cursor = {payload, 0};
+  cursor.put<uint8_t>(RECORDER_FRAME_SWEEP);
+  cursor.put<uint16_t>(sweep.sequence);
+  cursor.put<uint32_t>(sweep.timeUs);
+  cursor.put<uint8_t>(sweep.station);
+  cursor.put<int8_t>(sweep.mode);
+  cursor.put<uint8_t>(sweep.axis);
+  cursor.put<float>(sweep.pitch);
+  cursor.put<float>(sweep.roll);
+  for (int i = 0; i < 8; i++) {
+    cursor.put<uint32_t>(sweep.clockTicks[i]);
+  }
+  for (int i = 0; i < 8; i++) {
+    cursor.put<uint8_t>(sweep.numPulseDetections[i]);
+  }
+  for (int i = 0; i < 8; i++) {
+    cursor.put<uint16_t>(sweep.pulseWidth[i]);
+  }
+  return finishFrame(payload, cursor, out);
+
+}
+
+
+int encodeRecorderStatus(const RecorderStatus& status, uint8_t* out) {
+
+  uint8_t payload[RECORDER_PAYLOAD_MAX_LENGTH];
+  PayloadCursor cursor = {payload, 0};
+  cursor.put<uint8_t>(RECORDER_FRAME_STATUS);
+  cursor.put<uint32_t>(status.timeUs);
+  cursor.put<uint32_t>(status.imuRecorded);
+  cursor.put<uint32_t>(status.imuDropped);
+  cursor.put<uint32_t>(status.sweepsRecorded);
+  cursor.put<uint32_t>(status.sweepsDropped);
+  cursor.put<uint16_t>(status.bufferHighWater);
+  return finishFrame(payload, cursor, out);
+
+}
+
+
+/** payload length of a frame type, 0 if unknown */
+static int recorderPayloadLength(int type) {
+
+  switch (type) {
+    case RECORDER_FRAME_START:
+      return RECORDER_START_PAYLOAD_LENGTH;
+    case RECORDER_FRAME_IMU:
+      return RECORDER_IMU_PAYLOAD_LENGTH;
+    case RECORDER_FRAME_SWEEP:
+      return RECORDER_SWEEP_PAYLOAD_LENGTH;
+    case RECORDER_FRAME_STATUS:
+      return RECORDER_STATUS_PAYLOAD_LENGTH;
+    default:
+      return 0;
+  }
+
+}
+
+
+bool decodeRecorderFrame(const uint8_t* frame, int length, RecorderFrame& decoded) {
+
+  //a single COBS block: the first byte points at the next zero, and so on
+  if (length < 2 || length > RECORDER_PAYLOAD_MAX_LENGTH + 1) {
+    return false;
+  }
+  uint8_t payload[RECORDER_PAYLOAD_MAX_LENGTH];
+  int payloadLength = 0;
+  int i = 0;
+  while (i < length) {
+    uint8_t code = frame[i++];
+    if (code == 0 || i + code - 1 > length) {
+      return false;
+    }
+    for (int j = 1; j < code; j++) {
+      if (frame[i] == 0) {
+        return false;
+      }
+      payload[payloadLength++] = frame[i++];
+    }
+    if (i < length) {
+      payload[payloadLength++] = 0;
+    }
+  }
+
+  if (payloadLength < 3 || payloadLength != recorderPayloadLength(payload[0])) {
+    return false;
+  }
+  uint16_t crc;
+  memcpy(&crc, payload + payloadLength - 2, sizeof(crc));
+  if (crc != recorderCrc16(payload, payloadLength - 2)) {
+    return false;
+  }
+
+  PayloadCursor cursor = {payload, 0};
+  decoded.type = cursor.get<uint8_t>();
+
+  if (decoded.type == RECORDER_FRAME_START) {
+    decoded.version = cursor.get<uint8_t>();
+    decoded.start.timeUs = cursor.get<uint32_t>();
+    decoded.start.baseStationMode = cursor.get<int8_t>();
+    for (int k = 0; k < 3; k++) {
+      decoded.start.gyrBias[k] = cursor.get<float>();
+    }
+    for (int k = 0; k < 3; k++) {
+      decoded.start.accBias[k] = cursor.get<float>();
+    }
+  } else if (decoded.type == RECORDER_FRAME_IMU) {
+    decoded.imu.sequence = cursor.get<uint16_t>();
+    decoded.imu.timeUs = cursor.get<uint32_t>();
+    for (int k = 0; k < 3; k++) {
+      decoded.imu.gyr[k] = cursor.get<float>();
+    }
+    for (int k = 0; k < 3; k++) {
+      decoded.imu.acc[k] = cursor.get<float>();
+    }
+  } else if (decoded.type == RECORDER_FRAME_SWEEP) {
+    decoded.sweep.sequence = cursor.get<uint16_t>();
+    decoded.sweep.timeUs = cursor.get<uint32_t>();
+    decoded.sweep.station = cursor.get<uint8_t>();
+    decoded.sweep.mode = cursor.get<int8_t>();
+    decoded.sweep.axis = cursor.get<uint8_t>();
+    decoded.sweep.pitch = cursor.get<float>();
+    decoded.sweep.roll = cursor.get<float>();
+    for (int k = 0; k < 8; k++) {
+      decoded.sweep.clockTicks[k] = cursor.get<uint32_t>();
+    }
+    for (int k = 0; k < 8; k++) {
+      decoded.sweep.numPulseDetections[k] = cursor.get<uint8_t>();
+    }
+    for (int k = 0; k < 8; k++) {
+      decoded.sweep.pulseWidth[k] = cursor.get<uint16_t>();
+    }
+  } else {
+    decoded.status.timeUs = cursor.get<uint32_t>();
+    decoded.status.imuRecorded = cursor.get<uint32_t>();
+    decoded.status.imuDropped = cursor.get<uint32_t>();
+    decoded.status.sweepsRecorded = cursor.get<uint32_t>();
+    decoded.status.sweepsDropped = cursor.get<uint32_t>();
+    decoded.status.bufferHighWater = cursor.get<uint16_t>();
+  }
+
+  return true;
+
+}
@@ -0,0 +1,118 @@
+/**
+ * @file
+ * binary frames written by SessionRecorder: raw IMU readings and lighthouse
+ * sweeps at full rate, decoded on the host by session_tools/frames_to_session.
+ *
+ * the framing is the one of vr_handheld_lib/VRHandheld/SerialFrame.h: the
+ * payload ends with a CRC-16/CCITT-FALSE of the bytes before it, is COBS
+ * encoded (so it contains no zero bytes) and terminated by a zero byte. a
+ * reader can resync at any zero byte and drops chunks that fail the CRC or
+ * don't have the length of their type, e.g. text printed by the tests.
+ *
+ * payloads (little endian):
+ * \verbatim
+ * start  (sent once):  type, uint8 version, uint32 micros, int8 base station mode,
+ *                      float gyr bias x,y,z, float acc bias x,y,z, crc
+ * imu:                 type, uint16 sequence, uint32 micros,
+ *                      float gyr x,y,z (deg/s), float acc x,y,z (m/s^2), crc
+ *                      (before bias subtraction since version 2, version 1
+ *                      recorded them with the bias of the start frame
+ *                      already subtracted)
+ * sweep:               type, uint16 sequence, uint32 micros, uint8 station,
+ *                      int8 mode, uint8 axis, float pitch, float roll,
+ *                      uint32 clock ticks[8], uint8 pulse detections[8],
+ *                      uint16 pulse width[8], crc
+ * status (every 1 s):  type, uint32 micros, uint32 imu recorded, uint32 imu dropped,
+ *                      uint32 sweeps recorded, uint32 sweeps dropped,
+ *                      uint16 buffer high water mark in bytes, crc
+ * \endverbatim
+ *
+ * the sequence numbers count every reading, including the ones the recorder
+ * dropped, so the host sees drops as gaps. pulse detections and widths
+ * saturate at the maximum of their type.
+ *
+ * does not depend on Arduino, so the host tools compile it too.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#define RECORDER_FRAME_VERSION 2
+
+#define RECORDER_FRAME_START 0x10
+#define RECORDER_FRAME_IMU 0x11
+#define RECORDER_FRAME_SWEEP 0x12
+#define RECORDER_FRAME_STATUS 0x13
+
+#define RECORDER_START_PAYLOAD_LENGTH 33
+#define RECORDER_IMU_PAYLOAD_LENGTH 33
+#define RECORDER_SWEEP_PAYLOAD_LENGTH 76
+#define RECORDER_STATUS_PAYLOAD_LENGTH 25
+#define RECORDER_PAYLOAD_MAX_LENGTH RECORDER_SWEEP_PAYLOAD_LENGTH
+
+/** longest frame including the COBS overhead byte and the zero delimiter */
+#define RECORDER_FRAME_MAX_LENGTH (RECORDER_PAYLOAD_MAX_LENGTH + 2)
+
+struct RecorderStart {
+  uint32_t timeUs;
+  int8_t baseStationMode;
+  float gyrBias[3];
+  float accBias[3];
+};
+
+struct RecorderImu {
+  uint16_t sequence;
+  uint32_t timeUs;
+  float gyr[3];
+  float acc[3];
+};
+
+struct RecorderSweep {
+  uint16_t sequence;
+  uint32_t timeUs;
+  uint8_t station;
+  int8_t mode;
+  uint8_t axis;
+  float pitch;
+  float roll;
+  uint32_t clockTicks[8];
+  uint8_t numPulseDetections[8];
+  uint16_t pulseWidth[8];
+};
+
+struct RecorderStatus {
+  uint32_t timeUs;
+  uint32_t imuRecorded;
+  uint32_t imuDropped;
+  uint32_t sweepsRecorded;
+  uint32_t sweepsDropped;
+  uint16_t bufferHighWater;
+};
+
+/**
+ * a decoded frame, only the member matching type is set
+ */
+struct RecorderFrame {
+  int type;
+  uint8_t version;
+  RecorderStart start;
+  RecorderImu imu;
+  RecorderSweep sweep;
+  RecorderStatus status;
+};
+
+/**
+ * encode a complete frame including the zero delimiter
+ * @param [out] out - at least RECORDER_FRAME_MAX_LENGTH bytes
+ * @returns length of the frame in bytes
+ */
+int encodeRecorderStart(const RecorderStart& start, uint8_t* out);
+int encodeRecorderImu(const RecorderImu& imu, uint8_t* out);
+int encodeRecorderSweep(const RecorderSweep& sweep, uint8_t* out);
+int encodeRecorderStatus(const RecorderStatus& status, uint8_t* out);
+
+/**
+ * decode a frame given without its zero delimiter
+ * @returns false on COBS, length, CRC or type mismatch
+ */
+bool decodeRecorderFrame(const uint8_t* frame, int length, RecorderFrame& decoded);
@@ -0,0 +1,176 @@
+#include "SessionRecorder.h"
+
+SessionRecorder::SessionRecorder(Print& outIn) :
+
+  out(outIn),
+  bufferStart(0),
+  bufferCount(0),
+  bufferHighWater(0),
+  imuSequence(0),
+  sweepSequence(0),
+  imuRecorded(0),
+  imuDropped(0),
+  sweepsRecorded(0),
+  sweepsDropped(0),
+  statusTimeUs(0)
+
+  {
+
+}
+
+void SessionRecorder::begin(const OrientationTracker& tracker, int baseStationMode) {
+
+  RecorderStart start;
+  start.timeUs = micros();
+  start.baseStationMode = baseStationMode;
+  for (int i = 0; i < 3; i++) {
+    start.gyrBias[i] = tracker.getGyrBias()[i];
+    start.accBias[i] = tracker.getAccBias()[i];
+  }
+
+  uint8_t frame[RECORDER_FRAME_MAX_LENGTH];
+  queueFrame(frame, encodeRecorderStart(start, frame));
+  statusTimeUs = start.timeUs;
+  flush();
+
+}
+
+void SessionRecorder::recordSensors(OrientationTracker& tracker) {
+
+  recordImu(tracker);
+  recordStatus();
+  flush();
+
+}
+
+void SessionRecorder::recordSensors(PoseTracker& tracker) {
+
+  recordImu(tracker);
+
+  RecorderSweep sweep;
+  unsigned long ticks[8];
+  unsigned long detections[8];
+  unsigned long widths[8];
+  double pitch;
+  double roll;
+  int mode;
+  int axis;
+
+  for (int station = 0; station < 2; station++) {
+
+    if (!tracker.readStationSweep(station, ticks, detections, widths, pitch, roll, mode, axis)) {
+      continue;
+    }
+
+    sweep.sequence = sweepSequence++;
+    sweep.timeUs = micros();
+    sweep.station = station;
+    sweep.mode = mode;
+    sweep.axis = axis;
+    sweep.pitch = pitch;
+    sweep.roll = roll;
+    for (int i = 0; i < 8; i++) {
+      sweep.clockTicks[i] = ticks[i];
+      sweep.numPulseDetections[i] = min(detections[i], 255UL);
+      sweep.pulseWidth[i] = min(widths[i], 65535UL);
+    }
+
+    uint8_t frame[RECORDER_FRAME_MAX_LENGTH];
+    if (queueFrame(frame, encodeRecorderSweep(sweep, frame))) {
+      sweepsRecorded++;
+    } else {
+      sweepsDropped++;
+    }
+
+  }
+
+  recordStatus();
+  flush();
+
+}
+
+void SessionRecorder::recordImu(OrientationTracker& tracker) {
+
+  //only sample, the orientation is not needed while recording
+  if (!tracker.readImu()) {
+    return;
+  }
+
+  RecorderImu imu;
+  imu.sequence = imuSequence++;
+  imu.timeUs = micros();
+  for (int i = 0; i < 3; i++) {
+    imu.gyr[i] = tracker.getRawGyr()[i];
+    imu.acc[i] = tracker.getRawAcc()[i];
+  }
+
+  uint8_t frame[RECORDER_FRAME_MAX_LENGTH];
+  if (queueFrame(frame, encodeRecorderImu(imu, frame))) {
+    imuRecorded++;
+  } else {
+    imuDropped++;
+  }
+
+}
+
+void SessionRecorder::recordStatus() {
+
+  unsigned long now = micros();
+  if (now - statusTimeUs < kStatusPeriodUs) {
+    return;
+  }
+
+  RecorderStatus status;
+  status.timeUs = now;
+  status.imuRecorded = imuRecorded;
+  status.imuDropped = imuDropped;
+  status.sweepsRecorded = sweepsRecorded;
+  status.sweepsDropped = sweepsDropped;
+  status.bufferHighWater = bufferHighWater;
+
+  //retried with the next reading if the buffer is full
+  uint8_t frame[RECORDER_FRAME_MAX_LENGTH];
+  if (queueFrame(frame, encodeRecorderStatus(status, frame))) {
+    statusTimeUs = now;
+  }
+
+}
+
+bool SessionRecorder::queueFrame(const uint8_t* frame, int length) {
+
+  if (bufferCount + length > kBufferSize) {
+    return false;
+  }
+
+  for (int i = 0; i < length; i++) {
+    buffer[(bufferStart + bufferCount + i) % kBufferSize] = frame[i];
+  }
+  bufferCount += length;
+  bufferHighWater = max(bufferHighWater, bufferCount);
+
+  return true;
+
+}
+
+void SessionRecorder::flush() {
+
+  //write the contiguous part up to the end of the buffer, then the wrapped part
+  while (bufferCount > 0) {
+
+    int available = out.availableForWrite();
+    int length = min(min(bufferCount, kBufferSize - bufferStart), available);
+    if (length <= 0) {
+      return;
+    }
+
+    int written = out.write(buffer + bufferStart, length);
+    bufferStart = (bufferStart + written) % kBufferSize;
+    bufferCount -= written;
+
+    if (written < length) {
+      return;
+    }
+
+  }
+
+}
@@ -0,0 +1,109 @@
+/**
+ * @class SessionRecorder
+ * Streams the raw sensor readings the trackers work with, instead of the
+ * poses derived from them, so that a session can be replayed offline:
+ * every IMU reading and every lighthouse sweep of both base stations with
+ * clock ticks, number of pulse detections and pulse widths.
+ *
+ * Readings are written as binary frames (RecorderFrame.h) at full rate.
+ * Frames are queued in a ring buffer and only as many bytes are written as
+ * the serial port takes without blocking, so tracking is never slowed down
+ * by a slow or absent host. A reading whose frame doesn't fit in the buffer
+ * is dropped and counted; drops show up as sequence gaps on the host and
+ * in the status frame sent every second.
+ *
+ * Convert a capture of the serial port, e.g.
+ * `stty -F /dev/ttyACM0 raw && cat /dev/ttyACM0 > capture.bin`, with
+ * session_tools/frames_to_session into a session log for replay.
+ */
+
+#pragma once
+#include <Arduino.h>
+#include "RecorderFrame.h"
+#include "OrientationTracker.h"
+#include "PoseTracker.h"
+
+class SessionRecorder {
+
+  public:
+
+    /**
+     * @param [in] out - where frames are written, e.g. Serial
+     */
+    SessionRecorder(Print& out);
+
+    /**
+     * queues the start frame with the IMU bias of the tracker. call once
+     * after the bias was measured
+     * @param [in] baseStationMode - mode the tracker follows (0:A, 1:B, 2:C)
+     */
+    void begin(const OrientationTracker& tracker, int baseStationMode);
+
+    /**
+     * samples the IMU through the tracker and queues the reading, then
+     * writes as much of the queue as the port takes. the orientation is
+     * not updated
+     */
+    void recordSensors(OrientationTracker& tracker);
+
+    /**
+     * same as above, plus the most recent sweep of each base station.
+     * the pose is not updated
+     */
+    void recordSensors(PoseTracker& tracker);
+
+    /**
+     * writes queued bytes without blocking
+     */
+    void flush();
+
+    /** readings queued for writing since begin() */
+    unsigned long getImuRecorded() const { return imuRecorded; };
+    unsigned long getSweepsRecorded() const { return sweepsRecorded; };
+
+    /** readings dropped because the queue was full */
+    unsigned long getImuDropped() const { return imuDropped; };
+    unsigned long getSweepsDropped() const { return sweepsDropped; };
+
+  protected:
+
+    /**
+     * queues the IMU reading of the tracker if it had a new one, before
+     * bias subtraction (the start frame carries the bias)
+     */
+    void recordImu(OrientationTracker& tracker);
+
+    /** queues the status frame once per kStatusPeriodUs */
+    void recordStatus();
+
+    /**
+     * copies a complete frame into the ring buffer
+     * @returns false if it doesn't fit, nothing is queued then
+     */
+    bool queueFrame(const uint8_t* frame, int length);
+
+    Print& out;
+
+    /**
+     * ring buffer of encoded frames. about 40 ms of readings at full rate,
+     * small enough for the Teensy LC
+     */
+    static const int kBufferSize = 2048;
+    uint8_t buffer[kBufferSize];
+    int bufferStart;
+    int bufferCount;
+    int bufferHighWater;
+
+    /** sequence numbers of the next reading, dropped ones included */
+    uint16_t imuSequence;
+    uint16_t sweepSequence;
+
+    unsigned long imuRecorded;
+    unsigned long imuDropped;
+    unsigned long sweepsRecorded;
+    unsigned long sweepsDropped;
+
+    static const unsigned long kStatusPeriodUs = 1000000;
+    unsigned long statusTimeUs;
+
+};
@@ -0,0 +1,65 @@
+#include "SimulatedTable.h"
+
+SimulatedTableDecoder::SimulatedTableDecoder(const uint8_t* dataIn, int lengthIn, int rowsIn, int columnsIn) :
+
+  data(dataIn),
+  length(lengthIn),
+  rows(rowsIn),
+  columns(columnsIn < kMaxColumns ? columnsIn : kMaxColumns)
+
+  {
+
+  rewind();
+
+}
+
+void SimulatedTableDecoder::rewind() {
+
+  position = 0;
+  row = 0;
+  for (int i = 0; i < kMaxColumns; i++) {
+    previous[i] = 0;
+  }
+
+}
+
+void SimulatedTableDecoder::nextRow(int32_t* values) {
+
+  if (row >= rows || position >= length) {
+    rewind();
+  }
+
+  for (int i = 0; i < columns; i++) {
+
+    uint32_t zigzag = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+      byte = position < length ? data[position++] : 0;
+      zigzag |= (uint32_t)(byte & 0x7F) << shift;
+      shift += 7;
+    } while ((byte & 0x80) && shift < 35);
+
+    int32_t delta = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+    previous[i] += delta;
+    values[i] = previous[i];
+
+  }
+
+  row++;
+
+}
+
+int encodeSimulatedTableValue(int32_t delta, uint8_t* out) {
+
+  uint32_t zigzag = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+  int n = 0;
+  while (zigzag >= 0x80) {
+    out[n++] = (zigzag & 0x7F) | 0x80;
+    zigzag >>= 7;
+  }
+  out[n++] = zigzag;
+
+  return n;
+
+}
@@ -0,0 +1,76 @@
+/**
+ * @class SimulatedTableDecoder
+ * streaming decoder of a compressed simulation table, row by row.
+ *
+ * a table has rows of a fixed number of integer columns, e.g. IMU readings
+ * in units of 0.001 or clock ticks. each value is stored as the difference
+ * to the value in the same column of the previous row (0 before the first
+ * row), zigzag mapped to an unsigned number and written as a varint: 7 bits
+ * per byte, least significant first, the top bit set if another byte
+ * follows. recorded sensor data changes little from row to row, so most
+ * values take one or two bytes instead of four.
+ *
+ * the tables are generated by session_tools/compress_tables from
+ * simulatedImuData.h and simulatedLighthouseData.h. decoding needs no
+ * buffer besides the previous row, and the table is read in place from
+ * flash.
+ *
+ * does not depend on Arduino, so the host tools compile it too.
+ */
+
+#pragma once
+#include <stdint.h>
+
+class SimulatedTableDecoder {
+
+  public:
+
+    /** the largest number of columns of a table */
+    static const int kMaxColumns = 8;
+
+    /**
+     * @param [in] data - encoded table
+     * @param [in] length - length of data in bytes
+     * @param [in] rows - number of rows
+     * @param [in] columns - values per row, at most kMaxColumns
+     */
+    SimulatedTableDecoder(const uint8_t* data, int length, int rows, int columns);
+
+    /**
+     * decodes the next row. starts over with the first row after the last
+     * @param [out] values - columns values
+     */
+    void nextRow(int32_t* values);
+
+    /** continue with the first row */
+    void rewind();
+
+    /** index of the row returned by the next call to nextRow() */
+    int getRow() const { return row; };
+
+    int getRows() const { return rows; };
+    int getColumns() const { return columns; };
+
+  protected:
+
+    const uint8_t* data;
+    int length;
+    int rows;
+    int columns;
+
+    /** position of the next row in data */
+    int position;
+    int row;
+
+    /** values of the previous row */
+    int32_t previous[kMaxColumns];
+
+};
+
+/**
+ * encodes one value of a table, see SimulatedTableDecoder
+ * @param [in] delta - difference to the previous value in the column
+ * @param [out] out - at least 5 bytes
+ * @returns number of bytes written
+ */
+int encodeSimulatedTableValue(int32_t delta, uint8_t* out);
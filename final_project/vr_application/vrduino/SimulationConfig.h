@@ -0,0 +1,22 @@
+/**
+ * @file
+ * compile time switch for the simulated sensor tables.
+ *
+ * with VRDUINO_SIMULATED_TABLES set to 1 (the default), the recorded IMU
+ * and lighthouse tables (simulatedImuTable.h, simulatedLighthouseTable.h,
+ * about 46 KB of flash) are compiled in and replayed when the trackers
+ * simulate, so simulateImu/simulateLighthouse in vrduino.ino work as is.
+ * set it to 0 to leave the tables out of the firmware. simulating then
+ * only replays data handed to OrientationTracker::setSimulatedImu() or
+ * PoseTracker::setSimulatedLighthouse(), and setup() prints an error when
+ * a tracker simulates with nothing to replay (see
+ * OrientationTracker::simulationReady()).
+ * it is a header rather than a #define in the sketch, since the Arduino
+ * build does not pass those on to the other source files.
+ */
+
+#pragma once
+
+#ifndef VRDUINO_SIMULATED_TABLES
+#define VRDUINO_SIMULATED_TABLES 1
+#endif
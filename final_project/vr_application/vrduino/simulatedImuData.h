@@ -1,5 +1,11 @@
 #pragma once
 
+/**
+ * recorded imu data, rows of gyr x,y,z (deg/s), acc x,y,z (m/s^2).
+ * source of simulatedImuTable.h (session_tools/compress_tables), which is
+ * what the firmware compiles in. not included by the firmware itself
+ */
+
 const int nImuSamples = 2464 * 6;
 const float imuData[nImuSamples] = {
 0.317, 8.774, -4.087, 0.374, 9.012, 2.294,
@@ -0,0 +1,1719 @@
+#pragma once
+
+/**
+ * simulated imu data of simulatedImuData.h, compressed
+ * generated by session_tools/compress_tables, don't edit.
+ * decode with SimulatedTableDecoder (SimulatedTable.h)
+ */
+
+#include <stdint.h>
+
+/** values are in units of 1/imuTableScale, order is gyr x,y,z, acc x,y,z */
+const float imuTableScale = 1000.0f;
+
+const int imuTableRows = 2464;
+const int imuTableColumns = 6;
+const int imuTableLength = 27214;
+const uint8_t imuTableData[imuTableLength] = {
+0xfa, 0x04, 0x8c, 0x89, 0x01, 0xed, 0x3f, 0xec, 0x05, 0xe8, 0x8c, 0x01, 0xec, 0x23, 0xda, 0x1a,
+0x95, 0x11, 0xe5, 0x18, 0xa3, 0x01, 0xb0, 0x03, 0xb2, 0x02, 0x96, 0x11, 0xb5, 0x20, 0xbd, 0x0a,
+0x14, 0xf2, 0x03, 0x09, 0xe7, 0x03, 0x8f, 0x12, 0xa6, 0x0e, 0x39, 0x92, 0x03, 0x56, 0xf7, 0x15,
+0xcd, 0x1c, 0x90, 0x12, 0xc5, 0x02, 0x98, 0x01, 0xe1, 0x02, 0xe5, 0x18, 0xfb, 0x14, 0xe0, 0x19,
+0x97, 0x01, 0x41, 0xa1, 0x01, 0xf7, 0x15, 0xb9, 0x0b, 0xfe, 0x14, 0x00, 0x4c, 0x12, 0xbd, 0x0a,
+0xdf, 0x19, 0x8a, 0x13, 0x12, 0xd1, 0x01, 0x3a, 0xdc, 0x05, 0x8f, 0x12, 0xe8, 0x03, 0x96, 0x02,
+0x8b, 0x02, 0x30, 0x96, 0x11, 0xe5, 0x18, 0xc5, 0x09, 0xc0, 0x01, 0xc1, 0x03, 0x14, 0x9a, 0x10,
+0xef, 0x16, 0x8d, 0x12, 0x43, 0x13, 0xe5, 0x01, 0x8a, 0x13, 0xcb, 0x08, 0x9b, 0x10, 0x00, 0x8b,
+0x02, 0x1d, 0xb8, 0x0b, 0xe7, 0x03, 0xe5, 0x18, 0x41, 0xa3, 0x06, 0xa1, 0x04, 0x7a, 0xce, 0x1c,
+0x91, 0x26, 0xa9, 0x02, 0xac, 0x01, 0x89, 0x05, 0xae, 0x0d, 0xba, 0x34, 0xfd, 0x14, 0xf7, 0x01,
+0xf8, 0x01, 0x95, 0x02, 0xe8, 0x03, 0x82, 0x29, 0xc9, 0x08, 0x5f, 0x7e, 0x86, 0x01, 0xd6, 0x06,
+0xc2, 0x1e, 0xe3, 0x04, 0x4c, 0xf8, 0x01, 0xd8, 0x02, 0xe8, 0x03, 0x00, 0xdb, 0x05, 0x74, 0x82,
+0x02, 0x9c, 0x03, 0x00, 0xfd, 0x14, 0xd5, 0x06, 0x60, 0x8c, 0x02, 0x7c, 0x7a, 0xc1, 0x1e, 0xee,
+0x02, 0xb6, 0x01, 0x88, 0x01, 0xae, 0x01, 0xf6, 0x01, 0xb5, 0x20, 0xc4, 0x09, 0x27, 0x2e, 0x8c,
+0x02, 0xdd, 0x05, 0xab, 0x22, 0xf2, 0x16, 0x74, 0xaa, 0x02, 0x9e, 0x02, 0xe4, 0x04, 0xbb, 0x1f,
+0xd2, 0x07, 0x4c, 0xab, 0x01, 0xaa, 0x02, 0xbf, 0x0a, 0xb5, 0x20, 0xc4, 0x09, 0xb5, 0x01, 0xb6,
+0x01, 0x99, 0x01, 0xcf, 0x07, 0xf1, 0x16, 0xd6, 0x06, 0x7c, 0x4d, 0x86, 0x01, 0xe7, 0x03, 0xa7,
+0x0e, 0x00, 0x9d, 0x02, 0x86, 0x01, 0x8b, 0x02, 0xfd, 0x14, 0xd2, 0x07, 0x90, 0x12, 0xd4, 0x03,
+0xd4, 0x09, 0x86, 0x04, 0xd5, 0x44, 0xed, 0x02, 0x9e, 0x8b, 0x01, 0xf7, 0x04, 0xc0, 0x0c, 0xc7,
+0x04, 0x9d, 0x24, 0xb4, 0x35, 0x88, 0x51, 0x93, 0x0d, 0xd7, 0x08, 0x89, 0x0b, 0x8d, 0x27, 0xfa,
+0x67, 0xb1, 0x0c, 0x08, 0x94, 0x03, 0x72, 0xb4, 0x0c, 0xbe, 0x48, 0x79, 0xec, 0x02, 0xa1, 0x04,
+0x41, 0xe6, 0x18, 0xd0, 0x30, 0xe7, 0x03, 0xd4, 0x06, 0xbb, 0x05, 0xf6, 0x02, 0x94, 0x11, 0xd8,
+0x2f, 0x7a, 0xb6, 0x04, 0xd9, 0x07, 0xec, 0x02, 0xa2, 0x0f, 0xa2, 0x0f, 0xcb, 0x08, 0xbc, 0x02,
+0xfd, 0x05, 0xac, 0x01, 0x96, 0x11, 0xb8, 0x0b, 0xe5, 0x18, 0x00, 0xf7, 0x04, 0x60, 0xc4, 0x09,
+0xcc, 0x08, 0xcd, 0x1c, 0xf1, 0x03, 0xa5, 0x03, 0xa5, 0x03, 0xf3, 0x01, 0x79, 0xf1, 0x16, 0xcb,
+0x03, 0x30, 0xef, 0x01, 0xe1, 0x04, 0xe3, 0x04, 0xc1, 0x1e, 0x8b, 0x02, 0xa8, 0x02, 0xdb, 0x01,
+0xd7, 0x06, 0xb1, 0x0c, 0xb7, 0x0b, 0x9a, 0x01, 0x80, 0x03, 0x09, 0xc3, 0x09, 0x9b, 0x10, 0x79,
+0xb6, 0x01, 0xc6, 0x02, 0xa0, 0x02, 0xab, 0x0d, 0xcd, 0x1c, 0xd6, 0x06, 0x9e, 0x02, 0x92, 0x03,
+0xc8, 0x01, 0x79, 0x89, 0x13, 0x00, 0x9a, 0x01, 0xfe, 0x02, 0x90, 0x01, 0x7a, 0x9f, 0x0f, 0xed,
+0x02, 0x60, 0xfa, 0x01, 0xea, 0x03, 0xca, 0x08, 0xa1, 0x0f, 0xf4, 0x01, 0x30, 0x96, 0x02, 0x68,
+0xca, 0x08, 0xdb, 0x05, 0xd5, 0x06, 0x43, 0x68, 0x6a, 0xd2, 0x07, 0xe1, 0x04, 0x79, 0x26, 0x2f,
+0x42, 0xca, 0x08, 0x00, 0xd7, 0x06, 0x2f, 0x4b, 0x30, 0xca, 0x08, 0x79, 0xcf, 0x07, 0x07, 0x69,
+0x41, 0xe7, 0x03, 0xed, 0x02, 0xdb, 0x05, 0x56, 0x85, 0x01, 0x1d, 0xc9, 0x08, 0x79, 0x7a, 0x4c,
+0x97, 0x01, 0x4b, 0xc5, 0x09, 0xe7, 0x03, 0x7a, 0x11, 0xcb, 0x03, 0xef, 0x01, 0xc9, 0x08, 0xee,
+0x02, 0xe7, 0x03, 0x1d, 0x73, 0x07, 0xdb, 0x05, 0xe3, 0x04, 0xd5, 0x06, 0x7b, 0x97, 0x01, 0x95,
+0x02, 0xe7, 0x03, 0x7c, 0xd1, 0x07, 0x55, 0x3a, 0x99, 0x01, 0xe7, 0x03, 0xe8, 0x03, 0xc9, 0x08,
+0x26, 0x69, 0x7b, 0xe3, 0x04, 0x7a, 0x7a, 0x14, 0x1b, 0x1b, 0xc3, 0x09, 0xc4, 0x09, 0x7a, 0x8e,
+0x01, 0xb5, 0x01, 0x2f, 0xc9, 0x08, 0xe8, 0x03, 0xee, 0x02, 0xc7, 0x01, 0x13, 0x8f, 0x01, 0x83,
+0x14, 0xf4, 0x01, 0xf4, 0x01, 0x2f, 0x60, 0x8c, 0x02, 0xa1, 0x0f, 0xf3, 0x01, 0xd8, 0x06, 0x1c,
+0x00, 0x7c, 0xeb, 0x17, 0xb1, 0x0c, 0xbe, 0x0a, 0x14, 0xa0, 0x02, 0x3a, 0xe5, 0x18, 0xf1, 0x16,
+0xd6, 0x06, 0x12, 0xd8, 0x02, 0x96, 0x02, 0x9f, 0x0f, 0x95, 0x11, 0xb4, 0x0c, 0x2f, 0xac, 0x01,
+0x1d, 0x95, 0x11, 0xc1, 0x1e, 0xb2, 0x0c, 0xc0, 0x01, 0xd2, 0x01, 0x1e, 0xdb, 0x05, 0xd3, 0x1b,
+0xe2, 0x04, 0x97, 0x01, 0x1e, 0xe6, 0x01, 0xd5, 0x06, 0x8d, 0x27, 0xf4, 0x01, 0x38, 0x09, 0x7d,
+0xd7, 0x06, 0xf9, 0x29, 0xcc, 0x08, 0xa0, 0x02, 0x6a, 0xbc, 0x02, 0xcf, 0x07, 0xb1, 0x21, 0xd7,
+0x06, 0xb6, 0x01, 0xf8, 0x04, 0x0a, 0x8f, 0x12, 0xe3, 0x18, 0xb4, 0x0c, 0xcb, 0x03, 0xbf, 0x09,
+0xdb, 0x01, 0xf3, 0x01, 0xfb, 0x29, 0xac, 0x0d, 0x11, 0x00, 0xbb, 0x02, 0xa5, 0x0e, 0xb3, 0x0c,
+0xc6, 0x09, 0x12, 0x99, 0x01, 0xe6, 0x01, 0xa7, 0x0e, 0xf3, 0x01, 0xe2, 0x04, 0xf0, 0x01, 0xfa,
+0x01, 0x55, 0xb7, 0x0b, 0x79, 0xe7, 0x03, 0xef, 0x01, 0x39, 0xb5, 0x01, 0xb3, 0x0c, 0xc0, 0x0a,
+0xc9, 0x08, 0xac, 0x01, 0xfe, 0x02, 0x72, 0x9f, 0x0f, 0xd0, 0x07, 0x89, 0x13, 0xc7, 0x04, 0xdd,
+0x03, 0x11, 0xe3, 0x04, 0xca, 0x08, 0xe2, 0x04, 0x6a, 0xf5, 0x02, 0xcf, 0x02, 0xb1, 0x0c, 0xa5,
+0x0e, 0xc9, 0x08, 0x56, 0x69, 0x39, 0x7a, 0xa0, 0x0f, 0xbe, 0x0a, 0x4b, 0x4b, 0xb5, 0x01, 0xf3,
+0x01, 0xba, 0x0b, 0xe1, 0x04, 0x8b, 0x02, 0x5f, 0x90, 0x01, 0x9b, 0x10, 0x9a, 0x10, 0xd5, 0x06,
+0x26, 0x26, 0x0a, 0xcd, 0x1c, 0xa8, 0x0e, 0xe3, 0x04, 0x7c, 0x7b, 0x8c, 0x02, 0xf9, 0x29, 0xe0,
+0x19, 0x00, 0x71, 0x90, 0x01, 0x30, 0xdd, 0x2e, 0xd4, 0x1b, 0xe7, 0x03, 0xe4, 0x01, 0xf6, 0x02,
+0x0a, 0xc5, 0x32, 0x9e, 0x24, 0xb4, 0x0c, 0x7b, 0x39, 0x8b, 0x02, 0xb9, 0x34, 0x8e, 0x27, 0xac,
+0x0d, 0x8f, 0x01, 0xbf, 0x01, 0xbc, 0x02, 0xdd, 0x2e, 0xf2, 0x16, 0xba, 0x0b, 0xec, 0x02, 0x30,
+0xa2, 0x01, 0xa1, 0x38, 0xe0, 0x19, 0xda, 0x1a, 0x4e, 0xc7, 0x01, 0x0a, 0xcb, 0x31, 0xb8, 0x0b,
+0xb8, 0x0b, 0x99, 0x01, 0xef, 0x04, 0x69, 0xa7, 0x37, 0x79, 0xc0, 0x0a, 0x8b, 0x02, 0x3a, 0x44,
+0xb9, 0x34, 0xcc, 0x08, 0xe3, 0x04, 0x9a, 0x01, 0x7c, 0xe6, 0x01, 0xa7, 0x37, 0xb2, 0x0c, 0x91,
+0x26, 0xa3, 0x01, 0xed, 0x01, 0x7b, 0x81, 0x29, 0xb4, 0x0c, 0x8f, 0x12, 0x6a, 0x4c, 0xf8, 0x04,
+0xad, 0x36, 0xe8, 0x03, 0xb7, 0x0b, 0x82, 0x02, 0xa5, 0x03, 0xff, 0x02, 0xf5, 0x2a, 0xee, 0x02,
+0xcf, 0x07, 0x74, 0x8a, 0x03, 0x86, 0x01, 0x9b, 0x39, 0xe8, 0x03, 0xa1, 0x0f, 0x86, 0x01, 0xac,
+0x01, 0xa2, 0x01, 0xa1, 0x38, 0xf3, 0x01, 0xe7, 0x03, 0x30, 0x13, 0xec, 0x02, 0xcb, 0x31, 0x7a,
+0xe1, 0x04, 0xf8, 0x01, 0xdc, 0x01, 0xec, 0x02, 0xe9, 0x55, 0xed, 0x02, 0xa6, 0x0e, 0xfb, 0x03,
+0xc3, 0x02, 0x30, 0xed, 0x40, 0xf3, 0x01, 0xee, 0x02, 0x67, 0xa3, 0x01, 0x86, 0x01, 0xed, 0x69,
+0xee, 0x02, 0xe7, 0x03, 0xbe, 0x01, 0xb6, 0x01, 0xca, 0x01, 0xa9, 0x60, 0xd6, 0x06, 0xdb, 0x05,
+0x30, 0xe0, 0x03, 0x8b, 0x02, 0xb9, 0x34, 0xe8, 0x03, 0xed, 0x02, 0xdb, 0x01, 0xb6, 0x01, 0xa3,
+0x01, 0xb9, 0x34, 0x9c, 0x10, 0xe6, 0x18, 0xdc, 0x01, 0xff, 0x02, 0x93, 0x02, 0xbf, 0x33, 0x00,
+0x92, 0x26, 0xd4, 0x01, 0x9c, 0x03, 0x38, 0xe5, 0x18, 0xed, 0x02, 0xf8, 0x15, 0x1c, 0x25, 0xd7,
+0x02, 0xaf, 0x21, 0xb3, 0x0c, 0x8a, 0x13, 0x5f, 0xc8, 0x01, 0x56, 0xb3, 0x0c, 0xd8, 0x06, 0xbe,
+0x0a, 0xad, 0x03, 0xf5, 0x07, 0xe1, 0x02, 0xe1, 0x04, 0xd6, 0x06, 0xe2, 0x04, 0x30, 0x5f, 0x55,
+0x96, 0x11, 0xca, 0x08, 0xed, 0x02, 0x5f, 0x99, 0x01, 0x9f, 0x02, 0x90, 0x12, 0xc6, 0x09, 0xed,
+0x02, 0xc8, 0x01, 0xcd, 0x02, 0x7b, 0xd0, 0x07, 0xf4, 0x01, 0xdb, 0x05, 0x1e, 0x73, 0xa2, 0x01,
+0x7a, 0xdc, 0x05, 0x95, 0x11, 0xcb, 0x03, 0xd3, 0x03, 0xcc, 0x03, 0x7a, 0x7a, 0xc3, 0x09, 0x86,
+0x01, 0xf1, 0x03, 0x7c, 0xb3, 0x0c, 0x89, 0x13, 0xbf, 0x0a, 0xb2, 0x02, 0x8f, 0x01, 0x96, 0x02,
+0xcd, 0x1c, 0xb7, 0x0b, 0xdb, 0x05, 0xdc, 0x01, 0x55, 0xd4, 0x01, 0xe5, 0x18, 0xc5, 0x09, 0xe2,
+0x04, 0x30, 0x72, 0xbc, 0x02, 0xd1, 0x30, 0xfb, 0x14, 0xa2, 0x0f, 0xa1, 0x01, 0xab, 0x01, 0xb4,
+0x04, 0xdf, 0x42, 0xbd, 0x1f, 0xd6, 0x06, 0x8f, 0x01, 0x60, 0xc6, 0x02, 0xb3, 0x35, 0xb5, 0x20,
+0x79, 0x09, 0x4d, 0xd2, 0x01, 0x85, 0x3d, 0xfb, 0x29, 0xb7, 0x0b, 0xa1, 0x01, 0x9d, 0x02, 0x74,
+0x89, 0x3c, 0xa9, 0x22, 0xa7, 0x0e, 0xee, 0x01, 0xe7, 0x03, 0xce, 0x02, 0x9d, 0x24, 0x9d, 0x24,
+0xd5, 0x06, 0xca, 0x01, 0x72, 0x7e, 0xf5, 0x2a, 0x81, 0x29, 0x00, 0x26, 0x72, 0xfe, 0x02, 0xf7,
+0x3e, 0x91, 0x26, 0xee, 0x02, 0xd4, 0x01, 0xd2, 0x04, 0x90, 0x04, 0xc5, 0x32, 0x99, 0x25, 0x8a,
+0x13, 0xf5, 0x02, 0x11, 0xdd, 0x01, 0xab, 0x22, 0x89, 0x13, 0x8a, 0x13, 0x38, 0x68, 0x30, 0xd3,
+0x1b, 0xd3, 0x1b, 0xca, 0x08, 0x3a, 0x4e, 0xa0, 0x02, 0xf7, 0x15, 0xdb, 0x05, 0xe1, 0x04, 0x55,
+0x00, 0x25, 0x99, 0x10, 0xe8, 0x03, 0xad, 0x0d, 0x14, 0x0a, 0x98, 0x01, 0x83, 0x14, 0xd8, 0x06,
+0xc7, 0x1d, 0xa9, 0x02, 0xa5, 0x06, 0x71, 0x95, 0x11, 0xa0, 0x0f, 0x83, 0x14, 0xb6, 0x01, 0x8f,
+0x06, 0x9c, 0x03, 0xe7, 0x2c, 0x94, 0x26, 0xc3, 0x09, 0xac, 0x04, 0xad, 0x01, 0x55, 0xe5, 0x18,
+0xb0, 0x21, 0xf4, 0x01, 0xb5, 0x01, 0x2d, 0x4c, 0xc5, 0x32, 0x8a, 0x3c, 0xbe, 0x0a, 0x30, 0xa9,
+0x02, 0xc4, 0x05, 0xef, 0x2b, 0xf6, 0x2a, 0xae, 0x0d, 0xc6, 0x02, 0x0a, 0x44, 0xc9, 0x46, 0xd6,
+0x44, 0x8a, 0x13, 0xbb, 0x02, 0xf5, 0x02, 0xca, 0x01, 0xb7, 0x49, 0x94, 0x4f, 0xb8, 0x0b, 0xbf,
+0x04, 0xb1, 0x02, 0x13, 0xf1, 0x3f, 0xf0, 0x54, 0xd5, 0x06, 0x93, 0x02, 0xd5, 0x03, 0x8f, 0x01,
+0x87, 0x28, 0xe6, 0x41, 0xd5, 0x06, 0x09, 0x93, 0x05, 0x69, 0xa7, 0x37, 0xbc, 0x5d, 0x7a, 0xce,
+0x02, 0x83, 0x07, 0xca, 0x01, 0xcf, 0x45, 0xb6, 0x5e, 0xf3, 0x01, 0xc6, 0x02, 0x38, 0xca, 0x01,
+0x9b, 0x39, 0xec, 0x40, 0x79, 0xab, 0x01, 0x86, 0x01, 0xfe, 0x02, 0xe5, 0x41, 0xa0, 0x4d, 0xf7,
+0x15, 0xa1, 0x04, 0x9a, 0x01, 0xfe, 0x05, 0x9d, 0x39, 0xcc, 0x31, 0xc1, 0x1e, 0xae, 0x03, 0x60,
+0xe8, 0x03, 0xd9, 0x1a, 0xf3, 0x01, 0xf1, 0x16, 0x1e, 0x82, 0x02, 0x11, 0xb5, 0x20, 0xf1, 0x16,
+0xbd, 0x1f, 0x6a, 0xec, 0x02, 0xf8, 0x01, 0xdf, 0x19, 0x9d, 0x24, 0x97, 0x25, 0xad, 0x01, 0x7c,
+0x9c, 0x03, 0xa5, 0x0e, 0xa9, 0x22, 0xcd, 0x1c, 0x81, 0x02, 0xc7, 0x04, 0xf0, 0x01, 0xcf, 0x1c,
+0x9d, 0x39, 0xf5, 0x2a, 0xb0, 0x03, 0x85, 0x01, 0xd8, 0x02, 0xd3, 0x1b, 0xbd, 0x48, 0x91, 0x26,
+0xd2, 0x01, 0xa4, 0x01, 0x8c, 0x02, 0xe7, 0x03, 0xa3, 0x4c, 0x99, 0x25, 0x9a, 0x01, 0xe6, 0x01,
+0xda, 0x02, 0xed, 0x02, 0x9d, 0x39, 0xcd, 0x1c, 0x93, 0x03, 0xc5, 0x05, 0x26, 0x83, 0x14, 0x8f,
+0x3b, 0xf9, 0x29, 0xe6, 0x01, 0xc6, 0x02, 0x80, 0x08, 0x9f, 0x0f, 0x9f, 0x4d, 0xf5, 0x01, 0x30,
+0x85, 0x01, 0xdd, 0x03, 0xe2, 0x04, 0xab, 0x4b, 0xd0, 0x1c, 0xb1, 0x02, 0xdb, 0x01, 0xe6, 0x01,
+0xe2, 0x04, 0x8f, 0x3b, 0xd0, 0x07, 0xf5, 0x02, 0x55, 0xd8, 0x02, 0xab, 0x0d, 0xa7, 0x37, 0xc9,
+0x08, 0xab, 0x01, 0x13, 0x80, 0x03, 0xb9, 0x0b, 0xb7, 0x20, 0xfd, 0x14, 0xca, 0x01, 0x9b, 0x03,
+0x25, 0xf3, 0x01, 0xdb, 0x05, 0xd7, 0x06, 0x60, 0xc1, 0x03, 0x4d, 0xd6, 0x06, 0xd6, 0x06, 0xe4,
+0x04, 0x1c, 0xf7, 0x04, 0x00, 0xe4, 0x04, 0xc4, 0x1e, 0xbe, 0x0a, 0x39, 0xfb, 0x03, 0x07, 0xf5,
+0x01, 0xc2, 0x1e, 0xca, 0x08, 0x25, 0xed, 0x01, 0x7c, 0xe3, 0x18, 0xd2, 0x30, 0xee, 0x02, 0xa1,
+0x01, 0xd9, 0x02, 0x1d, 0xd7, 0x2f, 0xae, 0x36, 0x99, 0x10, 0x12, 0xdb, 0x01, 0x9a, 0x01, 0x8b,
+0x3c, 0xbc, 0x1f, 0xf7, 0x15, 0x00, 0xe5, 0x01, 0x60, 0xcb, 0x5a, 0x92, 0x26, 0xb5, 0x20, 0x00,
+0xc7, 0x04, 0xe1, 0x02, 0xc7, 0x5b, 0xec, 0x17, 0xeb, 0x17, 0xb6, 0x01, 0x95, 0x07, 0x26, 0xd9,
+0x43, 0xe4, 0x04, 0xad, 0x0d, 0x1b, 0xeb, 0x02, 0x55, 0xa5, 0x4c, 0xcb, 0x08, 0x9f, 0x0f, 0xa1,
+0x04, 0xd9, 0x02, 0x9e, 0x02, 0xb9, 0x34, 0x83, 0x14, 0xe1, 0x04, 0x4b, 0x0a, 0xdc, 0x04, 0x81,
+0x29, 0xaf, 0x21, 0xac, 0x0d, 0x8c, 0x02, 0x8f, 0x01, 0x30, 0xf4, 0x01, 0xfd, 0x14, 0xd2, 0x30,
+0xb4, 0x04, 0x81, 0x02, 0xb6, 0x01, 0xbc, 0x1f, 0xe1, 0x04, 0xfe, 0x3d, 0xac, 0x01, 0xc9, 0x01,
+0xd0, 0x02, 0xbe, 0x1f, 0x90, 0x12, 0x8e, 0x27, 0x7e, 0xab, 0x01, 0x9c, 0x03, 0xf4, 0x2a, 0xcc,
+0x31, 0xd4, 0x1b, 0x7d, 0x6a, 0xb0, 0x05, 0xae, 0x36, 0xd2, 0x59, 0xf4, 0x01, 0xd7, 0x02, 0x72,
+0xc2, 0x03, 0x9a, 0x25, 0x82, 0x52, 0x95, 0x11, 0x39, 0x11, 0xe0, 0x03, 0xee, 0x2b, 0xdc, 0x81,
+0x01, 0xa3, 0x23, 0x60, 0x82, 0x02, 0xf2, 0x03, 0xc4, 0x1e, 0xaa, 0x89, 0x01, 0xa3, 0x23, 0x99,
+0x01, 0x86, 0x01, 0x98, 0x04, 0xa0, 0x0f, 0xdc, 0x6c, 0xd3, 0x1b, 0x85, 0x01, 0x56, 0x98, 0x04,
+0x96, 0x11, 0xf6, 0x91, 0x01, 0x99, 0x25, 0x37, 0x09, 0xda, 0x02, 0xbc, 0x1f, 0xec, 0x7e, 0xbb,
+0x1f, 0x12, 0xa1, 0x01, 0x2e, 0xaa, 0x22, 0xc0, 0x5c, 0x89, 0x13, 0x30, 0x42, 0x11, 0xca, 0x1d,
+0xea, 0x2c, 0xbd, 0x0a, 0x00, 0x67, 0xf0, 0x01, 0x9e, 0x24, 0xb6, 0x20, 0xc5, 0x09, 0x26, 0xef,
+0x01, 0x1c, 0xee, 0x02, 0xd6, 0x06, 0x99, 0x10, 0x86, 0x01, 0x56, 0x09, 0xd6, 0x06, 0xc7, 0x1d,
+0xb9, 0x0b, 0x74, 0xc7, 0x04, 0xb2, 0x02, 0xb4, 0x0c, 0x95, 0x3a, 0xc3, 0x09, 0xa3, 0x01, 0xc5,
+0x02, 0xf3, 0x02, 0xb2, 0x0c, 0x8f, 0x79, 0x93, 0x26, 0xcf, 0x04, 0xef, 0x06, 0x2f, 0xf3, 0x01,
+0xd5, 0x96, 0x01, 0xed, 0x2b, 0x8f, 0x04, 0x9b, 0x06, 0xd7, 0x05, 0xd3, 0x1b, 0xef, 0x69, 0xe1,
+0x04, 0xd2, 0x04, 0xeb, 0x02, 0xf4, 0x05, 0x83, 0x14, 0xd5, 0xd4, 0x01, 0x86, 0x28, 0x86, 0x01,
+0xbf, 0x01, 0xf3, 0x05, 0xc9, 0x08, 0xe1, 0xd2, 0x01, 0xa2, 0x38, 0xcd, 0x02, 0xd3, 0x03, 0xd9,
+0x02, 0xdb, 0x05, 0xb5, 0x87, 0x01, 0xe6, 0x18, 0x56, 0x85, 0x01, 0x37, 0xfe, 0x14, 0xed, 0xa7,
+0x01, 0xba, 0x0b, 0x69, 0x5f, 0xad, 0x01, 0x92, 0x26, 0xbf, 0x9a, 0x01, 0x8e, 0x12, 0x71, 0xdb,
+0x04, 0x88, 0x01, 0xac, 0x22, 0xf7, 0x7c, 0xfe, 0x14, 0xbd, 0x02, 0xc3, 0x05, 0x4c, 0xe0, 0x19,
+0x99, 0x4e, 0x8a, 0x13, 0xa1, 0x01, 0xe7, 0x03, 0x1d, 0xe0, 0x19, 0xad, 0x5f, 0xc4, 0x09, 0xcb,
+0x03, 0xfb, 0x03, 0xd1, 0x01, 0x8e, 0x12, 0xd5, 0x44, 0xe1, 0x04, 0xc1, 0x03, 0xb1, 0x02, 0x9b,
+0x03, 0xed, 0x02, 0xcd, 0x1c, 0xd0, 0x07, 0xab, 0x09, 0x1d, 0xd7, 0x05, 0xd5, 0x06, 0xeb, 0x17,
+0x9a, 0x25, 0x8a, 0x05, 0xed, 0x01, 0xbb, 0x02, 0xa6, 0x0e, 0x99, 0x25, 0xb2, 0x0c, 0xd0, 0x0d,
+0xa1, 0x07, 0x86, 0x04, 0xd5, 0x06, 0xcd, 0x1c, 0xb4, 0x0c, 0xe6, 0x06, 0x97, 0x07, 0xe2, 0x02,
+0xcf, 0x07, 0xf3, 0x01, 0xd6, 0x06, 0x8c, 0x05, 0xe1, 0x02, 0xbc, 0x05, 0xf4, 0x01, 0x96, 0x11,
+0xd0, 0x07, 0xad, 0x03, 0x25, 0x08, 0xc4, 0x09, 0x88, 0x28, 0xba, 0x0b, 0x8b, 0x05, 0x88, 0x03,
+0xac, 0x04, 0xd2, 0x30, 0xfa, 0x29, 0xf4, 0x01, 0xff, 0x02, 0xc2, 0x03, 0xfa, 0x01, 0xd6, 0x44,
+0xea, 0x2c, 0xb8, 0x0b, 0xb5, 0x01, 0xac, 0x04, 0x56, 0xe0, 0x42, 0xda, 0x1a, 0x9c, 0x10, 0x93,
+0x02, 0x4b, 0x9f, 0x02, 0x98, 0x63, 0xea, 0x2c, 0xa8, 0x0e, 0x85, 0x01, 0xb2, 0x05, 0xb8, 0x03,
+0xde, 0x6c, 0xc6, 0x32, 0xf6, 0x15, 0xca, 0x03, 0x4d, 0x9c, 0x06, 0x9c, 0x62, 0x96, 0x3a, 0x90,
+0x12, 0xac, 0x04, 0xed, 0x01, 0x98, 0x04, 0xd6, 0x44, 0xea, 0x2c, 0xf4, 0x01, 0xab, 0x04, 0xcb,
+0x03, 0xf2, 0x03, 0xa6, 0x4c, 0xac, 0x4b, 0xab, 0x0d, 0xaa, 0x02, 0x8f, 0x04, 0xdc, 0x01, 0xb2,
+0x4a, 0xf2, 0x3f, 0xa5, 0x23, 0x90, 0x01, 0xdb, 0x01, 0xbc, 0x02, 0xde, 0x57, 0xca, 0x46, 0x8b,
+0x27, 0xdf, 0x03, 0x4e, 0x95, 0x02, 0x94, 0x4f, 0x90, 0x3b, 0xa7, 0x0e, 0xac, 0x04, 0x08, 0x30,
+0xbc, 0x5d, 0xe2, 0x42, 0xb7, 0x0b, 0xe6, 0x01, 0xeb, 0x02, 0xec, 0x02, 0x94, 0x4f, 0x8a, 0x3c,
+0xf4, 0x01, 0xa6, 0x03, 0x90, 0x01, 0x85, 0x01, 0xe4, 0x2d, 0x82, 0x29, 0xed, 0x02, 0x30, 0x5f,
+0xfa, 0x01, 0xb4, 0x35, 0xce, 0x45, 0xf4, 0x01, 0x9f, 0x02, 0x71, 0x9f, 0x02, 0xcc, 0x31, 0xc6,
+0x32, 0xc4, 0x09, 0xe5, 0x01, 0xc5, 0x02, 0xc1, 0x03, 0xd2, 0x30, 0xae, 0x36, 0xfe, 0x14, 0x8b,
+0x02, 0x26, 0xb5, 0x01, 0xb4, 0x35, 0xb4, 0x0c, 0xf2, 0x16, 0x09, 0x1b, 0x98, 0x01, 0xce, 0x45,
+0xac, 0x0d, 0x84, 0x14, 0x39, 0xb2, 0x02, 0x5d, 0xb2, 0x4a, 0x7a, 0xa0, 0x0f, 0xf7, 0x01, 0xac,
+0x04, 0xdf, 0x03, 0xc4, 0x47, 0x99, 0x10, 0xba, 0x0b, 0x7b, 0xac, 0x01, 0x11, 0xa8, 0x37, 0x83,
+0x14, 0xbe, 0x0a, 0x08, 0xef, 0x01, 0x2f, 0x9a, 0x4e, 0xd3, 0x1b, 0xba, 0x0b, 0x14, 0xeb, 0x02,
+0x1d, 0x92, 0x64, 0xb3, 0x0c, 0x7a, 0x69, 0xd1, 0x01, 0x87, 0x03, 0xce, 0x83, 0x01, 0x9f, 0x0f,
+0xdc, 0x05, 0x84, 0x02, 0xc7, 0x04, 0x42, 0x80, 0x67, 0x00, 0xf3, 0x01, 0xc1, 0x03, 0xe5, 0x01,
+0xd1, 0x01, 0xd4, 0x82, 0x01, 0xa0, 0x0f, 0xa7, 0x0e, 0xef, 0x01, 0x4c, 0xd1, 0x04, 0xfe, 0x7b,
+0x9a, 0x25, 0xd9, 0x1a, 0xa0, 0x07, 0xed, 0x01, 0x8c, 0x05, 0xbc, 0x86, 0x01, 0xe1, 0x04, 0x8f,
+0x12, 0x6a, 0xfd, 0x08, 0xe8, 0x03, 0x80, 0x67, 0xdc, 0x05, 0xa5, 0x0e, 0xa8, 0x02, 0xe2, 0x02,
+0x60, 0x84, 0x7b, 0x79, 0x00, 0xaa, 0x02, 0xa1, 0x01, 0x42, 0xa4, 0x61, 0xee, 0x02, 0xa6, 0x0e,
+0xcb, 0x03, 0x98, 0x01, 0xd1, 0x01, 0xe6, 0x41, 0x90, 0x12, 0xae, 0x0d, 0x7b, 0xf6, 0x02, 0x09,
+0xee, 0x40, 0xf3, 0x01, 0x98, 0x25, 0x26, 0x85, 0x01, 0xb4, 0x02, 0xa2, 0x38, 0xd7, 0x06, 0x9a,
+0x25, 0x7c, 0x26, 0xd4, 0x03, 0x96, 0x3a, 0x81, 0x14, 0x98, 0x25, 0x7c, 0x69, 0xbc, 0x02, 0x82,
+0x29, 0x95, 0x11, 0xbc, 0x1f, 0x00, 0xa1, 0x01, 0xf2, 0x03, 0xa8, 0x37, 0xfb, 0x29, 0x82, 0x29,
+0x7e, 0xf5, 0x02, 0xb6, 0x01, 0xba, 0x34, 0x8b, 0x27, 0xb0, 0x21, 0x43, 0xd1, 0x01, 0xe9, 0x05,
+0xd8, 0x2f, 0xfd, 0x14, 0xce, 0x1c, 0xfa, 0x01, 0xa7, 0x02, 0x7d, 0xb8, 0x49, 0x8f, 0x12, 0xda,
+0x1a, 0x83, 0x02, 0xaf, 0x03, 0x07, 0xcc, 0x31, 0xe7, 0x03, 0xf0, 0x02, 0xdb, 0x01, 0x3a, 0xb5,
+0x01, 0xb2, 0x4a, 0xf4, 0x01, 0xb9, 0x0b, 0xfd, 0x02, 0xf0, 0x01, 0x8b, 0x02, 0xd4, 0x44, 0xdc,
+0x05, 0x83, 0x14, 0x82, 0x02, 0x82, 0x02, 0x99, 0x01, 0x9e, 0x39, 0xf3, 0x01, 0x81, 0x14, 0x43,
+0x99, 0x01, 0x8f, 0x01, 0xac, 0x4b, 0xba, 0x0b, 0xab, 0x22, 0x37, 0xf6, 0x02, 0xa1, 0x04, 0xd8,
+0x58, 0xbe, 0x0a, 0xc1, 0x1e, 0x55, 0x7c, 0xbb, 0x02, 0xa6, 0x4c, 0xf4, 0x01, 0xf7, 0x15, 0xbe,
+0x01, 0xd4, 0x01, 0x1b, 0xde, 0x57, 0xe2, 0x04, 0x93, 0x11, 0xc0, 0x01, 0x27, 0xbf, 0x01, 0xb0,
+0x5f, 0xe1, 0x04, 0xf3, 0x01, 0x85, 0x01, 0x2f, 0x81, 0x02, 0xd6, 0x44, 0xeb, 0x17, 0xb8, 0x0b,
+0xd1, 0x01, 0x67, 0x26, 0x8e, 0x50, 0xbf, 0x33, 0xf8, 0x15, 0x00, 0xe5, 0x01, 0xc8, 0x01, 0xc6,
+0x32, 0xbf, 0x33, 0xec, 0x17, 0x85, 0x01, 0xa2, 0x01, 0x37, 0xba, 0x34, 0x8f, 0x3b, 0xa4, 0x23,
+0x00, 0x7c, 0x09, 0xea, 0x2c, 0x9b, 0x39, 0xba, 0x0b, 0xa5, 0x03, 0x8a, 0x03, 0xf8, 0x01, 0xb6,
+0x20, 0xbb, 0x1f, 0xd1, 0x07, 0x74, 0xc9, 0x01, 0xe4, 0x02, 0xe0, 0x19, 0x9f, 0x24, 0xab, 0x0d,
+0xb8, 0x03, 0x6a, 0xbe, 0x01, 0x98, 0x25, 0x9d, 0x24, 0xad, 0x0d, 0x00, 0x4c, 0x81, 0x02, 0xb8,
+0x20, 0xc1, 0x1e, 0xc9, 0x08, 0xc9, 0x01, 0x4e, 0x1b, 0xe8, 0x2c, 0xcf, 0x1c, 0xad, 0x0d, 0x30,
+0xb2, 0x02, 0x68, 0x8e, 0x27, 0x81, 0x14, 0xb7, 0x0b, 0x90, 0x01, 0x60, 0xb6, 0x01, 0xce, 0x45,
+0xb1, 0x21, 0xb9, 0x0b, 0xec, 0x02, 0x26, 0xa1, 0x04, 0x8a, 0x51, 0xc7, 0x1d, 0xc3, 0x09, 0x69,
+0x9e, 0x02, 0xcd, 0x02, 0xfe, 0x3d, 0xe1, 0x04, 0xb7, 0x0b, 0x56, 0xba, 0x03, 0x56, 0xea, 0x55,
+0x00, 0xee, 0x02, 0x96, 0x02, 0xf8, 0x04, 0x82, 0x02, 0xea, 0x6a, 0xf4, 0x01, 0xf4, 0x01, 0x5f,
+0xc8, 0x04, 0x55, 0xf6, 0x7c, 0xca, 0x08, 0xe7, 0x03, 0xc3, 0x02, 0xd8, 0x02, 0x1b, 0xbc, 0x5d,
+0xa8, 0x0e, 0xcb, 0x08, 0x5e, 0x41, 0xfe, 0x02, 0xee, 0x69, 0xc8, 0x1d, 0xe7, 0x03, 0xd4, 0x01,
+0x1d, 0x1e, 0x80, 0x67, 0xfc, 0x29, 0xd6, 0x06, 0x13, 0xaa, 0x02, 0xab, 0x01, 0x8e, 0x50, 0xb6,
+0x20, 0xf6, 0x01, 0xf5, 0x02, 0xc9, 0x01, 0x1d, 0xd2, 0x6e, 0xfe, 0x3d, 0xc4, 0x09, 0xd4, 0x01,
+0xa1, 0x01, 0xe8, 0x03, 0xe8, 0x6a, 0x84, 0x52, 0xd0, 0x07, 0x30, 0xf8, 0x01, 0xf3, 0x02, 0x8e,
+0x50, 0xec, 0x40, 0xd6, 0x06, 0x4d, 0x30, 0x8c, 0x02, 0xf4, 0x68, 0xe6, 0x56, 0xf0, 0x02, 0xe3,
+0x01, 0x4b, 0x9e, 0x02, 0xd2, 0x59, 0xbc, 0x48, 0xdc, 0x05, 0x57, 0xbc, 0x02, 0x44, 0xc6, 0x32,
+0xca, 0x1d, 0xca, 0x08, 0x14, 0x9a, 0x01, 0xab, 0x01, 0xba, 0x34, 0x88, 0x13, 0xe0, 0x19, 0x7c,
+0x96, 0x02, 0x96, 0x02, 0xb2, 0x21, 0xcf, 0x07, 0xd4, 0x1b, 0x26, 0xae, 0x03, 0x12, 0x8e, 0x12,
+0xb3, 0x0c, 0xec, 0x17, 0x41, 0xca, 0x01, 0xdc, 0x01, 0x96, 0x11, 0xf5, 0x15, 0xf8, 0x15, 0x55,
+0x27, 0x37, 0xdc, 0x05, 0xc3, 0x1e, 0xb2, 0x0c, 0x26, 0x97, 0x01, 0x73, 0xe8, 0x03, 0x99, 0x10,
+0x00, 0x9a, 0x01, 0x13, 0x91, 0x03, 0xe0, 0x19, 0x8d, 0x27, 0xd2, 0x07, 0xbc, 0x02, 0x14, 0xd1,
+0x01, 0xd4, 0x1b, 0x8b, 0x27, 0xa6, 0x0e, 0xbf, 0x01, 0x4d, 0xdb, 0x04, 0x8a, 0x13, 0xb9, 0x0b,
+0xd2, 0x07, 0x82, 0x02, 0xf0, 0x01, 0x39, 0xfc, 0x29, 0xb7, 0x0b, 0xd6, 0x06, 0x96, 0x02, 0x7c,
+0x85, 0x01, 0xa2, 0x38, 0x7a, 0xe8, 0x03, 0x0a, 0x9a, 0x01, 0x44, 0xfe, 0x3d, 0xd4, 0x1b, 0x79,
+0xd3, 0x01, 0xfa, 0x01, 0xf4, 0x02, 0xdc, 0x43, 0xd4, 0x1b, 0xd5, 0x06, 0x3a, 0xbe, 0x01, 0xae,
+0x01, 0xb6, 0x5e, 0x90, 0x3b, 0xeb, 0x17, 0x44, 0xf6, 0x02, 0x08, 0xce, 0x45, 0x8c, 0x3c, 0xd3,
+0x1b, 0x4d, 0xa2, 0x04, 0xec, 0x02, 0xb6, 0x5e, 0xf0, 0x54, 0x8d, 0x27, 0x93, 0x02, 0x92, 0x06,
+0xd6, 0x03, 0xf4, 0x68, 0xde, 0x57, 0xe9, 0x2c, 0x13, 0xa8, 0x05, 0xd0, 0x02, 0x94, 0x4f, 0xc6,
+0x32, 0x97, 0x25, 0xc9, 0x01, 0x8a, 0x05, 0xfe, 0x02, 0x8a, 0x7a, 0xc6, 0x32, 0xdd, 0x2e, 0x81,
+0x02, 0xd0, 0x02, 0xfc, 0x03, 0xdc, 0x6c, 0xac, 0x22, 0x8f, 0x3b, 0xa7, 0x05, 0xc2, 0x03, 0xbe,
+0x04, 0xa2, 0x76, 0x86, 0x28, 0xd7, 0x2f, 0xfa, 0x01, 0xe1, 0x02, 0x55, 0x9a, 0x4e, 0xf8, 0x15,
+0xfb, 0x29, 0xd2, 0x01, 0x43, 0x4b, 0x98, 0x63, 0xbc, 0x1f, 0xa3, 0x23, 0x56, 0x00, 0x86, 0x01,
+0x82, 0x52, 0xea, 0x2c, 0xab, 0x0d, 0x30, 0xcd, 0x05, 0x39, 0xa6, 0x4c, 0x9c, 0x39, 0x82, 0x14,
+0xc9, 0x01, 0xa5, 0x0b, 0xe5, 0x01, 0xc8, 0x1d, 0xb8, 0x20, 0xf0, 0x2b, 0xfd, 0x02, 0xbd, 0x04,
+0xbf, 0x01, 0xb8, 0x0b, 0x88, 0x13, 0xd4, 0x59, 0xcc, 0x03, 0xa3, 0x06, 0xf7, 0x04, 0xcd, 0x1c,
+0x91, 0x26, 0xd0, 0x6e, 0x94, 0x05, 0xb4, 0x01, 0xdd, 0x06, 0xb3, 0x35, 0xd7, 0x2f, 0xbe, 0x71,
+0xf8, 0x04, 0x25, 0x9b, 0x08, 0xcb, 0x31, 0xe9, 0x2c, 0x9a, 0x4e, 0x1b, 0x74, 0x8b, 0x02, 0xc3,
+0x47, 0xbb, 0x1f, 0xb6, 0x5e, 0x73, 0x7b, 0xb9, 0x03, 0x95, 0x63, 0x8d, 0x27, 0xa6, 0x4c, 0x85,
+0x01, 0xc2, 0x03, 0xf7, 0x01, 0xd7, 0x6d, 0xc5, 0x32, 0xd6, 0x44, 0x30, 0x09, 0x81, 0x02, 0x87,
+0x51, 0xdb, 0x2e, 0xf4, 0x2a, 0xe1, 0x02, 0x7c, 0xf5, 0x02, 0xbf, 0x5c, 0xe3, 0x2d, 0xd2, 0x30,
+0x8f, 0x01, 0xe5, 0x01, 0xf9, 0x01, 0xe5, 0x56, 0xe7, 0x41, 0x88, 0x28, 0x8b, 0x02, 0x92, 0x03,
+0xa3, 0x03, 0x95, 0x3a, 0xbf, 0x33, 0x82, 0x14, 0xc1, 0x03, 0xc6, 0x02, 0x4d, 0xb7, 0x49, 0xd1,
+0x30, 0x81, 0x14, 0xb1, 0x02, 0xf8, 0x04, 0xc7, 0x01, 0xeb, 0x40, 0xa9, 0x22, 0xc5, 0x32, 0xa3,
+0x01, 0x82, 0x05, 0x4c, 0x91, 0x3b, 0x97, 0x25, 0xcb, 0x31, 0x9c, 0x03, 0xae, 0x06, 0x99, 0x01,
+0xe1, 0x2d, 0xfd, 0x14, 0xab, 0x22, 0x4b, 0xe2, 0x05, 0x8d, 0x01, 0xc5, 0x32, 0x7a, 0x8b, 0x27,
+0x1b, 0x84, 0x04, 0xad, 0x01, 0xc3, 0x1e, 0xcf, 0x07, 0xdf, 0x19, 0x85, 0x04, 0x82, 0x08, 0x5d,
+0xcf, 0x07, 0xcb, 0x08, 0xc9, 0x08, 0xbf, 0x01, 0xba, 0x05, 0x85, 0x04, 0xaa, 0x22, 0xcd, 0x1c,
+0xa1, 0x0f, 0x4e, 0xb4, 0x0a, 0xb5, 0x01, 0xba, 0x34, 0xc1, 0x1e, 0xb5, 0x20, 0x9c, 0x03, 0xd0,
+0x07, 0x1b, 0xf4, 0x3f, 0x9d, 0x24, 0xb7, 0x20, 0x26, 0x88, 0x06, 0xbe, 0x01, 0x8c, 0x65, 0xd7,
+0x2f, 0xf3, 0x2a, 0xee, 0x04, 0xb2, 0x05, 0x44, 0xe4, 0x56, 0xb9, 0x34, 0xd9, 0x1a, 0x6a, 0xfe,
+0x02, 0x39, 0x8c, 0x65, 0x8b, 0x3c, 0xb1, 0x21, 0xf9, 0x01, 0xbc, 0x02, 0x11, 0xc8, 0x5b, 0xe5,
+0x41, 0xa3, 0x23, 0xb0, 0x03, 0xfc, 0x03, 0xb5, 0x01, 0xe0, 0x42, 0xb3, 0x35, 0xfd, 0x14, 0x27,
+0x55, 0x09, 0xc6, 0x32, 0x8d, 0x50, 0xfd, 0x14, 0x94, 0x08, 0x87, 0x03, 0x96, 0x02, 0xa2, 0x0f,
+0xf7, 0x53, 0xba, 0x0b, 0x7e, 0x8f, 0x09, 0xc5, 0x02, 0xb9, 0x0b, 0xd7, 0x2f, 0xec, 0x17, 0x82,
+0x02, 0xa1, 0x07, 0xdb, 0x01, 0xe9, 0x17, 0xf9, 0x29, 0xbc, 0x1f, 0x8b, 0x05, 0x91, 0x0b, 0x8d,
+0x07, 0xc5, 0x32, 0x89, 0x13, 0xe0, 0x19, 0x67, 0x81, 0x08, 0x8b, 0x02, 0xb9, 0x34, 0xc3, 0x09,
+0xb8, 0x0b, 0x00, 0x89, 0x05, 0xc5, 0x02, 0xdf, 0x57, 0x79, 0xa2, 0x0f, 0x69, 0xc9, 0x01, 0x3a,
+0x9b, 0x77, 0xb2, 0x0c, 0xb6, 0x20, 0xbf, 0x01, 0x56, 0xf7, 0x04, 0xb1, 0x73, 0xa2, 0x0f, 0xde,
+0x2e, 0xd7, 0x02, 0x9a, 0x01, 0x55, 0xd7, 0x58, 0x84, 0x14, 0xa0, 0x24, 0xb5, 0x01, 0xa6, 0x03,
+0x98, 0x01, 0xd5, 0x82, 0x01, 0xf6, 0x15, 0xda, 0x1a, 0x73, 0xae, 0x06, 0x83, 0x04, 0x8b, 0x8e,
+0x01, 0x90, 0x12, 0x9a, 0x10, 0x55, 0xc0, 0x09, 0x57, 0x95, 0x78, 0xa4, 0x23, 0x8a, 0x13, 0x41,
+0xbe, 0x07, 0xba, 0x03, 0x87, 0x51, 0xbc, 0x34, 0xd0, 0x07, 0x7b, 0xa8, 0x05, 0x1c, 0xe3, 0x56,
+0xea, 0x55, 0xf3, 0x01, 0xb6, 0x01, 0x96, 0x07, 0x1b, 0x85, 0x3d, 0xd2, 0x59, 0xb7, 0x0b, 0x7d,
+0xa4, 0x06, 0xd2, 0x01, 0x9d, 0x24, 0xfa, 0x3e, 0xe1, 0x04, 0x4b, 0xfc, 0x03, 0x5f, 0xf5, 0x2a,
+0xac, 0x4b, 0xeb, 0x17, 0x3a, 0x94, 0x08, 0xa0, 0x02, 0xdf, 0x19, 0xb4, 0x35, 0xe5, 0x18, 0x39,
+0xe8, 0x09, 0xe5, 0x01, 0xcf, 0x07, 0xf4, 0x2a, 0x9f, 0x24, 0x25, 0x84, 0x0c, 0xc9, 0x01, 0xf8,
+0x15, 0xda, 0x1a, 0xbb, 0x1f, 0x09, 0xb8, 0x09, 0x4b, 0xec, 0x40, 0x9c, 0x10, 0xe3, 0x2d, 0x6a,
+0x8c, 0x0a, 0xc1, 0x03, 0xe4, 0x6b, 0xc0, 0x0a, 0x97, 0x25, 0x1c, 0xbc, 0x05, 0xcf, 0x02, 0x92,
+0x64, 0xbe, 0x0a, 0x9f, 0x24, 0x4c, 0xe8, 0x03, 0x5d, 0x98, 0x8c, 0x01, 0xe8, 0x03, 0xaf, 0x21,
+0xd0, 0x02, 0x7c, 0x38, 0xf4, 0x68, 0xb7, 0x0b, 0xfd, 0x14, 0xac, 0x01, 0x71, 0x14, 0xc2, 0x85,
+0x01, 0xd9, 0x1a, 0xb7, 0x0b, 0xca, 0x01, 0xcd, 0x05, 0x90, 0x01, 0x92, 0x64, 0xe3, 0x2d, 0xa0,
+0x0f, 0x12, 0x81, 0x05, 0x82, 0x02, 0xae, 0x36, 0xe9, 0x2c, 0xb2, 0x21, 0xa4, 0x01, 0xad, 0x06,
+0xc0, 0x01, 0x94, 0x26, 0xbd, 0x48, 0xfe, 0x3d, 0x55, 0xdd, 0x09, 0x85, 0x01, 0xbe, 0x0a, 0xed,
+0x2b, 0xfc, 0x29, 0x9f, 0x02, 0x83, 0x07, 0xb9, 0x03, 0xa5, 0x0e, 0x87, 0x28, 0x90, 0x3b, 0x99,
+0x09, 0xd5, 0x0b, 0xa9, 0x07, 0xff, 0x3d, 0xed, 0x02, 0xf0, 0x54, 0x55, 0xd1, 0x0c, 0xcd, 0x02,
+0xad, 0x36, 0x83, 0x14, 0xac, 0x4b, 0x80, 0x08, 0xeb, 0x0a, 0x8f, 0x01, 0xef, 0x2b, 0xa5, 0x0e,
+0xa6, 0x23, 0x71, 0xa5, 0x06, 0xef, 0x04, 0xfb, 0x52, 0x88, 0x13, 0xf2, 0x16, 0xa2, 0x04, 0xb5,
+0x06, 0xad, 0x06, 0xa5, 0x4c, 0xec, 0x17, 0xd5, 0x1b, 0xbc, 0x02, 0x38, 0xab, 0x01, 0xc5, 0x5b,
+0xb2, 0x21, 0xc9, 0x31, 0x68, 0xf0, 0x04, 0xd1, 0x01, 0xf1, 0x54, 0xce, 0x1c, 0x93, 0x26, 0xb9,
+0x05, 0xce, 0x02, 0xd1, 0x04, 0x85, 0x8f, 0x01, 0xae, 0x36, 0xe5, 0x18, 0xe1, 0x05, 0xd4, 0x06,
+0xd7, 0x05, 0x8d, 0x8e, 0x01, 0x86, 0x28, 0x7a, 0x96, 0x02, 0xc0, 0x09, 0x81, 0x02, 0xd5, 0x6d,
+0x90, 0x12, 0xd0, 0x07, 0xf6, 0x02, 0xe8, 0x06, 0x5f, 0x8d, 0x8e, 0x01, 0xe7, 0x03, 0x00, 0xdc,
+0x01, 0x90, 0x09, 0x87, 0x03, 0xb5, 0x87, 0x01, 0xf3, 0x01, 0xc3, 0x09, 0x12, 0xca, 0x09, 0xd3,
+0x01, 0x97, 0x63, 0x00, 0xfd, 0x14, 0x2d, 0xf0, 0x09, 0x85, 0x01, 0x91, 0x64, 0xf3, 0x01, 0xa9,
+0x22, 0x00, 0x94, 0x0b, 0xeb, 0x02, 0xbf, 0x33, 0xd7, 0x06, 0xd3, 0x1b, 0x56, 0x98, 0x07, 0xa1,
+0x01, 0xbb, 0x1f, 0xd3, 0x1b, 0xdd, 0x2e, 0xe6, 0x01, 0xaa, 0x07, 0xf9, 0x01, 0xda, 0x1a, 0xa7,
+0x37, 0x81, 0x29, 0x08, 0xa4, 0x06, 0xac, 0x01, 0xf8, 0x53, 0xdf, 0x42, 0xa3, 0x23, 0xcd, 0x02,
+0xd8, 0x08, 0xac, 0x04, 0xd2, 0x59, 0xcb, 0x31, 0x9b, 0x10, 0x4d, 0xbc, 0x07, 0xec, 0x02, 0xea,
+0x93, 0x01, 0x9d, 0x39, 0xbd, 0x0a, 0x44, 0xb6, 0x07, 0xee, 0x04, 0xec, 0xa7, 0x01, 0x85, 0x28,
+0x7a, 0x00, 0xb0, 0x05, 0x67, 0xbc, 0x86, 0x01, 0xfd, 0x14, 0xcf, 0x07, 0x25, 0xca, 0x01, 0xc6,
+0x02, 0x96, 0xb6, 0x01, 0x89, 0x13, 0xd9, 0x1a, 0x25, 0x95, 0x02, 0xf8, 0x01, 0xc0, 0x9a, 0x01,
+0xde, 0x05, 0x99, 0x25, 0x56, 0x99, 0x06, 0xd0, 0x02, 0x8e, 0x79, 0xa6, 0x0e, 0xd7, 0x2f, 0xe6,
+0x01, 0xf9, 0x09, 0x00, 0xba, 0x34, 0xe8, 0x03, 0xd9, 0x1a, 0xdc, 0x01, 0x87, 0x09, 0x30, 0x88,
+0x28, 0xd8, 0x06, 0x87, 0x13, 0x85, 0x01, 0xd7, 0x0d, 0xf1, 0x03, 0x79, 0xf0, 0x16, 0x82, 0x14,
+0x5f, 0xc3, 0x10, 0xcb, 0x03, 0xdf, 0x19, 0xda, 0x1a, 0xc4, 0x1e, 0xab, 0x01, 0xeb, 0x0d, 0xeb,
+0x05, 0xab, 0x4b, 0xb6, 0x35, 0xf4, 0x2a, 0x99, 0x01, 0x8f, 0x0c, 0x81, 0x0a, 0xff, 0x66, 0xce,
+0x45, 0xec, 0x17, 0x13, 0xbd, 0x07, 0xb3, 0x0a, 0xd3, 0x59, 0xa2, 0x38, 0x7a, 0x7b, 0xcd, 0x02,
+0xf7, 0x04, 0xcd, 0x83, 0x01, 0xf8, 0x53, 0xee, 0x02, 0x9d, 0x02, 0x8f, 0x01, 0xad, 0x06, 0xb7,
+0x49, 0xa0, 0x4d, 0xfe, 0x14, 0xee, 0x01, 0xdc, 0x01, 0xc1, 0x03, 0xf9, 0x67, 0xa8, 0x60, 0xe0,
+0x19, 0xa6, 0x03, 0xfc, 0x03, 0xcd, 0x05, 0xed, 0x69, 0xe0, 0x57, 0xa8, 0x0e, 0x56, 0xba, 0x05,
+0xed, 0x07, 0xff, 0x66, 0xb4, 0x35, 0x00, 0xf6, 0x02, 0xea, 0x0b, 0x91, 0x03, 0xfd, 0x3d, 0xec,
+0x17, 0xca, 0x08, 0xc0, 0x01, 0xee, 0x04, 0xef, 0x01, 0xdb, 0x43, 0x8a, 0x13, 0xee, 0x02, 0x68,
+0x80, 0x03, 0xc5, 0x02, 0xc1, 0x1e, 0xd6, 0x06, 0xf3, 0x01, 0x0a, 0xce, 0x02, 0x3a, 0x91, 0x26,
+0xdb, 0x05, 0x7a, 0x60, 0x80, 0x03, 0xab, 0x01, 0xb1, 0x21, 0xfd, 0x14, 0x79, 0xc9, 0x01, 0xa2,
+0x04, 0x7c, 0xeb, 0x17, 0xf1, 0x16, 0xf4, 0x01, 0x37, 0xa8, 0x05, 0x6a, 0xa5, 0x0e, 0xd7, 0x2f,
+0xd6, 0x06, 0x1c, 0xec, 0x0a, 0xce, 0x02, 0xb2, 0x0c, 0xc9, 0x46, 0xae, 0x0d, 0x1b, 0xc4, 0x08,
+0xdc, 0x07, 0xf0, 0x2b, 0xd7, 0x58, 0xb2, 0x0c, 0xf7, 0x04, 0xce, 0x08, 0xaa, 0x07, 0xea, 0x2c,
+0xd7, 0x2f, 0xd8, 0x06, 0xfb, 0x06, 0xc6, 0x07, 0x95, 0x05, 0xc6, 0x32, 0xab, 0x0d, 0xb3, 0x0c,
+0xac, 0x01, 0x8a, 0x03, 0xc6, 0x02, 0xdc, 0x6c, 0xd4, 0x1b, 0xf1, 0x16, 0xbe, 0x0a, 0xee, 0x01,
+0xb8, 0x06, 0xdc, 0x6c, 0x94, 0x11, 0xd9, 0x1a, 0x73, 0x00, 0xde, 0x03, 0x82, 0x90, 0x01, 0xec,
+0x17, 0xdd, 0x2e, 0x2f, 0x97, 0x01, 0x55, 0xa4, 0x8a, 0x01, 0xd4, 0x1b, 0xbd, 0x33, 0x0a, 0xc9,
+0x01, 0xc0, 0x04, 0xd0, 0x6e, 0xd8, 0x06, 0xa3, 0x38, 0x41, 0xc5, 0x02, 0x68, 0x92, 0x64, 0xb8,
+0x0b, 0xa5, 0x4c, 0xf9, 0x01, 0x11, 0xc3, 0x02, 0xf4, 0x3f, 0xa2, 0x0f, 0xcd, 0x1c, 0xe6, 0x01,
+0xdf, 0x03, 0xd5, 0x06, 0xee, 0x2b, 0x82, 0x14, 0x96, 0x11, 0xb6, 0x01, 0xbb, 0x0a, 0xbf, 0x06,
+0x9c, 0x10, 0xb4, 0x0c, 0xbc, 0x1f, 0xac, 0x01, 0xc1, 0x06, 0xab, 0x04, 0x7a, 0xf4, 0x01, 0x8e,
+0x27, 0x6a, 0x8f, 0x09, 0xf9, 0x06, 0xb1, 0x0c, 0x00, 0xa0, 0x0f, 0x99, 0x01, 0xa9, 0x07, 0xb5,
+0x04, 0xef, 0x2b, 0xb8, 0x0b, 0xc9, 0x08, 0x37, 0x9d, 0x05, 0xbd, 0x07, 0x81, 0x29, 0xae, 0x0d,
+0xe7, 0x03, 0x4c, 0xaf, 0x03, 0x97, 0x04, 0xd9, 0x43, 0xa4, 0x23, 0x79, 0x30, 0xcd, 0x02, 0xe7,
+0x06, 0x93, 0x4f, 0x94, 0x26, 0xcb, 0x08, 0xac, 0x01, 0x8f, 0x04, 0xf9, 0x06, 0x85, 0x3d, 0xb0,
+0x21, 0xe7, 0x03, 0x39, 0x9d, 0x02, 0x97, 0x04, 0xc5, 0x5b, 0xce, 0x1c, 0xcf, 0x07, 0x1e, 0xa9,
+0x02, 0xed, 0x04, 0xf3, 0x68, 0xc4, 0x09, 0xed, 0x02, 0x72, 0x6a, 0xff, 0x02, 0x93, 0x4f, 0xc6,
+0x09, 0xf3, 0x01, 0x6a, 0xc6, 0x02, 0x69, 0xaf, 0x5f, 0xa6, 0x0e, 0xa6, 0x0e, 0x26, 0xf2, 0x03,
+0x71, 0xdb, 0x43, 0xa2, 0x0f, 0xa2, 0x0f, 0x5f, 0xf8, 0x01, 0x26, 0xa5, 0x4c, 0xc8, 0x1d, 0xec,
+0x17, 0x85, 0x01, 0xd4, 0x06, 0x71, 0xed, 0x2b, 0xce, 0x1c, 0x9a, 0x10, 0x4c, 0xc8, 0x04, 0xc8,
+0x01, 0xd9, 0x1a, 0xe6, 0x18, 0xcc, 0x08, 0x5d, 0xba, 0x08, 0xc2, 0x03, 0xd1, 0x07, 0xe2, 0x04,
+0xb8, 0x0b, 0x69, 0xba, 0x03, 0xa2, 0x04, 0xc6, 0x09, 0xbd, 0x0a, 0xc0, 0x0a, 0x13, 0x84, 0x07,
+0x9e, 0x05, 0xbc, 0x1f, 0xb5, 0x20, 0xf8, 0x15, 0x4e, 0x9e, 0x05, 0xb2, 0x05, 0xc8, 0x1d, 0xb1,
+0x21, 0xac, 0x0d, 0xa2, 0x01, 0xdc, 0x01, 0x30, 0xf6, 0x2a, 0xcf, 0x30, 0x90, 0x12, 0xb1, 0x02,
+0xd4, 0x09, 0x98, 0x04, 0xe4, 0x56, 0xa3, 0x38, 0xda, 0x1a, 0x43, 0xcc, 0x03, 0xe6, 0x01, 0xa0,
+0x4d, 0xe7, 0x2c, 0xbc, 0x1f, 0xfa, 0x01, 0x7c, 0x39, 0xd0, 0x6e, 0x93, 0x4f, 0x92, 0x26, 0xa9,
+0x02, 0xf0, 0x01, 0x6a, 0xde, 0x6c, 0xa9, 0x60, 0xae, 0x0d, 0x1b, 0xe1, 0x02, 0xa4, 0x01, 0x90,
+0x64, 0xcb, 0x6f, 0xb7, 0x0b, 0xbb, 0x02, 0xff, 0x02, 0x9f, 0x02, 0xb2, 0x4a, 0xdd, 0x57, 0x83,
+0x14, 0x85, 0x01, 0xc1, 0x03, 0xbf, 0x01, 0xb6, 0x5e, 0xe1, 0x6b, 0xb1, 0x21, 0xa2, 0x01, 0xbb,
+0x05, 0xd7, 0x05, 0xbc, 0x5d, 0x81, 0x52, 0x85, 0x28, 0xe6, 0x01, 0xcf, 0x07, 0xa5, 0x08, 0xb4,
+0x35, 0xcd, 0x1c, 0xdf, 0x19, 0x09, 0x87, 0x06, 0x95, 0x05, 0xfa, 0x29, 0xef, 0x02, 0x99, 0x25,
+0x7e, 0xdb, 0x09, 0xf5, 0x07, 0xee, 0x02, 0x9c, 0x10, 0xb3, 0x35, 0x99, 0x01, 0x8d, 0x0a, 0xbd,
+0x07, 0x87, 0x13, 0x84, 0x14, 0xed, 0x2b, 0x55, 0x91, 0x06, 0xdb, 0x04, 0x85, 0x3d, 0xec, 0x17,
+0xa1, 0x38, 0x30, 0xd9, 0x07, 0xbd, 0x04, 0x81, 0x52, 0xa0, 0x0f, 0xdb, 0x1a, 0xab, 0x01, 0xcf,
+0x07, 0x81, 0x02, 0xab, 0x4b, 0xd8, 0x06, 0xd5, 0x06, 0x69, 0xff, 0x02, 0xf9, 0x01, 0xa9, 0x60,
+0xdc, 0x05, 0xa8, 0x0e, 0x95, 0x02, 0x1e, 0xef, 0x01, 0xd1, 0x59, 0xd0, 0x07, 0xd4, 0x1b, 0x25,
+0xf4, 0x02, 0xad, 0x03, 0xd5, 0x44, 0xd0, 0x07, 0xce, 0x1c, 0x2f, 0x88, 0x06, 0x9f, 0x02, 0x83,
+0x3d, 0xd2, 0x07, 0xa8, 0x37, 0x9a, 0x01, 0xc0, 0x04, 0xbb, 0x02, 0xe9, 0x2c, 0xce, 0x1c, 0x90,
+0x3b, 0xa2, 0x01, 0x94, 0x02, 0xf0, 0x01, 0xeb, 0x17, 0xfc, 0x29, 0xca, 0x1d, 0x1c, 0x28, 0x4b,
+0xa3, 0x23, 0xde, 0x57, 0xb2, 0x0c, 0xb5, 0x01, 0x39, 0xc4, 0x02, 0x99, 0x25, 0x92, 0x64, 0x8f,
+0x12, 0x0a, 0x86, 0x01, 0xf6, 0x02, 0xcd, 0x1c, 0xde, 0x57, 0x85, 0x28, 0x0a, 0xac, 0x04, 0x96,
+0x02, 0x81, 0x14, 0xfc, 0x29, 0xf7, 0x15, 0xc0, 0x01, 0x90, 0x06, 0xde, 0x03, 0xd7, 0x06, 0xa0,
+0x0f, 0xbd, 0x0a, 0xb6, 0x01, 0x92, 0x09, 0x8c, 0x05, 0x96, 0x11, 0xfb, 0x14, 0xb2, 0x0c, 0x12,
+0xb6, 0x06, 0x1c, 0xea, 0x2c, 0xad, 0x36, 0xa2, 0x0f, 0x30, 0x96, 0x05, 0x4e, 0xce, 0x45, 0xf9,
+0x3e, 0x79, 0x85, 0x01, 0x55, 0xf9, 0x01, 0xa4, 0x38, 0xc7, 0x1d, 0xd1, 0x07, 0x97, 0x01, 0xd5,
+0x03, 0xbf, 0x01, 0x9a, 0x4e, 0x79, 0x9f, 0x0f, 0xcc, 0x03, 0xe7, 0x06, 0xa9, 0x04, 0xce, 0x45,
+0x9c, 0x10, 0xbd, 0x1f, 0x94, 0x02, 0xdf, 0x08, 0x8d, 0x07, 0xd4, 0x1b, 0x94, 0x11, 0xcd, 0x1c,
+0xf0, 0x01, 0x93, 0x05, 0xb7, 0x03, 0xc0, 0x0a, 0xd4, 0x1b, 0xaf, 0x21, 0x71, 0xf7, 0x07, 0x91,
+0x09, 0xfd, 0x14, 0xec, 0x17, 0x83, 0x14, 0x00, 0x99, 0x06, 0x93, 0x08, 0xaf, 0x21, 0xf8, 0x15,
+0xee, 0x02, 0x98, 0x01, 0xe9, 0x03, 0xdf, 0x05, 0x9b, 0x39, 0xc2, 0x1e, 0xf8, 0x15, 0xa4, 0x01,
+0x81, 0x02, 0xc7, 0x04, 0xd7, 0x2f, 0xe0, 0x19, 0xec, 0x17, 0x86, 0x01, 0xb5, 0x01, 0xa1, 0x04,
+0xd5, 0x44, 0xf8, 0x15, 0x9a, 0x25, 0x00, 0xb5, 0x01, 0x83, 0x02, 0xa1, 0x38, 0xee, 0x02, 0x8c,
+0x27, 0x89, 0x03, 0x1b, 0xf6, 0x02, 0x81, 0x29, 0xd3, 0x1b, 0xba, 0x0b, 0x83, 0x04, 0xb6, 0x01,
+0x86, 0x04, 0xb9, 0x34, 0xc5, 0x5b, 0xf4, 0x01, 0xf5, 0x02, 0x84, 0x04, 0xde, 0x03, 0xb5, 0x20,
+0xa3, 0x61, 0xdd, 0x05, 0x60, 0xa6, 0x03, 0xbe, 0x04, 0x95, 0x11, 0x93, 0x4f, 0xe4, 0x04, 0x8c,
+0x02, 0xc0, 0x01, 0x8a, 0x03, 0xab, 0x0d, 0xbb, 0x5d, 0xe2, 0x04, 0x26, 0xac, 0x01, 0xe6, 0x01,
+0xa6, 0x0e, 0xc3, 0x47, 0xc5, 0x09, 0x97, 0x01, 0xfe, 0x02, 0xb6, 0x01, 0xfe, 0x14, 0xf9, 0x29,
+0xdb, 0x05, 0x13, 0xbc, 0x05, 0xa4, 0x03, 0xf2, 0x16, 0xc3, 0x1e, 0x99, 0x10, 0x69, 0xfe, 0x05,
+0xb6, 0x01, 0xb6, 0x20, 0xcf, 0x07, 0xa1, 0x0f, 0xe7, 0x03, 0xcd, 0x02, 0xb5, 0x01, 0x96, 0x11,
+0xc2, 0x1e, 0xbd, 0x0a, 0x60, 0xd5, 0x03, 0x1e, 0xd0, 0x07, 0xd0, 0x45, 0xe9, 0x03, 0x5f, 0xd9,
+0x07, 0xd9, 0x02, 0xab, 0x0d, 0xee, 0x69, 0xd5, 0x06, 0x3a, 0xfd, 0x05, 0x95, 0x07, 0x8f, 0x12,
+0xbe, 0x48, 0xe1, 0x04, 0x42, 0xaf, 0x03, 0x87, 0x09, 0xf5, 0x2a, 0xea, 0x55, 0xd5, 0x06, 0x9a,
+0x01, 0xff, 0x07, 0xc7, 0x0c, 0x91, 0x26, 0xd2, 0x30, 0x79, 0x42, 0xc7, 0x07, 0xfb, 0x06, 0xc9,
+0x46, 0xf0, 0x2b, 0xb8, 0x0b, 0xb4, 0x02, 0xa1, 0x0c, 0xa7, 0x0d, 0xe9, 0x55, 0xd4, 0x1b, 0xc8,
+0x1d, 0x68, 0xd9, 0x0a, 0x8f, 0x0c, 0xa3, 0x61, 0xc2, 0x1e, 0xf0, 0x2b, 0x1b, 0xe7, 0x06, 0xc5,
+0x07, 0x8d, 0x50, 0xfe, 0x14, 0xa4, 0x23, 0x13, 0xab, 0x01, 0x12, 0xeb, 0x7e, 0xdc, 0x05, 0xfc,
+0x29, 0x30, 0xac, 0x01, 0x9a, 0x01, 0xe9, 0x93, 0x01, 0xed, 0x2b, 0xbc, 0x1f, 0x67, 0xc4, 0x08,
+0xa8, 0x02, 0x91, 0x64, 0xcb, 0x31, 0x9c, 0x10, 0x4d, 0x82, 0x08, 0xf0, 0x01, 0xd5, 0x6d, 0x97,
+0x3a, 0xb8, 0x0b, 0x90, 0x01, 0xaa, 0x07, 0xcc, 0x03, 0xa5, 0x4c, 0xf3, 0x2a, 0xed, 0x02, 0x6a,
+0x84, 0x04, 0xee, 0x04, 0xe9, 0x2c, 0xa5, 0x23, 0xa5, 0x0e, 0x25, 0xa0, 0x02, 0xdc, 0x04, 0xdb,
+0x2e, 0xa7, 0x37, 0xf1, 0x16, 0x4d, 0x8c, 0x05, 0xb4, 0x04, 0xbd, 0x1f, 0x91, 0x26, 0x83, 0x14,
+0x00, 0x94, 0x05, 0xd6, 0x03, 0xc7, 0x1d, 0x87, 0x28, 0xf1, 0x16, 0xd4, 0x01, 0xde, 0x06, 0xd8,
+0x02, 0x93, 0x11, 0xb7, 0x0b, 0xf1, 0x16, 0x39, 0xfe, 0x05, 0xea, 0x03, 0xd6, 0x06, 0xa6, 0x0e,
+0xdb, 0x05, 0xcf, 0x02, 0x56, 0x8e, 0x01, 0x9a, 0x10, 0xea, 0x2c, 0xdf, 0x19, 0xb5, 0x01, 0xe5,
+0x01, 0xc6, 0x02, 0xe4, 0x04, 0xea, 0x55, 0xa1, 0x0f, 0x14, 0x9d, 0x02, 0xac, 0x04, 0xd7, 0x06,
+0xc4, 0x47, 0xc3, 0x09, 0x9f, 0x02, 0xeb, 0x02, 0x96, 0x02, 0x85, 0x28, 0xe6, 0x7f, 0xb3, 0x0c,
+0x41, 0xcb, 0x03, 0xd3, 0x01, 0x9f, 0x24, 0xd6, 0x6d, 0xab, 0x0d, 0xc6, 0x02, 0x13, 0xc9, 0x03,
+0xf9, 0x29, 0xde, 0x95, 0x01, 0xc3, 0x09, 0x12, 0xe5, 0x01, 0x97, 0x07, 0xdd, 0x2e, 0xa2, 0x76,
+0xd7, 0x06, 0x1e, 0xa9, 0x07, 0xb9, 0x08, 0x95, 0x11, 0xe0, 0x42, 0xb4, 0x0c, 0x73, 0xb3, 0x07,
+0xc5, 0x05, 0xed, 0x2b, 0xd2, 0x30, 0x8a, 0x13, 0x14, 0x83, 0x0a, 0x8b, 0x0a, 0xb7, 0x49, 0x90,
+0x12, 0x88, 0x13, 0x0a, 0xa9, 0x07, 0x85, 0x09, 0x93, 0x4f, 0xd5, 0x06, 0xba, 0x0b, 0x92, 0x03,
+0xd7, 0x05, 0x97, 0x07, 0xeb, 0x7e, 0x93, 0x26, 0xd6, 0x06, 0xee, 0x01, 0xdd, 0x03, 0xa9, 0x07,
+0xb7, 0x87, 0x01, 0xc5, 0x32, 0xae, 0x0d, 0x86, 0x01, 0xe2, 0x02, 0x4c, 0x95, 0x63, 0xc5, 0x32,
+0x82, 0x14, 0xaa, 0x02, 0x9c, 0x03, 0xfc, 0x03, 0xd9, 0x81, 0x01, 0xa9, 0x60, 0x82, 0x29, 0x13,
+0xf6, 0x07, 0x90, 0x06, 0xcd, 0x5a, 0x83, 0x66, 0xb0, 0x21, 0xdb, 0x01, 0x82, 0x08, 0xca, 0x0c,
+0xcb, 0x31, 0xe5, 0x7f, 0xfe, 0x14, 0x55, 0x9a, 0x09, 0x94, 0x08, 0x79, 0x9d, 0x62, 0xe1, 0x04,
+0x1c, 0x84, 0x07, 0xb8, 0x06, 0xa0, 0x24, 0xb3, 0x73, 0x89, 0x13, 0x2f, 0x8e, 0x07, 0x94, 0x05,
+0xa8, 0x37, 0xb3, 0x5e, 0xa7, 0x0e, 0x9a, 0x01, 0x84, 0x04, 0xb6, 0x01, 0xc8, 0x1d, 0xe9, 0x2c,
+0x87, 0x13, 0x9a, 0x01, 0x7e, 0x14, 0xe0, 0x19, 0xa9, 0x22, 0xa1, 0x0f, 0x4c, 0x27, 0x93, 0x03,
+0x79, 0xa1, 0x0f, 0xab, 0x0d, 0x43, 0x87, 0x03, 0xe1, 0x02, 0xd1, 0x07, 0x83, 0x14, 0xcb, 0x08,
+0x55, 0xb3, 0x07, 0x87, 0x03, 0xf9, 0x29, 0xfd, 0x14, 0xe5, 0x18, 0xb5, 0x01, 0xed, 0x07, 0x9d,
+0x05, 0xb9, 0x34, 0x79, 0xeb, 0x17, 0xed, 0x01, 0xb3, 0x04, 0xdb, 0x01, 0xa5, 0x4c, 0xc6, 0x09,
+0xd9, 0x1a, 0x69, 0xaf, 0x03, 0x8b, 0x05, 0xdf, 0x57, 0xa4, 0x23, 0xcf, 0x07, 0x3a, 0xe5, 0x01,
+0x91, 0x03, 0xf7, 0x3e, 0x8e, 0x27, 0xe1, 0x04, 0x55, 0xc5, 0x02, 0xaf, 0x03, 0x8d, 0x50, 0xb4,
+0x35, 0xf1, 0x16, 0xbf, 0x01, 0xf1, 0x03, 0x9d, 0x02, 0xdb, 0x43, 0x80, 0x29, 0x9b, 0x10, 0x30,
+0xd3, 0x03, 0xd3, 0x01, 0xd7, 0x58, 0xea, 0x2c, 0xe1, 0x04, 0x3a, 0xab, 0x04, 0xe5, 0x01, 0xef,
+0x54, 0xea, 0x2c, 0xdc, 0x05, 0x1c, 0xef, 0x01, 0x97, 0x01, 0x8b, 0x3c, 0xb6, 0x20, 0xb4, 0x0c,
+0x56, 0x1e, 0x86, 0x01, 0xcf, 0x45, 0x98, 0x25, 0x96, 0x11, 0xef, 0x01, 0x90, 0x01, 0x88, 0x03,
+0x95, 0x3a, 0xd4, 0x1b, 0x7a, 0x2f, 0xf2, 0x03, 0xbc, 0x02, 0xaf, 0x21, 0xe4, 0x04, 0xed, 0x02,
+0x1e, 0xfe, 0x02, 0x86, 0x04, 0x81, 0x29, 0xf3, 0x01, 0xef, 0x02, 0x42, 0xb8, 0x03, 0xee, 0x04,
+0xff, 0x28, 0x95, 0x11, 0xdb, 0x05, 0x3a, 0xe0, 0x03, 0xe8, 0x03, 0xb1, 0x21, 0xa7, 0x0e, 0xe1,
+0x04, 0x4c, 0x8c, 0x02, 0x9a, 0x01, 0xdb, 0x2e, 0xe5, 0x18, 0xbd, 0x0a, 0x60, 0x92, 0x03, 0xbc,
+0x02, 0xe3, 0x2d, 0xaf, 0x21, 0xf1, 0x16, 0x90, 0x01, 0xca, 0x01, 0x1c, 0x81, 0x52, 0x8f, 0x3b,
+0x87, 0x28, 0x42, 0xa8, 0x02, 0xbf, 0x01, 0x97, 0x63, 0xe5, 0x56, 0xef, 0x2b, 0x97, 0x01, 0xc6,
+0x02, 0x3a, 0xbd, 0x48, 0xf1, 0x3f, 0xcd, 0x1c, 0x39, 0x4c, 0x86, 0x01, 0xb7, 0x49, 0xa5, 0x4c,
+0xc7, 0x1d, 0x71, 0xcd, 0x02, 0x98, 0x04, 0xd1, 0x30, 0xe9, 0x2c, 0x9f, 0x0f, 0x5f, 0xa1, 0x04,
+0xea, 0x03, 0xd3, 0x1b, 0xc9, 0x08, 0xcb, 0x08, 0xc9, 0x01, 0x8f, 0x01, 0xa8, 0x02, 0x8d, 0x12,
+0xca, 0x08, 0xcf, 0x07, 0x1b, 0xdc, 0x01, 0xf0, 0x01, 0xcf, 0x1c, 0x9c, 0x10, 0x8f, 0x12, 0x12,
+0xa6, 0x03, 0x55, 0xc7, 0x1d, 0xe8, 0x03, 0x99, 0x10, 0x7e, 0xa4, 0x03, 0xb5, 0x01, 0xd7, 0x2f,
+0xfd, 0x14, 0xa1, 0x0f, 0xac, 0x01, 0xe2, 0x02, 0x0a, 0xc5, 0x32, 0x97, 0x25, 0xe7, 0x03, 0x0a,
+0x2d, 0x1d, 0xe1, 0x2d, 0xfb, 0x29, 0xf4, 0x01, 0x83, 0x02, 0xf8, 0x01, 0x4c, 0xa5, 0x23, 0xfd,
+0x14, 0xbe, 0x0a, 0x8b, 0x02, 0xb6, 0x01, 0x6a, 0xcb, 0x31, 0xc9, 0x08, 0x84, 0x14, 0x1b, 0x8c,
+0x02, 0x56, 0x95, 0x3a, 0x84, 0x14, 0xae, 0x0d, 0xdb, 0x01, 0xb2, 0x02, 0xdc, 0x01, 0xd7, 0x2f,
+0xb4, 0x35, 0xbe, 0x0a, 0x8f, 0x01, 0x11, 0x84, 0x02, 0xaf, 0x21, 0xc6, 0x32, 0xed, 0x02, 0x0a,
+0x1c, 0xee, 0x01, 0xeb, 0x17, 0xae, 0x36, 0xe1, 0x04, 0x3a, 0x5f, 0x3a, 0xb7, 0x0b, 0xde, 0x2e,
+0xdb, 0x05, 0x09, 0x09, 0x60, 0xe3, 0x04, 0xce, 0x1c, 0xee, 0x02, 0x72, 0x37, 0x90, 0x01, 0xf5,
+0x15, 0xb6, 0x20, 0xca, 0x08, 0x2f, 0x55, 0x8f, 0x01, 0x99, 0x25, 0xbc, 0x1f, 0xf2, 0x16, 0xa1,
+0x01, 0xad, 0x01, 0x82, 0x02, 0xf5, 0x2a, 0xda, 0x1a, 0xfe, 0x14, 0x7b, 0x8d, 0x01, 0x0a, 0xaf,
+0x4a, 0xb2, 0x21, 0xc2, 0x1e, 0x9f, 0x02, 0xdd, 0x01, 0x2f, 0xa9, 0x37, 0xf8, 0x15, 0x9e, 0x24,
+0x2f, 0x30, 0xdb, 0x01, 0xcd, 0x1c, 0xca, 0x08, 0x88, 0x28, 0xc0, 0x01, 0x74, 0x39, 0x81, 0x14,
+0x84, 0x14, 0xa8, 0x37, 0x88, 0x03, 0x42, 0x71, 0xfd, 0x14, 0xe6, 0x18, 0xfe, 0x3d, 0x30, 0x60,
+0x42, 0xbf, 0x0a, 0xbe, 0x0a, 0xfc, 0x29, 0xd1, 0x01, 0x1e, 0xe6, 0x01, 0xf3, 0x2a, 0xa2, 0x0f,
+0xd2, 0x59, 0x8b, 0x1b, 0xc1, 0x03, 0xe9, 0x08, 0xe5, 0x56, 0xa5, 0x23, 0xda, 0x58, 0x92, 0x2c,
+0xf4, 0x10, 0xc6, 0x20, 0xbc, 0x1f, 0x87, 0x51, 0xa6, 0x0e, 0xf1, 0x03, 0xab, 0x04, 0x86, 0x04,
+0xbd, 0x0a, 0x93, 0x4f, 0xa1, 0x38, 0xfb, 0x0b, 0xc6, 0x0d, 0xb4, 0x04, 0xb6, 0x20, 0xad, 0x36,
+0xe1, 0x6b, 0x1e, 0x9e, 0x02, 0x7b, 0x94, 0x26, 0x81, 0x29, 0x91, 0x26, 0x8b, 0x02, 0x30, 0xf6,
+0x02, 0xf0, 0x2b, 0xee, 0x02, 0xb9, 0x0b, 0x4c, 0x9a, 0x01, 0xd3, 0x01, 0x8e, 0x12, 0xf6, 0x2a,
+0xbb, 0x1f, 0x82, 0x02, 0xe2, 0x02, 0x7e, 0xd6, 0x06, 0xba, 0x34, 0xa9, 0x22, 0x00, 0x41, 0x95,
+0x02, 0xe4, 0x04, 0xc0, 0x33, 0xa3, 0x38, 0x55, 0xc1, 0x06, 0x81, 0x05, 0xbd, 0x1f, 0xfc, 0x29,
+0x91, 0x26, 0x26, 0xc3, 0x05, 0xa1, 0x01, 0xe1, 0x2d, 0xc8, 0x1d, 0xdf, 0x19, 0xb6, 0x01, 0xbf,
+0x01, 0xfb, 0x03, 0x85, 0x3d, 0xd2, 0x30, 0xed, 0x02, 0x1e, 0x90, 0x01, 0xbb, 0x02, 0x99, 0x4e,
+0xd8, 0x2f, 0x9c, 0x10, 0x9e, 0x02, 0x9c, 0x03, 0xec, 0x02, 0x8d, 0x50, 0xe8, 0x2c, 0xf6, 0x15,
+0xab, 0x01, 0x96, 0x02, 0xb6, 0x01, 0xd7, 0x2f, 0xca, 0x1d, 0xc0, 0x0a, 0x39, 0x86, 0x01, 0x25,
+0xa9, 0x22, 0x88, 0x13, 0xc4, 0x09, 0x44, 0x99, 0x01, 0x85, 0x01, 0x9b, 0x10, 0xf8, 0x15, 0x84,
+0x14, 0x9c, 0x03, 0x97, 0x04, 0x56, 0xbd, 0x0a, 0xd4, 0x1b, 0xf8, 0x15, 0xac, 0x01, 0xdb, 0x01,
+0x72, 0x83, 0x14, 0xe4, 0x2d, 0xaa, 0x22, 0xa1, 0x01, 0xee, 0x01, 0xc8, 0x04, 0x8f, 0x12, 0xf6,
+0x2a, 0x84, 0x14, 0xef, 0x01, 0xe4, 0x02, 0xc2, 0x03, 0xd8, 0x06, 0x94, 0x11, 0xd4, 0x1b, 0xa5,
+0x03, 0x42, 0x92, 0x03, 0xfa, 0x29, 0xe7, 0x03, 0x98, 0x25, 0x26, 0x86, 0x04, 0x41, 0xf4, 0x68,
+0xa3, 0x23, 0xb8, 0x20, 0xa6, 0x03, 0x8e, 0x04, 0x09, 0xd8, 0x6d, 0x81, 0x29, 0xec, 0x17, 0xac,
+0x01, 0x4c, 0x86, 0x01, 0x92, 0x8d, 0x01, 0xcf, 0x45, 0xa0, 0x0f, 0xb6, 0x01, 0xdc, 0x01, 0xfc,
+0x03, 0xb4, 0x73, 0x8d, 0x50, 0xe2, 0x04, 0x55, 0x6a, 0x82, 0x05, 0xd8, 0x58, 0xdd, 0x57, 0xcc,
+0x08, 0x9f, 0x02, 0xcc, 0x03, 0xf4, 0x05, 0xe4, 0x2d, 0xa7, 0x37, 0xd0, 0x07, 0x25, 0xbc, 0x02,
+0xdc, 0x01, 0xb4, 0x35, 0x8d, 0x27, 0xb2, 0x0c, 0x26, 0xce, 0x05, 0xfc, 0x03, 0xf6, 0x2a, 0xe8,
+0x03, 0xc6, 0x09, 0x37, 0xcc, 0x03, 0x80, 0x03, 0x82, 0x14, 0xf2, 0x16, 0xd0, 0x07, 0x55, 0xb6,
+0x01, 0x2e, 0xf2, 0x16, 0xde, 0x2e, 0xc0, 0x0a, 0x39, 0xe6, 0x01, 0xe6, 0x01, 0xa8, 0x0e, 0x86,
+0x3d, 0xe2, 0x04, 0x2f, 0x25, 0x81, 0x02, 0xe8, 0x03, 0xfa, 0x29, 0xe7, 0x03, 0x1c, 0x39, 0xb5,
+0x01, 0x00, 0xd8, 0x2f, 0xb9, 0x0b, 0x4e, 0xed, 0x04, 0xd5, 0x03, 0xed, 0x02, 0x9e, 0x24, 0xb1,
+0x0c, 0xa2, 0x01, 0x8f, 0x04, 0xe9, 0x02, 0xb9, 0x0b, 0xec, 0x17, 0xbf, 0x0a, 0x42, 0xeb, 0x02,
+0xb3, 0x02, 0xcd, 0x1c, 0xc8, 0x1d, 0xab, 0x0d, 0x90, 0x01, 0xbd, 0x04, 0xf3, 0x02, 0x85, 0x28,
+0xf8, 0x15, 0x83, 0x14, 0x56, 0xe3, 0x04, 0xdd, 0x01, 0xe3, 0x2d, 0xd2, 0x07, 0xfd, 0x14, 0xb6,
+0x01, 0xff, 0x02, 0x4b, 0xe1, 0x42, 0xb9, 0x0b, 0xa3, 0x23, 0x74, 0x83, 0x04, 0xa2, 0x01, 0xfb,
+0x52, 0xcd, 0x1c, 0x93, 0x26, 0x2f, 0xb9, 0x03, 0xaa, 0x02, 0xbd, 0x48, 0xfb, 0x29, 0xd3, 0x1b,
+0xbf, 0x01, 0x9a, 0x01, 0x86, 0x01, 0xef, 0x54, 0xbb, 0x48, 0x85, 0x28, 0xd1, 0x01, 0xbb, 0x02,
+0xa0, 0x02, 0xbb, 0x5d, 0xcd, 0x5a, 0x81, 0x29, 0xd2, 0x01, 0x95, 0x02, 0xde, 0x03, 0xa1, 0x38,
+0xc3, 0x47, 0xf7, 0x15, 0x4c, 0x1c, 0x8b, 0x02, 0xf1, 0x3f, 0x97, 0x63, 0xa5, 0x0e, 0xb1, 0x02,
+0x86, 0x01, 0xbc, 0x02, 0x9b, 0x39, 0xf7, 0x3e, 0xc4, 0x09, 0x74, 0xec, 0x02, 0x4c, 0x9f, 0x24,
+0xeb, 0x17, 0xfe, 0x14, 0xdb, 0x01, 0x8a, 0x03, 0xdc, 0x04, 0x9b, 0x10, 0xd6, 0x06, 0xda, 0x1a,
+0x13, 0xc8, 0x04, 0xb2, 0x02, 0xcf, 0x07, 0xca, 0x1d, 0x86, 0x28, 0xab, 0x01, 0xba, 0x08, 0xee,
+0x07, 0xe6, 0x18, 0x86, 0x28, 0x9a, 0x25, 0x13, 0xf6, 0x07, 0xb4, 0x07, 0xa6, 0x23, 0xb0, 0x21,
+0xbc, 0x1f, 0x56, 0xb0, 0x06, 0xee, 0x04, 0xc8, 0x46, 0xfc, 0x29, 0xbc, 0x1f, 0x14, 0xc0, 0x06,
+0xbc, 0x05, 0xbc, 0x5d, 0xe6, 0x18, 0x84, 0x14, 0xb2, 0x02, 0xa8, 0x05, 0xf0, 0x01, 0xf6, 0x53,
+0xbe, 0x0a, 0x8a, 0x13, 0x98, 0x04, 0xd0, 0x02, 0x26, 0xf2, 0x7d, 0xd2, 0x07, 0xc8, 0x1d, 0x7b,
+0xac, 0x01, 0x7c, 0xce, 0x83, 0x01, 0xf2, 0x16, 0xfe, 0x14, 0x25, 0x69, 0xf0, 0x01, 0xaa, 0x60,
+0x88, 0x13, 0xd6, 0x06, 0x7b, 0x85, 0x01, 0x0a, 0xa0, 0x76, 0xd4, 0x1b, 0xb1, 0x0c, 0xf9, 0x01,
+0xb5, 0x01, 0x98, 0x01, 0x92, 0x64, 0xb4, 0x0c, 0xdf, 0x19, 0x71, 0x9b, 0x03, 0x8c, 0x02, 0xa6,
+0x4c, 0xb3, 0x0c, 0xe5, 0x18, 0x00, 0xbb, 0x02, 0xe6, 0x01, 0xd4, 0x1b, 0xc7, 0x1d, 0xd1, 0x07,
+0x69, 0x8b, 0x02, 0xa4, 0x01, 0xda, 0x1a, 0xd3, 0x44, 0xde, 0x05, 0x43, 0xd1, 0x01, 0x98, 0x01,
+0x8a, 0x13, 0xf1, 0x54, 0xb2, 0x0c, 0x5d, 0x91, 0x03, 0xbb, 0x02, 0xba, 0x0b, 0x8f, 0x3b, 0xee,
+0x02, 0x1c, 0xbf, 0x01, 0x1b, 0xac, 0x0d, 0xed, 0x40, 0xf4, 0x01, 0x09, 0xa7, 0x02, 0xef, 0x01,
+0xd6, 0x06, 0x8b, 0x27, 0xc3, 0x09, 0x5f, 0xbf, 0x01, 0x99, 0x01, 0xe4, 0x04, 0xcd, 0x1c, 0x89,
+0x13, 0x80, 0x03, 0x85, 0x01, 0xa1, 0x04, 0xd7, 0x06, 0xb5, 0x20, 0xa5, 0x0e, 0x9e, 0x08, 0x9c,
+0x03, 0xc1, 0x03, 0xd2, 0x07, 0xbd, 0x1f, 0x8e, 0x12, 0xf2, 0x08, 0xce, 0x05, 0xb9, 0x05, 0xed,
+0x02, 0xaf, 0x21, 0x8e, 0x27, 0x83, 0x07, 0x91, 0x03, 0xbe, 0x04, 0xc5, 0x09, 0xa3, 0x23, 0x8a,
+0x3c, 0xc5, 0x02, 0x30, 0x11, 0xa2, 0x0f, 0x93, 0x26, 0xf2, 0x16, 0xfd, 0x05, 0xad, 0x01, 0xee,
+0x01, 0x98, 0x25, 0x8b, 0x27, 0xb8, 0x0b, 0xc1, 0x03, 0x5f, 0xbc, 0x05, 0xa8, 0x37, 0xbd, 0x1f,
+0xf4, 0x01, 0x71, 0x90, 0x01, 0x92, 0x03, 0xe2, 0x42, 0xe5, 0x18, 0xf0, 0x02, 0x09, 0xf2, 0x03,
+0x8e, 0x04, 0x88, 0x51, 0xf3, 0x01, 0xe2, 0x04, 0xe9, 0x05, 0x90, 0x01, 0x98, 0x0a, 0xe8, 0x41,
+0x96, 0x11, 0xd6, 0x06, 0x9e, 0x02, 0xe2, 0x02, 0xda, 0x04, 0xde, 0x57, 0x8e, 0x27, 0xdc, 0x05,
+0xb7, 0x03, 0x8e, 0x07, 0xc8, 0x04, 0xde, 0x57, 0xa6, 0x4c, 0xcf, 0x07, 0x2f, 0xd6, 0x03, 0xa6,
+0x06, 0xb0, 0x5f, 0x82, 0x52, 0xa7, 0x0e, 0x4b, 0xc2, 0x03, 0xf4, 0x02, 0xe8, 0x41, 0x96, 0x3a,
+0xd9, 0x1a, 0x56, 0xb6, 0x01, 0xca, 0x01, 0x92, 0x64, 0x90, 0x3b, 0xbb, 0x1f, 0x82, 0x02, 0xa8,
+0x02, 0x6a, 0xee, 0x69, 0xa6, 0x23, 0xaf, 0x21, 0xec, 0x02, 0xde, 0x01, 0x7d, 0x9a, 0x77, 0xa6,
+0x0e, 0xb5, 0x20, 0xfa, 0x01, 0x98, 0x01, 0xf7, 0x01, 0xe6, 0x56, 0xd6, 0x06, 0xd7, 0x06, 0xc8,
+0x01, 0xe5, 0x01, 0x5f, 0xd0, 0x6e, 0xf3, 0x01, 0x00, 0x30, 0xc1, 0x03, 0xe1, 0x02, 0x9e, 0x62,
+0xed, 0x02, 0x79, 0x25, 0xad, 0x06, 0xfb, 0x03, 0xec, 0x40, 0xf3, 0x01, 0xd5, 0x06, 0xb5, 0x01,
+0xb1, 0x05, 0x85, 0x01, 0x80, 0x3e, 0xc3, 0x09, 0xa3, 0x23, 0x12, 0x99, 0x06, 0xa1, 0x04, 0xd8,
+0x2f, 0xad, 0x0d, 0x93, 0x26, 0xe4, 0x0a, 0xb1, 0x02, 0xad, 0x06, 0xdc, 0x2e, 0xbb, 0x1f, 0xc6,
+0x09, 0xa0, 0x0d, 0xb6, 0x06, 0xef, 0x0c, 0xba, 0x34, 0xa3, 0x23, 0xda, 0x1a, 0xa9, 0x0d, 0xb1,
+0x0d, 0xde, 0x01, 0xc6, 0x09, 0xd1, 0x07, 0xfa, 0x29, 0x90, 0x01, 0xd1, 0x01, 0x99, 0x01, 0xe7,
+0x03, 0x87, 0x13, 0xc6, 0x09, 0xfd, 0x05, 0xfb, 0x03, 0xab, 0x04, 0x9f, 0x24, 0x95, 0x11, 0xd1,
+0x07, 0x7b, 0xcd, 0x05, 0x00, 0xfd, 0x3d, 0xb7, 0x0b, 0xc9, 0x08, 0x7c, 0x81, 0x05, 0xab, 0x01,
+0xab, 0x4b, 0xb9, 0x0b, 0xe1, 0x04, 0x8b, 0x05, 0xa5, 0x03, 0x0a, 0x8f, 0x3b, 0xd6, 0x06, 0xb9,
+0x0b, 0x00, 0x4e, 0x55, 0xe7, 0x41, 0xa8, 0x0e, 0xfb, 0x14, 0xad, 0x03, 0x86, 0x01, 0x08, 0xe9,
+0x2c, 0xd4, 0x1b, 0x89, 0x13, 0xb2, 0x02, 0x9c, 0x03, 0x2f, 0xbf, 0x33, 0x8e, 0x27, 0x8f, 0x12,
+0xa1, 0x01, 0xf6, 0x02, 0xa4, 0x01, 0xbf, 0x33, 0xf2, 0x3f, 0xd5, 0x06, 0x72, 0xc8, 0x04, 0xf6,
+0x02, 0xa9, 0x22, 0xe4, 0x2d, 0xdc, 0x05, 0xb0, 0x03, 0xb2, 0x02, 0xd2, 0x01, 0xd3, 0x1b, 0xa2,
+0x38, 0x8a, 0x13, 0xd3, 0x01, 0xf8, 0x01, 0xdc, 0x01, 0xbb, 0x1f, 0x90, 0x3b, 0x94, 0x11, 0x7e,
+0xc0, 0x04, 0x80, 0x03, 0xc5, 0x09, 0xa6, 0x23, 0xb4, 0x0c, 0x4d, 0x8c, 0x02, 0xac, 0x01, 0xe7,
+0x03, 0xbc, 0x1f, 0xee, 0x02, 0x5f, 0x98, 0x04, 0xce, 0x02, 0xb4, 0x0c, 0xf2, 0x16, 0xdb, 0x05,
+0x30, 0xec, 0x02, 0xec, 0x02, 0xa4, 0x23, 0x8e, 0x12, 0xf3, 0x01, 0x30, 0x88, 0x03, 0x7e, 0x8a,
+0x3c, 0xde, 0x05, 0x79, 0x00, 0xb6, 0x01, 0x25, 0x92, 0x3b, 0x79, 0xf4, 0x01, 0x74, 0x6a, 0xbf,
+0x01, 0x88, 0x51, 0xdd, 0x05, 0xe2, 0x04, 0x08, 0x25, 0x12, 0xce, 0x45, 0xcf, 0x07, 0xbd, 0x0a,
+0x11, 0x5f, 0x9d, 0x02, 0xf6, 0x2a, 0x00, 0xad, 0x0d, 0x56, 0x7b, 0x8f, 0x01, 0x8e, 0x27, 0xdb,
+0x05, 0x9b, 0x10, 0x09, 0x89, 0x03, 0xb1, 0x02, 0xd4, 0x1b, 0x00, 0xb7, 0x0b, 0x26, 0xfb, 0x03,
+0xff, 0x02, 0xca, 0x08, 0xf3, 0x01, 0xc3, 0x09, 0x4e, 0x9d, 0x02, 0xa1, 0x01, 0x7a, 0xd5, 0x06,
+0xcb, 0x08, 0x69, 0xdf, 0x03, 0x73, 0xc9, 0x08, 0xc5, 0x09, 0x79, 0x7b, 0x83, 0x04, 0xc7, 0x01,
+0xa1, 0x0f, 0xc3, 0x09, 0x00, 0x5f, 0xff, 0x02, 0xcf, 0x02, 0xc7, 0x1d, 0xad, 0x0d, 0x00, 0x1b,
+0xc5, 0x02, 0x1b, 0xc7, 0x1d, 0xcf, 0x07, 0xe8, 0x03, 0x56, 0x2f, 0x1d, 0xfb, 0x29, 0xe1, 0x04,
+0xcc, 0x08, 0x98, 0x01, 0x0a, 0x60, 0xff, 0x28, 0xd0, 0x07, 0xac, 0x0d, 0x39, 0x09, 0x7b, 0x99,
+0x25, 0xdc, 0x05, 0xc0, 0x0a, 0x0a, 0x11, 0x73, 0xdd, 0x2e, 0xe4, 0x04, 0xb2, 0x0c, 0xa4, 0x01,
+0xd2, 0x01, 0xe6, 0x01, 0x97, 0x25, 0xe2, 0x04, 0xa2, 0x0f, 0x42, 0x00, 0x00, 0xf5, 0x2a, 0xee,
+0x02, 0x8e, 0x12, 0x7b, 0xdc, 0x01, 0x07, 0x87, 0x13, 0xd5, 0x06, 0xd8, 0x06, 0xab, 0x01, 0xbc,
+0x02, 0x73, 0xbf, 0x0a, 0x8f, 0x12, 0xac, 0x0d, 0x2f, 0xda, 0x02, 0x1b, 0xdb, 0x05, 0xa1, 0x0f,
+0xcc, 0x08, 0x30, 0x60, 0x1c, 0xee, 0x02, 0xbd, 0x0a, 0xca, 0x08, 0x38, 0xd2, 0x01, 0x00, 0xd6,
+0x06, 0xd5, 0x06, 0xca, 0x08, 0x00, 0x9a, 0x01, 0x26, 0xee, 0x02, 0xe2, 0x04, 0xe2, 0x04, 0x1b,
+0x26, 0xda, 0x02, 0xf0, 0x02, 0xb2, 0x0c, 0xba, 0x0b, 0x5f, 0x60, 0x30, 0xf4, 0x01, 0x90, 0x12,
+0xca, 0x08, 0x67, 0x68, 0xec, 0x02, 0xe2, 0x04, 0xa2, 0x0f, 0x7a, 0x09, 0xe6, 0x01, 0xee, 0x01,
+0xa0, 0x0f, 0xfc, 0x14, 0xe1, 0x04, 0x1d, 0xf0, 0x01, 0x8c, 0x02, 0xca, 0x1d, 0xa2, 0x0f, 0xe1,
+0x04, 0x58, 0xd8, 0x02, 0x7e, 0x88, 0x13, 0xbe, 0x0a, 0xe1, 0x04, 0x43, 0x07, 0xbe, 0x01, 0xd4,
+0x1b, 0xa8, 0x0e, 0xa1, 0x0f, 0x72, 0xa2, 0x01, 0xa4, 0x01, 0xa2, 0x0f, 0xe2, 0x04, 0xab, 0x0d,
+0x0a, 0x39, 0x56, 0xfe, 0x14, 0xae, 0x0d, 0xf7, 0x15, 0xd4, 0x01, 0x30, 0x2f, 0xf2, 0x16, 0xdc,
+0x05, 0xe5, 0x18, 0x5e, 0x97, 0x01, 0xa1, 0x01, 0x94, 0x11, 0xbe, 0x0a, 0xfd, 0x14, 0x6a, 0xad,
+0x01, 0x43, 0xe6, 0x18, 0xc0, 0x0a, 0x95, 0x11, 0x11, 0x11, 0x91, 0x03, 0x9c, 0x10, 0xd6, 0x06,
+0xa5, 0x0e, 0x13, 0xc9, 0x01, 0x69, 0x84, 0x14, 0xed, 0x02, 0xd1, 0x07, 0x5f, 0xd3, 0x03, 0x41,
+0xf4, 0x01, 0xd5, 0x06, 0xe1, 0x04, 0x39, 0xdf, 0x03, 0x83, 0x02, 0xd7, 0x06, 0x79, 0x00, 0x00,
+0xb1, 0x02, 0x97, 0x01, 0xdf, 0x19, 0xca, 0x08, 0x7a, 0xb5, 0x01, 0xdd, 0x03, 0x26, 0x81, 0x14,
+0xe2, 0x04, 0x00, 0x3a, 0xb3, 0x02, 0x39, 0xb7, 0x20, 0xba, 0x0b, 0xd8, 0x06, 0x7b, 0x55, 0xe5,
+0x01, 0xe5, 0x18, 0xb2, 0x0c, 0xf4, 0x01, 0x4b, 0x44, 0x30, 0xfb, 0x14, 0xb2, 0x0c, 0x7a, 0x12,
+0x7c, 0x71, 0xb7, 0x20, 0xe0, 0x19, 0xe9, 0x03, 0x97, 0x01, 0xec, 0x02, 0x1c, 0x87, 0x13, 0x90,
+0x12, 0xc3, 0x09, 0x86, 0x01, 0xa0, 0x02, 0x1e, 0x9b, 0x10, 0xf8, 0x15, 0x95, 0x11, 0x7c, 0x84,
+0x04, 0x5f, 0x79, 0x8a, 0x13, 0xbd, 0x0a, 0x86, 0x01, 0x96, 0x02, 0x56, 0xd6, 0x06, 0xf2, 0x16,
+0xe1, 0x04, 0xac, 0x01, 0x82, 0x02, 0x90, 0x01, 0xae, 0x0d, 0xf2, 0x16, 0xc9, 0x08, 0x30, 0x96,
+0x02, 0xee, 0x01, 0xf8, 0x15, 0xd4, 0x1b, 0xdc, 0x05, 0x1b, 0x7c, 0xf0, 0x01, 0xb8, 0x0b, 0x8e,
+0x12, 0xf3, 0x01, 0x5f, 0xa4, 0x01, 0x86, 0x01, 0x96, 0x11, 0xa0, 0x24, 0xbf, 0x0a, 0x83, 0x02,
+0xc2, 0x03, 0x4b, 0xe0, 0x19, 0xb0, 0x21, 0xcf, 0x07, 0x7b, 0x4c, 0xc0, 0x01, 0xc8, 0x1d, 0xde,
+0x2e, 0xa1, 0x0f, 0x8f, 0x01, 0xe6, 0x01, 0x88, 0x03, 0xc2, 0x1e, 0xf6, 0x2a, 0xb1, 0x0c, 0x11,
+0xc7, 0x01, 0x7c, 0x96, 0x11, 0xfa, 0x29, 0xc9, 0x08, 0x4c, 0x5f, 0x60, 0xc4, 0x09, 0xa8, 0x37,
+0xcb, 0x08, 0x44, 0xab, 0x01, 0xc9, 0x01, 0xee, 0x02, 0xcc, 0x31, 0xbd, 0x0a, 0x1d, 0x95, 0x02,
+0xb5, 0x01, 0xb1, 0x0c, 0xf6, 0x2a, 0xb9, 0x0b, 0x3a, 0xc9, 0x01, 0x00, 0xad, 0x0d, 0xba, 0x34,
+0xb7, 0x0b, 0x44, 0xcf, 0x02, 0xb6, 0x01, 0xa5, 0x0e, 0x8c, 0x27, 0xcf, 0x07, 0xef, 0x01, 0xa7,
+0x02, 0x07, 0xdd, 0x05, 0xc4, 0x1e, 0xd6, 0x06, 0x00, 0x41, 0x09, 0x00, 0xc8, 0x1d, 0xfe, 0x14,
+0x7c, 0xa5, 0x03, 0xe7, 0x03, 0xdf, 0x19, 0xa6, 0x0e, 0x9a, 0x10, 0xb2, 0x02, 0x1d, 0x9b, 0x03,
+0xa5, 0x0e, 0xc9, 0x08, 0xd8, 0x06, 0x44, 0x88, 0x01, 0xef, 0x01, 0xcf, 0x07, 0xb7, 0x0b, 0xd0,
+0x07, 0x8e, 0x04, 0xab, 0x04, 0xa1, 0x04, 0xef, 0x2b, 0xad, 0x0d, 0xe7, 0x03, 0xd4, 0x01, 0x4c,
+0x3a, 0xa9, 0x22, 0x00, 0xa7, 0x0e, 0xdb, 0x04, 0x5f, 0xcc, 0x03, 0xa1, 0x0f, 0xde, 0x2e, 0x8a,
+0x13, 0xd7, 0x05, 0x44, 0x84, 0x04, 0xad, 0x0d, 0xaa, 0x22, 0xf2, 0x16, 0xf1, 0x03, 0xe6, 0x01,
+0x96, 0x02, 0xe9, 0x17, 0xc0, 0x33, 0xd4, 0x1b, 0x98, 0x04, 0x08, 0x8b, 0x02, 0xc9, 0x1d, 0xa8,
+0x37, 0xee, 0x02, 0x80, 0x03, 0xec, 0x02, 0x71, 0xb7, 0x0b, 0x9a, 0x4e, 0xf3, 0x01, 0xe6, 0x01,
+0xfa, 0x01, 0x30, 0xee, 0x02, 0xae, 0x36, 0x79, 0xf9, 0x01, 0x30, 0x39, 0xd5, 0x06, 0xd6, 0x44,
+0xd0, 0x07, 0x4b, 0xf8, 0x01, 0x7c, 0xdc, 0x05, 0x80, 0x3e, 0xfe, 0x14, 0x8f, 0x04, 0x07, 0xcc,
+0x03, 0xd0, 0x07, 0xc0, 0x33, 0xb2, 0x0c, 0x30, 0x98, 0x04, 0xac, 0x01, 0xed, 0x02, 0xe4, 0x56,
+0xd2, 0x07, 0x91, 0x03, 0xa2, 0x04, 0x0a, 0xae, 0x0d, 0xd6, 0x6d, 0xc4, 0x09, 0xfe, 0x05, 0xe9,
+0x03, 0xbb, 0x02, 0xc1, 0x1e, 0x80, 0x3e, 0xfd, 0x14, 0x7e, 0xae, 0x01, 0xd8, 0x02, 0xad, 0x0d,
+0xf2, 0x3f, 0x91, 0x26, 0xef, 0x01, 0x8b, 0x02, 0x92, 0x03, 0xd1, 0x30, 0x8e, 0x50, 0x99, 0x25,
+0xb5, 0x01, 0xb6, 0x01, 0xf3, 0x02, 0x89, 0x13, 0xd8, 0x2f, 0x9d, 0x24, 0xf8, 0x01, 0xa1, 0x04,
+0xaa, 0x04, 0xd9, 0x1a, 0xc2, 0x1e, 0xad, 0x0d, 0xd3, 0x06, 0x1c, 0xcd, 0x02, 0x88, 0x28, 0xb0,
+0x5f, 0xa6, 0x23, 0xd1, 0x01, 0xa0, 0x02, 0xe2, 0x02, 0x96, 0x11, 0xfe, 0x3d, 0xea, 0x2c, 0xa4,
+0x09, 0xb7, 0x09, 0xc1, 0x03, 0xe9, 0x03, 0xda, 0x1a, 0xfc, 0x14, 0x39, 0xf0, 0x01, 0x09, 0xf3,
+0x01, 0x82, 0x29, 0xf2, 0x16, 0xea, 0x05, 0xf1, 0x03, 0xf0, 0x01, 0xc9, 0x08, 0xe1, 0x04, 0xe2,
+0x04, 0x85, 0x01, 0x55, 0xeb, 0x05, 0xc4, 0x09, 0xe1, 0x04, 0xb1, 0x0c, 0x00, 0x87, 0x03, 0x11,
+0xbd, 0x0a, 0xf6, 0x15, 0xf7, 0x15, 0x92, 0x03, 0x95, 0x02, 0xb5, 0x01, 0xad, 0x0d, 0x7a, 0xdb,
+0x05, 0x97, 0x04, 0xa2, 0x04, 0xef, 0x01, 0xb1, 0x0c, 0xf8, 0x15, 0x79, 0xaa, 0x02, 0xe9, 0x03,
+0xac, 0x01, 0xc9, 0x08, 0x9d, 0x24, 0xf1, 0x16, 0x83, 0x02, 0xb6, 0x04, 0xa1, 0x01, 0xa7, 0x0e,
+0xd7, 0x2f, 0xdb, 0x05, 0x7e, 0xcf, 0x02, 0x8c, 0x02, 0xe5, 0x18, 0xef, 0x2b, 0x8e, 0x12, 0x85,
+0x04, 0xb0, 0x03, 0xeb, 0x02, 0x9c, 0x10, 0x84, 0x14, 0xf0, 0x2b, 0xb5, 0x01, 0xa8, 0x02, 0xbb,
+0x02, 0xe1, 0x04, 0xe2, 0x04, 0xed, 0x02, 0xa6, 0x03, 0x84, 0x02, 0xdc, 0x04, 0xd0, 0x07, 0xc7,
+0x1d, 0x8f, 0x12, 0x95, 0x02, 0xd6, 0x05, 0x69, 0xd6, 0x06, 0xb6, 0x20, 0xf1, 0x16, 0xdb, 0x01,
+0x85, 0x01, 0xae, 0x06, 0xbd, 0x0a, 0xa2, 0x0f, 0xf3, 0x2a, 0x89, 0x03, 0xaa, 0x02, 0xb5, 0x01,
+0x79, 0x9e, 0x24, 0x83, 0x14, 0xaa, 0x02, 0xdd, 0x06, 0xa4, 0x06, 0x81, 0x29, 0xa6, 0x23, 0x9d,
+0x24, 0xbf, 0x01, 0x6a, 0x96, 0x02, 0x9b, 0x10, 0xba, 0x34, 0xad, 0x0d, 0xeb, 0x02, 0xb2, 0x02,
+0x44, 0xb1, 0x0c, 0xe0, 0x42, 0xc9, 0x08, 0x1e, 0x8e, 0x04, 0x92, 0x03, 0xd4, 0x1b, 0xde, 0x2e,
+0xca, 0x08, 0x88, 0x03, 0x85, 0x01, 0x00, 0xc3, 0x09, 0x8e, 0x27, 0x79, 0x81, 0x02, 0x9c, 0x03,
+0x25, 0xe6, 0x18, 0x94, 0x4f, 0xd5, 0x06, 0xc8, 0x01, 0xef, 0x01, 0x98, 0x04, 0xb3, 0x0c, 0xc0,
+0x33, 0xd0, 0x07, 0x98, 0x07, 0x99, 0x06, 0x96, 0x02, 0xbb, 0x1f, 0xcd, 0x1c, 0xba, 0x0b, 0xa3,
+0x09, 0xa2, 0x04, 0xd5, 0x03, 0xbe, 0x0a, 0xd7, 0x06, 0xea, 0x17, 0x8e, 0x04, 0xa7, 0x05, 0x99,
+0x09, 0x97, 0x25, 0xbb, 0x48, 0xd2, 0x07, 0xd1, 0x01, 0xce, 0x02, 0xd0, 0x07, 0xce, 0x1c, 0x95,
+0x11, 0xf8, 0x15, 0xa1, 0x01, 0xb8, 0x06, 0x87, 0x03, 0xd6, 0x44, 0xa4, 0x23, 0xa0, 0x0f, 0x96,
+0x02, 0xe1, 0x02, 0xa1, 0x01, 0xc8, 0x46, 0x81, 0x14, 0x8d, 0x12, 0xa2, 0x01, 0xa1, 0x01, 0xa7,
+0x05, 0x92, 0x3b, 0xd7, 0x06, 0xe8, 0x03, 0x97, 0x04, 0x8f, 0x04, 0xfc, 0x0b, 0xf4, 0x2a, 0xd8,
+0x06, 0xe3, 0x04, 0x9e, 0x08, 0xf7, 0x04, 0xad, 0x06, 0xad, 0x36, 0xc3, 0x47, 0xa9, 0x22, 0x87,
+0x06, 0xb2, 0x05, 0x8b, 0x05, 0x98, 0x3a, 0xbe, 0x0a, 0xb4, 0x0c, 0xa3, 0x01, 0xab, 0x0f, 0xd6,
+0x03, 0xf1, 0x16, 0xf2, 0x16, 0xdd, 0x05, 0x9c, 0x03, 0xd4, 0x0c, 0xc0, 0x01, 0xc2, 0x1e, 0xd2,
+0x30, 0xc9, 0x08, 0xe1, 0x02, 0xa9, 0x02, 0xd7, 0x05, 0xcd, 0x1c, 0xea, 0x2c, 0xe7, 0x03, 0xa6,
+0x03, 0xdb, 0x01, 0xac, 0x01, 0xa5, 0x23, 0xe0, 0x19, 0xbd, 0x0a, 0xdb, 0x01, 0xac, 0x04, 0xf7,
+0x04, 0xee, 0x02, 0xc8, 0x1d, 0xd0, 0x07, 0x38, 0x8f, 0x04, 0x09, 0xf3, 0x01, 0x96, 0x11, 0xb9,
+0x0b, 0xaa, 0x02, 0xb4, 0x02, 0xed, 0x04, 0x90, 0x12, 0xda, 0x1a, 0xdf, 0x19, 0x9e, 0x02, 0x56,
+0xf4, 0x02, 0x95, 0x3a, 0xfb, 0x29, 0xf3, 0x2a, 0x37, 0xaf, 0x03, 0xd0, 0x05, 0xd5, 0x06, 0xc9,
+0x08, 0xeb, 0x17, 0xad, 0x01, 0x83, 0x04, 0xbe, 0x01, 0xc5, 0x09, 0xd0, 0x30, 0x99, 0x25, 0xbd,
+0x01, 0xf0, 0x06, 0x28, 0xf3, 0x01, 0xa0, 0x24, 0xb5, 0x20, 0xb9, 0x08, 0x9a, 0x01, 0xf0, 0x06,
+0xb4, 0x0c, 0xe4, 0x2d, 0x00, 0xb8, 0x03, 0x9d, 0x05, 0x55, 0xf7, 0x15, 0xa6, 0x0e, 0xb1, 0x0c,
+0xe1, 0x02, 0xe0, 0x08, 0xeb, 0x02, 0xfc, 0x52, 0xdc, 0x43, 0xb2, 0x0c, 0xb3, 0x07, 0x81, 0x02,
+0xdd, 0x03, 0xd6, 0x06, 0x90, 0x3b, 0xb1, 0x0c, 0x9a, 0x11, 0xc5, 0x05, 0xa6, 0x08, 0xb3, 0x35,
+0xf1, 0x3f, 0xf1, 0x16, 0x9f, 0x0d, 0xb2, 0x05, 0x9a, 0x01, 0xd9, 0x1a, 0xac, 0x0d, 0xd3, 0x1b,
+0x25, 0x8c, 0x05, 0xce, 0x02, 0xde, 0x2e, 0xec, 0x17, 0xdd, 0x05, 0x83, 0x04, 0xe6, 0x01, 0xed,
+0x01, 0xda, 0x1a, 0x83, 0x14, 0x79, 0xa1, 0x04, 0xf9, 0x09, 0xf7, 0x04, 0x8f, 0x12, 0xcc, 0x31,
+0xde, 0x05, 0x98, 0x01, 0xaa, 0x0a, 0x86, 0x06, 0xb9, 0x34, 0x82, 0x52, 0x88, 0x13, 0xa6, 0x0e,
+0xa5, 0x06, 0xa2, 0x07, 0xcb, 0x31, 0x94, 0x26, 0xb4, 0x0c, 0xfd, 0x08, 0x90, 0x04, 0xd1, 0x0f,
+0xbd, 0x0a, 0xdc, 0x43, 0x90, 0x12, 0xd6, 0x03, 0x7d, 0x90, 0x04, 0xca, 0x08, 0xe9, 0x03, 0xbe,
+0x0a, 0xcb, 0x0b, 0x7b, 0xd7, 0x08, 0xa6, 0x4c, 0xdb, 0x05, 0xe1, 0x04, 0x9a, 0x09, 0xa1, 0x01,
+0xc4, 0x08, 0xa8, 0x0e, 0xe8, 0x03, 0xb1, 0x21, 0xdb, 0x04, 0xee, 0x04, 0xbd, 0x07, 0xf8, 0x3e,
+0xd8, 0x2f, 0xb7, 0x0b, 0xe8, 0x06, 0x81, 0x05, 0xfa, 0x09, 0xb9, 0x5d, 0xe4, 0x2d, 0xee, 0x02,
+0x73, 0x84, 0x07, 0x7b, 0xe6, 0x41, 0xca, 0x08, 0x8a, 0x13, 0x00, 0x9b, 0x03, 0xd9, 0x0d, 0xd3,
+0x1b, 0xce, 0x5a, 0x90, 0x12, 0xdf, 0x05, 0xb2, 0x08, 0xcc, 0x03, 0x9c, 0x10, 0x94, 0x11, 0xe6,
+0x18, 0xce, 0x10, 0xeb, 0x0d, 0xde, 0x09, 0xa7, 0x0e, 0xb3, 0x9c, 0x01, 0xc5, 0x09, 0x69, 0xfa,
+0x06, 0xc3, 0x0b, 0xa4, 0x23, 0xe7, 0x2c, 0x83, 0x14, 0xa5, 0x03, 0x83, 0x07, 0xfc, 0x06, 0xe7,
+0x03, 0xf1, 0x16, 0xd3, 0x1b, 0x8a, 0x03, 0xd2, 0x01, 0x84, 0x04, 0xdb, 0x2e, 0xe1, 0x04, 0xaf,
+0x21, 0xa5, 0x06, 0xdb, 0x01, 0xe3, 0x07, 0xb3, 0x0c, 0xd0, 0x07, 0xdf, 0x19, 0xd3, 0x03, 0x25,
+0xa1, 0x04, 0xb4, 0x0c, 0xf2, 0x16, 0xec, 0x17, 0xdb, 0x01, 0xc9, 0x09, 0xc2, 0x03, 0x8e, 0x12,
+0xd2, 0x30, 0xdc, 0x05, 0x81, 0x05, 0xa0, 0x02, 0xa7, 0x02, 0xaf, 0x21, 0x92, 0x26, 0xf4, 0x01,
+0xee, 0x0c, 0xb7, 0x09, 0xc4, 0x1b, 0xcb, 0x31, 0x95, 0x3a, 0xb5, 0x20, 0xab, 0x0c, 0x80, 0x0b,
+0xe5, 0x1f, 0xa1, 0x0f, 0xb2, 0x73, 0xcd, 0x1c, 0xcc, 0x06, 0x5d, 0xca, 0x09, 0xca, 0x1d, 0xeb,
+0x17, 0xc5, 0x32, 0xc3, 0x0b, 0xf4, 0x05, 0xa5, 0x03, 0xf4, 0x2a, 0xb2, 0x21, 0xd3, 0x1b, 0xb1,
+0x05, 0xc7, 0x04, 0xd0, 0x0d, 0xb5, 0x20, 0xb8, 0x49, 0xad, 0x0d, 0x9a, 0x09, 0xef, 0x04, 0x25,
+0x92, 0x26, 0xe2, 0x2d, 0xb7, 0x0b, 0x8d, 0x04, 0xcc, 0x06, 0x85, 0x0f, 0xd2, 0x30, 0xde, 0x6c,
+0xe8, 0x03, 0x81, 0x05, 0x98, 0x04, 0xdc, 0x04, 0xc6, 0x32, 0x8e, 0x12, 0x90, 0x12, 0xe6, 0x01,
+0xf1, 0x03, 0xa0, 0x0a, 0x93, 0x11, 0xd8, 0x06, 0xe1, 0x04, 0xfc, 0x03, 0xff, 0x07, 0xb5, 0x0f,
+0xb9, 0x34, 0x92, 0x26, 0xe9, 0x03, 0x85, 0x01, 0xe2, 0x0d, 0xc0, 0x01, 0xe3, 0x2d, 0xc2, 0x1e,
+0xec, 0x17, 0xac, 0x0c, 0xcf, 0x02, 0xb8, 0x11, 0x94, 0x11, 0x95, 0x3a, 0xe5, 0x18, 0xeb, 0x0d,
+0xe6, 0x04, 0xdb, 0x17, 0xdf, 0x19, 0x90, 0x3b, 0xac, 0x22, 0xa0, 0x02, 0xec, 0x02, 0x25, 0xe9,
+0x17, 0xd6, 0x06, 0xe2, 0x2d, 0x9e, 0x08, 0xdf, 0x03, 0xb8, 0x06, 0xcb, 0x31, 0xc7, 0x46, 0xf6,
+0x2a, 0xe8, 0x0b, 0xdc, 0x0c, 0xe4, 0x0c, 0xb4, 0x5e, 0xb1, 0x4a, 0xe6, 0x18, 0xc5, 0x0a, 0xcf,
+0x07, 0xe1, 0x15, 0xc0, 0x0a, 0xb5, 0x20, 0xf6, 0x2a, 0x86, 0x0c, 0xf2, 0x03, 0xfe, 0x10, 0x00,
+0x81, 0x29, 0xc0, 0x33, 0xf2, 0x03, 0x90, 0x01, 0x30, 0xce, 0x1c, 0xb5, 0x5e, 0xa4, 0x23, 0xb5,
+0x04, 0xe2, 0x02, 0xd3, 0x01, 0xe6, 0x18, 0xdb, 0x2e, 0xe4, 0x2d, 0xcd, 0x02, 0xe7, 0x09, 0x89,
+0x05, 0x95, 0x11, 0xff, 0x66, 0xe0, 0x19, 0xbb, 0x02, 0xf3, 0x02, 0xc3, 0x05, 0xbc, 0x1f, 0xdf,
+0x19, 0xf0, 0x2b, 0xe1, 0x02, 0xc7, 0x07, 0x98, 0x09, 0xd2, 0x30, 0x8c, 0x27, 0xc4, 0x09, 0xdd,
+0x01, 0x8d, 0x04, 0xa9, 0x07, 0x9c, 0x10, 0xea, 0x55, 0xa2, 0x0f, 0xaf, 0x05, 0xe5, 0x0f, 0xa6,
+0x03, 0x8d, 0x50, 0xb5, 0x49, 0x99, 0x25, 0xc5, 0x02, 0x0a, 0x39, 0x8f, 0x12, 0xe3, 0x2d, 0xd1,
+0x30, 0xbb, 0x02, 0xe0, 0x08, 0x85, 0x09, 0xfe, 0x14, 0xe6, 0x18, 0xd9, 0x1a, 0xa9, 0x02, 0xda,
+0x02, 0xd0, 0x0a, 0xfa, 0x29, 0xf7, 0x15, 0x85, 0x28, 0xfa, 0x01, 0xb3, 0x0a, 0x89, 0x03, 0xdb,
+0x2e, 0xac, 0x0d, 0x8d, 0x27, 0x91, 0x03, 0xba, 0x08, 0x99, 0x03, 0xa0, 0x0f, 0xe6, 0x18, 0x95,
+0x11, 0x98, 0x01, 0x55, 0x42, 0xfd, 0x14, 0x90, 0x12, 0xe9, 0x17, 0xd1, 0x01, 0xfa, 0x01, 0xa6,
+0x03, 0xae, 0x0d, 0x88, 0x28, 0xc3, 0x1e, 0x4b, 0xa6, 0x08, 0xe7, 0x06, 0xb8, 0x0b, 0xbe, 0x0a,
+0x00, 0x9b, 0x03, 0x25, 0x72, 0xef, 0x16, 0xb0, 0x21, 0x93, 0x11, 0xc0, 0x06, 0xd0, 0x0d, 0xb4,
+0x02, 0x8c, 0x27, 0x9b, 0x62, 0xf3, 0x01, 0xc0, 0x01, 0xcf, 0x0d, 0x43, 0xf5, 0x2a, 0xa7, 0x0e,
+0x89, 0x13, 0xf9, 0x06, 0x90, 0x0c, 0x14, 0xd8, 0x2f, 0xfc, 0x29, 0xbe, 0x0a, 0xff, 0x02, 0xfb,
+0x06, 0xc1, 0x06, 0xfd, 0x14, 0xef, 0x02, 0xa8, 0x0e, 0x8d, 0x01, 0x8b, 0x02, 0x94, 0x10, 0xf5,
+0x53, 0xdb, 0x05, 0xbf, 0x0a, 0xdb, 0x04, 0xe0, 0x0b, 0xb6, 0x04, 0xff, 0x28, 0xcc, 0x31, 0xca,
+0x1d, 0x86, 0x01, 0x6a, 0xc3, 0x08, 0xc2, 0x1e, 0xaf, 0x21, 0xe8, 0x2c, 0x3a, 0xa7, 0x05, 0xb8,
+0x03, 0xf3, 0x3f, 0xed, 0x40, 0xec, 0x17, 0xec, 0x02, 0xc0, 0x0c, 0xf2, 0x03, 0xa0, 0x24, 0xcd,
+0x45, 0xd8, 0x2f, 0xf4, 0x02, 0xc3, 0x03, 0x95, 0x0a, 0xb8, 0x0b, 0xf1, 0x54, 0xc0, 0x33, 0x55,
+0x4e, 0xa8, 0x05, 0xe1, 0x04, 0x79, 0x9a, 0x25, 0xd7, 0x02, 0xed, 0x04, 0xc4, 0x08, 0xe1, 0x04,
+0x9f, 0x0f, 0xc4, 0x32, 0xc8, 0x07, 0x12, 0x9d, 0x05, 0xc8, 0x1d, 0xff, 0x3d, 0x94, 0x26, 0xc6,
+0x07, 0xc5, 0x02, 0x5f, 0xf6, 0x53, 0xdf, 0x42, 0xd4, 0x1b, 0xf6, 0x02, 0x99, 0x09, 0xb1, 0x05,
+0xce, 0x1c, 0xb9, 0x34, 0x00, 0x4b, 0xe1, 0x02, 0xb8, 0x03, 0xf2, 0x16, 0xd0, 0x07, 0xe2, 0x04,
+0xda, 0x04, 0xf9, 0x06, 0x30, 0x95, 0x11, 0x83, 0x14, 0xf3, 0x01, 0xfa, 0x01, 0xc1, 0x03, 0x7b,
+0xe9, 0x17, 0xe2, 0x04, 0xed, 0x02, 0x68, 0x1d, 0x3a, 0x8e, 0x12, 0xb1, 0x0c, 0xc4, 0x09, 0x1b,
+0xc0, 0x01, 0x9d, 0x08, 0x88, 0x28, 0xe1, 0x04, 0xe4, 0x04, 0xd8, 0x05, 0x2f, 0xb1, 0x02, 0xfc,
+0x52, 0xd5, 0x44, 0xe3, 0x04, 0x6a, 0xf9, 0x06, 0x98, 0x01, 0xef, 0x2b, 0x9f, 0x4d, 0xd9, 0x1a,
+0xc8, 0x01, 0xa0, 0x07, 0xe0, 0x03, 0x9f, 0x0f, 0xcb, 0x31, 0xd5, 0x06, 0xd7, 0x05, 0xe0, 0x03,
+0x81, 0x05, 0xe8, 0x03, 0x89, 0x13, 0xe8, 0x03, 0xe7, 0x0b, 0xba, 0x05, 0xf7, 0x04, 0xe7, 0x03,
+0xfe, 0x14, 0xd8, 0x06, 0x7c, 0xed, 0x01, 0xd6, 0x0b, 0x88, 0x13, 0xf5, 0x53, 0xf5, 0x01, 0x30,
+0xdd, 0x01, 0x91, 0x06, 0xdf, 0x19, 0xfb, 0x29, 0xef, 0x16, 0x8b, 0x05, 0xe2, 0x05, 0x8e, 0x07,
+0xf2, 0x16, 0xbb, 0x1f, 0xf4, 0x01, 0xe5, 0x01, 0x74, 0xdf, 0x0b, 0x90, 0x12, 0xc1, 0x1e, 0xca,
+0x08, 0x91, 0x03, 0x7d, 0xb6, 0x04, 0x83, 0x14, 0xaf, 0x21, 0xad, 0x0d, 0xd9, 0x04, 0xf2, 0x06,
+0x86, 0x04, 0xa5, 0x0e, 0xb9, 0x0b, 0xf3, 0x01, 0x99, 0x01, 0x96, 0x02, 0x95, 0x02, 0xa1, 0x0f,
+0xaf, 0x21, 0x7a, 0x9f, 0x02, 0xf8, 0x01, 0xf9, 0x01, 0x89, 0x13, 0xfb, 0x29, 0x79, 0x81, 0x02,
+0xc7, 0x01, 0xae, 0x06, 0xea, 0x03, 0xa3, 0x23, 0xe7, 0x03, 0x25, 0xe1, 0x02, 0xe1, 0x02, 0xb9,
+0x0b, 0x8d, 0x27, 0xf7, 0x15, 0x82, 0x02, 0xee, 0x01, 0x55, 0x7a, 0x9d, 0x24, 0xe4, 0x04, 0xbc,
+0x05, 0xad, 0x03, 0x85, 0x01, 0x00, 0xe7, 0x41, 0xe2, 0x04, 0xa4, 0x03, 0x69, 0x99, 0x01, 0xe0,
+0x19, 0x83, 0x3d, 0x8f, 0x12, 0x96, 0x02, 0x71, 0x85, 0x01, 0xc0, 0x33, 0xb9, 0x34, 0xfd, 0x14,
+0x96, 0x02, 0xf1, 0x03, 0xe6, 0x01, 0xfa, 0x67, 0xbd, 0x48, 0x91, 0x26, 0xe2, 0x05, 0xc7, 0x04,
+0xf7, 0x01, 0xce, 0x5a, 0xd9, 0x81, 0x01, 0xc1, 0x1e, 0xf6, 0x02, 0x8d, 0x02, 0xb8, 0x06, 0x88,
+0x13, 0xb7, 0x49, 0xa7, 0x0e, 0x72, 0x8a, 0x03, 0xa4, 0x06, 0x79, 0x83, 0x3d, 0x8a, 0x13, 0xf8,
+0x04, 0xbe, 0x04, 0xc5, 0x02, 0xb7, 0x0b, 0xe3, 0x56, 0xa4, 0x23, 0xc8, 0x04, 0xa2, 0x04, 0x88,
+0x03, 0xcf, 0x07, 0x95, 0x78, 0x8a, 0x3c, 0xce, 0x05, 0xa0, 0x02, 0xc6, 0x02, 0x00, 0xa1, 0x9f,
+0x01, 0xee, 0x40, 0x86, 0x04, 0x83, 0x02, 0x5f, 0xf3, 0x01, 0xcb, 0x6f, 0xd2, 0x30, 0x09, 0x37,
+0x4b, 0xe2, 0x04, 0xcf, 0x97, 0x01, 0x96, 0x3a, 0xd7, 0x02, 0x00, 0x09, 0xc4, 0x09, 0xc5, 0x70,
+0xe4, 0x2d, 0xa3, 0x01, 0x4d, 0x83, 0x04, 0xa8, 0x0e, 0xff, 0x8f, 0x01, 0xd2, 0x30, 0xe1, 0x02,
+0x44, 0x09, 0xac, 0x0d, 0x8d, 0x8e, 0x01, 0xf4, 0x2a, 0xb1, 0x02, 0x42, 0xd3, 0x01, 0xd6, 0x06,
+0xed, 0x69, 0xc4, 0x1e, 0x87, 0x03, 0x44, 0xd1, 0x01, 0xd2, 0x07, 0xb5, 0x87, 0x01, 0xc2, 0x1e,
+0xc5, 0x05, 0x7c, 0x8b, 0x02, 0x7a, 0xf7, 0x7c, 0x8e, 0x12, 0xed, 0x04, 0xac, 0x01, 0xbb, 0x02,
+0xee, 0x02, 0xeb, 0x55, 0xc6, 0x09, 0xf7, 0x01, 0x0a, 0x3a, 0xe8, 0x03, 0xdb, 0x6c, 0xdc, 0x05,
+0xcf, 0x02, 0xb5, 0x01, 0x95, 0x02, 0xf3, 0x01, 0x8b, 0x65, 0xe8, 0x03, 0xcf, 0x02, 0x67, 0x1d,
+0xcf, 0x07, 0xa5, 0x4c, 0xe7, 0x03, 0xd7, 0x02, 0xe5, 0x01, 0xdb, 0x01, 0xb9, 0x0b, 0xdd, 0x57,
+0xab, 0x0d, 0xb5, 0x04, 0xab, 0x04, 0xb1, 0x02, 0xe1, 0x04, 0x87, 0x51, 0xab, 0x22, 0xcd, 0x05,
+0xcb, 0x03, 0xeb, 0x02, 0xdc, 0x05, 0x93, 0x26, 0xa3, 0x23, 0xfb, 0x03, 0xd1, 0x01, 0x69, 0xba,
+0x0b, 0xdf, 0x19, 0xd7, 0x2f, 0x88, 0x01, 0x69, 0x55, 0xdc, 0x05, 0xb5, 0x20, 0xef, 0x2b, 0xee,
+0x04, 0x56, 0x8a, 0x03, 0xe1, 0x04, 0xb5, 0x20, 0xe5, 0x18, 0xf8, 0x04, 0xf0, 0x01, 0xb6, 0x01,
+0xe1, 0x04, 0x8b, 0x3c, 0xff, 0x28, 0xb8, 0x03, 0xac, 0x01, 0x26, 0xd7, 0x06, 0xdb, 0x2e, 0xfd,
+0x14, 0x92, 0x03, 0xa6, 0x03, 0x86, 0x01, 0xf3, 0x01, 0x97, 0x3a, 0xeb, 0x17, 0xb2, 0x05, 0xa8,
+0x02, 0x86, 0x01, 0xc0, 0x0a, 0x9f, 0x4d, 0x83, 0x14, 0x8c, 0x05, 0x8c, 0x02, 0x96, 0x02, 0xd6,
+0x06, 0xcd, 0x45, 0xe1, 0x04, 0xa2, 0x04, 0xc6, 0x02, 0xe6, 0x01, 0xf2, 0x16, 0xe1, 0x6b, 0x00,
+0xec, 0x02, 0xbc, 0x02, 0xdc, 0x01, 0xd4, 0x1b, 0xe5, 0x56, 0xe2, 0x04, 0x9e, 0x02, 0x44, 0xe6,
+0x01, 0x98, 0x25, 0x93, 0x78, 0xba, 0x0b, 0xe2, 0x02, 0xbc, 0x02, 0xa8, 0x02, 0xe4, 0x2d, 0xb1,
+0x88, 0x01, 0x8e, 0x12, 0x8a, 0x03, 0x7d, 0x2f, 0x8e, 0x27, 0xe3, 0x94, 0x01, 0xb2, 0x21, 0x72,
+0xfa, 0x01, 0xec, 0x02, 0xaa, 0x22, 0xcf, 0x6e, 0xb6, 0x20, 0xf7, 0x01, 0x69, 0xe5, 0x01, 0xfe,
+0x3d, 0xbb, 0x86, 0x01, 0xd8, 0x2f, 0xf5, 0x02, 0x95, 0x02, 0xa4, 0x01, 0xde, 0x2e, 0xfb, 0x90,
+0x01, 0xfe, 0x3d, 0xaf, 0x03, 0xf7, 0x01, 0xcf, 0x02, 0xba, 0x0b, 0xeb, 0x40, 0xc6, 0x09, 0xa1,
+0x04, 0x98, 0x04, 0x56, 0xbc, 0x1f, 0xc1, 0x5c, 0xe0, 0x42, 0x80, 0x06, 0xd3, 0x06, 0xcd, 0x05,
+0xb3, 0x35, 0x81, 0x52, 0xc0, 0x33, 0xa3, 0x09, 0xaf, 0x03, 0x44, 0xa7, 0x0e, 0x89, 0x3c, 0xb4,
+0x0c, 0xff, 0x02, 0x8b, 0x02, 0xd1, 0x04, 0xd5, 0x06, 0xc5, 0x32, 0xad, 0x0d, 0x87, 0x06, 0xf5,
+0x02, 0xd3, 0x01, 0xa1, 0x0f, 0x89, 0x13, 0x9d, 0x24, 0xc3, 0x05, 0xd9, 0x07, 0x8d, 0x07, 0xdb,
+0x2e, 0xa8, 0x0e, 0xdf, 0x19, 0xe1, 0x02, 0x60, 0xb2, 0x05, 0xf7, 0x15, 0x7b, 0x9b, 0x10, 0xde,
+0x03, 0x9f, 0x02, 0xc5, 0x02, 0x99, 0x25, 0x9b, 0x39, 0x97, 0x25, 0xb6, 0x01, 0x82, 0x05, 0x7e,
+0xe3, 0x2d, 0xc6, 0x09, 0xb1, 0x21, 0xc0, 0x01, 0xb0, 0x03, 0xe8, 0x03, 0xcd, 0x1c, 0x9f, 0x24,
+0xe5, 0x18, 0x72, 0xed, 0x04, 0xc1, 0x03, 0xcd, 0x1c, 0xff, 0x28, 0xf9, 0x29, 0x67, 0x8c, 0x02,
+0xb2, 0x05, 0x87, 0x13, 0x95, 0x11, 0xf3, 0x3f, 0x90, 0x01, 0x60, 0xc9, 0x01, 0xc4, 0x09, 0xd5,
+0x06, 0xed, 0x2b, 0xa4, 0x03, 0xf1, 0x03, 0xf9, 0x01, 0xfd, 0x14, 0xfd, 0x14, 0x97, 0x3a, 0xad,
+0x03, 0x39, 0xad, 0x03, 0x7a, 0xbe, 0x0a, 0xe7, 0x2c, 0x55, 0xf8, 0x01, 0x85, 0x01, 0xe8, 0x03,
+0x95, 0x3a, 0xc9, 0x46, 0x92, 0x03, 0xc6, 0x05, 0xbb, 0x02, 0xf0, 0x2b, 0xd1, 0x30, 0xfb, 0x29,
+0xf0, 0x01, 0xa9, 0x02, 0xd1, 0x01, 0xee, 0x02, 0xd1, 0x59, 0x91, 0x26, 0xd3, 0x01, 0xae, 0x09,
+0xf8, 0x04, 0xa6, 0x4c, 0xc9, 0x46, 0xcb, 0x08, 0x25, 0xc5, 0x05, 0x94, 0x02, 0xb1, 0x0c, 0xed,
+0x02, 0xc6, 0x09, 0xef, 0x01, 0x86, 0x07, 0xce, 0x0b, 0xdd, 0x05, 0xcf, 0x07, 0xcc, 0x31, 0xbd,
+0x01, 0x95, 0x02, 0xbe, 0x07, 0xd3, 0x1b, 0xbe, 0x0a, 0xb2, 0x4a, 0xf4, 0x02, 0xd6, 0x08, 0xa5,
+0x06, 0xc0, 0x33, 0xeb, 0x17, 0xda, 0x43, 0x4b, 0xc9, 0x06, 0xfa, 0x01, 0xf4, 0x01, 0x91, 0x64,
+0xf0, 0x2b, 0xd0, 0x02, 0xb4, 0x07, 0x99, 0x01, 0x84, 0x52, 0xcd, 0x83, 0x01, 0xc0, 0x33, 0xd8,
+0x02, 0xd9, 0x02, 0x87, 0x03, 0xe6, 0x41, 0xd3, 0x82, 0x01, 0xf2, 0x16, 0xf7, 0x01, 0x55, 0x8e,
+0x04, 0xfe, 0x14, 0xb7, 0x0b, 0xa4, 0x23, 0x4d, 0x90, 0x01, 0xa4, 0x0c, 0xc0, 0x33, 0x85, 0x3d,
+0xde, 0x2e, 0xd1, 0x04, 0xd9, 0x07, 0xf7, 0x0a, 0x84, 0x14, 0x95, 0x11, 0xce, 0x1c, 0xd1, 0x01,
+0x9c, 0x03, 0x93, 0x05, 0xe8, 0x2c, 0xaf, 0x21, 0xa4, 0x23, 0xe5, 0x01, 0xf3, 0x05, 0xa0, 0x02,
+0xdb, 0x05, 0xa7, 0x37, 0xf8, 0x15, 0x26, 0xa8, 0x02, 0x09, 0x96, 0x3a, 0xfd, 0x3d, 0x9c, 0x10,
+0x3a, 0x9d, 0x05, 0xb7, 0x03, 0xa5, 0x0e, 0xe7, 0x41, 0x95, 0x11, 0xf1, 0x03, 0x84, 0x04, 0x91,
+0x03, 0xb0, 0x21, 0xcf, 0x07, 0x9f, 0x0f, 0xc7, 0x04, 0xff, 0x0a, 0x9f, 0x02, 0xa9, 0x22, 0xf1,
+0x16, 0xf1, 0x16, 0x43, 0x28, 0x72, 0xb9, 0x34, 0xe2, 0x04, 0xa1, 0x0f, 0xe9, 0x05, 0x09, 0x07,
+0xa1, 0x0f, 0x9a, 0x4e, 0xbd, 0x0a, 0xe6, 0x01, 0x83, 0x07, 0xec, 0x02, 0x95, 0x3a, 0x96, 0x11,
+0x8f, 0x12, 0xcc, 0x03, 0xd2, 0x04, 0xef, 0x04, 0x9b, 0x10, 0xa0, 0x0f, 0xc7, 0x1d, 0x08, 0xbb,
+0x02, 0x1b, 0xf3, 0x68, 0xd2, 0x07, 0xaf, 0x21, 0xf2, 0x03, 0x27, 0xdc, 0x01, 0xa5, 0x4c, 0xc5,
+0x09, 0xad, 0x0d, 0xc0, 0x01, 0xf1, 0x03, 0xd3, 0x06, 0xb5, 0x20, 0xce, 0x1c, 0xb7, 0x0b, 0x26,
+0xaa, 0x0a, 0xf4, 0x05, 0xa3, 0x23, 0xe4, 0x2d, 0xc4, 0x09, 0xc0, 0x01, 0xcd, 0x02, 0xa4, 0x01,
+0xbb, 0x5d, 0x88, 0x28, 0xd6, 0x06, 0xec, 0x02, 0xb4, 0x04, 0x42, 0xfd, 0x14, 0x98, 0x25, 0x8a,
+0x13, 0xde, 0x03, 0x8d, 0x04, 0x85, 0x04, 0xa3, 0x23, 0x83, 0x14, 0xb4, 0x0c, 0x7e, 0xbc, 0x02,
+0xa8, 0x08, 0x9b, 0x10, 0x9b, 0x39, 0xa1, 0x0f, 0x5f, 0xe4, 0x04, 0xe7, 0x06, 0xc6, 0x09, 0xed,
+0x02, 0xb8, 0x0b, 0x5f, 0x44, 0x8c, 0x05, 0xf3, 0x01, 0xbd, 0x48, 0xa8, 0x0e, 0x26, 0x9c, 0x0b,
+0xce, 0x08, 0x9b, 0x10, 0xd1, 0x30, 0xec, 0x17, 0x1c, 0xca, 0x01, 0xcf, 0x05, 0x88, 0x51, 0x93,
+0x11, 0xfe, 0x3d, 0x93, 0x05, 0x2f, 0xf2, 0x06, 0xee, 0x40, 0xf7, 0x53, 0xb8, 0x20, 0xa0, 0x02,
+0xa1, 0x04, 0x92, 0x03, 0xaa, 0x4b, 0xc5, 0x5b, 0xda, 0x1a, 0x97, 0x07, 0xcb, 0x03, 0xed, 0x04,
+0x8e, 0x27, 0xc4, 0x09, 0x94, 0x11, 0x89, 0x08, 0xfc, 0x03, 0xec, 0x0a, 0xdc, 0x6c, 0x9a, 0x25,
+0xf8, 0x15, 0xee, 0x04, 0xef, 0x04, 0x9d, 0x05, 0xe6, 0x18, 0xe2, 0x04, 0xd5, 0x06, 0x44, 0xe5,
+0x09, 0xda, 0x07, 0xbc, 0x1f, 0xcf, 0x07, 0xcf, 0x07, 0xe6, 0x01, 0x09, 0xc5, 0x07, 0xfc, 0x29,
+0x86, 0x28, 0xd7, 0x06, 0x93, 0x03, 0xe5, 0x06, 0xc8, 0x04, 0xa2, 0x38, 0xa8, 0x0e, 0x99, 0x10,
+0xa0, 0x02, 0xa8, 0x02, 0xfb, 0x06, 0xd2, 0x30, 0xa4, 0x23, 0xe5, 0x18, 0x96, 0x02, 0xb9, 0x08,
+0x6a, 0xdf, 0x19, 0xc4, 0x09, 0x99, 0x25, 0xf1, 0x03, 0x1b, 0xaf, 0x0b, 0x88, 0x28, 0xda, 0x81,
+0x01, 0xa5, 0x0e, 0xe8, 0x03, 0xe8, 0x03, 0xc3, 0x05, 0xc7, 0x1d, 0xe6, 0x56, 0xe3, 0x04, 0xf4,
+0x05, 0xc8, 0x01, 0xa4, 0x06, 0xc3, 0x1e, 0xa6, 0x0e, 0x7c, 0xe4, 0x02, 0xc4, 0x0b, 0x00, 0xc1,
+0x1e, 0xde, 0x05, 0x98, 0x25, 0x00, 0x72, 0xd5, 0x08, 0xc3, 0x70, 0xfc, 0x14, 0xc6, 0x32, 0x60,
+0xc0, 0x04, 0xc0, 0x09, 0x83, 0x7b, 0xd5, 0x2f, 0xa8, 0x37, 0xea, 0x02, 0xb6, 0x06, 0xec, 0x02,
+0x9f, 0x4d, 0x99, 0x25, 0xce, 0x5a, 0xad, 0x06, 0xad, 0x03, 0xe3, 0x07, 0xc1, 0x85, 0x01, 0xdc,
+0x05, 0xda, 0x1a, 0xbd, 0x01, 0xa4, 0x06, 0xe2, 0x0a, 0xeb, 0x17, 0x96, 0x11, 0x82, 0x14, 0xf9,
+0x01, 0x8b, 0x02, 0x4b, 0xa7, 0x37, 0xfd, 0x14, 0xcf, 0x07, 0x56, 0xcd, 0x05, 0x8e, 0x07, 0xc2,
+0x1e, 0x8b, 0x27, 0xc3, 0x09, 0x87, 0x03, 0x60, 0xd3, 0x09, 0xd9, 0x1a, 0xc8, 0x46, 0xe1, 0x04,
+0xd5, 0x0b, 0xee, 0x04, 0x99, 0x06, 0xdf, 0x19, 0xf0, 0x92, 0x01, 0xd7, 0x06, 0xa4, 0x06, 0xf5,
+0x02, 0xee, 0x0f, 0x8f, 0x12, 0x88, 0x28, 0xd2, 0x07, 0xbf, 0x01, 0xc5, 0x02, 0x85, 0x04, 0xf4,
+0x01, 0xd8, 0x2f, 0xe8, 0x03, 0xdc, 0x04, 0x8e, 0x02, 0xcc, 0x06, 0x00, 0xca, 0x08, 0xe2, 0x04,
+0xee, 0x07, 0xa2, 0x01, 0xce, 0x02, 0xdc, 0x05, 0xb9, 0x0b, 0xee, 0x02, 0x97, 0x04, 0x8b, 0x05,
+0xbb, 0x02, 0xae, 0x0d, 0xd2, 0x07, 0xb8, 0x0b, 0xec, 0x02, 0x96, 0x02, 0x8a, 0x0b, 0xb4, 0x35,
+0xcd, 0x1c, 0x7c, 0xa5, 0x03, 0xd5, 0x0b, 0xaf, 0x0e, 0xf2, 0x16, 0xd6, 0x06, 0x83, 0x14, 0x14,
+0x41, 0x67, 0xde, 0x2e, 0xad, 0x0d, 0xeb, 0x17, 0x13, 0xa4, 0x03, 0x88, 0x03, 0xde, 0x2e, 0xd4,
+0x1b, 0xed, 0x02, 0x95, 0x02, 0x30, 0x8f, 0x0c, 0xf0, 0x16, 0x82, 0x29, 0x00, 0x92, 0x06, 0x3a,
+0xb0, 0x03, 0xba, 0x0b, 0x83, 0x14, 0xe2, 0x04, 0x72, 0xc8, 0x07, 0xcf, 0x02, 0xea, 0x55, 0x9d,
+0x24, 0xa0, 0x0f, 0x86, 0x01, 0xcd, 0x0b, 0xf1, 0x03, 0xb9, 0x34, 0xce, 0x1c, 0xd5, 0x06, 0xa1,
+0x01, 0xfd, 0x02, 0xac, 0x04, 0xf3, 0x2a, 0xcc, 0x5a, 0xa2, 0x0f, 0xd6, 0x03, 0xd6, 0x03, 0x8d,
+0x04, 0xdd, 0x2e, 0xd8, 0x2f, 0xe0, 0x19, 0xa0, 0x04, 0x82, 0x02, 0xae, 0x03, 0xeb, 0x17, 0x82,
+0x29, 0xae, 0x36, 0xae, 0x01, 0xe4, 0x07, 0x60, 0xb8, 0x0b, 0xc4, 0x09, 0xb6, 0x20, 0xfa, 0x03,
+0x30, 0xd0, 0x02, 0xe3, 0x2d, 0xae, 0x0d, 0xce, 0x1c, 0xe5, 0x06, 0xff, 0x02, 0x8f, 0x01, 0xfb,
+0x52, 0xe8, 0x6a, 0x90, 0x12, 0x55, 0xb0, 0x03, 0x30, 0xd1, 0x30, 0xea, 0x2c, 0x8a, 0x13, 0xd0,
+0x04, 0x42, 0x9e, 0x05, 0xd3, 0x44, 0x92, 0x26, 0xb0, 0x21, 0x37, 0xa6, 0x03, 0xe6, 0x01, 0xdd,
+0x05, 0xc4, 0x47, 0xe0, 0x19, 0x89, 0x03, 0xe6, 0x01, 0xb4, 0x04, 0x97, 0x25, 0xf2, 0x16, 0xc4,
+0x09, 0xf3, 0x02, 0x72, 0xbd, 0x01, 0xd9, 0x1a, 0x96, 0x3a, 0x84, 0x14, 0xf1, 0x03, 0x71, 0x56,
+0xe2, 0x04, 0xe2, 0x04, 0xd9, 0x1a, 0x8b, 0x02, 0xdb, 0x04, 0x88, 0x0b, 0xb1, 0x0c, 0xf7, 0x15,
+0xa3, 0x23, 0xe9, 0x03, 0x8b, 0x0a, 0xae, 0x01, 0x97, 0x3a, 0xed, 0x02, 0xb3, 0x35, 0xdd, 0x03,
+0xfa, 0x06, 0xab, 0x04, 0xb4, 0x0c, 0x9f, 0x0f, 0xed, 0x40, 0xf6, 0x02, 0xe9, 0x05, 0xba, 0x08,
+0xe7, 0x03, 0xa1, 0x0f, 0xcf, 0x45, 0xb5, 0x01, 0xfa, 0x06, 0xf1, 0x03, 0xe0, 0x19, 0xdb, 0x05,
+0xa7, 0x37, 0x4d, 0xef, 0x01, 0xc9, 0x06, 0xe6, 0x18, 0x8f, 0x12, 0xdf, 0x42, 0xd4, 0x09, 0xed,
+0x04, 0xda, 0x07, 0xc2, 0x1e, 0xa5, 0x75, 0xcb, 0x31, 0x84, 0x07, 0xf8, 0x04, 0x81, 0x08, 0xa7,
+0x0e, 0xb1, 0x21, 0xbf, 0x0a, 0xb7, 0x06, 0xfe, 0x05, 0xe5, 0x06, 0xb6, 0x5e, 0xfc, 0x29, 0x90,
+0x12, 0xf0, 0x04, 0xc5, 0x02, 0xec, 0x02, 0x98, 0x25, 0xb3, 0x0c, 0xc9, 0x08, 0xc6, 0x07, 0x98,
+0x04, 0xb3, 0x02, 0xfa, 0x3e, 0xbf, 0x33, 0xf3, 0x01, 0xa1, 0x01, 0xfd, 0x05, 0xa3, 0x06, 0x9c,
+0x39, 0x81, 0x14, 0xf3, 0x01, 0xef, 0x01, 0x8d, 0x01, 0xac, 0x04, 0x9c, 0x39, 0x91, 0x3b, 0xd1,
+0x07, 0x81, 0x02, 0xb1, 0x05, 0xa3, 0x06, 0x91, 0x26, 0x9f, 0x0f, 0xc3, 0x09, 0xab, 0x04, 0xe1,
+0x02, 0xb1, 0x05, 0xd6, 0x06, 0xf6, 0x53, 0xbe, 0x0a, 0x25, 0xb0, 0x08, 0x42, 0xde, 0x2e, 0xda,
+0x81, 0x01, 0xb4, 0x0c, 0xb8, 0x03, 0xb3, 0x0a, 0xe2, 0x05, 0xf3, 0x3f, 0xfc, 0x52, 0xf3, 0x01,
+0x60, 0xac, 0x04, 0x4b, 0xd3, 0x1b, 0xac, 0x4b, 0xdb, 0x05, 0xc0, 0x01, 0x8e, 0x07, 0xb8, 0x06,
+0xa0, 0x24, 0xd4, 0x1b, 0xcb, 0x08, 0xb7, 0x03, 0x9a, 0x06, 0x91, 0x03, 0xc5, 0x09, 0x9a, 0x4e,
+0xe7, 0x03, 0xc5, 0x02, 0xe7, 0x03, 0x97, 0x07, 0xaf, 0x4a, 0xe4, 0x6b, 0xdb, 0x05, 0xc4, 0x08,
+0xf0, 0x01, 0xc6, 0x07, 0xb1, 0x4a, 0xe6, 0x41, 0xf2, 0x16, 0xfa, 0x06, 0x7c, 0xd0, 0x0a, 0xdb,
+0x43, 0xfe, 0x14, 0xe8, 0x2c, 0xd6, 0x03, 0xa8, 0x05, 0xcc, 0x06, 0xf5, 0x2a, 0xa2, 0x0f, 0x84,
+0x52, 0x1c, 0xa5, 0x08, 0x81, 0x02, 0xb9, 0x34, 0xe8, 0x03, 0x9a, 0x10, 0xab, 0x04, 0x99, 0x01,
+0xc5, 0x02, 0xf3, 0x01, 0xa3, 0x38, 0xba, 0x0b, 0xf2, 0x03, 0xcc, 0x03, 0x8a, 0x08, 0xb4, 0x35,
+0xcb, 0x5a, 0xb9, 0x0b, 0xbb, 0x07, 0x91, 0x03, 0xd2, 0x04, 0xac, 0x22, 0xcd, 0x5a, 0x8b, 0x27,
+0xc5, 0x05, 0xe7, 0x06, 0xa5, 0x0b, 0xad, 0x0d, 0xa1, 0x38, 0x87, 0x28, 0x9e, 0x05, 0xb7, 0x06,
+0x26, 0x00, 0xeb, 0x7e, 0x9d, 0x24, 0xa3, 0x03, 0xf4, 0x05, 0xc0, 0x06, 0xe4, 0x2d, 0xab, 0x0d,
+0x79, 0x8e, 0x01, 0xa3, 0x06, 0xaf, 0x08, 0xe1, 0x04, 0xe5, 0x18, 0xee, 0x02, 0xbc, 0x05, 0xb8,
+0x06, 0x95, 0x02, 0xee, 0x02, 0xe9, 0x2c, 0xb9, 0x0b, 0xb8, 0x03, 0xff, 0x02, 0xab, 0x09, 0xb3,
+0x35, 0xbf, 0x33, 0xc1, 0x1e, 0xaf, 0x10, 0xe4, 0x12, 0xaa, 0x07, 0xb8, 0x72, 0xfa, 0x3e, 0xd2,
+0x07, 0xd6, 0x0b, 0xd7, 0x0a, 0xdc, 0x01, 0xdc, 0x05, 0xbe, 0x0a, 0xdd, 0x05, 0xcb, 0x03, 0x86,
+0x01, 0x8d, 0x07, 0xd2, 0x07, 0xa8, 0x0e, 0xbd, 0x0a, 0xa8, 0x02, 0xc1, 0x06, 0x26, 0xdb, 0x05,
+0xf5, 0x01, 0x8f, 0x12, 0xa1, 0x01, 0xdc, 0x04, 0x0a, 0xfc, 0x14, 0xd8, 0x06, 0xcf, 0x07, 0x73,
+0x97, 0x04, 0xc8, 0x04, 0xd5, 0x06, 0xcb, 0x08, 0xcd, 0x1c, 0x8a, 0x03, 0xc8, 0x04, 0xf0, 0x01,
+0xf3, 0x01, 0xc3, 0x09, 0xdc, 0x05, 0xbd, 0x07, 0xe4, 0x07, 0x97, 0x04, 0x79, 0x84, 0x14, 0xf3,
+0x01, 0xb8, 0x06, 0x13, 0xe6, 0x01, 0xed, 0x02, 0x00, 0xe7, 0x03, 0xb6, 0x01, 0x8c, 0x02, 0xfb,
+0x06, 0xe7, 0x03, 0x8a, 0x13, 0xe1, 0x04, 0xf8, 0x04, 0x8f, 0x01, 0xbc, 0x05, 0xec, 0x17, 0x95,
+0x11, 0xd7, 0x06, 0xad, 0x06, 0xb9, 0x05, 0xf7, 0x07, 0xb2, 0x0c, 0xfa, 0x29, 0xe1, 0x04, 0xa2,
+0x01, 0xf6, 0x02, 0x8c, 0x02, 0xdb, 0x05, 0xa2, 0x0f, 0xbd, 0x0a, 0xd2, 0x01, 0x97, 0x0a, 0xfc,
+0x03, 0xdb, 0x05, 0xb0, 0x21, 0x95, 0x11, 0xbe, 0x07, 0x4b, 0xb2, 0x05, 0xf7, 0x15, 0xee, 0x02,
+0xc0, 0x0a, 0xc0, 0x01, 0x8e, 0x07, 0xb8, 0x03, 0x8d, 0x27, 0x8d, 0x12, 0xc0, 0x33, 0x8c, 0x05,
+0xf1, 0x03, 0xc5, 0x02, 0xb9, 0x34, 0xeb, 0x17, 0xb6, 0x20, 0xbb, 0x05, 0x3a, 0xa8, 0x05, 0xdd,
+0x2e, 0x79, 0xda, 0x1a, 0xd4, 0x06, 0xc5, 0x02, 0xc6, 0x05, 0xdd, 0x57, 0xe9, 0x2c, 0xea, 0x2c,
+0xd9, 0x07, 0x82, 0x0a, 0xb1, 0x02, 0xf2, 0x16, 0x8a, 0x13, 0xda, 0x1a, 0xde, 0x03, 0xbd, 0x04,
+0x56, 0xc1, 0x1e, 0x8d, 0x27, 0xe3, 0x04, 0xed, 0x04, 0xa4, 0x01, 0x8f, 0x01, 0xae, 0x5f, 0xb7,
+0x0b, 0x97, 0x25, 0x11, 0xd3, 0x09, 0xfd, 0x05, 0xe9, 0x17, 0xcb, 0x31, 0x9d, 0x24, 0xf5, 0x02,
+0xa0, 0x07, 0xf4, 0x05, 0xee, 0x2b, 0x7a, 0xbe, 0x0a, 0xc6, 0x02, 0xc0, 0x01, 0xb1, 0x02, 0xd4,
+0x1b, 0xdd, 0x2e, 0xf8, 0x15, 0x56, 0x8e, 0x07, 0x92, 0x03, 0x8e, 0x27, 0x85, 0x28, 0xee, 0x02,
+0xab, 0x01, 0xe9, 0x08, 0x8b, 0x05, 0xc7, 0x1d, 0xe3, 0x2d, 0xc1, 0x1e, 0x55, 0xff, 0x02, 0x44,
+0xb1, 0x21, 0xb5, 0x20, 0xc7, 0x1d, 0xdd, 0x01, 0xa8, 0x05, 0x9f, 0x02, 0xce, 0x1c, 0xb3, 0x0c,
+0x83, 0x14, 0x00, 0x8d, 0x01, 0xbd, 0x07, 0x88, 0x28, 0xf2, 0x16, 0xb9, 0x0b, 0x9d, 0x02, 0x72,
+0x26, 0xce, 0x1c, 0xc9, 0x08, 0x9f, 0x0f, 0xae, 0x03, 0x95, 0x02, 0x8e, 0x02, 0x82, 0x29, 0x93,
+0x26, 0xd3, 0x1b, 0x39, 0x86, 0x01, 0xe4, 0x01, 0xc8, 0x1d, 0xe1, 0x04, 0xc7, 0x1d, 0x5d, 0xdf,
+0x08, 0xe5, 0x09, 0xd7, 0x2f, 0xcf, 0x07, 0xd1, 0x07, 0x88, 0x03, 0xf4, 0x08, 0x92, 0x0e, 0x8a,
+0x13, 0xf1, 0x16, 0xcf, 0x07, 0xcf, 0x07, 0xe5, 0x01, 0xed, 0x0c, 0xf7, 0x15, 0xa4, 0x23, 0x7a,
+0xda, 0x04, 0x5f, 0xe0, 0x05, 0xb3, 0x0c, 0xe3, 0x2d, 0xda, 0x1a, 0xb8, 0x03, 0x4c, 0x3a, 0x83,
+0x3d, 0xeb, 0x17, 0xf8, 0x15, 0x1e, 0xa0, 0x02, 0xa6, 0x03, 0x8a, 0x13, 0xe1, 0x04, 0x8a, 0x13,
+0xa9, 0x02, 0x9d, 0x05, 0x60, 0xf7, 0x15, 0x81, 0x14, 0xe8, 0x03, 0xb0, 0x03, 0xcf, 0x02, 0x00,
+0xa5, 0x4c, 0xd7, 0x06, 0xf4, 0x01, 0x5f, 0x2f, 0xc4, 0x02, 0xe5, 0x18, 0xbd, 0x0a, 0xdc, 0x05,
+0x9c, 0x03, 0xb8, 0x09, 0xd6, 0x03, 0xd6, 0x06, 0xa1, 0x0f, 0xdc, 0x05, 0x90, 0x01, 0x93, 0x08,
+0x9e, 0x08, 0xb7, 0x0b, 0xb5, 0x20, 0xcf, 0x07, 0x85, 0x01, 0xbe, 0x04, 0x4c, 0xd2, 0x30, 0xbb,
+0x1f, 0xd6, 0x06, 0xfe, 0x02, 0xe5, 0x01, 0x97, 0x01, 0xa1, 0x0f, 0xb1, 0x21, 0xa5, 0x0e, 0xd0,
+0x02, 0xca, 0x01, 0xf1, 0x06, 0xe4, 0x2d, 0x81, 0x14, 0xbe, 0x0a, 0xa8, 0x02, 0xbe, 0x04, 0xa2,
+0x04, 0xa4, 0x23, 0xbf, 0x0a, 0xbd, 0x0a, 0xbf, 0x01, 0xb1, 0x02, 0xdf, 0x03, 0xb1, 0x0c, 0xf9,
+0x29, 0xd7, 0x2f, 0x07, 0x82, 0x02, 0xf0, 0x04, 0xf2, 0x16, 0xb1, 0x21, 0xc7, 0x1d, 0xfe, 0x02,
+0x14, 0x82, 0x02, 0xd1, 0x07, 0xeb, 0x40, 0xf5, 0x2a, 0xdf, 0x05, 0x9f, 0x05, 0xeb, 0x0a, 0xf5,
+0x15, 0xb3, 0x0c, 0xbb, 0x1f, 0x82, 0x02, 0xb5, 0x01, 0x55, 0xb7, 0x20, 0xcd, 0x1c, 0x8f, 0x12,
+0x39, 0xc4, 0x08, 0xb2, 0x02, 0xe4, 0x2d, 0x99, 0x10, 0xed, 0x02, 0x0a, 0xf5, 0x02, 0xa3, 0x01,
+0xe8, 0x03, 0x99, 0x25, 0xf3, 0x01, 0x1b, 0xd1, 0x01, 0xe9, 0x05, 0xc1, 0x1e, 0xf9, 0x29, 0xa7,
+0x0e, 0xe3, 0x02, 0xa2, 0x04, 0xb4, 0x04, 0x88, 0x28, 0xac, 0x0d, 0xf0, 0x02, 0x56, 0xed, 0x04,
+0x7e, 0xb6, 0x20, 0xb7, 0x0b, 0x94, 0x11, 0x74, 0xb5, 0x01, 0xf3, 0x08, 0xc1, 0x1e, 0xc9, 0x1d,
+0xa2, 0x0f, 0xc8, 0x04, 0xd2, 0x01, 0xd4, 0x06, 0xdf, 0x19, 0x93, 0x11, 0xb6, 0x20, 0x86, 0x01,
+0x86, 0x01, 0xac, 0x04, 0x79, 0xed, 0x02, 0x9c, 0x39, 0xd5, 0x08, 0xe8, 0x03, 0xb7, 0x06, 0xbd,
+0x1f, 0xac, 0x0d, 0x86, 0x3d, 0xea, 0x05, 0xdb, 0x01, 0xb0, 0x08, 0xf8, 0x15, 0x00, 0x82, 0x14,
+0x5f, 0x4b, 0xa9, 0x04, 0xab, 0x0d, 0x7a, 0xe6, 0x18, 0xe5, 0x01, 0x0a, 0xdd, 0x01, 0xb0, 0x21,
+0x8a, 0x13, 0xce, 0x1c, 0x9c, 0x03, 0xe5, 0x04, 0x30, 0xe2, 0x04, 0xad, 0x0d, 0xae, 0x0d, 0x8c,
+0x05, 0x87, 0x06, 0x8d, 0x01, 0xf3, 0x01, 0xc3, 0x32, 0xa1, 0x0f, 0xc5, 0x02, 0x67, 0xf8, 0x09,
+0xdb, 0x05, 0xff, 0x3d, 0xb7, 0x0b, 0xd7, 0x05, 0x83, 0x02, 0xc3, 0x02, 0xec, 0x17, 0xe8, 0x03,
+0xc3, 0x09, 0x74, 0xc0, 0x01, 0xb5, 0x04, 0xa5, 0x23, 0xa9, 0x22, 0xd7, 0x06, 0xb2, 0x02, 0x92,
+0x03, 0xff, 0x0a, 0xcc, 0x08, 0xbd, 0x0a, 0x8d, 0x12, 0xab, 0x04, 0xae, 0x01, 0xbe, 0x0a, 0x8f,
+0x12, 0xa6, 0x0e, 0x00, 0x69, 0x43, 0xc7, 0x0a, 0xa3, 0x23, 0xa8, 0x0e, 0xee, 0x02, 0x1b, 0xbe,
+0x07, 0xa4, 0x09, 0xf0, 0x54, 0xc4, 0x09, 0x79, 0xa0, 0x02, 0xd1, 0x01, 0xcd, 0x08, 0xae, 0x0d,
+0xeb, 0x17, 0xe8, 0x03, 0x8e, 0x01, 0x08, 0xb4, 0x0a, 0x95, 0x11, 0xa5, 0x0e, 0xa7, 0x0e, 0x30,
+0xf3, 0x05, 0xbb, 0x05, 0xb2, 0x0c, 0xea, 0x17, 0xf4, 0x01, 0xf2, 0x03, 0xb6, 0x04, 0xed, 0x04,
+0xcf, 0x07, 0x93, 0x11, 0xf4, 0x01, 0xba, 0x03, 0xf1, 0x09, 0xd0, 0x02, 0xbb, 0x1f, 0xb1, 0x21,
+0x79, 0xe5, 0x01, 0x8e, 0x0a, 0xd9, 0x02, 0xd6, 0x06, 0x99, 0x10, 0x7a, 0xf4, 0x02, 0xff, 0x07,
+0x92, 0x0e, 0xeb, 0x17, 0xfb, 0x29, 0xfb, 0x14, 0xad, 0x06, 0xba, 0x08, 0xa3, 0x06, 0xa2, 0x0f,
+0xae, 0x36, 0x79, 0x74, 0x9e, 0x02, 0x71, 0xe2, 0x04, 0xf4, 0x01, 0xf7, 0x15, 0xac, 0x09, 0x95,
+0x0a, 0x85, 0x04, 0xdd, 0x2e, 0xa7, 0x60, 0xd3, 0x1b, 0xb7, 0x03, 0x74, 0xa2, 0x04, 0x90, 0x12,
+0x9e, 0x24, 0xbf, 0x0a, 0x5f, 0xce, 0x02, 0x8c, 0x05, 0xce, 0x1c, 0xbf, 0x33, 0xb7, 0x0b, 0x1b,
+0x98, 0x04, 0xeb, 0x05, 0x9e, 0x62, 0xd6, 0x06, 0x7a, 0xb7, 0x03, 0xf7, 0x01, 0xcd, 0x02, 0xe2,
+0x04, 0xea, 0x2c, 0xc4, 0x09, 0xe6, 0x01, 0xde, 0x03, 0xf1, 0x03, 0xb7, 0x0b, 0xf1, 0x16, 0xed,
+0x02, 0xc8, 0x01, 0x60, 0xa8, 0x02, 0xca, 0x08, 0x93, 0x11, 0x00, 0xbd, 0x04, 0xcc, 0x03, 0xa8,
+0x05, 0x83, 0x14, 0xd4, 0x44, 0xda, 0x1a, 0x1b, 0xb6, 0x01, 0xdf, 0x08, 0xe2, 0x04, 0xe4, 0x2d,
+0xbc, 0x1f, 0xc9, 0x01, 0xe6, 0x09, 0xbc, 0x0a, 0xca, 0x46, 0xc0, 0x33, 0xf8, 0x15, 0xcc, 0x0b,
+0xcf, 0x12, 0xb1, 0x0a, 0xa5, 0x4c, 0x81, 0x52, 0x96, 0x11, 0xac, 0x04, 0xfe, 0x08, 0x2f, 0xc2,
+0x1e, 0xab, 0x22, 0xc9, 0x08, 0xf5, 0x02, 0xc9, 0x04, 0xa0, 0x0a, 0xaf, 0x21, 0xc7, 0x1d, 0xd1,
+0x07, 0x9f, 0x02, 0x4b, 0xab, 0x01, 0x00, 0xfd, 0x14, 0xf3, 0x01, 0x07, 0x95, 0x02, 0x56, 0xb8,
+0x0b, 0x9c, 0x10, 0xe1, 0x04, 0x8c, 0x02, 0x89, 0x05, 0xb3, 0x0d, 0xdf, 0x19, 0xb6, 0x20, 0x90,
+0x12, 0xc3, 0x08, 0xee, 0x04, 0xb6, 0x07, 0xca, 0x1d, 0x9a, 0x4e, 0xdc, 0x05, 0x60, 0xc8, 0x04,
+0x99, 0x01, 0x9b, 0x10, 0x9d, 0x24, 0x7a, 0xa0, 0x07, 0xd7, 0x02, 0xed, 0x04, 0xae, 0x36, 0xf7,
+0x15, 0xc4, 0x09, 0xad, 0x06, 0x38, 0x12, 0xd9, 0x1a, 0xb4, 0x0c, 0xc6, 0x09, 0xad, 0x06, 0xb8,
+0x09, 0x56, 0xb0, 0x5f, 0xdc, 0x6c, 0x00, 0xa1, 0x01, 0xa9, 0x0d, 0xa3, 0x06, 0xb5, 0x5e, 0x8e,
+0x50, 0xc4, 0x09, 0x99, 0x01, 0xbe, 0x0a, 0xef, 0x11, 0xbe, 0x0a, 0xe8, 0x6a, 0xbe, 0x0a, 0x98,
+0x04, 0xfd, 0x05, 0x82, 0x02, 0x87, 0x13, 0xfc, 0x52, 0xf2, 0x16, 0xb6, 0x01, 0xce, 0x02, 0xe4,
+0x12, 0x98, 0x25, 0xc0, 0x33, 0x00, 0x0a, 0xb3, 0x07, 0xb6, 0x0c, 0xab, 0x0d, 0xec, 0x7e, 0xfb,
+0x14, 0x0a, 0xdc, 0x01, 0x8f, 0x09, 0xc4, 0x09, 0x9a, 0x25, 0xeb, 0x17, 0x84, 0x04, 0x8d, 0x04,
+0xf7, 0x0f, 0xe3, 0x2d, 0xf4, 0x01, 0x89, 0x13, 0xca, 0x01, 0xc4, 0x05, 0x9a, 0x03, 0xd2, 0x30,
+0xea, 0x2c, 0xe5, 0x18, 0xef, 0x01, 0x1b, 0xe6, 0x0f, 0x00, 0xc4, 0x09, 0xc5, 0x32, 0x14, 0xed,
+0x04, 0x25, 0xc3, 0x47, 0x8f, 0x12, 0xf5, 0x2a, 0xfc, 0x03, 0x7c, 0xd9, 0x02, 0x8b, 0x27, 0x9f,
+0x0f, 0xc5, 0x32, 0x97, 0x07, 0xf4, 0x05, 0xed, 0x04, 0x80, 0x29, 0xc6, 0x5b, 0xa5, 0x0e, 0x4c,
+0x9c, 0x03, 0xf4, 0x08, 0xa4, 0x61, 0xd0, 0x45, 0x89, 0x13, 0x80, 0x03, 0x39, 0x85, 0x01, 0x83,
+0x14, 0x89, 0x13, 0xbb, 0x1f, 0xf6, 0x07, 0x8d, 0x01, 0xa9, 0x07, 0xe7, 0x03, 0xb3, 0x35, 0xa7,
+0x0e, 0xde, 0x01, 0x08, 0xf9, 0x01, 0xe1, 0x04, 0xe4, 0x2d, 0xb7, 0x0b, 0xab, 0x07, 0x00, 0x8b,
+0x02, 0xea, 0x2c, 0xa0, 0x76, 0xb8, 0x0b, 0xb4, 0x02, 0xc6, 0x05, 0xae, 0x03, 0xb6, 0x20, 0xac,
+0x4b, 0xaf, 0x21, 0xf9, 0x01, 0xb9, 0x0b, 0xf3, 0x02, 0x97, 0x25, 0xa0, 0x24, 0x00, 0x14, 0x30,
+0x81, 0x05, 0xdd, 0x05, 0xf2, 0x3f, 0x97, 0x25, 0x13, 0xb5, 0x01, 0x0a, 0xe9, 0x55, 0x94, 0x26,
+0xa5, 0x23, 0x6a, 0x72, 0xde, 0x06, 0xa7, 0x37, 0xdc, 0x05, 0xbb, 0x1f, 0xac, 0x01, 0x44, 0xc3,
+0x08, 0xa1, 0x0f, 0x90, 0x3b, 0xa1, 0x0f, 0x81, 0x02, 0x9c, 0x03, 0xfb, 0x06, 0xba, 0x0b, 0xae,
+0x74, 0xd8, 0x06, 0xd5, 0x06, 0xe1, 0x02, 0xbc, 0x10, 0xa6, 0x0e, 0xbc, 0x86, 0x01, 0xb8, 0x0b,
+0x80, 0x03, 0xf4, 0x02, 0xe5, 0x01, 0xb4, 0x0c, 0x98, 0x25, 0xf2, 0x16, 0x90, 0x01, 0x8e, 0x02,
+0xe3, 0x04, 0xfa, 0x29, 0x8a, 0x51, 0xd8, 0x2f, 0xdb, 0x04, 0x5e, 0x9f, 0x02, 0xa2, 0x0f, 0xf0,
+0x7d, 0xb4, 0x35, 0xe1, 0x02, 0xb5, 0x01, 0x90, 0x01, 0xeb, 0x17, 0xa0, 0x4d, 0x92, 0x26, 0xf8,
+0x01, 0x37, 0xb7, 0x06, 0xf7, 0x15, 0xf0, 0x69, 0xea, 0x2c, 0x92, 0x06, 0xd2, 0x04, 0xce, 0x05,
+0xcc, 0x31, 0xbc, 0x48, 0xa2, 0x0f, 0x7c, 0x73, 0x00, 0x84, 0x14, 0x98, 0x3a, 0x88, 0x13, 0xbd,
+0x01, 0xfa, 0x01, 0x81, 0x02, 0xd4, 0x1b, 0xe2, 0x6b, 0xde, 0x05, 0xe9, 0x03, 0xf1, 0x03, 0xd2,
+0x01, 0xf7, 0x15, 0x9a, 0x4e, 0x00, 0xb4, 0x02, 0xe2, 0x02, 0xe2, 0x02, 0xa6, 0x23, 0xfc, 0x52,
+0xe9, 0x03, 0x27, 0x4c, 0xf8, 0x07, 0xe3, 0x04, 0x88, 0x51, 0xe6, 0x18, 0x89, 0x05, 0xc5, 0x02,
+0x99, 0x0c, 0x79, 0xc2, 0x5c, 0xcc, 0x08, 0xab, 0x01, 0x95, 0x02, 0xd1, 0x04, 0x91, 0x26, 0xda,
+0x81, 0x01, 0xd6, 0x06, 0xee, 0x01, 0x1b, 0xaa, 0x02, 0xdf, 0x19, 0xee, 0x69, 0xa7, 0x0e, 0xc2,
+0x03, 0xbf, 0x01, 0x69, 0xe5, 0x18, 0xb2, 0x4a, 0xb7, 0x0b, 0xe6, 0x01, 0xf0, 0x01, 0xc2, 0x03,
+0xa0, 0x0f, 0xa4, 0x61, 0xc9, 0x08, 0xe6, 0x01, 0x5f, 0xdc, 0x04, 0xcc, 0x08, 0xe2, 0x6b, 0xa7,
+0x0e, 0x09, 0xbf, 0x01, 0xeb, 0x02, 0x7a, 0xb8, 0x49, 0xa5, 0x0e, 0xf0, 0x01, 0x74, 0x55, 0xcb,
+0x08, 0xea, 0x55, 0xbf, 0x0a, 0x4b, 0xf8, 0x01, 0xe1, 0x02, 0xbd, 0x0a, 0xa6, 0x4c, 0xd5, 0x06,
+0x42, 0x7e, 0xbe, 0x01, 0xd6, 0x06, 0x98, 0x63, 0xe1, 0x04, 0x94, 0x03, 0xc9, 0x01, 0x30, 0xf4,
+0x01, 0xc6, 0x5b, 0xd7, 0x06, 0x4c, 0xeb, 0x02, 0x7e, 0xc9, 0x08, 0xf4, 0x3f, 0xc3, 0x09, 0xac,
+0x01, 0xbb, 0x02, 0x95, 0x02, 0x83, 0x14, 0xa6, 0x4c, 0xa5, 0x0e, 0x4b, 0xb5, 0x01, 0x5f, 0xb1,
+0x0c, 0xb4, 0x35, 0xd1, 0x07, 0x69, 0x13, 0x3a, 0xa7, 0x0e, 0xb8, 0x49, 0xb1, 0x0c, 0xc5, 0x02,
+0x58, 0x12, 0xab, 0x0d, 0x8e, 0x50, 0xcb, 0x08, 0xf7, 0x01, 0xa8, 0x02, 0x25, 0x79, 0xc4, 0x47,
+0x79, 0xa3, 0x01, 0xfa, 0x01, 0x26, 0xf4, 0x01, 0xde, 0x57, 0xcc, 0x08, 0x55, 0xbc, 0x02, 0x11,
+0xdc, 0x05, 0xe2, 0x42, 0xb8, 0x0b, 0x56, 0x38, 0x60, 0x7a, 0xf0, 0x54, 0x84, 0x14, 0x25, 0x00,
+0x95, 0x02, 0xe8, 0x03, 0xe6, 0x41, 0x9c, 0x10, 0xbf, 0x01, 0x6a, 0x69, 0xd6, 0x06, 0xa4, 0x61,
+0xa4, 0x23, 0x86, 0x01, 0xd2, 0x01, 0xa1, 0x01, 0xe4, 0x04, 0xb0, 0x5f, 0xbc, 0x1f, 0x3a, 0x8f,
+0x01, 0xa2, 0x01, 0xd0, 0x07, 0xec, 0x40, 0xa2, 0x0f, 0x86, 0x01, 0x07, 0x00, 0xee, 0x02, 0xbc,
+0x5d, 0xf8, 0x15, 0x92, 0x03, 0xdb, 0x01, 0x26, 0xee, 0x02, 0xde, 0x57, 0x8e, 0x12, 0xec, 0x02,
+0x4d, 0xe0, 0x03, 0xdb, 0x05, 0xf4, 0x3f, 0xde, 0x05, 0xfa, 0x01, 0x30, 0x2f, 0x8f, 0x12, 0xa0,
+0x4d, 0xe2, 0x04, 0x39, 0x39, 0x7c, 0xc9, 0x08, 0x90, 0x3b, 0x79, 0x4b, 0x30, 0x72, 0xbf, 0x0a,
+0xac, 0x4b, 0xb9, 0x0b, 0xd3, 0x01, 0x07, 0xc7, 0x01, 0x7c, 0xac, 0x4b, 0xb7, 0x0b, 0x71, 0x1d,
+0x7c, 0xcb, 0x08, 0xd6, 0x44, 0xbf, 0x0a, 0x9f, 0x02, 0x00, 0x7b, 0x89, 0x13, 0xfa, 0x67, 0xe7,
+0x03, 0xbb, 0x02, 0xdc, 0x01, 0xbf, 0x01, 0xed, 0x02, 0xae, 0x5f, 0xee, 0x02, 0x83, 0x04, 0xd1,
+0x01, 0xa8, 0x02, 0xcf, 0x07, 0xa6, 0x4c, 0xd8, 0x06, 0xbc, 0x02, 0x00, 0x4b, 0xee, 0x02, 0xda,
+0x58, 0x7a, 0xfa, 0x03, 0x91, 0x03, 0xc2, 0x03, 0xa9, 0x22, 0xcc, 0x31, 0xd0, 0x07, 0xca, 0x01,
+0x4c, 0x39, 0x95, 0x11, 0x96, 0x3a, 0xe7, 0x03, 0x60, 0x25, 0x58, 0xcd, 0x1c, 0xe2, 0x42, 0x79,
+0x95, 0x02, 0xdb, 0x01, 0x9c, 0x08, 0xcf, 0x45, 0x98, 0x25, 0xc1, 0x1e, 0x44, 0xb4, 0x04, 0x5f,
+0xc6, 0x32, 0xc2, 0x1e, 0xfd, 0x14, 0x1d, 0xcf, 0x04, 0xeb, 0x07, 0xa0, 0x24, 0xda, 0x58, 0xf1,
+0x16, 0x5f, 0xdd, 0x01, 0xcf, 0x05, 0xf4, 0x01, 0xc6, 0x32, 0x83, 0x14, 0x30, 0xc0, 0x01, 0x0a,
+0x9c, 0x39, 0xa0, 0x4d, 0xca, 0x08, 0x71, 0xb5, 0x01, 0x6a, 0x7a, 0xd2, 0x59, 0xf0, 0x02, 0x85,
+0x01, 0x60, 0x8e, 0x07, 0xd0, 0x07, 0xf8, 0x15, 0xd6, 0x06, 0xde, 0x03, 0xd1, 0x01, 0xd8, 0x02,
+0xf1, 0x16, 0xf2, 0x3f, 0xe1, 0x04, 0x83, 0x07, 0x26, 0x25, 0xbf, 0x5c, 0xc0, 0x33, 0x79, 0xf7,
+0x04, 0xdc, 0x09, 0xb4, 0x0a, 0xc8, 0x1d, 0xc4, 0x1e, 0x9b, 0x10, 0xbc, 0x05, 0xa1, 0x01, 0xff,
+0x0a, 0xde, 0x2e, 0x96, 0x3a, 0xcf, 0x07, 0x27, 0x3a, 0xa1, 0x07, 0xbe, 0x0a, 0xf0, 0x2b, 0x79,
+0x8b, 0x02, 0x4d, 0x90, 0x01, 0xcf, 0x07, 0x82, 0x52, 0x8e, 0x12, 0xed, 0x01, 0x96, 0x05, 0xec,
+0x02, 0xae, 0x36, 0xd0, 0x45, 0xc6, 0x09, 0xf4, 0x02, 0xe1, 0x02, 0xf6, 0x02, 0xcc, 0x31, 0xba,
+0x5d, 0xe6, 0x18, 0x28, 0x9f, 0x05, 0x8b, 0x05, 0x93, 0x26, 0x9a, 0x25, 0xf6, 0x15, 0xa2, 0x01,
+0xd4, 0x01, 0xc6, 0x05, 0xd2, 0x07, 0xe8, 0x03, 0xd2, 0x07, 0xae, 0x03, 0xdb, 0x01, 0xa2, 0x04,
+0xd0, 0x07, 0xd4, 0x1b, 0xd1, 0x07, 0xec, 0x02, 0x30, 0xa2, 0x09, 0xe1, 0x04, 0xb9, 0x0b, 0xb7,
+0x0b, 0x7b, 0x83, 0x02, 0xf3, 0x02, 0x9b, 0x39, 0xb8, 0x20, 0xc3, 0x09, 0x83, 0x04, 0xa8, 0x05,
+0x91, 0x06, 0xdc, 0x05, 0xa8, 0x37, 0xe7, 0x03, 0x9e, 0x05, 0x87, 0x06, 0xf1, 0x03, 0x9f, 0x24,
+0xce, 0x1c, 0xd1, 0x07, 0xac, 0x01, 0xaa, 0x02, 0xa9, 0x02, 0xe4, 0x04, 0xc0, 0x33, 0xf4, 0x01,
+0xee, 0x04, 0xf1, 0x06, 0x96, 0x02, 0xd1, 0x07, 0xe8, 0x03, 0xf4, 0x01, 0xa1, 0x01, 0x30, 0xac,
+0x04, 0xc0, 0x0a, 0xae, 0x36, 0xa8, 0x0e, 0x56, 0xad, 0x03, 0xc2, 0x03, 0x81, 0x29, 0x8f, 0x12,
+0xc3, 0x09, 0x92, 0x03, 0xc5, 0x05, 0xe6, 0x0c, 0xc7, 0x1d, 0xf1, 0x3f, 0xcb, 0x08, 0x55, 0xea,
+0x0e, 0xf7, 0x0f, 0xe2, 0x42, 0x9c, 0x10, 0x84, 0x14, 0x99, 0x06, 0xad, 0x01, 0xbb, 0x02, 0xfb,
+0x29, 0xe5, 0x18, 0xdc, 0x05, 0xbf, 0x04, 0x81, 0x02, 0xbc, 0x0d, 0x9b, 0x10, 0xd4, 0x1b, 0xfe,
+0x14, 0xc8, 0x04, 0x8b, 0x02, 0x6a, 0x8e, 0x27, 0xeb, 0x17, 0xb4, 0x0c, 0xf6, 0x02, 0x88, 0x03,
+0x9f, 0x0d, 0xfc, 0x29, 0x83, 0x14, 0xee, 0x02, 0xe5, 0x01, 0xfd, 0x02, 0x92, 0x03, 0xdd, 0x05,
+0xe6, 0x18, 0x00, 0x97, 0x0f, 0xa7, 0x05, 0xb4, 0x07, 0xc3, 0x09, 0xde, 0x57, 0x88, 0x13, 0xf6,
+0x02, 0xfe, 0x02, 0xc2, 0x03, 0xc2, 0x1e, 0xb5, 0x20, 0xf3, 0x01, 0xcc, 0x08, 0xd2, 0x04, 0x1e,
+0x94, 0x26, 0xfb, 0x52, 0xf4, 0x01, 0x4e, 0x25, 0x55, 0xdd, 0x05, 0xa7, 0x0e, 0xea, 0x03, 0xe7,
+0x03, 0xdc, 0x01, 0x8f, 0x04, 0xa3, 0x23, 0xe1, 0x04, 0xe2, 0x04, 0x85, 0x04, 0x9c, 0x06, 0xc1,
+0x03, 0x84, 0x3d, 0xb4, 0x35, 0xd9, 0x1a, 0xab, 0x01, 0xc1, 0x06, 0xef, 0x06, 0xe5, 0x18, 0xc4,
+0x47, 0x8f, 0x12, 0xc8, 0x04, 0xab, 0x01, 0xf0, 0x06, 0xab, 0x4b, 0xd4, 0x1b, 0xaf, 0x21, 0xa1,
+0x04, 0x88, 0x06, 0xe5, 0x01, 0xd8, 0x2f, 0xb6, 0x20, 0xb7, 0x20, 0xb6, 0x09, 0x9b, 0x03, 0xb2,
+0x05, 0xae, 0x0d, 0x93, 0x11, 0xe5, 0x18, 0xa7, 0x02, 0xac, 0x01, 0xb2, 0x02, 0xfe, 0x3d, 0xee,
+0x02, 0xdb, 0x05, 0xec, 0x02, 0xbe, 0x04, 0x41, 0xfc, 0x29, 0xca, 0x08, 0xcf, 0x07, 0xcb, 0x03,
+0xa3, 0x03, 0x69, 0xfd, 0x14, 0xa4, 0x23, 0xf4, 0x01, 0x26, 0x72, 0x4b, 0xbf, 0x33, 0xfe, 0x14,
+0xc2, 0x1e, 0xdc, 0x01, 0xbe, 0x07, 0x30, 0x82, 0x29, 0xf6, 0x2a, 0xb0, 0x21, 0x88, 0x06, 0xcf,
+0x02, 0x69, 0xc8, 0x1d, 0x95, 0x11, 0xea, 0x2c, 0x74, 0x8f, 0x09, 0xc2, 0x03, 0xfb, 0x29, 0xd4,
+0x1b, 0xae, 0x36, 0x9f, 0x05, 0xa4, 0x0c, 0x97, 0x07, 0xe8, 0x41, 0x90, 0x12, 0x82, 0x29, 0xe6,
+0x01, 0xb7, 0x09, 0xf0, 0x01, 0xce, 0x1c, 0x9e, 0x24, 0xea, 0x2c, 0xbb, 0x02, 0x7b, 0xf0, 0x01,
+0xf4, 0x01, 0x8e, 0x27, 0x9c, 0x39, 0x9c, 0x03, 0x9c, 0x03, 0xa0, 0x07, 0xa2, 0x0f, 0x8f, 0x3b,
+0xb8, 0x0b, 0xf7, 0x01, 0xe1, 0x05, 0xaa, 0x07, 0xee, 0x2b, 0xf3, 0x3f, 0xc6, 0x09, 0x8d, 0x0a,
+0xaa, 0x02, 0x9d, 0x02, 0xf4, 0x3f, 0xfe, 0x14, 0xdc, 0x05, 0xdd, 0x03, 0x57, 0xf5, 0x0a, 0x88,
+0x13, 0xc2, 0x1e, 0xbd, 0x0a, 0xd2, 0x04, 0x8d, 0x01, 0xa9, 0x0a, 0x8a, 0x13, 0x9a, 0x25, 0x83,
+0x14, 0xe5, 0x04, 0x85, 0x04, 0x9c, 0x03, 0xa2, 0x38, 0x84, 0x3d, 0x9f, 0x24, 0x98, 0x04, 0xcb,
+0x03, 0x56, 0xc9, 0x08, 0xb6, 0x20, 0x8d, 0x12, 0x11, 0x8f, 0x06, 0x88, 0x06, 0xe7, 0x6a, 0xd8,
+0x06, 0x8f, 0x12, 0xd8, 0x02, 0x96, 0x15, 0xa4, 0x06, 0xe4, 0x56, 0xbf, 0x0a, 0xc1, 0x1e, 0x7b,
+0xc7, 0x0f, 0x09, 0xab, 0x0d, 0xa5, 0x0e, 0xdf, 0x19, 0xe1, 0x02, 0x80, 0x05, 0xd7, 0x02, 0xec,
+0x17, 0xce, 0x45, 0xf7, 0x15, 0xb8, 0x03, 0x7e, 0x91, 0x06, 0xb8, 0x0b, 0xa6, 0x23, 0xcb, 0x31,
+0xc2, 0x03, 0x4c, 0x2f, 0xe2, 0x04, 0xce, 0x1c, 0xf5, 0x2a, 0x3a, 0x39, 0xfa, 0x01, 0x9f, 0x4d,
+0xda, 0x1a, 0xe1, 0x2d, 0xba, 0x05, 0xab, 0x01, 0x92, 0x0e, 0xd9, 0x43, 0xa7, 0x0e, 0xfd, 0x14,
+0xe5, 0x09, 0xe6, 0x14, 0x93, 0x08, 0xba, 0x34, 0xb4, 0x0c, 0xed, 0x02, 0x96, 0x02, 0xb5, 0x0c,
+0x8b, 0x02, 0x7a, 0xca, 0x08, 0xfd, 0x14, 0x14, 0xdd, 0x03, 0x2f, 0xf7, 0x15, 0xdc, 0x05, 0xdb,
+0x05, 0xbb, 0x02, 0x87, 0x03, 0xae, 0x03, 0xa1, 0x0f, 0x8e, 0x27, 0xe9, 0x03, 0x4c, 0x85, 0x01,
+0xa4, 0x01, 0xdb, 0x05, 0xcd, 0x1c, 0xef, 0x16, 0xac, 0x01, 0xe4, 0x07, 0xb8, 0x03, 0xa2, 0x0f,
+0xf5, 0x2a, 0xb1, 0x21, 0x91, 0x03, 0x97, 0x07, 0x9c, 0x03, 0xe9, 0x2c, 0xc9, 0x08, 0xb1, 0x0c,
+0x09, 0xfc, 0x03, 0xb6, 0x01, 0xfe, 0x14, 0xab, 0x22, 0xe7, 0x03, 0xa2, 0x07, 0x09, 0x9f, 0x0a,
+0xf1, 0x16, 0xf3, 0x2a, 0xbe, 0x0a, 0xe3, 0x02, 0x69, 0x84, 0x04, 0xdb, 0x05, 0xe3, 0x04, 0x9c,
+0x10, 0x7b, 0x7e, 0xf3, 0x02, 0xe2, 0x04, 0xe7, 0x03, 0xbe, 0x0a, 0x9c, 0x03, 0xf1, 0x03, 0x98,
+0x01, 0x94, 0x11, 0xc7, 0x1d, 0xdb, 0x05, 0xe6, 0x01, 0xdb, 0x04, 0xf8, 0x04, 0xba, 0x0b, 0xc0,
+0x0a, 0xe7, 0x03, 0xd9, 0x0a, 0xf2, 0x03, 0xf7, 0x01, 0xad, 0x0d, 0xc0, 0x33, 0xc5, 0x09, 0xf0,
+0x01, 0x8b, 0x05, 0xdf, 0x03, 0xb4, 0x0c, 0xdc, 0x05, 0x8d, 0x12, 0x8b, 0x02, 0x88, 0x06, 0x97,
+0x01, 0xd0, 0x07, 0x83, 0x14, 0x83, 0x14, 0x95, 0x02, 0xf9, 0x06, 0xd4, 0x03, 0xcd, 0x1c, 0xc4,
+0x09, 0xbb, 0x1f, 0xc1, 0x03, 0xbc, 0x02, 0xed, 0x01, 0x8a, 0x13, 0xe1, 0x04, 0x95, 0x11, 0xf6,
+0x02, 0x43, 0xad, 0x06, 0xf1, 0x16, 0xb4, 0x0c, 0xf1, 0x16, 0xf5, 0x05, 0x4b, 0xf2, 0x03, 0x93,
+0x4f, 0xd4, 0x1b, 0xa1, 0x0f, 0xec, 0x05, 0xfe, 0x02, 0x82, 0x02, 0xef, 0x2b, 0xd0, 0x07, 0xb7,
+0x0b, 0x7b, 0xf6, 0x02, 0xa2, 0x01, 0xc3, 0x09, 0xe8, 0x03, 0xe7, 0x03, 0xf5, 0x02, 0xc0, 0x01,
+0xcb, 0x03, 0xee, 0x2b, 0xdc, 0x05, 0x7a, 0xfe, 0x02, 0x1b, 0x11, 0xcf, 0x07, 0x9c, 0x10, 0x79,
+0x74, 0x8e, 0x04, 0xf6, 0x02, 0xe6, 0x18, 0xa5, 0x0e, 0xe8, 0x03, 0xea, 0x05, 0x81, 0x05, 0x8a,
+0x05, 0xb7, 0x0b, 0xef, 0x2b, 0xe1, 0x04, 0x83, 0x04, 0xdc, 0x01, 0xd3, 0x06, 0xac, 0x0d, 0xb9,
+0x0b, 0x00, 0x82, 0x02, 0x81, 0x05, 0x9c, 0x06, 0xb5, 0x20, 0x9d, 0x24, 0xe6, 0x18, 0x97, 0x04,
+0xee, 0x07, 0xfe, 0x02, 0xb7, 0x0b, 0xa1, 0x0f, 0xa4, 0x23, 0x72, 0xf0, 0x01, 0x74, 0x90, 0x3b,
+0xf1, 0x16, 0x90, 0x12, 0xa0, 0x05, 0x93, 0x05, 0x82, 0x0a, 0xd7, 0x2f, 0xb9, 0x5d, 0xe7, 0x03,
+0xb9, 0x03, 0x80, 0x05, 0xf1, 0x0b, 0xb0, 0x21, 0xcf, 0x45, 0xd0, 0x07, 0xdd, 0x03, 0xdb, 0x01,
+0xc5, 0x02, 0xf2, 0x16, 0x7a, 0xf4, 0x01, 0xe5, 0x01, 0xd1, 0x01, 0xd8, 0x02, 0xc8, 0x1d, 0x7a,
+0x79, 0xf0, 0x01, 0x93, 0x08, 0xe5, 0x09, 0xd7, 0x2f, 0xeb, 0x17, 0xf4, 0x01, 0xf9, 0x01, 0xf8,
+0x07, 0x09, 0xf2, 0x16, 0xa5, 0x0e, 0xc6, 0x09, 0xd7, 0x02, 0x85, 0x01, 0x4b, 0xa2, 0x0f, 0xa0,
+0x0f, 0xef, 0x02, 0x7b, 0xce, 0x05, 0xb0, 0x03, 0xc2, 0x5c, 0xc6, 0x09, 0xbd, 0x0a, 0xfe, 0x02,
+0xd5, 0x0b, 0x9b, 0x03, 0xd5, 0x44, 0xcb, 0x08, 0xe7, 0x03, 0x0a, 0xae, 0x06, 0xab, 0x04, 0xec,
+0x17, 0xcc, 0x08, 0xca, 0x08, 0xde, 0x03, 0xe8, 0x03, 0x90, 0x0c, 0xec, 0x17, 0x82, 0x14, 0xf3,
+0x01, 0xaf, 0x05, 0x8d, 0x04, 0xd9, 0x02, 0xb9, 0x0b, 0xf0, 0x2b, 0x9f, 0x0f, 0x9b, 0x06, 0xbf,
+0x04, 0xd3, 0x06, 0x91, 0x26, 0xca, 0x46, 0xc3, 0x1e, 0xad, 0x03, 0xc8, 0x07, 0x91, 0x03, 0x7a,
+0xfe, 0x3d, 0xaf, 0x21, 0xd8, 0x02, 0xe1, 0x05, 0xb6, 0x09, 0xc7, 0x1d, 0xe0, 0x19, 0x95, 0x11,
+0xbf, 0x01, 0x9b, 0x03, 0xc1, 0x03, 0xdd, 0x05, 0xbe, 0x1f, 0xc6, 0x09, 0xb5, 0x01, 0xe8, 0x03,
+0xe1, 0x02, 0x90, 0x12, 0x96, 0x3a, 0xd4, 0x1b, 0x44, 0xed, 0x04, 0xc2, 0x06, 0x9c, 0x10, 0x9e,
+0x24, 0x79, 0x88, 0x03, 0x81, 0x02, 0xbb, 0x02, 0xd1, 0x30, 0xe5, 0x41, 0xf1, 0x16, 0xae, 0x09,
+0x9a, 0x01, 0x5f, 0xfb, 0x29, 0x83, 0x52, 0xcd, 0x1c, 0xcd, 0x08, 0xd3, 0x01, 0xfd, 0x05, 0xe7,
+0x2c, 0xa5, 0x0e, 0xc5, 0x09, 0x09, 0x9e, 0x05, 0xea, 0x08, 0xe8, 0x2c, 0xb1, 0x4a, 0xc9, 0x08,
+0xb2, 0x02, 0xd0, 0x02, 0xf4, 0x05, 0xec, 0x17, 0xe9, 0x55, 0x95, 0x11, 0x9d, 0x02, 0xa1, 0x04,
+0x81, 0x05, 0x8b, 0x27, 0xa7, 0x37, 0xdb, 0x05, 0xb4, 0x04, 0xa2, 0x04, 0x9d, 0x02, 0xce, 0x1c,
+0xd5, 0x44, 0xd0, 0x07, 0xc0, 0x01, 0x8c, 0x05, 0xf2, 0x0b, 0xd5, 0x06, 0xf5, 0x2a, 0xd5, 0x06,
+0x74, 0xc4, 0x02, 0x8b, 0x05, 0x9e, 0x24, 0x9d, 0x24, 0x79, 0x85, 0x07, 0x55, 0x90, 0x04, 0x90,
+0x12, 0xe2, 0x04, 0xcc, 0x08, 0x90, 0x04, 0x37, 0xdb, 0x07, 0x7a, 0xa5, 0x4c, 0xf6, 0x15, 0xcc,
+0x03, 0x2f, 0xeb, 0x02, 0xb3, 0x0c, 0xa3, 0x23, 0xfe, 0x14, 0x39, 0xff, 0x02, 0xb2, 0x05, 0xe2,
+0x04, 0xab, 0x22, 0xba, 0x0b, 0x93, 0x05, 0x85, 0x01, 0x6a, 0x79, 0xd3, 0x1b, 0xda, 0x1a, 0x94,
+0x02, 0xd3, 0x06, 0xb3, 0x07, 0xc3, 0x09, 0x97, 0x25, 0xac, 0x0d, 0xb1, 0x02, 0xb2, 0x02, 0x1c,
+0xe8, 0x03, 0x8d, 0x27, 0x90, 0x12, 0x97, 0x04, 0xc3, 0x05, 0xa1, 0x01, 0xe8, 0x03, 0xdb, 0x2e,
+0xf2, 0x16, 0xa0, 0x07, 0x95, 0x02, 0xff, 0x02, 0xf7, 0x15, 0xe1, 0x42, 0x00, 0xa3, 0x03, 0xac,
+0x04, 0xa1, 0x04, 0xd4, 0x1b, 0x83, 0x3d, 0xf3, 0x01, 0xdb, 0x04, 0xe5, 0x01, 0xb8, 0x06, 0xe6,
+0x18, 0x97, 0x3a, 0xfd, 0x14, 0x88, 0x03, 0xcb, 0x03, 0xe5, 0x01, 0xab, 0x0d, 0xa7, 0x60, 0xd9,
+0x1a, 0xf1, 0x03, 0x1d, 0xa5, 0x08, 0x79, 0xaf, 0x36, 0xc5, 0x09, 0x74, 0x58, 0xa8, 0x05, 0x7a,
+0xa5, 0x4c, 0xe9, 0x17, 0xac, 0x04, 0xd8, 0x02, 0xef, 0x01, 0xb9, 0x0b, 0xb7, 0x72, 0xe5, 0x18,
+0xf5, 0x02, 0xd6, 0x03, 0xf6, 0x02, 0xea, 0x03, 0xe9, 0x55, 0xb3, 0x0c, 0xe1, 0x02, 0x12, 0xdb,
+0x01, 0xa9, 0x37, 0xe5, 0x56, 0x79, 0xe5, 0x01, 0xc0, 0x01, 0xb8, 0x03, 0x97, 0x25, 0xe1, 0x6b,
+0xf8, 0x15, 0x9a, 0x06, 0xd2, 0x01, 0xdc, 0x01, 0xdf, 0x19, 0xe7, 0x6a, 0xd4, 0x1b, 0x4e, 0x26,
+0xf0, 0x01, 0xf1, 0x16, 0xaf, 0x88, 0x01, 0x8e, 0x27, 0x8d, 0x07, 0xab, 0x01, 0x98, 0x04, 0xa3,
+0x23, 0xdd, 0x6c, 0x9e, 0x24, 0x42, 0xb4, 0x02, 0x85, 0x04, 0xd3, 0x1b, 0x81, 0x52, 0x90, 0x12,
+0x86, 0x01, 0xa2, 0x01, 0x85, 0x01, 0xdd, 0x05, 0xb3, 0x5e, 0xe0, 0x19, 0x8f, 0x01, 0xc6, 0x02,
+0x71, 0xb4, 0x0c, 0xbd, 0x48, 0xb8, 0x0b, 0x28, 0xb6, 0x01, 0x26, 0xc4, 0x09, 0xd1, 0x30, 0xb4,
+0x0c, 0x09, 0xec, 0x02, 0x0a, 0xba, 0x0b, 0xd5, 0x44, 0xb2, 0x0c, 0x86, 0x01, 0x9f, 0x02, 0x2f,
+0xee, 0x02, 0x89, 0x3c, 0xc4, 0x09, 0xeb, 0x02, 0xfa, 0x01, 0x25, 0x00, 0x83, 0x3d, 0x96, 0x11,
+0xe6, 0x01, 0x69, 0x1d, 0xdc, 0x05, 0xa5, 0x4c, 0xa2, 0x0f, 0x4d, 0x4c, 0x00, 0xf8, 0x15, 0xe9,
+0x2c, 0xc4, 0x09, 0x37, 0x41, 0x8b, 0x02, 0xa8, 0x0e, 0xa1, 0x38, 0xd6, 0x06, 0x85, 0x01, 0x2f,
+0x26, 0xaa, 0x22, 0x97, 0x3a, 0xd2, 0x07, 0x7c, 0x8f, 0x04, 0xfa, 0x01, 0x00, 0xd9, 0x43, 0xd1,
+0x07, 0x55, 0x2f, 0x90, 0x01, 0xdc, 0x05, 0x99, 0x4e, 0xbd, 0x0a, 0x1c, 0xa3, 0x03, 0x95, 0x02,
+0x00, 0x9f, 0x4d, 0xe1, 0x04, 0x6a, 0xb5, 0x01, 0xb1, 0x02, 0xed, 0x02, 0xbf, 0x71, 0xe7, 0x03,
+0x1c, 0xf8, 0x01, 0x57, 0xd6, 0x06, 0xa5, 0x75, 0xdd, 0x05, 0xa1, 0x01, 0x74, 0xd7, 0x02, 0xc6,
+0x09, 0xb7, 0x49, 0xe7, 0x03, 0x26, 0x8e, 0x01, 0xef, 0x01, 0x9a, 0x10, 0xd7, 0x58, 0xd5, 0x06,
+0x13, 0x14, 0x3a, 0xe8, 0x03, 0xb5, 0x35, 0xf4, 0x01, 0x1e, 0x30, 0x44, 0x7a, 0xcd, 0x45, 0xd0,
+0x07, 0xbf, 0x01, 0x2f, 0x86, 0x01, 0xc3, 0x09, 0xff, 0x3d, 0xba, 0x0b, 0x5f, 0x09, 0xf5, 0x02,
+0xc3, 0x09, 0xf9, 0x29, 0xca, 0x08, 0x99, 0x01, 0xd1, 0x01, 0x6a, 0xbf, 0x0a, 0xe3, 0x2d, 0xfe,
+0x14, 0x71, 0x13, 0x4c, 0xb7, 0x0b, 0xe5, 0x18, 0xc4, 0x09, 0x26, 0x30, 0xdc, 0x01, 0xfd, 0x14,
+0xcd, 0x1c, 0xcc, 0x08, 0x1e, 0xdc, 0x01, 0x6a, 0xd5, 0x06, 0x83, 0x14, 0xd6, 0x06, 0x08, 0xde,
+0x01, 0x39, 0xa7, 0x0e, 0xd3, 0x1b, 0xc4, 0x09, 0x0a, 0xbe, 0x01, 0x42, 0xe1, 0x04, 0x95, 0x11,
+0xcc, 0x08, 0x90, 0x01, 0xd4, 0x01, 0x6a, 0xc9, 0x08, 0x93, 0x11, 0xd0, 0x07, 0x55, 0x26, 0xdc,
+0x01, 0xf4, 0x01, 0x95, 0x11, 0x94, 0x11, 0x7b, 0xe6, 0x01, 0x97, 0x01, 0x00, 0xad, 0x0d, 0xb4,
+0x0c, 0xc8, 0x01, 0x55, 0x72, 0xca, 0x08, 0xab, 0x0d, 0xdc, 0x05, 0x11, 0x8f, 0x01, 0xe6, 0x01,
+0xf4, 0x01, 0xa1, 0x0f, 0xe7, 0x03, 0x13, 0xb5, 0x01, 0x25, 0xca, 0x08, 0xc3, 0x09, 0xee, 0x02,
+0x13, 0x4b, 0xab, 0x01, 0xde, 0x05, 0xcf, 0x07, 0xe2, 0x04, 0xa4, 0x01, 0xe5, 0x01, 0x39, 0xa6,
+0x0e, 0xb9, 0x0b, 0xd8, 0x06, 0x3a, 0x13, 0xe5, 0x01, 0xee, 0x02, 0xab, 0x0d, 0x94, 0x11, 0x5f,
+0x00, 0x5f, 0xee, 0x02, 0xf3, 0x01, 0xd2, 0x07, 0x38, 0x56, 0xb6, 0x01, 0xea, 0x03, 0xf4, 0x01,
+0x88, 0x13, 0x2f, 0x14, 0xa1, 0x01, 0xee, 0x02, 0xa6, 0x0e, 0xd8, 0x06, 0x11, 0x25, 0x60, 0xf3,
+0x01, 0xde, 0x05, 0xe2, 0x04, 0x13, 0x73, 0x4c, 0xdc, 0x05, 0xef, 0x02, 0xd0, 0x07, 0x4e, 0x41,
+0x00, 0xe2, 0x04, 0xe4, 0x04, 0xca, 0x08, 0x7c, 0x98, 0x01, 0x14, 0xf4, 0x01, 0xf3, 0x01, 0xee,
+0x02, 0x43, 0x26, 0x1c, 0xe8, 0x03, 0xcb, 0x08, 0xd8, 0x06, 0x00, 0x1e, 0x6a, 0xe7, 0x03, 0xc3,
+0x09, 0xe2, 0x04, 0x07, 0xd2, 0x01, 0x43, 0xbd, 0x0a, 0x7a, 0xf2, 0x16, 0x38, 0x13, 0x71, 0xad,
+0x0d, 0x7a, 0xfe, 0x14, 0x86, 0x01, 0x58, 0x26, 0x8d, 0x12, 0xf3, 0x01, 0x88, 0x13, 0x67, 0x8f,
+0x01, 0xbf, 0x01, 0x83, 0x14, 0xbe, 0x0a, 0xce, 0x1c, 0x73, 0x8f, 0x01, 0x14, 0x8f, 0x12, 0xae,
+0x0d, 0xe0, 0x19, 0x74, 0x09, 0x68, 0xb1, 0x0c, 0xb2, 0x0c, 0x90, 0x12, 0x98, 0x01, 0x2f, 0x00,
+0x8f, 0x12, 0xa2, 0x0f, 0xcc, 0x08, 0x0a, 0x1b, 0x26, 0xa7, 0x0e, 0xa6, 0x0e, 0xb8, 0x0b, 0x3a,
+0x13, 0x14, 0xc3, 0x09, 0xba, 0x0b, 0xb2, 0x0c, 0xb6, 0x01, 0x44, 0xa2, 0x01, 0xcf, 0x07, 0xed,
+0x02, 0x9c, 0x10, 0x39, 0x25, 0x6a, 0x79, 0x79, 0x8a, 0x13, 0x14, 0xc8, 0x01, 0x55, 0x7a, 0xe3,
+0x04, 0xac, 0x0d, 0x38, 0x9a, 0x01, 0x26, 0xd6, 0x06, 0xbd, 0x0a, 0x9c, 0x10, 0xa7, 0x02, 0x72,
+0x9a, 0x01, 0x79, 0x00, 0xca, 0x08, 0x4c, 0x8c, 0x02, 0x73, 0xdc, 0x05, 0xf3, 0x01, 0x96, 0x11,
+0x44, 0xe4, 0x02, 0x00, 0xc4, 0x09, 0x90, 0x12, 0x9e, 0x24, 0x72, 0x4c, 0x2f, 0x8a, 0x13, 0xda,
+0x1a, 0xfc, 0x29, 0xe8, 0x03, 0xc0, 0x01, 0x37, 0xf8, 0x15, 0xe0, 0x19, 0xde, 0x2e, 0xea, 0x03,
+0x00, 0x1d, 0x90, 0x12, 0xa6, 0x0e, 0xaa, 0x22, 0x09, 0x5f, 0xb6, 0x01, 0xc2, 0x1e, 0xb4, 0x0c,
+0xfc, 0x29, 0x00, 0x0a, 0xa7, 0x02, 0xe6, 0x18, 0xc4, 0x09, 0xaa, 0x22, 0x81, 0x05, 0xb5, 0x01,
+0x12, 0xf2, 0x16, 0xba, 0x0b, 0xaa, 0x22, 0x96, 0x02, 0x56, 0xcb, 0x03, 0xac, 0x0d, 0x9b, 0x10,
+0x84, 0x14, 0xa5, 0x03, 0xcb, 0x03, 0xfa, 0x01, 0x7a, 0x8f, 0x12, 0xe6, 0x18, 0x2f, 0xa1, 0x04,
+0x90, 0x01, 0xb7, 0x0b, 0xab, 0x0d, 0xdc, 0x05, 0xed, 0x01, 0xb1, 0x02, 0x3a, 0xe1, 0x04, 0x83,
+0x14, 0xd8, 0x06, 0xee, 0x01, 0x83, 0x02, 0x86, 0x01, 0xb9, 0x0b, 0xdc, 0x05, 0xcb, 0x08, 0x85,
+0x01, 0x67, 0x57, 0xc9, 0x08, 0xd6, 0x06, 0xc9, 0x08, 0x26, 0x99, 0x01, 0x28, 0xc3, 0x09, 0xc0,
+0x0a, 0xd5, 0x06, 0x86, 0x04, 0x82, 0x02, 0x69, 0xc5, 0x09, 0xee, 0x02, 0xed, 0x02, 0xde, 0x03,
+0xaa, 0x02, 0xd1, 0x01, 0xab, 0x0d, 0xed, 0x02, 0xb8, 0x0b, 0x4e, 0xae, 0x03, 0x4d, 0xdd, 0x05,
+0xee, 0x02, 0x94, 0x26, 0x98, 0x01, 0xcc, 0x03, 0x7e, 0xed, 0x02, 0xdb, 0x05, 0x98, 0x25, 0x92,
+0x03, 0xd6, 0x03, 0x1d, 0xdb, 0x05, 0x8f, 0x12, 0xf2, 0x16, 0x1e, 0xac, 0x01, 0x25, 0xd5, 0x06,
+0xa9, 0x22, 0xd4, 0x1b, 0x73, 0x25, 0x72, 0x7a, 0xd7, 0x2f, 0x88, 0x28, 0xf3, 0x02, 0xab, 0x04,
+0x8e, 0x02, 0xe1, 0x04, 0x89, 0x13, 0xae, 0x36, 0xb1, 0x05, 0xc9, 0x09, 0x82, 0x02, 0xa7, 0x0e,
+0xba, 0x0b, 0xf4, 0x2a, 0x30, 0x8d, 0x04, 0x85, 0x01, 0xdf, 0x19, 0x9a, 0x10, 0xf0, 0x2b, 0x72,
+0x99, 0x01, 0xf5, 0x02, 0x83, 0x14, 0x96, 0x11, 0x8a, 0x13, 0x8a, 0x03, 0xa2, 0x01, 0xd5, 0x03,
+0x87, 0x13, 0xbe, 0x0a, 0xee, 0x02, 0x7c, 0xe6, 0x01, 0x58, 0xad, 0x0d, 0x90, 0x12, 0x7a, 0xc0,
+0x01, 0x86, 0x04, 0x2f, 0xb7, 0x0b, 0xf3, 0x01, 0xca, 0x08, 0x4d, 0xdc, 0x01, 0xd8, 0x02, 0xad,
+0x0d, 0xed, 0x02, 0xa2, 0x0f, 0x0a, 0x1b, 0x42, 0x8f, 0x12, 0xbf, 0x0a, 0x94, 0x11, 0x82, 0x02,
+0x98, 0x01, 0xa6, 0x03, 0xcf, 0x07, 0xd5, 0x06, 0xd8, 0x06, 0xec, 0x02, 0x37, 0xaa, 0x02, 0xc0,
+0x0a, 0xe1, 0x04, 0xca, 0x08, 0x0a, 0x7c, 0x08, 0xb2, 0x0c, 0xc3, 0x09, 0xe8, 0x03, 0xdb, 0x01,
+0x26, 0x8c, 0x02, 0xfe, 0x14, 0xdd, 0x05, 0x84, 0x14, 0xc8, 0x01, 0x85, 0x01, 0x1e, 0xa0, 0x0f,
+0xd5, 0x06, 0xec, 0x17, 0x60, 0x4b, 0xe2, 0x02, 0xea, 0x03, 0xb4, 0x0c, 0xa2, 0x0f, 0xe6, 0x01,
+0x7c, 0xa1, 0x01, 0xbe, 0x0a, 0xf0, 0x16, 0x98, 0x25, 0xa0, 0x02, 0xb8, 0x03, 0x9b, 0x03, 0x8a,
+0x13, 0xae, 0x0d, 0x88, 0x28, 0x9a, 0x01, 0xda, 0x02, 0xf9, 0x01, 0x94, 0x11, 0xe7, 0x03, 0x92,
+0x26, 0x42, 0xdc, 0x01, 0xbf, 0x01, 0xda, 0x1a, 0xa5, 0x23, 0xe4, 0x2d, 0x82, 0x02, 0xb4, 0x04,
+0xcf, 0x04, 0xca, 0x1d, 0x8f, 0x3b, 0x9e, 0x24, 0xb4, 0x02, 0x71, 0x5e, 0xfc, 0x14, 0xa1, 0x38,
+0xd4, 0x1b, 0x13, 0xc1, 0x03, 0x28, 0xb2, 0x21, 0xf7, 0x3e, 0x94, 0x26, 0x09, 0xc5, 0x05, 0x26,
+0xbe, 0x0a, 0x8b, 0x3c, 0xe4, 0x2d, 0x41, 0xe3, 0x04, 0x8c, 0x02, 0xee, 0x02, 0xd7, 0x2f, 0xbc,
+0x1f, 0x7d, 0xd1, 0x01, 0xb1, 0x02, 0x83, 0x14, 0xb3, 0x35, 0xd4, 0x1b, 0xf7, 0x17, 0xaf, 0x03,
+0xe3, 0x0a, 0x9b, 0xa0, 0x01, 0xc9, 0x08, 0xf4, 0x68, 0xf4, 0x10, 0xa9, 0x07, 0xe8, 0x06, 0x93,
+0x11, 0xa7, 0x37, 0xcf, 0x07, 0xb4, 0x0a, 0xb7, 0x03, 0x90, 0x0c, 0x00, 0xe9, 0x2c, 0xbd, 0x1f,
+0xcf, 0x02, 0xc7, 0x07, 0x8e, 0x01, 0xa5, 0x23, 0x9e, 0x24, 0xdf, 0x19, 0x56, 0xd1, 0x07, 0x3a,
+0x99, 0x10, 0x80, 0x3e, 0xff, 0x28, 0x60, 0xe9, 0x02, 0x25, 0xef, 0x02, 0xd2, 0x59, 0x85, 0x3d,
+0x60, 0xa8, 0x05, 0x39, 0xf3, 0x01, 0xc2, 0x5c, 0xb3, 0x35, 0x26, 0xba, 0x08, 0xfb, 0x08, 0xab,
+0x0d, 0xec, 0x40, 0x97, 0x25, 0xc6, 0x02, 0x84, 0x07, 0xd3, 0x01, 0xeb, 0x17, 0xe8, 0x41, 0x9f,
+0x24, 0xe2, 0x02, 0xcc, 0x0b, 0x26, 0xbd, 0x0a, 0x8e, 0x27, 0xc3, 0x09, 0xa0, 0x02, 0x92, 0x06,
+0x9a, 0x01, 0x7a, 0xaa, 0x22, 0xd0, 0x07, 0xf0, 0x01, 0x4d, 0xc6, 0x02, 0xbe, 0x0a, 0xce, 0x1c,
+0xbe, 0x1f, 0xb6, 0x01, 0x91, 0x03, 0xac, 0x01, 0x8a, 0x13, 0x9c, 0x10, 0xce, 0x1c, 0x60, 0x25,
+0xca, 0x01, 0x8e, 0x12, 0x79, 0xc8, 0x1d, 0x55, 0x9a, 0x01, 0x39, 0x9c, 0x10, 0x83, 0x14, 0xa6,
+0x0e, 0x12, 0x98, 0x01, 0x55, 0xfe, 0x14, 0xef, 0x2b, 0xd6, 0x1b, 0xfa, 0x01, 0xba, 0x03, 0x8b,
+0x02, 0xf2, 0x16, 0xd7, 0x2f, 0xc2, 0x1e, 0xf4, 0x05, 0xc8, 0x04, 0xeb, 0x02, 0xe6, 0x18, 0xc7,
+0x1d, 0x9a, 0x10, 0xd6, 0x03, 0xc2, 0x03, 0xff, 0x02, 0xee, 0x2b, 0xc5, 0x32, 0xe6, 0x18, 0x56,
+0x5f, 0x41, 0x94, 0x26, 0xb9, 0x34, 0xa6, 0x23, 0xb9, 0x03, 0xf7, 0x04, 0x12, 0xe6, 0x18, 0xcd,
+0x1c, 0xb0, 0x21, 0xbd, 0x01, 0xfb, 0x03, 0x3a, 0xe0, 0x19, 0xc1, 0x1e, 0xba, 0x34, 0xa5, 0x03,
+0x99, 0x0c, 0xdc, 0x04, 0xb9, 0x0b, 0xb2, 0x0c, 0xf0, 0x2b, 0xf9, 0x01, 0xcb, 0x0b, 0x60, 0x93,
+0x11, 0xf0, 0x2b, 0xa0, 0x0f, 0xc0, 0x01, 0xb3, 0x07, 0xbe, 0x01, 0xb1, 0x21, 0xfa, 0x67, 0x93,
+0x11, 0xbe, 0x04, 0xfd, 0x02, 0x25, 0xc9, 0x31, 0xbe, 0x71, 0xc9, 0x1d, 0xd0, 0x02, 0xc8, 0x01,
+0xb5, 0x01, 0xdf, 0x19, 0xf8, 0x53, 0xab, 0x0d, 0x09, 0x7b, 0xca, 0x01, 0xf5, 0x2a, 0xa2, 0x61,
+0xf8, 0x15, 0xb1, 0x02, 0x87, 0x03, 0xdc, 0x01, 0xcd, 0x1c, 0xde, 0x6c, 0xea, 0x2c, 0xc0, 0x01,
+0xbf, 0x01, 0x86, 0x01, 0xd1, 0x07, 0xfc, 0x52, 0xe6, 0x18, 0xfe, 0x02, 0x8c, 0x02, 0x09, 0x8a,
+0x13, 0xe2, 0x6b, 0x9a, 0x10, 0xc2, 0x03, 0xb2, 0x05, 0xbb, 0x02, 0x88, 0x28, 0xb0, 0x5f, 0x79,
+0x90, 0x01, 0x9e, 0x05, 0x09, 0x80, 0x29, 0xa8, 0x37, 0xf3, 0x01, 0x11, 0x9e, 0x05, 0x44, 0xba,
+0x34, 0xc6, 0x32, 0xbe, 0x0a, 0x1c, 0xd4, 0x06, 0x82, 0x02, 0x98, 0x3a, 0xb2, 0x0c, 0xe6, 0x18,
+0x9a, 0x01, 0xa6, 0x03, 0x96, 0x02, 0x9e, 0x24, 0xe1, 0x04, 0x9c, 0x10, 0xa2, 0x01, 0xf0, 0x01,
+0x72, 0xbc, 0x1f, 0xe5, 0x18, 0xa2, 0x0f, 0xe2, 0x02, 0xce, 0x02, 0x67, 0xe0, 0x19, 0xff, 0x28,
+0xc5, 0x09, 0xc6, 0x05, 0xe0, 0x03, 0xd1, 0x04, 0xfd, 0x14, 0xc3, 0x1e, 0xb5, 0x20, 0xd8, 0x05,
+0x90, 0x01, 0x9d, 0x05, 0x83, 0x3d, 0xa9, 0x4b, 0xb1, 0x4a, 0xb2, 0x02, 0x38, 0xeb, 0x02, 0x99,
+0x4e, 0xff, 0x3d, 0xf5, 0x53, 0xf9, 0x01, 0x9d, 0x05, 0x72, 0xbf, 0x33, 0xf7, 0x15, 0xd7, 0x2f,
+0xe1, 0x02, 0xc9, 0x06, 0x4c, 0x8d, 0x50, 0xa5, 0x0e, 0xe3, 0x2d, 0xbb, 0x02, 0xf3, 0x0b, 0x5d,
+0xf3, 0x68, 0x79, 0xd7, 0x2f, 0xdb, 0x04, 0xfb, 0x08, 0x98, 0x01, 0xad, 0x36, 0xc2, 0x1e, 0xd3,
+0x1b, 0xf0, 0x01, 0x8b, 0x05, 0x30, 0xad, 0x36, 0xda, 0x43, 0x97, 0x25, 0x09, 0xdb, 0x04, 0x11,
+0x81, 0x29, 0xda, 0x58, 0xe5, 0x18, 0xb1, 0x02, 0xd9, 0x04, 0x99, 0x01, 0xd9, 0x1a, 0xe2, 0x42,
+0xdc, 0x05, 0x9a, 0x01, 0x5f, 0x3a, 0xdd, 0x2e, 0x8e, 0x50, 0x94, 0x26, 0xa8, 0x02, 0xc6, 0x02,
+0xb2, 0x02, 0xfd, 0x3d, 0xea, 0x55, 0x9a, 0x4e, 0xf5, 0x15, 0x69, 0xa9, 0x12, 0xbd, 0xaf, 0x01,
+0xfa, 0x67, 0xfa, 0x90, 0x01, 0xca, 0x1c, 0xc2, 0x06, 0x9e, 0x10, 0x84, 0x14, 0xc1, 0x1e, 0xf6,
+0x2a, 0xfe, 0x08, 0x94, 0x05, 0xa8, 0x05, 0xac, 0x0d, 0xc1, 0x1e, 0xc0, 0x33, 0x9e, 0x05, 0xa2,
+0x04, 0x90, 0x01, 0xfe, 0x14, 0x8f, 0x12, 0xd4, 0x1b, 0xc0, 0x01, 0xf8, 0x01, 0xa4, 0x06, 0x84,
+0x14, 0xcd, 0x1c, 0xcf, 0x07, 0x9d, 0x05, 0xb0, 0x03, 0x9e, 0x05, 0xb4, 0x35, 0xe3, 0x2d, 0xb9,
+0x0b, 0x89, 0x03, 0xf8, 0x04, 0xe8, 0x06, 0xbe, 0x48, 0xdd, 0x2e, 0x9f, 0x0f, 0xdd, 0x03, 0x13,
+0xb2, 0x05, 0xd4, 0x44, 0xe1, 0x04, 0xfc, 0x14, 0xeb, 0x02, 0xd3, 0x03, 0xac, 0x01, 0x9e, 0x39,
+0x9c, 0x10, 0xa0, 0x24, 0xa5, 0x03, 0xcf, 0x02, 0xa2, 0x01, 0xac, 0x4b, 0x8a, 0x3c, 0xc4, 0x47,
+0x85, 0x01, 0x99, 0x01, 0xa2, 0x04, 0x94, 0x4f, 0xc2, 0x5c, 0x88, 0x51, 0xb2, 0x02, 0x94, 0x03,
+0xd7, 0x02, 0xb2, 0x4a, 0xe4, 0x56, 0xd2, 0x30, 0xcc, 0x03, 0xaa, 0x04, 0xbf, 0x01, 0x9a, 0x77,
+0x8e, 0x50, 0x90, 0x3b, 0xe0, 0x03, 0x8a, 0x03, 0xab, 0x04, 0xaa, 0x60, 0xcc, 0x31, 0xb0, 0x21,
+0x9c, 0x03, 0x08, 0xa1, 0x04, 0x8e, 0x50, 0xf4, 0x01, 0xb8, 0x20, 0x96, 0x02, 0x60, 0xb9, 0x05,
+0x9c, 0x39, 0xfd, 0x14, 0x8e, 0x12, 0xa2, 0x01, 0xcd, 0x02, 0xe7, 0x03, 0x86, 0x3d, 0x91, 0x26,
+0xf6, 0x2a, 0xa4, 0x06, 0x9d, 0x08, 0xff, 0x02, 0xa0, 0x0f, 0xfb, 0x52, 0xce, 0x1c, 0x96, 0x0a,
+0xd7, 0x05, 0x2f, 0xd5, 0x06, 0xfd, 0x52, 0xa8, 0x0e, 0x55, 0x83, 0x04, 0xe7, 0x06, 0xdb, 0x43,
+0xf3, 0x68, 0xbe, 0x0a, 0x85, 0x01, 0xdb, 0x07, 0xbb, 0x02, 0xd1, 0x59, 0xdb, 0x6c, 0xdf, 0x19,
+0x11, 0x8f, 0x06, 0x74, 0xa7, 0x37, 0xf7, 0x3e, 0xed, 0x40, 0xcc, 0x08, 0x2f, 0xe2, 0x02, 0x91,
+0x3b, 0xe1, 0x42, 0xe5, 0xa8, 0x01, 0x8c, 0x05, 0x8c, 0x02, 0x56, 0x99, 0x4e, 0x87, 0x51, 0xf9,
+0xa5, 0x01, 0xb5, 0x01, 0xb9, 0x03, 0xeb, 0x02, 0xa5, 0x4c, 0xb7, 0x49, 0xdd, 0x57, 0xa1, 0x04,
+0xa7, 0x02, 0xb5, 0x01, 0xcf, 0x6e, 0xed, 0x69, 0xef, 0x54, 0x9b, 0x03, 0xa0, 0x02, 0x00, 0xd5,
+0x6d, 0x91, 0x64, 0xf1, 0x54, 0x8c, 0x05, 0xce, 0x05, 0x60, 0xed, 0x40, 0xc3, 0x47, 0xa9, 0x4b,
+0xbc, 0x02, 0xa6, 0x03, 0x56, 0x83, 0x3d, 0xfb, 0x52, 0xf9, 0x67, 0x0a, 0xd2, 0x01, 0xcc, 0x03,
+0xa3, 0x23, 0xf1, 0x3f, 0xb5, 0x35, 0xab, 0x04, 0xb5, 0x01, 0x94, 0x08, 0x00, 0x95, 0x11, 0xed,
+0x02, 0xa3, 0x06, 0x81, 0x02, 0xba, 0x05, 0xca, 0x08, 0xbe, 0x0a, 0xd2, 0x07, 0x9f, 0x02, 0x2f,
+0xa8, 0x05, 0xd6, 0x06, 0xf0, 0x2b, 0xac, 0x0d, 0xe6, 0x01, 0xd8, 0x02, 0xc0, 0x01, 0x8a, 0x13,
+0xd8, 0x2f, 0x7a, 0xd6, 0x03, 0x9e, 0x05, 0x41, 0xf8, 0x15, 0xda, 0x1a, 0xbd, 0x0a, 0xe2, 0x02,
+0xb0, 0x03, 0xf9, 0x01, 0x98, 0x25, 0xce, 0x1c, 0xcb, 0x08, 0xf8, 0x01, 0xd4, 0x03, 0x09, 0xf6,
+0x2a, 0xc8, 0x1d, 0xb4, 0x0c, 0x44, 0x56, 0x92, 0x03, 0xcc, 0x31, 0xbc, 0x1f, 0x84, 0x14, 0x95,
+0x02, 0xb1, 0x02, 0xe4, 0x02, 0x92, 0x26, 0xac, 0x22, 0xb2, 0x0c, 0x98, 0x01, 0xe7, 0x03, 0xad,
+0x01, 0xdc, 0x43, 0xf8, 0x15, 0xae, 0x0d, 0x5d, 0x8d, 0x04, 0xb1, 0x02, 0xf2, 0x3f, 0x83, 0x14,
+0xce, 0x1c, 0xdd, 0x01, 0xa5, 0x03, 0xab, 0x01, 0x94, 0x26, 0xcb, 0x31, 0x9e, 0x24, 0x14, 0x1b,
+0x41, 0x86, 0x28, 0x87, 0x51, 0xe8, 0x41, 0x14, 0x8e, 0x01, 0x73, 0x96, 0x11, 0xf1, 0x54, 0xae,
+0x5f, 0xbb, 0x10, 0xed, 0x04, 0xc5, 0x0d, 0x87, 0x51, 0x81, 0x14, 0xf2, 0x7d, 0xae, 0x06, 0xe3,
+0x04, 0xfc, 0x06, 0xa6, 0x0e, 0xf9, 0x67, 0xc6, 0x70, 0xa0, 0x15, 0x90, 0x01, 0xf4, 0x0d, 0xbc,
+0x5d, 0xaf, 0x5f, 0xb6, 0x20, 0xec, 0x05, 0xd9, 0x02, 0xd4, 0x01, 0x88, 0x51, 0xf5, 0x2a, 0xa1,
+0x0f, 0x8e, 0x01, 0x9f, 0x02, 0x92, 0x03, 0x9e, 0x62, 0xfb, 0x52, 0xad, 0x36, 0xfd, 0x05, 0x93,
+0x02, 0xb1, 0x08, 0x7a, 0xd5, 0x6d, 0x97, 0x25, 0x07, 0xaf, 0x03, 0xe3, 0x0c, 0xbf, 0x5c, 0x9f,
+0x8b, 0x01, 0x83, 0x14, 0xf8, 0x01, 0xe1, 0x05, 0xf5, 0x02, 0x95, 0x4f, 0x8b, 0x65, 0xe8, 0x03,
+0xe5, 0x01, 0xbb, 0x02, 0x9c, 0x03, 0x81, 0x52, 0xbb, 0x1f, 0xc6, 0x09, 0x71, 0xe3, 0x04, 0xd8,
+0x05, 0xbf, 0x33, 0xe8, 0x41, 0xb9, 0x0b, 0x85, 0x04, 0xc7, 0x04, 0xc6, 0x07, 0xc9, 0x08, 0x86,
+0x66, 0xa5, 0x0e, 0xd7, 0x02, 0x99, 0x01, 0x84, 0x02, 0xd6, 0x06, 0xa2, 0xc8, 0x01, 0x9f, 0x24,
+0xd2, 0x04, 0xa4, 0x01, 0x55, 0x9c, 0x10, 0x80, 0xce, 0x01, 0x9b, 0x39, 0xa4, 0x06, 0x88, 0x0b,
+0x38, 0xac, 0x0d, 0xb8, 0x87, 0x01, 0xb3, 0x35, 0xe2, 0x05, 0xc8, 0x07, 0xd3, 0x03, 0xae, 0x0d,
+0xce, 0x83, 0x01, 0xd5, 0x44, 0xc8, 0x04, 0xde, 0x06, 0x8b, 0x02, 0x96, 0x11, 0xda, 0x43, 0xad,
+0x36, 0xb6, 0x01, 0x4c, 0xc5, 0x02, 0x94, 0x11, 0x96, 0x11, 0x97, 0x25, 0x26, 0xbf, 0x01, 0xc5,
+0x02, 0x9c, 0x10, 0xb1, 0x0c, 0xfd, 0x14, 0x30, 0xe3, 0x01, 0x39, 0xb0, 0x21, 0x83, 0x14, 0xf7,
+0x15, 0xba, 0x05, 0xbe, 0x01, 0xa7, 0x02, 0x88, 0x28, 0xfd, 0x14, 0xb1, 0x0c, 0xbe, 0x07, 0xdc,
+0x01, 0xab, 0x01, 0xac, 0x4b, 0xdb, 0x43, 0x82, 0x14, 0x84, 0x0a, 0x28, 0xa9, 0x02, 0xe8, 0x2c,
+0xdb, 0x6c, 0xf6, 0x2a, 0xff, 0x02, 0xe7, 0x06, 0xd6, 0x03, 0xb4, 0x0c, 0xbf, 0x5c, 0x98, 0x25,
+0xb3, 0x04, 0xb3, 0x07, 0xbc, 0x02, 0xcb, 0x08, 0xab, 0x89, 0x01, 0xda, 0x1a, 0x81, 0x0d, 0x93,
+0x08, 0xc9, 0x01, 0xab, 0x0d, 0xd3, 0x82, 0x01, 0x79, 0xe9, 0x08, 0xfd, 0x05, 0xed, 0x01, 0xb3,
+0x0c, 0x9f, 0x4d, 0xd9, 0x1a, 0xc1, 0x06, 0xf9, 0x01, 0x95, 0x02, 0xbd, 0x0a, 0xe9, 0x55, 0xcd,
+0x45, 0x12, 0xdd, 0x03, 0xd5, 0x03, 0xc9, 0x08, 0x9f, 0x4d, 0x91, 0x64, 0xc8, 0x07, 0xf0, 0x01,
+0xcb, 0x03, 0xed, 0x02, 0xad, 0x36, 0xf9, 0x3e, 0x88, 0x06, 0x69, 0x1e, 0xa7, 0x0e, 0xe3, 0x2d,
+0x85, 0x28, 0xa2, 0x01, 0xe1, 0x02, 0xb0, 0x05, 0xd9, 0x1a, 0x98, 0x25, 0x84, 0x14, 0x0a, 0xdf,
+0x03, 0xa8, 0x05, 0xa7, 0x0e, 0xca, 0x46, 0xc8, 0x1d, 0x90, 0x01, 0xad, 0x03, 0xcc, 0x03, 0xbb,
+0x1f, 0xaa, 0x60, 0xe6, 0x18, 0xac, 0x01, 0xc6, 0x02, 0xdb, 0x01, 0xb1, 0x0c, 0xd8, 0x58, 0xcb,
+0x08, 0x11, 0xba, 0x05, 0xe7, 0x03, 0x9b, 0x10, 0xb2, 0x21, 0x8d, 0x12, 0x72, 0xb0, 0x03, 0xb1,
+0x02, 0xa5, 0x0e, 0x9a, 0x10, 0xf4, 0x01, 0xa0, 0x02, 0xf2, 0x03, 0x09, 0xe2, 0x04, 0xdc, 0x05,
+0xa0, 0x0f, 0x42, 0x1c, 0x90, 0x01, 0xb8, 0x0b, 0x9c, 0x10, 0x82, 0x29, 0x3a, 0x99, 0x01, 0xee,
+0x01, 0x9c, 0x10, 0xca, 0x08, 0xc6, 0x32, 0x1b, 0x5f, 0x96, 0x02, 0x9e, 0x24, 0x7a, 0x92, 0x26,
+0x27, 0x0a, 0x26, 0xb2, 0x21, 0xf3, 0x01, 0xba, 0x0b, 0x41, 0x97, 0x01, 0x30, 0x90, 0x3b, 0x8a,
+0x13, 0xd6, 0x06, 0x9a, 0x01, 0xce, 0x02, 0x55, 0x9c, 0x39, 0x90, 0x12, 0xee, 0x02, 0xa6, 0x08,
+0x96, 0x02, 0xa7, 0x05, 0xa4, 0x23, 0xd5, 0x06, 0xe2, 0x04, 0xae, 0x09, 0xd0, 0x02, 0xe1, 0x02,
+0xe6, 0x18, 0x8f, 0x12, 0xe7, 0x03, 0xb2, 0x0a, 0xf8, 0x01, 0xc7, 0x04, 0x84, 0x14, 0xbb, 0x1f,
+0xbd, 0x0a, 0xba, 0x03, 0x95, 0x02, 0x91, 0x03, 0xee, 0x02, 0xdf, 0x19, 0xd1, 0x07, 0x12, 0xcd,
+0x02, 0xe1, 0x02, 0xdb, 0x05, 0xb1, 0x21, 0x81, 0x14, 0xdb, 0x04, 0x8b, 0x05, 0x42, 0x9d, 0x24,
+0xf3, 0x2a, 0xad, 0x36, 0xa9, 0x07, 0xa1, 0x0c, 0xd1, 0x01, 0x81, 0x29, 0xf3, 0x3f, 0x9d, 0x39,
+0xd7, 0x10, 0xdd, 0x09, 0xc8, 0x01, 0xe9, 0x2c, 0x89, 0x13, 0xcb, 0x31, 0xa1, 0x0c, 0xc3, 0x08,
+0x9a, 0x01, 0xd9, 0x1a, 0xb4, 0x0c, 0xab, 0x0d, 0x56, 0xb3, 0x04, 0xd2, 0x01, 0xcd, 0x1c, 0xbc,
+0x1f, 0xfe, 0x14, 0xa8, 0x05, 0xc5, 0x02, 0x2f, 0xf3, 0x2a, 0xa8, 0x37, 0x00, 0x98, 0x07, 0xcc,
+0x03, 0xeb, 0x02, 0x9f, 0x24, 0x94, 0x26, 0x95, 0x11, 0xbe, 0x07, 0xae, 0x03, 0x67, 0xef, 0x2b,
+0xb4, 0x35, 0xe3, 0x2d, 0xb4, 0x04, 0x9a, 0x04, 0x89, 0x03, 0x8b, 0x27, 0xd4, 0x1b, 0xb3, 0x35,
+0xdc, 0x01, 0xc6, 0x07, 0x11, 0xd3, 0x1b, 0xdb, 0x05, 0x9d, 0x24, 0xd4, 0x01, 0x8c, 0x02, 0x85,
+0x01, 0x93, 0x26, 0xf1, 0x16, 0xdf, 0x19, 0x86, 0x01, 0xc0, 0x01, 0x9e, 0x02, 0xd3, 0x1b, 0xbb,
+0x1f, 0x83, 0x14, 0x42, 0xac, 0x01, 0x60, 0xab, 0x0d, 0x89, 0x13, 0xe5, 0x18, 0xd7, 0x02, 0x1e,
+0xd0, 0x02, 0xb3, 0x0c, 0x89, 0x13, 0xfb, 0x29, 0x72, 0xa8, 0x02, 0x4c, 0xf3, 0x01, 0xd3, 0x1b,
+0xe7, 0x2c, 0xc5, 0x02, 0xf0, 0x01, 0x09, 0xed, 0x02, 0xe7, 0x03, 0x81, 0x29, 0xd1, 0x01, 0xf8,
+0x01, 0xca, 0x01, 0xe1, 0x04, 0xa7, 0x0e, 0x95, 0x3a, 0x0a, 0x81, 0x02, 0x13, 0xb3, 0x0c, 0xf1,
+0x16, 0xad, 0x36, 0x85, 0x01, 0x2f, 0x30, 0xd8, 0x06, 0xa9, 0x22, 0x8b, 0x3c, 0x8f, 0x01, 0x7c,
+0x9d, 0x02, 0xec, 0x17, 0xef, 0x2b, 0xff, 0x28, 0x97, 0x04, 0x85, 0x01, 0xf9, 0x01, 0xb8, 0x0b,
+0xa9, 0x22, 0xf7, 0x15, 0xe8, 0x03, 0x60, 0x26, 0xce, 0x1c, 0xc5, 0x32, 0xd9, 0x1a, 0xa0, 0x02,
+0x11, 0xe1, 0x02, 0xc8, 0x1d, 0xbb, 0x1f, 0xd3, 0x1b, 0xf2, 0x03, 0x27, 0xc5, 0x02, 0xa6, 0x23,
+0xa9, 0x22, 0xf7, 0x15, 0x56, 0x9d, 0x02, 0x37, 0xdc, 0x05, 0xdd, 0x05, 0xfd, 0x14, 0x4b, 0x26,
+0x88, 0x03, 0xf8, 0x15, 0xbd, 0x0a, 0xa5, 0x0e, 0xbf, 0x01, 0xd1, 0x07, 0xa2, 0x01, 0xca, 0x08,
+0xae, 0x0d, 0xca, 0x08, 0xcb, 0x03, 0xaf, 0x05, 0xb6, 0x01, 0xae, 0x0d, 0x86, 0x28, 0xe2, 0x04,
+0xcd, 0x05, 0xd7, 0x08, 0x83, 0x04, 0x9b, 0x10, 0xd2, 0x30, 0x00, 0xa1, 0x07, 0xbd, 0x07, 0xa4,
+0x03, 0xf1, 0x16, 0xc0, 0x33, 0x89, 0x13, 0x83, 0x04, 0xa3, 0x03, 0x41, 0xc5, 0x32, 0xd2, 0x59,
+0xad, 0x36, 0xb1, 0x05, 0x4d, 0xd7, 0x02, 0xb3, 0x35, 0xf0, 0x69, 0xe3, 0x56, 0xd2, 0x01, 0xd4,
+0x01, 0xd9, 0x02, 0xf7, 0x15, 0x9a, 0x4e, 0xd7, 0x2f, 0xb8, 0x09, 0xe8, 0x03, 0x6a, 0xed, 0x02,
+0xe8, 0x6a, 0xd9, 0x1a, 0xbc, 0x0a, 0xe4, 0x04, 0x95, 0x02, 0xbe, 0x0a, 0xc4, 0x70, 0xc3, 0x09,
+0xa4, 0x06, 0xf2, 0x06, 0xca, 0x01, 0xcc, 0x08, 0xca, 0x6f, 0x8f, 0x12, 0x67, 0xbc, 0x05, 0x98,
+0x01, 0xd6, 0x06, 0xfe, 0x52, 0x95, 0x11, 0xbf, 0x01, 0x7c, 0xd1, 0x01, 0x9c, 0x10, 0xc6, 0x5b,
+0xe5, 0x18, 0x1c, 0x69, 0x13, 0x94, 0x11, 0xb8, 0x49, 0xe5, 0x18, 0xab, 0x01, 0x90, 0x01, 0x44,
+0xfe, 0x14, 0xd2, 0x30, 0xe1, 0x04, 0x44, 0x60, 0xa3, 0x01, 0xc2, 0x1e, 0x9c, 0x39, 0x99, 0x10,
+0x68, 0xde, 0x03, 0x07, 0xb2, 0x21, 0xfc, 0x29, 0xeb, 0x17, 0xb6, 0x01, 0xa0, 0x02, 0x8c, 0x02,
+0x8e, 0x12, 0xf8, 0x15, 0xf7, 0x15, 0x90, 0x01, 0xc8, 0x01, 0x09, 0xbe, 0x1f, 0xa4, 0x23, 0xe5,
+0x18, 0x85, 0x01, 0x7b, 0x26, 0x88, 0x13, 0xbc, 0x1f, 0x89, 0x13, 0x55, 0x81, 0x02, 0xa6, 0x03,
+0x7a, 0xe4, 0x2d, 0xef, 0x2b, 0xdb, 0x01, 0xdf, 0x03, 0xbe, 0x01, 0xd8, 0x06, 0x98, 0x25, 0x9d,
+0x24, 0xdb, 0x01, 0xe3, 0x01, 0xa1, 0x01, 0xca, 0x08, 0x90, 0x12, 0xf1, 0x16, 0x5f, 0x99, 0x01,
+0xb5, 0x01, 0xca, 0x08, 0xee, 0x02, 0x9b, 0x10, 0xb8, 0x03, 0xa1, 0x01, 0x39, 0x8a, 0x13, 0xab,
+0x0d, 0xc3, 0x09, 0x82, 0x02, 0xdd, 0x01, 0x2f, 0xc4, 0x09, 0xf7, 0x15, 0xd5, 0x06, 0x5f, 0xad,
+0x03, 0xb1, 0x02, 0xcd, 0x1c, 0xfd, 0x14, 0xd3, 0x1b, 0x71, 0x81, 0x02, 0xc0, 0x04, 0xe7, 0x03,
+0xd5, 0x06, 0xa7, 0x0e, 0x8f, 0x01, 0xd1, 0x04, 0x72, 0xb5, 0x20, 0x79, 0x9f, 0x0f, 0xc1, 0x03,
+0xb1, 0x08, 0x9a, 0x01, 0xad, 0x36, 0xf2, 0x16, 0xa7, 0x0e, 0x99, 0x01, 0xe6, 0x01, 0x13, 0xcd,
+0x1c, 0xf2, 0x16, 0xcf, 0x07, 0x30, 0xa4, 0x01, 0xdb, 0x01, 0x99, 0x25, 0x8c, 0x27, 0xc7, 0x1d,
+0xf6, 0x02, 0xee, 0x04, 0x09, 0xfd, 0x14, 0xda, 0x1a, 0xf5, 0x2a, 0x82, 0x02, 0xe8, 0x06, 0xf7,
+0x01, 0xe1, 0x04, 0xca, 0x08, 0x93, 0x26, 0x6a, 0xba, 0x05, 0x73, 0xdc, 0x05, 0xc9, 0x08, 0xed,
+0x2b, 0x09, 0xd0, 0x02, 0x44, 0xea, 0x03, 0x83, 0x14, 0xdd, 0x2e, 0x85, 0x01, 0xb8, 0x03, 0xd8,
+0x02, 0xb2, 0x0c, 0x99, 0x10, 0xa3, 0x23, 0x1e, 0x82, 0x02, 0x86, 0x01, 0xa8, 0x0e, 0x89, 0x13,
+0xd7, 0x2f, 0x4d, 0xae, 0x01, 0x44, 0x8e, 0x12, 0xc9, 0x08, 0xf9, 0x3e, 0x67, 0x42, 0x1d, 0xde,
+0x05, 0x9a, 0x10, 0xdf, 0x42, 0x60, 0x2f, 0xbc, 0x02, 0xdc, 0x05, 0xc8, 0x1d, 0xa5, 0x23, 0x09,
+0x1b, 0x14, 0xe2, 0x04, 0x94, 0x26, 0x9d, 0x24, 0x96, 0x02, 0x2f, 0xe5, 0x01, 0xc9, 0x08, 0xb6,
+0x20, 0xfb, 0x29, 0xb6, 0x01, 0x90, 0x01, 0x9f, 0x02, 0xe2, 0x04, 0x84, 0x14, 0xb5, 0x20, 0x8f,
+0x01, 0xc0, 0x01, 0x41, 0xa6, 0x0e, 0xc2, 0x1e, 0xfd, 0x3d, 0x1d, 0xad, 0x01, 0x8f, 0x01, 0xee,
+0x02, 0xae, 0x0d, 0x97, 0x3a, 0x55, 0xb3, 0x04, 0xe7, 0x03, 0xf6, 0x01, 0xb2, 0x0c, 0x97, 0x25,
+0x67, 0xeb, 0x02, 0x25, 0x79, 0xda, 0x1a, 0x99, 0x25, 0xad, 0x01, 0xc1, 0x06, 0x87, 0x01, 0xb7,
+0x20, 0xf8, 0x15, 0xff, 0x28, 0x80, 0x06, 0xaf, 0x0b, 0xc7, 0x04, 0xcb, 0x31, 0xd0, 0x07, 0x9b,
+0x39, 0xb4, 0x04, 0xcd, 0x05, 0xeb, 0x02, 0xeb, 0x40, 0x94, 0x26, 0xed, 0x69, 0xef, 0x09, 0xa6,
+0x03, 0x60, 0xf1, 0x16, 0xe4, 0x56, 0xcd, 0x5a, 0xd7, 0x08, 0xd8, 0x02, 0xbc, 0x05, 0xeb, 0x17,
+0xda, 0x1a, 0x89, 0x3c, 0x4b, 0xc0, 0x01, 0xb1, 0x02, 0xf1, 0x16, 0xf3, 0x01, 0xa5, 0x23, 0x91,
+0x03, 0xb4, 0x07, 0x9e, 0x05, 0xd0, 0x07, 0xcf, 0x07, 0xff, 0x28, 0x86, 0x04, 0xf7, 0x01, 0xf0,
+0x01, 0xe5, 0x18, 0xe3, 0x2d, 0x8d, 0x27, 0xd7, 0x05, 0x94, 0x05, 0xb2, 0x02, 0xcf, 0x07, 0xc7,
+0x1d, 0x99, 0x10, 0xd5, 0x03, 0x86, 0x01, 0xea, 0x05, 0x95, 0x11, 0xc5, 0x32, 0xa1, 0x0f, 0xfb,
+0x03, 0xd0, 0x02, 0xb0, 0x03, 0x99, 0x10, 0xb9, 0x34, 0x7a, 0x8a, 0x03, 0x88, 0x03, 0xb2, 0x02,
+0xc5, 0x09, 0xcb, 0x31, 0xe8, 0x03, 0xfa, 0x03, 0xe1, 0x02, 0x1c, 0xd3, 0x1b, 0x93, 0x26, 0xcd,
+0x1c, 0xcc, 0x03, 0x94, 0x05, 0x5f, 0xc0, 0x0a, 0x8d, 0x12, 0xc7, 0x1d, 0xd4, 0x01, 0xbc, 0x02,
+0x60, 0xe1, 0x04, 0xc4, 0x09, 0xfb, 0x29, 0xd2, 0x01, 0xbc, 0x05, 0x4b, 0xd0, 0x07, 0x9c, 0x10,
+0xcd, 0x1c, 0x14, 0xf6, 0x02, 0xd7, 0x02, 0xd4, 0x1b, 0x80, 0x29, 0xcb, 0x31, 0x7c, 0xc4, 0x02,
+0xdb, 0x01, 0x96, 0x11, 0xac, 0x22, 0xff, 0x28, 0x56, 0xc6, 0x02, 0x2f, 0x9c, 0x39, 0xfe, 0x3d,
+0x97, 0x3a, 0xa3, 0x01, 0xb0, 0x03, 0x8f, 0x04, 0xc4, 0x47, 0x9c, 0x39, 0xf7, 0x3e, 0x07, 0xce,
+0x02, 0x8f, 0x01, 0xc8, 0x46, 0xa4, 0x38, 0xd5, 0x44, 0x42, 0x6a, 0xed, 0x01, 0xcc, 0x31, 0x80,
+0x29, 0xe7, 0x2c, 0x0a, 0x82, 0x02, 0x7d, 0xa4, 0x38, 0x8a, 0x3c, 0xef, 0x2b, 0x1b, 0x30, 0x60,
+0xc0, 0x33, 0xc0, 0x33, 0xf5, 0x2a, 0xb9, 0x03, 0x41, 0x9c, 0x03, 0xe0, 0x19, 0xac, 0x22, 0xf7,
+0x15, 0xe1, 0x02, 0xd5, 0x03, 0xd2, 0x04, 0xf5, 0x01, 0xac, 0x0d, 0xed, 0x2b, 0x9d, 0x05, 0xfd,
+0x05, 0xba, 0x08, 0xaf, 0x21, 0xcf, 0x07, 0x99, 0x25, 0xe1, 0x02, 0xf5, 0x02, 0xda, 0x02, 0xaf,
+0x21, 0xc9, 0x08, 0xe1, 0x04, 0xc1, 0x03, 0xa0, 0x02, 0xa2, 0x01, 0xb3, 0x0c, 0xb3, 0x0c, 0xe7,
+0x03, 0xe1, 0x02, 0x4c, 0x60, 0xcf, 0x07, 0x8f, 0x12, 0xd0, 0x07, 0x7c, 0xc0, 0x01, 0x92, 0x03,
+0xe7, 0x03, 0xa9, 0x22, 0x79, 0x39, 0xd2, 0x04, 0x7c, 0xb2, 0x0c, 0x97, 0x25, 0xb7, 0x0b, 0x11,
+0xbe, 0x04, 0x8f, 0x01, 0x84, 0x14, 0x8d, 0x27, 0x83, 0x14, 0x27, 0xa0, 0x02, 0xa4, 0x01, 0xa8,
+0x0e, 0xcd, 0x1c, 0x8f, 0x12, 0x67, 0x90, 0x01, 0x7b, 0x8e, 0x12, 0xa3, 0x23, 0xf1, 0x16, 0x68,
+0x4c, 0x83, 0x02, 0x96, 0x11, 0xa7, 0x37, 0xeb, 0x17, 0x8c, 0x02, 0x71, 0xcd, 0x02, 0xb4, 0x0c,
+0xbf, 0x33, 0xe5, 0x18, 0x1e, 0xa2, 0x01, 0x89, 0x03, 0xe8, 0x03, 0xc7, 0x5b, 0xd5, 0x2f, 0x72,
+0x7c, 0x55, 0xbf, 0x0a, 0xe1, 0x6b, 0xdd, 0x2e, 0x95, 0x02, 0xdc, 0x01, 0x97, 0x01, 0x87, 0x13,
+0xf5, 0x53, 0xa5, 0x23, 0xc7, 0x01, 0xa0, 0x02, 0xe2, 0x02, 0xd9, 0x1a, 0xc1, 0x5c, 0xbb, 0x1f,
+0xb1, 0x02, 0xc2, 0x03, 0xbe, 0x04, 0xf1, 0x16, 0xe7, 0x41, 0xe7, 0x03, 0x83, 0x02, 0xb6, 0x01,
+0x9e, 0x05, 0xb9, 0x0b, 0x8b, 0x27, 0x79, 0x83, 0x07, 0x71, 0xc0, 0x04, 0xab, 0x0d, 0xe1, 0x04,
+0x95, 0x11, 0xc9, 0x11, 0xa5, 0x06, 0xe6, 0x06, 0xcd, 0x1c, 0xc2, 0x1e, 0xbb, 0x48, 0x8e, 0x04,
+0xba, 0x08, 0xb5, 0x01, 0xda, 0x1a, 0xd9, 0x1a, 0x9d, 0x39, 0xd4, 0x0c, 0x98, 0x07, 0xcd, 0x05,
+0xfc, 0x14, 0xd3, 0x1b, 0xf7, 0x15, 0xe4, 0x01, 0x7c, 0xac, 0x01, 0xd2, 0x07, 0xb9, 0x34, 0xf0,
+0x02, 0xde, 0x06, 0xae, 0x06, 0xec, 0x02, 0xd0, 0x07, 0x93, 0x26, 0x88, 0x13, 0x2f, 0x6a, 0x14,
+0xe6, 0x18, 0xfd, 0x14, 0xf6, 0x2a, 0xfa, 0x09, 0xc4, 0x08, 0x97, 0x04, 0xf6, 0x53, 0xa3, 0x23,
+0xb6, 0x5e, 0x25, 0x1c, 0x91, 0x03, 0xba, 0x34, 0x9b, 0x10, 0x88, 0x51, 0xec, 0x02, 0x67, 0xb2,
+0x02, 0xc4, 0x47, 0xc7, 0x1d, 0xd4, 0x82, 0x01, 0xef, 0x09, 0xbf, 0x04, 0x81, 0x02, 0x82, 0x29,
+0xbd, 0x0a, 0xfe, 0x7b, 0xa5, 0x0b, 0x99, 0x06, 0xd8, 0x02, 0xf2, 0x16, 0xcf, 0x07, 0x84, 0x3d,
+0x87, 0x06, 0xc1, 0x03, 0xb5, 0x01, 0xb0, 0x21, 0xe2, 0x04, 0xbc, 0x1f, 0x99, 0x06, 0xd1, 0x04,
+0x1b, 0xe0, 0x19, 0x8a, 0x13, 0xed, 0x02, 0x38, 0xbf, 0x09, 0x9e, 0x02, 0x8f, 0x12, 0xe4, 0x18,
+0x9f, 0x0f, 0xc0, 0x01, 0x95, 0x05, 0x90, 0x01, 0xf7, 0x15, 0xfe, 0x14, 0x7b, 0xa6, 0x03, 0xdb,
+0x01, 0x93, 0x05, 0xa3, 0x23, 0x8e, 0x27, 0xd8, 0x06, 0xe2, 0x02, 0x56, 0x85, 0x04, 0xf7, 0x15,
+0xec, 0x17, 0xf4, 0x01, 0x99, 0x01, 0x84, 0x02, 0x85, 0x01, 0xfd, 0x14, 0xf4, 0x2a, 0xc5, 0x09,
+0xb1, 0x02, 0xfa, 0x03, 0xb1, 0x02, 0xb1, 0x0c, 0xb0, 0x36, 0x93, 0x11, 0x4e, 0x8c, 0x05, 0x8f,
+0x01, 0xb9, 0x0b, 0xf4, 0x2a, 0xad, 0x0d, 0xa9, 0x02, 0x1b, 0xec, 0x02, 0xab, 0x0d, 0xfe, 0x14,
+0x87, 0x13, 0xc7, 0x04, 0xcf, 0x02, 0xca, 0x01, 0xeb, 0x17, 0xd6, 0x06, 0x8f, 0x12, 0x26, 0xbc,
+0x02, 0xac, 0x01, 0xd5, 0x06, 0xe1, 0x04, 0xcf, 0x07, 0xb5, 0x01, 0xa0, 0x02, 0x90, 0x01, 0xbf,
+0x0a, 0xf7, 0x15, 0xd1, 0x07, 0x93, 0x05, 0xd5, 0x03, 0x8e, 0x04, 0x00, 0xd3, 0x1b, 0xf3, 0x01,
+0x72, 0x92, 0x06, 0x14, 0xd6, 0x06, 0xdf, 0x19, 0xe2, 0x04, 0xd4, 0x01, 0xee, 0x04, 0x85, 0x01,
+0x9c, 0x10, 0xdd, 0x2e, 0xc6, 0x09, 0xb1, 0x05, 0xf6, 0x02, 0xc8, 0x01, 0xe8, 0x03, 0xf3, 0x2a,
+0xa1, 0x0f, 0xf0, 0x06, 0xa6, 0x0b, 0xf5, 0x02, 0xc8, 0x1d, 0xe3, 0x2d, 0x9f, 0x0f, 0x87, 0x03,
+0xf0, 0x01, 0x3a, 0xdb, 0x05, 0xd7, 0x2f, 0x8d, 0x27, 0xf0, 0x01, 0xfa, 0x03, 0xd1, 0x01, 0xc3,
+0x09, 0xe5, 0x18, 0xcd, 0x1c, 0x13, 0x74, 0x68, 0x00, 0xe1, 0x04, 0xaf, 0x21, 0xf6, 0x0a, 0x84,
+0x0a, 0xeb, 0x07, 0xec, 0x17, 0xe0, 0x19, 0xb3, 0x0c, 0xcf, 0x07, 0x43, 0x72, 0xf2, 0x16, 0xd2,
+0x30, 0x7a, 0xda, 0x07, 0xd6, 0x03, 0x99, 0x01, 0x8a, 0x3c, 0xd8, 0x2f, 0xce, 0x1c, 0xc0, 0x01,
+0x98, 0x01, 0xbf, 0x06, 0xcc, 0x31, 0xc0, 0x5c, 0x92, 0x3b, 0xc6, 0x02, 0xc7, 0x04, 0xb1, 0x02,
+0xf6, 0x2a, 0xd8, 0x2f, 0xec, 0x40, 0xeb, 0x02, 0xcf, 0x07, 0xad, 0x01, 0xf6, 0x15, 0xcc, 0x31,
+0xa4, 0x61, 0xe9, 0x0b, 0xf9, 0x09, 0xc1, 0x03, 0x90, 0x12, 0xaa, 0x22, 0xfc, 0x52, 0xd5, 0x08,
+0xdf, 0x0b, 0xbb, 0x02, 0xd5, 0x06, 0xf7, 0x15, 0xec, 0x17, 0xe7, 0x06, 0xa7, 0x05, 0xa1, 0x04,
+0xa7, 0x0e, 0xa9, 0x22, 0xc9, 0x08, 0xe1, 0x02, 0xa7, 0x02, 0xa1, 0x04, 0xaf, 0x21, 0xdf, 0x42,
+0xcd, 0x1c, 0x38, 0xb3, 0x02, 0xca, 0x01, 0x9b, 0x39, 0xfd, 0x52, 0xcb, 0x31, 0x11, 0x85, 0x01,
+0xa1, 0x01, 0xcb, 0x31, 0xd9, 0x43, 0xa5, 0x23, 0xc5, 0x02, 0x6a, 0x1c, 0x95, 0x3a, 0xd9, 0x58,
+0xe7, 0x2c, 0xef, 0x01, 0x8b, 0x02, 0x90, 0x01, 0xb7, 0x20, 0x95, 0x3a, 0x81, 0x29, 0x71, 0x86,
+0x01, 0x82, 0x02, 0xe7, 0x2c, 0xd7, 0x2f, 0xd5, 0x44, 0xb7, 0x03, 0x82, 0x05, 0xdc, 0x01, 0xc3,
+0x1e, 0x9f, 0x0f, 0x93, 0x4f, 0xad, 0x01, 0xbc, 0x0d, 0xd8, 0x05, 0x87, 0x13, 0x8e, 0x12, 0xdd,
+0x2e, 0x97, 0x01, 0x94, 0x08, 0x8c, 0x05, 0xeb, 0x17, 0xf4, 0x3f, 0xb9, 0x34, 0xa8, 0x02, 0xa6,
+0x0b, 0xb8, 0x03, 0xc4, 0x09, 0xa4, 0x61, 0xd9, 0x1a, 0xac, 0x04, 0x96, 0x07, 0xbe, 0x04, 0xfe,
+0x14, 0x94, 0x4f, 0xe7, 0x03, 0xe2, 0x02, 0x86, 0x04, 0xd7, 0x02, 0x9c, 0x10, 0xfc, 0x7b, 0x8a,
+0x13, 0xb1, 0x02, 0xc9, 0x01, 0x84, 0x07, 0x82, 0x14, 0xf8, 0x7c, 0xf2, 0x16, 0xaf, 0x03, 0x90,
+0x01, 0x69, 0xa0, 0x24, 0x98, 0x63, 0x9a, 0x10, 0xad, 0x03, 0x1b, 0x9d, 0x02, 0x92, 0x26, 0x80,
+0x67, 0xcc, 0x08, 0xb5, 0x04, 0xbb, 0x02, 0x42, 0x9a, 0x25, 0xb8, 0x49, 0xe2, 0x04, 0x9b, 0x03,
+0x9f, 0x02, 0xa7, 0x02, 0x92, 0x26, 0xf0, 0x2b, 0xe7, 0x03, 0xeb, 0x02, 0x93, 0x05, 0xbb, 0x02,
+0xb0, 0x21, 0xd6, 0x06, 0xad, 0x0d, 0x99, 0x03, 0x5f, 0xab, 0x01, 0xa0, 0x24, 0xf1, 0x16, 0xf1,
+0x16, 0xcf, 0x02, 0x87, 0x03, 0xac, 0x01, 0xfe, 0x14, 0x89, 0x3c, 0xd9, 0x1a, 0xeb, 0x02, 0x8f,
+0x01, 0xc5, 0x05, 0xe2, 0x04, 0x8b, 0x3c, 0xb7, 0x0b, 0xf5, 0x02, 0xbb, 0x02, 0x9d, 0x02, 0x95,
+0x11, 0xb1, 0x73, 0x83, 0x14, 0x67, 0x9b, 0x03, 0xb1, 0x02, 0xe9, 0x2c, 0xf1, 0x7d, 0x9f, 0x0f,
+0xa2, 0x01, 0x43, 0xef, 0x01, 0xed, 0x2b, 0xc1, 0x5c, 0xdd, 0x05, 0x1c, 0x92, 0x03, 0x39, 0xd1,
+0x30, 0xb1, 0x73, 0xed, 0x02, 0x71, 0xb4, 0x02, 0xc3, 0x05, 0xa7, 0x37, 0xa3, 0x61, 0xe0, 0x19,
+0x4c, 0xa3, 0x01, 0x95, 0x02, 0x93, 0x4f, 0xe9, 0x55, 0xa6, 0x23, 0xec, 0x02, 0x5f, 0x7c, 0xcf,
+0x45, 0xb9, 0x34, 0xa4, 0x23, 0x90, 0x01, 0x84, 0x02, 0xbb, 0x02, 0xff, 0x66, 0x8d, 0x27, 0x8a,
+0x3c, 0x25, 0x60, 0x55, 0x87, 0x51, 0xfd, 0x14, 0x98, 0x3a, 0xd2, 0x04, 0xde, 0x06, 0xfd, 0x02,
+0xcd, 0x1c, 0xdb, 0x05, 0xe2, 0x2d, 0xbe, 0x01, 0x94, 0x05, 0xac, 0x01, 0xe7, 0x03, 0xf8, 0x15,
+0x80, 0x3e, 0x97, 0x0c, 0xa6, 0x03, 0x9e, 0x02, 0xca, 0x08, 0xb6, 0x5e, 0xb0, 0x21, 0x39, 0x08,
+0xd8, 0x08, 0xfd, 0x14, 0xb4, 0x5e, 0xb1, 0x0c, 0x7b, 0xcf, 0x04, 0xfa, 0x06, 0x81, 0x29, 0x8a,
+0x51, 0xb7, 0x20, 0xa7, 0x02, 0xab, 0x04, 0xaa, 0x07, 0xe1, 0x2d, 0xa6, 0x75, 0x89, 0x3c, 0xd5,
+0x06, 0xff, 0x02, 0xe6, 0x04, 0xeb, 0x17, 0xfe, 0x7b, 0xaf, 0x21, 0x9f, 0x07, 0xd1, 0x01, 0x14,
+0x79, 0xe8, 0x6a, 0xdd, 0x05, 0xf9, 0x01, 0xd1, 0x01, 0xba, 0x05, 0xc4, 0x09, 0xd0, 0x45, 0x00,
+0xf2, 0x03, 0x95, 0x02, 0x1b, 0xe0, 0x19, 0xc4, 0x47, 0x99, 0x10, 0x1b, 0xba, 0x05, 0xc8, 0x04,
+0xd0, 0x45, 0xce, 0x45, 0xd1, 0x30, 0xa0, 0x02, 0xb6, 0x01, 0xe5, 0x01, 0x90, 0x3b, 0xea, 0x2c,
+0x9f, 0x4d, 0xad, 0x01, 0x84, 0x07, 0x12, 0x90, 0x3b, 0xd0, 0x07, 0x89, 0x3c, 0xd7, 0x02, 0xd6,
+0x03, 0xab, 0x01, 0xfe, 0x52, 0x81, 0x14, 0xb3, 0x35, 0x91, 0x03, 0x9a, 0x06, 0xb6, 0x01, 0xf6,
+0x53, 0xd1, 0x30, 0xeb, 0x17, 0x1b, 0xa8, 0x05, 0x9d, 0x02, 0xca, 0x46, 0xdb, 0x43, 0xdf, 0x19,
+0xe5, 0x01, 0xaa, 0x02, 0x43, 0xe2, 0x2d, 0xad, 0x36, 0x89, 0x13, 0x4d, 0x98, 0x04, 0x00, 0xc0,
+0x33, 0x87, 0x51, 0x00, 0xfd, 0x02, 0x2f, 0x4b, 0xd4, 0x1b, 0xab, 0x4b, 0xf4, 0x01, 0x60, 0x90,
+0x01, 0x85, 0x01, 0xae, 0x0d, 0xdb, 0x43, 0x8a, 0x13, 0x09, 0x2f, 0x8f, 0x04, 0xe7, 0x03, 0x9b,
+0x39, 0x82, 0x14, 0x60, 0x26, 0x9b, 0x03, 0xad, 0x0d, 0xbb, 0x1f, 0xc0, 0x33, 0x82, 0x02, 0xe6,
+0x01, 0xd0, 0x02, 0xc9, 0x08, 0xfd, 0x14, 0xc6, 0x32, 0xaa, 0x02, 0xa6, 0x03, 0xe9, 0x05, 0xed,
+0x02, 0xc7, 0x1d, 0x90, 0x12, 0x39, 0xc6, 0x02, 0xa0, 0x04, 0x79, 0x81, 0x29, 0xd5, 0x06, 0xaf,
+0x03, 0xb2, 0x02, 0x3a, 0xe7, 0x03, 0x97, 0x25, 0xe8, 0x03, 0x9d, 0x02, 0xb5, 0x01, 0x80, 0x03,
+0xcb, 0x08, 0xb3, 0x0c, 0x84, 0x14, 0xd5, 0x03, 0x8b, 0x02, 0xc0, 0x01, 0x8d, 0x12, 0xee, 0x02,
+0xb6, 0x20, 0xa5, 0x03, 0xc9, 0x09, 0x86, 0x06, 0xd3, 0x1b, 0xca, 0x1d, 0xc8, 0x1d, 0xb5, 0x01,
+0xad, 0x09, 0xfc, 0x03, 0xaf, 0x36, 0x80, 0x29, 0xb6, 0x20, 0x41, 0x89, 0x08, 0xe5, 0x01, 0xaf,
+0x21, 0xcc, 0x31, 0xec, 0x17, 0x85, 0x04, 0xb5, 0x0c, 0x2f, 0xdf, 0x19, 0xa4, 0x23, 0x96, 0x11,
+0xb3, 0x04, 0xed, 0x07, 0xed, 0x01, 0xcd, 0x1c, 0xbe, 0x1f, 0x9c, 0x10, 0xd7, 0x05, 0x85, 0x09,
+0x85, 0x04, 0xf1, 0x16, 0xd0, 0x07, 0xee, 0x02, 0xf7, 0x04, 0xc5, 0x02, 0x9d, 0x05, 0xc1, 0x1e,
+0x89, 0x13, 0xd1, 0x07, 0xb5, 0x01, 0xc0, 0x01, 0x73, 0x83, 0x14, 0x83, 0x3d, 0x9f, 0x0f, 0x9b,
+0x03, 0xc2, 0x06, 0x9b, 0x03, 0x8f, 0x12, 0x81, 0x29, 0xc9, 0x08, 0xb5, 0x01, 0xe4, 0x04, 0x9f,
+0x04, 0x81, 0x14, 0xf7, 0x3e, 0xa7, 0x0e, 0xab, 0x01, 0xae, 0x09, 0x73, 0xbf, 0x0a, 0xd1, 0x30,
+0x83, 0x14, 0x72, 0xd4, 0x06, 0x8d, 0x04, 0xfd, 0x14, 0x8d, 0x50, 0xdf, 0x19, 0xb5, 0x01, 0xc0,
+0x06, 0x56, 0xea, 0x03, 0x91, 0x3b, 0xaf, 0x21, 0x1e, 0xd2, 0x07, 0xe2, 0x02, 0xec, 0x17, 0xad,
+0x36, 0x9d, 0x24, 0xc4, 0x02, 0xf8, 0x04, 0xe8, 0x03, 0xb0, 0x21, 0xb5, 0x20, 0xc9, 0x1d, 0x9a,
+0x01, 0xd8, 0x05, 0x9c, 0x03, 0xc6, 0x32, 0xe5, 0x18, 0xbb, 0x1f, 0xe2, 0x02, 0xc2, 0x03, 0x60,
+0xa8, 0x37, 0xf3, 0x01, 0xe5, 0x18, 0x69, 0x88, 0x03, 0xa8, 0x05, 0xd2, 0x30, 0xc4, 0x09, 0xdf,
+0x19, 0xfa, 0x01, 0xd4, 0x01, 0xca, 0x01, 0x86, 0x28, 0xf3, 0x01, 0xe1, 0x04, 0x55, 0x26, 0xce,
+0x02, 0xcc, 0x08, 0x9c, 0x10, 0xe2, 0x04, 0x7b, 0x95, 0x05, 0xec, 0x02, 0xac, 0x0d, 0x9e, 0x24,
+0xa8, 0x0e, 0xd3, 0x01, 0xfb, 0x08, 0xd1, 0x01, 0xdb, 0x05, 0xcc, 0x31, 0xec, 0x17, 0x67, 0xf5,
+0x05, 0xb9, 0x03, 0xed, 0x02, 0xb8, 0x20, 0xe6, 0x18, 0x73, 0xf9, 0x06, 0xa9, 0x04, 0x8f, 0x12,
+0x90, 0x3b, 0xb6, 0x20, 0xb3, 0x04, 0x97, 0x07, 0xbb, 0x02, 0xb7, 0x0b, 0x8a, 0x3c, 0xa0, 0x0f,
+0xbb, 0x02, 0xa9, 0x07, 0xff, 0x02, 0xc5, 0x09, 0xa8, 0x37, 0xc6, 0x09, 0x9b, 0x03, 0x99, 0x06,
+0xbf, 0x01, 0xeb, 0x17, 0x92, 0x3b, 0x7a, 0xaf, 0x03, 0x91, 0x06, 0x97, 0x01, 0xa5, 0x0e, 0xbc,
+0x1f, 0xeb, 0x17, 0xf9, 0x06, 0xbb, 0x02, 0x13, 0x7a, 0xed, 0x02, 0x83, 0x14, 0x43, 0x69, 0x86,
+0x01, 0xa8, 0x0e, 0x79, 0xdb, 0x05, 0x9d, 0x02, 0xfc, 0x06, 0x97, 0x01, 0xb2, 0x0c, 0xcb, 0x08,
+0xb7, 0x0b, 0x97, 0x04, 0xaa, 0x07, 0x26, 0xd4, 0x1b, 0x93, 0x11, 0xe9, 0x03, 0xad, 0x01, 0x84,
+0x0a, 0x56, 0xf8, 0x15, 0x81, 0x29, 0xa8, 0x0e, 0xfd, 0x02, 0xa8, 0x0a, 0xf8, 0x01, 0x96, 0x11,
+0xf7, 0x15, 0xf4, 0x01, 0xc9, 0x01, 0xa2, 0x07, 0x0a, 0xd0, 0x07, 0xe5, 0x18, 0xb2, 0x0c, 0x9d,
+0x02, 0x8e, 0x07, 0xf2, 0x03, 0xc4, 0x09, 0xba, 0x0b, 0x90, 0x12, 0xa8, 0x02, 0x8e, 0x04, 0x1e,
+0xfe, 0x14, 0xa4, 0x23, 0xf0, 0x2b, 0x82, 0x05, 0xde, 0x06, 0x8f, 0x01, 0xf2, 0x16, 0x9a, 0x25,
+0xa4, 0x23, 0x9c, 0x03, 0xf0, 0x01, 0x96, 0x02, 0xb0, 0x21, 0x84, 0x3d, 0xcc, 0x31, 0xcc, 0x03,
+0xa4, 0x03, 0x13, 0xe4, 0x2d, 0xc4, 0x47, 0xf6, 0x2a, 0xce, 0x02, 0xed, 0x01, 0xf8, 0x01, 0x90,
+0x12, 0xf8, 0x3e, 0xac, 0x0d, 0x8c, 0x02, 0xeb, 0x05, 0x1e, 0xb6, 0x20, 0x82, 0x29, 0x99, 0x10,
+0x37, 0xef, 0x09, 0xc6, 0x02, 0xdb, 0x05, 0xb6, 0x20, 0x99, 0x25, 0xa2, 0x01, 0xc7, 0x0c, 0x9f,
+0x02, 0xf4, 0x01, 0xb0, 0x21, 0xfd, 0x14, 0xb5, 0x01, 0xf5, 0x0a, 0x90, 0x01, 0xdb, 0x05, 0xbe,
+0x1f, 0x8d, 0x12, 0xdb, 0x01, 0x91, 0x09, 0xc1, 0x03, 0xcb, 0x08, 0x94, 0x11, 0x9b, 0x10, 0xa1,
+0x04, 0xbb, 0x07, 0x55, 0xe5, 0x18, 0xe6, 0x18, 0x95, 0x11, 0x95, 0x05, 0xad, 0x09, 0xb3, 0x02,
+0xcd, 0x1c, 0xda, 0x1a, 0xcd, 0x1c, 0xb9, 0x05, 0xe9, 0x08, 0x00, 0x9b, 0x39, 0xa2, 0x0f, 0xa3,
+0x23, 0x87, 0x06, 0xdf, 0x03, 0x8b, 0x02, 0xf5, 0x2a, 0xb8, 0x0b, 0xb5, 0x20, 0xe7, 0x03, 0x3a,
+0xf3, 0x02, 0xdb, 0x2e, 0xb4, 0x0c, 0xf7, 0x15, 0x39, 0xac, 0x01, 0xbb, 0x02, 0xb7, 0x20, 0x83,
+0x14, 0xe5, 0x18, 0x99, 0x01, 0x94, 0x03, 0x08, 0xeb, 0x17, 0xa1, 0x0f, 0x8f, 0x12, 0x00, 0xf8,
+0x04, 0x8a, 0x03, 0xd9, 0x1a, 0xb5, 0x20, 0x99, 0x10, 0xcd, 0x02, 0x90, 0x09, 0xe6, 0x01, 0x93,
+0x11, 0x89, 0x13, 0xf4, 0x01, 0x73, 0x86, 0x09, 0x96, 0x02, 0xd3, 0x1b, 0xb7, 0x0b, 0xac, 0x0d,
+0x41, 0x8e, 0x07, 0x56, 0x83, 0x14, 0xfd, 0x14, 0xf3, 0x01, 0x81, 0x02, 0xa8, 0x05, 0x8e, 0x01,
+0x93, 0x26, 0xab, 0x0d, 0xd0, 0x07, 0x8f, 0x01, 0xd4, 0x06, 0x9a, 0x01, 0xa5, 0x0e, 0xeb, 0x17,
+0x9c, 0x10, 0x12, 0x80, 0x03, 0xe1, 0x02, 0xd6, 0x06, 0xdf, 0x19, 0xca, 0x08, 0x11, 0xd2, 0x01,
+0x39, 0xe2, 0x04, 0xdd, 0x05, 0xf4, 0x01, 0xb2, 0x02, 0xb6, 0x01, 0xab, 0x01, 0xcc, 0x08, 0xe7,
+0x03, 0xf0, 0x02, 0xa8, 0x02, 0xb8, 0x03, 0xb7, 0x03, 0xc8, 0x1d, 0xcc, 0x08, 0x82, 0x14, 0xa0,
+0x02, 0xf1, 0x03, 0xe3, 0x02, 0xbe, 0x0a, 0xf2, 0x16, 0x9a, 0x25, 0xc6, 0x02, 0xa7, 0x05, 0x90,
+0x04, 0xd0, 0x07, 0xf4, 0x2a, 0x90, 0x3b, 0xdb, 0x01, 0xeb, 0x0a, 0x7c, 0x00, 0xd6, 0x44, 0xee,
+0x40, 0x96, 0x02, 0xaf, 0x0b, 0x25, 0x79, 0xaa, 0x22, 0xe2, 0x2d, 0x08, 0x9b, 0x0b, 0x30, 0xe1,
+0x04, 0xb4, 0x35, 0xde, 0x2e, 0xcd, 0x02, 0xa5, 0x0b, 0x7b, 0x99, 0x10, 0xd8, 0x2f, 0xe6, 0x18,
+0x95, 0x02, 0x89, 0x08, 0x43, 0x00, 0xb0, 0x21, 0xc0, 0x0a, 0xa1, 0x01, 0x9f, 0x02, 0xf5, 0x02,
+0xe8, 0x03, 0x94, 0x26, 0x7a, 0xbb, 0x02, 0x41, 0xab, 0x01, 0xfc, 0x14, 0x92, 0x26, 0xef, 0x02,
+0x91, 0x06, 0x94, 0x02, 0x86, 0x01, 0xec, 0x17, 0xf2, 0x16, 0xf3, 0x01, 0xbb, 0x05, 0xaa, 0x02,
+0xfc, 0x03, 0xb8, 0x20, 0xf8, 0x15, 0xd2, 0x07, 0xbd, 0x04, 0xe4, 0x04, 0x4c, 0xd4, 0x1b, 0xe2,
+0x04, 0x9a, 0x10, 0x9b, 0x03, 0xee, 0x07, 0x5f, 0x9a, 0x10, 0xd5, 0x06, 0xa2, 0x0f, 0xeb, 0x02,
+0xf4, 0x05, 0xdb, 0x01, 0xae, 0x0d, 0x97, 0x25, 0xbc, 0x1f, 0xd7, 0x02, 0xc6, 0x05, 0xa0, 0x02,
+0xc9, 0x08, 0xc5, 0x32, 0xfc, 0x29, 0x91, 0x03, 0xcc, 0x03, 0x42, 0xa7, 0x0e, 0xfb, 0x29, 0xc2,
+0x1e, 0xd9, 0x02, 0x1c, 0x1e, 0xb5, 0x20, 0xe3, 0x2d, 0xce, 0x1c, 0xe7, 0x03, 0x2f, 0x6a, 0xc1,
+0x1e, 0x8b, 0x27, 0xd0, 0x07, 0xab, 0x04, 0xe1, 0x02, 0x38, 0x8d, 0x27, 0xd3, 0x1b, 0x9c, 0x10,
+0x7b, 0xdf, 0x03, 0x11, 0xc1, 0x1e, 0xbf, 0x0a, 0xc4, 0x09, 0x56, 0x8d, 0x04, 0xef, 0x04, 0xad,
+0x0d, 0xd5, 0x06, 0xa8, 0x0e, 0x9a, 0x01, 0xab, 0x04, 0x8f, 0x06, 0xae, 0x0d, 0x9c, 0x10, 0x84,
+0x14, 0xba, 0x05, 0xd9, 0x04, 0x95, 0x05, 0xac, 0x0d, 0xd6, 0x06, 0xc4, 0x09, 0xca, 0x01, 0x55,
+0xdf, 0x05, 0xb4, 0x35, 0xd0, 0x07, 0xfe, 0x14, 0xb2, 0x02, 0x42, 0xd9, 0x02, 0xe2, 0x42, 0xe0,
+0x19, 0xce, 0x1c, 0x09, 0x8f, 0x01, 0x60, 0x9e, 0x24, 0x8e, 0x27, 0xf8, 0x15, 0xdc, 0x01, 0xcd,
+0x02, 0xca, 0x01, 0xd8, 0x06, 0x80, 0x29, 0xc8, 0x1d, 0x4b, 0xf1, 0x03, 0x8c, 0x02, 0xd9, 0x1a,
+0xe0, 0x19, 0x9c, 0x10, 0xdd, 0x03, 0xab, 0x04, 0xac, 0x04, 0xff, 0x3d, 0xb8, 0x20, 0x9e, 0x24,
+0xd8, 0x02, 0x87, 0x03, 0xdc, 0x06, 0x85, 0x28, 0xd6, 0x06, 0xf2, 0x16, 0x94, 0x10, 0x72, 0x86,
+0x04, 0xf8, 0x15, 0xa7, 0x0e, 0xc3, 0x47, 0xc6, 0x10, 0xfa, 0x09, 0xe0, 0x13, 0xca, 0x08, 0xb1,
+0x0c, 0xa3, 0x61, 0xa5, 0x24, 0xef, 0x01, 0xa3, 0x11, 0xe5, 0x18, 0x9e, 0x24, 0xcd, 0x1c, 0x9b,
+0x08, 0xa8, 0x05, 0xb2, 0x05, 0x8a, 0x13, 0xbf, 0x33, 0xf4, 0x01, 0xa2, 0x01, 0x96, 0x02, 0xe4,
+0x07, 0x98, 0x25, 0xe7, 0x6a, 0xee, 0x02, 0xf8, 0x01, 0xce, 0x08, 0xf7, 0x04, 0xc2, 0x1e, 0x83,
+0x3d, 0xed, 0x02, 0xed, 0x01, 0x94, 0x05, 0xa3, 0x06, 0xc0, 0x0a, 0xb3, 0x35, 0xb7, 0x0b, 0xa7,
+0x05, 0x55, 0xd5, 0x06, 0xdd, 0x05, 0xb9, 0x34, 0xa6, 0x0e, 0x26, 0xe1, 0x05, 0xa4, 0x01, 0xc9,
+0x08, 0xc5, 0x32, 0xb4, 0x0c, 0xab, 0x04, 0xbf, 0x06, 0x89, 0x03, 0xe5, 0x18, 0xab, 0x4b, 0xda,
+0x1a, 0xb1, 0x05, 0x83, 0x07, 0x93, 0x02, 0xef, 0x2b, 0xd1, 0x30, 0xe8, 0x03, 0x00, 0x8b, 0x05,
+0x91, 0x06, 0xb7, 0x0b, 0xab, 0x22, 0xd0, 0x07, 0xcc, 0x03, 0x87, 0x03, 0xf1, 0x06, 0xc4, 0x09,
+0xa3, 0x23, 0xd2, 0x07, 0xa6, 0x03, 0xbf, 0x04, 0xdd, 0x03, 0xf8, 0x15, 0xd9, 0x1a, 0xd0, 0x07,
+0x8b, 0x02, 0xb7, 0x03, 0x25, 0x90, 0x12, 0xe1, 0x04, 0xce, 0x1c, 0x25, 0xbd, 0x04, 0x13, 0xe0,
+0x19, 0x94, 0x11, 0xfe, 0x3d, 0x4c, 0xdf, 0x03, 0x5f, 0xb6, 0x20, 0xf2, 0x16, 0xb2, 0x4a, 0x94,
+0x05, 0x1e, 0x8d, 0x01, 0xe6, 0x18, 0xda, 0x1a, 0xae, 0x36, 0x90, 0x04, 0xee, 0x01, 0xa4, 0x03,
+0xfe, 0x14, 0x92, 0x3b, 0xa0, 0x24, 0x8b, 0x05, 0x14, 0x44, 0xb7, 0x0b, 0x88, 0x51, 0x86, 0x28,
+0xed, 0x04, 0xc0, 0x01, 0xaa, 0x04, 0x9b, 0x10, 0x9c, 0x39, 0xb8, 0x20, 0x81, 0x02, 0x84, 0x04,
+0xac, 0x04, 0xad, 0x0d, 0x8a, 0x3c, 0xac, 0x0d, 0x38, 0xc0, 0x09, 0x98, 0x04, 0xdf, 0x19, 0xd0,
+0x1c, 0xc3, 0x09, 0x84, 0x02, 0xc8, 0x07, 0xe4, 0x02, 0x85, 0x28, 0xdd, 0x05, 0xc1, 0x1e, 0xd7,
+0x05, 0x8a, 0x08, 0xc2, 0x03, 0xbd, 0x48, 0xd3, 0x1b, 0x93, 0x26, 0xbf, 0x09, 0xd2, 0x07, 0xae,
+0x06, 0x8b, 0x27, 0xb5, 0x20, 0x9f, 0x0f, 0xe7, 0x06, 0xae, 0x03, 0x96, 0x02, 0xe8, 0x03, 0xf1,
+0x16, 0xb8, 0x0b, 0xe1, 0x02, 0xdb, 0x01, 0x5e, 0xf2, 0x16, 0xf1, 0x16, 0xe6, 0x18, 0xf4, 0x02,
+0xb7, 0x06, 0x1e, 0xb2, 0x0c, 0xe1, 0x04, 0x84, 0x14, 0xcc, 0x03, 0xb1, 0x05, 0x9d, 0x05, 0x84,
+0x14, 0xad, 0x0d, 0xb8, 0x0b, 0x0a, 0xe7, 0x03, 0xff, 0x02, 0x90, 0x12, 0xcf, 0x07, 0xf3, 0x01,
+0xab, 0x01, 0x44, 0x13, 0xa6, 0x0e, 0xc9, 0x08, 0xee, 0x02, 0xa3, 0x01, 0x1d, 0xa1, 0x04, 0xa2,
+0x0f, 0xe7, 0x03, 0xcc, 0x08, 0xc3, 0x02, 0xab, 0x01, 0x55, 0x82, 0x14, 0xc4, 0x09, 0xb2, 0x0c,
+0x12, 0x91, 0x03, 0xe5, 0x01, 0x84, 0x14, 0x9c, 0x10, 0xc2, 0x1e, 0x82, 0x02, 0x8d, 0x04, 0x71,
+0xa8, 0x0e, 0x94, 0x11, 0xf8, 0x15, 0xe6, 0x01, 0xcf, 0x02, 0x13, 0xb8, 0x0b, 0x84, 0x14, 0xda,
+0x1a, 0x4b, 0xe1, 0x05, 0xda, 0x02, 0xdf, 0x19, 0xf8, 0x15, 0x79, 0xca, 0x01, 0xc7, 0x04, 0xb6,
+0x01, 0xf1, 0x16, 0xca, 0x08, 0xdb, 0x05, 0x8e, 0x04, 0xe1, 0x02, 0x43, 0xb5, 0x20, 0xb4, 0x0c,
+0xb9, 0x0b, 0xb6, 0x04, 0xd5, 0x03, 0x3a, 0xeb, 0x17, 0x90, 0x12, 0xb1, 0x0c, 0x9a, 0x03, 0x9d,
+0x02, 0xbf, 0x01, 0xcf, 0x07, 0xfc, 0x14, 0x7a, 0x74, 0x4b, 0x90, 0x01, 0xa7, 0x0e, 0xfe, 0x14,
+0xb8, 0x0b, 0xf9, 0x01, 0xad, 0x01, 0x39, 0x9f, 0x0f, 0xd4, 0x1b, 0xe4, 0x04, 0xd3, 0x03, 0xa2,
+0x04, 0x7e, 0xc5, 0x09, 0xee, 0x02, 0xb2, 0x0c, 0x83, 0x07, 0x74, 0xe2, 0x02, 0xa8, 0x37, 0xe6,
+0x18, 0xc1, 0x1e, 0x8f, 0x0c, 0xd2, 0x0f, 0xb3, 0x07, 0x88, 0x28, 0xb1, 0x0c, 0xdb, 0x05, 0x9e,
+0x08, 0xb3, 0x02, 0xda, 0x0f, 0xdc, 0x05, 0xed, 0x40, 0xdd, 0x05, 0x96, 0x07, 0xcd, 0x02, 0xd6,
+0x03, 0xb5, 0x20, 0x8d, 0x79, 0xbe, 0x1f, 0xd4, 0x09, 0xef, 0x04, 0xbb, 0x02, 0xb7, 0x49, 0xc9,
+0x84, 0x01, 0x89, 0x13, 0xec, 0x0d, 0xcd, 0x05, 0x8f, 0x0c, 0xff, 0x28, 0xdf, 0x42, 0xdc, 0x05,
+0xe7, 0x11, 0x97, 0x01, 0x41, 0xd9, 0x1a, 0x93, 0x4f, 0xcc, 0x31, 0xc3, 0x10, 0xad, 0x01, 0x5f,
+0xd6, 0x06, 0xbf, 0x33, 0x9c, 0x39, 0xa1, 0x0f, 0xa2, 0x04, 0x72, 0xde, 0x2e, 0x8a, 0x13, 0x8e,
+0x27, 0xd9, 0x07, 0xc0, 0x04, 0xf7, 0x04, 0xa6, 0x75, 0xec, 0x40, 0xec, 0x17, 0xcb, 0x03, 0xbe,
+0x07, 0xf5, 0x02, 0xf2, 0x7d, 0xf8, 0x3e, 0xb8, 0x0b, 0xce, 0x05, 0x98, 0x01, 0x74, 0x9a, 0x4e,
+0xaa, 0x37, 0xee, 0x02, 0x90, 0x09, 0x6a, 0xd1, 0x01, 0xf6, 0x2a, 0xc0, 0x33, 0x7a, 0xd4, 0x09,
+0x95, 0x02, 0x9b, 0x03, 0xc8, 0x1d, 0xce, 0x45, 0xf4, 0x01, 0xa2, 0x07, 0x81, 0x05, 0x1d, 0xc4,
+0x09, 0xa0, 0x4d, 0xec, 0x17, 0x98, 0x04, 0xc9, 0x09, 0xe0, 0x03, 0x99, 0x10, 0xc8, 0x1d, 0xec,
+0x17, 0xeb, 0x02, 0x99, 0x06, 0x2f, 0xbf, 0x0a, 0xb0, 0x36, 0xde, 0x2e, 0xdb, 0x01, 0xdb, 0x04,
+0x9f, 0x02, 0x89, 0x13, 0x86, 0x28, 0xb2, 0x4a, 0xf5, 0x02, 0x83, 0x04, 0xa1, 0x01, 0xab, 0x0d,
+0x82, 0x29, 0xd8, 0x2f, 0x7c, 0x9f, 0x02, 0x25, 0x87, 0x28, 0xd8, 0x2f, 0xde, 0x2e, 0xb8, 0x03,
+0xc5, 0x02, 0xdd, 0x01, 0xa7, 0x37, 0xf4, 0x2a, 0xc2, 0x1e, 0xc0, 0x04, 0xab, 0x04, 0x0a, 0x9b,
+0x39, 0xb4, 0x0c, 0xf2, 0x16, 0xe7, 0x06, 0xfd, 0x02, 0x25, 0xa3, 0x23, 0xee, 0x02, 0xe2, 0x04,
+0xd7, 0x05, 0xfb, 0x03, 0x6a, 0xcd, 0x1c, 0xa1, 0x0f, 0xf3, 0x01, 0xf3, 0x05, 0x1b, 0x8c, 0x02,
+0x9f, 0x24, 0xbf, 0x33, 0x00, 0xc6, 0x02, 0xf8, 0x04, 0xbb, 0x02, 0xf7, 0x15, 0xeb, 0x40, 0xb8,
+0x0b, 0x9e, 0x02, 0xf6, 0x07, 0x56, 0xd5, 0x06, 0xa3, 0x61, 0xac, 0x22, 0xd0, 0x0a, 0xf0, 0x0c,
+0x9c, 0x03, 0xb4, 0x35, 0xdb, 0x6c, 0x94, 0x11, 0x9a, 0x01, 0xd2, 0x01, 0x60, 0x83, 0x14, 0xcb,
+0x31, 0x9a, 0x25, 0x8d, 0x0f, 0x84, 0x07, 0x8d, 0x07, 0x8d, 0x12, 0xe9, 0x2c, 0x9a, 0x77, 0xc9,
+0x09, 0x9a, 0x04, 0xe2, 0x02, 0xc4, 0x09, 0x83, 0x3d, 0xd8, 0x96, 0x01, 0x84, 0x04, 0xda, 0x04,
+0xbe, 0x04, 0xec, 0x17, 0xa7, 0x37, 0xce, 0x83, 0x01, 0x55, 0x30, 0xd7, 0x02, 0xf8, 0x15, 0xfd,
+0x14, 0xfe, 0x52, 0x88, 0x03, 0xa0, 0x02, 0x6a, 0x98, 0x25, 0xcb, 0x08, 0xc6, 0x5b, 0x80, 0x03,
+0xa9, 0x02, 0xce, 0x02, 0xf2, 0x16, 0xf4, 0x01, 0x90, 0x3b, 0x90, 0x01, 0xa1, 0x01, 0x6a, 0xf8,
+0x15, 0xfe, 0x14, 0xb0, 0x36, 0x00, 0xef, 0x01, 0x43, 0x96, 0x11, 0xae, 0x36, 0xbe, 0x33, 0xac,
+0x01, 0xeb, 0x02, 0xd1, 0x04, 0xac, 0x0d, 0x92, 0x3b, 0xf0, 0x2b, 0xe6, 0x01, 0x81, 0x02, 0xc3,
+0x02, 0xc0, 0x0a, 0x88, 0x51, 0xa2, 0x38, 0x72, 0xf5, 0x02, 0xdd, 0x01, 0x00, 0x8e, 0x50, 0x9e,
+0x39, 0x00, 0x87, 0x03, 0x25, 0xef, 0x02, 0x96, 0x3a, 0xcc, 0x31, 0x44, 0xe5, 0x01, 0x8f, 0x01,
+0xed, 0x02, 0xb8, 0x49, 0xa4, 0x4c, 0x2f, 0xdb, 0x01, 0xbd, 0x01, 0xbd, 0x0a, 0xdc, 0x43, 0xca,
+0x46, 0xb5, 0x01, 0xc9, 0x01, 0xa8, 0x02, 0x9b, 0x10, 0x9e, 0x24, 0xd8, 0x2f, 0x5f, 0xdb, 0x01,
+0x25, 0xd3, 0x1b, 0xc2, 0x1e, 0xea, 0x2c, 0x0a, 0xf7, 0x01, 0x82, 0x02, 0xa3, 0x23, 0xba, 0x0b,
+0x8a, 0x13, 0xd1, 0x01, 0xbf, 0x01, 0x56, 0x93, 0x26, 0xcb, 0x08, 0xee, 0x02, 0x69, 0x0a, 0xb4,
+0x02, 0xc1, 0x1e, 0x9f, 0x0f, 0xdd, 0x05, 0x42, 0xc8, 0x01, 0x43, 0xfd, 0x14, 0xd3, 0x1b, 0xe7,
+0x03, 0x07, 0xba, 0x03, 0xdc, 0x01, 0xe7, 0x03, 0xdf, 0x19, 0xf4, 0x01, 0xbe, 0x01, 0x9e, 0x02,
+0x09, 0xd2, 0x07, 0x89, 0x13, 0xd8, 0x06, 0x30, 0x9a, 0x01, 0x28, 0xfc, 0x14, 0xe5, 0x18, 0xa0,
+0x0f, 0x2f, 0x3a, 0x68, 0xec, 0x17, 0xb5, 0x20, 0x90, 0x12, 0xa4, 0x01, 0x2f, 0x60, 0xc6, 0x09,
+0xdf, 0x19, 0xd0, 0x07, 0x68, 0x4d, 0x09, 0xca, 0x08, 0x87, 0x28, 0x90, 0x12, 0x74, 0xed, 0x01,
+0x30, 0xdc, 0x05, 0xcd, 0x1c, 0xe6, 0x18, 0xac, 0x01, 0xbb, 0x02, 0x41, 0xcc, 0x08, 0xf7, 0x15,
+0xec, 0x17, 0xfa, 0x01, 0x12, 0x9f, 0x02, 0xa6, 0x0e, 0xd3, 0x1b, 0xc2, 0x1e, 0xb6, 0x01, 0x96,
+0x02, 0xd1, 0x04, 0xa8, 0x0e, 0x9f, 0x0f, 0xec, 0x17, 0xee, 0x01, 0x86, 0x01, 0x9d, 0x02, 0xf2,
+0x16, 0xdc, 0x05, 0xa4, 0x23, 0x26, 0x25, 0x4d, 0x9a, 0x10, 0xca, 0x08, 0x9a, 0x25, 0x0a, 0xbf,
+0x01, 0xdb, 0x01, 0x7a, 0xc6, 0x09, 0xe0, 0x19, 0x41, 0x69, 0x97, 0x01, 0xc9, 0x08, 0xbc, 0x1f,
+0xf4, 0x2a, 0xd8, 0x02, 0xbb, 0x02, 0xe3, 0x02, 0xeb, 0x17, 0x88, 0x13, 0xbe, 0x1f, 0xdc, 0x01,
+0x11, 0xb7, 0x03, 0x9b, 0x10, 0x84, 0x14, 0xbc, 0x1f, 0x56, 0xa9, 0x02, 0x25, 0x8d, 0x12, 0xb4,
+0x0c, 0x9a, 0x10, 0x07, 0x11, 0x00, 0xf7, 0x15, 0x88, 0x13, 0xca, 0x1d, 0x7c, 0x25, 0xc3, 0x05,
+0xb1, 0x21, 0xa0, 0x24, 0x9e, 0x24, 0x88, 0x03, 0x42, 0x56, 0xd3, 0x1b, 0xc6, 0x32, 0xfc, 0x29,
+0xac, 0x04, 0xbd, 0x04, 0x72, 0xa9, 0x22, 0xae, 0x36, 0xcc, 0x31, 0x72, 0x55, 0xbe, 0x04, 0xe3,
+0x2d, 0xdc, 0x43, 0xc2, 0x47, 0x9a, 0x01, 0x89, 0x03, 0x71, 0xa7, 0x37, 0xae, 0x36, 0xdc, 0x43,
+0x87, 0x03, 0xe0, 0x03, 0xf8, 0x01, 0xa3, 0x23, 0xd4, 0x1b, 0xce, 0x1c, 0xdd, 0x01, 0xb6, 0x01,
+0x80, 0x03, 0xe3, 0x2d, 0xc2, 0x1e, 0x96, 0x11, 0x5d, 0xb6, 0x01, 0x82, 0x02, 0xe3, 0x2d, 0x7a,
+0xed, 0x02, 0x42, 0x25, 0x90, 0x04, 0xd9, 0x1a, 0xd5, 0x06, 0xa1, 0x0f, 0x11, 0x88, 0x03, 0xd1,
+0x04, 0xd9, 0x1a, 0xa1, 0x0f, 0xc7, 0x1d, 0xef, 0x01, 0xf8, 0x01, 0x91, 0x03, 0x95, 0x11, 0xbb,
+0x1f, 0xbb, 0x1f, 0x7b, 0x8d, 0x01, 0xfe, 0x02, 0xdf, 0x19, 0x93, 0x26, 0xd3, 0x1b, 0x83, 0x02,
+0x2f, 0xb1, 0x02, 0xd9, 0x1a, 0xad, 0x36, 0x95, 0x11, 0xd1, 0x01, 0xe6, 0x01, 0xef, 0x01, 0xf3,
+0x01, 0x95, 0x3a, 0xee, 0x02, 0x43, 0x7d, 0x7b, 0xf1, 0x16, 0xfd, 0x3d, 0xbe, 0x0a, 0x7e, 0xa8,
+0x05, 0x55, 0xe1, 0x04, 0x87, 0x51, 0xac, 0x22, 0xf4, 0x02, 0xc0, 0x04, 0x39, 0xe2, 0x04, 0xcf,
+0x45, 0x8c, 0x27, 0xf2, 0x03, 0xe8, 0x03, 0x26, 0xe0, 0x19, 0xd7, 0x2f, 0xae, 0x36, 0xcc, 0x03,
+0xf0, 0x06, 0x67, 0xbe, 0x1f, 0xc1, 0x1e, 0xd8, 0x2f, 0xd0, 0x02, 0xd0, 0x02, 0x98, 0x04, 0xe2,
+0x2d, 0x93, 0x26, 0xcc, 0x31, 0x86, 0x01, 0xe2, 0x05, 0xac, 0x04, 0xd8, 0x2f, 0x85, 0x28, 0xec,
+0x17, 0xc0, 0x01, 0xce, 0x02, 0xc4, 0x02, 0xf6, 0x2a, 0xa5, 0x23, 0xb4, 0x0c, 0x4d, 0xac, 0x04,
+0xc3, 0x02, 0xf8, 0x3e, 0xb5, 0x20, 0xb2, 0x0c, 0x85, 0x01, 0xac, 0x01, 0x88, 0x03, 0xc0, 0x33,
+0xc7, 0x1d, 0x8a, 0x13, 0xa4, 0x01, 0x97, 0x01, 0x3a, 0xa6, 0x23, 0xdf, 0x19, 0x90, 0x12, 0xbf,
+0x01, 0xad, 0x06, 0x5e, 0xce, 0x1c, 0x00, 0xbc, 0x1f, 0x4b, 0xc7, 0x07, 0xa0, 0x02, 0xb8, 0x0b,
+0xde, 0x2e, 0xe4, 0x2d, 0x13, 0xfb, 0x03, 0xd1, 0x01, 0xe7, 0x03, 0xd2, 0x30, 0xe0, 0x19, 0x90,
+0x01, 0xb7, 0x03, 0xb7, 0x03, 0x93, 0x11, 0xd4, 0x44, 0xd4, 0x1b, 0x30, 0xa1, 0x04, 0xc9, 0x01,
+0xa1, 0x0f, 0xe8, 0x41, 0x9a, 0x10, 0xbf, 0x01, 0xb1, 0x02, 0x42, 0xcd, 0x1c, 0xbc, 0x5d, 0xbc,
+0x1f, 0xe7, 0x03, 0x8b, 0x02, 0x25, 0xfb, 0x29, 0xb8, 0x72, 0x86, 0x3d, 0xc9, 0x09, 0xd8, 0x02,
+0x6a, 0xd9, 0x1a, 0xcc, 0x5a, 0xe6, 0x41, 0xe2, 0x02, 0x86, 0x01, 0xe1, 0x02, 0x9d, 0x24, 0xf6,
+0x68, 0x84, 0x52, 0x8e, 0x07, 0x80, 0x03, 0xdb, 0x01, 0x87, 0x28, 0xc6, 0x5b, 0x96, 0x3a, 0xd6,
+0x0b, 0x42, 0xc5, 0x05, 0xcb, 0x31, 0xd0, 0x45, 0x84, 0x14, 0xc0, 0x01, 0x8a, 0x03, 0xbd, 0x04,
+0xad, 0x36, 0xb6, 0x20, 0xb9, 0x0b, 0x8a, 0x08, 0xad, 0x01, 0xf1, 0x06, 0xed, 0x69, 0xa8, 0x0e,
+0xa1, 0x38, 0x9a, 0x06, 0x00, 0xf9, 0x06, 0xd7, 0x58, 0x8e, 0x12, 0xdb, 0x43, 0x83, 0x04, 0xae,
+0x01, 0x56, 0xc3, 0x47, 0xf3, 0x01, 0xdf, 0x42, 0x8e, 0x07, 0x08, 0xa0, 0x02, 0x99, 0x25, 0x83,
+0x14, 0xdd, 0x2e, 0xdf, 0x03, 0xb0, 0x03, 0xb2, 0x05, 0xbb, 0x1f, 0xd5, 0x2f, 0xe9, 0x2c, 0xe9,
+0x08, 0xc8, 0x04, 0x96, 0x07, 0xc7, 0x1d, 0x9f, 0x4d, 0xa9, 0x22, 0x8f, 0x06, 0xfe, 0x05, 0xa2,
+0x04, 0x83, 0x14, 0xff, 0x66, 0xe5, 0x18, 0x9f, 0x02, 0x80, 0x08, 0xa8, 0x05, 0x7a, 0x89, 0x51,
+0xb3, 0x0c, 0x86, 0x01, 0xc0, 0x04, 0xbc, 0x02, 0xd8, 0x06, 0xb3, 0x5e, 0xf6, 0x01, 0xcc, 0x03,
+0xe6, 0x06, 0xb6, 0x01, 0xc2, 0x1e, 0xe5, 0x56, 0xb2, 0x0c, 0xae, 0x03, 0x92, 0x06, 0x60, 0xb6,
+0x20, 0x8f, 0x3b, 0xbe, 0x0a, 0x8c, 0x02, 0xa2, 0x01, 0xf0, 0x01, 0xcc, 0x31, 0xf1, 0x3f, 0xc6,
+0x09, 0xca, 0x04, 0xb6, 0x01, 0xf8, 0x01, 0xd6, 0x44, 0xed, 0x40, 0xb9, 0x0b, 0xd2, 0x01, 0x2d,
+0x9a, 0x01, 0xfe, 0x3d, 0x9b, 0x39, 0xcd, 0x1c, 0xeb, 0x02, 0x42, 0xd8, 0x02, 0xde, 0x2e, 0xf5,
+0x2a, 0xf1, 0x16, 0x55, 0x91, 0x03, 0x7e, 0x98, 0x25, 0x9b, 0x39, 0xc7, 0x1d, 0xa5, 0x03, 0xa9,
+0x02, 0x7d, 0xda, 0x1a, 0xef, 0x2b, 0xb7, 0x0b, 0xd7, 0x05, 0x8b, 0x07, 0x1b, 0xae, 0x0d, 0xf7,
+0x15, 0xd0, 0x07, 0x95, 0x02, 0xa1, 0x07, 0x81, 0x02, 0xca, 0x08, 0x00, 0xde, 0x2e, 0xc3, 0x0d,
+0xe1, 0x05, 0x7b, 0xa8, 0x0e, 0xdc, 0x43, 0xe0, 0x80, 0x01, 0x39, 0xf1, 0x08, 0xca, 0x06, 0xbd,
+0x1f, 0xb0, 0x21, 0x8c, 0x65, 0x96, 0x0d, 0x99, 0x01, 0xd3, 0x09, 0xd3, 0x1b, 0xe8, 0x41, 0xc8,
+0x84, 0x01, 0xe6, 0x06, 0x86, 0x01, 0x55, 0xf1, 0x16, 0x8a, 0x3c, 0xc6, 0x5b, 0xa2, 0x04, 0xa2,
+0x01, 0xf5, 0x02, 0xbf, 0x33, 0x98, 0x3a, 0x98, 0x63, 0x84, 0x07, 0xe2, 0x08, 0xc3, 0x05, 0xbb,
+0x1f, 0xd6, 0x2f, 0x9e, 0x39, 0xec, 0x08, 0xa8, 0x02, 0xb5, 0x04, 0xbb, 0x1f, 0xe0, 0x19, 0xca,
+0x08, 0x8e, 0x04, 0xa6, 0x03, 0xe6, 0x01, 0xbf, 0x33, 0xbe, 0x1f, 0xc1, 0x1e, 0xda, 0x07, 0x42,
+0xc7, 0x01, 0xbd, 0x48, 0xd4, 0x1b, 0x87, 0x51, 0x88, 0x03, 0x8c, 0x02, 0xd9, 0x07, 0xd1, 0x30,
+0xfe, 0x14, 0xc7, 0x5b, 0xd3, 0x06, 0xf0, 0x01, 0x1c, 0xed, 0x2b, 0x9a, 0x10, 0x83, 0x3d, 0x30,
+0xa2, 0x01, 0x7b, 0x8d, 0x27, 0xb7, 0x0b, 0xf9, 0x3e, 0xc8, 0x04, 0xea, 0x03, 0x30, 0x00, 0x95,
+0x11, 0xb5, 0x20, 0xc7, 0x04, 0x56, 0xae, 0x06, 0xb1, 0x0c, 0xfb, 0x29, 0x83, 0x14, 0xcc, 0x06,
+0x42, 0xbe, 0x01, 0xd1, 0x07, 0xbf, 0x33, 0x9d, 0x24, 0x9f, 0x05, 0xd8, 0x05, 0x86, 0x01, 0xe6,
+0x18, 0x83, 0x3d, 0x8d, 0x27, 0xe1, 0x02, 0x11, 0x8e, 0x07, 0xe1, 0x04, 0x87, 0x51, 0xd7, 0x2f,
+0x8d, 0x04, 0x84, 0x07, 0x86, 0x07, 0xdc, 0x05, 0xc3, 0x47, 0xc1, 0x1e, 0xc9, 0x01, 0x2f, 0x88,
+0x03, 0xba, 0x0b, 0x8b, 0x65, 0xef, 0x2b, 0x56, 0xae, 0x06, 0x39, 0xc8, 0x1d, 0xc9, 0x6f, 0xdb,
+0x2e, 0xdb, 0x01, 0x7c, 0x7c, 0x86, 0x28, 0xe7, 0x6a, 0xe9, 0x2c, 0xd6, 0x03, 0xd1, 0x01, 0x3a,
+0xb8, 0x20, 0x8d, 0x50, 0xef, 0x2b, 0x98, 0x04, 0x00, 0x8b, 0x02, 0xfa, 0x29, 0xff, 0x66, 0x9f,
+0x4d, 0xdd, 0x03, 0x8e, 0x04, 0x1c, 0x82, 0x29, 0xf7, 0x53, 0xb3, 0x35, 0xdd, 0x06, 0xa7, 0x05,
+0x6a, 0xd6, 0x06, 0x8f, 0x3b, 0x99, 0x10, 0xf7, 0x04, 0xff, 0x07, 0x9a, 0x01, 0xf3, 0x01, 0xe9,
+0x2c, 0xe0, 0x19, 0x1c, 0xe1, 0x0d, 0xdc, 0x01, 0x00, 0xd5, 0x06, 0xee, 0x2b, 0xc0, 0x01, 0xdb,
+0x07, 0xdf, 0x03, 0xd0, 0x07, 0xd4, 0x1b, 0xac, 0x22, 0x09, 0xae, 0x01, 0x83, 0x07, 0xc4, 0x47,
+0xae, 0x36, 0xc6, 0x5b, 0xe7, 0x3a, 0xfc, 0x16, 0xaa, 0x1d, 0x8c, 0xa3, 0x01, 0xbc, 0x5d, 0x88,
+0xf6, 0x01, 0xf8, 0x3b, 0xe5, 0x0f, 0xb9, 0x18, 0xda, 0x43, 0xb8, 0x0b, 0x8a, 0xa3, 0x01, 0xf4,
+0x1b, 0xf8, 0x12, 0x12, 0xd8, 0x2f, 0x8c, 0x3c, 0x96, 0x3a, 0xde, 0x06, 0x92, 0x0b, 0x11, 0x9c,
+0x39, 0xb2, 0x4a, 0xcc, 0x08, 0x8e, 0x04, 0x86, 0x01, 0xf9, 0x04, 0x99, 0x10, 0xc4, 0x09, 0xa5,
+0x4c, 0xa1, 0x04, 0xa6, 0x06, 0xc9, 0x03, 0x8f, 0x12, 0xdf, 0x19, 0xa5, 0x8a, 0x01, 0xa7, 0x05,
+0xc8, 0x01, 0xd2, 0x04, 0xb3, 0x0c, 0xc3, 0x09, 0xad, 0x5f, 0xdc, 0x01, 0xc9, 0x06, 0xbe, 0x01,
+0xc9, 0x08, 0xc1, 0x5c, 0xb7, 0x87, 0x01, 0x71, 0x8f, 0x01, 0x97, 0x0c, 0x9f, 0x0f, 0xcd, 0x83,
+0x01, 0xad, 0x5f, 0x8f, 0x01, 0xed, 0x07, 0xc6, 0x07, 0x81, 0x29, 0xed, 0x40, 0xa5, 0x23, 0x09,
+0xf7, 0x04, 0xf0, 0x04, 0x9b, 0x39, 0xe7, 0x2c, 0xb7, 0x0b, 0x7b, 0xab, 0x01, 0xc8, 0x01, 0xe7,
+0x41, 0xdc, 0x05, 0x89, 0x13, 0xb7, 0x03, 0x7c, 0xfa, 0x01, 0xf7, 0x3e, 0xee, 0x2b, 0xf5, 0x2a,
+0xb7, 0x06, 0xaa, 0x02, 0xf8, 0x01, 0xa7, 0x37, 0xb0, 0x36, 0xf3, 0x2a, 0x9a, 0x01, 0xeb, 0x02,
+0x8b, 0x02, 0xdb, 0x43, 0xa0, 0x4d, 0x9f, 0x4d, 0xbe, 0x04, 0x85, 0x01, 0x30, 0xf3, 0x3f, 0xfe,
+0x3d, 0x85, 0x66, 0x90, 0x01, 0x5e, 0xf1, 0x03, 0x85, 0x28, 0xf0, 0x2b, 0x9f, 0x4d, 0xbc, 0x02,
+0xe3, 0x01, 0xc7, 0x01, 0xb9, 0x34, 0xc2, 0x1e, 0xdb, 0x6c, 0x2f, 0xac, 0x01, 0xf9, 0x01, 0xad,
+0x0d, 0xb8, 0x0b, 0xd7, 0x2f, 0xe5, 0x01, 0x9e, 0x02, 0xde, 0x03, 0xba, 0x0b, 0xe4, 0x04, 0x00,
+0xdc, 0x04, 0xf0, 0x01, 0xaa, 0x02, 0xfa, 0x29, 0xef, 0x02, 0xd2, 0x30, 0x80, 0x05, 0xca, 0x01,
+0xd2, 0x01, 0xf4, 0x3f, 0xa5, 0x0e, 0xda, 0x43, 0xa0, 0x02, 0x1c, 0x44, 0xfc, 0x52, 0xbb, 0x1f,
+0xc4, 0x47, 0xbc, 0x02, 0x60, 0x25, 0xe8, 0x41, 0x93, 0x26, 0x84, 0x3d, 0xf0, 0x01, 0x96, 0x02,
+0x13, 0xae, 0x5f, 0xd7, 0x58, 0x94, 0x4f, 0x56, 0xc2, 0x03, 0xb5, 0x01, 0xc8, 0x5b, 0x97, 0x63,
+0x9e, 0x62, 0xc6, 0x02, 0xc2, 0x03, 0xb2, 0x02, 0xd6, 0x44, 0xf9, 0x67, 0xbc, 0x5d, 0x60, 0xc0,
+0x01, 0xcc, 0x03, 0xdc, 0x2e, 0xed, 0x40, 0x96, 0x3a, 0x26, 0xae, 0x03, 0x90, 0x01, 0xa6, 0x4c,
+0xfb, 0x52, 0xe8, 0x41, 0x42, 0x09, 0x00, 0x86, 0x3d, 0xb9, 0x34, 0xba, 0x34, 0x37, 0x9a, 0x04,
+0x8e, 0x04, 0x98, 0x25, 0xd3, 0x1b, 0x8e, 0x12, 0x12, 0xd2, 0x01, 0x86, 0x01, 0x8e, 0x27, 0x95,
+0x11, 0x79, 0xef, 0x01, 0xd8, 0x02, 0xa6, 0x03, 0xa6, 0x0e, 0xdb, 0x05, 0xeb, 0x17, 0x67, 0x86,
+0x01, 0xb2, 0x02, 0xe1, 0x04, 0xee, 0x02, 0xc1, 0x1e, 0x4d, 0x86, 0x01, 0xda, 0x02, 0xf1, 0x16,
+0x9c, 0x10, 0xf1, 0x16, 0x58, 0xbd, 0x01, 0xbe, 0x01, 0xb5, 0x20, 0x86, 0x28, 0x85, 0x28, 0x57,
+0xb3, 0x02, 0x44, 0xa3, 0x23, 0xc6, 0x32, 0xdd, 0x2e, 0xad, 0x03, 0xe7, 0x03, 0x39, 0xfd, 0x14,
+0xd2, 0x30, 0x97, 0x25, 0xf9, 0x01, 0xb1, 0x02, 0x30, 0x83, 0x14, 0x88, 0x51, 0xcb, 0x31, 0xf7,
+0x01, 0x87, 0x03, 0xc7, 0x01, 0xb7, 0x0b, 0xce, 0x5a, 0xdd, 0x2e, 0x00, 0xd9, 0x02, 0x38, 0xe3,
+0x04, 0xb2, 0x4a, 0xfb, 0x29, 0xb6, 0x01, 0x81, 0x02, 0x11, 0xe7, 0x03, 0xc0, 0x5c, 0x83, 0x3d,
+0xca, 0x01, 0xdb, 0x01, 0x55, 0xf3, 0x01, 0xdc, 0x43, 0x87, 0x28, 0x72, 0x7c, 0x12, 0xab, 0x0d,
+0xde, 0x57, 0x91, 0x26, 0xc0, 0x01, 0xc0, 0x01, 0x86, 0x01, 0xfd, 0x14, 0xa0, 0x4d, 0xf1, 0x16,
+0xa4, 0x03, 0xc8, 0x04, 0xc7, 0x01, 0xcd, 0x1c, 0xf6, 0x2a, 0xdb, 0x05, 0xd0, 0x05, 0xa8, 0x02,
+0xfd, 0x05, 0xa1, 0x0f, 0xd4, 0x1b, 0xe5, 0x18, 0xf2, 0x0b, 0xdc, 0x04, 0xbb, 0x02, 0xcf, 0x07,
+0xe0, 0x19, 0xdb, 0x43, 0xf2, 0x03, 0xb6, 0x04, 0xa3, 0x01, 0x84, 0x14, 0xba, 0x0b, 0x91, 0x26,
+0x8b, 0x02, 0x26, 0xd4, 0x01, 0xd4, 0x1b, 0xe9, 0x03, 0xe8, 0x03, 0x69, 0xef, 0x01, 0x68, 0x92,
+0x26, 0xe9, 0x17, 0x80, 0x29, 0x71, 0x71, 0x0a, 0xde, 0x2e, 0x87, 0x28, 0xae, 0x36, 0xac, 0x01,
+0xef, 0x01, 0x1b, 0xb6, 0x20, 0xd9, 0x1a, 0xe4, 0x2d, 0x2f, 0xef, 0x01, 0x8f, 0x01, 0x94, 0x26,
+0x99, 0x25, 0xa6, 0x23, 0x5f, 0xab, 0x01, 0x39, 0xfa, 0x29, 0x9f, 0x0f, 0x8c, 0x27, 0x2f, 0x25,
+0xdb, 0x01, 0xec, 0x17, 0xc9, 0x08, 0xf2, 0x16, 0xf0, 0x01, 0xa3, 0x01, 0x82, 0x02, 0xc8, 0x1d,
+0xd1, 0x07, 0xe0, 0x19, 0xe2, 0x02, 0xf7, 0x01, 0xb1, 0x02, 0xec, 0x17, 0xe8, 0x03, 0xf8, 0x15,
+0xbc, 0x02, 0xb1, 0x02, 0x13, 0xcc, 0x08, 0x7a, 0x90, 0x12, 0xb6, 0x01, 0xc9, 0x01, 0x41, 0xdd,
+0x05, 0xf3, 0x01, 0x8e, 0x12, 0x41, 0xab, 0x01, 0x69, 0x99, 0x10, 0x87, 0x13, 0xae, 0x0d, 0xcf,
+0x02, 0xf9, 0x01, 0x71, 0xbf, 0x0a, 0x95, 0x11, 0xd0, 0x07, 0xe5, 0x01, 0x41, 0xdc, 0x01, 0xe1,
+0x04, 0xe5, 0x18, 0xa2, 0x0f, 0xe5, 0x01, 0x72, 0x42, 0xe8, 0x03, 0x89, 0x13, 0xfc, 0x14, 0xa4,
+0x01, 0xb6, 0x01, 0xd4, 0x01, 0xba, 0x0b, 0xdb, 0x05, 0xd2, 0x07, 0xdc, 0x01, 0xb6, 0x01, 0xbc,
+0x02, 0xc4, 0x09, 0x79, 0xe8, 0x03, 0xce, 0x02, 0xc2, 0x03, 0x00, 0xc0, 0x0a, 0xe8, 0x03, 0xc9,
+0x08, 0xaa, 0x02, 0xec, 0x02, 0x26, 0xf5, 0x01, 0xd0, 0x07, 0xfd, 0x14, 0xa8, 0x02, 0xf2, 0x03,
+0x8c, 0x02, 0xab, 0x0d, 0xb4, 0x0c, 0xa5, 0x23, 0x5f, 0xa0, 0x02, 0x0a, 0xcd, 0x1c, 0xc4, 0x09,
+0xed, 0x2b, 0x71, 0xac, 0x01, 0xac, 0x01, 0xc5, 0x32, 0xcc, 0x08, 0xb7, 0x49, 0xf9, 0x01, 0x60,
+0x7c, 0xb9, 0x34, 0xb6, 0x20, 0xc7, 0x5b, 0xb5, 0x01, 0x4b, 0xac, 0x01, 0xdd, 0x2e, 0x8c, 0x27,
+0x9d, 0x62, 0x86, 0x01, 0x1d, 0xf0, 0x01, 0xcd, 0x1c, 0xfc, 0x29, 0x8d, 0x50, 0xbc, 0x02, 0x11,
+0x5f, 0xf1, 0x16, 0xb8, 0x49, 0x95, 0x63, 0xf2, 0x03, 0x99, 0x01, 0x44, 0x83, 0x14, 0x82, 0x52,
+0xc7, 0x5b, 0x90, 0x04, 0x0a, 0x1d, 0x99, 0x10, 0x9c, 0x39, 0x89, 0x3c, 0x82, 0x02, 0x26, 0xdb,
+0x01, 0xbf, 0x0a, 0xfa, 0x3e, 0xe1, 0x42, 0xa8, 0x02, 0xab, 0x01, 0xed, 0x01, 0xab, 0x0d, 0xa4,
+0x23, 0xfb, 0x29, 0x7e, 0x4b, 0x4d, 0xb3, 0x0c, 0xd4, 0x1b, 0xf3, 0x2a, 0xee, 0x01, 0xf9, 0x01,
+0xa7, 0x02, 0x79, 0xf4, 0x01, 0xbb, 0x1f, 0xa4, 0x01, 0xa1, 0x01, 0xa3, 0x01, 0x7a, 0xc3, 0x09,
+0x8f, 0x12, 0x1d, 0xf9, 0x01, 0xbd, 0x01, 0x90, 0x12, 0xaf, 0x21, 0x8f, 0x12, 0xb6, 0x01, 0xe1,
+0x02, 0xd9, 0x02, 0xce, 0x1c, 0x87, 0x28, 0xca, 0x08, 0x4e, 0xa1, 0x04, 0x1e, 0x84, 0x14, 0x97,
+0x25, 0xfe, 0x14, 0x00, 0xd7, 0x02, 0x43, 0xd4, 0x1b, 0xe1, 0x42, 0xfc, 0x29, 0xbb, 0x02, 0xfb,
+0x03, 0x60, 0xac, 0x0d, 0xd1, 0x30, 0xa4, 0x23, 0xdb, 0x01, 0xbb, 0x02, 0x26, 0xc0, 0x0a, 0xeb,
+0x40, 0xb8, 0x20, 0xa9, 0x02, 0x85, 0x01, 0x74, 0xdc, 0x05, 0x9d, 0x39, 0xc2, 0x1e, 0xeb, 0x02,
+0x26, 0xee, 0x01, 0xe8, 0x03, 0xbb, 0x1f, 0x8e, 0x12, 0x4b, 0xd2, 0x01, 0xe6, 0x01, 0xd6, 0x06,
+0x91, 0x26, 0xfe, 0x14, 0x39, 0x9c, 0x03, 0x80, 0x03, 0xcc, 0x08, 0x89, 0x13, 0xa8, 0x0e, 0x74,
+0xb0, 0x03, 0xac, 0x01, 0x8a, 0x13, 0xbd, 0x0a, 0xda, 0x1a, 0xc4, 0x02, 0x9e, 0x02, 0xb0, 0x03,
+0x8e, 0x12, 0xe3, 0x04, 0x94, 0x11, 0x30, 0xf6, 0x02, 0x9e, 0x02, 0xd6, 0x06, 0xee, 0x02, 0xa8,
+0x0e, 0x85, 0x01, 0xdc, 0x01, 0x30, 0xe4, 0x04, 0xf0, 0x02, 0xcf, 0x07, 0xa1, 0x01, 0x84, 0x02,
+0xa0, 0x02, 0xd7, 0x06, 0xdc, 0x05, 0xcd, 0x1c, 0xb1, 0x02, 0x26, 0xdc, 0x01, 0xab, 0x0d, 0xac,
+0x0d, 0xb7, 0x20, 0xe5, 0x01, 0x68, 0x26, 0xa9, 0x22, 0xc0, 0x0a, 0xd3, 0x44, 0xd3, 0x01, 0x86,
+0x01, 0xa2, 0x01, 0x99, 0x25, 0xe0, 0x19, 0x99, 0x4e, 0x14, 0x6a, 0xae, 0x01, 0xf7, 0x15, 0xe0,
+0x19, 0xf3, 0x3f, 0x72, 0x14, 0x39, 0xfd, 0x14, 0xcc, 0x31, 0x81, 0x52, 0x74, 0xdb, 0x01, 0xc0,
+0x01, 0xc3, 0x09, 0xe2, 0x2d, 0xf5, 0x2a, 0x90, 0x01, 0x99, 0x01, 0x43, 0xc9, 0x08, 0xee, 0x40,
+0xd1, 0x30, 0xf8, 0x01, 0x73, 0x90, 0x01, 0xf3, 0x01, 0xd6, 0x44, 0xe5, 0x18, 0x37, 0xbb, 0x02,
+0x8b, 0x02, 0x7a, 0xc6, 0x32, 0x99, 0x10, 0x72, 0x25, 0xab, 0x01, 0x00, 0xae, 0x36, 0xdf, 0x19,
+0x44, 0xab, 0x01, 0xa3, 0x01, 0xf4, 0x01, 0xa8, 0x37, 0xdf, 0x19, 0x2e, 0x0a, 0xeb, 0x02, 0xe8,
+0x03, 0x9e, 0x24, 0xf7, 0x15, 0xfa, 0x01, 0x42, 0xb1, 0x02, 0xe8, 0x03, 0x88, 0x28, 0xb5, 0x20,
+0xd6, 0x03, 0x25, 0xfd, 0x02, 0xdc, 0x05, 0xce, 0x1c, 0xf5, 0x2a, 0xc8, 0x04, 0xa1, 0x01, 0xf1,
+0x03, 0xe8, 0x03, 0xd0, 0x07, 0xcd, 0x1c, 0xee, 0x01, 0x43, 0xa9, 0x02, 0xfe, 0x14, 0xa5, 0x0e,
+0xd3, 0x1b, 0xc6, 0x02, 0x5f, 0x7b, 0x90, 0x12, 0xc3, 0x1e, 0xc9, 0x08, 0x14, 0x1b, 0x81, 0x02,
+0xc8, 0x1d, 0xf7, 0x3e, 0xe2, 0x04, 0xc1, 0x03, 0x56, 0xa3, 0x01, 0xc2, 0x1e, 0xe3, 0x56, 0x84,
+0x14, 0xbb, 0x02, 0x14, 0x30, 0x8a, 0x13, 0xcf, 0x45, 0x94, 0x11, 0xff, 0x02, 0x7d, 0x1e, 0xae,
+0x0d, 0xbb, 0x5d, 0xfe, 0x14, 0xd3, 0x03, 0x99, 0x03, 0xce, 0x02, 0x79, 0x81, 0x52, 0xf4, 0x01,
+0x9b, 0x03, 0xb3, 0x02, 0x44, 0xdd, 0x05, 0xf5, 0x2a, 0xe7, 0x03, 0xef, 0x01, 0x00, 0xf2, 0x03,
+0x87, 0x13, 0xdf, 0x19, 0xa1, 0x0f, 0xf9, 0x01, 0xed, 0x01, 0xbc, 0x02, 0x95, 0x11, 0x79, 0x9f,
+0x0f, 0x25, 0x86, 0x01, 0xdc, 0x01, 0x95, 0x11, 0xd4, 0x1b, 0x89, 0x13, 0xe5, 0x01, 0xe2, 0x02,
+0x8c, 0x02, 0xd5, 0x06, 0xb0, 0x36, 0xb1, 0x0c, 0xd4, 0x01, 0xc6, 0x02, 0xb6, 0x01, 0x79, 0xd0,
+0x30, 0xf5, 0x01, 0xce, 0x02, 0x8e, 0x01, 0x98, 0x01, 0xe1, 0x04, 0xe2, 0x42, 0x79, 0xfa, 0x01,
+0xf0, 0x01, 0x44, 0xf4, 0x01, 0xde, 0x2e, 0xed, 0x02, 0x26, 0x44, 0x85, 0x01, 0xe8, 0x03, 0x8a,
+0x3c, 0xd5, 0x06, 0xa2, 0x01, 0x13, 0x42, 0x7a, 0xac, 0x22, 0xdb, 0x05, 0x3a, 0x85, 0x01, 0x81,
+0x02, 0x79, 0xb6, 0x20, 0xc9, 0x08, 0x99, 0x01, 0xc5, 0x02, 0x69, 0x00, 0x9a, 0x10, 0x7b, 0x8d,
+0x01, 0xed, 0x01, 0x9d, 0x02, 0xf4, 0x01, 0xd2, 0x07, 0xd8, 0x06, 0xf7, 0x04, 0x8f, 0x01, 0x30,
+0xb8, 0x0b, 0xbf, 0x0a, 0x84, 0x14, 0xc5, 0x02, 0x85, 0x01, 0x39, 0xc6, 0x09, 0xb7, 0x0b, 0x88,
+0x13, 0x7b, 0xd3, 0x01, 0x1b, 0xa0, 0x0f, 0x8f, 0x12, 0xce, 0x1c, 0xdd, 0x01, 0x41, 0x68, 0xd8,
+0x06, 0xcf, 0x07, 0x90, 0x12, 0x71, 0x09, 0x14, 0xd6, 0x06, 0x79, 0xf8, 0x15, 0x4b, 0xab, 0x01,
+0x1b, 0xf3, 0x01, 0xd0, 0x07, 0xa6, 0x0e, 0x55, 0x2f, 0x1c, 0xd5, 0x06, 0xf2, 0x16, 0xcc, 0x08,
+0x43, 0x1c, 0x4c, 0xfd, 0x14, 0xb0, 0x21, 0xee, 0x02, 0x5f, 0x07, 0x4b, 0x9b, 0x10, 0xbe, 0x1f,
+0xe7, 0x03, 0x00, 0x08, 0x7b, 0xcd, 0x1c, 0xca, 0x31, 0xeb, 0x17, 0x8c, 0x02, 0xca, 0x01, 0xc9,
+0x01, 0x95, 0x11, 0x9a, 0x25, 0x9b, 0x10, 0x92, 0x03, 0xac, 0x01, 0x5f, 0xa5, 0x0e, 0xc0, 0x33,
+0xc7, 0x1d, 0x8a, 0x03, 0xa6, 0x03, 0xb5, 0x01, 0xb9, 0x0b, 0xde, 0x2e, 0xf7, 0x15, 0xda, 0x04,
+0xc6, 0x02, 0x97, 0x01, 0xa5, 0x0e, 0xda, 0x1a, 0x9f, 0x0f, 0xb0, 0x03, 0xb6, 0x01, 0xf9, 0x01,
+0xad, 0x0d, 0x9a, 0x10, 0xe5, 0x18, 0x8a, 0x05, 0xc2, 0x03, 0xbf, 0x01, 0x81, 0x14, 0xbd, 0x0a,
+0xb7, 0x20, 0xd0, 0x02, 0x88, 0x03, 0xc7, 0x01, 0x8f, 0x12, 0xc1, 0x1e, 0x99, 0x10, 0xac, 0x01,
+0x9a, 0x01, 0x25, 0x89, 0x13, 0xa1, 0x38, 0x89, 0x13, 0xa4, 0x01, 0xac, 0x01, 0x8b, 0x02, 0xbd,
+0x0a, 0xd5, 0x44, 0xb7, 0x0b, 0x7c, 0x43, 0x4c, 0xed, 0x02, 0xb3, 0x35, 0xdd, 0x05, 0x55, 0x67,
+0x42, 0x00, 0x9f, 0x4d, 0xd5, 0x06, 0x0a, 0xc9, 0x01, 0x74, 0xee, 0x02, 0xa7, 0x37, 0xf4, 0x01,
+0xb3, 0x02, 0xab, 0x01, 0x42, 0xca, 0x08, 0xe1, 0x42, 0xdc, 0x05, 0xcb, 0x03, 0x30, 0x8c, 0x02,
+0xd0, 0x07, 0xfd, 0x3d, 0xba, 0x0b, 0xd3, 0x03, 0xe1, 0x02, 0xe0, 0x03, 0x79, 0x93, 0x26, 0xed,
+0x02, 0x85, 0x01, 0x2f, 0xba, 0x05, 0xa9, 0x22, 0xa5, 0x0e, 0xf5, 0x2a, 0xc6, 0x02, 0xae, 0x06,
+0x82, 0x08, 0xe6, 0x18, 0x79, 0x9a, 0x4e, 0xbf, 0x04, 0xfb, 0x21, 0xc3, 0x13, 0xb8, 0x72, 0xb3,
+0x0c, 0xae, 0x36, 0xdd, 0x16, 0x96, 0x07, 0xe4, 0x07, 0x84, 0x14, 0xb1, 0x0c, 0xed, 0x92, 0x01,
+0xd5, 0x06, 0xc2, 0x0e, 0xb8, 0x06, 0x8f, 0x3b, 0xed, 0x02, 0xef, 0x92, 0x01, 0xb6, 0x0c, 0xa6,
+0x03, 0x3a, 0xf5, 0xba, 0x01, 0xc9, 0x1d, 0xa6, 0x0e, 0xd0, 0x20, 0xc9, 0x09, 0xab, 0x04, 0xa3,
+0x61, 0x8d, 0x12, 0x84, 0xa0, 0x02, 0xdb, 0x01, 0xb6, 0x0f, 0x9e, 0x0d, 0xab, 0x22, 0xd8, 0x58,
+0x90, 0x64, 0xaf, 0x03, 0x8a, 0x13, 0xde, 0x06, 0xbc, 0x9b, 0x01, 0xa8, 0x9e, 0x01, 0xc8, 0x5b,
+0xea, 0x03, 0xb1, 0x05, 0xed, 0x04, 0xae, 0x9d, 0x01, 0xaa, 0x60, 0x9e, 0x8b, 0x01, 0xae, 0x06,
+0xcf, 0x02, 0xe3, 0x07, 0x84, 0xa4, 0x01, 0xaa, 0x22, 0x86, 0xa4, 0x01, 0xff, 0x02, 0x09, 0x99,
+0x06, 0x9a, 0x4e, 0xd5, 0x06, 0xd2, 0x30, 0x99, 0x06, 0xa0, 0x02, 0xe5, 0x01, 0xda, 0x1a, 0xd7,
+0x2f, 0xbf, 0x33, 0xb3, 0x07, 0x1c, 0x89, 0x03, 0xd3, 0x1b, 0xe9, 0x55, 0xcd, 0x83, 0x01, 0xaf,
+0x03, 0xaf, 0x05, 0xed, 0x04, 0x9d, 0x24, 0x93, 0x4f, 0xfd, 0x7b, 0x39, 0x8f, 0x04, 0x00, 0xdf,
+0x57, 0x91, 0x64, 0xbd, 0xaf, 0x01, 0xd6, 0x03, 0xa3, 0x03, 0x26, 0xff, 0x28, 0xb9, 0x34, 0xbb,
+0x5d, 0xaa, 0x02, 0x7c, 0x44, 0xab, 0x22, 0x93, 0x26, 0xe9, 0x55, 0xa4, 0x06, 0x81, 0x02, 0xe8,
+0x03, 0xe7, 0x2c, 0xd2, 0x07, 0xd6, 0x06, 0x92, 0x03, 0x80, 0x08, 0xee, 0x04, 0xe0, 0x19, 0x86,
+0x28, 0xa0, 0x24, 0xd6, 0x03, 0x13, 0x26, 0xca, 0x31, 0xea, 0x2c, 0xea, 0x55, 0xb4, 0x04, 0xfa,
+0x01, 0x4b, 0xd6, 0x1b, 0x96, 0x11, 0x9a, 0x4e, 0xde, 0x03, 0x09, 0x8c, 0x02, 0x82, 0x14, 0xe0,
+0x19, 0xa2, 0x76, 0xd1, 0x01, 0xee, 0x04, 0x00, 0xae, 0x36, 0xcc, 0x31, 0xc6, 0x32, 0xd1, 0x01,
+0x74, 0xb1, 0x05, 0xac, 0x22, 0xa0, 0x0f, 0xee, 0x02, 0x69, 0xa5, 0x03, 0x85, 0x01, 0xed, 0x02,
+0x99, 0x10, 0xcd, 0x1c, 0xb3, 0x04, 0xb1, 0x02, 0xa7, 0x02, 0xe5, 0x18, 0xc9, 0x1d, 0xff, 0x3d,
+0xbf, 0x01, 0xc9, 0x01, 0xa7, 0x02, 0x81, 0x29, 0xb9, 0x34, 0xf9, 0x67, 0xd3, 0x01, 0xe3, 0x04,
+0x99, 0x04, 0x8f, 0x3b, 0xbb, 0x48, 0xff, 0x66, 0xb1, 0x02, 0xa1, 0x04, 0x41, 0xd7, 0x2f, 0x9d,
+0x39, 0xf1, 0x3f, 0xcb, 0x03, 0xd7, 0x02, 0xc0, 0x01, 0xa1, 0x38, 0x8f, 0x3b, 0xed, 0x40, 0xcd,
+0x05, 0x00, 0x82, 0x02, 0xcd, 0x1c, 0xd9, 0x1a, 0xe5, 0x18, 0x37, 0xc5, 0x02, 0xf2, 0x03, 0xef,
+0x2b, 0xfd, 0x14, 0xdb, 0x05, 0x73, 0xef, 0x01, 0xd2, 0x04, 0xf7, 0x15, 0xa2, 0x0f, 0x8c, 0x27,
+0xd1, 0x01, 0xb1, 0x02, 0x94, 0x05, 0xab, 0x0d, 0xce, 0x1c, 0xde, 0x2e, 0xcb, 0x03, 0x56, 0xb0,
+0x03, 0xcb, 0x08, 0xa8, 0x37, 0xb8, 0x49, 0x9d, 0x05, 0x8c, 0x02, 0x9c, 0x03, 0xc6, 0x09, 0xa6,
+0x4c, 0xf4, 0x3f, 0xab, 0x04, 0xe6, 0x01, 0x94, 0x02, 0xd6, 0x06, 0xca, 0x46, 0xb0, 0x21, 0x2f,
+0xf0, 0x01, 0x4e, 0x8a, 0x13, 0x8c, 0x65, 0x90, 0x12, 0xe6, 0x01, 0x82, 0x02, 0x43, 0xee, 0x02,
+0x94, 0x4f, 0xee, 0x02, 0xfe, 0x02, 0xa8, 0x02, 0x26, 0xdc, 0x05, 0xaa, 0x60, 0xad, 0x0d, 0xf0,
+0x04, 0x80, 0x03, 0x8d, 0x04, 0xdb, 0x05, 0x8e, 0x50, 0xa9, 0x22, 0xe4, 0x04, 0x88, 0x03, 0x8b,
+0x02, 0xd9, 0x1a, 0xd4, 0x1b, 0x83, 0x14, 0xf2, 0x03, 0x74, 0x13, 0xe9, 0x2c, 0xa4, 0x23, 0xdf,
+0x19, 0x30, 0x88, 0x06, 0xcd, 0x02, 0xb3, 0x0c, 0xa4, 0x23, 0x9b, 0x39, 0xe0, 0x03, 0xa4, 0x03,
+0x1d, 0xb1, 0x0c, 0xde, 0x05, 0x9f, 0x24, 0x8e, 0x04, 0x00, 0x7b, 0xdb, 0x05, 0x00, 0xe9, 0x17,
+0xe2, 0x02, 0xa0, 0x02, 0x5f, 0xc8, 0x1d, 0xa7, 0x0e, 0xf1, 0x16, 0xe6, 0x01, 0x69, 0xed, 0x01,
+0xf6, 0x2a, 0x97, 0x25, 0xd1, 0x07, 0x90, 0x01, 0x25, 0x8f, 0x01, 0xda, 0x1a, 0xfb, 0x29, 0xe4,
+0x04, 0x56, 0xbf, 0x01, 0x73, 0xbc, 0x1f, 0xdb, 0x43, 0xf4, 0x01, 0xc9, 0x01, 0x3a, 0x44, 0xb0,
+0x21, 0xfd, 0x3d, 0xcb, 0x08, 0xbd, 0x01, 0xbf, 0x01, 0x00, 0xa2, 0x0f, 0xb7, 0x49, 0xdb, 0x05,
+0x7d, 0xa7, 0x02, 0x09, 0xe2, 0x04, 0xa7, 0x37, 0xee, 0x02, 0x7b, 0xab, 0x01, 0xa6, 0x03, 0xd6,
+0x06, 0xa1, 0x38, 0xd6, 0x06, 0xa5, 0x03, 0x95, 0x02, 0x1c, 0xe6, 0x18, 0x87, 0x28, 0x9c, 0x10,
+0xeb, 0x02, 0x2f, 0x96, 0x02, 0x84, 0x14, 0xf1, 0x16, 0x96, 0x11, 0xa1, 0x01, 0xa3, 0x01, 0xac,
+0x01, 0x9c, 0x10, 0xcd, 0x1c, 0xb0, 0x21, 0xa5, 0x03, 0xc3, 0x02, 0xbc, 0x02, 0xca, 0x08, 0x99,
+0x10, 0xbc, 0x1f, 0xd9, 0x04, 0x13, 0xda, 0x02, 0xb8, 0x0b, 0x79, 0x8a, 0x13, 0xb3, 0x02, 0x71,
+0xac, 0x01, 0xb4, 0x0c, 0xb2, 0x0c, 0xa8, 0x0e, 0xa7, 0x02, 0x7c, 0x8c, 0x02, 0x84, 0x14, 0x8a,
+0x13, 0x8e, 0x12, 0x56, 0x9f, 0x02, 0x42, 0xe3, 0x04, 0xb2, 0x0c, 0x96, 0x11, 0x39, 0xfa, 0x01,
+0xc6, 0x02, 0xc6, 0x09, 0x88, 0x28, 0xa6, 0x0e, 0xdc, 0x01, 0x39, 0x55, 0x7a, 0xe6, 0x18, 0xb4,
+0x0c, 0x1b, 0x56, 0x0a, 0xe8, 0x03, 0x80, 0x29, 0xbe, 0x0a, 0xac, 0x01, 0x1b, 0x25, 0x7a, 0xe6,
+0x18, 0xe2, 0x04, 0x07, 0x30, 0x8b, 0x02, 0x00, 0x90, 0x12, 0x00, 0xdc, 0x01, 0x26, 0x7d, 0x00,
+0x96, 0x11, 0xbd, 0x0a, 0x68, 0x0a, 0x1b, 0xb7, 0x0b, 0xd0, 0x07, 0xc3, 0x09, 0x26, 0x08, 0xab,
+0x01, 0xcb, 0x08, 0x7a, 0xe5, 0x18, 0x74, 0x0a, 0x55, 0xb7, 0x0b, 0xdb, 0x05, 0x8f, 0x12, 0x26,
+0x39, 0x99, 0x01, 0xcb, 0x08, 0xa7, 0x0e, 0xab, 0x0d, 0xac, 0x01, 0x1b, 0x71, 0xd5, 0x06, 0x9f,
+0x0f, 0xb9, 0x0b, 0x86, 0x01, 0x30, 0x1d, 0x79, 0xc5, 0x09, 0xdb, 0x05, 0x6a, 0x1b, 0x1e, 0xd6,
+0x06, 0x9f, 0x0f, 0xe7, 0x03, 0xca, 0x01, 0x00, 0x73, 0xee, 0x02, 0xad, 0x0d, 0xe1, 0x04, 0x4c,
+0xd2, 0x01, 0x60, 0xc0, 0x0a, 0xb1, 0x0c, 0xdd, 0x05, 0x25, 0x2f, 0x26, 0xca, 0x08, 0x83, 0x14,
+0x00, 0x13, 0x4b, 0x41, 0xd6, 0x06, 0xf7, 0x15, 0xcc, 0x08, 0x4b, 0x43, 0x38, 0xe4, 0x04, 0xbb,
+0x1f, 0xdc, 0x05, 0x99, 0x01, 0x5f, 0x2f, 0xe2, 0x04, 0xd3, 0x1b, 0xdc, 0x05, 0x7b, 0x14, 0xfa,
+0x01, 0x7a, 0xaf, 0x21, 0xe2, 0x04, 0x8b, 0x02, 0xb6, 0x01, 0xa2, 0x01, 0xe2, 0x04, 0xc9, 0x1d,
+0xee, 0x02, 0x09, 0x2f, 0xf0, 0x01, 0x79, 0x99, 0x10, 0xf0, 0x02, 0x5f, 0x4b, 0xdc, 0x01, 0x00,
+0xad, 0x0d, 0xe3, 0x04, 0x55, 0xb6, 0x01, 0x39, 0xe2, 0x04, 0xf3, 0x01, 0xd5, 0x06, 0x71, 0x2e,
+0x8e, 0x02, 0xf4, 0x01, 0x7a, 0xcf, 0x07, 0x38, 0x07, 0x86, 0x01, 0x79, 0xe2, 0x04, 0xd1, 0x07,
+0x1b, 0x1d, 0x00, 0x7a, 0x9c, 0x10, 0xd5, 0x06, 0x13, 0x60, 0x68, 0xde, 0x05, 0xae, 0x0d, 0xe1,
+0x04, 0x55, 0x39, 0x44, 0x00, 0xf0, 0x16, 0xc9, 0x08, 0xab, 0x01, 0x7e, 0xa2, 0x01, 0xee, 0x02,
+0x9c, 0x10, 0xbf, 0x0a, 0x09, 0x90, 0x01, 0x25, 0xdc, 0x05, 0xf8, 0x15, 0x99, 0x10, 0x28, 0x42,
+0x56, 0xe8, 0x03, 0xc8, 0x1d, 0x9b, 0x10, 0x4c, 0x14, 0x39, 0xe2, 0x04, 0xce, 0x1c, 0xab, 0x0d,
+0x98, 0x01, 0x2f, 0x37, 0xee, 0x02, 0x94, 0x26, 0xbf, 0x0a, 0x6a, 0x2f, 0x39, 0xe1, 0x04, 0xda,
+0x1a, 0xc9, 0x08, 0x30, 0x4d, 0x5f, 0xed, 0x02, 0xb6, 0x20, 0xcb, 0x08, 0x1b, 0x41, 0x85, 0x01,
+0xf3, 0x01, 0xe4, 0x2d, 0x99, 0x10, 0x43, 0x73, 0xf7, 0x01, 0x7a, 0xb6, 0x20, 0xe1, 0x04, 0x1b,
+0x4b, 0x8f, 0x01, 0xc4, 0x09, 0x8e, 0x27, 0xf3, 0x01, 0x68, 0xab, 0x01, 0xab, 0x01, 0xd2, 0x07,
+0xda, 0x1a, 0xf5, 0x01, 0x90, 0x01, 0xac, 0x01, 0x08, 0xa0, 0x0f, 0xf0, 0x16, 0xea, 0x03, 0x8f,
+0x01, 0xf0, 0x01, 0x85, 0x01, 0xc0, 0x0a, 0xd2, 0x07, 0x00, 0xfc, 0x03, 0xeb, 0x05, 0x55, 0xed,
+0x02, 0xbf, 0x0a, 0x95, 0x11, 0x1e, 0xa4, 0x01, 0x9d, 0x05, 0xd7, 0x06, 0xe4, 0x04, 0xf4, 0x01,
+0x42, 0x09, 0x3a, 0xe1, 0x04, 0xb3, 0x0c, 0xf4, 0x01, 0x1b, 0x39, 0x09, 0xf4, 0x01, 0xf1, 0x16,
+0xee, 0x02, 0x42, 0x81, 0x02, 0x8b, 0x02, 0xc9, 0x08, 0x95, 0x11, 0xf4, 0x01, 0xb5, 0x01, 0x00,
+0x12, 0xd5, 0x06, 0xef, 0x16, 0xde, 0x05, 0xbd, 0x01, 0x3a, 0x4b, 0xb2, 0x0c, 0xf7, 0x15, 0xca,
+0x08, 0x8f, 0x01, 0xef, 0x01, 0x41, 0xf4, 0x01, 0xdf, 0x19, 0xe2, 0x04, 0x0a, 0x4c, 0xa2, 0x01,
+0x00, 0x8f, 0x12, 0xbe, 0x0a, 0x69, 0x3a, 0x4b, 0xc0, 0x0a, 0x9b, 0x10, 0x90, 0x12, 0x43, 0x1b,
+0x38, 0x9a, 0x10, 0xf3, 0x01, 0xec, 0x17, 0x26, 0x5f, 0xc0, 0x01, 0x90, 0x12, 0xed, 0x02, 0xfe,
+0x14, 0x00, 0x73, 0x2f, 0xb8, 0x0b, 0xf4, 0x01, 0xfc, 0x29, 0x11, 0x30, 0x44, 0xb4, 0x0c, 0xf3,
+0x01, 0xd4, 0x1b, 0xbf, 0x01, 0x11, 0x60, 0x94, 0x11, 0x9c, 0x10, 0x82, 0x14, 0x5f, 0x39, 0xd3,
+0x01, 0xc6, 0x09, 0xac, 0x0d, 0xae, 0x0d, 0x25, 0x39, 0xbd, 0x01, 0xe1, 0x04, 0xc6, 0x09, 0xd6,
+0x06, 0x4c, 0x25, 0x09, 0xd1, 0x07, 0xca, 0x08, 0xcf, 0x07, 0x58, 0x00, 0xdb, 0x01,
+};
@@ -6,6 +6,10 @@
  * it was generated by printing out the clock ticks as the
  * motions were performed.
  * this can be used as a simulated lighthouse
+ *
+ * source of simulatedLighthouseTable.h (session_tools/compress_tables),
+ * which is what the firmware compiles in. not included by the firmware
+ * itself
  */
 
 const double baseStationPitchSim = -11.993;
@@ -0,0 +1,1192 @@
+#pragma once
+
+/**
+ * simulated clock ticks of simulatedLighthouseData.h, compressed
+ * generated by session_tools/compress_tables, don't edit.
+ * decode with SimulatedTableDecoder (SimulatedTable.h)
+ */
+
+#include <stdint.h>
+
+/** base station pitch/roll in degrees during the recording */
+const double lighthouseTablePitch = -11.993;
+const double lighthouseTableRoll = 2.255;
+
+/** clock ticks, order is sensor0 hori, sensor0 verti, ... sensor3 verti */
+const int lighthouseTableRows = 1770;
+const int lighthouseTableColumns = 8;
+const int lighthouseTableLength = 18741;
+const uint8_t lighthouseTableData[lighthouseTableLength] = {
+0x8c, 0xfc, 0x18, 0xc4, 0xcb, 0x16, 0xd8, 0xd6, 0x17, 0xec, 0xcd, 0x16, 0xfc, 0xd5, 0x17, 0xe6,
+0xea, 0x15, 0xb4, 0xfc, 0x18, 0x8a, 0xe8, 0x15, 0x82, 0x01, 0x00, 0x8e, 0x01, 0x00, 0x74, 0x00,
+0x6a, 0x00, 0x00, 0x27, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x0d, 0x8e, 0x01, 0x00, 0x74, 0x00, 0x76,
+0x00, 0x88, 0x01, 0x00, 0x00, 0x19, 0x00, 0x04, 0x00, 0x19, 0x00, 0x1d, 0x6a, 0x00, 0x76, 0x00,
+0x6c, 0x00, 0x58, 0x00, 0x00, 0x31, 0x00, 0x15, 0x00, 0x09, 0x00, 0x21, 0x88, 0x01, 0x00, 0x7c,
+0x00, 0x64, 0x00, 0x78, 0x00, 0x00, 0x13, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x31, 0x82, 0x01, 0x00,
+0x7a, 0x00, 0x78, 0x00, 0x64, 0x00, 0x00, 0x2d, 0x00, 0x07, 0x00, 0x07, 0x00, 0x39, 0x86, 0x01,
+0x00, 0x82, 0x01, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x00, 0x47, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x4d,
+0x74, 0x00, 0x78, 0x00, 0x6e, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x26,
+0x88, 0x01, 0x00, 0x7a, 0x00, 0x74, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x03,
+0x00, 0x19, 0x58, 0x00, 0x5c, 0x00, 0x56, 0x00, 0x54, 0x00, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x06,
+0x00, 0x0f, 0x80, 0x01, 0x00, 0x72, 0x00, 0x70, 0x00, 0x58, 0x00, 0x00, 0x0f, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x0b, 0x7a, 0x00, 0x7a, 0x00, 0x60, 0x00, 0x76, 0x00, 0x00, 0x02, 0x00, 0x24, 0x00,
+0x06, 0x00, 0x0b, 0x68, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00,
+0x18, 0x00, 0x0e, 0x72, 0x00, 0x66, 0x00, 0x60, 0x00, 0x46, 0x00, 0x00, 0x12, 0x00, 0x0c, 0x00,
+0x24, 0x00, 0x05, 0x48, 0x00, 0x52, 0x00, 0x52, 0x00, 0x48, 0x00, 0x00, 0x14, 0x00, 0x16, 0x00,
+0x22, 0x00, 0x34, 0x4a, 0x00, 0x4c, 0x00, 0x44, 0x00, 0x4e, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00,
+0x01, 0x00, 0x0c, 0x2e, 0x00, 0x4c, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x00, 0x36, 0x00, 0x2c, 0x00,
+0x3a, 0x00, 0x20, 0x4a, 0x00, 0x42, 0x00, 0x46, 0x00, 0x36, 0x00, 0x00, 0x16, 0x00, 0x0c, 0x00,
+0x1a, 0x00, 0x26, 0x2e, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x00, 0x12, 0x00, 0x30, 0x00,
+0x1c, 0x00, 0x0e, 0x50, 0x00, 0x66, 0x00, 0x56, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x2c, 0x26, 0x2a, 0x3c,
+0x40, 0x4a, 0x2c, 0x3a, 0x00, 0x42, 0x00, 0x38, 0x00, 0x28, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00,
+0x14, 0x00, 0x15, 0x36, 0x00, 0x46, 0x00, 0x32, 0x00, 0x30, 0x00, 0x00, 0x1a, 0x00, 0x22, 0x00,
+0x22, 0x00, 0x30, 0x36, 0x00, 0x38, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00,
+0x04, 0x00, 0x09, 0x16, 0x00, 0x14, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00,
+0x08, 0x00, 0x10, 0x20, 0x00, 0x26, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x00, 0x0f, 0x00, 0x1d, 0x00,
+0x13, 0x00, 0x15, 0x03, 0x00, 0x09, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+0x1f, 0x00, 0x1a, 0x13, 0x00, 0x07, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x1b, 0x00, 0x11, 0x00,
+0x0b, 0x00, 0x2f, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+0x05, 0x00, 0x07, 0x03, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x19, 0x00, 0x1f, 0x00,
+0x1f, 0x00, 0x15, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00, 0x12, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x00,
+0x27, 0x00, 0x19, 0x23, 0x00, 0x19, 0x00, 0x13, 0x00, 0x19, 0x00, 0x00, 0x13, 0x00, 0x19, 0x00,
+0x17, 0x00, 0x25, 0x0f, 0x00, 0x21, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x17, 0x00, 0x21, 0x00,
+0x2b, 0x00, 0x09, 0x1d, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x21, 0x00, 0x29, 0x00,
+0x1d, 0x00, 0x11, 0x17, 0x00, 0x21, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x00, 0x19, 0x00, 0x21, 0x00,
+0x2b, 0x00, 0x19, 0x11, 0x00, 0x17, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x0d, 0x00, 0x0f, 0x00,
+0x0f, 0x00, 0x21, 0x00, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x00, 0x17, 0x00, 0x11, 0x00,
+0x11, 0x00, 0x02, 0x0a, 0x00, 0x04, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+0x0a, 0x00, 0x01, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x16, 0x00,
+0x14, 0x00, 0x1a, 0x16, 0x00, 0x20, 0x00, 0x18, 0x00, 0x30, 0x00, 0x00, 0x06, 0x00, 0x14, 0x00,
+0x0c, 0x00, 0x0f, 0x20, 0x00, 0x2a, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x02, 0x00, 0x16, 0x00,
+0x2a, 0x00, 0x04, 0x26, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x1e, 0x00, 0x00, 0x1a, 0x00, 0x1a, 0x00,
+0x28, 0x00, 0x28, 0x0a, 0x00, 0x20, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00,
+0x14, 0x00, 0x07, 0x12, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x24, 0x00, 0x00, 0x0e, 0x00, 0x0a, 0x00,
+0x0a, 0x00, 0x10, 0x0b, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x16, 0x00, 0x0a, 0x00,
+0x14, 0x00, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+0x1c, 0x00, 0x08, 0x0b, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0x17, 0x00,
+0x21, 0x00, 0x1f, 0x0f, 0x00, 0x15, 0x00, 0x13, 0x00, 0x11, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00,
+0x32, 0x00, 0x30, 0x1d, 0x00, 0x11, 0x00, 0x19, 0x00, 0x17, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00,
+0x11, 0x00, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+0x00, 0x00, 0x16, 0x17, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+0x0c, 0x00, 0x19, 0x16, 0x00, 0x16, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+0x14, 0x00, 0x0f, 0x1e, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x35, 0x00, 0x17, 0x00,
+0x2f, 0x00, 0x35, 0x09, 0x00, 0x06, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x00,
+0x08, 0x00, 0x04, 0x13, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x05, 0x00,
+0x13, 0x00, 0x01, 0x39, 0x00, 0x2f, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00,
+0x00, 0x00, 0x01, 0x1d, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x17, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+0x18, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00,
+0x0a, 0x00, 0x11, 0x0f, 0x00, 0x0b, 0x00, 0x39, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x28, 0x00,
+0x2e, 0x00, 0x09, 0x55, 0x00, 0x5b, 0x00, 0x71, 0x00, 0x83, 0x01, 0x00, 0x00, 0x09, 0x00, 0x1a,
+0x00, 0x0a, 0x00, 0x0f, 0x9d, 0x01, 0x00, 0xb1, 0x01, 0x00, 0xb7, 0x01, 0x00, 0xb5, 0x01, 0x00,
+0x00, 0x11, 0x00, 0x09, 0x00, 0x02, 0x00, 0x11, 0x85, 0x02, 0x00, 0x87, 0x02, 0x00, 0xfd, 0x01,
+0x00, 0xed, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x09, 0x00, 0x04, 0xa3, 0x02, 0x00, 0xb1,
+0x02, 0x00, 0xad, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x2a, 0x00, 0x06,
+0xd5, 0x02, 0x00, 0xb7, 0x02, 0x00, 0xd5, 0x02, 0x00, 0xe1, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x34,
+0x00, 0x2e, 0x00, 0x1f, 0xe7, 0x02, 0x00, 0xe9, 0x02, 0x00, 0xb5, 0x03, 0x00, 0x9b, 0x03, 0x00,
+0x00, 0x21, 0x00, 0x4e, 0x00, 0x64, 0x00, 0x2f, 0xad, 0x04, 0x00, 0x9b, 0x04, 0x00, 0xdd, 0x04,
+0x00, 0xdf, 0x04, 0x00, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x1c, 0x00, 0x31, 0x8d, 0x06, 0x00, 0xf5,
+0x05, 0x00, 0x8f, 0x06, 0x00, 0x87, 0x06, 0x00, 0x00, 0x10, 0x00, 0x13, 0x00, 0x03, 0x00, 0x11,
+0xd1, 0x08, 0x00, 0xcf, 0x08, 0x00, 0xa5, 0x08, 0x00, 0xbb, 0x08, 0x00, 0x00, 0x14, 0x00, 0x45,
+0x00, 0x57, 0x00, 0x0f, 0x93, 0x0a, 0x00, 0xa3, 0x0a, 0x00, 0xc7, 0x09, 0x00, 0xf1, 0x09, 0x00,
+0x00, 0x12, 0x00, 0x6f, 0x00, 0x6b, 0x00, 0x04, 0x8f, 0x0b, 0x00, 0xf7, 0x0a, 0x00, 0xc3, 0x0a,
+0x00, 0xb1, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x24, 0xb5, 0x0a, 0x00, 0x97,
+0x0a, 0x00, 0x93, 0x0a, 0x00, 0xc7, 0x0a, 0x00, 0x00, 0x23, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x49,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xab, 0x15, 0x05, 0xd3, 0x14, 0xac, 0x01, 0xb1, 0x16, 0xb4, 0x01, 0x85, 0x17, 0x23, 0x00, 0x4a,
+0x00, 0x9c, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x8a, 0x01, 0xad, 0x0d, 0x00, 0xe9, 0x0c, 0x00, 0x93,
+0x0d, 0x00, 0xd1, 0x10, 0x00, 0x00, 0x7a, 0x00, 0x7e, 0x00, 0x78, 0x00, 0x5e, 0x87, 0x0f, 0x00,
+0xcd, 0x0e, 0x00, 0xc1, 0x0e, 0x00, 0x8f, 0x0c, 0x00, 0x00, 0x9e, 0x01, 0x00, 0x66, 0x00, 0x58,
+0x00, 0x96, 0x01, 0x97, 0x10, 0x00, 0xe1, 0x0f, 0x00, 0xbd, 0x0f, 0x00, 0xd3, 0x0f, 0x00, 0x00,
+0xb0, 0x01, 0x00, 0x6e, 0x00, 0x76, 0x00, 0x8e, 0x01, 0x9f, 0x10, 0x00, 0xb9, 0x0f, 0x00, 0xbd,
+0x0f, 0x00, 0xc5, 0x10, 0x00, 0x00, 0x7a, 0x00, 0xf0, 0x01, 0x00, 0x80, 0x02, 0x00, 0x8e, 0x01,
+0x83, 0x10, 0x00, 0xf5, 0x0e, 0x00, 0xd7, 0x0f, 0x00, 0xcf, 0x10, 0x00, 0x00, 0x70, 0x00, 0xda,
+0x01, 0x00, 0xfa, 0x01, 0x00, 0x5a, 0xad, 0x11, 0x00, 0xe1, 0x0f, 0x00, 0xe9, 0x0f, 0x00, 0xc9,
+0x11, 0x00, 0x00, 0x88, 0x01, 0x00, 0xdc, 0x01, 0x00, 0xec, 0x01, 0x00, 0x8e, 0x01, 0xb5, 0x12,
+0x00, 0xfd, 0x10, 0x00, 0x87, 0x11, 0x00, 0xd5, 0x12, 0x00, 0x00, 0xba, 0x01, 0x00, 0xa4, 0x01,
+0x00, 0xb4, 0x01, 0x00, 0xc0, 0x01, 0xb9, 0x13, 0x00, 0xcb, 0x11, 0x00, 0xaf, 0x11, 0x00, 0x93,
+0x13, 0x00, 0x00, 0xe0, 0x01, 0x00, 0xac, 0x01, 0x00, 0xd0, 0x01, 0x00, 0xda, 0x01, 0x8b, 0x14,
+0x00, 0xad, 0x12, 0x00, 0xf1, 0x11, 0x00, 0xfb, 0x13, 0x00, 0x00, 0xfe, 0x01, 0x00, 0xa0, 0x01,
+0x00, 0xb2, 0x01, 0x00, 0xf2, 0x01, 0xb5, 0x14, 0x00, 0xb7, 0x12, 0x00, 0x95, 0x12, 0x00, 0xf3,
+0x13, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x70, 0x00, 0x90, 0x01, 0x00, 0xd0, 0x01, 0xb9, 0x14, 0x00,
+0xf9, 0x11, 0x00, 0xe7, 0x11, 0x00, 0x83, 0x14, 0x00, 0x00, 0x7c, 0x00, 0x78, 0x00, 0x7c, 0x00,
+0x90, 0x01, 0xa1, 0x14, 0x00, 0xf1, 0x11, 0x00, 0xd1, 0x11, 0x00, 0x85, 0x14, 0x00, 0x00, 0x7a,
+0x00, 0x40, 0x00, 0x6a, 0x00, 0x84, 0x01, 0xb1, 0x14, 0x00, 0xe1, 0x11, 0x00, 0xb5, 0x11, 0x00,
+0xf7, 0x13, 0x00, 0x00, 0x94, 0x01, 0x00, 0x4e, 0x00, 0x96, 0x01, 0x00, 0xba, 0x01, 0xa3, 0x14,
+0x00, 0xd5, 0x11, 0x00, 0xf5, 0x10, 0x00, 0xc5, 0x13, 0x00, 0x00, 0x78, 0x00, 0x24, 0x00, 0x5e,
+0x00, 0x94, 0x01, 0x8b, 0x14, 0x00, 0xf5, 0x10, 0x00, 0x93, 0x10, 0x00, 0xbd, 0x13, 0x00, 0x00,
+0x8a, 0x01, 0x00, 0x40, 0x00, 0x66, 0x00, 0x9c, 0x01, 0xd1, 0x13, 0x00, 0xc7, 0x10, 0x00, 0x83,
+0x10, 0x00, 0x8b, 0x13, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x88, 0x01, 0xcd, 0x12,
+0x00, 0xf5, 0x0f, 0x00, 0xbb, 0x0f, 0x00, 0xe5, 0x11, 0x00, 0x00, 0x78, 0x00, 0x1f, 0x00, 0x0e,
+0x00, 0x8e, 0x01, 0xbd, 0x11, 0x00, 0xf5, 0x0e, 0x00, 0xb1, 0x0e, 0x00, 0xfb, 0x10, 0x00, 0x00,
+0x66, 0x00, 0x13, 0x00, 0x16, 0x00, 0x70, 0x93, 0x10, 0x00, 0xfb, 0x0d, 0x00, 0xab, 0x0d, 0x00,
+0xd9, 0x0f, 0x00, 0x00, 0x68, 0x00, 0x02, 0x00, 0x28, 0x00, 0x84, 0x01, 0xad, 0x0f, 0x00, 0xe5,
+0x0c, 0x00, 0xad, 0x0c, 0x00, 0x85, 0x0f, 0x00, 0x00, 0x3c, 0x00, 0x05, 0x00, 0x30, 0x00, 0x50,
+0xbd, 0x0e, 0x00, 0xf5, 0x0b, 0x00, 0xcd, 0x0b, 0x00, 0xfb, 0x0d, 0x00, 0x00, 0x48, 0x00, 0x45,
+0x00, 0x15, 0x00, 0x82, 0x01, 0xe5, 0x0d, 0x00, 0xbd, 0x0b, 0x00, 0xd9, 0x0a, 0x00, 0xfb, 0x0c,
+0x00, 0x00, 0x34, 0x00, 0x2d, 0x00, 0x15, 0x00, 0x5e, 0xd5, 0x0c, 0x00, 0xb3, 0x0a, 0x00, 0xef,
+0x09, 0x00, 0x89, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x39, 0x00, 0x25, 0x00, 0x32, 0xc9, 0x0a, 0x00,
+0xe1, 0x08, 0x00, 0xab, 0x08, 0x00, 0x9f, 0x0a, 0x00, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x0d, 0x00,
+0x12, 0xbf, 0x09, 0x00, 0xdd, 0x07, 0x00, 0xad, 0x07, 0x00, 0x87, 0x09, 0x00, 0x00, 0x09, 0x00,
+0x3d, 0x00, 0x01, 0x00, 0x24, 0x8b, 0x08, 0x00, 0xcb, 0x06, 0x00, 0xad, 0x06, 0x00, 0xcd, 0x07,
+0x00, 0x00, 0x03, 0x00, 0x29, 0x00, 0x21, 0x00, 0x10, 0xbd, 0x06, 0x00, 0xb5, 0x05, 0x00, 0xa3,
+0x05, 0x00, 0xb7, 0x06, 0x00, 0x00, 0x11, 0x00, 0x31, 0x00, 0x17, 0x00, 0x05, 0xd1, 0x05, 0x00,
+0xcd, 0x04, 0x00, 0xd3, 0x04, 0x00, 0xcb, 0x05, 0x00, 0x00, 0x10, 0x00, 0x17, 0x00, 0x03, 0x00,
+0x1a, 0xa9, 0x04, 0x00, 0xad, 0x03, 0x00, 0x97, 0x03, 0x00, 0xa1, 0x04, 0x00, 0x00, 0x11, 0x00,
+0x1d, 0x00, 0x07, 0x00, 0x03, 0xbd, 0x03, 0x00, 0xcd, 0x02, 0x00, 0xbd, 0x02, 0x00, 0xa5, 0x03,
+0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0a, 0xd7, 0x02, 0x00, 0xf5, 0x01, 0x00, 0xd5,
+0x01, 0x00, 0xa7, 0x02, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00, 0x16, 0x00, 0x22, 0xb3, 0x01, 0x00,
+0x89, 0x01, 0x00, 0x71, 0x00, 0xc9, 0x01, 0x00, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x26,
+0x49, 0x00, 0x27, 0x00, 0x1b, 0x00, 0x35, 0x00, 0x00, 0x08, 0x00, 0x09, 0x00, 0x02, 0x00, 0x0a,
+0x48, 0x00, 0x4e, 0x00, 0x3e, 0x00, 0x28, 0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x09, 0x00, 0x0e,
+0xb6, 0x01, 0x00, 0x96, 0x01, 0x00, 0x9c, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x07, 0x00, 0x0d,
+0x00, 0x27, 0x00, 0x23, 0xc8, 0x01, 0x00, 0xd0, 0x01, 0x00, 0xce, 0x01, 0x00, 0xf8, 0x01, 0x00,
+0x00, 0x1b, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x1d, 0x8a, 0x03, 0x00, 0xf2, 0x02, 0x00, 0xea, 0x02,
+0x00, 0x80, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x2d, 0xc4, 0x03, 0x00, 0xf8,
+0x02, 0x00, 0x92, 0x03, 0x00, 0xda, 0x03, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x2f,
+0x94, 0x04, 0x00, 0xda, 0x03, 0x00, 0xe0, 0x03, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x4d, 0x00, 0x45,
+0x00, 0x5f, 0x00, 0x61, 0x8a, 0x05, 0x00, 0xa0, 0x04, 0x00, 0xae, 0x04, 0x00, 0x92, 0x05, 0x00,
+0x00, 0x37, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x29, 0xd8, 0x05, 0x00, 0xd0, 0x04, 0x00, 0xd6, 0x04,
+0x00, 0xf0, 0x05, 0x00, 0x00, 0x47, 0x00, 0x67, 0x00, 0x89, 0x01, 0x00, 0x69, 0xea, 0x06, 0x00,
+0xa0, 0x05, 0x00, 0xae, 0x05, 0x00, 0xd6, 0x06, 0x00, 0x00, 0x71, 0x00, 0x8f, 0x01, 0x00, 0x9b,
+0x01, 0x00, 0x77, 0xa2, 0x07, 0x00, 0xf8, 0x05, 0x00, 0xe8, 0x05, 0x00, 0x94, 0x07, 0x00, 0x00,
+0x77, 0x00, 0x7d, 0x00, 0x93, 0x01, 0x00, 0x9b, 0x01, 0xe4, 0x07, 0x00, 0xb8, 0x06, 0x00, 0xae,
+0x06, 0x00, 0xe4, 0x07, 0x00, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x87, 0x01, 0x00, 0x93, 0x01, 0x86,
+0x08, 0x00, 0xf2, 0x06, 0x00, 0x82, 0x07, 0x00, 0x98, 0x08, 0x00, 0x00, 0x95, 0x01, 0x00, 0x8f,
+0x01, 0x00, 0xb7, 0x01, 0x00, 0x95, 0x01, 0xf6, 0x08, 0x00, 0xa0, 0x07, 0x00, 0xc4, 0x07, 0x00,
+0x9c, 0x09, 0x00, 0x00, 0x43, 0x00, 0x6d, 0x00, 0xad, 0x01, 0x00, 0x6b, 0xdc, 0x09, 0x00, 0xde,
+0x07, 0x00, 0xf8, 0x07, 0x00, 0xd6, 0x09, 0x00, 0x00, 0x77, 0x00, 0xa5, 0x01, 0x00, 0x99, 0x01,
+0x00, 0x99, 0x01, 0xbe, 0x0a, 0x00, 0xb0, 0x08, 0x00, 0xca, 0x08, 0x00, 0xd0, 0x0a, 0x00, 0x00,
+0x73, 0x00, 0x7d, 0x00, 0xc3, 0x01, 0x00, 0x89, 0x01, 0x96, 0x0b, 0x00, 0x98, 0x09, 0x00, 0x92,
+0x09, 0x00, 0xa0, 0x0b, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x97, 0x01, 0x00, 0xbf, 0x01, 0x00, 0xa1,
+0x01, 0xf2, 0x0b, 0x00, 0xd4, 0x09, 0x00, 0xbe, 0x09, 0x00, 0xdc, 0x0b, 0x00, 0x00, 0x19, 0x00,
+0x5f, 0x00, 0x6f, 0x00, 0x57, 0xce, 0x0c, 0x00, 0x9e, 0x0a, 0x00, 0x96, 0x0a, 0x00, 0xd2, 0x0c,
+0x00, 0x00, 0x67, 0x00, 0x35, 0x00, 0x73, 0x00, 0x6f, 0x96, 0x0d, 0x00, 0xf4, 0x0a, 0x00, 0x88,
+0x0b, 0x00, 0xa8, 0x0d, 0x00, 0x00, 0x3b, 0x00, 0x11, 0x00, 0x45, 0x00, 0x61, 0xe6, 0x0d, 0x00,
+0xd0, 0x0b, 0x00, 0xea, 0x0b, 0x00, 0xfc, 0x0d, 0x00, 0x00, 0x4d, 0x00, 0x1f, 0x00, 0x49, 0x00,
+0x81, 0x01, 0xc8, 0x0e, 0x00, 0xbc, 0x0c, 0x00, 0xba, 0x0c, 0x00, 0xb0, 0x0e, 0x00, 0x00, 0x3d,
+0x00, 0x29, 0x00, 0x6d, 0x00, 0x55, 0x94, 0x0f, 0x00, 0xf0, 0x0c, 0x00, 0xe2, 0x0c, 0x00, 0xa2,
+0x0f, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x49, 0x00, 0x45, 0xec, 0x0f, 0x00, 0x80, 0x0d, 0x00,
+0x8a, 0x0d, 0x00, 0xd8, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x3f, 0x00, 0x1d, 0xb4, 0x10,
+0x00, 0xf2, 0x0d, 0x00, 0xdc, 0x0d, 0x00, 0xaa, 0x10, 0x00, 0x00, 0x3c, 0x00, 0x2c, 0x00, 0x1f,
+0x00, 0x26, 0xa0, 0x11, 0x00, 0xe2, 0x0e, 0x00, 0xb0, 0x0e, 0x00, 0x98, 0x11, 0x00, 0x00, 0x20,
+0x00, 0x40, 0x00, 0x22, 0x00, 0x29, 0xfe, 0x11, 0x00, 0xac, 0x0f, 0x00, 0x9c, 0x0f, 0x00, 0xc2,
+0x11, 0x00, 0x00, 0x42, 0x00, 0x78, 0x00, 0x4c, 0x00, 0x1c, 0x98, 0x12, 0x00, 0xe4, 0x0f, 0x00,
+0xb4, 0x0f, 0x00, 0xf2, 0x11, 0x00, 0x00, 0x3a, 0x00, 0x62, 0x00, 0x3e, 0x00, 0x14, 0xa4, 0x12,
+0x00, 0xf2, 0x0f, 0x00, 0xd8, 0x0f, 0x00, 0xe4, 0x11, 0x00, 0x00, 0x20, 0x00, 0x56, 0x00, 0x1a,
+0x00, 0x10, 0x80, 0x12, 0x00, 0xd8, 0x0f, 0x00, 0xd2, 0x0f, 0x00, 0x82, 0x12, 0x00, 0x00, 0x3a,
+0x00, 0x56, 0x00, 0x22, 0x00, 0x26, 0xea, 0x11, 0x00, 0xf6, 0x0f, 0x00, 0xdc, 0x0f, 0x00, 0xd8,
+0x11, 0x00, 0x00, 0x26, 0x00, 0x56, 0x00, 0x3e, 0x00, 0x22, 0xb2, 0x12, 0x00, 0x8c, 0x10, 0x00,
+0xe2, 0x0f, 0x00, 0xec, 0x11, 0x00, 0x00, 0x64, 0x00, 0x78, 0x00, 0x3a, 0x00, 0x42, 0xc0, 0x12,
+0x00, 0xa2, 0x10, 0x00, 0x98, 0x10, 0x00, 0xa0, 0x12, 0x00, 0x00, 0x6e, 0x00, 0xa4, 0x01, 0x00,
+0x6a, 0x00, 0x50, 0xcc, 0x12, 0x00, 0xec, 0x10, 0x00, 0x94, 0x10, 0x00, 0xb8, 0x12, 0x00, 0x00,
+0x68, 0x00, 0xd0, 0x01, 0x00, 0x8e, 0x01, 0x00, 0x3c, 0xd4, 0x12, 0x00, 0x82, 0x11, 0x00, 0xc0,
+0x10, 0x00, 0xe2, 0x11, 0x00, 0x00, 0x38, 0x00, 0xcc, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x2e, 0xd6,
+0x11, 0x00, 0xb4, 0x10, 0x00, 0xd8, 0x0f, 0x00, 0xe4, 0x10, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x01,
+0x00, 0xb0, 0x01, 0x00, 0x2f, 0xdc, 0x0f, 0x00, 0x80, 0x0f, 0x00, 0xae, 0x0e, 0x00, 0xa0, 0x0f,
+0x00, 0x00, 0x17, 0x00, 0x66, 0x00, 0x4a, 0x00, 0x23, 0xec, 0x0a, 0x00, 0xf4, 0x0c, 0x00, 0xc6,
+0x0c, 0x00, 0x88, 0x0a, 0x00, 0x00, 0x1b, 0x00, 0x1a, 0x00, 0x0d, 0x00, 0x33, 0xec, 0x0f, 0x00,
+0xba, 0x0b, 0x00, 0xbe, 0x0b, 0x00, 0x8e, 0x10, 0x00, 0x00, 0x4b, 0x00, 0x0f, 0x00, 0x2b, 0x00,
+0x75, 0xe0, 0x0b, 0x00, 0xf2, 0x0a, 0x00, 0xd4, 0x0a, 0x00, 0x9a, 0x0b, 0x00, 0x00, 0x7f, 0x00,
+0x19, 0x00, 0x39, 0x00, 0x5d, 0xca, 0x0b, 0x00, 0xfc, 0x0a, 0x00, 0xce, 0x0a, 0x00, 0xac, 0x0b,
+0x00, 0x00, 0x91, 0x01, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x81, 0x01, 0xfe, 0x0a, 0x00, 0x9e, 0x0a,
+0x00, 0xe8, 0x09, 0x00, 0xaa, 0x0a, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x23, 0x00, 0x1d, 0x00, 0xdb,
+0x01, 0xd4, 0x09, 0x00, 0x9a, 0x09, 0x00, 0xb8, 0x08, 0x00, 0xba, 0x08, 0x00, 0x00, 0xb1, 0x01,
+0x00, 0x4d, 0x00, 0x71, 0x00, 0xd1, 0x01, 0xee, 0x06, 0x00, 0xbc, 0x06, 0x00, 0xc2, 0x06, 0x00,
+0xa0, 0x07, 0x00, 0x00, 0x01, 0x00, 0xb7, 0x01, 0x00, 0xbf, 0x01, 0x00, 0x11, 0xb6, 0x05, 0x00,
+0xd0, 0x04, 0x00, 0xbc, 0x05, 0x00, 0x8e, 0x06, 0x00, 0x00, 0x70, 0x00, 0xb3, 0x01, 0x00, 0xdb,
+0x01, 0x00, 0x50, 0x9e, 0x06, 0x00, 0xe8, 0x05, 0x00, 0xa6, 0x06, 0x00, 0xa4, 0x07, 0x00, 0x00,
+0x62, 0x00, 0x17, 0x00, 0x39, 0x00, 0x72, 0xcc, 0x08, 0x00, 0x90, 0x08, 0x00, 0x9e, 0x08, 0x00,
+0xde, 0x08, 0x00, 0x00, 0x72, 0x00, 0x5c, 0x00, 0x2a, 0x00, 0x74, 0x88, 0x0a, 0x00, 0xf0, 0x09,
+0x00, 0xe6, 0x09, 0x00, 0xdc, 0x09, 0x00, 0x00, 0x70, 0x00, 0xa6, 0x01, 0x00, 0xaa, 0x01, 0x00,
+0x72, 0xd0, 0x0b, 0x00, 0xc8, 0x0b, 0x00, 0xf2, 0x0a, 0x00, 0xa4, 0x0b, 0x00, 0x00, 0x8a, 0x01,
+0x00, 0xf0, 0x01, 0x00, 0xa2, 0x01, 0x00, 0x3e, 0x9e, 0x0c, 0x00, 0xea, 0x0b, 0x00, 0xae, 0x0b,
+0x00, 0xe2, 0x0b, 0x00, 0x00, 0xc6, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xe0, 0x01, 0x00, 0xd0, 0x01,
+0x8a, 0x0c, 0x00, 0x82, 0x0c, 0x00, 0xee, 0x0b, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0xd8, 0x01, 0x00,
+0xda, 0x01, 0x00, 0xbc, 0x01, 0x00, 0xe8, 0x01, 0x9e, 0x0c, 0x00, 0x8c, 0x0c, 0x00, 0x9c, 0x0c,
+0x00, 0xd2, 0x0c, 0x00, 0x00, 0xe6, 0x01, 0x00, 0xe0, 0x01, 0x00, 0xc0, 0x01, 0x00, 0x8c, 0x02,
+0xce, 0x0c, 0x00, 0xec, 0x0c, 0x00, 0xd8, 0x0c, 0x00, 0xd2, 0x0c, 0x00, 0x00, 0xa0, 0x02, 0x00,
+0x9a, 0x02, 0x00, 0xc8, 0x01, 0x00, 0x98, 0x02, 0xe4, 0x0d, 0x00, 0xbc, 0x0d, 0x00, 0xd4, 0x0d,
+0x00, 0xd0, 0x0d, 0x00, 0x00, 0xf6, 0x01, 0x00, 0xaa, 0x02, 0x00, 0xe8, 0x01, 0x00, 0x8a, 0x02,
+0x8c, 0x0e, 0x00, 0x84, 0x0f, 0x00, 0xa4, 0x0e, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0xc8, 0x01, 0x00,
+0x96, 0x02, 0x00, 0xb8, 0x02, 0x00, 0xee, 0x01, 0xec, 0x0e, 0x00, 0x94, 0x0f, 0x00, 0xcc, 0x0e,
+0x00, 0xa2, 0x0e, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x94, 0x02, 0x00, 0x80, 0x02, 0x00, 0xb0, 0x01,
+0x9e, 0x0e, 0x00, 0xac, 0x0e, 0x00, 0x88, 0x0e, 0x00, 0xdc, 0x0d, 0x00, 0x00, 0xee, 0x01, 0x00,
+0x98, 0x02, 0x00, 0xbe, 0x02, 0x00, 0xb6, 0x01, 0xd8, 0x0d, 0x00, 0x8e, 0x0e, 0x00, 0xf4, 0x0d,
+0x00, 0xd8, 0x0d, 0x00, 0x00, 0xc4, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xee, 0x01, 0x00, 0xd2, 0x01,
+0xde, 0x0c, 0x00, 0x9e, 0x0d, 0x00, 0xdc, 0x0d, 0x00, 0xde, 0x0c, 0x00, 0x00, 0xf0, 0x01, 0x00,
+0xc2, 0x01, 0x00, 0xbc, 0x01, 0x00, 0xe0, 0x01, 0xea, 0x0c, 0x00, 0xca, 0x0d, 0x00, 0xc4, 0x0d,
+0x00, 0xa4, 0x0d, 0x00, 0x00, 0xd0, 0x01, 0x00, 0xd8, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xf2, 0x01,
+0x9a, 0x0d, 0x00, 0x82, 0x0e, 0x00, 0x84, 0x0e, 0x00, 0xb2, 0x0d, 0x00, 0x00, 0xb6, 0x01, 0x00,
+0xd6, 0x01, 0x00, 0xde, 0x01, 0x00, 0xc6, 0x01, 0x8c, 0x0e, 0x00, 0xb6, 0x0e, 0x00, 0xd8, 0x0e,
+0x00, 0xfc, 0x0d, 0x00, 0x00, 0x8e, 0x01, 0x00, 0xca, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xa2, 0x01,
+0xb4, 0x0e, 0x00, 0x94, 0x0f, 0x00, 0xee, 0x0e, 0x00, 0x8a, 0x0e, 0x00, 0x00, 0x9c, 0x01, 0x00,
+0xc8, 0x01, 0x00, 0xb2, 0x01, 0x00, 0x7e, 0xc0, 0x0e, 0x00, 0xb4, 0x0f, 0x00, 0x92, 0x0f, 0x00,
+0xc2, 0x0e, 0x00, 0x00, 0x8a, 0x01, 0x00, 0xbe, 0x01, 0x00, 0xaa, 0x01, 0x00, 0xae, 0x01, 0xe0,
+0x0e, 0x00, 0xf0, 0x0f, 0x00, 0xd6, 0x0f, 0x00, 0xb4, 0x0e, 0x00, 0x00, 0x60, 0x00, 0x76, 0x00,
+0x84, 0x01, 0x00, 0x56, 0xce, 0x0e, 0x00, 0xd6, 0x0f, 0x00, 0xee, 0x0f, 0x00, 0xce, 0x0e, 0x00,
+0x00, 0x70, 0x00, 0x90, 0x01, 0x00, 0x76, 0x00, 0x74, 0xf4, 0x0e, 0x00, 0x8a, 0x10, 0x00, 0x84,
+0x10, 0x00, 0xfa, 0x0e, 0x00, 0x00, 0x70, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6a, 0x88, 0x0f, 0x00,
+0x9a, 0x10, 0x00, 0xe8, 0x0f, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x56, 0x00, 0x72, 0x00, 0x4a, 0x00,
+0x54, 0xaa, 0x0f, 0x00, 0xb6, 0x10, 0x00, 0xba, 0x10, 0x00, 0x90, 0x0f, 0x00, 0x00, 0x4c, 0x00,
+0x5a, 0x00, 0x58, 0x00, 0x5c, 0xa6, 0x0f, 0x00, 0xf4, 0x10, 0x00, 0xca, 0x10, 0x00, 0xc6, 0x0f,
+0x00, 0x00, 0x6c, 0x00, 0x8a, 0x01, 0x00, 0x84, 0x01, 0x00, 0x6a, 0xec, 0x0f, 0x00, 0x9a, 0x11,
+0x00, 0xb8, 0x11, 0x00, 0x88, 0x0f, 0x00, 0x00, 0x48, 0x00, 0x8a, 0x01, 0x00, 0x94, 0x01, 0x00,
+0x6a, 0x9a, 0x10, 0x00, 0x8c, 0x12, 0x00, 0xba, 0x11, 0x00, 0xce, 0x0f, 0x00, 0x00, 0x5a, 0x00,
+0x92, 0x01, 0x00, 0x9a, 0x01, 0x00, 0x4e, 0xf0, 0x0f, 0x00, 0xfa, 0x11, 0x00, 0xc8, 0x11, 0x00,
+0xd4, 0x0f, 0x00, 0x00, 0x36, 0x00, 0xb2, 0x01, 0x00, 0xd0, 0x01, 0x00, 0x6a, 0xcc, 0x0f, 0x00,
+0xd6, 0x11, 0x00, 0x92, 0x11, 0x00, 0xf6, 0x0e, 0x00, 0x00, 0x3c, 0x00, 0x80, 0x01, 0x00, 0x6a,
+0x00, 0x5a, 0xde, 0x0e, 0x00, 0xd6, 0x10, 0x00, 0xb6, 0x10, 0x00, 0xce, 0x0e, 0x00, 0x00, 0x46,
+0x00, 0x6e, 0x00, 0x74, 0x00, 0x54, 0x86, 0x0e, 0x00, 0xbc, 0x10, 0x00, 0xa0, 0x10, 0x00, 0xfa,
+0x0d, 0x00, 0x00, 0x46, 0x00, 0x8a, 0x01, 0x00, 0xa6, 0x01, 0x00, 0x5e, 0xe4, 0x0d, 0x00, 0xf2,
+0x0f, 0x00, 0xcc, 0x0f, 0x00, 0x8c, 0x0d, 0x00, 0x00, 0x14, 0x00, 0x80, 0x01, 0x00, 0x8a, 0x01,
+0x00, 0x46, 0x9a, 0x0d, 0x00, 0xc8, 0x0f, 0x00, 0x9a, 0x0f, 0x00, 0x82, 0x0d, 0x00, 0x00, 0x2a,
+0x00, 0x9a, 0x01, 0x00, 0xac, 0x01, 0x00, 0x46, 0xea, 0x0c, 0x00, 0xa0, 0x0f, 0x00, 0xb0, 0x0e,
+0x00, 0x94, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x72, 0x00, 0x9a, 0x01, 0x00, 0x1c, 0xa8, 0x0c, 0x00,
+0xae, 0x0e, 0x00, 0xee, 0x0d, 0x00, 0xe4, 0x0b, 0x00, 0x00, 0x45, 0x00, 0x92, 0x01, 0x00, 0x84,
+0x01, 0x00, 0x11, 0xb4, 0x0b, 0x00, 0x90, 0x0d, 0x00, 0xa0, 0x0c, 0x00, 0xd6, 0x0a, 0x00, 0x00,
+0x3b, 0x00, 0x58, 0x00, 0x7c, 0x00, 0x2b, 0xee, 0x09, 0x00, 0xd2, 0x0b, 0x00, 0x86, 0x0b, 0x00,
+0xb2, 0x09, 0x00, 0x00, 0x43, 0x00, 0x16, 0x00, 0x32, 0x00, 0x1d, 0x9e, 0x08, 0x00, 0x94, 0x0a,
+0x00, 0xe4, 0x09, 0x00, 0xea, 0x07, 0x00, 0x00, 0x63, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x43, 0x94,
+0x07, 0x00, 0xd6, 0x08, 0x00, 0x92, 0x08, 0x00, 0xde, 0x06, 0x00, 0x00, 0x89, 0x01, 0x00, 0x29,
+0x00, 0x14, 0x00, 0x7b, 0x98, 0x06, 0x00, 0x86, 0x07, 0x00, 0xd0, 0x06, 0x00, 0xc8, 0x05, 0x00,
+0x00, 0xd7, 0x01, 0x00, 0x4b, 0x00, 0x47, 0x00, 0xc3, 0x01, 0xfa, 0x04, 0x00, 0xb6, 0x05, 0x00,
+0xe6, 0x04, 0x00, 0x9e, 0x04, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x85, 0x01, 0x00, 0x7d, 0x00, 0xcb,
+0x01, 0xea, 0x02, 0x00, 0xa4, 0x03, 0x00, 0xe6, 0x02, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xdf, 0x01,
+0x00, 0xc7, 0x01, 0x00, 0xb3, 0x01, 0x00, 0xd9, 0x01, 0x76, 0x00, 0x8e, 0x01, 0x00, 0x7e, 0x00,
+0x58, 0x00, 0x00, 0xd3, 0x01, 0x00, 0xd3, 0x01, 0x00, 0xe1, 0x01, 0x00, 0xe1, 0x01, 0x5f, 0x00,
+0x81, 0x01, 0x00, 0x75, 0x00, 0x63, 0x00, 0x00, 0xe3, 0x01, 0x00, 0x8b, 0x02, 0x00, 0xa3, 0x02,
+0x00, 0xd7, 0x01, 0xcd, 0x02, 0x00, 0xf7, 0x02, 0x00, 0xef, 0x02, 0x00, 0xc3, 0x02, 0x00, 0x00,
+0xe7, 0x01, 0x00, 0xa9, 0x02, 0x00, 0xa7, 0x02, 0x00, 0x83, 0x02, 0xff, 0x03, 0x00, 0xf5, 0x04,
+0x00, 0xdb, 0x04, 0x00, 0xd5, 0x03, 0x00, 0x00, 0xeb, 0x01, 0x00, 0xa5, 0x02, 0x00, 0xc1, 0x02,
+0x00, 0x85, 0x02, 0xd9, 0x04, 0x00, 0xf3, 0x05, 0x00, 0xe5, 0x05, 0x00, 0xd9, 0x04, 0x00, 0x00,
+0xe5, 0x01, 0x00, 0xb1, 0x02, 0x00, 0xcd, 0x02, 0x00, 0xfb, 0x01, 0x87, 0x06, 0x00, 0xa7, 0x07,
+0x00, 0xa1, 0x07, 0x00, 0xfd, 0x05, 0x00, 0x00, 0xf3, 0x01, 0x00, 0xad, 0x02, 0x00, 0xb5, 0x02,
+0x00, 0xf3, 0x01, 0x9f, 0x07, 0x00, 0xe7, 0x08, 0x00, 0xd7, 0x08, 0x00, 0xfd, 0x06, 0x00, 0x00,
+0xb3, 0x01, 0x00, 0xb1, 0x02, 0x00, 0xa9, 0x02, 0x00, 0xe5, 0x01, 0xb7, 0x08, 0x00, 0x9b, 0x0a,
+0x00, 0xfb, 0x09, 0x00, 0xa5, 0x08, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x89, 0x02, 0x00, 0x9f, 0x02,
+0x00, 0xf1, 0x01, 0xc3, 0x09, 0x00, 0x8d, 0x0b, 0x00, 0xe7, 0x0a, 0x00, 0xa7, 0x09, 0x00, 0x00,
+0xbf, 0x01, 0x00, 0xe9, 0x01, 0x00, 0x93, 0x02, 0x00, 0xbf, 0x01, 0x9b, 0x0a, 0x00, 0x9f, 0x0c,
+0x00, 0x99, 0x0c, 0x00, 0x95, 0x0a, 0x00, 0x00, 0xd3, 0x01, 0x00, 0xf1, 0x01, 0x00, 0xe5, 0x01,
+0x00, 0xff, 0x01, 0x8f, 0x0b, 0x00, 0xd1, 0x0d, 0x00, 0xc1, 0x0d, 0x00, 0xed, 0x0a, 0x00, 0x00,
+0xc1, 0x01, 0x00, 0xe5, 0x01, 0x00, 0xed, 0x01, 0x00, 0xd3, 0x01, 0xaf, 0x0c, 0x00, 0xeb, 0x0e,
+0x00, 0xdd, 0x0e, 0x00, 0xa5, 0x0c, 0x00, 0x00, 0x8f, 0x01, 0x00, 0xef, 0x01, 0x00, 0x93, 0x02,
+0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x95, 0x1c, 0x71, 0xbf, 0x20, 0x83, 0x02, 0xbf, 0x1f, 0xfb, 0x01, 0xa7, 0x1b,
+0xa9, 0x01, 0x00, 0x91, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xeb, 0x01, 0x00, 0x9b, 0x01, 0xdf, 0x0e,
+0x00, 0x8b, 0x11, 0x00, 0xf1, 0x10, 0x00, 0xc3, 0x0e, 0x00, 0x00, 0x7d, 0x00, 0x9f, 0x01, 0x00,
+0xb3, 0x01, 0x00, 0x99, 0x01, 0xa1, 0x0f, 0x00, 0xcb, 0x11, 0x00, 0xc9, 0x11, 0x00, 0x8d, 0x0f,
+0x00, 0x00, 0x8d, 0x01, 0x00, 0xb7, 0x01, 0x00, 0xa9, 0x01, 0x00, 0xb9, 0x01, 0xc3, 0x0f, 0x00,
+0x8b, 0x12, 0x00, 0x91, 0x12, 0x00, 0xcb, 0x0f, 0x00, 0x00, 0x91, 0x01, 0x00, 0xc3, 0x01, 0x00,
+0xb7, 0x01, 0x00, 0xd3, 0x01, 0xcd, 0x10, 0x00, 0x85, 0x13, 0x00, 0xcb, 0x12, 0x00, 0xa3, 0x10,
+0x00, 0x00, 0x87, 0x01, 0x00, 0xa3, 0x01, 0x00, 0xcd, 0x01, 0x00, 0x6d, 0xd5, 0x11, 0x00, 0xcb,
+0x13, 0x00, 0xb9, 0x13, 0x00, 0xb3, 0x11, 0x00, 0x00, 0x75, 0x00, 0xd3, 0x01, 0x00, 0xa9, 0x01,
+0x00, 0x9d, 0x01, 0x95, 0x12, 0x00, 0xcb, 0x14, 0x00, 0xcd, 0x13, 0x00, 0xed, 0x11, 0x00, 0x00,
+0x4d, 0x00, 0xbb, 0x01, 0x00, 0xe3, 0x01, 0x00, 0x4f, 0x95, 0x13, 0x00, 0xe1, 0x14, 0x00, 0xa9,
+0x14, 0x00, 0xa9, 0x12, 0x00, 0x00, 0x4b, 0x00, 0xcd, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x75, 0xcd,
+0x13, 0x00, 0xa1, 0x15, 0x00, 0xbd, 0x14, 0x00, 0xf7, 0x12, 0x00, 0x00, 0x67, 0x00, 0xb9, 0x01,
+0x00, 0xc5, 0x01, 0x00, 0x67, 0xa5, 0x13, 0x00, 0xf5, 0x14, 0x00, 0xa7, 0x14, 0x00, 0xdd, 0x12,
+0x00, 0x00, 0x5f, 0x00, 0xbf, 0x01, 0x00, 0xb1, 0x01, 0x00, 0x73, 0xa3, 0x13, 0x00, 0xb5, 0x14,
+0x00, 0xe9, 0x13, 0x00, 0xdd, 0x12, 0x00, 0x00, 0x73, 0x00, 0x8f, 0x01, 0x00, 0x8b, 0x01, 0x00,
+0x75, 0xd9, 0x12, 0x00, 0xf1, 0x13, 0x00, 0xc3, 0x13, 0x00, 0xb1, 0x12, 0x00, 0x00, 0x7f, 0x00,
+0xb5, 0x01, 0x00, 0x9b, 0x01, 0x00, 0x8f, 0x01, 0xdb, 0x12, 0x00, 0xdb, 0x13, 0x00, 0xb3, 0x13,
+0x00, 0xa3, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xed, 0x12, 0xeb, 0x01, 0xc3, 0x13, 0xbb, 0x03, 0xf5, 0x12, 0xb3, 0x03,
+0xb7, 0x12, 0xf7, 0x01, 0xf3, 0x12, 0x00, 0x9f, 0x13, 0x00, 0xeb, 0x12, 0x00, 0x9b, 0x12, 0x00,
+0x00, 0x69, 0x00, 0xe7, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x5d, 0xbd, 0x12, 0x00, 0x87, 0x13, 0x00,
+0x95, 0x12, 0x00, 0x91, 0x12, 0x00, 0x00, 0x4b, 0x00, 0x79, 0x00, 0xc7, 0x02, 0x00, 0x4d, 0xe7,
+0x11, 0x00, 0xd3, 0x11, 0x00, 0xcb, 0x11, 0x00, 0x9d, 0x11, 0x00, 0x00, 0x6b, 0x00, 0x47, 0x00,
+0x4a, 0x00, 0x61, 0xd3, 0x11, 0x00, 0xd7, 0x11, 0x00, 0xc9, 0x11, 0x00, 0xb1, 0x11, 0x00, 0x00,
+0x1f, 0x00, 0x6f, 0x00, 0x06, 0x00, 0x3d, 0xb3, 0x11, 0x00, 0xcd, 0x11, 0x00, 0xef, 0x10, 0x00,
+0x91, 0x11, 0x00, 0x00, 0x47, 0x00, 0x8f, 0x01, 0x00, 0x6f, 0x00, 0x31, 0x85, 0x11, 0x00, 0xd9,
+0x10, 0x00, 0x8f, 0x10, 0x00, 0xb9, 0x10, 0x00, 0x00, 0x51, 0x00, 0x99, 0x01, 0x00, 0x59, 0x00,
+0x39, 0xb7, 0x10, 0x00, 0x91, 0x10, 0x00, 0xd1, 0x0f, 0x00, 0xef, 0x0f, 0x00, 0x00, 0x53, 0x00,
+0xaf, 0x01, 0x00, 0x85, 0x01, 0x00, 0x5d, 0xcf, 0x0f, 0x00, 0x93, 0x0f, 0x00, 0xd3, 0x0e, 0x00,
+0xfb, 0x0e, 0x00, 0x00, 0x59, 0x00, 0x73, 0x00, 0x7d, 0x00, 0x35, 0xf9, 0x0e, 0x00, 0xad, 0x0e,
+0x00, 0xcb, 0x0d, 0x00, 0xd7, 0x0e, 0x00, 0x00, 0x5b, 0x00, 0x85, 0x01, 0x00, 0x5b, 0x00, 0x6d,
+0xa5, 0x0d, 0x00, 0xf1, 0x0c, 0x00, 0xe1, 0x0c, 0x00, 0xd5, 0x0c, 0x00, 0x00, 0x7d, 0x00, 0x77,
+0x00, 0x67, 0x00, 0x69, 0xa7, 0x0c, 0x00, 0xd3, 0x0b, 0x00, 0xbb, 0x0b, 0x00, 0xf5, 0x0b, 0x00,
+0x00, 0x55, 0x00, 0x85, 0x01, 0x00, 0x55, 0x00, 0x8f, 0x01, 0x9d, 0x0b, 0x00, 0xe7, 0x0a, 0x00,
+0xbf, 0x0a, 0x00, 0x83, 0x0b, 0x00, 0x00, 0x4b, 0x00, 0x81, 0x01, 0x00, 0x7b, 0x00, 0x3f, 0xa1,
+0x0a, 0x00, 0xd3, 0x09, 0x00, 0xf3, 0x08, 0x00, 0x93, 0x09, 0x00, 0x00, 0x21, 0x00, 0x83, 0x01,
+0x00, 0x79, 0x00, 0x10, 0xa3, 0x08, 0x00, 0xf5, 0x07, 0x00, 0xad, 0x07, 0x00, 0xaf, 0x08, 0x00,
+0x00, 0x13, 0x00, 0x47, 0x00, 0x3d, 0x00, 0x03, 0x89, 0x06, 0x00, 0xf1, 0x05, 0x00, 0xeb, 0x05,
+0x00, 0xdf, 0x05, 0x00, 0x00, 0x2b, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x1b, 0xe7, 0x03, 0x00, 0xb7,
+0x03, 0x00, 0xed, 0x03, 0x00, 0xa3, 0x04, 0x00, 0x00, 0x21, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x15,
+0xfb, 0x02, 0x00, 0xf7, 0x02, 0x00, 0x85, 0x03, 0x00, 0x97, 0x03, 0x00, 0x00, 0x15, 0x00, 0x00,
+0x00, 0x0a, 0x00, 0x11, 0x9f, 0x02, 0x00, 0xa1, 0x02, 0x00, 0x9d, 0x02, 0x00, 0x9b, 0x02, 0x00,
+0x00, 0x0c, 0x00, 0x17, 0x00, 0x11, 0x00, 0x0c, 0xc7, 0x01, 0x00, 0xc9, 0x01, 0x00, 0xbf, 0x01,
+0x00, 0x9f, 0x01, 0x00, 0x00, 0x26, 0x00, 0x29, 0x00, 0x25, 0x00, 0x16, 0x51, 0x00, 0x5b, 0x00,
+0x4b, 0x00, 0x3f, 0x00, 0x00, 0x1e, 0x00, 0x23, 0x00, 0x33, 0x00, 0x18, 0x10, 0x00, 0x13, 0x00,
+0x04, 0x00, 0x16, 0x00, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x21, 0x00, 0x3c, 0x76, 0x00, 0x6c, 0x00,
+0x76, 0x00, 0x82, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1c, 0xcc, 0x01, 0x00,
+0xca, 0x01, 0x00, 0xde, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x1d, 0x00,
+0x17, 0xa4, 0x02, 0x00, 0x94, 0x02, 0x00, 0x98, 0x02, 0x00, 0xa4, 0x02, 0x00, 0x00, 0x38, 0x00,
+0x20, 0x00, 0x20, 0x00, 0x14, 0xd4, 0x02, 0x00, 0xd8, 0x02, 0x00, 0xda, 0x02, 0x00, 0xd0, 0x02,
+0x00, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x60, 0xf4, 0x02, 0x00, 0xda, 0x02, 0x00, 0xec,
+0x02, 0x00, 0xb2, 0x03, 0x00, 0x00, 0x76, 0x00, 0x54, 0x00, 0x4a, 0x00, 0x58, 0xb8, 0x03, 0x00,
+0x9c, 0x03, 0x00, 0xa8, 0x03, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x7c, 0x00, 0x6e, 0x00, 0x58, 0x00,
+0x70, 0xd0, 0x03, 0x00, 0x9e, 0x03, 0x00, 0x8e, 0x03, 0x00, 0xcc, 0x03, 0x00, 0x00, 0xb2, 0x01,
+0x00, 0x76, 0x00, 0x7a, 0x00, 0x92, 0x01, 0xe6, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xca, 0x03, 0x00,
+0xde, 0x03, 0x00, 0x00, 0xae, 0x01, 0x00, 0xb4, 0x01, 0x00, 0xa2, 0x01, 0x00, 0xb0, 0x01, 0x9e,
+0x04, 0x00, 0xec, 0x03, 0x00, 0xd6, 0x03, 0x00, 0xbc, 0x03, 0x00, 0x00, 0xb6, 0x01, 0x00, 0xd8,
+0x01, 0x00, 0xe4, 0x01, 0x00, 0xb6, 0x01, 0x9c, 0x04, 0x00, 0xa0, 0x04, 0x00, 0xde, 0x03, 0x00,
+0x90, 0x04, 0x00, 0x00, 0xfe, 0x01, 0x00, 0xb0, 0x02, 0x00, 0xa2, 0x02, 0x00, 0x92, 0x02, 0x88,
+0x04, 0x00, 0x8e, 0x04, 0x00, 0xf2, 0x03, 0x00, 0x8a, 0x04, 0x00, 0x00, 0xc4, 0x02, 0x00, 0xd4,
+0x02, 0x00, 0xb6, 0x02, 0x00, 0xb6, 0x02, 0x8e, 0x04, 0x00, 0xee, 0x03, 0x00, 0xd4, 0x03, 0x00,
+0xe6, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0xf0, 0x02, 0x00, 0xfa, 0x02, 0x00, 0xce, 0x02, 0xec,
+0x03, 0x00, 0xe4, 0x03, 0x00, 0xca, 0x03, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xb4, 0x03, 0x00, 0xd0,
+0x03, 0x00, 0xc2, 0x03, 0x00, 0xd0, 0x03, 0xf6, 0x03, 0x00, 0xd4, 0x03, 0x00, 0xba, 0x03, 0x00,
+0xea, 0x03, 0x00, 0x00, 0x80, 0x04, 0x00, 0xbe, 0x04, 0x00, 0x94, 0x04, 0x00, 0xea, 0x03, 0x88,
+0x04, 0x00, 0xb0, 0x04, 0x00, 0xf8, 0x03, 0x00, 0xea, 0x03, 0x00, 0x00, 0xec, 0x04, 0x00, 0xba,
+0x05, 0x00, 0x84, 0x05, 0x00, 0xde, 0x04, 0x98, 0x04, 0x00, 0xe4, 0x03, 0x00, 0xae, 0x03, 0x00,
+0xd2, 0x03, 0x00, 0x00, 0xd6, 0x05, 0x00, 0x8c, 0x06, 0x00, 0x94, 0x06, 0x00, 0xbe, 0x05, 0xd2,
+0x03, 0x00, 0xb4, 0x03, 0x00, 0x9e, 0x03, 0x00, 0x8c, 0x03, 0x00, 0x00, 0xb4, 0x06, 0x00, 0xee,
+0x06, 0x00, 0xe0, 0x06, 0x00, 0xce, 0x06, 0xfa, 0x02, 0x00, 0xe4, 0x02, 0x00, 0xd8, 0x02, 0x00,
+0xc8, 0x02, 0x00, 0x00, 0xa8, 0x07, 0x00, 0xb2, 0x07, 0x00, 0xa4, 0x07, 0x00, 0x80, 0x07, 0xb8,
+0x02, 0x00, 0xcc, 0x02, 0x00, 0xa4, 0x02, 0x00, 0x9a, 0x02, 0x00, 0x00, 0xca, 0x08, 0x00, 0xc6,
+0x08, 0x00, 0xba, 0x08, 0x00, 0xb0, 0x08, 0xf2, 0x01, 0x00, 0xec, 0x01, 0x00, 0xac, 0x02, 0x00,
+0xac, 0x02, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x96, 0x09, 0x00, 0xf4, 0x08, 0x00, 0xa8, 0x09, 0xbe,
+0x02, 0x00, 0x82, 0x02, 0x00, 0xa0, 0x02, 0x00, 0xae, 0x02, 0x00, 0x00, 0xf6, 0x09, 0x00, 0xb0,
+0x0a, 0x00, 0xca, 0x0a, 0x00, 0xd0, 0x09, 0xd8, 0x02, 0x00, 0xbe, 0x02, 0x00, 0x90, 0x02, 0x00,
+0xd0, 0x02, 0x00, 0x00, 0xe8, 0x0a, 0x00, 0xc2, 0x0b, 0x00, 0x84, 0x0b, 0x00, 0xb6, 0x0a, 0xc4,
+0x02, 0x00, 0xb0, 0x02, 0x00, 0x84, 0x02, 0x00, 0x82, 0x02, 0x00, 0x00, 0xee, 0x0b, 0x00, 0xdc,
+0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xd6, 0x0b, 0x92, 0x02, 0x00, 0xb4, 0x02, 0x00, 0xc4, 0x01, 0x00,
+0xee, 0x01, 0x00, 0x00, 0xc6, 0x0c, 0x00, 0x98, 0x0d, 0x00, 0x88, 0x0d, 0x00, 0xd4, 0x0c, 0xc8,
+0x01, 0x00, 0x98, 0x01, 0x00, 0x8e, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x00, 0xc0, 0x0d, 0x00, 0xfc,
+0x0d, 0x00, 0xd0, 0x0d, 0x00, 0xc8, 0x0d, 0x18, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x6c, 0x00, 0x00,
+0xac, 0x0e, 0x00, 0x9a, 0x0e, 0x00, 0x9e, 0x0e, 0x00, 0xfc, 0x0d, 0xb0, 0x01, 0x00, 0x64, 0x00,
+0x1c, 0x00, 0x5c, 0x00, 0x00, 0xe6, 0x0e, 0x00, 0xfa, 0x0e, 0x00, 0xee, 0x0e, 0x00, 0xf2, 0x0e,
+0x78, 0x00, 0x5e, 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0xd2, 0x0f, 0x00, 0xe2, 0x0f, 0x00, 0xaa,
+0x0f, 0x00, 0xae, 0x0f, 0x9a, 0x01, 0x00, 0x72, 0x00, 0x14, 0x00, 0x4a, 0x00, 0x00, 0xda, 0x0d,
+0x00, 0xa0, 0x10, 0x00, 0xaa, 0x10, 0x00, 0xde, 0x0f, 0x96, 0x01, 0x00, 0x62, 0x00, 0x2d, 0x00,
+0x03, 0x00, 0x00, 0xa8, 0x12, 0x00, 0xe6, 0x10, 0x00, 0xc8, 0x10, 0x00, 0x96, 0x10, 0x32, 0x00,
+0x30, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00, 0xd8, 0x10, 0x00, 0x80, 0x11, 0x00, 0xea, 0x10, 0x00,
+0x9e, 0x10, 0x1a, 0x00, 0x1f, 0x00, 0x33, 0x00, 0xc3, 0x01, 0x00, 0x00, 0xe0, 0x10, 0x00, 0xe4,
+0x10, 0x00, 0xf0, 0x10, 0x00, 0xe2, 0x10, 0x05, 0x00, 0x49, 0x00, 0x5d, 0x00, 0xad, 0x01, 0x00,
+0x00, 0xc0, 0x11, 0x00, 0x8a, 0x11, 0x00, 0x92, 0x11, 0x00, 0xba, 0x11, 0x55, 0x00, 0x71, 0x00,
+0x1d, 0x00, 0xda, 0x01, 0x00, 0x00, 0xa4, 0x11, 0x00, 0x9a, 0x11, 0x00, 0x8e, 0x11, 0x00, 0xae,
+0x11, 0x4f, 0x00, 0x6b, 0x00, 0x49, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x9a, 0x11, 0x00, 0xba, 0x11,
+0x00, 0xba, 0x0f, 0x00, 0xe6, 0x10, 0x45, 0x00, 0x2b, 0x00, 0x0f, 0x00, 0x9e, 0x01, 0x00, 0x00,
+0xb0, 0x11, 0x00, 0xb6, 0x11, 0x00, 0xae, 0x13, 0x00, 0x92, 0x11, 0x5c, 0x00, 0x05, 0x00, 0x23,
+0x00, 0x05, 0x00, 0x00, 0xec, 0x10, 0x00, 0x96, 0x11, 0x00, 0x98, 0x11, 0x00, 0xe6, 0x10, 0x17,
+0x00, 0x3b, 0x00, 0x7b, 0x00, 0x0d, 0x00, 0x00, 0xe0, 0x10, 0x00, 0xfe, 0x10, 0x00, 0xd6, 0x10,
+0x00, 0xfa, 0x10, 0x25, 0x00, 0x5d, 0x00, 0x45, 0x00, 0x16, 0x00, 0x00, 0x8c, 0x11, 0x00, 0xd2,
+0x10, 0x00, 0xdc, 0x10, 0x00, 0xfa, 0x10, 0x57, 0x00, 0xad, 0x01, 0x00, 0x89, 0x01, 0x00, 0x41,
+0x00, 0x00, 0xc8, 0x10, 0x00, 0xa4, 0x10, 0x00, 0x96, 0x10, 0x00, 0xac, 0x10, 0x75, 0x00, 0xa9,
+0x01, 0x00, 0x61, 0x00, 0x2d, 0x00, 0x00, 0xb2, 0x10, 0x00, 0x8e, 0x10, 0x00, 0x8e, 0x10, 0x00,
+0xae, 0x10, 0x13, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x59, 0x00, 0x00, 0xd6, 0x0f, 0x00, 0x9e, 0x10,
+0x00, 0x92, 0x10, 0x00, 0xbe, 0x0f, 0xa4, 0x01, 0x00, 0x4a, 0x00, 0x30, 0x00, 0x98, 0x01, 0x00,
+0x00, 0x96, 0x0f, 0x00, 0xc8, 0x0f, 0x00, 0xd6, 0x0f, 0x00, 0xca, 0x0f, 0x38, 0x00, 0x16, 0x00,
+0x03, 0x00, 0x44, 0x00, 0x00, 0xfe, 0x0e, 0x00, 0xb4, 0x0f, 0x00, 0xaa, 0x0f, 0x00, 0xce, 0x0e,
+0x23, 0x00, 0x04, 0x00, 0x11, 0x00, 0x07, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0xd0, 0x0e, 0x00, 0x9e,
+0x0e, 0x00, 0xca, 0x0e, 0x40, 0x00, 0x23, 0x00, 0x0c, 0x00, 0x2e, 0x00, 0x00, 0xe8, 0x0d, 0x00,
+0xe2, 0x0d, 0x00, 0x86, 0x0e, 0x00, 0xf6, 0x0d, 0x84, 0x01, 0x00, 0x2a, 0x00, 0x0c, 0x00, 0x88,
+0x01, 0x00, 0x00, 0x84, 0x0d, 0x00, 0xb0, 0x0d, 0x00, 0x94, 0x0d, 0x00, 0xe2, 0x0c, 0x74, 0x00,
+0x12, 0x00, 0x08, 0x00, 0x3c, 0x00, 0x00, 0x98, 0x0c, 0x00, 0xca, 0x0c, 0x00, 0xb2, 0x0c, 0x00,
+0x9c, 0x0c, 0x6e, 0x00, 0x6e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0xfe, 0x0a, 0x00, 0xcc, 0x0b,
+0x00, 0xda, 0x0b, 0x00, 0x9e, 0x0b, 0x86, 0x01, 0x00, 0x1a, 0x00, 0x6e, 0x00, 0x54, 0x00, 0x00,
+0xb6, 0x0a, 0x00, 0xf4, 0x0a, 0x00, 0xd8, 0x0a, 0x00, 0x94, 0x0a, 0x74, 0x00, 0x6a, 0x00, 0x32,
+0x00, 0xa4, 0x01, 0x00, 0x00, 0xa2, 0x09, 0x00, 0xda, 0x09, 0x00, 0xe2, 0x09, 0x00, 0xa8, 0x09,
+0x0e, 0x00, 0x3c, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0xd0, 0x08, 0x00, 0xbc, 0x08, 0x00, 0xe2,
+0x08, 0x00, 0xc2, 0x08, 0x15, 0x00, 0x0b, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x00, 0xbc, 0x07, 0x00,
+0xb4, 0x07, 0x00, 0xb0, 0x07, 0x00, 0xe2, 0x07, 0x0e, 0x00, 0x1d, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+0x00, 0xca, 0x06, 0x00, 0xb2, 0x06, 0x00, 0x9e, 0x06, 0x00, 0xb2, 0x06, 0x40, 0x00, 0x0a, 0x00,
+0x20, 0x00, 0x21, 0x00, 0x00, 0xa2, 0x05, 0x00, 0xaa, 0x05, 0x00, 0xac, 0x05, 0x00, 0x98, 0x05,
+0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x1f, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x8a, 0x04, 0x00, 0xf4,
+0x03, 0x00, 0xe0, 0x03, 0x0c, 0x00, 0x23, 0x00, 0x2b, 0x00, 0x1f, 0x00, 0x00, 0xe4, 0x02, 0x00,
+0xe6, 0x02, 0x00, 0x94, 0x03, 0x00, 0xf4, 0x02, 0x79, 0x00, 0xab, 0x01, 0x00, 0x8b, 0x01, 0x00,
+0x43, 0x00, 0x00, 0xc8, 0x01, 0x00, 0xa4, 0x01, 0x00, 0x76, 0x00, 0xf0, 0x01, 0xf7, 0x01, 0x00,
+0xeb, 0x01, 0x00, 0xad, 0x01, 0x00, 0xd7, 0x01, 0x00, 0x00, 0x4e, 0x00, 0x23, 0x00, 0x06, 0x00,
+0x4e, 0xb7, 0x02, 0x00, 0x8f, 0x02, 0x00, 0xd5, 0x01, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x4b, 0x00,
+0xa7, 0x01, 0x00, 0xa5, 0x01, 0x00, 0x47, 0xe5, 0x01, 0x00, 0xe3, 0x01, 0x00, 0xbb, 0x01, 0x00,
+0xbb, 0x01, 0x00, 0x00, 0xaf, 0x02, 0x00, 0xd1, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x9f, 0x02, 0xf1,
+0x01, 0x00, 0xcb, 0x01, 0x00, 0xad, 0x01, 0x00, 0xab, 0x01, 0x00, 0x00, 0xf1, 0x02, 0x00, 0xcf,
+0x03, 0x00, 0x9d, 0x03, 0x00, 0xd7, 0x02, 0xe9, 0x01, 0x00, 0xd3, 0x01, 0x00, 0x97, 0x01, 0x00,
+0xfb, 0x01, 0x00, 0x00, 0xfd, 0x03, 0x00, 0xf1, 0x04, 0x00, 0xef, 0x04, 0x00, 0x8b, 0x04, 0xa1,
+0x02, 0x00, 0x87, 0x02, 0x00, 0xcd, 0x01, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x9b, 0x05, 0x00, 0xfd,
+0x05, 0x00, 0xe1, 0x05, 0x00, 0xe9, 0x04, 0xaf, 0x02, 0x00, 0xd7, 0x01, 0x00, 0xcd, 0x01, 0x00,
+0xa3, 0x01, 0x00, 0x00, 0x89, 0x06, 0x00, 0xdf, 0x06, 0x00, 0xd3, 0x06, 0x00, 0xe7, 0x05, 0xa3,
+0x01, 0x00, 0xa3, 0x01, 0x00, 0x2b, 0x00, 0x83, 0x01, 0x00, 0x00, 0xab, 0x07, 0x00, 0x9d, 0x07,
+0x00, 0xf7, 0x06, 0x00, 0x95, 0x07, 0x37, 0x00, 0x30, 0x00, 0x13, 0x00, 0x61, 0x00, 0x00, 0xb1,
+0x08, 0x00, 0x95, 0x08, 0x00, 0xcb, 0x07, 0x00, 0x89, 0x08, 0x31, 0x00, 0x14, 0x00, 0x0e, 0x00,
+0x55, 0x00, 0x00, 0x89, 0x09, 0x00, 0x81, 0x09, 0x00, 0xfb, 0x08, 0x00, 0xc9, 0x08, 0x87, 0x01,
+0x00, 0x47, 0x00, 0x4d, 0x00, 0x73, 0x00, 0x00, 0xb1, 0x09, 0x00, 0xa3, 0x0a, 0x00, 0xf9, 0x09,
+0x00, 0x99, 0x09, 0x99, 0x01, 0x00, 0x5d, 0x00, 0x49, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xc7, 0x0a,
+0x00, 0xdf, 0x0a, 0x00, 0xcb, 0x0a, 0x00, 0xd1, 0x0a, 0x91, 0x01, 0x00, 0x25, 0x00, 0x1b, 0x00,
+0x49, 0x00, 0x00, 0xa1, 0x0b, 0x00, 0xcb, 0x0b, 0x00, 0x95, 0x0b, 0x00, 0xeb, 0x0a, 0xe1, 0x01,
+0x00, 0x7b, 0x00, 0x41, 0x00, 0x7d, 0x00, 0x00, 0x85, 0x0c, 0x00, 0xb9, 0x0c, 0x00, 0x8f, 0x0c,
+0x00, 0xd1, 0x0b, 0xb3, 0x02, 0x00, 0xbd, 0x01, 0x00, 0x49, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xc5,
+0x0c, 0x00, 0xa9, 0x0d, 0x00, 0x81, 0x0d, 0x00, 0xf3, 0x0b, 0xad, 0x02, 0x00, 0xab, 0x01, 0x00,
+0x7f, 0x00, 0xeb, 0x01, 0x00, 0x00, 0xa7, 0x0d, 0x00, 0x83, 0x0e, 0x00, 0xb9, 0x0d, 0x00, 0xf9,
+0x0c, 0xc1, 0x01, 0x00, 0x85, 0x01, 0x00, 0x5d, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xcb, 0x0d, 0x00,
+0xd7, 0x0d, 0x00, 0xa5, 0x0d, 0x00, 0x93, 0x0d, 0x07, 0x00, 0x32, 0x00, 0x03, 0x00, 0x31, 0x00,
+0x00, 0xaf, 0x0d, 0x00, 0xc3, 0x0d, 0x00, 0xa3, 0x0d, 0x00, 0x95, 0x0d, 0x4f, 0x00, 0x12, 0x00,
+0x04, 0x00, 0x73, 0x00, 0x00, 0x83, 0x0e, 0x00, 0x8f, 0x0e, 0x00, 0xe7, 0x0d, 0x00, 0xe9, 0x0d,
+0xb1, 0x01, 0x00, 0x39, 0x00, 0x4f, 0x00, 0xab, 0x01, 0x00, 0x00, 0xa7, 0x0e, 0x00, 0x89, 0x0f,
+0x00, 0xff, 0x0e, 0x00, 0x83, 0x0e, 0xb7, 0x01, 0x00, 0x7f, 0x00, 0x47, 0x00, 0x91, 0x01, 0x00,
+0x00, 0xfd, 0x0e, 0x00, 0xdd, 0x0f, 0x00, 0xbd, 0x0f, 0x00, 0xd9, 0x0e, 0xef, 0x01, 0x00, 0x95,
+0x01, 0x00, 0x45, 0x00, 0xa3, 0x01, 0x00, 0x00, 0xa9, 0x0f, 0x00, 0x85, 0x10, 0x00, 0x89, 0x10,
+0x00, 0xb5, 0x0f, 0xfb, 0x01, 0x00, 0xb7, 0x01, 0x00, 0x85, 0x01, 0x00, 0xb3, 0x01, 0x00, 0x00,
+0xc9, 0x0f, 0x00, 0x9d, 0x10, 0x00, 0xef, 0x0f, 0x00, 0x9f, 0x0f, 0x93, 0x02, 0x00, 0xc1, 0x01,
+0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x89, 0x0f, 0x00, 0xa1, 0x10, 0x00, 0x95, 0x10,
+0x00, 0x8f, 0x0f, 0x99, 0x02, 0x00, 0xd7, 0x01, 0x00, 0x8f, 0x01, 0x00, 0xc1, 0x01, 0x00, 0x00,
+0xbf, 0x0f, 0x00, 0xc1, 0x10, 0x00, 0xb9, 0x10, 0x00, 0x81, 0x0f, 0xdb, 0x01, 0x00, 0x4f, 0x00,
+0x03, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x85, 0x10, 0x00, 0xc5, 0x10, 0x00, 0x93, 0x12, 0x00, 0x91,
+0x10, 0x54, 0x00, 0x6a, 0x00, 0x86, 0x01, 0x00, 0x42, 0x00, 0x00, 0x97, 0x10, 0x00, 0xef, 0x0f,
+0x00, 0x85, 0x0e, 0x00, 0xfb, 0x0f, 0xd6, 0x01, 0x00, 0x84, 0x02, 0x00, 0xa4, 0x01, 0x00, 0xa0,
+0x01, 0x00, 0x00, 0xbd, 0x10, 0x00, 0x91, 0x10, 0x00, 0xf9, 0x0f, 0x00, 0xcb, 0x10, 0x88, 0x01,
+0x00, 0xa4, 0x01, 0x00, 0x22, 0x00, 0x16, 0x00, 0x00, 0xd3, 0x10, 0x00, 0xf1, 0x10, 0x00, 0xd5,
+0x10, 0x00, 0xb3, 0x10, 0x27, 0x00, 0x50, 0x00, 0x7a, 0x00, 0xad, 0x02, 0x00, 0x00, 0xdf, 0x10,
+0x00, 0x9f, 0x11, 0x00, 0xaf, 0x11, 0x00, 0xd1, 0x10, 0x32, 0x00, 0x46, 0x00, 0xd2, 0x01, 0x00,
+0xbc, 0x03, 0x00, 0x00, 0xdb, 0x10, 0x00, 0xab, 0x11, 0x00, 0x99, 0x11, 0x00, 0xd3, 0x10, 0xcc,
+0x01, 0x00, 0xf4, 0x01, 0x00, 0xc8, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x89, 0x11, 0x00, 0xbf,
+0x10, 0x00, 0x9d, 0x10, 0x00, 0xed, 0x10, 0xa8, 0x02, 0x00, 0xfe, 0x02, 0x00, 0x8a, 0x03, 0x00,
+0xde, 0x02, 0x00, 0x00, 0xd7, 0x10, 0x00, 0x93, 0x10, 0x00, 0xa1, 0x10, 0x00, 0xdf, 0x10, 0x98,
+0x02, 0x00, 0xb8, 0x02, 0x00, 0xf8, 0x02, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xeb, 0x10, 0x00, 0xb5,
+0x10, 0x00, 0xa7, 0x10, 0x00, 0xc7, 0x10, 0x4c, 0x00, 0xba, 0x01, 0x00, 0xe8, 0x01, 0x00, 0xca,
+0x01, 0x00, 0x00, 0xe9, 0x10, 0x00, 0xdd, 0x10, 0x00, 0xd9, 0x10, 0x00, 0xdb, 0x10, 0x60, 0x00,
+0x64, 0x00, 0xbe, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xb7, 0x11, 0x00, 0x9b, 0x11, 0x00, 0xfd,
+0x10, 0x00, 0xa5, 0x11, 0x90, 0x02, 0x00, 0xc2, 0x01, 0x00, 0xc8, 0x01, 0x00, 0x8e, 0x01, 0x00,
+0x00, 0xbb, 0x11, 0x00, 0xc1, 0x11, 0x00, 0xad, 0x11, 0x00, 0xc7, 0x11, 0x1d, 0x00, 0x24, 0x00,
+0x44, 0x00, 0x0b, 0x00, 0x00, 0xa5, 0x11, 0x00, 0xe5, 0x11, 0x00, 0xb9, 0x11, 0x00, 0xa3, 0x11,
+0x57, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x49, 0x00, 0x00, 0x9f, 0x11, 0x00, 0xf5, 0x11, 0x00, 0xd7,
+0x11, 0x00, 0xd1, 0x10, 0x41, 0x00, 0x37, 0x00, 0x39, 0x00, 0x5f, 0x00, 0x00, 0x95, 0x11, 0x00,
+0xbf, 0x11, 0x00, 0xa7, 0x11, 0x00, 0xff, 0x10, 0x3f, 0x00, 0x51, 0x00, 0x31, 0x00, 0x41, 0x00,
+0x00, 0xbd, 0x11, 0x00, 0xa9, 0x11, 0x00, 0xfb, 0x10, 0x00, 0xff, 0x10, 0x2d, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x09, 0x00, 0x00, 0xef, 0x10, 0x00, 0x8f, 0x11, 0x00, 0xcf, 0x10, 0x00, 0xd1, 0x10,
+0x39, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x31, 0x00, 0x00, 0xd3, 0x10, 0x00, 0xc7, 0x10, 0x00, 0xb5,
+0x10, 0x00, 0xfb, 0x0f, 0xbd, 0x01, 0x00, 0x9d, 0x01, 0x00, 0x4b, 0x00, 0x73, 0x00, 0x00, 0xc9,
+0x0f, 0x00, 0xbb, 0x10, 0x00, 0xf5, 0x0f, 0x00, 0xa5, 0x0f, 0xd5, 0x01, 0x00, 0xcf, 0x01, 0x00,
+0x6b, 0x00, 0x87, 0x01, 0x00, 0x00, 0x99, 0x0f, 0x00, 0x85, 0x10, 0x00, 0xb9, 0x0f, 0x00, 0xbd,
+0x0e, 0xbb, 0x01, 0x00, 0x97, 0x01, 0x00, 0x53, 0x00, 0xa3, 0x01, 0x00, 0x00, 0xd9, 0x0e, 0x00,
+0xa3, 0x0f, 0x00, 0xed, 0x0e, 0x00, 0xb3, 0x0e, 0x59, 0x00, 0x43, 0x00, 0x11, 0x00, 0x15, 0x00,
+0x00, 0xab, 0x0e, 0x00, 0xbd, 0x0e, 0x00, 0xf1, 0x0d, 0x00, 0xb7, 0x0d, 0x16, 0x00, 0x28, 0x00,
+0x2c, 0x00, 0x09, 0x00, 0x00, 0x8d, 0x0d, 0x00, 0xad, 0x0d, 0x00, 0xeb, 0x0c, 0x00, 0xcd, 0x0c,
+0x36, 0x00, 0x46, 0x00, 0x62, 0x00, 0x46, 0x00, 0x00, 0xad, 0x0c, 0x00, 0xbf, 0x0c, 0x00, 0x8b,
+0x0c, 0x00, 0xfb, 0x0b, 0x72, 0x00, 0x84, 0x01, 0x00, 0x7e, 0x00, 0x76, 0x00, 0x00, 0xab, 0x0c,
+0x00, 0xcb, 0x0b, 0x00, 0x8d, 0x0b, 0x00, 0xe1, 0x0b, 0xa4, 0x01, 0x00, 0xc2, 0x01, 0x00, 0xa8,
+0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x01, 0xdb, 0x17, 0x9c, 0x01, 0xb9, 0x17, 0x82, 0x01, 0xa7,
+0x16, 0x8a, 0x01, 0xcd, 0x16, 0x62, 0x00, 0x78, 0x00, 0x98, 0x01, 0x00, 0x58, 0x00, 0x00, 0xf9,
+0x0a, 0x00, 0xb1, 0x0b, 0x00, 0x87, 0x0b, 0x00, 0xb3, 0x0a, 0x74, 0x00, 0xae, 0x01, 0x00, 0xc0,
+0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0xe5, 0x0a, 0x00, 0xa7, 0x0b, 0x00, 0xc9, 0x0a, 0x00, 0xa5,
+0x0a, 0xdc, 0x01, 0x00, 0xf6, 0x01, 0x00, 0xfa, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x00, 0x93, 0x0b,
+0x00, 0xe7, 0x0a, 0x00, 0xa7, 0x0a, 0x00, 0xbd, 0x0a, 0xa8, 0x02, 0x00, 0xc2, 0x02, 0x00, 0x88,
+0x02, 0x00, 0xe8, 0x01, 0x00, 0x00, 0xeb, 0x0b, 0x00, 0x97, 0x0b, 0x00, 0xa1, 0x0a, 0x00, 0x83,
+0x0b, 0xbc, 0x02, 0x00, 0xd8, 0x02, 0x00, 0xbc, 0x02, 0x00, 0xfa, 0x01, 0x00, 0x00, 0x95, 0x0c,
+0x00, 0xa5, 0x0b, 0x00, 0x9b, 0x0a, 0x00, 0xa3, 0x0b, 0xca, 0x02, 0x00, 0xc6, 0x02, 0x00, 0xa0,
+0x02, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0xfb, 0x0a, 0x00, 0xa7, 0x0a, 0x00, 0x85,
+0x0b, 0xcc, 0x01, 0x00, 0xda, 0x01, 0x00, 0xe2, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x89, 0x0b,
+0x00, 0xfb, 0x0a, 0x00, 0xad, 0x0a, 0x00, 0xbd, 0x0a, 0x36, 0x00, 0x72, 0x00, 0x72, 0x00, 0x42,
+0x00, 0x00, 0xc3, 0x0a, 0x00, 0xf5, 0x0a, 0x00, 0xcd, 0x0a, 0x00, 0xf7, 0x09, 0x02, 0x00, 0x34,
+0x00, 0x64, 0x00, 0x44, 0x00, 0x00, 0x8b, 0x0a, 0x00, 0xd5, 0x0a, 0x00, 0x85, 0x0a, 0x00, 0xcd,
+0x09, 0x05, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x0e, 0x00, 0x00, 0xcd, 0x0a, 0x00, 0xb9, 0x0a, 0x00,
+0xcd, 0x09, 0x00, 0xf7, 0x09, 0x2e, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x9f, 0x0a,
+0x00, 0x87, 0x0a, 0x00, 0xb1, 0x09, 0x00, 0xa3, 0x09, 0x53, 0x00, 0x31, 0x00, 0x13, 0x00, 0x37,
+0x00, 0x00, 0xc7, 0x09, 0x00, 0x8b, 0x0a, 0x00, 0xd9, 0x09, 0x00, 0xb5, 0x09, 0xaf, 0x01, 0x00,
+0x67, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x00, 0x8d, 0x09, 0x00, 0x8d, 0x0a, 0x00, 0xcd, 0x09, 0x00,
+0xcf, 0x08, 0x41, 0x00, 0x4b, 0x00, 0x11, 0x00, 0x4d, 0x00, 0x00, 0xa5, 0x09, 0x00, 0x8d, 0x0a,
+0x00, 0xbd, 0x09, 0x00, 0xc1, 0x08, 0x1b, 0x00, 0x2f, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0xa7,
+0x09, 0x00, 0xbf, 0x09, 0x00, 0x89, 0x09, 0x00, 0x95, 0x09, 0x0c, 0x00, 0x1c, 0x00, 0x09, 0x00,
+0x17, 0x00, 0x00, 0xc1, 0x09, 0x00, 0x89, 0x09, 0x00, 0xdb, 0x08, 0x00, 0xd3, 0x08, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x99,
+0x09, 0x67, 0xef, 0x08, 0x57, 0x9b, 0x08, 0x39, 0xf9, 0x08, 0x00, 0xbd, 0x08, 0x00, 0x8b, 0x09,
+0x00, 0xd3, 0x08, 0x00, 0xdd, 0x07, 0xdf, 0x01, 0x00, 0xcd, 0x01, 0x00, 0x83, 0x01, 0x00, 0x9d,
+0x01, 0x00, 0x00, 0xad, 0x07, 0x00, 0xb7, 0x08, 0x00, 0xdf, 0x07, 0x00, 0xd3, 0x06, 0x7f, 0x00,
+0x8d, 0x01, 0x00, 0x5f, 0x00, 0x5f, 0x00, 0x00, 0x95, 0x06, 0x00, 0xaf, 0x06, 0x00, 0xad, 0x06,
+0x00, 0x99, 0x06, 0x29, 0x00, 0x23, 0x00, 0x21, 0x00, 0x25, 0x00, 0x00, 0x89, 0x05, 0x00, 0xf9,
+0x04, 0x00, 0x83, 0x05, 0x00, 0xa5, 0x05, 0x06, 0x00, 0x05, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x00,
+0xad, 0x04, 0x00, 0xe3, 0x03, 0x00, 0xd1, 0x03, 0x00, 0x83, 0x04, 0x18, 0x00, 0x16, 0x00, 0x19,
+0x00, 0x0d, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x83, 0x03, 0x00, 0x85, 0x03, 0x00, 0xef, 0x03, 0x61,
+0x00, 0x49, 0x00, 0x47, 0x00, 0x5b, 0x00, 0x00, 0xf5, 0x02, 0x00, 0xa9, 0x03, 0x00, 0xa7, 0x03,
+0x00, 0x81, 0x03, 0xb5, 0x01, 0x00, 0x95, 0x01, 0x00, 0x67, 0x00, 0x67, 0x00, 0x00, 0xd9, 0x01,
+0x00, 0xdd, 0x02, 0x00, 0xb5, 0x02, 0x00, 0xd3, 0x01, 0x5b, 0x00, 0x77, 0x00, 0x4b, 0x00, 0x4f,
+0x00, 0x00, 0x4d, 0x00, 0x7f, 0x00, 0x8b, 0x01, 0x00, 0x5b, 0x18, 0x00, 0x18, 0x00, 0x14, 0x00,
+0x22, 0x00, 0x00, 0x46, 0x00, 0x5c, 0x00, 0x2c, 0x00, 0x38, 0x98, 0x01, 0x00, 0x9a, 0x01, 0x00,
+0x70, 0x00, 0x7c, 0x00, 0x00, 0xea, 0x01, 0x00, 0xa0, 0x02, 0x00, 0xfc, 0x01, 0x00, 0xca, 0x01,
+0xd6, 0x01, 0x00, 0xc6, 0x01, 0x00, 0x84, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x8c, 0x07, 0xc2,
+0x01, 0xaa, 0x08, 0x80, 0x01, 0xb0, 0x07, 0xb0, 0x01, 0x98, 0x06, 0x80, 0x01, 0x00, 0x92, 0x01,
+0x00, 0x5e, 0x00, 0x6c, 0x00, 0x00, 0x92, 0x05, 0x00, 0x8c, 0x05, 0x00, 0xca, 0x04, 0x00, 0xcc,
+0x04, 0x09, 0x00, 0x05, 0x00, 0x20, 0x00, 0x26, 0x00, 0x00, 0xfa, 0x05, 0x00, 0xa2, 0x05, 0x00,
+0xe0, 0x04, 0x00, 0xd6, 0x05, 0x21, 0x00, 0x1d, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0xc4, 0x06,
+0x00, 0x80, 0x06, 0x00, 0xc4, 0x05, 0x00, 0xee, 0x05, 0x30, 0x00, 0x20, 0x00, 0x16, 0x00, 0x03,
+0x00, 0x00, 0xd4, 0x06, 0x00, 0xd4, 0x06, 0x00, 0x8a, 0x06, 0x00, 0x9e, 0x06, 0x1c, 0x00, 0x20,
+0x00, 0x2c, 0x00, 0x44, 0x00, 0x00, 0x8c, 0x07, 0x00, 0x86, 0x07, 0x00, 0xc8, 0x06, 0x00, 0xc0,
+0x06, 0x2a, 0x00, 0x2e, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0xba, 0x07, 0x00, 0xca, 0x07, 0x00,
+0xf6, 0x06, 0x00, 0xf6, 0x06, 0x1c, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x00, 0xe2, 0x07,
+0x00, 0xf8, 0x07, 0x00, 0xaa, 0x07, 0x00, 0x9a, 0x07, 0x1f, 0x00, 0x29, 0x00, 0x2f, 0x00, 0x0f,
+0x00, 0x00, 0x96, 0x08, 0x00, 0xe6, 0x07, 0x00, 0xc0, 0x07, 0x00, 0xce, 0x07, 0x57, 0x00, 0x67,
+0x00, 0x3d, 0x00, 0x49, 0x00, 0x00, 0xd6, 0x08, 0x00, 0xb2, 0x08, 0x00, 0xe6, 0x07, 0x00, 0x9e,
+0x08, 0x75, 0x00, 0x5f, 0x00, 0x55, 0x00, 0x31, 0x00, 0x00, 0x9a, 0x09, 0x00, 0xdc, 0x08, 0x00,
+0x96, 0x08, 0x00, 0xaa, 0x08, 0x71, 0x00, 0x6d, 0x00, 0x63, 0x00, 0x43, 0x00, 0x00, 0xe4, 0x08,
+0x00, 0xfc, 0x08, 0x00, 0x9e, 0x08, 0x00, 0xb0, 0x08, 0x4b, 0x00, 0x47, 0x00, 0x51, 0x00, 0x3b,
+0x00, 0x00, 0x92, 0x09, 0x00, 0x94, 0x09, 0x00, 0xe2, 0x08, 0x00, 0xec, 0x08, 0x33, 0x00, 0x3d,
+0x00, 0x2f, 0x00, 0x29, 0x00, 0x00, 0xa4, 0x09, 0x00, 0xa8, 0x09, 0x00, 0xde, 0x08, 0x00, 0xca,
+0x08, 0x4d, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x3f, 0x00, 0x00, 0x90, 0x09, 0x00, 0xa0, 0x09, 0x00,
+0xd6, 0x08, 0x00, 0xca, 0x08, 0x1f, 0x00, 0x43, 0x00, 0x41, 0x00, 0x2f, 0x00, 0x00, 0xb2, 0x09,
+0x00, 0x9e, 0x09, 0x00, 0xf8, 0x08, 0x00, 0xee, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xbc, 0x09, 0x57, 0xbc, 0x09, 0x83,
+0x01, 0xd8, 0x08, 0x77, 0xf0, 0x08, 0x00, 0xa0, 0x09, 0x00, 0xc8, 0x09, 0x00, 0x9c, 0x09, 0x00,
+0x82, 0x09, 0x29, 0x00, 0x23, 0x00, 0x27, 0x00, 0x33, 0x00, 0x00, 0xac, 0x09, 0x00, 0xc2, 0x09,
+0x00, 0x86, 0x09, 0x00, 0xfa, 0x08, 0x12, 0x00, 0x12, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x00, 0xa4,
+0x09, 0x00, 0xca, 0x09, 0x00, 0xa6, 0x09, 0x00, 0xda, 0x08, 0x0c, 0x00, 0x32, 0x00, 0x05, 0x00,
+0x15, 0x00, 0x00, 0x98, 0x09, 0x00, 0xee, 0x09, 0x00, 0xd6, 0x09, 0x00, 0xf4, 0x08, 0x4c, 0x00,
+0x3a, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0xbc, 0x09, 0x00, 0xfe, 0x09, 0x00, 0xae, 0x09, 0x00,
+0xdc, 0x08, 0x5a, 0x00, 0x42, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0xa2, 0x09, 0x00, 0xe2, 0x09,
+0x00, 0xd0, 0x09, 0x00, 0xfe, 0x08, 0x3e, 0x00, 0x44, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x00, 0xac,
+0x09, 0x00, 0xee, 0x09, 0x00, 0xae, 0x09, 0x00, 0x8c, 0x09, 0x40, 0x00, 0x2c, 0x00, 0x16, 0x00,
+0x16, 0x00, 0x00, 0xa6, 0x09, 0x00, 0xdc, 0x09, 0x00, 0xb0, 0x09, 0x00, 0xb0, 0x09, 0x3c, 0x00,
+0x3a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0xb2, 0x09, 0x00, 0xea, 0x09, 0x00, 0xd4, 0x09, 0x00,
+0xf2, 0x08, 0x58, 0x00, 0x68, 0x00, 0x38, 0x00, 0x56, 0x00, 0x00, 0x8a, 0x09, 0x00, 0xe4, 0x09,
+0x00, 0xf4, 0x09, 0x00, 0xf0, 0x08, 0x72, 0x00, 0x7a, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x00, 0x98,
+0x09, 0x00, 0x90, 0x0a, 0x00, 0xc4, 0x09, 0x00, 0xf0, 0x08, 0x50, 0x00, 0x2a, 0x00, 0x08, 0x00,
+0x18, 0x00, 0x00, 0x8c, 0x09, 0x00, 0xd4, 0x09, 0x00, 0xc6, 0x09, 0x00, 0xda, 0x08, 0x3c, 0x00,
+0x38, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x90, 0x09, 0x00, 0xb2, 0x09, 0x00, 0xfc, 0x08, 0x00,
+0x94, 0x09, 0x59, 0x00, 0x59, 0x00, 0x57, 0x00, 0x4d, 0x00, 0x00, 0xa2, 0x09, 0x00, 0xf6, 0x08,
+0x00, 0xe6, 0x08, 0x00, 0x86, 0x09, 0x6d, 0x00, 0x63, 0x00, 0x61, 0x00, 0x47, 0x00, 0x00, 0x9a,
+0x09, 0x00, 0x9e, 0x09, 0x00, 0xa0, 0x09, 0x00, 0xfa, 0x08, 0x0e, 0x00, 0x16, 0x00, 0x21, 0x00,
+0x02, 0x00, 0x00, 0xae, 0x08, 0x00, 0xac, 0x09, 0x00, 0xa4, 0x09, 0x00, 0x8a, 0x08, 0x42, 0x00,
+0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0xde, 0x08, 0x00, 0xb4, 0x09, 0x00, 0x96, 0x09, 0x00,
+0xc4, 0x08, 0x36, 0x00, 0x28, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x00, 0x90, 0x08, 0x00, 0xcc, 0x08,
+0x00, 0xc8, 0x08, 0x00, 0xfe, 0x07, 0x33, 0x00, 0x47, 0x00, 0x4d, 0x00, 0x2d, 0x00, 0x00, 0xfc,
+0x07, 0x00, 0x8a, 0x08, 0x00, 0xda, 0x07, 0x00, 0x80, 0x08, 0xa7, 0x01, 0x00, 0x9b, 0x01, 0x00,
+0x97, 0x01, 0x00, 0x7b, 0x00, 0x00, 0xe8, 0x07, 0x00, 0xd4, 0x07, 0x00, 0xdc, 0x07, 0x00, 0xd6,
+0x07, 0x85, 0x01, 0x00, 0x85, 0x01, 0x00, 0x6f, 0x00, 0x6f, 0x00, 0x00, 0xba, 0x07, 0x00, 0xc0,
+0x07, 0x00, 0xba, 0x07, 0x00, 0x8e, 0x07, 0x25, 0x00, 0x31, 0x00, 0x4d, 0x00, 0x51, 0x00, 0x00,
+0xee, 0x06, 0x00, 0xbe, 0x07, 0x00, 0xd8, 0x07, 0x00, 0x94, 0x07, 0x1d, 0x00, 0x07, 0x00, 0x61,
+0x00, 0x4d, 0x00, 0x00, 0xb0, 0x06, 0x00, 0xf8, 0x06, 0x00, 0xdc, 0x06, 0x00, 0xa0, 0x06, 0x37,
+0x00, 0x55, 0x00, 0x73, 0x00, 0x51, 0x00, 0x00, 0x88, 0x06, 0x00, 0xea, 0x05, 0x00, 0x8c, 0x06,
+0x00, 0x82, 0x06, 0x97, 0x01, 0x00, 0x99, 0x01, 0x00, 0x79, 0x00, 0x95, 0x01, 0x00, 0x00, 0xda,
+0x05, 0x00, 0xd6, 0x05, 0x00, 0xda, 0x05, 0x00, 0xe6, 0x05, 0x83, 0x01, 0x00, 0x8b, 0x01, 0x00,
+0x89, 0x01, 0x00, 0x69, 0x00, 0x00, 0xbe, 0x05, 0x00, 0xae, 0x05, 0x00, 0x9e, 0x05, 0x00, 0xb4,
+0x05, 0x5b, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x53, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x82, 0x05, 0x00,
+0xfe, 0x04, 0x00, 0xd8, 0x04, 0x33, 0x00, 0x23, 0x00, 0x45, 0x00, 0x47, 0x00, 0x00, 0x98, 0x04,
+0x00, 0xc8, 0x04, 0x00, 0xe0, 0x04, 0x00, 0xa6, 0x04, 0x13, 0x00, 0x1f, 0x00, 0x39, 0x00, 0x3d,
+0x00, 0x00, 0xbc, 0x03, 0x00, 0xe6, 0x03, 0x00, 0xe6, 0x03, 0x00, 0xba, 0x03, 0x3f, 0x00, 0x3d,
+0x00, 0x49, 0x00, 0x4b, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x9a, 0x03, 0x00, 0x82, 0x03, 0x00, 0xfa,
+0x02, 0x49, 0x00, 0x63, 0x00, 0x55, 0x00, 0x45, 0x00, 0x00, 0xc6, 0x02, 0x00, 0xa4, 0x02, 0x00,
+0xac, 0x02, 0x00, 0xd0, 0x02, 0x39, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x4d, 0x00, 0x00, 0xd8, 0x01,
+0x00, 0xee, 0x01, 0x00, 0xf6, 0x01, 0x00, 0xd6, 0x01, 0x02, 0x00, 0x05, 0x00, 0x11, 0x00, 0x17,
+0x00, 0x00, 0x76, 0x00, 0x92, 0x01, 0x00, 0x9e, 0x01, 0x00, 0x76, 0x0a, 0x00, 0x18, 0x00, 0x0f,
+0x00, 0x0d, 0x00, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x1c, 0x13, 0x00, 0x01, 0x00, 0x09,
+0x00, 0x2b, 0x00, 0x00, 0x31, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x35, 0x10, 0x00, 0x13, 0x00, 0x11,
+0x00, 0x0c, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x6d, 0x00, 0x7d, 0x00, 0x79, 0x27, 0x00, 0x17, 0x00,
+0x33, 0x00, 0x3b, 0x00, 0x00, 0xaf, 0x01, 0x00, 0xa5, 0x01, 0x00, 0xa5, 0x01, 0x00, 0xbb, 0x01,
+0x6d, 0x00, 0x4b, 0x00, 0x43, 0x00, 0x45, 0x00, 0x00, 0xbf, 0x01, 0x00, 0xfb, 0x01, 0x00, 0xe3,
+0x01, 0x00, 0xa9, 0x01, 0x8b, 0x01, 0x00, 0x85, 0x01, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x00, 0xc9,
+0x01, 0x00, 0xf5, 0x01, 0x00, 0x81, 0x02, 0x00, 0xc5, 0x01, 0xa3, 0x01, 0x00, 0x8f, 0x01, 0x00,
+0x79, 0x00, 0x7b, 0x00, 0x00, 0xcb, 0x01, 0x00, 0xfb, 0x01, 0x00, 0xf3, 0x01, 0x00, 0xd1, 0x01,
+0x89, 0x01, 0x00, 0x5f, 0x00, 0x63, 0x00, 0x73, 0x00, 0x00, 0xfb, 0x01, 0x00, 0xfd, 0x01, 0x00,
+0xef, 0x01, 0x00, 0xed, 0x01, 0x6b, 0x00, 0x73, 0x00, 0x67, 0x00, 0x65, 0x00, 0x00, 0xc3, 0x01,
+0x00, 0xef, 0x01, 0x00, 0xed, 0x01, 0x00, 0xcb, 0x01, 0x6b, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x87,
+0x01, 0x00, 0x00, 0xbd, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xc7, 0x01, 0x71, 0x00,
+0x73, 0x00, 0x5b, 0x00, 0x47, 0x00, 0x00, 0xa9, 0x01, 0x00, 0xc9, 0x01, 0x00, 0xc7, 0x01, 0x00,
+0xb3, 0x01, 0x83, 0x01, 0x00, 0x5f, 0x00, 0x53, 0x00, 0x67, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x99,
+0x01, 0x00, 0xa9, 0x01, 0x00, 0x95, 0x01, 0x51, 0x00, 0x5f, 0x00, 0x4d, 0x00, 0x63, 0x00, 0x00,
+0x7b, 0x00, 0x91, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x97, 0x01, 0x43, 0x00, 0x4d, 0x00, 0x4d, 0x00,
+0x57, 0x00, 0x00, 0x4b, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4d, 0x7d, 0x00, 0x71, 0x00, 0x75, 0x00,
+0x5f, 0x00, 0x00, 0x11, 0x00, 0x31, 0x00, 0x41, 0x00, 0x00, 0x85, 0x01, 0x00, 0x9f, 0x01, 0x00,
+0x77, 0x00, 0x7b, 0x00, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x11, 0x00, 0x10, 0x57, 0x00, 0x55, 0x00,
+0x4f, 0x00, 0x55, 0x00, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x22, 0x00, 0x06, 0x13, 0x00, 0x19, 0x00,
+0x25, 0x00, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x66, 0x00, 0x48, 0x00, 0x20, 0x06, 0x00, 0x0b, 0x00,
+0x45, 0x00, 0x25, 0x00, 0x00, 0x26, 0x00, 0x56, 0x00, 0x54, 0x00, 0x18, 0x07, 0x00, 0x2b, 0x00,
+0x3f, 0x00, 0x37, 0x00, 0x00, 0x54, 0x00, 0x7e, 0x00, 0x66, 0x00, 0x0c, 0x37, 0x00, 0x5b, 0x00,
+0x7b, 0x00, 0x3f, 0x00, 0x00, 0x4a, 0x00, 0x72, 0x00, 0x5c, 0x00, 0x66, 0x3f, 0x00, 0x6f, 0x00,
+0x7b, 0x00, 0x51, 0x00, 0x00, 0x32, 0x00, 0x5a, 0x00, 0x40, 0x00, 0x06, 0x4b, 0x00, 0x93, 0x01,
+0x00, 0xb1, 0x01, 0x00, 0x71, 0x00, 0x00, 0x1c, 0x00, 0x34, 0x00, 0x28, 0x00, 0x08, 0x41, 0x00,
+0x7f, 0x00, 0x8b, 0x01, 0x00, 0x51, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x00, 0x1c, 0x00, 0x35, 0x23,
+0x00, 0x6b, 0x00, 0x97, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x0b, 0x00, 0x44, 0x00, 0x14, 0x00, 0x35,
+0x25, 0x00, 0x6d, 0x00, 0xb7, 0x01, 0x00, 0x57, 0x00, 0x00, 0x15, 0x00, 0x3e, 0x00, 0x18, 0x00,
+0x3b, 0x63, 0x00, 0xab, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x83, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x48,
+0x00, 0x06, 0x00, 0x1b, 0x69, 0x00, 0xc7, 0x01, 0x00, 0xe7, 0x01, 0x00, 0x97, 0x01, 0x00, 0x00,
+0x0c, 0x00, 0x38, 0x00, 0x1e, 0x00, 0x59, 0x93, 0x01, 0x00, 0x89, 0x02, 0x00, 0xa5, 0x02, 0x00,
+0xb5, 0x01, 0x00, 0x00, 0x26, 0x00, 0x4e, 0x00, 0x0f, 0x00, 0x11, 0xd9, 0x01, 0x00, 0xdd, 0x02,
+0x00, 0xd3, 0x02, 0x00, 0xdb, 0x01, 0x00, 0x00, 0x36, 0x00, 0x5a, 0x00, 0x0a, 0x00, 0x13, 0xbf,
+0x01, 0x00, 0xcd, 0x02, 0x00, 0x83, 0x03, 0x00, 0xf5, 0x01, 0x00, 0x00, 0x12, 0x00, 0x5c, 0x00,
+0x04, 0x00, 0x57, 0xd5, 0x01, 0x00, 0xd3, 0x02, 0x00, 0xfb, 0x02, 0x00, 0xf5, 0x01, 0x00, 0x00,
+0x0f, 0x00, 0x56, 0x00, 0x05, 0x00, 0x67, 0xc5, 0x01, 0x00, 0xc7, 0x02, 0x00, 0x8b, 0x03, 0x00,
+0x97, 0x02, 0x00, 0x00, 0x11, 0x00, 0x54, 0x00, 0x0c, 0x00, 0xe1, 0x01, 0xab, 0x02, 0x00, 0xbb,
+0x03, 0x00, 0xe7, 0x03, 0x00, 0xdf, 0x02, 0x00, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x10,
+0xbb, 0x03, 0x00, 0xb9, 0x04, 0x00, 0xb5, 0x04, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x13,
+0x00, 0x65, 0x00, 0x2f, 0x89, 0x04, 0x00, 0xad, 0x05, 0x00, 0xef, 0x04, 0x00, 0xc9, 0x03, 0x00,
+0x00, 0x17, 0x00, 0x21, 0x00, 0x83, 0x01, 0x00, 0x7d, 0xa9, 0x04, 0x00, 0xab, 0x05, 0x00, 0xa3,
+0x05, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x0d, 0x00, 0x67, 0x00, 0x3d, 0xb1, 0x04, 0x00,
+0xb3, 0x05, 0x00, 0xb5, 0x05, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x4d, 0x00,
+0x4d, 0xa9, 0x03, 0x00, 0xbf, 0x04, 0x00, 0xfb, 0x04, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x09, 0x00,
+0x24, 0x00, 0x59, 0x00, 0x77, 0x97, 0x03, 0x00, 0xe9, 0x04, 0x00, 0xf9, 0x04, 0x00, 0xbd, 0x03,
+0x00, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x55, 0x00, 0x8f, 0x01, 0xfb, 0x03, 0x00, 0x9b, 0x05, 0x00,
+0x9b, 0x05, 0x00, 0x8d, 0x04, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x75, 0x00, 0x23, 0xb7, 0x04,
+0x00, 0xef, 0x05, 0x00, 0xf1, 0x05, 0x00, 0xc1, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x2f, 0x00, 0x91,
+0x01, 0x00, 0x31, 0xf5, 0x04, 0x00, 0xcb, 0x06, 0x00, 0x8d, 0x06, 0x00, 0xd5, 0x04, 0x00, 0x00,
+0x5a, 0x00, 0x47, 0x00, 0x9b, 0x01, 0x00, 0x10, 0x95, 0x05, 0x00, 0xb3, 0x06, 0x00, 0x99, 0x06,
+0x00, 0xbf, 0x04, 0x00, 0x00, 0x5a, 0x00, 0x11, 0x00, 0x97, 0x01, 0x00, 0x00, 0xe1, 0x04, 0x00,
+0x8d, 0x06, 0x00, 0xdb, 0x05, 0x00, 0xff, 0x03, 0x00, 0x00, 0x64, 0x00, 0x16, 0x00, 0x53, 0x00,
+0x11, 0xbd, 0x03, 0x00, 0xb1, 0x05, 0x00, 0xb5, 0x05, 0x00, 0xd7, 0x03, 0x00, 0x00, 0x3e, 0x00,
+0x5e, 0x00, 0x45, 0x00, 0x43, 0xdf, 0x02, 0x00, 0xd5, 0x04, 0x00, 0x91, 0x05, 0x00, 0x87, 0x08,
+0x00, 0x00, 0x08, 0x00, 0x62, 0x00, 0x55, 0x00, 0xbb, 0x01, 0xcb, 0x06, 0x00, 0xd9, 0x04, 0x00,
+0x8b, 0x05, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x85, 0x01, 0x00, 0x95, 0x01,
+0xf5, 0x01, 0x00, 0x87, 0x06, 0x00, 0xf5, 0x05, 0x00, 0xff, 0x01, 0x00, 0x00, 0x04, 0x00, 0x77,
+0x00, 0xe9, 0x01, 0x00, 0x9d, 0x01, 0xe7, 0x04, 0x00, 0xe5, 0x07, 0x00, 0xf7, 0x06, 0x00, 0x97,
+0x04, 0x00, 0x00, 0x05, 0x00, 0xa5, 0x01, 0x00, 0xff, 0x02, 0x00, 0x8f, 0x01, 0xd7, 0x05, 0x00,
+0xe9, 0x07, 0x00, 0xa1, 0x07, 0x00, 0x8f, 0x05, 0x00, 0x00, 0x79, 0x00, 0xf7, 0x01, 0x00, 0x87,
+0x03, 0x00, 0xf7, 0x01, 0xd1, 0x04, 0x00, 0x8d, 0x07, 0x00, 0xe7, 0x06, 0x00, 0xbf, 0x04, 0x00,
+0x00, 0xb7, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xf7, 0x02, 0x00, 0xdd, 0x02, 0xff, 0x03, 0x00, 0x8b,
+0x06, 0x00, 0x97, 0x06, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xf7, 0x01, 0x00, 0xab, 0x01, 0x00, 0x89,
+0x03, 0x00, 0xed, 0x03, 0xeb, 0x03, 0x00, 0x85, 0x06, 0x00, 0x95, 0x06, 0x00, 0xe1, 0x03, 0x00,
+0x00, 0xa7, 0x02, 0x00, 0x97, 0x02, 0x00, 0xb7, 0x03, 0x00, 0xa1, 0x03, 0xe7, 0x04, 0x00, 0xe1,
+0x06, 0x00, 0xd1, 0x06, 0x00, 0xd3, 0x04, 0x00, 0x00, 0x83, 0x02, 0x00, 0xe1, 0x02, 0x00, 0x8f,
+0x04, 0x00, 0xb1, 0x03, 0x95, 0x06, 0x00, 0xd3, 0x07, 0x00, 0x9b, 0x07, 0x00, 0xe5, 0x04, 0x00,
+0x00, 0xe9, 0x01, 0x00, 0x9f, 0x03, 0x00, 0xa7, 0x04, 0x00, 0xef, 0x02, 0x95, 0x05, 0x00, 0xef,
+0x07, 0x00, 0x8b, 0x07, 0x00, 0x97, 0x05, 0x00, 0x00, 0xf5, 0x01, 0x00, 0xc3, 0x02, 0x00, 0xd7,
+0x03, 0x00, 0xf1, 0x02, 0xf5, 0x04, 0x00, 0xe5, 0x06, 0x00, 0xbf, 0x06, 0x00, 0x93, 0x05, 0x00,
+0x00, 0xff, 0x01, 0x00, 0x97, 0x02, 0x00, 0xaf, 0x03, 0x00, 0x8b, 0x03, 0xf5, 0x04, 0x00, 0xbb,
+0x06, 0x00, 0x8d, 0x06, 0x00, 0xc5, 0x04, 0x00, 0x00, 0xf5, 0x01, 0x00, 0xb9, 0x02, 0x00, 0xd5,
+0x03, 0x00, 0xf1, 0x02, 0xb1, 0x04, 0x00, 0xef, 0x05, 0x00, 0xc3, 0x05, 0x00, 0xf5, 0x03, 0x00,
+0x00, 0xf7, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xc5, 0x02, 0x00, 0xe3, 0x02, 0xbd, 0x04, 0x00, 0xeb,
+0x05, 0x00, 0xd3, 0x05, 0x00, 0x9b, 0x04, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x81, 0x02, 0x00, 0xf5,
+0x02, 0x00, 0x9f, 0x02, 0xf9, 0x03, 0x00, 0xa3, 0x05, 0x00, 0xed, 0x04, 0x00, 0xcb, 0x03, 0x00,
+0x00, 0xb5, 0x01, 0x00, 0x81, 0x02, 0x00, 0xe3, 0x02, 0x00, 0x83, 0x02, 0xc5, 0x04, 0x00, 0xfd,
+0x04, 0x00, 0xc9, 0x04, 0x00, 0xd7, 0x03, 0x00, 0x00, 0x99, 0x01, 0x00, 0xdb, 0x01, 0x00, 0xf9,
+0x01, 0x00, 0xd7, 0x01, 0xff, 0x02, 0x00, 0x99, 0x04, 0x00, 0xeb, 0x03, 0x00, 0x8f, 0x03, 0x00,
+0x00, 0x9d, 0x01, 0x00, 0x99, 0x01, 0x00, 0xdf, 0x01, 0x00, 0xe9, 0x01, 0xe9, 0x01, 0x00, 0x8d,
+0x03, 0x00, 0xa3, 0x03, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x99, 0x01, 0x00, 0x73, 0x00, 0xbd, 0x01,
+0x00, 0xff, 0x01, 0xc7, 0x01, 0x00, 0xb3, 0x02, 0x00, 0xc9, 0x02, 0x00, 0xbb, 0x01, 0x00, 0x00,
+0x99, 0x01, 0x00, 0x65, 0x00, 0x9f, 0x01, 0x00, 0xa5, 0x01, 0x85, 0x01, 0x00, 0xcb, 0x01, 0x00,
+0xef, 0x01, 0x00, 0xaf, 0x01, 0x00, 0x00, 0x67, 0x00, 0x59, 0x00, 0x85, 0x01, 0x00, 0xb7, 0x01,
+0x4f, 0x00, 0x7f, 0x00, 0xaf, 0x01, 0x00, 0x53, 0x00, 0x00, 0x7d, 0x00, 0x57, 0x00, 0x6f, 0x00,
+0xa3, 0x01, 0x17, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x41, 0x00, 0x00, 0x67, 0x00, 0x21, 0x00, 0x2f,
+0x00, 0x6f, 0x30, 0x00, 0x08, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x00, 0x4f, 0x00, 0x2d, 0x00, 0x3f,
+0x00, 0x59, 0x6e, 0x00, 0x54, 0x00, 0x2a, 0x00, 0x24, 0x00, 0x00, 0x3b, 0x00, 0x16, 0x00, 0x00,
+0x00, 0x41, 0x76, 0x00, 0x98, 0x01, 0x00, 0x66, 0x00, 0x64, 0x00, 0x00, 0x1f, 0x00, 0x26, 0x00,
+0x48, 0x00, 0x13, 0xf0, 0x01, 0x00, 0xa8, 0x02, 0x00, 0xf8, 0x01, 0x00, 0xcc, 0x01, 0x00, 0x00,
+0x0b, 0x00, 0x7a, 0x00, 0x9c, 0x01, 0x00, 0x04, 0xe4, 0x02, 0x00, 0xaa, 0x03, 0x00, 0xda, 0x02,
+0x00, 0x8a, 0x02, 0x00, 0x00, 0x22, 0x00, 0x8a, 0x01, 0x00, 0xba, 0x01, 0x00, 0x48, 0xb6, 0x02,
+0x00, 0x8c, 0x03, 0x00, 0xf4, 0x02, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x70, 0x00, 0x96, 0x01, 0x00,
+0x98, 0x01, 0x00, 0x78, 0x8c, 0x02, 0x00, 0xde, 0x02, 0x00, 0xc4, 0x02, 0x00, 0xfe, 0x01, 0x00,
+0x00, 0x94, 0x01, 0x00, 0x8e, 0x01, 0x00, 0xe2, 0x01, 0x00, 0xd4, 0x01, 0xf6, 0x01, 0x00, 0xe2,
+0x02, 0x00, 0xf8, 0x02, 0x00, 0xba, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0xda, 0x01, 0x00, 0x94,
+0x02, 0x00, 0x80, 0x02, 0xc2, 0x03, 0x00, 0x8a, 0x04, 0x00, 0xc0, 0x03, 0x00, 0xd8, 0x02, 0x00,
+0x00, 0xb4, 0x01, 0x00, 0x9e, 0x02, 0x00, 0xc6, 0x02, 0x00, 0xfc, 0x01, 0xe8, 0x03, 0x00, 0xe4,
+0x04, 0x00, 0xb4, 0x04, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x92, 0x02, 0x00, 0xe4, 0x02, 0x00, 0xb6,
+0x03, 0x00, 0xbe, 0x02, 0xd2, 0x03, 0x00, 0xe0, 0x04, 0x00, 0xd0, 0x04, 0x00, 0x9e, 0x03, 0x00,
+0x00, 0xc8, 0x02, 0x00, 0xce, 0x02, 0x00, 0xc8, 0x03, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x15, 0xb6, 0x0c,
+0xf0, 0x1d, 0xf0, 0x0c, 0xde, 0x1d, 0xe6, 0x10, 0xdc, 0x15, 0x82, 0x10, 0x00, 0xb0, 0x03, 0x00,
+0x8a, 0x03, 0x00, 0x90, 0x04, 0x00, 0xe0, 0x04, 0xe2, 0x03, 0x00, 0xbe, 0x05, 0x00, 0xfe, 0x05,
+0x00, 0x88, 0x04, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x8a, 0x03, 0x00, 0x8c, 0x04, 0x00, 0xf8, 0x04,
+0x8e, 0x04, 0x00, 0xe4, 0x05, 0x00, 0xb6, 0x06, 0x00, 0xb6, 0x04, 0x00, 0x00, 0xea, 0x02, 0x00,
+0xc6, 0x02, 0x00, 0x86, 0x04, 0x00, 0xd6, 0x03, 0x8a, 0x05, 0x00, 0x92, 0x07, 0x00, 0xf0, 0x06,
+0x00, 0xd0, 0x04, 0x00, 0x00, 0xf4, 0x01, 0x00, 0xba, 0x02, 0x00, 0xc4, 0x03, 0x00, 0xd8, 0x02,
+0xd4, 0x04, 0x00, 0xf4, 0x06, 0x00, 0xde, 0x06, 0x00, 0xd4, 0x04, 0x00, 0x00, 0xfc, 0x01, 0x00,
+0x86, 0x02, 0x00, 0x9a, 0x03, 0x00, 0xc2, 0x03, 0x8e, 0x04, 0x00, 0x8e, 0x06, 0x00, 0x96, 0x06,
+0x00, 0xa4, 0x04, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xac, 0x01, 0x00, 0xd8, 0x02, 0x00, 0x9e, 0x03,
+0xa4, 0x03, 0x00, 0x90, 0x05, 0x00, 0xf2, 0x05, 0x00, 0xe4, 0x03, 0x00, 0x00, 0xb8, 0x01, 0x00,
+0x62, 0x00, 0xfe, 0x01, 0x00, 0x82, 0x03, 0xec, 0x02, 0x00, 0xa0, 0x05, 0x00, 0xe6, 0x05, 0x00,
+0x80, 0x03, 0x00, 0x00, 0x82, 0x01, 0x00, 0x3a, 0x00, 0xd4, 0x01, 0x00, 0x90, 0x02, 0xa6, 0x02,
+0x00, 0x8e, 0x06, 0x00, 0xb6, 0x06, 0x00, 0xac, 0x02, 0x00, 0x00, 0x4e, 0x00, 0x08, 0x00, 0xb6,
+0x01, 0x00, 0x84, 0x02, 0xe4, 0x06, 0x00, 0x86, 0x06, 0x00, 0xa2, 0x06, 0x00, 0xae, 0x07, 0x00,
+0x00, 0x3c, 0x00, 0x50, 0x00, 0xd4, 0x01, 0x00, 0xb0, 0x01, 0xb0, 0x04, 0x00, 0xa2, 0x06, 0x00,
+0xba, 0x06, 0x00, 0xde, 0x04, 0x00, 0x00, 0x46, 0x00, 0x22, 0x00, 0xb6, 0x01, 0x00, 0xd2, 0x01,
+0xbe, 0x04, 0x00, 0x96, 0x06, 0x00, 0xbc, 0x06, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x04, 0x00, 0x1b,
+0x00, 0x7a, 0x00, 0x90, 0x01, 0xc4, 0x04, 0x00, 0xc2, 0x06, 0x00, 0xcc, 0x06, 0x00, 0xfc, 0x04,
+0x00, 0x00, 0x87, 0x01, 0x00, 0x5d, 0x00, 0x2e, 0x00, 0x1a, 0xb0, 0x05, 0x00, 0xe8, 0x06, 0x00,
+0xf2, 0x06, 0x00, 0x94, 0x05, 0x00, 0x00, 0x93, 0x01, 0x00, 0x61, 0x00, 0x28, 0x00, 0x0c, 0xc2,
+0x05, 0x00, 0xbe, 0x07, 0x00, 0xae, 0x07, 0x00, 0xba, 0x05, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x79,
+0x00, 0x1a, 0x00, 0x53, 0xa6, 0x06, 0x00, 0xf2, 0x07, 0x00, 0xc2, 0x07, 0x00, 0xea, 0x05, 0x00,
+0x00, 0xb3, 0x01, 0x00, 0x71, 0x00, 0x10, 0x00, 0x4f, 0xbc, 0x05, 0x00, 0xa4, 0x07, 0x00, 0xfa,
+0x06, 0x00, 0x8e, 0x05, 0x00, 0x00, 0x7b, 0x00, 0x95, 0x01, 0x00, 0x0d, 0x00, 0x08, 0x8c, 0x05,
+0x00, 0xb8, 0x06, 0x00, 0xe6, 0x06, 0x00, 0x90, 0x05, 0x00, 0x00, 0x93, 0x01, 0x00, 0x9d, 0x01,
+0x00, 0x33, 0x00, 0x3a, 0xa8, 0x05, 0x00, 0xe0, 0x06, 0x00, 0xec, 0x06, 0x00, 0xb2, 0x05, 0x00,
+0x00, 0x73, 0x00, 0x6f, 0x00, 0x0c, 0x00, 0x06, 0xe2, 0x05, 0x00, 0x8e, 0x07, 0x00, 0xf2, 0x06,
+0x00, 0x86, 0x05, 0x00, 0x00, 0x65, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x2b, 0x86, 0x06, 0x00, 0xc4,
+0x07, 0x00, 0x84, 0x07, 0x00, 0xe8, 0x05, 0x00, 0x00, 0x4f, 0x00, 0x0e, 0x00, 0x8a, 0x01, 0x00,
+0x02, 0xda, 0x05, 0x00, 0xac, 0x07, 0x00, 0xe6, 0x06, 0x00, 0xac, 0x05, 0x00, 0x00, 0x5d, 0x00,
+0x17, 0x00, 0x6c, 0x00, 0x26, 0xaa, 0x05, 0x00, 0xc4, 0x06, 0x00, 0x9c, 0x06, 0x00, 0x90, 0x05,
+0x00, 0x00, 0x61, 0x00, 0x29, 0x00, 0x40, 0x00, 0x02, 0xb8, 0x04, 0x00, 0xf4, 0x05, 0x00, 0xca,
+0x05, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x51, 0x00, 0x45, 0x00, 0x14, 0x00, 0x3a, 0xde, 0x03, 0x00,
+0x80, 0x05, 0x00, 0x94, 0x05, 0x00, 0xf2, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x12, 0x00,
+0x12, 0xd4, 0x03, 0x00, 0xc4, 0x04, 0x00, 0xb4, 0x04, 0x00, 0xce, 0x03, 0x00, 0x00, 0x75, 0x00,
+0x6f, 0x00, 0x0d, 0x00, 0x33, 0x9e, 0x03, 0x00, 0xf6, 0x03, 0x00, 0xfe, 0x03, 0x00, 0x80, 0x03,
+0x00, 0x00, 0x97, 0x01, 0x00, 0x9b, 0x01, 0x00, 0x49, 0x00, 0x45, 0xa2, 0x02, 0x00, 0xa0, 0x03,
+0x00, 0x9e, 0x03, 0x00, 0xac, 0x02, 0x00, 0x00, 0x97, 0x01, 0x00, 0xb7, 0x01, 0x00, 0x9f, 0x01,
+0x00, 0x65, 0xea, 0x01, 0x00, 0xae, 0x02, 0x00, 0xc8, 0x02, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xad,
+0x01, 0x00, 0xcf, 0x01, 0x00, 0x93, 0x01, 0x00, 0x6f, 0x96, 0x01, 0x00, 0xde, 0x01, 0x00, 0xf0,
+0x01, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0xb9, 0x01, 0x00, 0xb7, 0x01, 0x00, 0x6f,
+0x4a, 0x00, 0x7c, 0x00, 0xaa, 0x01, 0x00, 0x68, 0x00, 0x00, 0x97, 0x01, 0x00, 0xc9, 0x01, 0x00,
+0x9f, 0x01, 0x00, 0x75, 0x3c, 0x00, 0x5a, 0x00, 0x7e, 0x00, 0x5a, 0x00, 0x00, 0x95, 0x01, 0x00,
+0xb7, 0x01, 0x00, 0xa5, 0x01, 0x00, 0x7d, 0x38, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x26, 0x00, 0x00,
+0x71, 0x00, 0xad, 0x01, 0x00, 0xad, 0x01, 0x00, 0x77, 0x01, 0x00, 0x20, 0x00, 0x44, 0x00, 0x26,
+0x00, 0x00, 0x6d, 0x00, 0x7b, 0x00, 0x65, 0x00, 0x3f, 0x2c, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x20,
+0x00, 0x00, 0x43, 0x00, 0x71, 0x00, 0x69, 0x00, 0x5b, 0x26, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x40,
+0x00, 0x00, 0x35, 0x00, 0x29, 0x00, 0x4d, 0x00, 0x2b, 0x2c, 0x00, 0x24, 0x00, 0x18, 0x00, 0x38,
+0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0x17, 0x00, 0x23, 0x20, 0x00, 0x16, 0x00, 0x20, 0x00, 0x0e,
+0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x25, 0x00, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x05, 0x25, 0x00, 0x43, 0x00, 0x35, 0x00, 0x21,
+0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0f, 0x05, 0x00, 0x25, 0x00, 0x13, 0x00, 0x09,
+0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x1d, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x2f,
+0x00, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x0f, 0x00, 0x09, 0x27, 0x00, 0x2f, 0x00, 0x19, 0x00, 0x00,
+0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x0b, 0x25, 0x00, 0x3d, 0x00, 0x25, 0x00, 0x1d,
+0x00, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x27, 0x00, 0x21, 0x35, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x13,
+0x00, 0x00, 0x13, 0x00, 0x23, 0x00, 0x27, 0x00, 0x08, 0x09, 0x00, 0x15, 0x00, 0x09, 0x00, 0x11,
+0x00, 0x00, 0x11, 0x00, 0x15, 0x00, 0x0f, 0x00, 0x1f, 0x2a, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x28,
+0x00, 0x00, 0x25, 0x00, 0x21, 0x00, 0x27, 0x00, 0x35, 0x3a, 0x00, 0x34, 0x00, 0x26, 0x00, 0x28,
+0x00, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x1f, 0x2c, 0x00, 0x1a, 0x00, 0x12, 0x00, 0x16,
+0x00, 0x00, 0x1d, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x09, 0x07, 0x00, 0x04, 0x00, 0x18, 0x00, 0x2a,
+0x00, 0x00, 0x15, 0x00, 0x29, 0x00, 0x29, 0x00, 0x15, 0x0b, 0x00, 0x09, 0x00, 0x05, 0x00, 0x15,
+0x00, 0x00, 0x0b, 0x00, 0x2d, 0x00, 0x3f, 0x00, 0x29, 0x07, 0x00, 0x0f, 0x00, 0x02, 0x00, 0x14,
+0x00, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x0f, 0x00, 0x0e, 0x1e, 0x00, 0x14, 0x00, 0x14, 0x00, 0x1a,
+0x00, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x1f, 0x48, 0x00, 0x5a, 0x00, 0x3a, 0x00, 0x3a,
+0x00, 0x00, 0x12, 0x00, 0x36, 0x00, 0x20, 0x00, 0x16, 0x3e, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x30,
+0x00, 0x00, 0x2e, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x32, 0x2c, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x28,
+0x00, 0x00, 0x66, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x70, 0x6c, 0x00, 0x82, 0x01, 0x00, 0x8a, 0x01,
+0x00, 0x70, 0x00, 0x00, 0x8c, 0x01, 0x00, 0xba, 0x01, 0x00, 0xba, 0x01, 0x00, 0x9a, 0x01, 0xe0,
+0x01, 0x00, 0x84, 0x02, 0x00, 0xd0, 0x01, 0x00, 0xcc, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x8a,
+0x02, 0x00, 0x98, 0x02, 0x00, 0x9c, 0x01, 0xf2, 0x01, 0x00, 0xa8, 0x02, 0x00, 0xf2, 0x01, 0x00,
+0xcc, 0x01, 0x00, 0x00, 0xfa, 0x01, 0x00, 0xba, 0x02, 0x00, 0xc4, 0x02, 0x00, 0xa8, 0x02, 0xfa,
+0x01, 0x00, 0xbe, 0x02, 0x00, 0x96, 0x02, 0x00, 0xec, 0x01, 0x00, 0x00, 0xb8, 0x02, 0x00, 0xee,
+0x02, 0x00, 0xa8, 0x03, 0x00, 0xd8, 0x02, 0x92, 0x02, 0x00, 0xe2, 0x02, 0x00, 0xc4, 0x02, 0x00,
+0xfe, 0x01, 0x00, 0x00, 0x90, 0x03, 0x00, 0xb6, 0x03, 0x00, 0xf6, 0x03, 0x00, 0xa0, 0x03, 0xcc,
+0x02, 0x00, 0xae, 0x03, 0x00, 0x80, 0x03, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x90,
+0x04, 0x00, 0xcc, 0x04, 0x00, 0xf2, 0x03, 0x82, 0x03, 0x00, 0x80, 0x04, 0x00, 0xae, 0x03, 0x00,
+0xc4, 0x02, 0x00, 0x00, 0xec, 0x03, 0x00, 0xa2, 0x04, 0x00, 0xf8, 0x04, 0x00, 0xb6, 0x04, 0xd4,
+0x02, 0x00, 0xda, 0x03, 0x00, 0xb8, 0x03, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xa6, 0x04, 0x00, 0xaa,
+0x04, 0x00, 0x98, 0x05, 0x00, 0x92, 0x05, 0xf0, 0x02, 0x00, 0xe6, 0x03, 0x00, 0xd8, 0x03, 0x00,
+0xd6, 0x02, 0x00, 0x00, 0xb4, 0x04, 0x00, 0xd0, 0x04, 0x00, 0xae, 0x05, 0x00, 0xf8, 0x04, 0x94,
+0x03, 0x00, 0x92, 0x04, 0x00, 0x86, 0x04, 0x00, 0xca, 0x02, 0x00, 0x00, 0xa6, 0x04, 0x00, 0xe0,
+0x04, 0x00, 0xb8, 0x05, 0x00, 0x8c, 0x05, 0x80, 0x03, 0x00, 0xce, 0x04, 0x00, 0xb2, 0x04, 0x00,
+0xdc, 0x02, 0x00, 0x00, 0x8e, 0x04, 0x00, 0xa2, 0x04, 0x00, 0xb0, 0x05, 0x00, 0xf6, 0x04, 0x90,
+0x03, 0x00, 0xcc, 0x04, 0x00, 0x88, 0x04, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x9e,
+0x04, 0x00, 0xa2, 0x05, 0x00, 0xee, 0x04, 0xee, 0x02, 0x00, 0x8c, 0x04, 0x00, 0x9e, 0x04, 0x00,
+0xee, 0x02, 0x00, 0x00, 0xcc, 0x03, 0x00, 0xf0, 0x03, 0x00, 0xd6, 0x04, 0x00, 0xe4, 0x04, 0xb0,
+0x02, 0x00, 0xfe, 0x03, 0x00, 0xf0, 0x03, 0x00, 0xa2, 0x02, 0x00, 0x00, 0xd4, 0x03, 0x00, 0xa6,
+0x03, 0x00, 0xb8, 0x04, 0x00, 0xbc, 0x04, 0xa8, 0x02, 0x00, 0xe0, 0x03, 0x00, 0xe0, 0x03, 0x00,
+0xc8, 0x02, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x90, 0x03, 0x00, 0x84, 0x04, 0x00, 0x88, 0x04, 0x80,
+0x02, 0x00, 0xd4, 0x03, 0x00, 0xdc, 0x03, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x92, 0x03, 0x00, 0x82,
+0x03, 0x00, 0xe2, 0x03, 0x00, 0xa8, 0x04, 0xa0, 0x02, 0x00, 0xc0, 0x03, 0x00, 0xbc, 0x03, 0x00,
+0xa8, 0x02, 0x00, 0x00, 0x9a, 0x03, 0x00, 0xee, 0x02, 0x00, 0xfc, 0x03, 0x00, 0xfc, 0x03, 0xa0,
+0x02, 0x00, 0xc2, 0x03, 0x00, 0xc8, 0x03, 0x00, 0xee, 0x01, 0x00, 0x00, 0xaa, 0x03, 0x00, 0xfa,
+0x02, 0x00, 0xea, 0x03, 0x00, 0xa2, 0x04, 0xda, 0x01, 0x00, 0xb8, 0x02, 0x00, 0x82, 0x03, 0x00,
+0xa2, 0x02, 0x00, 0x00, 0xbe, 0x03, 0x00, 0xe2, 0x02, 0x00, 0xd2, 0x03, 0x00, 0xa4, 0x04, 0xfe,
+0x01, 0x00, 0x8a, 0x02, 0x00, 0xe6, 0x02, 0x00, 0x92, 0x02, 0x00, 0x00, 0xa8, 0x03, 0x00, 0xf0,
+0x02, 0x00, 0xda, 0x03, 0x00, 0xa4, 0x04, 0xe8, 0x01, 0x00, 0x92, 0x04, 0x00, 0x92, 0x03, 0x00,
+0x92, 0x02, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x80, 0x03, 0x00, 0xec, 0x03, 0x00, 0xfe, 0x03, 0xb6,
+0x02, 0x00, 0xc0, 0x03, 0x00, 0xde, 0x03, 0x00, 0x96, 0x02, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x88,
+0x03, 0x00, 0xe6, 0x03, 0x00, 0xa6, 0x03, 0xaa, 0x02, 0x00, 0xc6, 0x03, 0x00, 0xa6, 0x03, 0x00,
+0xaa, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00, 0xea, 0x02, 0x00, 0xbc, 0x03, 0x00, 0xbe, 0x03, 0xca,
+0x01, 0x00, 0xba, 0x02, 0x00, 0xdc, 0x02, 0x00, 0xea, 0x01, 0x00, 0x00, 0xdc, 0x02, 0x00, 0xa8,
+0x02, 0x00, 0xe6, 0x02, 0x00, 0xac, 0x03, 0x88, 0x01, 0x00, 0xe6, 0x01, 0x00, 0x8e, 0x02, 0x00,
+0xa6, 0x01, 0x00, 0x00, 0x9e, 0x02, 0x00, 0xe2, 0x01, 0x00, 0x9e, 0x02, 0x00, 0xf2, 0x02, 0x4c,
+0x00, 0xd4, 0x01, 0x00, 0xe2, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x94, 0x02, 0x00, 0xc8, 0x01,
+0x00, 0x98, 0x02, 0x00, 0xd8, 0x02, 0x4c, 0x00, 0xac, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x86, 0x01,
+0x00, 0x00, 0xe6, 0x01, 0x00, 0xba, 0x01, 0x00, 0x88, 0x02, 0x00, 0xb0, 0x02, 0x60, 0x00, 0xae,
+0x01, 0x00, 0xae, 0x01, 0x00, 0x64, 0x00, 0x00, 0xa0, 0x01, 0x00, 0xa4, 0x01, 0x00, 0xc8, 0x01,
+0x00, 0xe2, 0x01, 0x44, 0x00, 0x6a, 0x00, 0x88, 0x01, 0x00, 0x52, 0x00, 0x00, 0x9c, 0x01, 0x00,
+0x6e, 0x00, 0x96, 0x01, 0x00, 0xca, 0x01, 0x04, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x20, 0x00, 0x00,
+0x9c, 0x01, 0x00, 0x4a, 0x00, 0x88, 0x01, 0x00, 0xca, 0x01, 0x2f, 0x00, 0x06, 0x00, 0x44, 0x00,
+0x02, 0x00, 0x00, 0x92, 0x01, 0x00, 0x3a, 0x00, 0x4a, 0x00, 0xa2, 0x01, 0x37, 0x00, 0x1b, 0x00,
+0x22, 0x00, 0x13, 0x00, 0x00, 0x58, 0x00, 0x01, 0x00, 0x12, 0x00, 0x7a, 0x5b, 0x00, 0x15, 0x00,
+0x07, 0x00, 0x11, 0x00, 0x00, 0x2c, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x5a, 0x27, 0x00, 0x33, 0x00,
+0x0a, 0x00, 0x2b, 0x00, 0x00, 0x32, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x38, 0x13, 0x00, 0x00, 0x00,
+0x16, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x00, 0x03, 0x00, 0x10, 0x00, 0x2e, 0x21, 0x00, 0x06, 0x00,
+0x14, 0x00, 0x1d, 0x00, 0x00, 0x05, 0x00, 0x15, 0x00, 0x09, 0x00, 0x10, 0x1b, 0x00, 0x09, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x1b, 0x00, 0x14, 0x31, 0x00, 0x41, 0x00,
+0x17, 0x00, 0x1f, 0x00, 0x00, 0x08, 0x00, 0x2b, 0x00, 0x3d, 0x00, 0x07, 0x4f, 0x00, 0x45, 0x00,
+0x29, 0x00, 0x2f, 0x00, 0x00, 0x09, 0x00, 0x35, 0x00, 0x25, 0x00, 0x0f, 0x55, 0x00, 0x3b, 0x00,
+0x2b, 0x00, 0x21, 0x00, 0x00, 0x29, 0x00, 0x31, 0x00, 0x4f, 0x00, 0x1d, 0x49, 0x00, 0x5d, 0x00,
+0x49, 0x00, 0x55, 0x00, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x21, 0x73, 0x00, 0x7b, 0x00,
+0x79, 0x00, 0x63, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x0f, 0xcf, 0x01, 0x00, 0xd1,
+0x01, 0x00, 0x95, 0x01, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x2f, 0x00, 0x55, 0x00, 0x03,
+0xb7, 0x01, 0x00, 0xdb, 0x01, 0x00, 0xcb, 0x01, 0x00, 0xc5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x01, 0x22, 0x83,
+0x02, 0x21, 0xe3, 0x01, 0x7d, 0xb5, 0x01, 0x13, 0xd3, 0x01, 0x00, 0x91, 0x02, 0x00, 0x89, 0x02,
+0x00, 0xdb, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x07, 0x81, 0x02, 0x00, 0x9f,
+0x02, 0x00, 0x8b, 0x02, 0x00, 0xdf, 0x01, 0x00, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x35, 0x00, 0x03,
+0x97, 0x02, 0x00, 0xd3, 0x02, 0x00, 0xad, 0x02, 0x00, 0xfb, 0x01, 0x00, 0x00, 0x38, 0x00, 0x08,
+0x00, 0x25, 0x00, 0x0b, 0xad, 0x02, 0x00, 0x9b, 0x03, 0x00, 0xc9, 0x02, 0x00, 0x91, 0x02, 0x00,
+0x00, 0x42, 0x00, 0x02, 0x00, 0x21, 0x00, 0x1a, 0xe9, 0x02, 0x00, 0xf5, 0x02, 0x00, 0xfb, 0x02,
+0x00, 0x9b, 0x02, 0x00, 0x00, 0x64, 0x00, 0x38, 0x00, 0x11, 0x00, 0x0d, 0x8f, 0x02, 0x00, 0xbd,
+0x02, 0x00, 0xa3, 0x03, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x54, 0x00, 0x72, 0x00, 0x0a, 0x00, 0x18,
+0xd1, 0x01, 0x00, 0xdf, 0x02, 0x00, 0x97, 0x02, 0x00, 0xf3, 0x01, 0x00, 0x00, 0x6a, 0x00, 0x86,
+0x01, 0x00, 0x3c, 0x00, 0x0e, 0xd7, 0x01, 0x00, 0xb5, 0x02, 0x00, 0xbd, 0x02, 0x00, 0xcf, 0x01,
+0x00, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x10, 0x00, 0x03, 0xe3, 0x01, 0x00, 0xd3, 0x02, 0x00, 0xc1,
+0x02, 0x00, 0xd9, 0x01, 0x00, 0x00, 0x60, 0x00, 0x68, 0x00, 0x01, 0x00, 0x0f, 0xc9, 0x01, 0x00,
+0x83, 0x03, 0x00, 0xf5, 0x02, 0x00, 0x81, 0x02, 0x00, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x41, 0x00,
+0x41, 0x81, 0x02, 0x00, 0xbd, 0x03, 0x00, 0xa5, 0x03, 0x00, 0x87, 0x02, 0x00, 0x00, 0x1f, 0x00,
+0x17, 0x00, 0x71, 0x00, 0x8d, 0x01, 0xe9, 0x01, 0x00, 0xf7, 0x02, 0x00, 0x87, 0x03, 0x00, 0xeb,
+0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x3f, 0x00, 0xab, 0x01, 0x00, 0xe9, 0x01, 0xad, 0x01, 0x00,
+0xc9, 0x02, 0x00, 0x89, 0x03, 0x00, 0xe1, 0x01, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x5d, 0x00, 0xc5,
+0x01, 0x00, 0xb1, 0x02, 0xcb, 0x01, 0x00, 0xdf, 0x02, 0x00, 0x91, 0x03, 0x00, 0xed, 0x01, 0x00,
+0x00, 0xcd, 0x01, 0x00, 0x8d, 0x01, 0x00, 0xed, 0x01, 0x00, 0xaf, 0x02, 0xbd, 0x02, 0x00, 0xd1,
+0x03, 0x00, 0xd1, 0x03, 0x00, 0xc5, 0x02, 0x00, 0x00, 0xcb, 0x01, 0x00, 0xd5, 0x01, 0x00, 0xbd,
+0x02, 0x00, 0xad, 0x02, 0xef, 0x02, 0x00, 0x99, 0x04, 0x00, 0xef, 0x03, 0x00, 0xbb, 0x02, 0x00,
+0x00, 0xbd, 0x01, 0x00, 0xef, 0x01, 0x00, 0xe5, 0x02, 0x00, 0xbd, 0x02, 0x89, 0x03, 0x00, 0xb9,
+0x04, 0x00, 0xf9, 0x03, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x97, 0x02, 0x00, 0xbf, 0x02, 0x00, 0x8d,
+0x03, 0x00, 0x8f, 0x03, 0x9f, 0x02, 0x00, 0xf1, 0x03, 0x00, 0xe1, 0x03, 0x00, 0xbd, 0x02, 0x00,
+0x00, 0xb9, 0x02, 0x00, 0xeb, 0x01, 0x00, 0xf9, 0x02, 0x00, 0xa1, 0x03, 0xdd, 0x01, 0x00, 0x93,
+0x03, 0x00, 0xc7, 0x03, 0x00, 0xb9, 0x02, 0x00, 0x00, 0xeb, 0x02, 0x00, 0xd3, 0x02, 0x00, 0x97,
+0x03, 0x00, 0xc9, 0x03, 0xd9, 0x02, 0x00, 0xdf, 0x03, 0x00, 0xdb, 0x03, 0x00, 0xaf, 0x02, 0x00,
+0x00, 0xe7, 0x02, 0x00, 0x81, 0x03, 0x00, 0xe5, 0x03, 0x00, 0xc7, 0x03, 0x99, 0x03, 0x00, 0xa7,
+0x04, 0x00, 0x99, 0x04, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xd7, 0x02, 0x00, 0x85, 0x03, 0x00, 0xf3,
+0x03, 0x00, 0xb5, 0x03, 0xdb, 0x02, 0x00, 0xa3, 0x04, 0x00, 0x81, 0x04, 0x00, 0xdd, 0x02, 0x00,
+0x00, 0xe1, 0x02, 0x00, 0xfb, 0x02, 0x00, 0xeb, 0x03, 0x00, 0xb9, 0x03, 0xb9, 0x02, 0x00, 0xc9,
+0x03, 0x00, 0xd9, 0x03, 0x00, 0xc7, 0x02, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x93, 0x03, 0x00, 0xfd,
+0x03, 0x00, 0x8b, 0x04, 0x81, 0x02, 0x00, 0xc5, 0x03, 0x00, 0xb3, 0x03, 0x00, 0x8d, 0x02, 0x00,
+0x00, 0xb9, 0x03, 0x00, 0x89, 0x03, 0x00, 0x83, 0x04, 0x00, 0xa9, 0x04, 0xf3, 0x01, 0x00, 0xc7,
+0x03, 0x00, 0xaf, 0x03, 0x00, 0x8d, 0x02, 0x00, 0x00, 0xdd, 0x03, 0x00, 0xd5, 0x03, 0x00, 0xaf,
+0x04, 0x00, 0xaf, 0x04, 0xdb, 0x01, 0x00, 0xfd, 0x02, 0x00, 0x8d, 0x03, 0x00, 0xd3, 0x01, 0x00,
+0x00, 0xa3, 0x04, 0x00, 0xe1, 0x03, 0x00, 0xdb, 0x04, 0x00, 0xed, 0x04, 0xbd, 0x01, 0x00, 0xd7,
+0x02, 0x00, 0xdd, 0x02, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xb5, 0x04, 0x00, 0xa1, 0x04, 0x00, 0xfd,
+0x04, 0x00, 0x93, 0x05, 0x77, 0x00, 0xa9, 0x02, 0x00, 0xc5, 0x02, 0x00, 0x99, 0x01, 0x00, 0x00,
+0x99, 0x05, 0x00, 0xf7, 0x04, 0x00, 0xd9, 0x05, 0x00, 0xd5, 0x05, 0x19, 0x00, 0x9f, 0x01, 0x00,
+0xdd, 0x01, 0x00, 0x4d, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x87, 0x05, 0x00, 0xd3, 0x05, 0x00, 0xad,
+0x06, 0x05, 0x00, 0xa7, 0x01, 0x00, 0xe7, 0x01, 0x00, 0x3f, 0x00, 0x00, 0x85, 0x06, 0x00, 0xc7,
+0x05, 0x00, 0xa9, 0x06, 0x00, 0xf5, 0x06, 0x0c, 0x00, 0xad, 0x01, 0x00, 0xc1, 0x01, 0x00, 0x2f,
+0x00, 0x00, 0xb7, 0x06, 0x00, 0xf3, 0x05, 0x00, 0xcd, 0x06, 0x00, 0xe7, 0x06, 0x3a, 0x00, 0x5b,
+0x00, 0x6b, 0x00, 0x05, 0x00, 0x00, 0xd3, 0x06, 0x00, 0xa9, 0x06, 0x00, 0xc7, 0x06, 0x00, 0xfd,
+0x06, 0x70, 0x00, 0x0b, 0x00, 0x25, 0x00, 0x70, 0x00, 0x00, 0xf3, 0x06, 0x00, 0xad, 0x06, 0x00,
+0xe3, 0x06, 0x00, 0xc5, 0x07, 0x98, 0x01, 0x00, 0x2e, 0x00, 0x04, 0x00, 0x64, 0x00, 0x00, 0xeb,
+0x06, 0x00, 0x9d, 0x06, 0x00, 0xc1, 0x06, 0x00, 0xed, 0x06, 0xd4, 0x01, 0x00, 0x5a, 0x00, 0x1e,
+0x00, 0x80, 0x01, 0x00, 0x00, 0xe1, 0x06, 0x00, 0x93, 0x06, 0x00, 0xad, 0x06, 0x00, 0xf3, 0x06,
+0xa4, 0x01, 0x00, 0x6c, 0x00, 0x4e, 0x00, 0x94, 0x01, 0x00, 0x00, 0xe9, 0x05, 0x00, 0xd3, 0x05,
+0x00, 0xe1, 0x05, 0x00, 0x85, 0x06, 0xa8, 0x01, 0x00, 0x5e, 0x00, 0x5e, 0x00, 0x8e, 0x01, 0x00,
+0x00, 0xbf, 0x05, 0x00, 0xc9, 0x05, 0x00, 0xe1, 0x05, 0x00, 0xd3, 0x05, 0xb6, 0x01, 0x00, 0x7e,
+0x00, 0x7e, 0x00, 0x92, 0x01, 0x00, 0x00, 0xed, 0x04, 0x00, 0xf7, 0x04, 0x00, 0xf9, 0x04, 0x00,
+0xeb, 0x04, 0xe8, 0x01, 0x00, 0xba, 0x01, 0x00, 0x9c, 0x01, 0x00, 0xce, 0x01, 0x00, 0x00, 0xd1,
+0x04, 0x00, 0x91, 0x04, 0x00, 0xab, 0x04, 0x00, 0xcb, 0x04, 0xfc, 0x01, 0x00, 0xe4, 0x01, 0x00,
+0xe0, 0x01, 0x00, 0xca, 0x01, 0x00, 0x00, 0xd7, 0x03, 0x00, 0xb9, 0x03, 0x00, 0xd5, 0x03, 0x00,
+0xf3, 0x03, 0xf4, 0x01, 0x00, 0xe2, 0x01, 0x00, 0xdc, 0x01, 0x00, 0x80, 0x02, 0x00, 0x00, 0xc7,
+0x03, 0x00, 0xa3, 0x03, 0x00, 0x97, 0x03, 0x00, 0xbb, 0x03, 0xf2, 0x01, 0x00, 0xd0, 0x01, 0x00,
+0xc2, 0x01, 0x00, 0x84, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 0xb1, 0x02, 0x00, 0xb9, 0x02, 0x00,
+0xc9, 0x02, 0xb2, 0x01, 0x00, 0x9a, 0x01, 0x00, 0xa4, 0x01, 0x00, 0xc8, 0x01, 0x00, 0x00, 0xf7,
+0x01, 0x00, 0xb3, 0x02, 0x00, 0xad, 0x02, 0x00, 0x93, 0x02, 0x94, 0x01, 0x00, 0x64, 0x00, 0x90,
+0x01, 0x00, 0x9e, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0xc9, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x8b,
+0x01, 0x92, 0x01, 0x00, 0x84, 0x01, 0x00, 0x76, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x5b, 0x00, 0x53,
+0x00, 0x6f, 0x00, 0x55, 0xde, 0x01, 0x00, 0xf4, 0x01, 0x00, 0xca, 0x01, 0x00, 0xbc, 0x01, 0x00,
+0x00, 0x39, 0x00, 0x00, 0x00, 0x09, 0x00, 0x5b, 0xc2, 0x01, 0x00, 0xc2, 0x01, 0x00, 0xb8, 0x01,
+0x00, 0xb8, 0x01, 0x00, 0x00, 0x34, 0x00, 0x36, 0x00, 0x46, 0x00, 0x50, 0x90, 0x01, 0x00, 0x84,
+0x01, 0x00, 0x82, 0x01, 0x00, 0x7e, 0x00, 0x00, 0x7a, 0x00, 0x62, 0x00, 0x48, 0x00, 0x66, 0x74,
+0x00, 0x82, 0x01, 0x00, 0x74, 0x00, 0x84, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0xa6, 0x01, 0x00,
+0x9c, 0x01, 0x00, 0x96, 0x01, 0x7a, 0x00, 0x76, 0x00, 0x66, 0x00, 0x56, 0x00, 0x00, 0xae, 0x01,
+0x00, 0xb8, 0x01, 0x00, 0xb2, 0x01, 0x00, 0xc4, 0x01, 0x56, 0x00, 0x70, 0x00, 0x6a, 0x00, 0x54,
+0x00, 0x00, 0xc0, 0x01, 0x00, 0xda, 0x01, 0x00, 0xf6, 0x01, 0x00, 0xc2, 0x01, 0x30, 0x00, 0x48,
+0x00, 0x40, 0x00, 0x32, 0x00, 0x00, 0x84, 0x02, 0x00, 0xee, 0x01, 0x00, 0xe4, 0x01, 0x00, 0xf2,
+0x01, 0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x8c, 0x02, 0x00,
+0x86, 0x02, 0x00, 0xa2, 0x02, 0x35, 0x00, 0x0d, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x9a, 0x02,
+0x00, 0x92, 0x02, 0x00, 0x9a, 0x02, 0x00, 0xb4, 0x02, 0x45, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x83,
+0x01, 0x00, 0x00, 0xb8, 0x02, 0x00, 0xaa, 0x02, 0x00, 0xaa, 0x02, 0x00, 0x9e, 0x02, 0x63, 0x00,
+0x71, 0x00, 0x63, 0x00, 0x15, 0x00, 0x00, 0xf6, 0x02, 0x00, 0xb2, 0x02, 0x00, 0xc0, 0x02, 0x00,
+0xf2, 0x02, 0xdb, 0x01, 0x00, 0xc9, 0x01, 0x00, 0x9f, 0x01, 0x00, 0xc3, 0x01, 0x00, 0x00, 0xa0,
+0x03, 0x00, 0xca, 0x02, 0x00, 0xc2, 0x02, 0x00, 0xa8, 0x03, 0xe3, 0x02, 0x00, 0xe7, 0x02, 0x00,
+0x99, 0x02, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x94, 0x04, 0x00, 0xc0, 0x02, 0x00, 0xcc, 0x02, 0x00,
+0xd8, 0x03, 0xcd, 0x04, 0x00, 0xad, 0x04, 0x00, 0xf9, 0x02, 0x00, 0xb3, 0x03, 0x00, 0x00, 0x96,
+0x05, 0x00, 0x9e, 0x02, 0x00, 0xbc, 0x02, 0x00, 0xc6, 0x05, 0xeb, 0x06, 0x00, 0xb3, 0x06, 0x00,
+0x9d, 0x04, 0x00, 0xd3, 0x04, 0x00, 0x00, 0xa8, 0x06, 0x00, 0xc6, 0x02, 0x00, 0xc0, 0x02, 0x00,
+0xb6, 0x06, 0xf1, 0x07, 0x00, 0xb7, 0x07, 0x00, 0xf7, 0x04, 0x00, 0xf9, 0x04, 0x00, 0x00, 0xa2,
+0x07, 0x00, 0xa6, 0x03, 0x00, 0xb2, 0x03, 0x00, 0xa8, 0x07, 0x89, 0x08, 0x00, 0xb3, 0x07, 0x00,
+0x87, 0x05, 0x00, 0xfb, 0x05, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x84, 0x04, 0x00, 0xb0, 0x04, 0x00,
+0x8e, 0x08, 0xe7, 0x08, 0x00, 0x93, 0x08, 0x00, 0xe9, 0x05, 0x00, 0x87, 0x06, 0x00, 0x00, 0xb8,
+0x08, 0x00, 0xae, 0x04, 0x00, 0xda, 0x04, 0x00, 0xd6, 0x08, 0xb7, 0x0b, 0x00, 0xa9, 0x0a, 0x00,
+0x9b, 0x07, 0x00, 0xff, 0x08, 0x00, 0x00, 0xbe, 0x09, 0x00, 0x9a, 0x03, 0x00, 0xf0, 0x03, 0x00,
+0xd4, 0x09, 0x85, 0x10, 0x00, 0x8b, 0x0e, 0x00, 0xcd, 0x09, 0x00, 0xd9, 0x0a, 0x00, 0x00, 0xe4,
+0x09, 0x00, 0x6e, 0x00, 0xfa, 0x01, 0x00, 0x84, 0x0b, 0xfb, 0x14, 0x00, 0xfd, 0x11, 0x00, 0x87,
+0x0c, 0x00, 0xe1, 0x0e, 0x00, 0x00, 0xf0, 0x09, 0x00, 0x8d, 0x02, 0x00, 0x2f, 0x00, 0xd8, 0x0a,
+0xeb, 0x1a, 0x00, 0x8b, 0x15, 0x00, 0xc1, 0x0d, 0x00, 0xeb, 0x11, 0x00, 0x00, 0xbc, 0x08, 0x00,
+0xe3, 0x04, 0x00, 0xd5, 0x01, 0x00, 0x88, 0x0b, 0xb3, 0x1a, 0x00, 0xc7, 0x15, 0x00, 0xab, 0x0e,
+0x00, 0xbb, 0x13, 0x00, 0x00, 0xce, 0x06, 0x00, 0xb3, 0x05, 0x00, 0x8b, 0x02, 0x00, 0x9a, 0x0a,
+0xb7, 0x1a, 0x00, 0x93, 0x14, 0x00, 0x8d, 0x0e, 0x00, 0xe9, 0x13, 0x00, 0x00, 0x96, 0x05, 0x00,
+0xeb, 0x04, 0x00, 0xdb, 0x01, 0x00, 0xd0, 0x08, 0xb1, 0x19, 0x00, 0x81, 0x13, 0x00, 0xfd, 0x0d,
+0x00, 0xa5, 0x14, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x9d, 0x05, 0x00, 0xcd, 0x01, 0x00, 0xd0, 0x07,
+0xd9, 0x19, 0x00, 0xd3, 0x12, 0x00, 0xf5, 0x0d, 0x00, 0xd9, 0x14, 0x00, 0x00, 0x8e, 0x02, 0x00,
+0xfd, 0x06, 0x00, 0x83, 0x03, 0x00, 0xb0, 0x06, 0xab, 0x1c, 0x00, 0xf9, 0x12, 0x00, 0x83, 0x0e,
+0x00, 0xfd, 0x16, 0x00, 0x00, 0x27, 0x00, 0xa5, 0x0a, 0x00, 0x9b, 0x05, 0x00, 0xa0, 0x04, 0x8b,
+0x1e, 0x00, 0xe9, 0x12, 0x00, 0xc9, 0x0d, 0x00, 0xaf, 0x18, 0x00, 0x00, 0xed, 0x03, 0x00, 0xe3,
+0x0d, 0x00, 0xf5, 0x07, 0x00, 0x94, 0x02, 0xbf, 0x1e, 0x00, 0xe5, 0x11, 0x00, 0xeb, 0x0c, 0x00,
+0x99, 0x19, 0x00, 0x00, 0xcf, 0x07, 0x00, 0xfb, 0x10, 0x00, 0x9b, 0x0a, 0x00, 0x3d, 0x81, 0x1d,
+0x00, 0xd5, 0x10, 0x00, 0x93, 0x0c, 0x00, 0xd3, 0x18, 0x00, 0x00, 0x97, 0x0a, 0x00, 0xb7, 0x12,
+0x00, 0xcf, 0x0b, 0x00, 0xa3, 0x02, 0xbf, 0x1b, 0x00, 0xdb, 0x0e, 0x00, 0xa9, 0x0b, 0x00, 0xed,
+0x17, 0x00, 0x00, 0xeb, 0x0b, 0x00, 0xe7, 0x12, 0x00, 0xd5, 0x0b, 0x00, 0xb1, 0x04, 0xdd, 0x18,
+0x00, 0xc9, 0x0c, 0x00, 0x87, 0x0a, 0x00, 0xcd, 0x16, 0x00, 0x00, 0xbf, 0x0d, 0x00, 0x8f, 0x12,
+0x00, 0xbd, 0x0b, 0x00, 0xb7, 0x06, 0xa1, 0x17, 0x00, 0xa1, 0x0a, 0x00, 0x8b, 0x08, 0x00, 0xd5,
+0x15, 0x00, 0x00, 0xc7, 0x0f, 0x00, 0x9b, 0x13, 0x00, 0xaf, 0x0c, 0x00, 0xcd, 0x08, 0xe5, 0x15,
+0x00, 0xa3, 0x08, 0x00, 0xc1, 0x06, 0x00, 0xaf, 0x14, 0x00, 0x00, 0xb5, 0x12, 0x00, 0x89, 0x15,
+0x00, 0xf5, 0x0d, 0x00, 0xe7, 0x0a, 0xd3, 0x14, 0x00, 0xd5, 0x05, 0x00, 0x93, 0x04, 0x00, 0xc3,
+0x13, 0x00, 0x00, 0xcd, 0x16, 0x00, 0xeb, 0x17, 0x00, 0xe7, 0x0f, 0x00, 0xf5, 0x0d, 0xd7, 0x12,
+0x00, 0xb5, 0x02, 0x00, 0xb9, 0x01, 0x00, 0xfd, 0x11, 0x00, 0x00, 0xeb, 0x19, 0x00, 0xb9, 0x1a,
+0x00, 0x99, 0x11, 0x00, 0xdd, 0x10, 0x93, 0x10, 0x00, 0x5c, 0x00, 0x82, 0x01, 0x00, 0x91, 0x10,
+0x00, 0x00, 0xd7, 0x1b, 0x00, 0xcf, 0x1a, 0x00, 0x8f, 0x11, 0x00, 0xd3, 0x11, 0xa7, 0x0c, 0x00,
+0xec, 0x02, 0x00, 0xae, 0x02, 0x00, 0xbb, 0x0d, 0x00, 0x00, 0xd1, 0x1a, 0x00, 0xa5, 0x18, 0x00,
+0xf9, 0x0f, 0x00, 0xe1, 0x11, 0xb5, 0x09, 0x00, 0x86, 0x04, 0x00, 0xde, 0x02, 0x00, 0x9d, 0x0b,
+0x00, 0x00, 0x9d, 0x18, 0x00, 0xef, 0x14, 0x00, 0x81, 0x0e, 0x00, 0xa5, 0x11, 0xf3, 0x07, 0x00,
+0xb0, 0x04, 0x00, 0xda, 0x02, 0x00, 0xfb, 0x09, 0x00, 0x00, 0xf3, 0x16, 0x00, 0xf7, 0x11, 0x00,
+0xe7, 0x0b, 0x00, 0xb3, 0x10, 0x8d, 0x07, 0x00, 0x92, 0x04, 0x00, 0xcc, 0x02, 0x00, 0xc7, 0x08,
+0x00, 0x00, 0xf3, 0x14, 0x00, 0x91, 0x10, 0x00, 0xd7, 0x0a, 0x00, 0xb1, 0x0f, 0x83, 0x05, 0x00,
+0xc0, 0x03, 0x00, 0xbe, 0x01, 0x00, 0xd1, 0x07, 0x00, 0x00, 0xb5, 0x11, 0x00, 0x85, 0x0e, 0x00,
+0xd7, 0x09, 0x00, 0xa5, 0x0d, 0xa5, 0x04, 0x00, 0x96, 0x02, 0x00, 0x46, 0x00, 0xa1, 0x06, 0x00,
+0x00, 0xe1, 0x0e, 0x00, 0xad, 0x0b, 0x00, 0x9b, 0x08, 0x00, 0xbb, 0x0b, 0x95, 0x04, 0x00, 0x76,
+0x00, 0x0d, 0x00, 0xa9, 0x05, 0x00, 0x00, 0x8b, 0x0d, 0x00, 0xdb, 0x09, 0x00, 0xeb, 0x06, 0x00,
+0xeb, 0x09, 0xb3, 0x03, 0x00, 0xac, 0x01, 0x00, 0x02, 0x00, 0xd1, 0x04, 0x00, 0x00, 0xb9, 0x0b,
+0x00, 0xe5, 0x08, 0x00, 0xa3, 0x06, 0x00, 0x93, 0x09, 0xf9, 0x01, 0x00, 0xd0, 0x01, 0x00, 0x3e,
+0x00, 0xbb, 0x03, 0x00, 0x00, 0xc1, 0x09, 0x00, 0xb5, 0x07, 0x00, 0xad, 0x05, 0x00, 0xd3, 0x07,
+0xd3, 0x01, 0x00, 0xc8, 0x01, 0x00, 0x26, 0x00, 0xe1, 0x02, 0x00, 0x00, 0x89, 0x08, 0x00, 0xed,
+0x05, 0x00, 0xb9, 0x04, 0x00, 0xb1, 0x06, 0xa3, 0x01, 0x00, 0x98, 0x01, 0x00, 0x1a, 0x00, 0xa9,
+0x02, 0x00, 0x00, 0xc1, 0x06, 0x00, 0xe1, 0x04, 0x00, 0xd7, 0x03, 0x00, 0xbb, 0x05, 0x83, 0x01,
+0x00, 0x62, 0x00, 0x0c, 0x00, 0xed, 0x01, 0x00, 0x00, 0xfb, 0x04, 0x00, 0xdb, 0x03, 0x00, 0xf9,
+0x02, 0x00, 0x8f, 0x04, 0x77, 0x00, 0x12, 0x00, 0x29, 0x00, 0xc9, 0x01, 0x00, 0x00, 0xe5, 0x03,
+0x00, 0xf5, 0x02, 0x00, 0xb7, 0x02, 0x00, 0xa3, 0x03, 0x7f, 0x00, 0x0d, 0x00, 0x37, 0x00, 0xa7,
+0x01, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x9d, 0x02, 0x00, 0xf3, 0x01, 0x00, 0xd3, 0x02, 0x59, 0x00,
+0x1b, 0x00, 0x2b, 0x00, 0x7b, 0x00, 0x00, 0x99, 0x01, 0x00, 0x99, 0x01, 0x00, 0x95, 0x01, 0x00,
+0xa7, 0x01, 0x43, 0x00, 0x81, 0x01, 0x00, 0x93, 0x01, 0x00, 0x59, 0x00, 0x00, 0xc6, 0x01, 0x00,
+0x30, 0x00, 0x15, 0x00, 0x74, 0x95, 0x01, 0x00, 0xdf, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x67, 0x00,
+0x00, 0xfc, 0x03, 0x00, 0xb8, 0x02, 0x00, 0x78, 0x00, 0xc6, 0x02, 0xdd, 0x01, 0x00, 0x93, 0x04,
+0x00, 0xb5, 0x03, 0x00, 0x7d, 0x00, 0x00, 0xce, 0x05, 0x00, 0xf4, 0x03, 0x00, 0x82, 0x02, 0x00,
+0xf0, 0x03, 0xd7, 0x01, 0x00, 0xbd, 0x04, 0x00, 0xd5, 0x03, 0x00, 0x4f, 0x00, 0x00, 0xbe, 0x06,
+0x00, 0xe4, 0x04, 0x00, 0xd2, 0x02, 0x00, 0xf0, 0x04, 0x8d, 0x01, 0x00, 0xf7, 0x03, 0x00, 0x87,
+0x03, 0x00, 0x02, 0x00, 0x00, 0xb4, 0x07, 0x00, 0xf0, 0x04, 0x00, 0xf8, 0x02, 0x00, 0xc2, 0x05,
+0x1b, 0x00, 0xb1, 0x04, 0x00, 0xcb, 0x03, 0x00, 0x1c, 0x00, 0x00, 0xc4, 0x0a, 0x00, 0xc6, 0x06,
+0x00, 0xae, 0x04, 0x00, 0xf8, 0x07, 0x25, 0x00, 0xcf, 0x06, 0x00, 0xbf, 0x05, 0x00, 0x80, 0x01,
+0x00, 0x00, 0xc8, 0x0f, 0x00, 0xe8, 0x0a, 0x00, 0xda, 0x06, 0x00, 0xac, 0x0b, 0x5b, 0x00, 0xe9,
+0x08, 0x00, 0xc5, 0x07, 0x00, 0x8e, 0x01, 0x00, 0x00, 0xa6, 0x12, 0x00, 0x9a, 0x0e, 0x00, 0xe6,
+0x08, 0x00, 0xf2, 0x0c, 0x61, 0x00, 0xb7, 0x09, 0x00, 0xcd, 0x07, 0x00, 0x9a, 0x01, 0x00, 0x00,
+0xbe, 0x13, 0x00, 0xd8, 0x0f, 0x00, 0xc6, 0x0a, 0x00, 0xa2, 0x0e, 0x7a, 0x00, 0x95, 0x08, 0x00,
+0xdf, 0x06, 0x00, 0xfa, 0x02, 0x00, 0x00, 0xbe, 0x13, 0x00, 0xf6, 0x0f, 0x00, 0xde, 0x0a, 0x00,
+0x86, 0x0e, 0x9c, 0x03, 0x00, 0xf1, 0x05, 0x00, 0xc5, 0x04, 0x00, 0x84, 0x05, 0x00, 0x00, 0xc0,
+0x12, 0x00, 0xd2, 0x0f, 0x00, 0xb4, 0x0a, 0x00, 0x9c, 0x0d, 0xa4, 0x05, 0x00, 0x9d, 0x04, 0x00,
+0xbb, 0x03, 0x00, 0x84, 0x06, 0x00, 0x00, 0xb8, 0x12, 0x00, 0xb0, 0x0f, 0x00, 0xb4, 0x0a, 0x00,
+0xa4, 0x0d, 0xc2, 0x06, 0x00, 0x9d, 0x04, 0x00, 0xdb, 0x03, 0x00, 0xbc, 0x07, 0x00, 0x00, 0xda,
+0x14, 0x00, 0xd6, 0x11, 0x00, 0x90, 0x0c, 0x00, 0xd8, 0x0e, 0xa8, 0x07, 0x00, 0x9f, 0x05, 0x00,
+0xed, 0x04, 0x00, 0x92, 0x08, 0x00, 0x00, 0xe2, 0x17, 0x00, 0xdc, 0x15, 0x00, 0xfc, 0x0e, 0x00,
+0xbe, 0x10, 0xd2, 0x08, 0x00, 0x97, 0x05, 0x00, 0x89, 0x05, 0x00, 0x9e, 0x09, 0x00, 0x00, 0xc4,
+0x19, 0x00, 0xd8, 0x19, 0x00, 0xa6, 0x11, 0x00, 0xf8, 0x10, 0xb4, 0x0a, 0x00, 0xd5, 0x02, 0x00,
+0xd1, 0x02, 0x00, 0xe8, 0x0a, 0x00, 0x00, 0xfe, 0x16, 0x00, 0x86, 0x19, 0x00, 0xba, 0x11, 0x00,
+0xc4, 0x0e, 0xa2, 0x0c, 0x00, 0x4c, 0x00, 0x0e, 0x00, 0x90, 0x0c, 0x00, 0x00, 0xfc, 0x13, 0x00,
+0xee, 0x15, 0x00, 0xb0, 0x0f, 0x00, 0xa6, 0x0d, 0xe0, 0x0e, 0x00, 0x9a, 0x02, 0x00, 0xa8, 0x01,
+0x00, 0xaa, 0x0e, 0x00, 0x00, 0x92, 0x13, 0x00, 0xe8, 0x14, 0x00, 0xce, 0x0e, 0x00, 0xda, 0x0c,
+0xda, 0x11, 0x00, 0xe0, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xee, 0x0f, 0x00, 0x00, 0xaa, 0x14, 0x00,
+0xc4, 0x18, 0x00, 0x8a, 0x11, 0x00, 0xe2, 0x0c, 0xbc, 0x14, 0x00, 0xa2, 0x06, 0x00, 0xa0, 0x03,
+0x00, 0xbc, 0x12, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x90, 0x1b, 0x00, 0xfa, 0x12, 0x00, 0xc6, 0x0b,
+0xa8, 0x15, 0x00, 0x90, 0x09, 0x00, 0xfc, 0x05, 0x00, 0xce, 0x12, 0x00, 0x00, 0xec, 0x10, 0x00,
+0xd6, 0x18, 0x00, 0xc4, 0x11, 0x00, 0x92, 0x09, 0xba, 0x15, 0x00, 0x9a, 0x0b, 0x00, 0xfe, 0x07,
+0x00, 0xd6, 0x12, 0x00, 0x00, 0xe6, 0x0c, 0x00, 0xd4, 0x13, 0x00, 0xfe, 0x0d, 0x00, 0xa8, 0x07,
+0xa8, 0x15, 0x00, 0xe4, 0x0b, 0x00, 0xf8, 0x08, 0x00, 0xd8, 0x11, 0x00, 0x00, 0xfe, 0x09, 0x00,
+0xe0, 0x0f, 0x00, 0xa4, 0x0b, 0x00, 0xb8, 0x05, 0xdc, 0x15, 0x00, 0xc4, 0x0c, 0x00, 0x90, 0x09,
+0x00, 0xa6, 0x12, 0x00, 0x00, 0x88, 0x09, 0x00, 0xd2, 0x0f, 0x00, 0x96, 0x0b, 0x00, 0xca, 0x04,
+0xaa, 0x17, 0x00, 0xa0, 0x0e, 0x00, 0xfc, 0x09, 0x00, 0xb2, 0x13, 0x00, 0x00, 0x8c, 0x08, 0x00,
+0xcc, 0x10, 0x00, 0xfa, 0x0b, 0x00, 0x9e, 0x03, 0xac, 0x18, 0x00, 0xde, 0x0f, 0x00, 0x9e, 0x0b,
+0x00, 0xd2, 0x13, 0x00, 0x00, 0xb4, 0x05, 0x00, 0xac, 0x0e, 0x00, 0x84, 0x0a, 0x00, 0x5c, 0x8e,
+0x15, 0x00, 0xaa, 0x0f, 0x00, 0xde, 0x0b, 0x00, 0xbe, 0x11, 0x00, 0x00, 0xb0, 0x03, 0x00, 0xf8,
+0x09, 0x00, 0xb8, 0x07, 0x00, 0x1a, 0x80, 0x13, 0x00, 0xf6, 0x0d, 0x00, 0x9a, 0x0b, 0x00, 0xc6,
+0x0f, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x9a, 0x07, 0x00, 0x94, 0x05, 0x00, 0x35, 0xc4, 0x13, 0x00,
+0x8c, 0x0e, 0x00, 0x86, 0x0b, 0x00, 0xee, 0x0f, 0x00, 0x00, 0x3c, 0x00, 0xb4, 0x07, 0x00, 0xf0,
+0x04, 0x00, 0xef, 0x01, 0xbe, 0x14, 0x00, 0xf6, 0x0f, 0x00, 0xca, 0x0b, 0x00, 0xaa, 0x10, 0x00,
+0x00, 0x91, 0x01, 0x00, 0xc8, 0x07, 0x00, 0x90, 0x05, 0x00, 0xc1, 0x03, 0xaa, 0x15, 0x00, 0xce,
+0x10, 0x00, 0x9a, 0x0c, 0x00, 0xd8, 0x10, 0x00, 0x00, 0xa7, 0x02, 0x00, 0xd0, 0x05, 0x00, 0xd6,
+0x03, 0x00, 0xc1, 0x04, 0xc0, 0x11, 0x00, 0xd0, 0x0f, 0x00, 0xe2, 0x0b, 0x00, 0xf8, 0x0e, 0x00,
+0x00, 0xa7, 0x04, 0x00, 0xf8, 0x02, 0x00, 0xa8, 0x01, 0x00, 0xe9, 0x05, 0xae, 0x11, 0x00, 0xba,
+0x0d, 0x00, 0xe6, 0x0a, 0x00, 0xe8, 0x0c, 0x00, 0x00, 0xa1, 0x05, 0x00, 0x1c, 0x00, 0x7b, 0x00,
+0x83, 0x06, 0xac, 0x0e, 0x00, 0xc2, 0x0c, 0x00, 0xca, 0x09, 0x00, 0xc0, 0x0b, 0x00, 0x00, 0xd9,
+0x05, 0x00, 0x7d, 0x00, 0xdd, 0x01, 0x00, 0xc5, 0x06, 0xaa, 0x0e, 0x00, 0xca, 0x0c, 0x00, 0xb6,
+0x09, 0x00, 0xba, 0x0b, 0x00, 0x00, 0xd9, 0x06, 0x00, 0x81, 0x01, 0x00, 0x85, 0x02, 0x00, 0xef,
+0x07, 0xc2, 0x0f, 0x00, 0xf8, 0x0c, 0x00, 0xce, 0x09, 0x00, 0x88, 0x0a, 0x00, 0x00, 0xf3, 0x07,
+0x00, 0xe1, 0x01, 0x00, 0xb5, 0x02, 0x00, 0xe7, 0x08, 0x9e, 0x0d, 0x00, 0x94, 0x0c, 0x00, 0xa0,
+0x09, 0x00, 0xb0, 0x0b, 0x00, 0x00, 0x89, 0x08, 0x00, 0xb5, 0x03, 0x00, 0xd3, 0x03, 0x00, 0xd1,
+0x08, 0xc2, 0x0a, 0x00, 0xcc, 0x09, 0x00, 0xd4, 0x07, 0x00, 0xe6, 0x08, 0x00, 0x00, 0x91, 0x08,
+0x00, 0x9d, 0x04, 0x00, 0xcb, 0x04, 0x00, 0xd3, 0x08, 0xe8, 0x0a, 0x00, 0xb8, 0x09, 0x00, 0xa4,
+0x07, 0x00, 0xbe, 0x08, 0x00, 0x00, 0x9f, 0x08, 0x00, 0xa7, 0x04, 0x00, 0xb9, 0x04, 0x00, 0xbf,
+0x08, 0x96, 0x0b, 0x00, 0x9e, 0x0a, 0x00, 0xc6, 0x07, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf9, 0x08,
+0x00, 0xff, 0x03, 0x00, 0xa9, 0x04, 0x00, 0xe5, 0x08, 0x80, 0x0b, 0x00, 0xba, 0x0a, 0x00, 0xb6,
+0x07, 0x00, 0xde, 0x07, 0x00, 0x00, 0xab, 0x09, 0x00, 0x9f, 0x04, 0x00, 0xc9, 0x04, 0x00, 0x97,
+0x09, 0xc8, 0x09, 0x00, 0xf6, 0x08, 0x00, 0xcc, 0x06, 0x00, 0xfa, 0x06, 0x00, 0x00, 0xfd, 0x08,
+0x00, 0xc1, 0x05, 0x00, 0xab, 0x05, 0x00, 0xcd, 0x09, 0xc6, 0x07, 0x00, 0xce, 0x06, 0x00, 0xa2,
+0x05, 0x00, 0xbe, 0x05, 0x00, 0x00, 0x8d, 0x09, 0x00, 0x95, 0x06, 0x00, 0xb5, 0x06, 0x00, 0xab,
+0x08, 0xac, 0x05, 0x00, 0xe2, 0x04, 0x00, 0xea, 0x03, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x8f, 0x08,
+0x00, 0xeb, 0x06, 0x00, 0xed, 0x06, 0x00, 0xd5, 0x08, 0xb4, 0x03, 0x00, 0xb8, 0x03, 0x00, 0xd4,
+0x02, 0x00, 0xba, 0x02, 0x00, 0x00, 0x91, 0x08, 0x00, 0x97, 0x07, 0x00, 0xef, 0x06, 0x00, 0xef,
+0x07, 0xbc, 0x02, 0x00, 0x9e, 0x02, 0x00, 0xe2, 0x01, 0x00, 0xfa, 0x01, 0x00, 0x00, 0x89, 0x08,
+0x00, 0x85, 0x07, 0x00, 0xdb, 0x06, 0x00, 0xf1, 0x07, 0x86, 0x02, 0x00, 0x84, 0x02, 0x00, 0x8c,
+0x01, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xef, 0x07, 0x00, 0xbf, 0x06, 0x00, 0xa5, 0x06, 0x00, 0xcd,
+0x07, 0xac, 0x01, 0x00, 0x7e, 0x00, 0x44, 0x00, 0x1c, 0x00, 0x00, 0x8b, 0x07, 0x00, 0xfd, 0x05,
+0x00, 0x87, 0x06, 0x00, 0xb5, 0x07, 0x00, 0x00, 0x09, 0x00, 0x4d, 0x00, 0x21, 0x00, 0x00, 0xfb,
+0x05, 0x00, 0xb9, 0x05, 0x00, 0xb1, 0x05, 0x00, 0xf1, 0x05, 0x69, 0x00, 0x79, 0x00, 0x87, 0x01,
+0x00, 0x71, 0x00, 0x00, 0xa1, 0x05, 0x00, 0xf7, 0x04, 0x00, 0xe9, 0x04, 0x00, 0xe9, 0x04, 0xcf,
+0x01, 0x00, 0xc3, 0x01, 0x00, 0xaf, 0x01, 0x00, 0xb3, 0x01, 0x00, 0x00, 0xed, 0x03, 0x00, 0xe1,
+0x03, 0x00, 0xf9, 0x03, 0x00, 0xd5, 0x03, 0x7b, 0x00, 0x9f, 0x01, 0x00, 0xcb, 0x01, 0x00, 0x91,
+0x01, 0x00, 0x00, 0xa7, 0x03, 0x00, 0xb3, 0x02, 0x00, 0xcf, 0x02, 0x00, 0xc3, 0x03, 0x85, 0x01,
+0x00, 0x91, 0x01, 0x00, 0xb3, 0x01, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xa3, 0x02, 0x00, 0xd3, 0x01,
+0x00, 0xc9, 0x01, 0x00, 0xd9, 0x02, 0xff, 0x01, 0x00, 0x81, 0x02, 0x00, 0x9f, 0x02, 0x00, 0x9d,
+0x02, 0x00, 0x00, 0x67, 0x00, 0x71, 0x00, 0x8f, 0x01, 0x00, 0x7f, 0xc1, 0x02, 0x00, 0xbd, 0x02,
+0x00, 0x95, 0x02, 0x00, 0x85, 0x02, 0x00, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x0c, 0xc7,
+0x02, 0x00, 0xb9, 0x02, 0x00, 0xb9, 0x02, 0x00, 0xa1, 0x02, 0x00, 0x00, 0x34, 0x00, 0x2e, 0x00,
+0x26, 0x00, 0x0b, 0xfb, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x95, 0x02, 0x00, 0xa9, 0x02, 0x00, 0x00,
+0x54, 0x00, 0x7c, 0x00, 0x8a, 0x01, 0x00, 0x58, 0x99, 0x02, 0x00, 0x9b, 0x02, 0x00, 0xb9, 0x02,
+0x00, 0xd3, 0x02, 0x00, 0x00, 0x7e, 0x00, 0xb4, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x9a, 0x01, 0xaf,
+0x02, 0x00, 0xc5, 0x02, 0x00, 0xc5, 0x02, 0x00, 0xab, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0xba,
+0x01, 0x00, 0xac, 0x01, 0x00, 0xd8, 0x01, 0xc1, 0x02, 0x00, 0xc9, 0x02, 0x00, 0xb3, 0x02, 0x00,
+0xa7, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0xe8, 0x01, 0x00, 0xd6, 0x01, 0x00, 0xe4, 0x01, 0xeb,
+0x01, 0x00, 0xff, 0x01, 0x00, 0x8d, 0x02, 0x00, 0x85, 0x02, 0x00, 0x00, 0x82, 0x02, 0x00, 0x92,
+0x02, 0x00, 0xfc, 0x01, 0x00, 0x92, 0x02, 0xc3, 0x01, 0x00, 0xc3, 0x01, 0x00, 0xdd, 0x01, 0x00,
+0xe3, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0xa8, 0x02, 0x00, 0xa4, 0x02, 0x00, 0xe8, 0x01, 0x8d,
+0x01, 0x00, 0x97, 0x01, 0x00, 0xcd, 0x01, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x90, 0x02, 0x00, 0xc0,
+0x02, 0x00, 0xa8, 0x02, 0x00, 0xde, 0x01, 0x41, 0x00, 0x75, 0x00, 0xb7, 0x01, 0x00, 0xa1, 0x01,
+0x00, 0x00, 0x8a, 0x02, 0x00, 0xce, 0x02, 0x00, 0xe0, 0x02, 0x00, 0xa4, 0x02, 0x4b, 0x00, 0x4b,
+0x00, 0x91, 0x01, 0x00, 0x77, 0x00, 0x00, 0x90, 0x02, 0x00, 0xcc, 0x02, 0x00, 0xae, 0x02, 0x00,
+0xa0, 0x02, 0x0b, 0x00, 0x17, 0x00, 0x47, 0x00, 0x65, 0x00, 0x00, 0xc4, 0x02, 0x00, 0xa8, 0x03,
+0x00, 0xa2, 0x03, 0x00, 0xae, 0x02, 0x50, 0x00, 0x44, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x00, 0xe4,
+0x02, 0x00, 0xd2, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xb6, 0x02, 0xa4, 0x02, 0x00, 0x9c, 0x02, 0x00,
+0xa2, 0x01, 0x00, 0xac, 0x01, 0x00, 0x00, 0xca, 0x02, 0x00, 0xc0, 0x04, 0x00, 0xac, 0x04, 0x00,
+0xc0, 0x01, 0xea, 0x03, 0x00, 0xd4, 0x03, 0x00, 0xae, 0x02, 0x00, 0xbe, 0x02, 0x00, 0x00, 0xb2,
+0x02, 0x00, 0xfe, 0x04, 0x00, 0xf2, 0x04, 0x00, 0xc0, 0x03, 0xa4, 0x05, 0x00, 0xf6, 0x04, 0x00,
+0xac, 0x03, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xaa, 0x03, 0x00, 0xda, 0x05, 0x00, 0xd2, 0x05, 0x00,
+0xb0, 0x03, 0xa4, 0x07, 0x00, 0xdc, 0x06, 0x00, 0xf2, 0x04, 0x00, 0x90, 0x05, 0x00, 0x00, 0xea,
+0x02, 0x00, 0xc4, 0x06, 0x00, 0xc8, 0x06, 0x00, 0xfc, 0x02, 0xca, 0x09, 0x00, 0xc0, 0x09, 0x00,
+0xe2, 0x06, 0x00, 0x82, 0x07, 0x00, 0x00, 0xd0, 0x02, 0x00, 0xc0, 0x07, 0x00, 0xa4, 0x07, 0x00,
+0xc6, 0x02, 0x84, 0x0c, 0x00, 0xd4, 0x0c, 0x00, 0xec, 0x08, 0x00, 0xda, 0x08, 0x00, 0x00, 0xf6,
+0x01, 0x00, 0xd6, 0x07, 0x00, 0xfa, 0x07, 0x00, 0xa6, 0x01, 0xfa, 0x0d, 0x00, 0x94, 0x0e, 0x00,
+0xb6, 0x0a, 0x00, 0xf6, 0x09, 0x00, 0x00, 0xd6, 0x01, 0x00, 0xdc, 0x07, 0x00, 0x9c, 0x08, 0x00,
+0xae, 0x02, 0x92, 0x0e, 0x00, 0xd8, 0x0e, 0x00, 0xe6, 0x0b, 0x00, 0x80, 0x0b, 0x00, 0x00, 0xde,
+0x01, 0x00, 0x96, 0x07, 0x00, 0xe2, 0x07, 0x00, 0xb8, 0x02, 0x9e, 0x10, 0x00, 0x80, 0x11, 0x00,
+0xfe, 0x0c, 0x00, 0xf8, 0x0b, 0x00, 0x00, 0x38, 0x00, 0x92, 0x07, 0x00, 0x9a, 0x08, 0x00, 0x98,
+0x01, 0xe2, 0x11, 0x00, 0xb4, 0x13, 0x00, 0x88, 0x0f, 0x00, 0xae, 0x0d, 0x00, 0x00, 0x95, 0x01,
+0x00, 0xce, 0x06, 0x00, 0xda, 0x07, 0x00, 0x32, 0xc6, 0x12, 0x00, 0xe4, 0x14, 0x00, 0xa0, 0x10,
+0x00, 0xf0, 0x0d, 0x00, 0x00, 0xf1, 0x01, 0x00, 0xc4, 0x05, 0x00, 0x94, 0x07, 0x00, 0x11, 0xee,
+0x12, 0x00, 0xa6, 0x15, 0x00, 0xf4, 0x10, 0x00, 0xc8, 0x0e, 0x00, 0x00, 0xad, 0x02, 0x00, 0x9a,
+0x04, 0x00, 0x94, 0x06, 0x00, 0x39, 0xa6, 0x12, 0x00, 0xd0, 0x15, 0x00, 0x94, 0x11, 0x00, 0xaa,
+0x0e, 0x00, 0x00, 0x9d, 0x03, 0x00, 0xc2, 0x03, 0x00, 0xfc, 0x04, 0x00, 0x8f, 0x01, 0xd2, 0x12,
+0x00, 0xb6, 0x15, 0x00, 0xca, 0x11, 0x00, 0xc2, 0x0e, 0x00, 0x00, 0xc3, 0x04, 0x00, 0xc6, 0x02,
+0x00, 0xe2, 0x03, 0x00, 0xa7, 0x02, 0xc2, 0x12, 0x00, 0xfc, 0x15, 0x00, 0xfa, 0x11, 0x00, 0xc4,
+0x0e, 0x00, 0x00, 0xb1, 0x05, 0x00, 0x92, 0x01, 0x00, 0xa8, 0x02, 0x00, 0xab, 0x03, 0xc8, 0x12,
+0x00, 0xfe, 0x16, 0x00, 0xe0, 0x12, 0x00, 0xf8, 0x0e, 0x00, 0x00, 0x87, 0x07, 0x00, 0x17, 0x00,
+0xfa, 0x01, 0x00, 0xf3, 0x04, 0x9c, 0x12, 0x00, 0xf4, 0x16, 0x00, 0x9e, 0x13, 0x00, 0xc8, 0x0e,
+0x00, 0x00, 0xdf, 0x07, 0x00, 0xcb, 0x01, 0x00, 0x6a, 0x00, 0xff, 0x05, 0xd6, 0x11, 0x00, 0xf6,
+0x15, 0x00, 0xce, 0x12, 0x00, 0xa6, 0x0e, 0x00, 0x00, 0xb5, 0x08, 0x00, 0x89, 0x03, 0x00, 0x31,
+0x00, 0xab, 0x06, 0x9a, 0x11, 0x00, 0xe6, 0x15, 0x00, 0xe6, 0x12, 0x00, 0x9a, 0x0e, 0x00, 0x00,
+0xd7, 0x09, 0x00, 0xcf, 0x04, 0x00, 0x85, 0x02, 0x00, 0xdd, 0x06, 0x86, 0x11, 0x00, 0x88, 0x16,
+0x00, 0xea, 0x12, 0x00, 0xc8, 0x0e, 0x00, 0x00, 0xcd, 0x0b, 0x00, 0xbd, 0x06, 0x00, 0xa1, 0x03,
+0x00, 0xc3, 0x08, 0xfc, 0x10, 0x00, 0x8a, 0x16, 0x00, 0xd6, 0x12, 0x00, 0xd4, 0x0d, 0x00, 0x00,
+0xf9, 0x0c, 0x00, 0xff, 0x07, 0x00, 0xeb, 0x04, 0x00, 0x83, 0x0a, 0xb8, 0x10, 0x00, 0x8c, 0x16,
+0x00, 0xfe, 0x12, 0x00, 0xea, 0x0d, 0x00, 0x00, 0xd7, 0x0d, 0x00, 0x9f, 0x09, 0x00, 0xb7, 0x06,
+0x00, 0xa5, 0x0a, 0xd0, 0x0f, 0x00, 0xd8, 0x14, 0x00, 0x8a, 0x12, 0x00, 0xee, 0x0c, 0x00, 0x00,
+0x95, 0x0e, 0x00, 0x99, 0x0a, 0x00, 0xc5, 0x07, 0x00, 0xaf, 0x0b, 0xc4, 0x0e, 0x00, 0xf4, 0x13,
+0x00, 0xa0, 0x11, 0x00, 0xf4, 0x0c, 0x00, 0x00, 0xcd, 0x0e, 0x00, 0xf5, 0x0a, 0x00, 0xaf, 0x08,
+0x00, 0xeb, 0x0b, 0x8e, 0x0e, 0x00, 0x98, 0x13, 0x00, 0x8e, 0x11, 0x00, 0x96, 0x0c, 0x00, 0x00,
+0xe5, 0x0e, 0x00, 0xdf, 0x0b, 0x00, 0xfd, 0x09, 0x00, 0x8f, 0x0c, 0x8c, 0x0d, 0x00, 0xb2, 0x11,
+0x00, 0xec, 0x0f, 0x00, 0xba, 0x0b, 0x00, 0x00, 0xdb, 0x0e, 0x00, 0x9f, 0x0c, 0x00, 0xe3, 0x09,
+0x00, 0x9d, 0x0c, 0x8c, 0x0c, 0x00, 0xda, 0x10, 0x00, 0xd4, 0x0e, 0x00, 0xb4, 0x0a, 0x00, 0x00,
+0x8b, 0x0f, 0x00, 0xe7, 0x0c, 0x00, 0xed, 0x09, 0x00, 0xc5, 0x0c, 0x84, 0x0b, 0x00, 0x94, 0x0f,
+0x00, 0xf4, 0x0d, 0x00, 0xd4, 0x09, 0x00, 0x00, 0xe5, 0x0e, 0x00, 0xc7, 0x0c, 0x00, 0xa5, 0x0a,
+0x00, 0xb7, 0x0c, 0xea, 0x09, 0x00, 0xdc, 0x0d, 0x00, 0xba, 0x0c, 0x00, 0xc2, 0x08, 0x00, 0x00,
+0xc3, 0x0d, 0x00, 0xfd, 0x0b, 0x00, 0xd3, 0x09, 0x00, 0xa7, 0x0b, 0x92, 0x08, 0x00, 0xbc, 0x0b,
+0x00, 0xe8, 0x0a, 0x00, 0x9c, 0x07, 0x00, 0x00, 0x85, 0x0c, 0x00, 0x89, 0x0b, 0x00, 0xc9, 0x09,
+0x00, 0xbd, 0x0a, 0xf2, 0x06, 0x00, 0xd4, 0x09, 0x00, 0x82, 0x09, 0x00, 0xb6, 0x06, 0x00, 0x00,
+0xbb, 0x0a, 0x00, 0x97, 0x0a, 0x00, 0x81, 0x09, 0x00, 0xbb, 0x09, 0x94, 0x06, 0x00, 0xc6, 0x08,
+0x00, 0xb4, 0x08, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xa3, 0x0a, 0x00, 0x8b, 0x0a, 0x00, 0xcb, 0x08,
+0x00, 0xe3, 0x08, 0xd8, 0x05, 0x00, 0xa0, 0x08, 0x00, 0xe8, 0x07, 0x00, 0x82, 0x05, 0x00, 0x00,
+0xcf, 0x0a, 0x00, 0xf1, 0x09, 0x00, 0xa5, 0x08, 0x00, 0xf5, 0x08, 0xb2, 0x05, 0x00, 0xd0, 0x07,
+0x00, 0x90, 0x07, 0x00, 0xe0, 0x04, 0x00, 0x00, 0xa7, 0x09, 0x00, 0xd9, 0x08, 0x00, 0xc7, 0x07,
+0x00, 0x97, 0x08, 0xd4, 0x04, 0x00, 0xa8, 0x06, 0x00, 0x88, 0x06, 0x00, 0xac, 0x04, 0x00, 0x00,
+0xf3, 0x07, 0x00, 0xd9, 0x07, 0x00, 0xeb, 0x06, 0x00, 0x8d, 0x07, 0xcc, 0x03, 0x00, 0xa0, 0x05,
+0x00, 0xe0, 0x04, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xcb, 0x06, 0x00, 0xc9, 0x06, 0x00, 0xa5, 0x06,
+0x00, 0x93, 0x06, 0xdc, 0x03, 0x00, 0xfa, 0x04, 0x00, 0xec, 0x04, 0x00, 0xce, 0x03, 0x00, 0x00,
+0xbb, 0x06, 0x00, 0xbd, 0x06, 0x00, 0xe1, 0x05, 0x00, 0xdb, 0x05, 0x80, 0x03, 0x00, 0xd6, 0x04,
+0x00, 0xd2, 0x04, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x9b, 0x06, 0x00, 0x99, 0x06, 0x00, 0xcb, 0x05,
+0x00, 0xbf, 0x05, 0x98, 0x03, 0x00, 0xea, 0x04, 0x00, 0xe0, 0x04, 0x00, 0xf2, 0x02, 0x00, 0x00,
+0xe3, 0x05, 0x00, 0xe7, 0x05, 0x00, 0xfd, 0x04, 0x00, 0xad, 0x05, 0xf8, 0x02, 0x00, 0xa0, 0x04,
+0x00, 0x9c, 0x04, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x8d, 0x05, 0x00, 0x9d, 0x05, 0x00, 0xc9, 0x04,
+0x00, 0xad, 0x04, 0xf0, 0x02, 0x00, 0x8e, 0x04, 0x00, 0x80, 0x04, 0x00, 0xfc, 0x02, 0x00, 0x00,
+0xed, 0x04, 0x00, 0xf1, 0x04, 0x00, 0xa3, 0x04, 0x00, 0x8f, 0x04, 0xba, 0x02, 0x00, 0xd6, 0x03,
+0x00, 0xae, 0x03, 0x00, 0x86, 0x02, 0x00, 0x00, 0xb3, 0x04, 0x00, 0xa5, 0x04, 0x00, 0xe5, 0x03,
+0x00, 0xe1, 0x03, 0xea, 0x01, 0x00, 0xf4, 0x02, 0x00, 0xe6, 0x02, 0x00, 0xe6, 0x01, 0x00, 0x00,
+0x8d, 0x04, 0x00, 0x87, 0x04, 0x00, 0xcf, 0x03, 0x00, 0xd1, 0x03, 0x9e, 0x01, 0x00, 0xc6, 0x02,
+0x00, 0x9a, 0x02, 0x00, 0xa0, 0x01, 0x00, 0x00, 0xcf, 0x03, 0x00, 0xb9, 0x03, 0x00, 0x97, 0x03,
+0x00, 0x91, 0x03, 0x84, 0x01, 0x00, 0xce, 0x01, 0x00, 0xd8, 0x01, 0x00, 0x78, 0x00, 0x00, 0xb9,
+0x02, 0x00, 0xd1, 0x02, 0x00, 0x9f, 0x02, 0x00, 0xa1, 0x02, 0x5e, 0x00, 0x68, 0x00, 0x54, 0x00,
+0x44, 0x00, 0x00, 0xc7, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xef, 0x01, 0x00, 0xb1, 0x01, 0x18, 0x00,
+0x42, 0x00, 0x44, 0x00, 0x18, 0x00, 0x00, 0xa5, 0x01, 0x00, 0xa3, 0x01, 0x00, 0x87, 0x01, 0x00,
+0x93, 0x01, 0x03, 0x00, 0x03, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x29, 0x00, 0x23, 0x00, 0x2f,
+0x00, 0x35, 0x45, 0x00, 0x73, 0x00, 0x6d, 0x00, 0x31, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x7e, 0x00,
+0x44, 0x00, 0x6a, 0x67, 0x00, 0xd3, 0x01, 0x00, 0xcf, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x9a, 0x02,
+0x00, 0xfc, 0x01, 0x00, 0xae, 0x01, 0x00, 0xd6, 0x01, 0x91, 0x01, 0x00, 0xb5, 0x02, 0x00, 0x99,
+0x02, 0x00, 0x65, 0x00, 0x00, 0x8c, 0x03, 0x00, 0xf6, 0x02, 0x00, 0xc0, 0x02, 0x00, 0xa2, 0x02,
+0xb1, 0x01, 0x00, 0x81, 0x03, 0x00, 0xed, 0x02, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xe8, 0x04, 0x00,
+0xb2, 0x04, 0x00, 0xba, 0x03, 0x00, 0xe4, 0x03, 0xe9, 0x01, 0x00, 0xf7, 0x03, 0x00, 0xc7, 0x03,
+0x00, 0xe3, 0x01, 0x00, 0x00, 0xfc, 0x05, 0x00, 0xbe, 0x05, 0x00, 0xa8, 0x04, 0x00, 0x80, 0x05,
+0xbf, 0x02, 0x00, 0xcb, 0x04, 0x00, 0xe9, 0x03, 0x00, 0xe5, 0x01, 0x00, 0x00, 0xda, 0x07, 0x00,
+0x94, 0x07, 0x00, 0xc8, 0x05, 0x00, 0xee, 0x05, 0xcd, 0x02, 0x00, 0xbd, 0x05, 0x00, 0x81, 0x05,
+0x00, 0x93, 0x02, 0x00, 0x00, 0xbc, 0x09, 0x00, 0xd8, 0x08, 0x00, 0xf0, 0x06, 0x00, 0xe0, 0x07,
+0xa5, 0x03, 0x00, 0x87, 0x07, 0x00, 0xb1, 0x06, 0x00, 0x9f, 0x02, 0x00, 0x00, 0xc2, 0x0b, 0x00,
+0x96, 0x0a, 0x00, 0xee, 0x07, 0x00, 0xb8, 0x09, 0xd9, 0x03, 0x00, 0xe3, 0x08, 0x00, 0xef, 0x07,
+0x00, 0xff, 0x02, 0x00, 0x00, 0xe4, 0x0d, 0x00, 0xce, 0x0b, 0x00, 0xde, 0x08, 0x00, 0xf4, 0x0a,
+0xb5, 0x04, 0x00, 0xb3, 0x0a, 0x00, 0xe3, 0x08, 0x00, 0xa3, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00,
+0xa2, 0x0c, 0x00, 0x92, 0x09, 0x00, 0x86, 0x0c, 0x91, 0x05, 0x00, 0xb7, 0x0a, 0x00, 0xeb, 0x08,
+0x00, 0xe7, 0x03, 0x00, 0x00, 0xd2, 0x0d, 0x00, 0xfe, 0x0b, 0x00, 0xc4, 0x09, 0x00, 0x90, 0x0b,
+0x81, 0x06, 0x00, 0xfb, 0x09, 0x00, 0xf9, 0x08, 0x00, 0xd1, 0x04, 0x00, 0x00, 0xbe, 0x0d, 0x00,
+0x8a, 0x0c, 0x00, 0xca, 0x09, 0x00, 0x96, 0x0b, 0xe3, 0x06, 0x00, 0xe5, 0x0b, 0x00, 0xad, 0x0a,
+0x00, 0xc3, 0x05, 0x00, 0x00, 0x94, 0x10, 0x00, 0xb4, 0x0d, 0x00, 0xb2, 0x0a, 0x00, 0xa2, 0x0d,
+0x89, 0x09, 0x00, 0x97, 0x0f, 0x00, 0xc9, 0x0c, 0x00, 0xa5, 0x06, 0x00, 0x00, 0xf4, 0x13, 0x00,
+0xf8, 0x0e, 0x00, 0xca, 0x0a, 0x00, 0xc8, 0x0f, 0x85, 0x0b, 0x00, 0xf9, 0x12, 0x00, 0xb9, 0x0f,
+0x00, 0xff, 0x07, 0x00, 0x00, 0xf8, 0x15, 0x00, 0xa8, 0x0f, 0x00, 0xc8, 0x0a, 0x00, 0xa4, 0x11,
+0xeb, 0x0c, 0x00, 0xdd, 0x14, 0x00, 0x8f, 0x11, 0x00, 0xdf, 0x08, 0x00, 0x00, 0xea, 0x14, 0x00,
+0xb4, 0x0e, 0x00, 0x82, 0x0a, 0x00, 0xde, 0x10, 0xe5, 0x0c, 0x00, 0xb3, 0x14, 0x00, 0xcf, 0x10,
+0x00, 0xc9, 0x09, 0x00, 0x00, 0x9a, 0x12, 0x00, 0xd6, 0x0c, 0x00, 0xfe, 0x09, 0x00, 0xe2, 0x0e,
+0x9d, 0x0d, 0x00, 0xa9, 0x13, 0x00, 0x95, 0x10, 0x00, 0xe3, 0x0a, 0x00, 0x00, 0xbe, 0x10, 0x00,
+0x8e, 0x0c, 0x00, 0x82, 0x09, 0x00, 0xdc, 0x0d, 0x83, 0x0f, 0x00, 0x8f, 0x15, 0x00, 0xab, 0x11,
+0x00, 0xdb, 0x0b, 0x00, 0x00, 0xaa, 0x12, 0x00, 0xd0, 0x0b, 0x00, 0xe0, 0x08, 0x00, 0xf0, 0x0e,
+0x8d, 0x12, 0x00, 0xe1, 0x18, 0x00, 0xd3, 0x13, 0x00, 0x81, 0x0d, 0x00, 0x00, 0xbc, 0x14, 0x00,
+0x82, 0x0b, 0x00, 0xc2, 0x07, 0x00, 0xb4, 0x10, 0xdf, 0x14, 0x00, 0xc5, 0x1b, 0x00, 0xc9, 0x15,
+0x00, 0x97, 0x0f, 0x00, 0x00, 0x9c, 0x14, 0x00, 0xe8, 0x09, 0x00, 0x8a, 0x06, 0x00, 0xba, 0x10,
+0x8f, 0x16, 0x00, 0xe3, 0x1c, 0x00, 0x8d, 0x16, 0x00, 0xad, 0x10, 0x00, 0x00, 0xb0, 0x12, 0x00,
+0xa6, 0x08, 0x00, 0xfc, 0x04, 0x00, 0xee, 0x0e, 0xa3, 0x16, 0x00, 0xc1, 0x1b, 0x00, 0xa7, 0x15,
+0x00, 0xc7, 0x10, 0x00, 0x00, 0x9c, 0x0f, 0x00, 0xd6, 0x06, 0x00, 0xa6, 0x04, 0x00, 0xfe, 0x0c,
+0xdd, 0x15, 0x00, 0xc9, 0x19, 0x00, 0xcd, 0x14, 0x00, 0xff, 0x10, 0x00, 0x00, 0xac, 0x0d, 0x00,
+0x9c, 0x05, 0x00, 0xbe, 0x03, 0x00, 0x90, 0x0b, 0x9b, 0x17, 0x00, 0xf9, 0x19, 0x00, 0xd3, 0x14,
+0x00, 0xd7, 0x11, 0x00, 0x00, 0xee, 0x0c, 0x00, 0xae, 0x03, 0x00, 0xde, 0x01, 0x00, 0x80, 0x0b,
+0xdb, 0x18, 0x00, 0xab, 0x1b, 0x00, 0xb5, 0x15, 0x00, 0xc5, 0x12, 0x00, 0x00, 0xf0, 0x0b, 0x00,
+0xd8, 0x01, 0x00, 0x26, 0x00, 0xdc, 0x0a, 0xdb, 0x19, 0x00, 0x81, 0x1c, 0x00, 0x97, 0x15, 0x00,
+0xe7, 0x13, 0x00, 0x00, 0xfa, 0x0a, 0x00, 0x38, 0x00, 0x16, 0x00, 0xaa, 0x0a, 0x95, 0x1a, 0x00,
+0x9d, 0x1b, 0x00, 0xc5, 0x15, 0x00, 0xb9, 0x13, 0x00, 0x00, 0xc4, 0x08, 0x00, 0x2b, 0x00, 0x7f,
+0x00, 0xf8, 0x07, 0xa3, 0x18, 0x00, 0xcf, 0x18, 0x00, 0x85, 0x13, 0x00, 0xd3, 0x12, 0x00, 0x00,
+0xa0, 0x06, 0x00, 0xb5, 0x01, 0x00, 0xef, 0x01, 0x00, 0xde, 0x05, 0xf5, 0x14, 0x00, 0xf1, 0x14,
+0x00, 0xf5, 0x10, 0x00, 0x85, 0x11, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x91, 0x02, 0x00, 0x81, 0x02,
+0x00, 0xbc, 0x03, 0x8b, 0x13, 0x00, 0xcd, 0x12, 0x00, 0xb7, 0x0f, 0x00, 0xd5, 0x0f, 0x00, 0x00,
+0xe8, 0x01, 0x00, 0xa9, 0x03, 0x00, 0xf7, 0x02, 0x00, 0xee, 0x01, 0xab, 0x11, 0x00, 0xad, 0x11,
+0x00, 0x85, 0x0e, 0x00, 0xb7, 0x0e, 0x00, 0x00, 0x07, 0x00, 0xbb, 0x04, 0x00, 0x97, 0x04, 0x00,
+0x34, 0x93, 0x10, 0x00, 0xb1, 0x0f, 0x00, 0xeb, 0x0c, 0x00, 0xd3, 0x0d, 0x00, 0x00, 0x9f, 0x01,
+0x00, 0xcb, 0x05, 0x00, 0x97, 0x05, 0x00, 0x57, 0xf1, 0x0f, 0x00, 0xed, 0x0e, 0x00, 0xf5, 0x0b,
+0x00, 0x9b, 0x0c, 0x00, 0x00, 0xfb, 0x01, 0x00, 0xcd, 0x06, 0x00, 0xd5, 0x05, 0x00, 0xbf, 0x01,
+0xc3, 0x0d, 0x00, 0xad, 0x0c, 0x00, 0xfd, 0x09, 0x00, 0x89, 0x0b, 0x00, 0x00, 0xe9, 0x02, 0x00,
+0xef, 0x05, 0x00, 0xd3, 0x05, 0x00, 0xd9, 0x02, 0xe9, 0x09, 0x00, 0x85, 0x09, 0x00, 0x8b, 0x08,
+0x00, 0xd7, 0x08, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x9f, 0x05, 0x00, 0x8b, 0x05, 0x00, 0xd1, 0x03,
+0x93, 0x07, 0x00, 0xb9, 0x06, 0x00, 0x8b, 0x06, 0x00, 0xbd, 0x06, 0x00, 0x00, 0xf5, 0x04, 0x00,
+0x8d, 0x05, 0x00, 0xe3, 0x04, 0x00, 0xeb, 0x04, 0xbd, 0x05, 0x00, 0xa7, 0x05, 0x00, 0x85, 0x05,
+0x00, 0xc1, 0x05, 0x00, 0x00, 0xd1, 0x04, 0x00, 0x89, 0x05, 0x00, 0xed, 0x04, 0x00, 0xe1, 0x04,
+0x95, 0x04, 0x00, 0xcd, 0x03, 0x00, 0xed, 0x03, 0x00, 0xa3, 0x04, 0x00, 0x00, 0xeb, 0x04, 0x00,
+0x95, 0x05, 0x00, 0xfd, 0x04, 0x00, 0xbb, 0x04, 0x9b, 0x03, 0x00, 0xe3, 0x02, 0x00, 0xd3, 0x02,
+0x00, 0xb3, 0x03, 0x00, 0x00, 0xad, 0x04, 0x00, 0x9b, 0x04, 0x00, 0x91, 0x04, 0x00, 0xb5, 0x04,
+0xd3, 0x01, 0x00, 0xad, 0x01, 0x00, 0xe9, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xd1, 0x04, 0x00,
+0xb3, 0x03, 0x00, 0x9b, 0x03, 0x00, 0xbf, 0x04, 0x2f, 0x00, 0x13, 0x00, 0x67, 0x00, 0x83, 0x01,
+0x00, 0x00, 0xed, 0x03, 0x00, 0xd5, 0x02, 0x00, 0xdd, 0x02, 0x00, 0xc5, 0x04, 0x40, 0x00, 0x38,
+0x00, 0x1f, 0x00, 0x25, 0x00, 0x00, 0xcb, 0x03, 0x00, 0xaf, 0x02, 0x00, 0xa5, 0x02, 0x00, 0xb5,
+0x03, 0x24, 0x00, 0x3c, 0x00, 0x09, 0x00, 0x1d, 0x00, 0x00, 0xd9, 0x02, 0x00, 0x95, 0x02, 0x00,
+0x81, 0x02, 0x00, 0xcd, 0x02, 0x36, 0x00, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xab, 0x02,
+0x00, 0xdf, 0x01, 0x00, 0xd7, 0x01, 0x00, 0xff, 0x01, 0x2c, 0x00, 0x4c, 0x00, 0x26, 0x00, 0x22,
+0x00, 0x00, 0xbd, 0x01, 0x00, 0x87, 0x01, 0x00, 0x99, 0x01, 0x00, 0xdf, 0x01, 0x9e, 0x01, 0x00,
+0x92, 0x01, 0x00, 0x64, 0x00, 0x56, 0x00, 0x00, 0x85, 0x01, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x67,
+0xa0, 0x01, 0x00, 0xac, 0x01, 0x00, 0x64, 0x00, 0x62, 0x00, 0x00, 0x4f, 0x00, 0x1e, 0x00, 0x1a,
+0x00, 0x55, 0xa0, 0x01, 0x00, 0xaa, 0x01, 0x00, 0x7c, 0x00, 0x7e, 0x00, 0x00, 0x1f, 0x00, 0x62,
+0x00, 0x52, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x9a, 0x01, 0x00, 0x76, 0x00, 0x68, 0x00, 0x00, 0x42,
+0x00, 0x64, 0x00, 0x60, 0x00, 0x26, 0x64, 0x00, 0x6a, 0x00, 0x4c, 0x00, 0x70, 0x00, 0x00, 0x60,
+0x00, 0x5c, 0x00, 0x60, 0x00, 0x52, 0x2e, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x00, 0x60,
+0x00, 0x76, 0x00, 0x6a, 0x00, 0x48, 0x48, 0x00, 0x34, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x00, 0x5a,
+0x00, 0x5e, 0x00, 0x60, 0x00, 0x62, 0x56, 0x00, 0x3a, 0x00, 0x34, 0x00, 0x44, 0x00, 0x00, 0x84,
+0x01, 0x00, 0xac, 0x01, 0x00, 0xb0, 0x01, 0x00, 0x78, 0x34, 0x00, 0x4e, 0x00, 0x22, 0x00, 0x08,
+0x00, 0x00, 0x70, 0x00, 0xac, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x74, 0x4e, 0x00, 0x48, 0x00, 0x2a,
+0x00, 0x52, 0x00, 0x00, 0x54, 0x00, 0x9c, 0x01, 0x00, 0xa4, 0x01, 0x00, 0x5c, 0x44, 0x00, 0x36,
+0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x46, 0x00, 0x48, 0x0b, 0x00, 0x05,
+0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x5a, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x4e, 0x35, 0x00, 0x27,
+0x00, 0x15, 0x00, 0x0d, 0x00, 0x00, 0x24, 0x00, 0x16, 0x00, 0x14, 0x00, 0x30, 0x1c, 0x00, 0x0e,
+0x00, 0x10, 0x00, 0x3c, 0x00,
+};
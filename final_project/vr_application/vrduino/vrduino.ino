@@ -9,11 +9,13 @@
 #include "PoseTracker.h"
 #include "PoseMath.h"
 #include "PulsePosition.h"
+#include "SessionRecorder.h"
 
 const unsigned int kOutputStringWidth = 40;
 
 //intialize orientation tracker
 double alphaImuFilter = 0.9;
+//simulating replays the recorded tables, see SimulationConfig.h
 bool simulateImu = false;
 OrientationTracker tracker(alphaImuFilter, simulateImu);
 
@@ -30,6 +32,10 @@ bool simulateLighthouse = false;
 //if test is true, then run tests in Test.cpp and exit
 bool test = false;
 
+//if true, stream raw IMU readings (and lighthouse sweeps with a PoseTracker)
+//as binary frames instead of the quaternion. see SessionRecorder.h
+bool recordSession = false;
+
 //mode of base station
 //0:A, 1:B, 2: C
 const int A = 0;
@@ -40,6 +46,8 @@ int baseStationMode = A;
 
 //PoseTracker tracker(alphaImuFilter, baseStationMode, simulateLighthouse);
 
+SessionRecorder recorder(Serial);
+
 void setup() {
 
   Serial.begin(115200);
@@ -47,6 +55,12 @@ void setup() {
   delay(1000);
 //END HW06
 
+  //without the tables or replay data, simulating silently gives no readings
+  if (!tracker.simulationReady()) {
+    Serial.println("ERROR: simulateImu/simulateLighthouse is set but there is nothing to replay. "
+      "set VRDUINO_SIMULATED_TABLES back to 1 in SimulationConfig.h or call setSimulatedImu()/setSimulatedLighthouse() first");
+  }
+
   tracker.initImu();
 
   //measures bias/variance
@@ -89,6 +103,10 @@ void setup() {
   delay(5000);
   tracker.resetOrientation();
   tracker.measureImuBiasVariance();
+
+  if (recordSession) {
+    recorder.begin(tracker, baseStationMode);
+  }
 }
 
 void testBiasVariance() {
@@ -811,6 +829,11 @@ void updatePosePrint() {
 
 
 void loop() {
+  if (recordSession) {
+    recorder.recordSensors(tracker);
+    return;
+  }
+
   if (!test)
   {
     bool imuTrack = false;
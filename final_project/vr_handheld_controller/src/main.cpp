@@ -9,8 +9,72 @@ This code is the code behind the handheld VR controller that broadcasts an IMU s
 #include <Arduino.h>
 #include <ArduinoBLE.h>
 #include <Arduino_LSM9DS1.h>
+#include <Wire.h>
+#include <utility/ATT.h>
+#include <utility/HCI.h>
+#include <ImuPacket.h>
+#include <ImuBatch.h>
+#include <ImuCodec.h>
+#include <NotifyControl.h>
+#include <Lsm9ds1Fifo.h>
+#include <MotionGate.h>
+#include <BleConnection.h>
+#include <SampleStream.h>
 
 #define BUTTON_PIN 3
+#define BUTTON_DEBOUNCE_US 5000
+
+// Maximum notifications per second of each stream, 0 for no limit
+#define ACC_MAX_NOTIFY_HZ 0
+#define GYR_MAX_NOTIFY_HZ 0
+#define MAG_MAX_NOTIFY_HZ 0
+#define BUTTON_MAX_NOTIFY_HZ 50
+#define SAMPLE_MAX_NOTIFY_HZ 0 // packed samples or batches
+
+// true: acc and gyr are read in bursts from the LSM9DS1 FIFO at IMU_ODR_HZ (see Lsm9ds1Fifo.h)
+// false: acc and gyr are polled one sample at a time at the Arduino_LSM9DS1 rate of 119 Hz
+#define USE_IMU_FIFO true
+#define IMU_ODR_HZ 238 // 14.9, 59.5, 119, 238, 476 or 952 Hz, higher rates are rounded up
+// Samples per burst, at 238 Hz 4 samples wake the MCU about every 17 ms
+#define IMU_FIFO_WATERMARK 4
+// Pin wired to INT1_A/G of the LSM9DS1, -1 to wake a watermark of sample periods after the last burst instead
+#define IMU_FIFO_INT_PIN -1
+#define IMU_I2C_CLOCK_HZ 400000
+
+// true: while the controller lies still it drops to IDLE_IMU_ODR_HZ and asks for a long connection interval until it
+// is moved or the button is pressed (see MotionGate.h), needs USE_IMU_FIFO
+#define USE_MOTION_GATE true
+#define MOTION_STILL_VARIANCE 0.0004f // g^2 summed over the axes, ~0.01 g of noise on each axis stays below it
+#define MOTION_WAKE_DEVIATION_G 0.05f
+#define MOTION_STILL_TIME_US 5000000
+#define MOTION_WINDOW_US 250000
+#define IDLE_IMU_ODR_HZ 14.9
+#define IDLE_IMU_FIFO_WATERMARK 2 // a burst every ~134 ms, which bounds the wake up latency on motion
+#define IDLE_BATCH_MAX_DELAY_US 500000
+#define IDLE_NAP_MS 10
+// Connection intervals asked from the receiver: the shortest one allowed while streaming, when a central connects and
+// again after the controller was idle
+#define ACTIVE_CONN_INTERVAL_MIN_US 7500
+#define ACTIVE_CONN_INTERVAL_MAX_US 7500
+#define IDLE_CONN_INTERVAL_MIN_US 100000
+#define IDLE_CONN_INTERVAL_MAX_US 200000
+#define CONN_SUPERVISION_TIMEOUT_US 4000000
+#define BLE_MAX_CONN_HANDLES 8 // handles searched for the connection, the controller only has one
+
+// true: each sample is sent as one notification of the packed sample characteristic (see ImuPacket.h)
+// false: legacy mode, one notification per sensor and one for the button
+#define USE_PACKED_SAMPLE true
+// true: packed samples are queued and sent several per notification of the batch characteristic (see ImuBatch.h)
+#define USE_SAMPLE_BATCHING true
+// Encoding of batches, floats (ImuBatch.h) or int16 in sensor units, optionally delta encoded (ImuCodec.h)
+#define BATCH_ENCODING_FLOAT 0
+#define BATCH_ENCODING_INT16 1
+#define BATCH_ENCODING_DELTA 2
+#define BATCH_ENCODING BATCH_ENCODING_DELTA
+// Batches are sized for the ATT MTU of the connection, which starts at 23 bytes and grows to the largest MTU both
+// Nano 33 BLEs support when the receiver discovers attributes
+// A batch is sent early when its oldest sample is this old so latency stays bounded at low sample rates
+#define BATCH_MAX_DELAY_US 20000
 
 #define ARDUINO_FLOAT_LENGTH_BYTES 4
 #define ACC_ELEMENTS 3
@@ -32,12 +96,237 @@ uint8_t *gyr_buffer = (uint8_t *) gyr;
 float mag[MAG_ELEMENTS] = {0.0,0.0,0.0};  // x,y,z muT (micro-Teslas)
 uint8_t *mag_buffer = (uint8_t *) mag;
 bool button_pressed = false;
+bool button_changed = false; // debounced edge not sent yet
+bool acc_updated = false;
+bool gyr_updated = false;
+
+bool readImuRegisters(uint8_t reg, uint8_t *data, int length);
+bool writeImuRegister(uint8_t reg, uint8_t value);
+
+ButtonDebouncer button(BUTTON_DEBOUNCE_US);
+NotifyRateLimiter acc_rate(ACC_MAX_NOTIFY_HZ);
+NotifyRateLimiter gyr_rate(GYR_MAX_NOTIFY_HZ);
+NotifyRateLimiter mag_rate(MAG_MAX_NOTIFY_HZ);
+NotifyRateLimiter button_rate(BUTTON_MAX_NOTIFY_HZ);
+NotifyRateLimiter sample_rate(SAMPLE_MAX_NOTIFY_HZ);
+
+ImuSample sample;
+uint8_t sample_buffer[IMU_SAMPLE_PACKET_LENGTH_BYTES];
+
+Lsm9ds1Fifo imu_fifo(readImuRegisters, writeImuRegister);
+ImuSample imu_burst[LSM9DS1_FIFO_SIZE];
+volatile bool imu_fifo_interrupt = false;
+uint32_t imu_fifo_next_us = 0;
+int imu_fifo_watermark = IMU_FIFO_WATERMARK;
+
+MotionGate motion_gate(MOTION_STILL_VARIANCE, MOTION_WAKE_DEVIATION_G, MOTION_STILL_TIME_US, MOTION_WINDOW_US);
+volatile bool button_interrupt = false;
+uint8_t conn_request_identifier = 0;
 
 BLEService IMUService(BLE_UUID_IMU_SERVICE); 
 BLECharacteristic IMUCharacteristicAcc(BLE_UUID_ACC, BLENotify, ARDUINO_FLOAT_LENGTH_BYTES*3, true); 
 BLECharacteristic IMUCharacteristicGyr(BLE_UUID_GYR, BLENotify, ARDUINO_FLOAT_LENGTH_BYTES*3, true); 
 BLECharacteristic IMUCharacteristicMag(BLE_UUID_MAG, BLENotify, ARDUINO_FLOAT_LENGTH_BYTES*3, true); 
 BLEBoolCharacteristic ButtonPressedCharacteristic(BLE_UUID_BUTTON, BLENotify);
+BLECharacteristic IMUCharacteristicSample(BLE_UUID_IMU_SAMPLE, BLENotify, IMU_SAMPLE_PACKET_LENGTH_BYTES, true);
+BLECharacteristic IMUCharacteristicBatch(BLE_UUID_IMU_BATCH, BLENotify, IMU_BATCH_MAX_LENGTH_BYTES);
+BLECharacteristic IMUCharacteristicCompactBatch(BLE_UUID_IMU_COMPACT_BATCH, BLENotify, IMU_CODEC_MAX_LENGTH_BYTES);
+
+// Sends the notifications of the sample streamer on the characteristic of their encoding (see SampleStream.h)
+class BleSampleTransport : public SampleTransport {
+public:
+    bool send(int encoding, const uint8_t *data, int length, uint32_t now_us) {
+        // ArduinoBLE returns 0 if the notification couldn't be queued, e.g. before the central subscribed
+        if (encoding == SAMPLE_ENCODING_PACKED) {
+            return IMUCharacteristicSample.writeValue(data, length) > 0;
+        }
+        else if (encoding == SAMPLE_ENCODING_BATCH) {
+            return IMUCharacteristicBatch.writeValue(data, length) > 0;
+        }
+        return IMUCharacteristicCompactBatch.writeValue(data, length) > 0;
+    }
+};
+
+BleSampleTransport ble_transport;
+SampleStreamer streamer(ble_transport,
+                        !USE_SAMPLE_BATCHING ? SAMPLE_ENCODING_PACKED :
+                        BATCH_ENCODING == BATCH_ENCODING_FLOAT ? SAMPLE_ENCODING_BATCH : SAMPLE_ENCODING_COMPACT_BATCH,
+                        BATCH_ENCODING == BATCH_ENCODING_DELTA, BATCH_MAX_DELAY_US);
+
+void sendSample(uint32_t now, uint32_t sample_us, bool pressed)
+{
+    // Sends acc, gyr, mag and button state from the same instant in a single notification
+    if (!USE_SAMPLE_BATCHING && !sample_rate.allow(now)) {
+        // Rate limited single samples are skipped without using up a sequence number, so they don't count as dropped
+        return;
+    }
+    sample.timestamp_us = sample_us;
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        sample.acc[i] = acc[i];
+        sample.gyr[i] = gyr[i];
+        sample.mag[i] = mag[i];
+    }
+    sample.button_pressed = pressed;
+    // A full queue drops the sample, the receiver sees the gap in the sequence numbers.
+    // A button edge sends the batch right away instead of waiting for it to fill.
+    streamer.push(sample);
+    if (streamer.due(now, button_changed) && (!USE_SAMPLE_BATCHING || sample_rate.allow(now))) {
+        streamer.send(now);
+        button_changed = false;
+    }
+}
+
+bool readImuRegisters(uint8_t reg, uint8_t *data, int length)
+{
+    // Same transfers as Arduino_LSM9DS1, which talks to the LSM9DS1 on Wire1
+    Wire1.beginTransmission(LSM9DS1_AG_ADDRESS);
+    Wire1.write(reg);
+    if (Wire1.endTransmission(false) != 0) {
+        return false;
+    }
+    if (Wire1.requestFrom(LSM9DS1_AG_ADDRESS, length) != (size_t)length) {
+        return false;
+    }
+    for (int i = 0; i < length; i++) {
+        data[i] = Wire1.read();
+    }
+    return true;
+}
+
+bool writeImuRegister(uint8_t reg, uint8_t value)
+{
+    Wire1.beginTransmission(LSM9DS1_AG_ADDRESS);
+    Wire1.write(reg);
+    Wire1.write(value);
+    return Wire1.endTransmission() == 0;
+}
+
+void onImuFifoInterrupt()
+{
+    imu_fifo_interrupt = true;
+}
+
+bool imuFifoDue(uint32_t now)
+{
+    return imu_fifo_interrupt || (int32_t)(now - imu_fifo_next_us) >= 0;
+}
+
+bool connectionHandle(uint16_t &handle)
+{
+    // ArduinoBLE doesn't expose the handle of a connection, the controller only has the one to the receiver
+    for (handle = 0; handle < BLE_MAX_CONN_HANDLES; handle++) {
+        if (ATT.connected(handle)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool requestConnectionInterval(uint32_t min_us, uint32_t max_us)
+{
+    // ArduinoBLE only asks for its preferred interval when a central connects, later changes are requested with an
+    // L2CAP signaling command on the connection (see BleConnection.h)
+    BleConnectionParameters parameters = {bleConnectionIntervalUnits(min_us), bleConnectionIntervalUnits(max_us), 0,
+                                          CONN_SUPERVISION_TIMEOUT_US / BLE_SUPERVISION_TIMEOUT_UNIT_US};
+    uint8_t request[L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES];
+    conn_request_identifier = conn_request_identifier == 0xFF ? 1 : conn_request_identifier + 1;
+    int length = encodeConnectionParameterRequest(parameters, conn_request_identifier, request);
+    uint16_t handle;
+    if (length == 0 || !connectionHandle(handle)) {
+        return false;
+    }
+    HCI.sendAclPkt(handle, L2CAP_LE_SIGNALING_CID, length, request);
+    return true;
+}
+
+void updateBatchCapacity(uint16_t mtu)
+{
+    // Called when a central connects and whenever the ATT MTU of the connection changes
+    streamer.setMtu(mtu);
+    Serial.print("ATT MTU: ");
+    Serial.print(mtu);
+    Serial.print(", samples per batch: ");
+    Serial.println(streamer.capacity());
+}
+
+void onButtonInterrupt()
+{
+    button_interrupt = true;
+}
+
+void setMotionIdle(bool idle, uint32_t now)
+{
+    // Still: low output data rate, larger bursts sent less often and a long connection interval so the radio mostly
+    // sleeps. Moving: back to the configured rate and a short interval.
+    imu_fifo_watermark = idle ? IDLE_IMU_FIFO_WATERMARK : IMU_FIFO_WATERMARK;
+    if (!imu_fifo.begin(idle ? IDLE_IMU_ODR_HZ : IMU_ODR_HZ, imu_fifo_watermark)) {
+        Serial.println("Changing IMU output data rate failed");
+    }
+    imu_fifo_next_us = now + imu_fifo_watermark*imu_fifo.samplePeriodUs();
+    streamer.setMaxDelay(idle ? IDLE_BATCH_MAX_DELAY_US : BATCH_MAX_DELAY_US);
+    bool requested = idle ? requestConnectionInterval(IDLE_CONN_INTERVAL_MIN_US, IDLE_CONN_INTERVAL_MAX_US) :
+                            requestConnectionInterval(ACTIVE_CONN_INTERVAL_MIN_US, ACTIVE_CONN_INTERVAL_MAX_US);
+    Serial.print(idle ? "Idle, variance " : "Active, variance ");
+    Serial.print(motion_gate.lastVariance(), 6);
+    Serial.print(" g^2, IMU at ");
+    Serial.print(imu_fifo.sampleRateHz());
+    Serial.println(requested ? "Hz, connection interval requested" : "Hz, connection interval request failed");
+}
+
+void readImuFifo(uint32_t now)
+{
+    imu_fifo_interrupt = false;
+    int count = imu_fifo.drain(imu_burst, LSM9DS1_FIFO_SIZE, now);
+    // Without the interrupt the next burst is due a watermark of periods from now. With it the timeout only catches
+    // a missed edge, INT1_A/G stays high if the FIFO refilled to the watermark while it was drained.
+    uint32_t burst_us = imu_fifo_watermark*imu_fifo.samplePeriodUs();
+    imu_fifo_next_us = now + (IMU_FIFO_INT_PIN >= 0 ? 2*burst_us : burst_us);
+    if (count < 0) {
+        Serial.println("Reading IMU FIFO failed");
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+    if (IMU.magneticFieldAvailable()) {
+        // Mag runs slower than acc/gyr and has no FIFO, all samples of the burst carry the latest reading
+        IMU.readMagneticField(mag[0], mag[1], mag[2]); // muT (micro-Teslas)
+        if (!USE_PACKED_SAMPLE && mag_rate.allow(now)) {
+            IMUCharacteristicMag.writeValue(mag_buffer, ARDUINO_FLOAT_LENGTH_BYTES*MAG_ELEMENTS);
+        }
+    }
+    bool motion_changed = false;
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < IMU_AXES; j++) {
+            acc[j] = imu_burst[i].acc[j];
+            gyr[j] = imu_burst[i].gyr[j];
+        }
+        if (USE_MOTION_GATE && motion_gate.update(imu_burst[i].acc, imu_burst[i].timestamp_us)) {
+            motion_changed = true;
+        }
+        if (USE_PACKED_SAMPLE) {
+            // Samples taken before the last button edge still carry the state from before it
+            bool pressed = button_pressed;
+            if (button.edgeCount() > 0 && (int32_t)(button.lastEdgeUs() - imu_burst[i].timestamp_us) > 0) {
+                pressed = !pressed;
+            }
+            sendSample(now, imu_burst[i].timestamp_us, pressed);
+        }
+    }
+    if (!USE_PACKED_SAMPLE) {
+        // Legacy notifications only carry the newest sample of the burst
+        if (acc_rate.allow(now)) {
+            IMUCharacteristicAcc.writeValue(acc_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+        }
+        if (gyr_rate.allow(now)) {
+            IMUCharacteristicGyr.writeValue(gyr_buffer, ARDUINO_FLOAT_LENGTH_BYTES*GYR_ELEMENTS);
+        }
+    }
+    if (motion_changed) {
+        setMotionIdle(motion_gate.idle(), now);
+    }
+}
 
 void setup() {
     delay(5000); // Delay so setup Serial output can be observed
@@ -45,6 +334,9 @@ void setup() {
 
     // Enable button pin for input
     pinMode(BUTTON_PIN, INPUT);
+    if (USE_IMU_FIFO && USE_MOTION_GATE) {
+        attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), onButtonInterrupt, CHANGE);
+    }
 
     // BLE
     if (!BLE.begin()){
@@ -61,6 +353,16 @@ void setup() {
     IMUService.addCharacteristic(IMUCharacteristicGyr);
     IMUService.addCharacteristic(IMUCharacteristicMag);
     IMUService.addCharacteristic(ButtonPressedCharacteristic);
+    // Only the characteristic of the selected sample format is offered, the receiver picks the best one it finds
+    if (USE_PACKED_SAMPLE && streamer.encoding() == SAMPLE_ENCODING_PACKED) {
+        IMUService.addCharacteristic(IMUCharacteristicSample);
+    }
+    else if (USE_PACKED_SAMPLE && streamer.encoding() == SAMPLE_ENCODING_BATCH) {
+        IMUService.addCharacteristic(IMUCharacteristicBatch);
+    }
+    else if (USE_PACKED_SAMPLE) {
+        IMUService.addCharacteristic(IMUCharacteristicCompactBatch);
+    }
     Serial.println("Added characteristics to service");
 
     BLE.addService(IMUService);
@@ -70,8 +372,13 @@ void setup() {
     IMUCharacteristicGyr.writeValue(gyr_buffer, ARDUINO_FLOAT_LENGTH_BYTES*3);
     IMUCharacteristicMag.writeValue(mag_buffer, ARDUINO_FLOAT_LENGTH_BYTES*3);
     ButtonPressedCharacteristic.writeValue(button_pressed);
+    packImuSample(sample, sample_buffer);
+    IMUCharacteristicSample.writeValue(sample_buffer, IMU_SAMPLE_PACKET_LENGTH_BYTES);
     Serial.println("Wrote initial characteristic values");
 
+    // ArduinoBLE asks a connecting central for this interval (in 1.25 ms units)
+    BLE.setConnectionInterval(bleConnectionIntervalUnits(ACTIVE_CONN_INTERVAL_MIN_US),
+                              bleConnectionIntervalUnits(ACTIVE_CONN_INTERVAL_MAX_US));
     BLE.advertise();  
     Serial.println("Started BLE advertising");
     Serial.println("***BLE initialization complete***");
@@ -85,13 +392,32 @@ void setup() {
         while (1);
     }
     Serial.println("***IMU module started***");
-    Serial.print("Accelerometer sample rate = ");
-    Serial.print(IMU.accelerationSampleRate());
-    Serial.println("Hz");
+    if (USE_IMU_FIFO) {
+        // Reconfigures acc/gyr behind Arduino_LSM9DS1, which keeps them at 119 Hz and has no FIFO support
+        Wire1.setClock(IMU_I2C_CLOCK_HZ);
+        if (!imu_fifo.begin(IMU_ODR_HZ, IMU_FIFO_WATERMARK)) {
+            Serial.println("Starting IMU FIFO failed!");
+            while (1);
+        }
+        if (IMU_FIFO_INT_PIN >= 0) {
+            pinMode(IMU_FIFO_INT_PIN, INPUT);
+            attachInterrupt(digitalPinToInterrupt(IMU_FIFO_INT_PIN), onImuFifoInterrupt, RISING);
+        }
+        Serial.print("Accelerometer and gyroscope sample rate = ");
+        Serial.print(imu_fifo.sampleRateHz());
+        Serial.print("Hz from the FIFO, ");
+        Serial.print(IMU_FIFO_WATERMARK);
+        Serial.println(" samples per burst");
+    }
+    else {
+        Serial.print("Accelerometer sample rate = ");
+        Serial.print(IMU.accelerationSampleRate());
+        Serial.println("Hz");
 
-    Serial.print("Gyroscope sample rate = ");
-    Serial.print(IMU.gyroscopeSampleRate());
-    Serial.println("Hz");
+        Serial.print("Gyroscope sample rate = ");
+        Serial.print(IMU.gyroscopeSampleRate());
+        Serial.println("Hz");
+    }
 
     Serial.print("Magnetometer sample rate = ");
     Serial.print(IMU.magneticFieldSampleRate());
@@ -110,28 +436,102 @@ void loop() {
         Serial.print("MAC address: ");
         Serial.println(central.address());
 
+        streamer.reset();
+        uint16_t handle = 0;
+        bool have_handle = connectionHandle(handle);
+        updateBatchCapacity(have_handle ? ATT.mtu(handle) : BLE_ATT_DEFAULT_MTU);
+        Serial.println(requestConnectionInterval(ACTIVE_CONN_INTERVAL_MIN_US, ACTIVE_CONN_INTERVAL_MAX_US) ?
+                       "Requested connection interval" : "Requesting connection interval failed");
+        acc_updated = false;
+        gyr_updated = false;
+        button_changed = false;
+        acc_rate.reset();
+        gyr_rate.reset();
+        mag_rate.reset();
+        button_rate.reset();
+        sample_rate.reset();
+        if (USE_IMU_FIFO) {
+            // Restarting the FIFO discards the samples queued while disconnected
+            imu_fifo_watermark = IMU_FIFO_WATERMARK;
+            imu_fifo.begin(IMU_ODR_HZ, imu_fifo_watermark);
+            imu_fifo_interrupt = false;
+            imu_fifo_next_us = micros() + imu_fifo_watermark*imu_fifo.samplePeriodUs();
+            motion_gate.wake(micros());
+            button_interrupt = false;
+            streamer.setMaxDelay(BATCH_MAX_DELAY_US);
+        }
         while (central.connected()) {
-            if (IMU.accelerationAvailable()) {
+            uint32_t now = micros();
+            if (have_handle && ATT.mtu(handle) != streamer.mtu()) {
+                updateBatchCapacity(ATT.mtu(handle));
+            }
+            if (USE_IMU_FIFO) {
+                if (USE_MOTION_GATE && button_interrupt) {
+                    // The button wakes the controller right away, its state is still debounced below
+                    button_interrupt = false;
+                    if (motion_gate.wake(now)) {
+                        setMotionIdle(false, now);
+                    }
+                }
+                if (imuFifoDue(now)) {
+                    readImuFifo(now);
+                }
+            }
+            else if (IMU.accelerationAvailable()) {
                 // Acc range [-4,+4]g -/+0.122 mg
                 IMU.readAcceleration(acc[0], acc[1], acc[2]); // g = 9.80665 m/s^2
-                IMUCharacteristicAcc.writeValue(acc_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                acc_updated = true;
+                if (!USE_PACKED_SAMPLE && acc_rate.allow(now)) {
+                    IMUCharacteristicAcc.writeValue(acc_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                }
             }
-            if (IMU.gyroscopeAvailable()) {
+            if (!USE_IMU_FIFO && IMU.gyroscopeAvailable()) {
                 // Gyr range [-2000, +2000] dps +/-70 mdps
                 IMU.readGyroscope(gyr[0], gyr[1], gyr[2]); // deg/s
-                IMUCharacteristicGyr.writeValue(gyr_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                gyr_updated = true;
+                if (!USE_PACKED_SAMPLE && gyr_rate.allow(now)) {
+                    IMUCharacteristicGyr.writeValue(gyr_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                }
             }
-            if (IMU.magneticFieldAvailable()) {
+            if (!USE_IMU_FIFO && IMU.magneticFieldAvailable()) {
                 // Mag range  [-400, +400] uT +/-0.014 uT
+                // Mag runs slower than acc/gyr, packed samples carry the latest reading
                 IMU.readMagneticField(mag[0], mag[1], mag[2]); // muT (micro-Teslas)
-                IMUCharacteristicMag.writeValue(mag_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                if (!USE_PACKED_SAMPLE && mag_rate.allow(now)) {
+                    IMUCharacteristicMag.writeValue(mag_buffer, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+                }
+            }
+            if (button.update(digitalRead(BUTTON_PIN) == HIGH, now)) {
+                button_pressed = button.pressed();
+                button_changed = true;
+            }
+            if (USE_PACKED_SAMPLE) {
+                // Acc and gyr share the same output data rate, send once both have a new reading
+                if (acc_updated && gyr_updated) {
+                    sendSample(now, now, button_pressed);
+                    acc_updated = false;
+                    gyr_updated = false;
+                }
+            }
+            else if (button_changed && button_rate.allow(now)) {
+                // Button state is only sent on debounced edges, a rate limited edge is sent on a later pass
+                ButtonPressedCharacteristic.writeValue(button_pressed);
+                button_changed = false;
+            }
+            uint32_t nap_ms = motion_gate.idle() ? IDLE_NAP_MS : 1;
+            if (USE_IMU_FIFO && !imu_fifo_interrupt && !button_interrupt &&
+                (int32_t)(imu_fifo_next_us - micros()) > (int32_t)(1000*nap_ms)) {
+                // Nothing to do until the next burst, sleeping lets the idle thread put the CPU to sleep. The button
+                // is still polled every nap, within its debounce time while active.
+                delay(nap_ms);
             }
-            // Send button state
-            button_pressed = (digitalRead(BUTTON_PIN) == HIGH); 
-            ButtonPressedCharacteristic.writeValue(button_pressed);
         }
 
         Serial.println("Disconnected to central device");
+        if (USE_IMU_FIFO) {
+            Serial.print("IMU FIFO overruns: ");
+            Serial.println(imu_fifo.overruns());
+        }
 
     }
 
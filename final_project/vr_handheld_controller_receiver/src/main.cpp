@@ -13,7 +13,20 @@ This code is the code behind the bluetooth receiver of the handheld VR controlle
 
 #include <Arduino.h>
 #include <ArduinoBLE.h>
+#include <utility/ATT.h>
+#include <utility/HCI.h>
 #include <Arduino_LSM9DS1.h>
+#include <ImuPacket.h>
+#include <ImuBatch.h>
+#include <ImuCodec.h>
+#include <RingBuffer.h>
+#include <LatencyHistogram.h>
+#include <SerialFrame.h>
+#include <GestureSegmenter.h>
+#include <GestureClassifier.h>
+#include <BleConnection.h>
+#include <LinkStats.h>
+#include <SampleStream.h>
 
 #define ARDUINO_FLOAT_LENGTH_BYTES 4
 #define ARDUINO_BOOL_LENGTH_BYTES 1
@@ -27,12 +40,84 @@ This code is the code behind the bluetooth receiver of the handheld VR controlle
 #define BLE_UUID_MAG "55584dd1-b773-44aa-a38d-ed6d9c94a851"
 #define BLE_UUID_BUTTON "017fa2e8-b256-47bf-953b-a494b75fb9bf"
 
+// Sample formats a controller may offer, in order of preference
+#define SAMPLE_FORMAT_COMPACT_BATCH 0
+#define SAMPLE_FORMAT_BATCH 1
+#define SAMPLE_FORMAT_PACKED 2
+#define SAMPLE_FORMAT_LEGACY 3
+
+#define RECEIVE_BUFFER_SIZE 64
+#define LATENCY_REPORT_INTERVAL_MS 10000
+// Controllers connected at the same time, e.g. one per hand. ArduinoBLE supports a few more concurrent connections
+// (ATT_MAX_PEERS), each one costs a receive buffer and a gesture segmenter of RAM here.
+#define MAX_CONTROLLERS 2
+
+// Link parameters asked for after connecting, see BleConnection.h. The controller also asks for the interval itself.
+#define LINK_CONN_INTERVAL_US 7500
+#define LINK_SUPERVISION_TIMEOUT_US 4000000
+#define LINK_DATA_LENGTH_OCTETS BLE_DATA_LENGTH_MAX_OCTETS // a whole 247 byte MTU notification per link layer packet
+#define LINK_USE_2M_PHY true
+#define BLE_MAX_CONN_HANDLES 8 // handles searched for a new connection
+
 float acc[ACC_ELEMENTS] = {0.0,0.0,0.0}; // x,y,z g = 9.80665 m/s^2
 float gyr[GYR_ELEMENTS] = {0.0,0.0,0.0}; // x,y,z deg/s
 float mag[MAG_ELEMENTS] = {0.0,0.0,0.0};  // x,y,z muT (micro-Teslas)
 bool buttonPressed = false;
 
+// Samples are pushed by the characteristic event handlers (run from BLE.poll()) and drained by the serial writer
+struct ReceivedSample {
+    ImuSample sample;
+    uint32_t arrival_us; // micros() when the notification carrying the sample was handled
+};
+
+// State of one connected controller, its index in controllers is the controller id written with its samples
+struct Controller {
+    BLEDevice peripheral;
+    bool connected;
+    int sampleFormat;
+    RingBuffer<ReceivedSample, RECEIVE_BUFFER_SIZE> receivedSamples;
+    bool sequenceValid;
+    uint16_t lastSequence;
+    unsigned long droppedSamples;
+    unsigned long overflowedSamples; // part of droppedSamples lost because the serial writer fell behind
+    // Latest values of the legacy characteristics, which carry no sequence numbers
+    float acc[ACC_ELEMENTS];
+    float gyr[GYR_ELEMENTS];
+    float mag[MAG_ELEMENTS];
+    bool buttonPressed;
+    bool legacyUpdated;
+    uint32_t legacyArrivalUs;
+    uint16_t legacySequence;
+    GestureSegmenter gestureSegmenter;
+    uint16_t connHandle;
+    uint16_t mtu; // ATT MTU last seen while connected
+    bool notified;
+    uint32_t lastNotificationUs;
+    LatencyHistogram notificationGaps; // time between sample notifications, bounded below by the connection interval
+    LinkStats linkStats; // controller to receiver latency from the sample timestamps, jitter and loss
+};
+Controller controllers[MAX_CONTROLLERS];
+int nextDrainController = 0; // controller the serial writer starts with in its next round
+bool scanning = false;
+ImuSample batchSamples[SAMPLE_PACKET_MAX_SAMPLES];
+
+// Time from a notification being handled until its values are written to serial
+LatencyHistogram latency;
+unsigned long lastLatencyReportMs = 0;
+
 bool printForViz = false;
+bool binaryOutput = false; // fixed size COBS frames (see SerialFrame.h) instead of text lines
+ImuSample currentSample; // latest sample, written as a frame in binary mode
+int currentController = 0; // controller currentSample came from
+uint8_t frameBuffer[SERIAL_FRAME_LENGTH_BYTES];
+
+// Gesture record output, one resampled record per button press instead of a line/frame per sample
+bool gestureOutput = false;
+float gestureFeatures[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH];
+uint8_t gestureRecord[GESTURE_RECORD_LENGTH_BYTES];
+// In binary mode gestures are also classified on the receiver when a model was exported, see GestureClassifier.h
+GestureClassifier gestureClassifier;
+GesturePrediction gesturePrediction;
 bool print_a = false;
 bool print_g = false;
 bool print_m = false;
@@ -129,73 +214,394 @@ void printIMUVals(float *acc, float *gyr, float *mag)
     Serial.println();
 }
 
-void setup() {
-    delay(5000); // Delay so setup Serial output can be observed
-    Serial.begin(15200); 
-    while (!Serial); // Wait if serial is not ready- may want to change this but for training this is useful so doesn't start until serial connection is made
+Controller *controllerFor(const BLEDevice &device)
+{
+    for (int i = 0; i < MAX_CONTROLLERS; i++)
+    {
+        if (controllers[i].connected && controllers[i].peripheral == device){
+            return &controllers[i];
+        }
+    }
+    return NULL;
+}
 
-    Serial.println(F("Press y in next 3 seconds for visualization print out"));
-    delay(3000);
-    if (Serial.available())
+int connectedControllers()
+{
+    int count = 0;
+    for (int i = 0; i < MAX_CONTROLLERS; i++)
     {
-        char data = Serial.read();
-        if (data == 'y'){
-            printForViz = true;
+        if (controllers[i].connected){
+            count++;
         }
     }
+    return count;
+}
 
-    // BLE 
-    if (!BLE.begin()){
-        Serial.println(F("Starting BLE module failed!"));
-        while (1);
+void applySample(Controller &controller, const ImuSample &sample)
+{
+    // Copies a received sample into acc, gyr, mag and buttonPressed, counting dropped samples
+    if (controller.sequenceValid){
+        controller.droppedSamples += imuSequenceGap(controller.lastSequence, sample.sequence);
     }
-    Serial.println(F("***Started BLE module***"));
+    controller.lastSequence = sample.sequence;
+    controller.sequenceValid = true;
 
-    BLE.advertise();  
-    Serial.println(F("Started BLE advertising"));
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        acc[i] = sample.acc[i];
+        gyr[i] = sample.gyr[i];
+        mag[i] = sample.mag[i];
+    }
+    buttonPressed = sample.button_pressed;
+    currentSample = sample;
+}
 
-    Serial.println(F("***BLE initialization complete***"));
-    Serial.println();
-    Serial.println();
+void pushSamples(const BLEDevice &device, const ImuSample *samples, int n)
+{
+    Controller *controller = controllerFor(device);
+    if (!controller){
+        return;
+    }
+    uint32_t now = micros();
+    if (controller->notified){
+        controller->notificationGaps.add(now - controller->lastNotificationUs);
+    }
+    controller->notified = true;
+    controller->lastNotificationUs = now;
+    ReceivedSample received;
+    received.arrival_us = now;
+    for (int i = 0; i < n; i++)
+    {
+        controller->linkStats.add(samples[i], now);
+        received.sample = samples[i];
+        if (!controller->receivedSamples.push(received)){
+            controller->overflowedSamples++;
+        }
+    }
+}
 
-    BLE.scanForUuid(BLE_UUID_IMU_SERVICE);
-    Serial.println(F("Started scanning for uuid"));
+void receiveSamples(const BLEDevice &device, int encoding, BLECharacteristic &characteristic)
+{
+    // Same decoding as on the host over LoopbackTransport, see SampleStream.h
+    int n = decodeSamplePacket(encoding, characteristic.value(), characteristic.valueLength(), batchSamples);
+    if (n > 0){
+        pushSamples(device, batchSamples, n);
+    }
 }
 
+void onCompactBatchUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    receiveSamples(device, SAMPLE_ENCODING_COMPACT_BATCH, characteristic);
+}
 
-void loop() {
-    BLEDevice peripheral = BLE.available();
-    Serial.println(F("Discovering peripheral device"));
-    // Exit loop() until peripheral is found (Note loop() will be called again, so like calling continue)
-    if (!peripheral){
-        return;
+void onBatchUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    receiveSamples(device, SAMPLE_ENCODING_BATCH, characteristic);
+}
+
+void onPackedSampleUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    receiveSamples(device, SAMPLE_ENCODING_PACKED, characteristic);
+}
+
+void readLegacyValue(Controller &controller, BLECharacteristic &characteristic, void *value, int length)
+{
+    // Legacy characteristics carry no sequence numbers, only the latest values are kept
+    if (characteristic.valueLength() == length){
+        memcpy(value, characteristic.value(), length);
+        if (!controller.legacyUpdated){
+            controller.legacyArrivalUs = micros();
+        }
+        controller.legacyUpdated = true;
     }
+}
 
-    Serial.println(F("***Peripheral device discovered***"));
-    Serial.print(F("MAC address: "));
-    Serial.println(peripheral.address());
-    Serial.print(F("Device name: "));
-    Serial.println(peripheral.localName());
-    Serial.print(F("Advertised service UUID: "));
-    Serial.println(peripheral.advertisedServiceUuid());
+void onAccUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    Controller *controller = controllerFor(device);
+    if (controller){
+        readLegacyValue(*controller, characteristic, controller->acc, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+    }
+}
+
+void onGyrUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    Controller *controller = controllerFor(device);
+    if (controller){
+        readLegacyValue(*controller, characteristic, controller->gyr, ARDUINO_FLOAT_LENGTH_BYTES*GYR_ELEMENTS);
+    }
+}
+
+void onMagUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    Controller *controller = controllerFor(device);
+    if (controller){
+        readLegacyValue(*controller, characteristic, controller->mag, ARDUINO_FLOAT_LENGTH_BYTES*MAG_ELEMENTS);
+    }
+}
+
+void onButtonUpdated(BLEDevice device, BLECharacteristic characteristic)
+{
+    Controller *controller = controllerFor(device);
+    if (controller){
+        readLegacyValue(*controller, characteristic, &controller->buttonPressed, ARDUINO_BOOL_LENGTH_BYTES);
+    }
+}
+
+void classifyGesture(Controller &controller)
+{
+    // Classifies the gesture the controller's segmenter just completed and writes the result as a gesture frame
+    controller.gestureSegmenter.resample(gestureFeatures);
+    uint32_t start = micros();
+    gestureClassifier.classify(gestureFeatures, gesturePrediction);
+
+    const GestureInfo &info = controller.gestureSegmenter.info();
+    GestureResult result;
+    result.inference_us = micros() - start;
+    result.number = info.number;
+    result.start_us = info.start_us;
+    result.duration_us = info.duration_us;
+    result.num_samples = info.num_samples;
+    result.label = gesturePrediction.label;
+    result.confidence = gesturePrediction.confidence;
+    result.controller = currentController;
+    encodeGestureFrame(result, frameBuffer);
+    Serial.write(frameBuffer, SERIAL_FRAME_LENGTH_BYTES);
+}
+
+void printVals(Controller &controller)
+{
+    if (gestureOutput)
+    {
+        if (controller.gestureSegmenter.update(currentSample))
+        {
+            controller.gestureSegmenter.resample(gestureFeatures);
+            int length = encodeGestureRecord(controller.gestureSegmenter.info(), currentController, gestureFeatures, gestureRecord);
+            Serial.write(gestureRecord, length);
+        }
+    }
+    else if (binaryOutput)
+    {
+        encodeSampleFrame(currentSample, currentController, frameBuffer);
+        Serial.write(frameBuffer, SERIAL_FRAME_LENGTH_BYTES);
+        if (GestureClassifier::available() && controller.gestureSegmenter.update(currentSample))
+        {
+            classifyGesture(controller);
+        }
+    }
+    else if (printForViz)
+    {
+        if (Serial.available())
+        {
+            char data = Serial.read();
+            if (data == 'a'){
+                print_a = !print_a;
+            }
+            if (data == 'g'){
+                print_g = !print_g;
+            }
+            if (data == 'm'){
+                print_m = !print_m;
+            }
+        }
+        printIMUValsForViz(acc, gyr, mag, print_a, print_g, print_m);
+    }
+    else
+    {
+        // Lines of the first controller keep the 10 field format, the others are prefixed with their id (c1; ...)
+        if (currentController > 0){
+            Serial.print(F("c"));
+            Serial.print(currentController);
+            Serial.print(F(";"));
+        }
+        printIMUVals(acc, gyr, mag);
+    }
+}
+
+bool takeLegacySample(Controller &controller)
+{
+    // Turns the latest legacy values into a sample, legacy characteristics have no sequence numbers or timestamps so
+    // frames use the arrival order and time
+    if (!controller.legacyUpdated){
+        return false;
+    }
+    controller.legacyUpdated = false;
+    currentSample.sequence = controller.legacySequence++;
+    currentSample.timestamp_us = controller.legacyArrivalUs;
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        currentSample.acc[i] = acc[i] = controller.acc[i];
+        currentSample.gyr[i] = gyr[i] = controller.gyr[i];
+        currentSample.mag[i] = mag[i] = controller.mag[i];
+    }
+    currentSample.button_pressed = buttonPressed = controller.buttonPressed;
+    return true;
+}
+
+void drainReceivedSamples()
+{
+    // Serial writer, prints every received sample once, in order per controller. Each round takes at most one sample
+    // from every controller, and the controller going first rotates, so a controller sending faster can't delay the
+    // samples of the others.
+    bool pending = true;
+    while (pending)
+    {
+        pending = false;
+        for (int i = 0; i < MAX_CONTROLLERS; i++)
+        {
+            currentController = (nextDrainController + i) % MAX_CONTROLLERS;
+            Controller &controller = controllers[currentController];
+            ReceivedSample received;
+            if (controller.receivedSamples.pop(received))
+            {
+                applySample(controller, received.sample);
+                printVals(controller);
+                latency.add(micros() - received.arrival_us);
+                pending = true;
+            }
+            else if (takeLegacySample(controller))
+            {
+                printVals(controller);
+                latency.add(micros() - controller.legacyArrivalUs);
+            }
+        }
+        nextDrainController = (nextDrainController + 1) % MAX_CONTROLLERS;
+    }
+}
+
+void printLatencyReport()
+{
+    Serial.print(F("Latency us: n="));
+    Serial.print(latency.count());
+    Serial.print(F(" mean="));
+    Serial.print(latency.meanUs());
+    Serial.print(F(" p50<="));
+    Serial.print(latency.percentileUs(50));
+    Serial.print(F(" p99<="));
+    Serial.print(latency.percentileUs(99));
+    Serial.print(F(" max="));
+    Serial.println(latency.maxUs());
+    Serial.print(F("Latency histogram us:"));
+    for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        if (latency.bucketCount(i) > 0){
+            Serial.print(F(" >="));
+            Serial.print(latency.bucketLowerUs(i));
+            Serial.print(F(":"));
+            Serial.print(latency.bucketCount(i));
+        }
+    }
     Serial.println();
+}
 
-    if (peripheral.localName() != BLE_LOCAL_NAME_IMU){
-        Serial.println(F("Incorrect local name"));
-        return;
+void printLinkReport(Controller &controller, int id)
+{
+    Serial.print(F("Link c"));
+    Serial.print(id);
+    if (controller.peripheral.connected()){
+        controller.mtu = ATT.mtu(controller.connHandle);
     }
+    Serial.print(F(": ATT MTU="));
+    Serial.print(controller.mtu);
+    Serial.print(F(" notification gap us: n="));
+    Serial.print(controller.notificationGaps.count());
+    Serial.print(F(" p50<="));
+    Serial.print(controller.notificationGaps.percentileUs(50));
+    Serial.print(F(" p99<="));
+    Serial.print(controller.notificationGaps.percentileUs(99));
+    Serial.print(F(" max="));
+    Serial.println(controller.notificationGaps.maxUs());
+
+    // Sample age on arrival above the fastest samples, see LinkStats.h
+    const LatencyHistogram &linkLatency = controller.linkStats.latency();
+    Serial.print(F("Link c"));
+    Serial.print(id);
+    Serial.print(F(": sample latency us: n="));
+    Serial.print(linkLatency.count());
+    Serial.print(F(" mean="));
+    Serial.print(linkLatency.meanUs());
+    Serial.print(F(" p50<="));
+    Serial.print(linkLatency.percentileUs(50));
+    Serial.print(F(" p99<="));
+    Serial.print(linkLatency.percentileUs(99));
+    Serial.print(F(" max="));
+    Serial.print(linkLatency.maxUs());
+    Serial.print(F(" jitter="));
+    Serial.print(controller.linkStats.jitterUs());
+    Serial.print(F(" dropped="));
+    Serial.print(controller.linkStats.dropped());
+    Serial.print(F("/"));
+    Serial.print(controller.linkStats.received() + controller.linkStats.dropped());
+    Serial.print(F(" drift ppm="));
+    Serial.println(controller.linkStats.driftPpm());
+}
 
-    BLE.stopScan();
+bool newConnectionHandle(uint16_t &handle)
+{
+    // ArduinoBLE doesn't expose the handle of a connection, a new one is the connected handle no controller owns yet
+    for (handle = 0; handle < BLE_MAX_CONN_HANDLES; handle++)
+    {
+        if (!ATT.connected(handle)){
+            continue;
+        }
+        bool owned = false;
+        for (int i = 0; i < MAX_CONTROLLERS; i++)
+        {
+            owned = owned || (controllers[i].connected && controllers[i].connHandle == handle);
+        }
+        if (!owned){
+            return true;
+        }
+    }
+    return false;
+}
 
+void negotiateLink(Controller &controller)
+{
+    // Without these requests the link keeps the parameters ArduinoBLE connects with. Each one only starts a link
+    // layer procedure, the controller may settle on other values, the status printed is whether it was started.
+    uint16_t handle = controller.connHandle;
+    uint16_t interval = bleConnectionIntervalUnits(LINK_CONN_INTERVAL_US);
+    int intervalStatus = HCI.leConnUpdate(handle, interval, interval, 0, LINK_SUPERVISION_TIMEOUT_US / BLE_SUPERVISION_TIMEOUT_UNIT_US);
+    uint8_t command[HCI_LE_SET_PHY_LENGTH_BYTES];
+    int length = encodeSetDataLength(handle, LINK_DATA_LENGTH_OCTETS, command);
+    int dataLengthStatus = HCI.sendCommand(HCI_LE_SET_DATA_LENGTH, length, command);
+    int phyStatus = -1;
+    if (LINK_USE_2M_PHY){
+        length = encodeSetPhy(handle, BLE_PHY_2M, command);
+        phyStatus = HCI.sendCommand(HCI_LE_SET_PHY, length, command);
+    }
+
+    Serial.print(F("Link requests (0 = started): connection interval "));
+    Serial.print(interval * BLE_CONN_INTERVAL_UNIT_US);
+    Serial.print(F("us: "));
+    Serial.print(intervalStatus);
+    Serial.print(F(", data length "));
+    Serial.print(LINK_DATA_LENGTH_OCTETS);
+    Serial.print(F(": "));
+    Serial.print(dataLengthStatus);
+    Serial.print(F(", 2M PHY: "));
+    Serial.println(phyStatus);
+    controller.mtu = ATT.mtu(handle);
+    Serial.print(F("ATT MTU: "));
+    Serial.println(controller.mtu);
+}
+
+bool connectController(BLEDevice &peripheral, int id)
+{
+    // Connects to a discovered controller and subscribes to its samples, which are then received into controllers[id]
     Serial.println(F("Connecting to peripheral device"));
     if (peripheral.connect()){
         Serial.println(F("Connected to peripheral device"));
     }
     else{
         Serial.println(F("Failed to connect to peripheral device"));
-        return;
+        return false;
     }
 
+    uint16_t connHandle = 0;
+    bool haveHandle = newConnectionHandle(connHandle);
+
     Serial.println(F("Discovering peripheral device attributes"));
     if (peripheral.discoverAttributes()){
         Serial.println(F("Peripheral device attributes discovered"));
@@ -203,110 +609,279 @@ void loop() {
     else{
         Serial.println(F("Failed to discover peripheral device attributes"));
         peripheral.disconnect();
-        return;
+        return false;
     }
 
-    BLECharacteristic IMUCharacteristicAcc = peripheral.characteristic(BLE_UUID_ACC);
-    if (!IMUCharacteristicAcc){
-        Serial.println(F("Peripheral doesn't have Acc characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicAcc.canSubscribe()){
-        Serial.println(F("Peripheral does not have subscribeable Acc characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicAcc.subscribe()){
-        Serial.println(F("Did not successfully subscribe to Acc characteristic!"));
-        peripheral.disconnect();
-        return;
+    // The slot is taken before subscribing so the event handlers find it for the first notification
+    Controller &controller = controllers[id];
+    controller.peripheral = peripheral;
+    controller.connected = true;
+    controller.connHandle = connHandle;
+    controller.mtu = BLE_ATT_DEFAULT_MTU;
+    controller.sequenceValid = false;
+    controller.droppedSamples = 0;
+    controller.overflowedSamples = 0;
+    controller.legacyUpdated = false;
+    controller.legacySequence = 0;
+    controller.receivedSamples.clear();
+    controller.gestureSegmenter.reset(); // a gesture interrupted by a disconnect is dropped
+    controller.notified = false;
+    controller.notificationGaps.clear();
+    controller.linkStats.clear();
+    if (connectedControllers() == 1){
+        latency.clear();
+        lastLatencyReportMs = millis();
     }
 
-    BLECharacteristic IMUCharacteristicGyr = peripheral.characteristic(BLE_UUID_GYR);
-    if (!IMUCharacteristicGyr){
-        Serial.println(F("Peripheral doesn't have Gyr characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicGyr.canSubscribe()){
-        Serial.println(F("Peripheral does not have subscribeable Gyr characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicGyr.subscribe()){
-        Serial.println(F("Did not successfully subscribe to Gyr characteristic!"));
-        peripheral.disconnect();
-        return;
+    // Prefer sample batches, then single packed samples, fall back to one characteristic per sensor for older controllers
+    BLECharacteristic IMUCharacteristicCompactBatch = peripheral.characteristic(BLE_UUID_IMU_COMPACT_BATCH);
+    BLECharacteristic IMUCharacteristicBatch = peripheral.characteristic(BLE_UUID_IMU_BATCH);
+    BLECharacteristic IMUCharacteristicSample = peripheral.characteristic(BLE_UUID_IMU_SAMPLE);
+    if (IMUCharacteristicCompactBatch && IMUCharacteristicCompactBatch.canSubscribe() && IMUCharacteristicCompactBatch.subscribe()){
+        controller.sampleFormat = SAMPLE_FORMAT_COMPACT_BATCH;
     }
-
-    BLECharacteristic IMUCharacteristicMag = peripheral.characteristic(BLE_UUID_MAG);
-    if (!IMUCharacteristicMag){
-        Serial.println(F("Peripheral doesn't have Mag characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicMag.canSubscribe()){
-        Serial.println(F("Peripheral does not have subscribeable Mag characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!IMUCharacteristicMag.subscribe()){
-        Serial.println(F("Did not successfully subscribe to Mag characteristic!"));
-        peripheral.disconnect();
-        return;
+    else if (IMUCharacteristicBatch && IMUCharacteristicBatch.canSubscribe() && IMUCharacteristicBatch.subscribe()){
+        controller.sampleFormat = SAMPLE_FORMAT_BATCH;
+    }
+    else if (IMUCharacteristicSample && IMUCharacteristicSample.canSubscribe() && IMUCharacteristicSample.subscribe()){
+        controller.sampleFormat = SAMPLE_FORMAT_PACKED;
+    }
+    else{
+        controller.sampleFormat = SAMPLE_FORMAT_LEGACY;
     }
+    IMUCharacteristicCompactBatch.setEventHandler(BLEUpdated, onCompactBatchUpdated);
+    IMUCharacteristicBatch.setEventHandler(BLEUpdated, onBatchUpdated);
+    IMUCharacteristicSample.setEventHandler(BLEUpdated, onPackedSampleUpdated);
 
+    BLECharacteristic IMUCharacteristicAcc = peripheral.characteristic(BLE_UUID_ACC);
+    BLECharacteristic IMUCharacteristicGyr = peripheral.characteristic(BLE_UUID_GYR);
+    BLECharacteristic IMUCharacteristicMag = peripheral.characteristic(BLE_UUID_MAG);
     BLECharacteristic ButtonPressedCharacteristic = peripheral.characteristic(BLE_UUID_BUTTON);
-    if (!ButtonPressedCharacteristic){
-        Serial.println(F("Peripheral doesn't have Button Pressed characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!ButtonPressedCharacteristic.canSubscribe()){
-        Serial.println(F("Peripheral does not have subscribeable Button Pressed characteristic!"));
-        peripheral.disconnect();
-        return;
-    } else if (!ButtonPressedCharacteristic.subscribe()){
-        Serial.println(F("Did not successfully subscribe to Button Pressed characteristic!"));
-        peripheral.disconnect();
-        return;
+    if (controller.sampleFormat == SAMPLE_FORMAT_COMPACT_BATCH){
+        Serial.println(F("Subscribed to compact sample batch characteristic"));
+    }
+    else if (controller.sampleFormat == SAMPLE_FORMAT_BATCH){
+        Serial.println(F("Subscribed to sample batch characteristic"));
     }
+    else if (controller.sampleFormat == SAMPLE_FORMAT_PACKED){
+        Serial.println(F("Subscribed to packed sample characteristic"));
+    }
+    else{
+        IMUCharacteristicAcc.setEventHandler(BLEUpdated, onAccUpdated);
+        IMUCharacteristicGyr.setEventHandler(BLEUpdated, onGyrUpdated);
+        IMUCharacteristicMag.setEventHandler(BLEUpdated, onMagUpdated);
+        ButtonPressedCharacteristic.setEventHandler(BLEUpdated, onButtonUpdated);
+
+        if (!IMUCharacteristicAcc){
+            Serial.println(F("Peripheral doesn't have Acc characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicAcc.canSubscribe()){
+            Serial.println(F("Peripheral does not have subscribeable Acc characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicAcc.subscribe()){
+            Serial.println(F("Did not successfully subscribe to Acc characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        }
 
-    while (peripheral.connected()) {
-        delay(5); // Delay to not overwhelm serial buffer
-        if (IMUCharacteristicAcc.valueUpdated()){
-            IMUCharacteristicAcc.readValue(&acc, ARDUINO_FLOAT_LENGTH_BYTES*ACC_ELEMENTS);
+        if (!IMUCharacteristicGyr){
+            Serial.println(F("Peripheral doesn't have Gyr characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicGyr.canSubscribe()){
+            Serial.println(F("Peripheral does not have subscribeable Gyr characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicGyr.subscribe()){
+            Serial.println(F("Did not successfully subscribe to Gyr characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
         }
-        if (IMUCharacteristicGyr.valueUpdated()){
-            IMUCharacteristicGyr.readValue(&gyr, ARDUINO_FLOAT_LENGTH_BYTES*GYR_ELEMENTS);
+
+        if (!IMUCharacteristicMag){
+            Serial.println(F("Peripheral doesn't have Mag characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicMag.canSubscribe()){
+            Serial.println(F("Peripheral does not have subscribeable Mag characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!IMUCharacteristicMag.subscribe()){
+            Serial.println(F("Did not successfully subscribe to Mag characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
         }
-        if (IMUCharacteristicMag.valueUpdated()){
-            IMUCharacteristicMag.readValue(&mag, ARDUINO_FLOAT_LENGTH_BYTES*MAG_ELEMENTS);
+
+        if (!ButtonPressedCharacteristic){
+            Serial.println(F("Peripheral doesn't have Button Pressed characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!ButtonPressedCharacteristic.canSubscribe()){
+            Serial.println(F("Peripheral does not have subscribeable Button Pressed characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
+        } else if (!ButtonPressedCharacteristic.subscribe()){
+            Serial.println(F("Did not successfully subscribe to Button Pressed characteristic!"));
+            peripheral.disconnect();
+            controller.connected = false;
+            return false;
         }
-        if (ButtonPressedCharacteristic.valueUpdated()){
-            ButtonPressedCharacteristic.readValue(&buttonPressed, ARDUINO_BOOL_LENGTH_BYTES);
+    }
+
+    // After discovery, which exchanged the ATT MTU
+    if (haveHandle){
+        negotiateLink(controller);
+    }
+    else{
+        Serial.println(F("Connection handle not found, keeping the link parameters"));
+    }
+
+    Serial.print(F("Controller id: "));
+    Serial.println(id);
+    return true;
+}
+
+void checkDisconnected()
+{
+    for (int i = 0; i < MAX_CONTROLLERS; i++)
+    {
+        Controller &controller = controllers[i];
+        if (!controller.connected || controller.peripheral.connected()){
+            continue;
         }
-        if (printForViz)
-        {
-            if (Serial.available())
-            {
-                char data = Serial.read();
-                if (data == 'a'){
-                    print_a = !print_a;
-                }
-                if (data == 'g'){
-                    print_g = !print_g;
-                }
-                if (data == 'm'){
-                    print_m = !print_m;
-                }
-            }
-            printIMUValsForViz(acc, gyr, mag, print_a, print_g, print_m);
+        // Samples still buffered are written before the slot is given up
+        drainReceivedSamples();
+        controller.connected = false;
+
+        Serial.print(F("***Peripheral device disconnected*** controller id: "));
+        Serial.println(i);
+        if (controller.sampleFormat != SAMPLE_FORMAT_LEGACY){
+            Serial.print(F("Dropped samples: "));
+            Serial.print(controller.droppedSamples);
+            Serial.print(F(" (receive buffer overflows: "));
+            Serial.print(controller.overflowedSamples);
+            Serial.println(F(")"));
         }
-        else
-        {
-            printIMUVals(acc, gyr, mag);
+        printLinkReport(controller, i);
+        printLatencyReport();
+        Serial.println();
+        Serial.println();
+    }
+}
+
+void startScanning()
+{
+    BLE.scanForUuid(BLE_UUID_IMU_SERVICE);
+    scanning = true;
+    Serial.println(F("Started scanning for uuid"));
+}
+
+void setup() {
+    delay(5000); // Delay so setup Serial output can be observed
+    Serial.begin(15200); 
+    while (!Serial); // Wait if serial is not ready- may want to change this but for training this is useful so doesn't start until serial connection is made
+
+    Serial.println(F("Press y in next 3 seconds for visualization print out, b for binary output, g for gesture records"));
+    delay(3000);
+    if (Serial.available())
+    {
+        char data = Serial.read();
+        if (data == 'y'){
+            printForViz = true;
+        }
+        if (data == 'b'){
+            binaryOutput = true;
+        }
+        if (data == 'g'){
+            gestureOutput = true;
         }
     }
 
-    Serial.println(F("***Peripheral device disconnected***"));
+    // BLE 
+    if (!BLE.begin()){
+        Serial.println(F("Starting BLE module failed!"));
+        while (1);
+    }
+    Serial.println(F("***Started BLE module***"));
+
+    BLE.advertise();  
+    Serial.println(F("Started BLE advertising"));
+
+    Serial.println(F("***BLE initialization complete***"));
     Serial.println();
     Serial.println();
 
-    BLE.scanForUuid(BLE_UUID_IMU_SERVICE);
-    Serial.println(F("Started scanning for uuid"));
+    startScanning();
+}
+
+
+void onDiscovered(BLEDevice &peripheral)
+{
+    Serial.println(F("***Peripheral device discovered***"));
+    Serial.print(F("MAC address: "));
+    Serial.println(peripheral.address());
+    Serial.print(F("Device name: "));
+    Serial.println(peripheral.localName());
+    Serial.print(F("Advertised service UUID: "));
+    Serial.println(peripheral.advertisedServiceUuid());
+    Serial.println();
+
+    if (peripheral.localName() != BLE_LOCAL_NAME_IMU){
+        Serial.println(F("Incorrect local name"));
+        return;
+    }
+    if (controllerFor(peripheral)){
+        return;
+    }
+    int id = 0;
+    while (controllers[id].connected)
+    {
+        id++;
+    }
+
+    BLE.stopScan();
+    scanning = false;
+    connectController(peripheral, id);
+}
+
+void loop() {
+    // Notifications are handled by the event handlers above as soon as BLE.poll() sees them, the loop writes them to
+    // serial and keeps scanning for another controller while a slot is free
+    BLE.poll();
+    if (scanning)
+    {
+        BLEDevice peripheral = BLE.available();
+        if (peripheral){
+            onDiscovered(peripheral);
+        }
+    }
+    checkDisconnected();
+    drainReceivedSamples();
+    if (!printForViz && !binaryOutput && !gestureOutput && connectedControllers() > 0 && millis() - lastLatencyReportMs >= LATENCY_REPORT_INTERVAL_MS){
+        // Lines with other than 10 fields are ignored by the host scripts
+        printLatencyReport();
+        for (int i = 0; i < MAX_CONTROLLERS; i++)
+        {
+            if (controllers[i].connected){
+                printLinkReport(controllers[i], i);
+            }
+        }
+        lastLatencyReportMs = millis();
+    }
+    if (!scanning && connectedControllers() < MAX_CONTROLLERS){
+        startScanning();
+    }
 }
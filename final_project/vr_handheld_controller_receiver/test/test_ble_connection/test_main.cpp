@@ -0,0 +1,77 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the BLE connection parameter helpers (vr_handheld_lib/VRHandheld/BleConnection.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <BleConnection.h>
+
+static void test_interval_units()
+{
+    TEST_ASSERT_EQUAL_UINT16(6, bleConnectionIntervalUnits(7500));
+    TEST_ASSERT_EQUAL_UINT16(80, bleConnectionIntervalUnits(100000));
+    TEST_ASSERT_EQUAL_UINT16(8, bleConnectionIntervalUnits(10000));
+    TEST_ASSERT_EQUAL_UINT16(BLE_CONN_INTERVAL_MIN, bleConnectionIntervalUnits(1000));
+    TEST_ASSERT_EQUAL_UINT16(BLE_CONN_INTERVAL_MAX, bleConnectionIntervalUnits(10000000));
+}
+
+static void test_parameters_valid()
+{
+    BleConnectionParameters parameters = {80, 160, 0, 400};
+    TEST_ASSERT_TRUE(bleConnectionParametersValid(parameters));
+    // Timeout must exceed twice (1 + latency) * max interval: 2 * 10 * 200 ms = 4 s
+    parameters.latency = 9;
+    TEST_ASSERT_FALSE(bleConnectionParametersValid(parameters));
+    parameters.supervision_timeout = 401;
+    TEST_ASSERT_TRUE(bleConnectionParametersValid(parameters));
+    parameters.min_interval = 200;
+    TEST_ASSERT_FALSE(bleConnectionParametersValid(parameters));
+    BleConnectionParameters too_fast = {5, 6, 0, 100};
+    TEST_ASSERT_FALSE(bleConnectionParametersValid(too_fast));
+    BleConnectionParameters most_latency = {BLE_CONN_INTERVAL_MAX, BLE_CONN_INTERVAL_MAX, BLE_CONN_LATENCY_MAX,
+                                            BLE_SUPERVISION_TIMEOUT_MAX};
+    TEST_ASSERT_FALSE(bleConnectionParametersValid(most_latency));
+}
+
+static void test_encode_request()
+{
+    BleConnectionParameters parameters = {6, 12, 0, 400};
+    uint8_t out[L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES];
+    TEST_ASSERT_EQUAL(L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES, encodeConnectionParameterRequest(parameters, 7, out));
+    const uint8_t expected[] = {0x12, 7, 8, 0, 6, 0, 12, 0, 0, 0, 0x90, 0x01};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, sizeof(expected));
+
+    parameters.min_interval = 20;
+    TEST_ASSERT_EQUAL(0, encodeConnectionParameterRequest(parameters, 8, out));
+}
+
+static void test_encode_hci_commands()
+{
+    uint8_t out[HCI_LE_SET_PHY_LENGTH_BYTES];
+    TEST_ASSERT_EQUAL(HCI_LE_SET_DATA_LENGTH_LENGTH_BYTES, encodeSetDataLength(0x0040, 251, out));
+    const uint8_t data_length[] = {0x40, 0x00, 251, 0, 0x48, 0x08}; // 2120 us
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data_length, out, sizeof(data_length));
+    encodeSetDataLength(1, 1000, out);
+    TEST_ASSERT_EQUAL_UINT8(BLE_DATA_LENGTH_MAX_OCTETS, out[2]);
+    encodeSetDataLength(1, 0, out);
+    TEST_ASSERT_EQUAL_UINT8(BLE_DATA_LENGTH_MIN_OCTETS, out[2]);
+    const uint8_t min_time[] = {0x48, 0x01}; // 328 us
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(min_time, out + 4, sizeof(min_time));
+
+    TEST_ASSERT_EQUAL(HCI_LE_SET_PHY_LENGTH_BYTES, encodeSetPhy(0x0102, BLE_PHY_2M, out));
+    const uint8_t phy[] = {0x02, 0x01, 0, BLE_PHY_2M, BLE_PHY_2M, 0, 0};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(phy, out, sizeof(phy));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_interval_units);
+    RUN_TEST(test_parameters_valid);
+    RUN_TEST(test_encode_request);
+    RUN_TEST(test_encode_hci_commands);
+    return UNITY_END();
+}
@@ -0,0 +1,216 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the receiver's gesture classifier (vr_handheld_lib/VRHandheld/GestureClassifier.h).
+
+With exported weights the classifier is run on every labelled gesture in training/ (read and resampled like
+GestureDataset does) and its accuracy has to match the accuracy PyTorch had on the same gestures when the model was
+exported. The accuracy and the inference time per gesture on the host are printed.
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <GestureClassifier.h>
+#include <GestureModelWeights.h>
+
+#define TRAINING_DIR "../training/"
+#define LOOKUP_FILEPATH TRAINING_DIR "vr_handheld_controller_gesture_data.csv"
+#define MAX_COLUMNS 1024
+#define MAX_LINE_LENGTH (16*MAX_COLUMNS)
+
+static void test_adaptive_avg_pool_windows()
+{
+    // The average of a ramp over [start, end) is (start + end - 1) / 2 with PyTorch's window bounds
+    const int in_length = GESTURE_CONV1_LENGTH;
+    const int out_length = GESTURE_POOL1_LENGTH;
+    float input[2*in_length];
+    float output[2*out_length];
+    for (int i = 0; i < in_length; i++)
+    {
+        input[i] = i;
+        input[in_length + i] = -2.0f*i;
+    }
+    adaptiveAvgPool1d(input, 2, in_length, out_length, output);
+    for (int i = 0; i < out_length; i++)
+    {
+        int start = (int)floor((double)i*in_length/out_length);
+        int end = (int)ceil((double)(i + 1)*in_length/out_length);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f*(start + end - 1), output[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, -(float)(start + end - 1), output[out_length + i]);
+    }
+}
+
+static void test_conv1d_relu()
+{
+    // 2 input channels, 2 output channels, kernel 2
+    const float input[2*4] = {1, 2, 3, 4,
+                              0, 1, 0, -1};
+    const float weight[2*2*2] = {1, 0,   0, 1,   // out 0: input 0 at i plus input 1 at i+1
+                                 -1, 0,  0, 0};  // out 1: -input 0 at i, clamped by the ReLU
+    const float bias[2] = {0.5f, 2.0f};
+    float output[2*3];
+    conv1dRelu(input, 2, 4, weight, bias, 2, 2, output);
+    const float expected[2*3] = {2.5f, 2.5f, 2.5f,
+                                 1.0f, 0.0f, 0.0f};
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, output, 2*3);
+}
+
+#if GESTURE_MODEL_EXPORTED
+static bool readGesture(const char *filepath, float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH])
+{
+    // Reads a gesture csv (one row per channel, each ending with ','), drops samples with a missing or 'ovf' value
+    // like pandas' dropna(axis=1) and streams the rest through a GestureFeatureExtractor
+    static float values[GESTURE_CHANNELS][MAX_COLUMNS];
+    static bool valid[MAX_COLUMNS];
+    static char line[MAX_LINE_LENGTH];
+    FILE *file = fopen(filepath, "r");
+    if (!file)
+    {
+        return false;
+    }
+    int columns = 0;
+    for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+    {
+        if (!fgets(line, sizeof(line), file))
+        {
+            fclose(file);
+            return false;
+        }
+        int column = 0;
+        char *field = line;
+        while (column < MAX_COLUMNS)
+        {
+            char *end;
+            float value = strtof(field, &end);
+            bool parsed = end != field && (*end == ',' || *end == '\n' || *end == '\r' || *end == '\0');
+            if (channel == 0)
+            {
+                valid[column] = true;
+            }
+            values[channel][column] = value;
+            valid[column] = valid[column] && parsed;
+            column++;
+            char *comma = strchr(field, ',');
+            if (!comma)
+            {
+                break;
+            }
+            field = comma + 1;
+        }
+        columns = channel == 0 ? column : (column < columns ? column : columns);
+    }
+    fclose(file);
+
+    static GestureFeatureExtractor extractor;
+    extractor.clear();
+    for (int column = 0; column < columns; column++)
+    {
+        if (valid[column])
+        {
+            float sample[GESTURE_CHANNELS];
+            for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+            {
+                sample[channel] = values[channel][column];
+            }
+            extractor.push(sample);
+        }
+    }
+    return extractor.extract(features);
+}
+
+static void test_training_csv_parity()
+{
+    FILE *lookup = fopen(LOOKUP_FILEPATH, "r");
+    TEST_ASSERT_NOT_NULL_MESSAGE(lookup, "run from vr_handheld_controller_receiver so " LOOKUP_FILEPATH " is found");
+
+    static GestureClassifier classifier;
+    static float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH];
+    GesturePrediction prediction;
+    int num_total = 0;
+    int num_correct = 0;
+    int per_label_total[GESTURE_CLASSES] = {0};
+    int per_label_correct[GESTURE_CLASSES] = {0};
+    double total_us = 0.0;
+    double max_us = 0.0;
+    char line[512];
+    while (fgets(line, sizeof(line), lookup))
+    {
+        // "./data_files/<name>.csv, <label 1..6>, <duration>" relative to the training directory
+        char relative_path[256];
+        int label;
+        if (sscanf(line, "%255[^,], %d", relative_path, &label) != 2)
+        {
+            continue;
+        }
+        char filepath[512];
+        snprintf(filepath, sizeof(filepath), "%s%s", TRAINING_DIR, strncmp(relative_path, "./", 2) == 0 ? relative_path + 2 : relative_path);
+        TEST_ASSERT_TRUE_MESSAGE(readGesture(filepath, features), filepath);
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        int predicted = classifier.classify(features, prediction);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double us = (end.tv_sec - start.tv_sec)*1e6 + (end.tv_nsec - start.tv_nsec)*1e-3;
+        total_us += us;
+        max_us = us > max_us ? us : max_us;
+
+        TEST_ASSERT_TRUE(predicted >= 0 && predicted < GESTURE_CLASSES);
+        TEST_ASSERT_TRUE(prediction.confidence > 0.0f && prediction.confidence <= 1.0f);
+        num_total++;
+        per_label_total[label - 1]++;
+        if (predicted == label - 1)
+        {
+            num_correct++;
+            per_label_correct[label - 1]++;
+        }
+    }
+    fclose(lookup);
+
+    printf("%s: %d/%d correct (PyTorch %d/%d)\n", GESTURE_MODEL_NAME, num_correct, num_total,
+           GESTURE_MODEL_REFERENCE_CORRECT, GESTURE_MODEL_REFERENCE_TOTAL);
+    for (int i = 0; i < GESTURE_CLASSES; i++)
+    {
+        printf("    %-6s %d/%d\n", gestureLabelName(i), per_label_correct[i], per_label_total[i]);
+    }
+    printf("Inference per gesture on the host: mean %.1f us, max %.1f us\n", total_us/num_total, max_us);
+
+    TEST_ASSERT_EQUAL(GESTURE_MODEL_REFERENCE_TOTAL, num_total);
+    // Summation order differs from PyTorch, allow a single gesture whose top two scores are within rounding
+    TEST_ASSERT_INT_WITHIN(1, GESTURE_MODEL_REFERENCE_CORRECT, num_correct);
+}
+#else
+static void test_training_csv_parity()
+{
+    TEST_IGNORE_MESSAGE("GestureModelWeights.h is the placeholder, export a model with training/export_gesture_model.py");
+}
+#endif
+
+static void test_classify_without_model()
+{
+    if (GestureClassifier::available())
+    {
+        TEST_IGNORE_MESSAGE("a model was exported");
+    }
+    static GestureClassifier classifier;
+    static float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH];
+    GesturePrediction prediction;
+    TEST_ASSERT_EQUAL(-1, classifier.classify(features, prediction));
+    TEST_ASSERT_EQUAL(-1, prediction.label);
+    TEST_ASSERT_EQUAL_STRING("none", gestureLabelName(prediction.label));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_adaptive_avg_pool_windows);
+    RUN_TEST(test_conv1d_relu);
+    RUN_TEST(test_classify_without_model);
+    RUN_TEST(test_training_csv_parity);
+    return UNITY_END();
+}
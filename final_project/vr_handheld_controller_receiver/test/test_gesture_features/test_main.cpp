@@ -0,0 +1,86 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the streaming gesture feature extractor (vr_handheld_lib/VRHandheld/GestureFeatures.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <math.h>
+#include <GestureFeatures.h>
+
+static float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH];
+
+static void pushRamp(GestureFeatureExtractor &extractor, int count)
+{
+    // Sample n has the value n + 1000*channel on every channel
+    for (int n = 0; n < count; n++)
+    {
+        float values[GESTURE_CHANNELS];
+        for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+        {
+            values[channel] = n + 1000.0f*channel;
+        }
+        extractor.push(values);
+    }
+}
+
+static void test_resample_matches_interpolate()
+{
+    // Indices of F.interpolate(mode='nearest') are floor(i*count/150) for these lengths, shorter and longer than 150
+    const int counts[] = {7, 149, 150, 151, 248, 511};
+    static GestureFeatureExtractor extractor;
+    for (unsigned int c = 0; c < sizeof(counts)/sizeof(counts[0]); c++)
+    {
+        extractor.clear();
+        pushRamp(extractor, counts[c]);
+        TEST_ASSERT_EQUAL(counts[c], extractor.count());
+        TEST_ASSERT_TRUE(extractor.extract(features));
+        for (int i = 0; i < GESTURE_SIGNAL_LENGTH; i++)
+        {
+            int expected = i*counts[c]/GESTURE_SIGNAL_LENGTH;
+            for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+            {
+                TEST_ASSERT_EQUAL_FLOAT(expected + 1000.0f*channel, features[channel][i]);
+            }
+        }
+    }
+}
+
+static void test_decimation_keeps_whole_gesture()
+{
+    static GestureFeatureExtractor extractor;
+    const int count = 5*GESTURE_MAX_SAMPLES/2;
+    pushRamp(extractor, count);
+    TEST_ASSERT_EQUAL_UINT32(count, extractor.received());
+    TEST_ASSERT_LESS_OR_EQUAL(GESTURE_MAX_SAMPLES, extractor.count());
+    TEST_ASSERT_TRUE(extractor.extract(features));
+    // Stored samples are every 4th pushed one, the features still span the start to the end of the gesture
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, features[0][0]);
+    TEST_ASSERT_GREATER_OR_EQUAL(count - 4*4, (int)features[0][GESTURE_SIGNAL_LENGTH - 1]);
+    for (int i = 1; i < GESTURE_SIGNAL_LENGTH; i++)
+    {
+        TEST_ASSERT_TRUE(features[0][i] > features[0][i - 1]);
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, fmodf(features[0][i], 4.0f));
+    }
+}
+
+static void test_extract_without_samples()
+{
+    static GestureFeatureExtractor extractor;
+    TEST_ASSERT_FALSE(extractor.extract(features));
+    pushRamp(extractor, 3);
+    extractor.clear();
+    TEST_ASSERT_EQUAL(0, extractor.count());
+    TEST_ASSERT_FALSE(extractor.extract(features));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_resample_matches_interpolate);
+    RUN_TEST(test_decimation_keeps_whole_gesture);
+    RUN_TEST(test_extract_without_samples);
+    return UNITY_END();
+}
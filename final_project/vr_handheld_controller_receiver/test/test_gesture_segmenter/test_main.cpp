@@ -0,0 +1,199 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the gesture segmentation and records of the receiver (vr_handheld_lib/VRHandheld/GestureSegmenter.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <string.h>
+#include <GestureSegmenter.h>
+#include <SerialFrame.h>
+
+#define PERIOD_US 8403 // 119 Hz
+
+static float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH];
+static uint8_t record[GESTURE_RECORD_LENGTH_BYTES];
+
+// Sample n has the value n + 1000*channel on every channel
+static ImuSample makeSample(uint32_t n, bool pressed)
+{
+    ImuSample sample;
+    sample.timestamp_us = 4294000000u + n*PERIOD_US; // wraps around during the long gestures
+    sample.sequence = (uint16_t)n;
+    for (int axis = 0; axis < IMU_AXES; axis++)
+    {
+        sample.acc[axis] = n + 1000.0f*axis;
+        sample.gyr[axis] = n + 1000.0f*(IMU_AXES + axis);
+        sample.mag[axis] = n + 1000.0f*(2*IMU_AXES + axis);
+    }
+    sample.button_pressed = pressed;
+    return sample;
+}
+
+// Feeds idle samples, a press held for held samples and idle samples after the release starting at sample n,
+// returns the number of completed gestures
+static int feedPress(GestureSegmenter &segmenter, uint32_t &n, int held)
+{
+    int completed = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        completed += segmenter.update(makeSample(n++, false));
+    }
+    for (int i = 0; i < held; i++)
+    {
+        completed += segmenter.update(makeSample(n++, true));
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        completed += segmenter.update(makeSample(n++, false));
+    }
+    return completed;
+}
+
+static uint16_t readU16(const uint8_t *buffer)
+{
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t *buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+void test_press_gives_one_gesture()
+{
+    static GestureSegmenter segmenter;
+    uint32_t n = 0;
+    const int held = 120;
+    int completed = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        completed += segmenter.update(makeSample(n++, false));
+    }
+    uint32_t first = n;
+    for (int i = 0; i < held; i++)
+    {
+        completed += segmenter.update(makeSample(n++, true));
+    }
+    // Only the release completes the gesture, later idle samples don't repeat it
+    TEST_ASSERT_EQUAL(0, completed);
+    TEST_ASSERT_TRUE(segmenter.update(makeSample(n++, false)));
+    for (int i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_FALSE(segmenter.update(makeSample(n++, false)));
+    }
+
+    const GestureInfo &info = segmenter.info();
+    TEST_ASSERT_EQUAL_UINT16(0, info.number);
+    TEST_ASSERT_EQUAL_UINT32(makeSample(first, true).timestamp_us, info.start_us);
+    TEST_ASSERT_EQUAL_UINT32((held - 1)*PERIOD_US, info.duration_us);
+    TEST_ASSERT_EQUAL_UINT16(held, info.num_samples);
+
+    segmenter.resample(features);
+    for (int i = 0; i < GESTURE_SIGNAL_LENGTH; i++)
+    {
+        float expected = first + gestureResampleIndex(i, held);
+        for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+        {
+            TEST_ASSERT_EQUAL_FLOAT(expected + 1000.0f*channel, features[channel][i]);
+        }
+    }
+
+    // The next gesture gets the next number
+    TEST_ASSERT_EQUAL(1, feedPress(segmenter, n, held));
+    TEST_ASSERT_EQUAL_UINT16(1, segmenter.info().number);
+}
+
+void test_short_press_ignored()
+{
+    static GestureSegmenter segmenter;
+    uint32_t n = 0;
+    for (int held = 0; held < GESTURE_MIN_SAMPLES; held++)
+    {
+        TEST_ASSERT_EQUAL(0, feedPress(segmenter, n, held));
+    }
+    // A short press doesn't use up a gesture number or leave samples for the next gesture
+    TEST_ASSERT_EQUAL(1, feedPress(segmenter, n, GESTURE_MIN_SAMPLES));
+    TEST_ASSERT_EQUAL_UINT16(0, segmenter.info().number);
+    TEST_ASSERT_EQUAL_UINT16(GESTURE_MIN_SAMPLES, segmenter.info().num_samples);
+    segmenter.resample(features);
+    TEST_ASSERT_EQUAL_FLOAT(n - 3 - GESTURE_MIN_SAMPLES, features[0][0]);
+}
+
+void test_long_press_decimated()
+{
+    // Holds longer than the window of GESTURE_MAX_SAMPLES are decimated, the features still span the whole gesture
+    static GestureSegmenter segmenter;
+    uint32_t n = 0;
+    const int held = 5*GESTURE_MAX_SAMPLES/2;
+    TEST_ASSERT_EQUAL(1, feedPress(segmenter, n, held));
+    uint32_t first = n - 3 - held;
+
+    const GestureInfo &info = segmenter.info();
+    TEST_ASSERT_EQUAL_UINT16(held, info.num_samples);
+    TEST_ASSERT_EQUAL_UINT32((held - 1)*PERIOD_US, info.duration_us);
+
+    segmenter.resample(features);
+    TEST_ASSERT_EQUAL_FLOAT(first, features[0][0]);
+    TEST_ASSERT_GREATER_OR_EQUAL(first + held - 4*4, (uint32_t)features[0][GESTURE_SIGNAL_LENGTH - 1]);
+    for (int i = 1; i < GESTURE_SIGNAL_LENGTH; i++)
+    {
+        TEST_ASSERT_TRUE(features[0][i] > features[0][i - 1]);
+    }
+}
+
+void test_record_layout()
+{
+    static GestureSegmenter segmenter;
+    uint32_t n = 0;
+    TEST_ASSERT_EQUAL(1, feedPress(segmenter, n, 200));
+    segmenter.resample(features);
+    const GestureInfo &info = segmenter.info();
+
+    memset(record, 0xA5, sizeof(record));
+    TEST_ASSERT_EQUAL(GESTURE_RECORD_LENGTH_BYTES, encodeGestureRecord(info, 3, features, record));
+
+    // Magic and the length prefix of the payload
+    TEST_ASSERT_EQUAL_UINT8_ARRAY("GSTR", record, 4);
+    TEST_ASSERT_EQUAL_UINT16(GESTURE_RECORD_PAYLOAD_LENGTH_BYTES, readU16(record + 4));
+    TEST_ASSERT_EQUAL(GESTURE_RECORD_HEADER_LENGTH_BYTES + GESTURE_RECORD_PAYLOAD_LENGTH_BYTES + 2,
+                      GESTURE_RECORD_LENGTH_BYTES);
+
+    const uint8_t *payload = record + GESTURE_RECORD_HEADER_LENGTH_BYTES;
+    TEST_ASSERT_EQUAL_UINT16(info.number, readU16(payload));
+    TEST_ASSERT_EQUAL_UINT32(info.start_us, readU32(payload + 2));
+    TEST_ASSERT_EQUAL_UINT32(info.duration_us, readU32(payload + 6));
+    TEST_ASSERT_EQUAL_UINT16(200, readU16(payload + 10));
+    TEST_ASSERT_EQUAL_UINT8(GESTURE_CHANNELS, payload[12]);
+    TEST_ASSERT_EQUAL_UINT16(GESTURE_SIGNAL_LENGTH, readU16(payload + 13));
+    TEST_ASSERT_EQUAL_UINT8(3, payload[15]);
+
+    // Values channel major as float32
+    const uint8_t *values = payload + GESTURE_RECORD_INFO_LENGTH_BYTES;
+    for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+    {
+        for (int i = 0; i < GESTURE_SIGNAL_LENGTH; i++)
+        {
+            uint32_t bits = readU32(values + 4*(channel*GESTURE_SIGNAL_LENGTH + i));
+            float value;
+            memcpy(&value, &bits, sizeof(value));
+            TEST_ASSERT_EQUAL_FLOAT(features[channel][i], value);
+        }
+    }
+
+    // CRC of the payload after it
+    TEST_ASSERT_EQUAL_UINT16(crc16Ccitt(payload, GESTURE_RECORD_PAYLOAD_LENGTH_BYTES),
+                             readU16(payload + GESTURE_RECORD_PAYLOAD_LENGTH_BYTES));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_press_gives_one_gesture);
+    RUN_TEST(test_short_press_ignored);
+    RUN_TEST(test_long_press_decimated);
+    RUN_TEST(test_record_layout);
+    return UNITY_END();
+}
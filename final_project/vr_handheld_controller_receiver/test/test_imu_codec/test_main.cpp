@@ -0,0 +1,134 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Round trip tests of the compact IMU batch encoding (vr_handheld_lib/VRHandheld/ImuCodec.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <math.h>
+#include <ImuCodec.h>
+
+static ImuSample makeSample(int i, float speed = 1.0f)
+{
+    // Smooth motion with some noise-like jitter, all within the sensor full scale, speed scales how much the values
+    // change between samples
+    ImuSample sample;
+    sample.timestamp_us = 4294900000u + i*8403; // wraps around during the test
+    sample.sequence = 65530 + i;                // wraps around during the test
+    for (int axis = 0; axis < IMU_AXES; axis++)
+    {
+        sample.acc[axis] = 0.9f*sinf(speed*0.05f*i + axis) + speed*0.001f*((i*7 + axis) % 5);
+        sample.gyr[axis] = 350.0f*cosf(speed*0.08f*i + axis) + speed*0.3f*((i*3 + axis) % 7);
+        sample.mag[axis] = 45.0f*sinf(speed*0.01f*i + 2*axis);
+    }
+    sample.button_pressed = (i / 3) % 2;
+    return sample;
+}
+
+static void assertRoundTrip(bool delta, int max_length)
+{
+    const int num_samples = IMU_SAMPLE_BUFFER_SIZE;
+    ImuSampleBuffer buffer;
+    for (int i = 0; i < num_samples; i++)
+    {
+        TEST_ASSERT_TRUE(buffer.push(makeSample(i)));
+    }
+
+    uint8_t encoded[IMU_CODEC_MAX_LENGTH_BYTES];
+    ImuSample decoded[IMU_CODEC_MAX_SAMPLES];
+    int num_decoded = 0;
+    while (buffer.size() > 0)
+    {
+        int length = encodeImuBatch(buffer, max_length, delta, encoded);
+        TEST_ASSERT_GREATER_THAN(0, length);
+        TEST_ASSERT_LESS_OR_EQUAL(max_length, length);
+        int n = decodeImuBatch(encoded, length, decoded);
+        TEST_ASSERT_GREATER_THAN(0, n);
+
+        for (int i = 0; i < n; i++)
+        {
+            ImuSample expected = makeSample(num_decoded + i);
+            TEST_ASSERT_EQUAL_UINT32(expected.timestamp_us, decoded[i].timestamp_us);
+            TEST_ASSERT_EQUAL_UINT16(expected.sequence, decoded[i].sequence);
+            TEST_ASSERT_EQUAL(expected.button_pressed, decoded[i].button_pressed);
+            // Quantization error is at most half a LSB of the sensor
+            for (int axis = 0; axis < IMU_AXES; axis++)
+            {
+                TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_ACC_SCALE + 1e-6f, expected.acc[axis], decoded[i].acc[axis]);
+                TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_GYR_SCALE + 1e-4f, expected.gyr[axis], decoded[i].gyr[axis]);
+                TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_MAG_SCALE + 1e-5f, expected.mag[axis], decoded[i].mag[axis]);
+            }
+        }
+        num_decoded += n;
+    }
+    TEST_ASSERT_EQUAL(num_samples, num_decoded);
+}
+
+void test_round_trip_int16()
+{
+    assertRoundTrip(false, IMU_CODEC_MAX_LENGTH_BYTES);
+}
+
+void test_round_trip_delta()
+{
+    assertRoundTrip(true, IMU_CODEC_MAX_LENGTH_BYTES);
+}
+
+void test_round_trip_small_mtu()
+{
+    // Smallest payload that fits one int16 sample, every batch then carries a single sample
+    assertRoundTrip(true, IMU_CODEC_HEADER_LENGTH_BYTES + 1 + 2*IMU_CODEC_VALUES);
+}
+
+void test_saturation()
+{
+    ImuSample sample = makeSample(0);
+    sample.acc[0] = 100.0f;
+    sample.gyr[1] = -5000.0f;
+    int16_t raw[IMU_CODEC_VALUES];
+    quantizeImuSample(sample, raw);
+    TEST_ASSERT_EQUAL_INT16(32767, raw[0]);
+    TEST_ASSERT_EQUAL_INT16(-32768, raw[4]);
+}
+
+void test_compression()
+{
+    // A controller held almost still (changes of a few LSB per sample) must need less than half the bytes of a float
+    // batch with delta encoding
+    ImuSampleBuffer buffer;
+    for (int i = 0; i < IMU_CODEC_MAX_SAMPLES; i++)
+    {
+        buffer.push(makeSample(i, 0.01f));
+    }
+    uint8_t encoded[IMU_CODEC_MAX_LENGTH_BYTES];
+    int length = encodeImuBatch(buffer, IMU_CODEC_MAX_LENGTH_BYTES, true, encoded);
+    int n = IMU_CODEC_MAX_SAMPLES - buffer.size();
+    TEST_ASSERT_EQUAL(IMU_CODEC_MAX_SAMPLES, n);
+    TEST_ASSERT_LESS_OR_EQUAL(imuBatchLength(n) / 2, length);
+}
+
+void test_malformed()
+{
+    ImuSampleBuffer buffer;
+    buffer.push(makeSample(0));
+    buffer.push(makeSample(1));
+    uint8_t encoded[IMU_CODEC_MAX_LENGTH_BYTES];
+    ImuSample decoded[IMU_CODEC_MAX_SAMPLES];
+    int length = encodeImuBatch(buffer, IMU_CODEC_MAX_LENGTH_BYTES, true, encoded);
+    TEST_ASSERT_EQUAL(-1, decodeImuBatch(encoded, length - 1, decoded));
+    TEST_ASSERT_EQUAL(-1, decodeImuBatch(encoded, IMU_CODEC_HEADER_LENGTH_BYTES - 1, decoded));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_int16);
+    RUN_TEST(test_round_trip_delta);
+    RUN_TEST(test_round_trip_small_mtu);
+    RUN_TEST(test_saturation);
+    RUN_TEST(test_compression);
+    RUN_TEST(test_malformed);
+    return UNITY_END();
+}
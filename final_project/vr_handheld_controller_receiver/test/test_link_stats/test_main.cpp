@@ -0,0 +1,199 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the link latency, jitter and loss statistics (vr_handheld_lib/VRHandheld/LinkStats.h).
+
+The controller side streams delta encoded batches with SampleStreamer over the loopback link
+(vr_handheld_lib/VRHandheld/LoopbackTransport.h): batches leave at connection events and arrive after a random extra
+delay, some are lost. The controller's clock drifts against the receiver's and is offset from it. The receiver side
+decodes the batches and feeds LinkStats, whose estimates are compared with the true delays of the simulation.
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <SampleStream.h>
+#include <LoopbackTransport.h>
+#include <LinkStats.h>
+
+#define SAMPLE_PERIOD_US 4202 // 238 Hz
+#define CONN_INTERVAL_US 7500
+#define BATCH_SAMPLES 4
+#define MAX_SAMPLES 20000
+
+struct LinkSimulation {
+    // Sender clock = true time * (1 + drift) + offset, receiver clock = true time
+    double drift;
+    uint32_t sender_offset_us;
+    uint32_t max_extra_delay_us; // uniform random delay added after the connection event
+    float loss;                  // probability of losing a batch
+};
+
+struct LinkResult {
+    double mean_true_latency_us; // above the fastest sample, like LinkStats
+    uint32_t sent_samples;       // from the first to the last one received, LinkStats can't see losses around them
+    uint32_t lost_samples;       // of those
+};
+
+// The streamer runs on the sender clock, the loopback link on the true time of the simulation
+class SenderClockTransport : public SampleTransport {
+public:
+    SenderClockTransport(LoopbackTransport &link) : link(link), true_now_us(0) {}
+
+    bool send(int encoding, const uint8_t *data, int length, uint32_t now_us)
+    {
+        (void)now_us;
+        return link.send(encoding, data, length, true_now_us);
+    }
+
+    LoopbackTransport &link;
+    uint32_t true_now_us;
+};
+
+class SimulationSink : public SampleSink {
+public:
+    SimulationSink(LinkStats &stats, const double *true_sent_us) :
+        stats(stats), true_sent_us(true_sent_us), latency_sum(0.0), min_latency(1e30), count(0), first_sequence(0),
+        last_sequence(0) {}
+
+    void receive(int encoding, const uint8_t *data, int length, uint32_t arrival_us)
+    {
+        ImuSample samples[SAMPLE_PACKET_MAX_SAMPLES];
+        int n = decodeSamplePacket(encoding, data, length, samples);
+        TEST_ASSERT_EQUAL(BATCH_SAMPLES, n);
+        for (int i = 0; i < n; i++)
+        {
+            stats.add(samples[i], arrival_us);
+            double latency = arrival_us - true_sent_us[samples[i].sequence];
+            latency_sum += latency;
+            if (latency < min_latency)
+            {
+                min_latency = latency;
+            }
+            if (count == 0)
+            {
+                first_sequence = samples[i].sequence;
+            }
+            count++;
+            last_sequence = samples[i].sequence;
+        }
+    }
+
+    LinkStats &stats;
+    const double *true_sent_us;
+    double latency_sum;
+    double min_latency;
+    uint32_t count;
+    uint16_t first_sequence;
+    uint16_t last_sequence;
+};
+
+static LinkResult simulate(const LinkSimulation &simulation, int samples, LinkStats &stats)
+{
+    static double true_sent_us[MAX_SAMPLES];
+    const LoopbackLinkConfig config = {CONN_INTERVAL_US, 0, 0, simulation.max_extra_delay_us, simulation.loss, 1};
+    LoopbackTransport link(config);
+    SenderClockTransport transport(link);
+    // A batch is due once its oldest sample waited more than two and a half periods, so each one carries four samples
+    SampleStreamer streamer(transport, SAMPLE_ENCODING_COMPACT_BATCH, true, (2*BATCH_SAMPLES - 3) * SAMPLE_PERIOD_US / 2);
+    streamer.setMtu(247);
+    SimulationSink sink(stats, true_sent_us);
+
+    for (int n = 0; n < samples; n++)
+    {
+        double taken = 1000.0 + n * (double)SAMPLE_PERIOD_US;
+        uint32_t sender_now_us = (uint32_t)(int64_t)(taken * (1.0 + simulation.drift)) + simulation.sender_offset_us;
+        ImuSample sample = {};
+        sample.timestamp_us = sender_now_us;
+        sample.acc[2] = 1.0f;
+        true_sent_us[n] = taken;
+        transport.true_now_us = (uint32_t)(int64_t)taken;
+        TEST_ASSERT_TRUE(streamer.push(sample));
+        if (streamer.due(sender_now_us, false))
+        {
+            TEST_ASSERT_EQUAL(BATCH_SAMPLES, streamer.send(sender_now_us));
+        }
+        link.deliver(transport.true_now_us, sink);
+    }
+    link.deliver(transport.true_now_us + 1000000, sink);
+    TEST_ASSERT_EQUAL(0, streamer.queued());
+    TEST_ASSERT_EQUAL_UINT32(0, link.refused());
+
+    LinkResult result;
+    result.mean_true_latency_us = sink.latency_sum / sink.count - sink.min_latency;
+    result.sent_samples = sink.last_sequence - sink.first_sequence + 1;
+    result.lost_samples = result.sent_samples - sink.count;
+    return result;
+}
+
+static void test_ideal_link()
+{
+    LinkStats stats;
+    LinkSimulation link = {0.0, 123456789u, 0, 0.0f};
+    LinkResult result = simulate(link, 5000, stats);
+    TEST_ASSERT_EQUAL_UINT32(5000, stats.received());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, stats.dropRate());
+    // Only the batching and connection event delays are left, up to 3 periods plus an interval
+    TEST_ASSERT_FLOAT_WITHIN(200.0f, result.mean_true_latency_us, stats.latency().meanUs());
+    TEST_ASSERT_LESS_OR_EQUAL(4*SAMPLE_PERIOD_US + CONN_INTERVAL_US, stats.latency().maxUs());
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, 0.0f, stats.driftPpm());
+}
+
+static void test_drift_and_wrap_around()
+{
+    // 40 ppm between the crystals, the sender clock wraps around during the run
+    LinkStats stats;
+    LinkSimulation link = {40e-6, 0xFFF00000u, 2000, 0.0f};
+    LinkResult result = simulate(link, 20000, stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped());
+    TEST_ASSERT_FLOAT_WITHIN(15.0f, -40.0f, stats.driftPpm()); // receiver runs slow against the sender
+    TEST_ASSERT_FLOAT_WITHIN(300.0f, result.mean_true_latency_us, stats.latency().meanUs());
+    TEST_ASSERT_TRUE(stats.jitterUs() > 100.0f);
+}
+
+static void test_loss_and_jitter()
+{
+    LinkStats stats;
+    LinkSimulation steady = {0.0, 0, 0, 0.0f};
+    simulate(steady, 2000, stats);
+    float steady_jitter = stats.jitterUs();
+
+    stats.clear();
+    LinkSimulation lossy = {10e-6, 5000000u, 8000, 1.0f/7};
+    LinkResult result = simulate(lossy, 10000, stats);
+    TEST_ASSERT_TRUE(result.lost_samples > 0);
+    TEST_ASSERT_EQUAL_UINT32(result.lost_samples, stats.dropped());
+    TEST_ASSERT_EQUAL_UINT32(result.sent_samples - result.lost_samples, stats.received());
+    TEST_ASSERT_FLOAT_WITHIN(0.03f, 1.0f/7, stats.dropRate());
+    TEST_ASSERT_FLOAT_WITHIN(500.0f, result.mean_true_latency_us, stats.latency().meanUs());
+    // Waiting for connection events alone gives jitter, random delays on top of it give more
+    TEST_ASSERT_TRUE(stats.jitterUs() > steady_jitter + 500.0f);
+    TEST_ASSERT_TRUE(stats.latency().percentileUs(99) >= stats.latency().percentileUs(50));
+}
+
+static void test_unsettled_clock()
+{
+    // Latencies are only counted once a whole block of the clock offset estimate was seen
+    LinkStats stats;
+    ImuSample sample = {};
+    for (int n = 0; n < 10; n++)
+    {
+        sample.timestamp_us = n * SAMPLE_PERIOD_US;
+        sample.sequence = n;
+        stats.add(sample, 5000 + n * SAMPLE_PERIOD_US);
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, stats.received());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.latency().count());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, stats.jitterUs());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_ideal_link);
+    RUN_TEST(test_drift_and_wrap_around);
+    RUN_TEST(test_loss_and_jitter);
+    RUN_TEST(test_unsettled_clock);
+    return UNITY_END();
+}
@@ -0,0 +1,271 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the LSM9DS1 FIFO driver (vr_handheld_lib/VRHandheld/Lsm9ds1Fifo.h) against a fake register map.
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <string.h>
+#include <Lsm9ds1Fifo.h>
+
+// Fake accelerometer/gyroscope: registers, a FIFO of raw slots and a log of the register writes
+struct FakeSlot {
+    int16_t gyr[IMU_AXES];
+    int16_t acc[IMU_AXES];
+};
+
+static uint8_t registers[0x80];
+static FakeSlot fifo[LSM9DS1_FIFO_SIZE];
+static int fifo_count;
+static bool fifo_overrun;
+static bool gyr_read; // the fake FIFO advances once both halves of a slot were read
+static uint8_t written_registers[32];
+static uint8_t written_values[32];
+static int writes;
+static bool bus_ok;
+
+static void resetFake()
+{
+    memset(registers, 0, sizeof(registers));
+    fifo_count = 0;
+    fifo_overrun = false;
+    gyr_read = false;
+    writes = 0;
+    bus_ok = true;
+}
+
+static void pushSlot(int16_t gyr_x, int16_t acc_x)
+{
+    FakeSlot slot = {{gyr_x, (int16_t)(gyr_x + 1), (int16_t)(gyr_x + 2)}, {acc_x, (int16_t)(acc_x + 1), (int16_t)(acc_x + 2)}};
+    if (fifo_count == LSM9DS1_FIFO_SIZE)
+    {
+        memmove(fifo, fifo + 1, sizeof(fifo) - sizeof(fifo[0]));
+        fifo_count--;
+        fifo_overrun = true;
+    }
+    fifo[fifo_count++] = slot;
+}
+
+static void popSlot()
+{
+    memmove(fifo, fifo + 1, sizeof(fifo) - sizeof(fifo[0]));
+    fifo_count--;
+    fifo_overrun = false;
+}
+
+static void writeRaw(const int16_t *values, uint8_t *data)
+{
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        data[2*i] = values[i] & 0xFF;
+        data[2*i + 1] = (uint16_t)values[i] >> 8;
+    }
+}
+
+static bool fakeRead(uint8_t reg, uint8_t *data, int length)
+{
+    if (!bus_ok)
+    {
+        return false;
+    }
+    if (reg == LSM9DS1_FIFO_SRC)
+    {
+        int threshold = registers[LSM9DS1_FIFO_CTRL] & 0x1F;
+        data[0] = fifo_count | (fifo_overrun ? LSM9DS1_FIFO_SRC_OVRN : 0) |
+                  (fifo_count >= threshold ? LSM9DS1_FIFO_SRC_FTH : 0);
+        return length == 1;
+    }
+    TEST_ASSERT_EQUAL(2*IMU_AXES, length);
+    TEST_ASSERT_TRUE(fifo_count > 0);
+    if (reg == LSM9DS1_OUT_X_L_G)
+    {
+        writeRaw(fifo[0].gyr, data);
+        gyr_read = true;
+        return true;
+    }
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_OUT_X_L_XL, reg);
+    TEST_ASSERT_TRUE(gyr_read);
+    writeRaw(fifo[0].acc, data);
+    gyr_read = false;
+    popSlot();
+    return true;
+}
+
+static bool fakeWrite(uint8_t reg, uint8_t value)
+{
+    if (!bus_ok)
+    {
+        return false;
+    }
+    registers[reg] = value;
+    written_registers[writes] = reg;
+    written_values[writes] = value;
+    writes++;
+    return true;
+}
+
+static void test_odr_bits()
+{
+    TEST_ASSERT_EQUAL_UINT8(1, lsm9ds1OdrBits(10.0f));
+    TEST_ASSERT_EQUAL_UINT8(3, lsm9ds1OdrBits(119.0f));
+    TEST_ASSERT_EQUAL_UINT8(4, lsm9ds1OdrBits(200.0f));
+    TEST_ASSERT_EQUAL_UINT8(4, lsm9ds1OdrBits(238.0f));
+    TEST_ASSERT_EQUAL_UINT8(6, lsm9ds1OdrBits(5000.0f));
+    TEST_ASSERT_EQUAL_FLOAT(238.0f, lsm9ds1OdrHz(4));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, lsm9ds1OdrHz(0));
+}
+
+static void test_begin_configures_fifo()
+{
+    resetFake();
+    Lsm9ds1Fifo imu(fakeRead, fakeWrite);
+    TEST_ASSERT_TRUE(imu.begin(238.0f, 4));
+    TEST_ASSERT_EQUAL_FLOAT(238.0f, imu.sampleRateHz());
+    TEST_ASSERT_EQUAL_UINT32(4202, imu.samplePeriodUs());
+
+    TEST_ASSERT_EQUAL_HEX8(0x98, registers[LSM9DS1_CTRL_REG1_G]);
+    TEST_ASSERT_EQUAL_HEX8(0x90, registers[LSM9DS1_CTRL_REG6_XL]);
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_IF_ADD_INC, registers[LSM9DS1_CTRL_REG8]);
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_FIFO_EN, registers[LSM9DS1_CTRL_REG9]);
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_FMODE_CONTINUOUS | 4, registers[LSM9DS1_FIFO_CTRL]);
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_INT1_FTH, registers[LSM9DS1_INT1_CTRL]);
+    // The FIFO is passed through bypass mode before continuous mode, which clears it
+    bool bypassed = false;
+    for (int i = 0; i < writes; i++)
+    {
+        if (written_registers[i] == LSM9DS1_FIFO_CTRL)
+        {
+            bypassed = bypassed || written_values[i] == LSM9DS1_FMODE_BYPASS;
+        }
+    }
+    TEST_ASSERT_TRUE(bypassed);
+
+    // Watermarks outside the FIFO are clamped
+    TEST_ASSERT_TRUE(imu.begin(952.0f, 40));
+    TEST_ASSERT_EQUAL_HEX8(LSM9DS1_FMODE_CONTINUOUS | (LSM9DS1_FIFO_SIZE - 1), registers[LSM9DS1_FIFO_CTRL]);
+
+    TEST_ASSERT_TRUE(imu.end());
+    TEST_ASSERT_EQUAL_HEX8(0, registers[LSM9DS1_INT1_CTRL]);
+    TEST_ASSERT_EQUAL_HEX8(0, registers[LSM9DS1_CTRL_REG9]);
+
+    bus_ok = false;
+    TEST_ASSERT_FALSE(imu.begin(238.0f, 4));
+}
+
+static void test_drain_scales_samples()
+{
+    resetFake();
+    Lsm9ds1Fifo imu(fakeRead, fakeWrite);
+    TEST_ASSERT_TRUE(imu.begin(238.0f, 3));
+    pushSlot(100, -8192);
+    pushSlot(-32768, 16384);
+    TEST_ASSERT_FALSE(imu.watermarkReached());
+    pushSlot(0, 0);
+    TEST_ASSERT_TRUE(imu.watermarkReached());
+
+    ImuSample samples[LSM9DS1_FIFO_SIZE];
+    TEST_ASSERT_EQUAL(3, imu.drain(samples, LSM9DS1_FIFO_SIZE, 100000));
+    TEST_ASSERT_EQUAL(0, fifo_count);
+    TEST_ASSERT_EQUAL_FLOAT(100*LSM9DS1_GYR_SCALE, samples[0].gyr[0]);
+    TEST_ASSERT_EQUAL_FLOAT(102*LSM9DS1_GYR_SCALE, samples[0].gyr[2]);
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, samples[0].acc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(-2000.0f, samples[1].gyr[0]);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, samples[1].acc[0]);
+    TEST_ASSERT_EQUAL_FLOAT(2*LSM9DS1_ACC_SCALE, samples[2].acc[2]);
+
+    // Only max_samples are read, the rest stay for the next drain
+    pushSlot(1, 1);
+    pushSlot(2, 2);
+    TEST_ASSERT_EQUAL(1, imu.drain(samples, 1, 108000));
+    TEST_ASSERT_EQUAL(1, fifo_count);
+    TEST_ASSERT_EQUAL(1, imu.drain(samples, 1, 112000));
+    TEST_ASSERT_EQUAL(0, imu.drain(samples, 1, 116000));
+
+    bus_ok = false;
+    TEST_ASSERT_EQUAL(-1, imu.drain(samples, 1, 120000));
+}
+
+static void test_timestamps_follow_sample_rate()
+{
+    resetFake();
+    Lsm9ds1Fifo imu(fakeRead, fakeWrite);
+    TEST_ASSERT_TRUE(imu.begin(238.0f, 4));
+    const uint32_t period = imu.samplePeriodUs();
+    ImuSample samples[LSM9DS1_FIFO_SIZE];
+
+    // Samples are produced every period and drained up to a period later at random times. The clock starts close to
+    // the uint32 wrap around.
+    uint32_t produced = 0xFFFF0000u;
+    uint32_t random = 12345;
+    uint32_t last_timestamp = 0;
+    for (int drain = 0; drain < 500; drain++)
+    {
+        int count = 4 + drain % 3;
+        for (int i = 0; i < count; i++)
+        {
+            produced += period;
+            pushSlot(i, i);
+        }
+        random = random*1103515245u + 12345u;
+        uint32_t now = produced + (random >> 16) % period;
+        TEST_ASSERT_EQUAL(count, imu.drain(samples, LSM9DS1_FIFO_SIZE, now));
+        for (int i = 0; i < count; i++)
+        {
+            // Evenly spaced within a drain, only slowly corrected across drains
+            if (i > 0)
+            {
+                TEST_ASSERT_EQUAL_UINT32(period, samples[i].timestamp_us - samples[i - 1].timestamp_us);
+            }
+            else if (drain > 0)
+            {
+                TEST_ASSERT_UINT32_WITHIN(period/4, period, samples[i].timestamp_us - last_timestamp);
+            }
+            // Never ahead of the drain and within half a period of when the sample was produced
+            TEST_ASSERT_TRUE((int32_t)(now - samples[i].timestamp_us) >= 0);
+            uint32_t sample_produced = produced - (count - 1 - i)*period;
+            TEST_ASSERT_INT32_WITHIN(period/2, 0, (int32_t)(samples[i].timestamp_us - sample_produced));
+        }
+        last_timestamp = samples[count - 1].timestamp_us;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, imu.overruns());
+}
+
+static void test_overrun_restarts_timestamps()
+{
+    resetFake();
+    Lsm9ds1Fifo imu(fakeRead, fakeWrite);
+    TEST_ASSERT_TRUE(imu.begin(238.0f, 4));
+    const uint32_t period = imu.samplePeriodUs();
+    ImuSample samples[LSM9DS1_FIFO_SIZE];
+
+    for (int i = 0; i < 4; i++)
+    {
+        pushSlot(i, i);
+    }
+    TEST_ASSERT_EQUAL(4, imu.drain(samples, LSM9DS1_FIFO_SIZE, 50000));
+
+    // The MCU was busy for 40 samples, 8 of them were overwritten
+    for (int i = 0; i < 40; i++)
+    {
+        pushSlot(i, i);
+    }
+    uint32_t now = 50000 + 40*period;
+    TEST_ASSERT_EQUAL(LSM9DS1_FIFO_SIZE, imu.drain(samples, LSM9DS1_FIFO_SIZE, now));
+    TEST_ASSERT_EQUAL_UINT32(1, imu.overruns());
+    // The samples end at the drain instead of continuing 32 periods after the last timestamp
+    TEST_ASSERT_UINT32_WITHIN(period, now, samples[LSM9DS1_FIFO_SIZE - 1].timestamp_us);
+    TEST_ASSERT_EQUAL_UINT32((LSM9DS1_FIFO_SIZE - 1)*period, samples[LSM9DS1_FIFO_SIZE - 1].timestamp_us - samples[0].timestamp_us);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_odr_bits);
+    RUN_TEST(test_begin_configures_fifo);
+    RUN_TEST(test_drain_scales_samples);
+    RUN_TEST(test_timestamps_follow_sample_rate);
+    RUN_TEST(test_overrun_restarts_timestamps);
+    return UNITY_END();
+}
@@ -0,0 +1,108 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the motion gate of the controller (vr_handheld_lib/VRHandheld/MotionGate.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <math.h>
+#include <MotionGate.h>
+
+#define STILL_VARIANCE 0.0004f
+#define WAKE_DEVIATION 0.05f
+#define STILL_US 2000000
+#define WINDOW_US 250000
+#define PERIOD_US 4202 // 238 Hz
+
+// Feeds samples lying flat (1 g on z) with a small wobble of the given amplitude for duration_us, returns the time
+// of the first state change or 0 if there was none
+static uint32_t feed(MotionGate &gate, uint32_t &now, uint32_t duration_us, float amplitude)
+{
+    uint32_t changed = 0;
+    for (uint32_t end = now + duration_us; (int32_t)(end - now) > 0; now += PERIOD_US)
+    {
+        float phase = now * 1e-5f;
+        float acc[IMU_AXES] = {amplitude*sinf(phase), amplitude*cosf(phase), 1.0f + 0.001f*sinf(7*phase)};
+        if (gate.update(acc, now) && changed == 0)
+        {
+            changed = now;
+        }
+    }
+    return changed;
+}
+
+static void test_goes_idle_when_still()
+{
+    MotionGate gate(STILL_VARIANCE, WAKE_DEVIATION, STILL_US, WINDOW_US);
+    uint32_t now = 0xFFF00000u; // across the micros() wrap around
+    uint32_t start = now;
+    uint32_t changed = feed(gate, now, 2*STILL_US, 0.002f);
+    TEST_ASSERT_TRUE(gate.idle());
+    TEST_ASSERT_TRUE(changed != 0);
+    // Idle after the still time, within a window
+    TEST_ASSERT_GREATER_OR_EQUAL(STILL_US, changed - start);
+    TEST_ASSERT_LESS_OR_EQUAL(STILL_US + 2*WINDOW_US, changed - start);
+    TEST_ASSERT_LESS_THAN(STILL_VARIANCE, gate.lastVariance());
+}
+
+static void test_stays_active_while_moving()
+{
+    MotionGate gate(STILL_VARIANCE, WAKE_DEVIATION, STILL_US, WINDOW_US);
+    uint32_t now = 0;
+    TEST_ASSERT_EQUAL_UINT32(0, feed(gate, now, 3*STILL_US, 0.3f));
+    TEST_ASSERT_FALSE(gate.idle());
+    TEST_ASSERT_GREATER_THAN(STILL_VARIANCE, gate.lastVariance());
+
+    // Moving shortly before the still time is reached restarts it
+    feed(gate, now, STILL_US - WINDOW_US, 0.002f);
+    feed(gate, now, WINDOW_US, 0.3f);
+    feed(gate, now, STILL_US - WINDOW_US, 0.002f);
+    TEST_ASSERT_FALSE(gate.idle());
+}
+
+static void test_wakes_on_motion()
+{
+    MotionGate gate(STILL_VARIANCE, WAKE_DEVIATION, STILL_US, WINDOW_US);
+    uint32_t now = 0;
+    feed(gate, now, 2*STILL_US, 0.002f);
+    TEST_ASSERT_TRUE(gate.idle());
+
+    // Small deviations, e.g. noise at a low output data rate, keep it idle
+    float acc[IMU_AXES] = {0.03f, 0.0f, 1.0f};
+    TEST_ASSERT_FALSE(gate.update(acc, now));
+    TEST_ASSERT_TRUE(gate.idle());
+    // A single larger one wakes it up
+    acc[0] = 0.0f;
+    acc[2] = 0.9f;
+    TEST_ASSERT_TRUE(gate.update(acc, now));
+    TEST_ASSERT_FALSE(gate.idle());
+
+    // And it needs the whole still time again before going idle
+    uint32_t start = now;
+    uint32_t changed = feed(gate, now, 2*STILL_US, 0.002f);
+    TEST_ASSERT_GREATER_OR_EQUAL(STILL_US, changed - start);
+}
+
+static void test_wake_from_button()
+{
+    MotionGate gate(STILL_VARIANCE, WAKE_DEVIATION, STILL_US, WINDOW_US);
+    uint32_t now = 0;
+    TEST_ASSERT_FALSE(gate.wake(now));
+    feed(gate, now, 2*STILL_US, 0.002f);
+    TEST_ASSERT_TRUE(gate.idle());
+    TEST_ASSERT_TRUE(gate.wake(now));
+    TEST_ASSERT_FALSE(gate.idle());
+    TEST_ASSERT_EQUAL_UINT32(0, feed(gate, now, STILL_US - WINDOW_US, 0.002f));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_goes_idle_when_still);
+    RUN_TEST(test_stays_active_while_moving);
+    RUN_TEST(test_wakes_on_motion);
+    RUN_TEST(test_wake_from_button);
+    return UNITY_END();
+}
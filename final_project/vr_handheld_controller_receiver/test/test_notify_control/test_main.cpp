@@ -0,0 +1,124 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the notification helpers of the controller (vr_handheld_lib/VRHandheld/NotifyControl.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <NotifyControl.h>
+
+#define DEBOUNCE_US 5000
+#define POLL_US 250
+
+// Polls the debouncer with a constant raw reading for duration_us, returns the number of edges
+static int poll(ButtonDebouncer &button, uint32_t &now, uint32_t duration_us, bool raw_pressed)
+{
+    int edges = 0;
+    for (uint32_t end = now + duration_us; (int32_t)(end - now) > 0; now += POLL_US)
+    {
+        edges += button.update(raw_pressed, now);
+    }
+    return edges;
+}
+
+static void test_debounce_window()
+{
+    ButtonDebouncer button(DEBOUNCE_US);
+    uint32_t now = 1000;
+    TEST_ASSERT_EQUAL(0, poll(button, now, 2*DEBOUNCE_US, false));
+
+    // The press is accepted once it was stable for debounce_us, dated at the first raw press
+    uint32_t press = now;
+    TEST_ASSERT_EQUAL(0, poll(button, now, DEBOUNCE_US, true));
+    TEST_ASSERT_FALSE(button.pressed());
+    TEST_ASSERT_TRUE(button.update(true, now));
+    TEST_ASSERT_TRUE(button.pressed());
+    TEST_ASSERT_EQUAL_UINT32(press, button.lastEdgeUs());
+    TEST_ASSERT_EQUAL(0, poll(button, now, 4*DEBOUNCE_US, true));
+
+    uint32_t release = now;
+    TEST_ASSERT_EQUAL(1, poll(button, now, 2*DEBOUNCE_US, false));
+    TEST_ASSERT_FALSE(button.pressed());
+    TEST_ASSERT_EQUAL_UINT32(release, button.lastEdgeUs());
+    TEST_ASSERT_EQUAL_UINT16(2, button.edgeCount());
+}
+
+static void test_bounces_ignored()
+{
+    ButtonDebouncer button(DEBOUNCE_US);
+    uint32_t now = 0;
+
+    // Contact bounce shorter than debounce_us on press and on release gives one edge each
+    int edges = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        edges += poll(button, now, DEBOUNCE_US/4, true);
+        edges += poll(button, now, DEBOUNCE_US/4, false);
+    }
+    TEST_ASSERT_EQUAL(0, edges);
+    TEST_ASSERT_FALSE(button.pressed());
+
+    uint32_t press = now;
+    TEST_ASSERT_EQUAL(1, poll(button, now, 2*DEBOUNCE_US, true));
+    TEST_ASSERT_EQUAL_UINT32(press, button.lastEdgeUs());
+    for (int i = 0; i < 6; i++)
+    {
+        edges += poll(button, now, DEBOUNCE_US/4, false);
+        edges += poll(button, now, DEBOUNCE_US/4, true);
+    }
+    TEST_ASSERT_EQUAL(0, edges);
+    TEST_ASSERT_TRUE(button.pressed());
+    TEST_ASSERT_EQUAL_UINT16(1, button.edgeCount());
+}
+
+static void test_debounce_across_wrap_around()
+{
+    ButtonDebouncer button(DEBOUNCE_US);
+    uint32_t now = 0xFFFFFFFFu - DEBOUNCE_US/2; // micros() wraps while the press settles
+    uint32_t press = now;
+    TEST_ASSERT_EQUAL(0, poll(button, now, DEBOUNCE_US - POLL_US, true));
+    TEST_ASSERT_TRUE(now < press);
+    TEST_ASSERT_EQUAL(1, poll(button, now, 2*POLL_US, true));
+    TEST_ASSERT_EQUAL_UINT32(press, button.lastEdgeUs());
+}
+
+static void test_rate_limit()
+{
+    NotifyRateLimiter limiter(100.0f); // 10 ms
+    uint32_t now = 0xFFFFFFFFu - 15000; // across the micros() wrap around
+    TEST_ASSERT_TRUE(limiter.allow(now));
+    TEST_ASSERT_FALSE(limiter.allow(now + 1));
+    TEST_ASSERT_FALSE(limiter.allow(now + 9999));
+    TEST_ASSERT_TRUE(limiter.allow(now + 10000));
+
+    // Only allowed notifications restart the interval
+    now += 10000;
+    TEST_ASSERT_FALSE(limiter.allow(now + 5000));
+    TEST_ASSERT_TRUE(limiter.allow(now + 10000));
+
+    // After reset() the next one is allowed at once
+    limiter.reset();
+    TEST_ASSERT_TRUE(limiter.allow(now + 10001));
+}
+
+static void test_rate_limit_disabled()
+{
+    NotifyRateLimiter limiter(0.0f);
+    for (uint32_t now = 0; now < 10; now++)
+    {
+        TEST_ASSERT_TRUE(limiter.allow(now));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_debounce_window);
+    RUN_TEST(test_bounces_ignored);
+    RUN_TEST(test_debounce_across_wrap_around);
+    RUN_TEST(test_rate_limit);
+    RUN_TEST(test_rate_limit_disabled);
+    return UNITY_END();
+}
@@ -0,0 +1,255 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the sample streaming protocol (vr_handheld_lib/VRHandheld/SampleStream.h) over the loopback link
+(vr_handheld_lib/VRHandheld/LoopbackTransport.h).
+
+The controller side is driven like the controller's main loop: one sample per IMU period, a notification whenever
+the streamer says one is due. The receiver side decodes every notification and feeds LinkStats. The throughput test
+prints what each encoding gets through a link limited to a few notifications per connection event.
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include <SampleStream.h>
+#include <LoopbackTransport.h>
+#include <LinkStats.h>
+
+#define MAX_RECEIVED 4096
+
+class TestSink : public SampleSink {
+public:
+    TestSink() : count(0), malformed(0) {}
+
+    void receive(int encoding, const uint8_t *data, int length, uint32_t arrival_us)
+    {
+        ImuSample samples[SAMPLE_PACKET_MAX_SAMPLES];
+        int n = decodeSamplePacket(encoding, data, length, samples);
+        if (n < 0)
+        {
+            malformed++;
+            return;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            stats.add(samples[i], arrival_us);
+            if (count < MAX_RECEIVED)
+            {
+                received[count] = samples[i];
+            }
+            count++;
+        }
+    }
+
+    LinkStats stats;
+    ImuSample received[MAX_RECEIVED];
+    int count;
+    int malformed;
+};
+
+static ImuSample makeSample(int n, uint32_t timestamp_us)
+{
+    ImuSample sample = {};
+    sample.timestamp_us = timestamp_us;
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        sample.acc[i] = 0.5f*sinf(0.01f*n + i);
+        sample.gyr[i] = 200.0f*sinf(0.02f*n + i);
+        sample.mag[i] = 40.0f*cosf(0.005f*n + i);
+    }
+    sample.button_pressed = (n / 50) % 2 == 1;
+    return sample;
+}
+
+// Streams count samples taken every period_us through the link, then flushes the streamer and waits for the link
+static void stream(SampleStreamer &streamer, LoopbackTransport &link, TestSink &sink, int count, uint32_t period_us,
+                   uint32_t start_us)
+{
+    uint32_t now = start_us;
+    for (int n = 0; n < count; n++)
+    {
+        now = start_us + n*period_us;
+        streamer.push(makeSample(n, now));
+        if (streamer.due(now, false))
+        {
+            streamer.send(now);
+        }
+        link.deliver(now, sink);
+    }
+    while (streamer.queued() > 0)
+    {
+        now += period_us;
+        streamer.send(now);
+        link.deliver(now, sink);
+    }
+    link.deliver(now + 1000000, sink);
+}
+
+static void test_round_trip_each_encoding()
+{
+    const int encodings[] = {SAMPLE_ENCODING_PACKED, SAMPLE_ENCODING_BATCH, SAMPLE_ENCODING_COMPACT_BATCH, SAMPLE_ENCODING_COMPACT_BATCH};
+    const bool deltas[] = {false, false, false, true};
+    const LoopbackLinkConfig ideal = {0, 0, 0, 0, 0.0f, 1};
+    for (int e = 0; e < 4; e++)
+    {
+        static TestSink sink;
+        sink = TestSink();
+        LoopbackTransport link(ideal);
+        SampleStreamer streamer(link, encodings[e], deltas[e], 20000);
+        streamer.setMtu(247);
+        stream(streamer, link, sink, 500, 4202, 0xFFFF0000u);
+
+        TEST_ASSERT_EQUAL(500, sink.count);
+        TEST_ASSERT_EQUAL(0, sink.malformed);
+        TEST_ASSERT_EQUAL_UINT32(0, sink.stats.dropped());
+        TEST_ASSERT_EQUAL_UINT32(0, streamer.refused());
+        // Floats go through unchanged, compact batches are quantized to the sensor resolution
+        float acc_tolerance = encodings[e] == SAMPLE_ENCODING_COMPACT_BATCH ? IMU_CODEC_ACC_SCALE : 0.0f;
+        float gyr_tolerance = encodings[e] == SAMPLE_ENCODING_COMPACT_BATCH ? IMU_CODEC_GYR_SCALE : 0.0f;
+        float mag_tolerance = encodings[e] == SAMPLE_ENCODING_COMPACT_BATCH ? IMU_CODEC_MAG_SCALE : 0.0f;
+        for (int n = 0; n < 500; n++)
+        {
+            ImuSample expected = makeSample(n, 0xFFFF0000u + n*4202);
+            const ImuSample &sample = sink.received[n];
+            TEST_ASSERT_EQUAL_UINT16(n, sample.sequence);
+            TEST_ASSERT_EQUAL_UINT32(expected.timestamp_us, sample.timestamp_us);
+            TEST_ASSERT_EQUAL(expected.button_pressed, sample.button_pressed);
+            for (int i = 0; i < IMU_AXES; i++)
+            {
+                TEST_ASSERT_FLOAT_WITHIN(acc_tolerance, expected.acc[i], sample.acc[i]);
+                TEST_ASSERT_FLOAT_WITHIN(gyr_tolerance, expected.gyr[i], sample.gyr[i]);
+                TEST_ASSERT_FLOAT_WITHIN(mag_tolerance, expected.mag[i], sample.mag[i]);
+            }
+        }
+    }
+}
+
+static void test_batch_due()
+{
+    const LoopbackLinkConfig ideal = {0, 0, 0, 0, 0.0f, 1};
+    LoopbackTransport link(ideal);
+    SampleStreamer streamer(link, SAMPLE_ENCODING_COMPACT_BATCH, true, 20000);
+    streamer.setMtu(247);
+    TEST_ASSERT_EQUAL(IMU_CODEC_MAX_SAMPLES, streamer.capacity());
+    TEST_ASSERT_FALSE(streamer.due(0, true));
+
+    // Not full, due once the oldest sample is the maximum delay old or right away when urgent
+    for (int n = 0; n < 5; n++)
+    {
+        streamer.push(makeSample(n, 1000 + n*4202));
+    }
+    TEST_ASSERT_FALSE(streamer.due(1000 + 4*4202, false));
+    TEST_ASSERT_TRUE(streamer.due(1000 + 4*4202, true));
+    TEST_ASSERT_TRUE(streamer.due(1000 + 20000, false));
+    TEST_ASSERT_EQUAL(5, streamer.send(1000 + 20000));
+    TEST_ASSERT_EQUAL(0, streamer.queued());
+    TEST_ASSERT_EQUAL(0, streamer.send(1000 + 20000));
+    TEST_ASSERT_EQUAL_UINT32(1, streamer.sent());
+
+    // Full batches are due at once, samples beyond the queue are dropped but still use up sequence numbers
+    for (int n = 0; n < IMU_SAMPLE_BUFFER_SIZE + 3; n++)
+    {
+        streamer.push(makeSample(n, 30000 + n*100));
+    }
+    TEST_ASSERT_TRUE(streamer.due(30000, false));
+    TEST_ASSERT_EQUAL_UINT32(3, streamer.overflowed());
+    streamer.reset();
+    TEST_ASSERT_EQUAL(0, streamer.queued());
+
+    // Float batches at the default MTU don't fit a sample, one per notification is still sent
+    SampleStreamer floats(link, SAMPLE_ENCODING_BATCH, false, 20000);
+    TEST_ASSERT_EQUAL(1, floats.capacity());
+    floats.setMtu(247);
+    TEST_ASSERT_EQUAL(imuBatchCapacity(247), floats.capacity());
+}
+
+static void test_loss_seen_as_gaps()
+{
+    // Every tenth notification is lost on average, the rest arrive after a random delay
+    const LoopbackLinkConfig lossy = {7500, 4, 1500, 3000, 0.1f, 12345};
+    static TestSink sink;
+    sink = TestSink();
+    LoopbackTransport link(lossy);
+    SampleStreamer streamer(link, SAMPLE_ENCODING_COMPACT_BATCH, true, 20000);
+    streamer.setMtu(247);
+    stream(streamer, link, sink, 20000, 4202, 0);
+
+    TEST_ASSERT_EQUAL(0, sink.malformed);
+    TEST_ASSERT_EQUAL_UINT32(0, streamer.refused());
+    TEST_ASSERT_EQUAL_UINT32(0, streamer.overflowed());
+    TEST_ASSERT_EQUAL_UINT32(streamer.sent(), link.sent());
+    TEST_ASSERT_EQUAL_UINT32(link.sent() - link.lost(), link.delivered());
+    TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.1f, (float)link.lost() / link.sent());
+    // Samples of lost notifications show up as gaps, except for any lost at the very end
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)sink.count, sink.stats.received());
+    TEST_ASSERT_LESS_OR_EQUAL(20000, sink.stats.received() + sink.stats.dropped());
+    TEST_ASSERT_GREATER_OR_EQUAL(20000 - IMU_CODEC_MAX_SAMPLES*4, sink.stats.received() + sink.stats.dropped());
+    TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.1f, sink.stats.dropRate());
+    for (int n = 1; n < MAX_RECEIVED; n++)
+    {
+        TEST_ASSERT_TRUE(sink.received[n].sequence > sink.received[n - 1].sequence);
+    }
+    // Waiting for connection events and the random delay are seen as latency and jitter
+    TEST_ASSERT_TRUE(sink.stats.latency().meanUs() > 1000.0f);
+    TEST_ASSERT_TRUE(sink.stats.jitterUs() > 500.0f);
+}
+
+static void test_throughput_limit()
+{
+    // 952 Hz samples over a 7.5 ms connection interval with 4 notifications per event (533 per second): one sample
+    // per notification can't keep up, batches can
+    const LoopbackLinkConfig limited = {7500, 4, 1000, 0, 0.0f, 7};
+    const int encodings[] = {SAMPLE_ENCODING_PACKED, SAMPLE_ENCODING_BATCH, SAMPLE_ENCODING_COMPACT_BATCH, SAMPLE_ENCODING_COMPACT_BATCH};
+    const bool deltas[] = {false, false, false, true};
+    const char *names[] = {"packed", "float batch", "int16 batch", "delta batch"};
+    const int count = 9520; // 10 s
+    const uint32_t period_us = 1050;
+    for (int e = 0; e < 4; e++)
+    {
+        static TestSink sink;
+        sink = TestSink();
+        LoopbackTransport link(limited);
+        SampleStreamer streamer(link, encodings[e], deltas[e], 20000);
+        streamer.setMtu(247);
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        stream(streamer, link, sink, count, period_us, 0);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double host_us = (end.tv_sec - start.tv_sec)*1e6 + (end.tv_nsec - start.tv_nsec)/1e3;
+
+        float seconds = count*period_us/1e6f;
+        printf("%-12s %4.0f samples/s %5.0f bytes/s %4.0f notifications/s, dropped %4.1f%%, p99 latency %lu us, "
+               "host %.2f us/sample\n", names[e], sink.count/seconds, link.deliveredBytes()/seconds,
+               link.delivered()/seconds, 100.0f*sink.stats.dropRate(), (unsigned long)sink.stats.latency().percentileUs(99),
+               host_us/count);
+
+        TEST_ASSERT_EQUAL(0, sink.malformed);
+        // Connection events during the run plus the ones draining the queue afterwards
+        TEST_ASSERT_LESS_OR_EQUAL(4*(count*period_us/7500 + 1) + LOOPBACK_QUEUE_SIZE, link.delivered());
+        if (encodings[e] == SAMPLE_ENCODING_PACKED)
+        {
+            TEST_ASSERT_TRUE(streamer.refused() > 0);
+            TEST_ASSERT_TRUE(sink.stats.dropRate() > 0.3f);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_UINT32(0, streamer.refused());
+            TEST_ASSERT_EQUAL(count, sink.count);
+            TEST_ASSERT_EQUAL_UINT32(0, sink.stats.dropped());
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_each_encoding);
+    RUN_TEST(test_batch_due);
+    RUN_TEST(test_loss_seen_as_gaps);
+    RUN_TEST(test_throughput_limit);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the binary serial frames of the receiver (vr_handheld_lib/VRHandheld/SerialFrame.h).
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <string.h>
+#include <SerialFrame.h>
+#include <ImuCodec.h>
+
+static ImuSample makeSample()
+{
+    ImuSample sample;
+    sample.timestamp_us = 0x12003400u; // zero bytes in the payload
+    sample.sequence = 0x0100;
+    for (int axis = 0; axis < IMU_AXES; axis++)
+    {
+        sample.acc[axis] = axis == 2 ? 1.0f : 0.0f;
+        sample.gyr[axis] = -250.0f + 100.0f*axis;
+        sample.mag[axis] = 0.0f;
+    }
+    sample.button_pressed = true;
+    return sample;
+}
+
+static GestureResult makeGesture()
+{
+    GestureResult result;
+    result.number = 7;
+    result.start_us = 4294967000u;
+    result.duration_us = 1250000;
+    result.num_samples = 297;
+    result.label = 3;
+    result.confidence = 0.875f;
+    result.inference_us = 0; // zero bytes in the payload
+    result.controller = 2;
+    return result;
+}
+
+// Every frame has the same length, ends with the only zero byte and is given to the decoders without it
+static void assertFrameShape(const uint8_t frame[SERIAL_FRAME_LENGTH_BYTES])
+{
+    for (int i = 0; i < SERIAL_FRAME_LENGTH_BYTES - 1; i++)
+    {
+        TEST_ASSERT_NOT_EQUAL(0, frame[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, frame[SERIAL_FRAME_LENGTH_BYTES - 1]);
+}
+
+void test_crc_known_answer()
+{
+    // Check value of CRC-16/CCITT-FALSE
+    const char *check = "123456789";
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, crc16Ccitt((const uint8_t *)check, 9));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, crc16Ccitt((const uint8_t *)check, 0));
+}
+
+void test_cobs_zeros()
+{
+    const uint8_t data[] = {0x00, 0x11, 0x00, 0x00, 0x22, 0x33, 0x00};
+    uint8_t encoded[sizeof(data) + 1];
+    uint8_t decoded[sizeof(data)];
+    int length = cobsEncode(data, sizeof(data), encoded);
+    TEST_ASSERT_EQUAL(sizeof(data) + 1, length);
+    for (int i = 0; i < length; i++)
+    {
+        TEST_ASSERT_NOT_EQUAL(0, encoded[i]);
+    }
+    TEST_ASSERT_EQUAL(sizeof(data), cobsDecode(encoded, length, decoded));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data, decoded, sizeof(data));
+
+    const uint8_t all_zero[4] = {0, 0, 0, 0};
+    length = cobsEncode(all_zero, sizeof(all_zero), encoded);
+    TEST_ASSERT_EQUAL(sizeof(all_zero), cobsDecode(encoded, length, decoded));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(all_zero, decoded, sizeof(all_zero));
+}
+
+void test_sample_round_trip()
+{
+    ImuSample sample = makeSample();
+    uint8_t frame[SERIAL_FRAME_LENGTH_BYTES];
+    encodeSampleFrame(sample, 5, frame);
+    assertFrameShape(frame);
+
+    ImuSample decoded;
+    uint8_t controller = 0;
+    TEST_ASSERT_TRUE(decodeSampleFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 1, decoded, controller));
+    TEST_ASSERT_EQUAL_UINT8(5, controller);
+    TEST_ASSERT_EQUAL_UINT32(sample.timestamp_us, decoded.timestamp_us);
+    TEST_ASSERT_EQUAL_UINT16(sample.sequence, decoded.sequence);
+    TEST_ASSERT_EQUAL(sample.button_pressed, decoded.button_pressed);
+    for (int axis = 0; axis < IMU_AXES; axis++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_ACC_SCALE + 1e-6f, sample.acc[axis], decoded.acc[axis]);
+        TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_GYR_SCALE + 1e-4f, sample.gyr[axis], decoded.gyr[axis]);
+        TEST_ASSERT_FLOAT_WITHIN(0.5f*IMU_CODEC_MAG_SCALE + 1e-5f, sample.mag[axis], decoded.mag[axis]);
+    }
+
+    // The highest controller id still fits next to the button bit
+    encodeSampleFrame(sample, SERIAL_FRAME_MAX_CONTROLLER, frame);
+    TEST_ASSERT_TRUE(decodeSampleFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 1, decoded, controller));
+    TEST_ASSERT_EQUAL_UINT8(SERIAL_FRAME_MAX_CONTROLLER, controller);
+    TEST_ASSERT_TRUE(decoded.button_pressed);
+}
+
+void test_gesture_round_trip()
+{
+    GestureResult result = makeGesture();
+    uint8_t frame[SERIAL_FRAME_LENGTH_BYTES];
+    encodeGestureFrame(result, frame);
+    assertFrameShape(frame);
+
+    GestureResult decoded;
+    memset(&decoded, 0xA5, sizeof(decoded));
+    TEST_ASSERT_TRUE(decodeGestureFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 1, decoded));
+    TEST_ASSERT_EQUAL_UINT16(result.number, decoded.number);
+    TEST_ASSERT_EQUAL_UINT32(result.start_us, decoded.start_us);
+    TEST_ASSERT_EQUAL_UINT32(result.duration_us, decoded.duration_us);
+    TEST_ASSERT_EQUAL_UINT16(result.num_samples, decoded.num_samples);
+    TEST_ASSERT_EQUAL_INT8(result.label, decoded.label);
+    TEST_ASSERT_EQUAL_FLOAT(result.confidence, decoded.confidence);
+    TEST_ASSERT_EQUAL_UINT32(result.inference_us, decoded.inference_us);
+    TEST_ASSERT_EQUAL_UINT8(result.controller, decoded.controller);
+}
+
+void test_wrong_type()
+{
+    uint8_t frame[SERIAL_FRAME_LENGTH_BYTES];
+    encodeGestureFrame(makeGesture(), frame);
+    ImuSample sample;
+    uint8_t controller;
+    TEST_ASSERT_FALSE(decodeSampleFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 1, sample, controller));
+
+    encodeSampleFrame(makeSample(), 1, frame);
+    GestureResult result;
+    TEST_ASSERT_FALSE(decodeGestureFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 1, result));
+}
+
+void test_corrupted_crc()
+{
+    // Flip a single bit in every byte position in turn: COBS or the CRC must reject each of them
+    uint8_t frame[SERIAL_FRAME_LENGTH_BYTES];
+    encodeSampleFrame(makeSample(), 1, frame);
+    for (int i = 0; i < SERIAL_FRAME_LENGTH_BYTES - 1; i++)
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            uint8_t corrupted[SERIAL_FRAME_LENGTH_BYTES];
+            memcpy(corrupted, frame, sizeof(frame));
+            corrupted[i] ^= 1 << bit;
+            ImuSample sample;
+            uint8_t controller;
+            TEST_ASSERT_FALSE(decodeSampleFrame(corrupted, SERIAL_FRAME_LENGTH_BYTES - 1, sample, controller));
+        }
+    }
+
+    // A wrong CRC in an otherwise well formed frame, as from a payload changed before encoding
+    uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES];
+    TEST_ASSERT_EQUAL(SERIAL_FRAME_PAYLOAD_LENGTH_BYTES, cobsDecode(frame, SERIAL_FRAME_LENGTH_BYTES - 1, payload));
+    payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES - 1] ^= 0x80;
+    uint8_t reencoded[SERIAL_FRAME_LENGTH_BYTES];
+    cobsEncode(payload, SERIAL_FRAME_PAYLOAD_LENGTH_BYTES, reencoded);
+    ImuSample sample;
+    uint8_t controller;
+    TEST_ASSERT_FALSE(decodeSampleFrame(reencoded, SERIAL_FRAME_LENGTH_BYTES - 1, sample, controller));
+}
+
+void test_wrong_length()
+{
+    uint8_t frame[SERIAL_FRAME_LENGTH_BYTES];
+    encodeSampleFrame(makeSample(), 1, frame);
+    ImuSample sample;
+    uint8_t controller;
+    TEST_ASSERT_FALSE(decodeSampleFrame(frame, SERIAL_FRAME_LENGTH_BYTES - 2, sample, controller));
+    TEST_ASSERT_FALSE(decodeSampleFrame(frame, SERIAL_FRAME_LENGTH_BYTES, sample, controller));
+    TEST_ASSERT_FALSE(decodeSampleFrame(frame, 0, sample, controller));
+
+    // Status text printed while connecting is dropped as well
+    const char *text = "Connecting to controller 1...\n";
+    GestureResult result;
+    TEST_ASSERT_FALSE(decodeGestureFrame((const uint8_t *)text, strlen(text), result));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_crc_known_answer);
+    RUN_TEST(test_cobs_zeros);
+    RUN_TEST(test_sample_round_trip);
+    RUN_TEST(test_gesture_round_trip);
+    RUN_TEST(test_wrong_type);
+    RUN_TEST(test_corrupted_crc);
+    RUN_TEST(test_wrong_length);
+    return UNITY_END();
+}
@@ -0,0 +1,190 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Tests of the recorded session log (vr_handheld_lib/SessionLog/SessionLog.h): records written through
+SessionLogWriter come back unchanged through the memory mapped reader, merged in time order and after seeking.
+
+Run on the host with: pio test -e native
+*/
+
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <SessionLog.h>
+
+#define IMU_PERIOD_US 2000
+#define LIGHTHOUSE_PERIOD_US 8333
+#define IMU_RECORDS (2*SESSION_CHUNK_RECORDS + 17) // several chunks, the last one partly filled
+#define LIGHTHOUSE_RECORDS 600
+
+static char path[64];
+
+static SessionImuRecord imuRecord(int n)
+{
+    SessionImuRecord record;
+    for (int i = 0; i < 3; i++)
+    {
+        record.gyr[i] = n + 0.25f*i;
+        record.acc[i] = -n - 0.5f*i;
+    }
+    return record;
+}
+
+static void writeSession()
+{
+    strcpy(path, "/tmp/test_session_logXXXXXX");
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+
+    SessionLogWriter writer;
+    TEST_ASSERT_TRUE(writer.open(path, "unit test"));
+    writer.setBaseStation(-11.993, 2.255);
+    // Written interleaved as a recorder would, chunks of the two channels end up interleaved in the file
+    int imu = 0;
+    int lighthouse = 0;
+    while (imu < IMU_RECORDS || lighthouse < LIGHTHOUSE_RECORDS)
+    {
+        if (lighthouse == LIGHTHOUSE_RECORDS || (imu < IMU_RECORDS && (uint64_t)imu*IMU_PERIOD_US <= (uint64_t)lighthouse*LIGHTHOUSE_PERIOD_US))
+        {
+            SessionImuRecord record = imuRecord(imu);
+            TEST_ASSERT_TRUE(writer.add(SESSION_CHANNEL_IMU, (uint64_t)imu*IMU_PERIOD_US, &record));
+            imu++;
+        }
+        else
+        {
+            SessionLighthouseRecord record;
+            for (int i = 0; i < 8; i++)
+            {
+                record.clock_ticks[i] = 180000 + 10*lighthouse + i;
+            }
+            TEST_ASSERT_TRUE(writer.add(SESSION_CHANNEL_LIGHTHOUSE, (uint64_t)lighthouse*LIGHTHOUSE_PERIOD_US, &record));
+            lighthouse++;
+        }
+    }
+    SessionMarkerRecord marker = {SESSION_MARKER_GESTURE_START, 3};
+    TEST_ASSERT_TRUE(writer.add(SESSION_CHANNEL_MARKER, 1000000, &marker));
+    // Timestamps can't go back within a channel and unknown channels are refused
+    TEST_ASSERT_FALSE(writer.add(SESSION_CHANNEL_MARKER, 999999, &marker));
+    TEST_ASSERT_FALSE(writer.add(7, 2000000, &marker));
+    TEST_ASSERT_TRUE(writer.close());
+}
+
+static void test_chunks_zero_copy()
+{
+    writeSession();
+    SessionLogReader reader;
+    TEST_ASSERT_TRUE(reader.open(path));
+    TEST_ASSERT_EQUAL_STRING("unit test", reader.header().description);
+    TEST_ASSERT_EQUAL_FLOAT(-11.993f, (float)reader.header().base_station_pitch);
+    TEST_ASSERT_EQUAL_UINT32(IMU_RECORDS, reader.recordCount(SESSION_CHANNEL_IMU));
+    TEST_ASSERT_EQUAL_UINT32(LIGHTHOUSE_RECORDS, reader.recordCount(SESSION_CHANNEL_LIGHTHOUSE));
+    TEST_ASSERT_EQUAL_UINT32(1, reader.recordCount(SESSION_CHANNEL_MARKER));
+    TEST_ASSERT_EQUAL_UINT32(0, reader.recordCount(SESSION_CHANNEL_CONTROLLER));
+    TEST_ASSERT_EQUAL(3 + 1 + 1, reader.chunkCount());
+
+    // The IMU chunks are float arrays with the layout of simulatedImuData.h
+    int n = 0;
+    for (int i = 0; i < reader.chunkCount(); i++)
+    {
+        SessionChunk chunk = reader.chunk(i);
+        if (chunk.channel != SESSION_CHANNEL_IMU)
+        {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_UINT32(reader.indexEntry(i).first_us, chunk.timestamps_us[0]);
+        TEST_ASSERT_EQUAL_UINT32(reader.indexEntry(i).last_us, chunk.timestamps_us[chunk.count - 1]);
+        const float *values = &sessionImuRecords(chunk)->gyr[0];
+        for (uint32_t j = 0; j < chunk.count; j++, n++)
+        {
+            TEST_ASSERT_EQUAL_UINT32((uint64_t)n*IMU_PERIOD_US, chunk.timestamps_us[j]);
+            TEST_ASSERT_EQUAL_FLOAT(n + 0.5f, values[6*j + 2]);
+            TEST_ASSERT_EQUAL_FLOAT(-n - 1.0f, values[6*j + 5]);
+        }
+    }
+    TEST_ASSERT_EQUAL(IMU_RECORDS, n);
+    reader.close();
+}
+
+static void test_cursor_merges_and_seeks()
+{
+    SessionLogReader reader;
+    TEST_ASSERT_TRUE(reader.open(path));
+    SessionCursor cursor(reader, (1u << SESSION_CHANNEL_IMU) | (1u << SESSION_CHANNEL_LIGHTHOUSE));
+    SessionRecord record;
+    uint64_t previous_us = 0;
+    int imu = 0;
+    int lighthouse = 0;
+    while (cursor.next(record))
+    {
+        TEST_ASSERT_TRUE(record.timestamp_us >= previous_us);
+        previous_us = record.timestamp_us;
+        if (record.channel == SESSION_CHANNEL_IMU)
+        {
+            TEST_ASSERT_EQUAL_FLOAT((float)imu, ((const SessionImuRecord *)record.data)->gyr[0]);
+            imu++;
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(SESSION_CHANNEL_LIGHTHOUSE, record.channel);
+            TEST_ASSERT_EQUAL_UINT32((uint32_t)(180000 + 10*lighthouse), ((const SessionLighthouseRecord *)record.data)->clock_ticks[0]);
+            lighthouse++;
+        }
+    }
+    TEST_ASSERT_EQUAL(IMU_RECORDS, imu);
+    TEST_ASSERT_EQUAL(LIGHTHOUSE_RECORDS, lighthouse);
+
+    // Into the second IMU chunk, between two samples
+    cursor.seek((uint64_t)1500*IMU_PERIOD_US + 1);
+    TEST_ASSERT_TRUE(cursor.next(record));
+    TEST_ASSERT_EQUAL(SESSION_CHANNEL_IMU, record.channel);
+    TEST_ASSERT_EQUAL_UINT32((uint64_t)1501*IMU_PERIOD_US, record.timestamp_us);
+    while (cursor.next(record) && record.channel == SESSION_CHANNEL_IMU)
+    {
+    }
+    TEST_ASSERT_EQUAL(SESSION_CHANNEL_LIGHTHOUSE, record.channel);
+    TEST_ASSERT_EQUAL_UINT32((uint64_t)361*LIGHTHOUSE_PERIOD_US, record.timestamp_us);
+    // Past the end of every channel
+    cursor.seek((uint64_t)LIGHTHOUSE_RECORDS*LIGHTHOUSE_PERIOD_US);
+    TEST_ASSERT_FALSE(cursor.next(record));
+    reader.close();
+}
+
+static void test_rejects_damaged_files()
+{
+    // Cut off before the index, as after a crash while recording
+    FILE *file = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(file);
+    static uint8_t contents[1 << 20];
+    size_t length = fread(contents, 1, sizeof(contents), file);
+    fclose(file);
+    TEST_ASSERT_TRUE(length > 1000 && length < sizeof(contents));
+
+    SessionLogReader reader;
+    file = fopen(path, "wb");
+    fwrite(contents, 1, length - 100, file);
+    fclose(file);
+    TEST_ASSERT_FALSE(reader.open(path));
+
+    // Damaged chunk header
+    SessionIndexEntry entry;
+    memcpy(&entry, contents + ((SessionFileHeader *)contents)->index_offset, sizeof(entry));
+    contents[entry.offset] ^= 0xFF;
+    file = fopen(path, "wb");
+    fwrite(contents, 1, length, file);
+    fclose(file);
+    TEST_ASSERT_FALSE(reader.open(path));
+    TEST_ASSERT_EQUAL(0, reader.chunkCount());
+    TEST_ASSERT_FALSE(reader.open("/tmp/does/not/exist"));
+    unlink(path);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_chunks_zero_copy);
+    RUN_TEST(test_cursor_merges_and_seeks);
+    RUN_TEST(test_rejects_damaged_files);
+    return UNITY_END();
+}
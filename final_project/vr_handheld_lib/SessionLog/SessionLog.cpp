@@ -0,0 +1,440 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Binary log of a recorded session, writer and memory mapped reader.
+*/
+
+#include "SessionLog.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(SessionFileHeader) == 64, "SessionFileHeader layout");
+static_assert(sizeof(SessionChunkHeader) == 16, "SessionChunkHeader layout");
+static_assert(sizeof(SessionIndexEntry) == 32, "SessionIndexEntry layout");
+static_assert(sizeof(SessionImuRecord) == 24, "SessionImuRecord layout");
+static_assert(sizeof(SessionLighthouseRecord) == 32, "SessionLighthouseRecord layout");
+static_assert(sizeof(SessionControllerRecord) == 44, "SessionControllerRecord layout");
+static_assert(sizeof(SessionMarkerRecord) == 8, "SessionMarkerRecord layout");
+static_assert(sizeof(SessionSweepRecord) == 108, "SessionSweepRecord layout");
+static_assert(sizeof(SessionPoseRecord) == 32, "SessionPoseRecord layout");
+
+static const uint8_t PADDING[8] = {0};
+
+static uint64_t padded(uint64_t length)
+{
+    return (length + 7) & ~(uint64_t)7;
+}
+
+static bool littleEndian()
+{
+    uint16_t one = 1;
+    return *(const uint8_t *)&one == 1;
+}
+
+int sessionRecordLength(int channel)
+{
+    switch (channel)
+    {
+    case SESSION_CHANNEL_IMU:
+        return sizeof(SessionImuRecord);
+    case SESSION_CHANNEL_LIGHTHOUSE:
+        return sizeof(SessionLighthouseRecord);
+    case SESSION_CHANNEL_CONTROLLER:
+        return sizeof(SessionControllerRecord);
+    case SESSION_CHANNEL_MARKER:
+        return sizeof(SessionMarkerRecord);
+    case SESSION_CHANNEL_SWEEP:
+        return sizeof(SessionSweepRecord);
+    case SESSION_CHANNEL_POSE:
+        return sizeof(SessionPoseRecord);
+    default:
+        return 0;
+    }
+}
+
+SessionLogWriter::SessionLogWriter() :
+    file(NULL),
+    failed(false),
+    offset(0),
+    index(NULL),
+    index_capacity(0)
+{
+    memset(&header, 0, sizeof(header));
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        timestamps[channel] = NULL;
+        records[channel] = NULL;
+    }
+}
+
+SessionLogWriter::~SessionLogWriter()
+{
+    if (file)
+    {
+        close();
+    }
+}
+
+bool SessionLogWriter::open(const char *path, const char *description)
+{
+    if (file || !littleEndian())
+    {
+        return false;
+    }
+    file = fopen(path, "wb");
+    if (!file)
+    {
+        return false;
+    }
+    failed = false;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SESSION_MAGIC, SESSION_MAGIC_LENGTH);
+    header.version = SESSION_VERSION;
+    header.header_length = sizeof(header);
+    strncpy(header.description, description ? description : "", SESSION_DESCRIPTION_LENGTH - 1);
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        counts[channel] = 0;
+        started[channel] = false;
+        last_us[channel] = 0;
+    }
+    // The header is written again with the index offset on close
+    failed = fwrite(&header, sizeof(header), 1, file) != 1;
+    offset = sizeof(header);
+    return !failed;
+}
+
+void SessionLogWriter::setBaseStation(double pitch, double roll)
+{
+    header.base_station_pitch = pitch;
+    header.base_station_roll = roll;
+}
+
+bool SessionLogWriter::add(int channel, uint64_t timestamp_us, const void *record)
+{
+    int length = sessionRecordLength(channel);
+    if (!file || length == 0 || (started[channel] && timestamp_us < last_us[channel]))
+    {
+        return false;
+    }
+    if (!records[channel])
+    {
+        timestamps[channel] = (uint64_t *)malloc(SESSION_CHUNK_RECORDS * sizeof(uint64_t));
+        records[channel] = (uint8_t *)malloc(SESSION_CHUNK_RECORDS * length);
+        if (!timestamps[channel] || !records[channel])
+        {
+            failed = true;
+            return false;
+        }
+    }
+    timestamps[channel][counts[channel]] = timestamp_us;
+    memcpy(records[channel] + counts[channel]*length, record, length);
+    counts[channel]++;
+    started[channel] = true;
+    last_us[channel] = timestamp_us;
+    if (counts[channel] == SESSION_CHUNK_RECORDS)
+    {
+        return flush(channel);
+    }
+    return !failed;
+}
+
+bool SessionLogWriter::flush(int channel)
+{
+    int count = counts[channel];
+    if (count == 0)
+    {
+        return !failed;
+    }
+    if ((int)header.chunk_count == index_capacity)
+    {
+        int capacity = index_capacity ? 2*index_capacity : 64;
+        SessionIndexEntry *grown = (SessionIndexEntry *)realloc(index, capacity * sizeof(SessionIndexEntry));
+        if (!grown)
+        {
+            failed = true;
+            return false;
+        }
+        index = grown;
+        index_capacity = capacity;
+    }
+
+    int length = sessionRecordLength(channel);
+    SessionChunkHeader chunk;
+    chunk.magic = SESSION_CHUNK_MAGIC;
+    chunk.channel = channel;
+    chunk.record_length = length;
+    chunk.count = count;
+    chunk.records_offset = sizeof(chunk) + count*sizeof(uint64_t);
+    uint64_t records_length = (uint64_t)count*length;
+    bool written = fwrite(&chunk, sizeof(chunk), 1, file) == 1 &&
+                   fwrite(timestamps[channel], sizeof(uint64_t), count, file) == (size_t)count &&
+                   fwrite(records[channel], 1, records_length, file) == records_length &&
+                   fwrite(PADDING, 1, padded(records_length) - records_length, file) == padded(records_length) - records_length;
+
+    SessionIndexEntry &entry = index[header.chunk_count++];
+    entry.offset = offset;
+    entry.channel = channel;
+    entry.record_length = length;
+    entry.count = count;
+    entry.first_us = timestamps[channel][0];
+    entry.last_us = timestamps[channel][count - 1];
+    offset += chunk.records_offset + padded(records_length);
+    counts[channel] = 0;
+    failed = failed || !written;
+    return !failed;
+}
+
+bool SessionLogWriter::close()
+{
+    if (!file)
+    {
+        return false;
+    }
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        flush(channel);
+    }
+    header.index_offset = offset;
+    if (header.chunk_count > 0 && fwrite(index, sizeof(SessionIndexEntry), header.chunk_count, file) != header.chunk_count)
+    {
+        failed = true;
+    }
+    if (fseek(file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, file) != 1)
+    {
+        failed = true;
+    }
+    if (fclose(file) != 0)
+    {
+        failed = true;
+    }
+    file = NULL;
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        free(timestamps[channel]);
+        free(records[channel]);
+        timestamps[channel] = NULL;
+        records[channel] = NULL;
+    }
+    free(index);
+    index = NULL;
+    index_capacity = 0;
+    return !failed;
+}
+
+SessionLogReader::SessionLogReader() :
+    data(NULL),
+    size(0),
+    file_header(NULL),
+    index(NULL)
+{
+}
+
+SessionLogReader::~SessionLogReader()
+{
+    close();
+}
+
+bool SessionLogReader::open(const char *path)
+{
+    close();
+    if (!littleEndian())
+    {
+        return false;
+    }
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || (uint64_t)status.st_size < sizeof(SessionFileHeader))
+    {
+        ::close(fd);
+        return false;
+    }
+    // The mapping stays valid after the descriptor is closed
+    void *mapped = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+    data = (const uint8_t *)mapped;
+    size = status.st_size;
+    file_header = (const SessionFileHeader *)data;
+
+    const SessionFileHeader &h = *file_header;
+    uint64_t index_end = h.index_offset + (uint64_t)h.chunk_count*sizeof(SessionIndexEntry);
+    bool valid = memcmp(h.magic, SESSION_MAGIC, SESSION_MAGIC_LENGTH) == 0 && h.version == SESSION_VERSION &&
+                 h.header_length == sizeof(SessionFileHeader) && h.index_offset >= sizeof(SessionFileHeader) &&
+                 h.index_offset % 8 == 0 && index_end <= size;
+    index = valid ? (const SessionIndexEntry *)(data + h.index_offset) : NULL;
+    for (uint32_t i = 0; valid && i < h.chunk_count; i++)
+    {
+        const SessionIndexEntry &entry = index[i];
+        const SessionChunkHeader *chunk = (const SessionChunkHeader *)(data + entry.offset);
+        valid = entry.offset % 8 == 0 && entry.offset + sizeof(SessionChunkHeader) <= h.index_offset &&
+                chunk->magic == SESSION_CHUNK_MAGIC && chunk->channel == entry.channel &&
+                chunk->record_length == entry.record_length && chunk->count == entry.count && entry.count > 0 &&
+                entry.channel < SESSION_MAX_CHANNELS && entry.record_length > 0 &&
+                (sessionRecordLength(entry.channel) == 0 || sessionRecordLength(entry.channel) == entry.record_length) &&
+                chunk->records_offset == sizeof(SessionChunkHeader) + (uint64_t)entry.count*sizeof(uint64_t) &&
+                entry.offset + chunk->records_offset + (uint64_t)entry.count*entry.record_length <= h.index_offset;
+    }
+    if (!valid)
+    {
+        close();
+    }
+    return valid;
+}
+
+void SessionLogReader::close()
+{
+    if (data)
+    {
+        munmap((void *)data, size);
+    }
+    data = NULL;
+    size = 0;
+    file_header = NULL;
+    index = NULL;
+}
+
+const SessionFileHeader &SessionLogReader::header() const
+{
+    return *file_header;
+}
+
+int SessionLogReader::chunkCount() const
+{
+    return file_header ? file_header->chunk_count : 0;
+}
+
+const SessionIndexEntry &SessionLogReader::indexEntry(int i) const
+{
+    return index[i];
+}
+
+SessionChunk SessionLogReader::chunk(int i) const
+{
+    const SessionIndexEntry &entry = index[i];
+    const uint8_t *start = data + entry.offset;
+    SessionChunk chunk;
+    chunk.channel = entry.channel;
+    chunk.record_length = entry.record_length;
+    chunk.count = entry.count;
+    chunk.timestamps_us = (const uint64_t *)(start + sizeof(SessionChunkHeader));
+    chunk.records = start + ((const SessionChunkHeader *)start)->records_offset;
+    return chunk;
+}
+
+uint64_t SessionLogReader::recordCount(int channel) const
+{
+    uint64_t count = 0;
+    for (int i = 0; i < chunkCount(); i++)
+    {
+        if (index[i].channel == channel)
+        {
+            count += index[i].count;
+        }
+    }
+    return count;
+}
+
+SessionCursor::SessionCursor(const SessionLogReader &reader, unsigned int channel_mask) :
+    reader(reader),
+    channel_mask(channel_mask)
+{
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        startChannel(channel, 0);
+    }
+}
+
+void SessionCursor::startChannel(int channel, int from_chunk)
+{
+    chunk_index[channel] = -1;
+    record_index[channel] = 0;
+    if (!(channel_mask & (1u << channel)))
+    {
+        return;
+    }
+    for (int i = from_chunk; i < reader.chunkCount(); i++)
+    {
+        if (reader.indexEntry(i).channel == channel)
+        {
+            chunk_index[channel] = i;
+            return;
+        }
+    }
+}
+
+bool SessionCursor::next(SessionRecord &record)
+{
+    int best = -1;
+    uint64_t best_us = 0;
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        if (chunk_index[channel] < 0)
+        {
+            continue;
+        }
+        uint64_t timestamp_us = reader.chunk(chunk_index[channel]).timestamps_us[record_index[channel]];
+        if (best < 0 || timestamp_us < best_us)
+        {
+            best = channel;
+            best_us = timestamp_us;
+        }
+    }
+    if (best < 0)
+    {
+        return false;
+    }
+    SessionChunk chunk = reader.chunk(chunk_index[best]);
+    record.channel = best;
+    record.timestamp_us = best_us;
+    record.data = chunk.records + (size_t)record_index[best]*chunk.record_length;
+    if (++record_index[best] == chunk.count)
+    {
+        startChannel(best, chunk_index[best] + 1);
+    }
+    return true;
+}
+
+void SessionCursor::seek(uint64_t timestamp_us)
+{
+    for (int channel = 0; channel < SESSION_MAX_CHANNELS; channel++)
+    {
+        // The index gives the first chunk not entirely before timestamp_us, the chunk's timestamps the record
+        startChannel(channel, 0);
+        while (chunk_index[channel] >= 0 && reader.indexEntry(chunk_index[channel]).last_us < timestamp_us)
+        {
+            startChannel(channel, chunk_index[channel] + 1);
+        }
+        if (chunk_index[channel] < 0)
+        {
+            continue;
+        }
+        SessionChunk chunk = reader.chunk(chunk_index[channel]);
+        uint32_t low = 0;
+        uint32_t high = chunk.count - 1; // last_us >= timestamp_us, so the record is in this chunk
+        while (low < high)
+        {
+            uint32_t middle = (low + high) / 2;
+            if (chunk.timestamps_us[middle] < timestamp_us)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        record_index[channel] = low;
+    }
+}
@@ -0,0 +1,264 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Binary log of a recorded session: VRduino IMU readings, lighthouse clock ticks and raw sweeps, handheld controller
+samples, ground truth poses and markers (e.g. gesture labels), each with a timestamp, in one file that is replayed without parsing or
+copying.
+
+Records are stored per channel in chunks of up to SESSION_CHUNK_RECORDS. A chunk holds the timestamps of its
+records in one array followed by the records in another, so the records of a chunk are a plain C array with the
+same layout as the tables in simulatedImuData.h and simulatedLighthouseData.h. SessionLogReader maps the file into
+memory, a chunk's arrays can then be handed to OrientationTracker::setSimulatedImu() or
+PoseTracker::setSimulatedLighthouse() directly. The chunk index at the end of the file gives the channel, record
+count and time range of every chunk, so a reader can seek without touching the chunks.
+
+Layout (little endian, every section starts at a multiple of 8 bytes):
+    0   SessionFileHeader, index_offset is 0 until the writer was closed
+    64  chunks, each:
+        SessionChunkHeader
+        uint64  timestamp of each record in microseconds since the start of the session
+        records of the channel's record type, padded to 8 bytes
+    index_offset: chunk_count times SessionIndexEntry
+
+Timestamps never decrease within a channel. The host tools in final_project/session_tools convert the training
+CSVs, the simulation tables and VRduino recordings (vrduino/SessionRecorder.h) into this format, generate synthetic
+sessions and replay them.
+
+Only builds on the host (POSIX mmap), the controller and receiver firmware don't include it.
+*/
+
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define SESSION_MAGIC "VRSESSLG"
+#define SESSION_MAGIC_LENGTH 8
+#define SESSION_VERSION 1
+#define SESSION_CHUNK_MAGIC 0x4B4E4843 // "CHNK"
+#define SESSION_CHUNK_RECORDS 1024
+#define SESSION_DESCRIPTION_LENGTH 24
+
+// Channel types, a session has at most one channel of each
+#define SESSION_CHANNEL_IMU 1        // SessionImuRecord
+#define SESSION_CHANNEL_LIGHTHOUSE 2 // SessionLighthouseRecord
+#define SESSION_CHANNEL_CONTROLLER 3 // SessionControllerRecord
+#define SESSION_CHANNEL_MARKER 4     // SessionMarkerRecord
+#define SESSION_CHANNEL_SWEEP 5      // SessionSweepRecord
+#define SESSION_CHANNEL_POSE 6       // SessionPoseRecord, ground truth of generated traces
+#define SESSION_MAX_CHANNELS 8       // channel types are below this
+
+#define SESSION_MARKER_GESTURE_START 1 // value: gesture label
+#define SESSION_MARKER_GESTURE_END 2   // value: gesture label
+#define SESSION_MARKER_IMU_DROPPED 3   // value: IMU readings the recorder dropped before the next one
+#define SESSION_MARKER_SWEEP_DROPPED 4 // value: sweeps the recorder dropped before the next one
+#define SESSION_MARKER_SEGMENT 5       // value: label of the trajectory segment that starts
+
+#define SESSION_CONTROLLER_BUTTON_PRESSED 0x01
+
+// VRduino IMU reading, same order and units as a row of simulatedImuData.h
+struct SessionImuRecord {
+    float gyr[3]; // x,y,z deg/s
+    float acc[3]; // x,y,z m/s^2
+};
+
+// Clock ticks of one lighthouse frame, same order as a row of simulatedLighthouseData.h
+struct SessionLighthouseRecord {
+    uint32_t clock_ticks[8]; // sensor0 horizontal, sensor0 vertical, sensor1 horizontal, ...
+};
+
+// Raw timings of one lighthouse sweep as read out by the VRduino (Lighthouse::readStationSweepTimings()). The entries
+// of the swept axis are new, the others are from the previous sweep of the station.
+struct SessionSweepRecord {
+    uint8_t station; // slot of the base station (0 or 1)
+    int8_t mode;     // 0:A, 1:B, 2:C, -1 until the OOTX frame was decoded
+    uint8_t axis;    // 0 horizontal, 1 vertical
+    uint8_t reserved;
+    float pitch;     // degrees
+    float roll;
+    uint32_t clock_ticks[8];          // same order as SessionLighthouseRecord
+    uint32_t num_pulse_detections[8]; // 0 if the diode was covered, more than 1 with inter-reflections
+    uint32_t pulse_width[8];          // clock ticks
+};
+
+// Pose of the VRduino in the frame of a base station, same conventions as PoseTracker::getPosition() and
+// getQuaternionHm()
+struct SessionPoseRecord {
+    uint8_t station; // slot of the base station whose frame this is
+    uint8_t reserved[3];
+    float position[3];   // x,y,z mm
+    float quaternion[4]; // w,x,y,z
+};
+
+// Sample of a handheld controller as received (see vr_handheld_lib/VRHandheld/ImuPacket.h)
+struct SessionControllerRecord {
+    uint32_t sample_us; // micros() on the controller when the sample was taken
+    uint16_t sequence;
+    uint8_t flags;      // SESSION_CONTROLLER_BUTTON_PRESSED
+    uint8_t controller; // id of the controller on the receiver
+    float acc[3];       // x,y,z g
+    float gyr[3];       // x,y,z deg/s
+    float mag[3];       // x,y,z muT
+};
+
+struct SessionMarkerRecord {
+    uint32_t kind; // SESSION_MARKER_*
+    int32_t value;
+};
+
+struct SessionFileHeader {
+    char magic[SESSION_MAGIC_LENGTH];
+    uint16_t version;
+    uint16_t header_length;
+    uint32_t chunk_count;
+    uint64_t index_offset;
+    double base_station_pitch; // degrees, for lighthouse replay
+    double base_station_roll;
+    char description[SESSION_DESCRIPTION_LENGTH]; // zero padded
+};
+
+struct SessionChunkHeader {
+    uint32_t magic;
+    uint16_t channel;
+    uint16_t record_length;
+    uint32_t count;
+    uint32_t records_offset; // from the start of the chunk
+};
+
+struct SessionIndexEntry {
+    uint64_t offset; // of the chunk header
+    uint16_t channel;
+    uint16_t record_length;
+    uint32_t count;
+    uint64_t first_us;
+    uint64_t last_us;
+};
+
+// Record length in bytes of a channel type, 0 if unknown
+int sessionRecordLength(int channel);
+
+class SessionLogWriter {
+public:
+    SessionLogWriter();
+    ~SessionLogWriter();
+
+    // Creates the file, description is truncated to SESSION_DESCRIPTION_LENGTH - 1 characters
+    bool open(const char *path, const char *description);
+    void setBaseStation(double pitch, double roll);
+
+    // Appends a record of a known channel type, returns false if the channel is unknown, the timestamp is older
+    // than the channel's last one or writing failed
+    bool add(int channel, uint64_t timestamp_us, const void *record);
+
+    // Writes the partly filled chunks and the index, the file is only readable after this. Returns false if any
+    // write failed.
+    bool close();
+
+private:
+    bool flush(int channel);
+
+    FILE *file;
+    bool failed;
+    SessionFileHeader header;
+    uint64_t offset;
+    uint64_t *timestamps[SESSION_MAX_CHANNELS];
+    uint8_t *records[SESSION_MAX_CHANNELS];
+    int counts[SESSION_MAX_CHANNELS];
+    bool started[SESSION_MAX_CHANNELS];
+    uint64_t last_us[SESSION_MAX_CHANNELS];
+    SessionIndexEntry *index;
+    int index_capacity;
+};
+
+// Arrays of one chunk inside the mapped file
+struct SessionChunk {
+    int channel;
+    int record_length;
+    uint32_t count;
+    const uint64_t *timestamps_us;
+    const uint8_t *records;
+};
+
+inline const SessionImuRecord *sessionImuRecords(const SessionChunk &chunk)
+{
+    return (const SessionImuRecord *)chunk.records;
+}
+
+inline const SessionLighthouseRecord *sessionLighthouseRecords(const SessionChunk &chunk)
+{
+    return (const SessionLighthouseRecord *)chunk.records;
+}
+
+inline const SessionControllerRecord *sessionControllerRecords(const SessionChunk &chunk)
+{
+    return (const SessionControllerRecord *)chunk.records;
+}
+
+inline const SessionMarkerRecord *sessionMarkerRecords(const SessionChunk &chunk)
+{
+    return (const SessionMarkerRecord *)chunk.records;
+}
+
+inline const SessionSweepRecord *sessionSweepRecords(const SessionChunk &chunk)
+{
+    return (const SessionSweepRecord *)chunk.records;
+}
+
+inline const SessionPoseRecord *sessionPoseRecords(const SessionChunk &chunk)
+{
+    return (const SessionPoseRecord *)chunk.records;
+}
+
+class SessionLogReader {
+public:
+    SessionLogReader();
+    ~SessionLogReader();
+
+    // Maps the file and checks the header, the index and every chunk header. Returns false if the file can't be
+    // mapped, is malformed or wasn't closed by the writer.
+    bool open(const char *path);
+    void close();
+
+    const SessionFileHeader &header() const;
+    int chunkCount() const;
+    const SessionIndexEntry &indexEntry(int i) const;
+    SessionChunk chunk(int i) const;
+    uint64_t recordCount(int channel) const;
+
+private:
+    const uint8_t *data;
+    size_t size;
+    const SessionFileHeader *file_header;
+    const SessionIndexEntry *index;
+};
+
+// One record while replaying
+struct SessionRecord {
+    int channel;
+    uint64_t timestamp_us;
+    const uint8_t *data; // record of the channel's type, inside the mapped file
+};
+
+// Replays the records of the selected channels merged in time order (records with the same timestamp in order of
+// their channel type)
+class SessionCursor {
+public:
+    // channel_mask: bit n selects channel type n
+    SessionCursor(const SessionLogReader &reader, unsigned int channel_mask);
+
+    bool next(SessionRecord &record);
+
+    // Continues with the first record of every channel at or after timestamp_us
+    void seek(uint64_t timestamp_us);
+
+private:
+    void startChannel(int channel, int from_chunk);
+
+    const SessionLogReader &reader;
+    unsigned int channel_mask;
+    int chunk_index[SESSION_MAX_CHANNELS]; // current chunk of each channel, -1 when done
+    uint32_t record_index[SESSION_MAX_CHANNELS];
+};
+
+#endif
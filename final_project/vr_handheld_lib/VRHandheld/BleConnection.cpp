@@ -0,0 +1,84 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+BLE connection parameters of the controller link.
+*/
+
+#include "BleConnection.h"
+
+uint16_t bleConnectionIntervalUnits(uint32_t interval_us)
+{
+    uint32_t units = (interval_us + BLE_CONN_INTERVAL_UNIT_US/2) / BLE_CONN_INTERVAL_UNIT_US;
+    if (units < BLE_CONN_INTERVAL_MIN)
+    {
+        return BLE_CONN_INTERVAL_MIN;
+    }
+    if (units > BLE_CONN_INTERVAL_MAX)
+    {
+        return BLE_CONN_INTERVAL_MAX;
+    }
+    return units;
+}
+
+bool bleConnectionParametersValid(const BleConnectionParameters &parameters)
+{
+    if (parameters.min_interval < BLE_CONN_INTERVAL_MIN || parameters.max_interval > BLE_CONN_INTERVAL_MAX ||
+        parameters.min_interval > parameters.max_interval || parameters.latency > BLE_CONN_LATENCY_MAX ||
+        parameters.supervision_timeout < BLE_SUPERVISION_TIMEOUT_MIN ||
+        parameters.supervision_timeout > BLE_SUPERVISION_TIMEOUT_MAX)
+    {
+        return false;
+    }
+    uint32_t silent_us = (uint32_t)(1 + parameters.latency) * parameters.max_interval * BLE_CONN_INTERVAL_UNIT_US;
+    return (uint32_t)parameters.supervision_timeout * BLE_SUPERVISION_TIMEOUT_UNIT_US > 2*silent_us;
+}
+
+static void writeU16(uint16_t value, uint8_t *out)
+{
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+int encodeConnectionParameterRequest(const BleConnectionParameters &parameters, uint8_t identifier, uint8_t *out)
+{
+    if (!bleConnectionParametersValid(parameters))
+    {
+        return 0;
+    }
+    out[0] = L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST;
+    out[1] = identifier;
+    writeU16(L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES - 4, out + 2);
+    writeU16(parameters.min_interval, out + 4);
+    writeU16(parameters.max_interval, out + 6);
+    writeU16(parameters.latency, out + 8);
+    writeU16(parameters.supervision_timeout, out + 10);
+    return L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES;
+}
+
+int encodeSetDataLength(uint16_t handle, uint16_t tx_octets, uint8_t *out)
+{
+    if (tx_octets < BLE_DATA_LENGTH_MIN_OCTETS)
+    {
+        tx_octets = BLE_DATA_LENGTH_MIN_OCTETS;
+    }
+    if (tx_octets > BLE_DATA_LENGTH_MAX_OCTETS)
+    {
+        tx_octets = BLE_DATA_LENGTH_MAX_OCTETS;
+    }
+    // Preamble, access address, header, MIC and CRC add 14 bytes to the payload, 8 us per byte on the 1M PHY
+    uint16_t tx_time_us = (tx_octets + 14) * 8;
+    writeU16(handle, out);
+    writeU16(tx_octets, out + 2);
+    writeU16(tx_time_us, out + 4);
+    return HCI_LE_SET_DATA_LENGTH_LENGTH_BYTES;
+}
+
+int encodeSetPhy(uint16_t handle, uint8_t phys, uint8_t *out)
+{
+    writeU16(handle, out);
+    out[2] = 0; // all_phys: both directions have a preference
+    out[3] = phys;
+    out[4] = phys;
+    writeU16(0, out + 5); // phy_options: no preferred coding
+    return HCI_LE_SET_PHY_LENGTH_BYTES;
+}
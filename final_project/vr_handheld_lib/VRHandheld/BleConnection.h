@@ -0,0 +1,73 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+BLE connection parameters of the controller link.
+
+The central (the receiver) picks the connection interval, the peripheral (the controller) can only ask for other
+parameters with an L2CAP connection parameter update request on the LE signaling channel. ArduinoBLE only sends
+that request with the interval set by BLE.setConnectionInterval() when a central connects, so the controller builds
+it here to change the interval during a connection, e.g. a long interval while the controller lies still.
+
+The central can change the interval itself and either side can ask its link layer for longer data packets (data
+length extension) and the 2M PHY with HCI commands, which are encoded here as well for HCI.sendCommand(). All of them
+are proposals, the link layer of the other side may settle on different values.
+
+Intervals are in units of 1.25 ms and the supervision timeout in units of 10 ms, as on the air.
+*/
+
+#ifndef BLE_CONNECTION_H
+#define BLE_CONNECTION_H
+
+#include <stdint.h>
+
+#define BLE_CONN_INTERVAL_UNIT_US 1250
+#define BLE_SUPERVISION_TIMEOUT_UNIT_US 10000
+#define BLE_CONN_INTERVAL_MIN 6      // 7.5 ms
+#define BLE_CONN_INTERVAL_MAX 3200   // 4 s
+#define BLE_CONN_LATENCY_MAX 499
+#define BLE_SUPERVISION_TIMEOUT_MIN 10   // 100 ms
+#define BLE_SUPERVISION_TIMEOUT_MAX 3200 // 32 s
+
+#define BLE_ATT_DEFAULT_MTU 23
+#define BLE_DATA_LENGTH_MIN_OCTETS 27
+#define BLE_DATA_LENGTH_MAX_OCTETS 251
+#define BLE_PHY_1M 0x01 // bits of the PHY masks of LE Set PHY
+#define BLE_PHY_2M 0x02
+#define BLE_PHY_CODED 0x04
+
+#define HCI_LE_SET_DATA_LENGTH 0x2022 // OGF 0x08 (LE controller), OCF 0x0022
+#define HCI_LE_SET_DATA_LENGTH_LENGTH_BYTES 6
+#define HCI_LE_SET_PHY 0x2032
+#define HCI_LE_SET_PHY_LENGTH_BYTES 7
+
+#define L2CAP_LE_SIGNALING_CID 0x0005
+#define L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST 0x12
+#define L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES 12
+
+struct BleConnectionParameters {
+    uint16_t min_interval;        // 1.25 ms units
+    uint16_t max_interval;        // 1.25 ms units
+    uint16_t latency;             // connection events the peripheral may skip
+    uint16_t supervision_timeout; // 10 ms units
+};
+
+// Interval in 1.25 ms units closest to interval_us, clamped to the allowed range
+uint16_t bleConnectionIntervalUnits(uint32_t interval_us);
+
+// true if the parameters are allowed by the Bluetooth spec: ranges, min <= max and a supervision timeout longer
+// than twice the time the peripheral may stay silent
+bool bleConnectionParametersValid(const BleConnectionParameters &parameters);
+
+// Writes the L2CAP signaling command (without the L2CAP header) into out, which must hold
+// L2CAP_CONNECTION_PARAMETER_UPDATE_REQUEST_LENGTH_BYTES, returns its length or 0 if the parameters are invalid
+int encodeConnectionParameterRequest(const BleConnectionParameters &parameters, uint8_t identifier, uint8_t *out);
+
+// Writes the parameters of LE Set Data Length for the connection handle into out, with the largest transmit time
+// tx_octets (clamped to 27..251) take on the 1M PHY, returns HCI_LE_SET_DATA_LENGTH_LENGTH_BYTES
+int encodeSetDataLength(uint16_t handle, uint16_t tx_octets, uint8_t *out);
+
+// Writes the parameters of LE Set PHY for the connection handle into out, asking for the PHYs in the phys mask in
+// both directions, returns HCI_LE_SET_PHY_LENGTH_BYTES
+int encodeSetPhy(uint16_t handle, uint8_t phys, uint8_t *out);
+
+#endif
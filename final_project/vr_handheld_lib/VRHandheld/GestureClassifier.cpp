@@ -0,0 +1,125 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Gesture classification on the receiver.
+*/
+
+#include "GestureClassifier.h"
+#include "GestureModelWeights.h"
+#include <math.h>
+
+static const char *const GESTURE_LABEL_NAMES[GESTURE_CLASSES] = {"up", "right", "down", "left", "circle", "x"};
+
+bool GestureClassifier::available()
+{
+    return GESTURE_MODEL_EXPORTED != 0;
+}
+
+int GestureClassifier::classify(const float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH], GesturePrediction &prediction)
+{
+    prediction.label = -1;
+    prediction.confidence = 0.0f;
+    for (int i = 0; i < GESTURE_CLASSES; i++)
+    {
+        prediction.scores[i] = 0.0f;
+    }
+#if GESTURE_MODEL_EXPORTED
+    conv1dRelu(&features[0][0], GESTURE_CHANNELS, GESTURE_SIGNAL_LENGTH, GESTURE_CONV1_WEIGHT, GESTURE_CONV1_BIAS,
+               GESTURE_CONV1_CHANNELS, GESTURE_CONV1_KERNEL, conv_arena);
+    adaptiveAvgPool1d(conv_arena, GESTURE_CONV1_CHANNELS, GESTURE_CONV1_LENGTH, GESTURE_POOL1_LENGTH, pool_arena);
+    conv1dRelu(pool_arena, GESTURE_CONV1_CHANNELS, GESTURE_POOL1_LENGTH, GESTURE_CONV2_WEIGHT, GESTURE_CONV2_BIAS,
+               GESTURE_CONV2_CHANNELS, GESTURE_CONV2_KERNEL, conv_arena);
+    adaptiveAvgPool1d(conv_arena, GESTURE_CONV2_CHANNELS, GESTURE_CONV2_LENGTH, GESTURE_POOL2_LENGTH, pool_arena);
+
+    int best = 0;
+    for (int i = 0; i < GESTURE_CLASSES; i++)
+    {
+        const float *weight = GESTURE_FC_WEIGHT + i*GESTURE_FC_INPUTS;
+        float score = GESTURE_FC_BIAS[i];
+        for (int j = 0; j < GESTURE_FC_INPUTS; j++)
+        {
+            score += weight[j] * pool_arena[j];
+        }
+        prediction.scores[i] = score;
+        if (score > prediction.scores[best])
+        {
+            best = i;
+        }
+    }
+
+    // Softmax probability of the best score, shifted by it so expf can't overflow
+    float sum = 0.0f;
+    for (int i = 0; i < GESTURE_CLASSES; i++)
+    {
+        sum += expf(prediction.scores[i] - prediction.scores[best]);
+    }
+    prediction.label = best;
+    prediction.confidence = 1.0f / sum;
+#else
+    (void)features;
+#endif
+    return prediction.label;
+}
+
+const char *gestureLabelName(int label)
+{
+    if (label < 0 || label >= GESTURE_CLASSES)
+    {
+        return "none";
+    }
+    return GESTURE_LABEL_NAMES[label];
+}
+
+void conv1dRelu(const float *input, int in_channels, int in_length, const float *weight, const float *bias,
+                int out_channels, int kernel, float *output)
+{
+    int out_length = in_length - kernel + 1;
+    for (int out_channel = 0; out_channel < out_channels; out_channel++)
+    {
+        float *out = output + out_channel*out_length;
+        for (int i = 0; i < out_length; i++)
+        {
+            out[i] = bias[out_channel];
+        }
+        // Accumulate one input channel and kernel tap at a time so the inner loop runs over contiguous memory
+        for (int in_channel = 0; in_channel < in_channels; in_channel++)
+        {
+            const float *in = input + in_channel*in_length;
+            const float *w = weight + (out_channel*in_channels + in_channel)*kernel;
+            for (int k = 0; k < kernel; k++)
+            {
+                float tap = w[k];
+                for (int i = 0; i < out_length; i++)
+                {
+                    out[i] += tap * in[i + k];
+                }
+            }
+        }
+        for (int i = 0; i < out_length; i++)
+        {
+            if (out[i] < 0.0f)
+            {
+                out[i] = 0.0f;
+            }
+        }
+    }
+}
+
+void adaptiveAvgPool1d(const float *input, int channels, int in_length, int out_length, float *output)
+{
+    for (int i = 0; i < out_length; i++)
+    {
+        int start = (i*in_length) / out_length;
+        int end = ((i + 1)*in_length + out_length - 1) / out_length;
+        for (int channel = 0; channel < channels; channel++)
+        {
+            const float *in = input + channel*in_length;
+            float sum = 0.0f;
+            for (int j = start; j < end; j++)
+            {
+                sum += in[j];
+            }
+            output[channel*out_length + i] = sum / (end - start);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Gesture classification on the receiver.
+
+Runs GestureClassificationNet (training/train_gesture_classification.py) on a gesture resampled by GestureSegmenter,
+so the receiver can report the predicted gesture without a PyTorch process on the host:
+    conv1   Conv1d(9,16,3) -> ReLU -> BatchNorm1d(16) -> AdaptiveAvgPool1d(125)
+    conv2   Conv1d(16,32,5) -> ReLU -> BatchNorm1d(32) -> AdaptiveAvgPool1d(12)
+    fc      Flatten -> Linear(384,6) (Dropout is a no-op in eval mode)
+
+The weights are const float arrays in GestureModelWeights.h, generated by training/export_gesture_model.py. A batch
+norm followed by average pooling is an affine map per channel, so the exporter folds it into the weights of the next
+layer and only conv + ReLU, pooling and the final linear layer are left to compute here.
+
+Float kernels are used, the nRF52840 has a single precision FPU and floats keep the scores equal to PyTorch's up to
+rounding. All intermediate values live in the classifier's arena, no heap is used.
+*/
+
+#ifndef GESTURE_CLASSIFIER_H
+#define GESTURE_CLASSIFIER_H
+
+#include "GestureSegmenter.h"
+
+#define GESTURE_CLASSES 6 // zero-based labels: up, right, down, left, circle, x
+#define GESTURE_CONV1_CHANNELS 16
+#define GESTURE_CONV1_KERNEL 3
+#define GESTURE_CONV1_LENGTH (GESTURE_SIGNAL_LENGTH - GESTURE_CONV1_KERNEL + 1)
+#define GESTURE_POOL1_LENGTH 125
+#define GESTURE_CONV2_CHANNELS 32
+#define GESTURE_CONV2_KERNEL 5
+#define GESTURE_CONV2_LENGTH (GESTURE_POOL1_LENGTH - GESTURE_CONV2_KERNEL + 1)
+#define GESTURE_POOL2_LENGTH 12
+#define GESTURE_FC_INPUTS (GESTURE_CONV2_CHANNELS*GESTURE_POOL2_LENGTH)
+
+// Convolution outputs and pooling outputs each get one part of the arena, reused by both layers
+#define GESTURE_CONV_ARENA_FLOATS (GESTURE_CONV2_CHANNELS*GESTURE_CONV2_LENGTH > GESTURE_CONV1_CHANNELS*GESTURE_CONV1_LENGTH ? \
+    GESTURE_CONV2_CHANNELS*GESTURE_CONV2_LENGTH : GESTURE_CONV1_CHANNELS*GESTURE_CONV1_LENGTH)
+#define GESTURE_POOL_ARENA_FLOATS (GESTURE_CONV1_CHANNELS*GESTURE_POOL1_LENGTH > GESTURE_FC_INPUTS ? \
+    GESTURE_CONV1_CHANNELS*GESTURE_POOL1_LENGTH : GESTURE_FC_INPUTS)
+
+struct GesturePrediction {
+    int8_t label;       // zero-based, -1 if no model was exported
+    float confidence;   // softmax probability of label
+    float scores[GESTURE_CLASSES];
+};
+
+class GestureClassifier {
+public:
+    // False while GestureModelWeights.h is the placeholder without weights
+    static bool available();
+
+    // Classifies a resampled gesture, returns the predicted label (-1 if no model was exported)
+    int classify(const float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH], GesturePrediction &prediction);
+
+private:
+    float conv_arena[GESTURE_CONV_ARENA_FLOATS];
+    float pool_arena[GESTURE_POOL_ARENA_FLOATS];
+};
+
+// Name of a zero-based label for printing
+const char *gestureLabelName(int label);
+
+// Conv1d without padding followed by ReLU. input is in_channels x in_length, weight is
+// out_channels x in_channels x kernel, output is out_channels x (in_length - kernel + 1), all row major.
+void conv1dRelu(const float *input, int in_channels, int in_length, const float *weight, const float *bias,
+                int out_channels, int kernel, float *output);
+
+// AdaptiveAvgPool1d, output i averages input[floor(i*in_length/out_length) .. ceil((i+1)*in_length/out_length))
+void adaptiveAvgPool1d(const float *input, int channels, int in_length, int out_length, float *output);
+
+#endif
@@ -0,0 +1,93 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Fixed length gesture features from a stream of IMU samples.
+*/
+
+#include "GestureFeatures.h"
+#include <math.h>
+#include <string.h>
+
+GestureFeatureExtractor::GestureFeatureExtractor()
+{
+    clear();
+}
+
+void GestureFeatureExtractor::clear()
+{
+    stored = 0;
+    stride = 1;
+    pushed = 0;
+}
+
+void GestureFeatureExtractor::push(const float values[GESTURE_CHANNELS])
+{
+    if (pushed % stride == 0)
+    {
+        if (stored == GESTURE_MAX_SAMPLES)
+        {
+            decimate();
+        }
+        // pushed is a multiple of the doubled stride here as well, since GESTURE_MAX_SAMPLES is even
+        memcpy(window[stored++], values, sizeof(window[0]));
+    }
+    pushed++;
+}
+
+void GestureFeatureExtractor::push(const ImuSample &sample)
+{
+    float values[GESTURE_CHANNELS];
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        values[i] = sample.acc[i];
+        values[IMU_AXES + i] = sample.gyr[i];
+        values[2*IMU_AXES + i] = sample.mag[i];
+    }
+    push(values);
+}
+
+void GestureFeatureExtractor::decimate()
+{
+    // Keeps every other stored sample so the whole gesture still fits, at half the rate
+    for (int i = 0; 2*i < stored; i++)
+    {
+        memcpy(window[i], window[2*i], sizeof(window[i]));
+    }
+    stored = (stored + 1) / 2;
+    stride *= 2;
+}
+
+bool GestureFeatureExtractor::extract(float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH]) const
+{
+    if (stored == 0)
+    {
+        return false;
+    }
+    for (int i = 0; i < GESTURE_SIGNAL_LENGTH; i++)
+    {
+        const float *values = window[gestureResampleIndex(i, stored)];
+        for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+        {
+            features[channel][i] = values[channel];
+        }
+    }
+    return true;
+}
+
+int GestureFeatureExtractor::count() const
+{
+    return stored;
+}
+
+uint32_t GestureFeatureExtractor::received() const
+{
+    return pushed;
+}
+
+int gestureResampleIndex(int i, int count)
+{
+    // Same index computation as torch.nn.functional.interpolate(mode='nearest'), including its float32 rounding
+    float scale = (float)count / GESTURE_SIGNAL_LENGTH;
+    int index = (int)floorf(i * scale);
+    return index < count - 1 ? index : count - 1;
+}
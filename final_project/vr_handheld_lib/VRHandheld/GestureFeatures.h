@@ -0,0 +1,51 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Fixed length gesture features from a stream of IMU samples.
+
+GestureFeatureExtractor accumulates the 9 axis values of a gesture as they arrive, in a window allocated with the
+extractor, and resamples them to GESTURE_SIGNAL_LENGTH samples per channel into a buffer owned by the caller. The
+result is the input of GestureClassificationNet, identical to what training/train_gesture_classification.py computes
+with read_and_interpolate_features (torch.nn.functional.interpolate with the default nearest mode), without a CSV
+round trip. It is used by GestureSegmenter on the receiver and by host tools reading recorded gestures.
+*/
+
+#ifndef GESTURE_FEATURES_H
+#define GESTURE_FEATURES_H
+
+#include "ImuPacket.h"
+
+#define GESTURE_CHANNELS (3*IMU_AXES) // acc x,y,z, gyr x,y,z, mag x,y,z
+#define GESTURE_SIGNAL_LENGTH 150
+// Longest gesture kept at full rate (~4.3 s at 119 Hz), longer gestures are decimated by 2 whenever the window fills
+#define GESTURE_MAX_SAMPLES 512
+
+class GestureFeatureExtractor {
+public:
+    GestureFeatureExtractor();
+
+    // Appends the values of the next sample in GESTURE_CHANNELS order
+    void push(const float values[GESTURE_CHANNELS]);
+    void push(const ImuSample &sample);
+
+    // Resamples the samples pushed since clear() into features, returns false if there are none
+    bool extract(float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH]) const;
+
+    void clear();
+
+    int count() const;          // samples in the window
+    uint32_t received() const;  // samples pushed, larger than count() once the window was decimated
+
+private:
+    void decimate();
+
+    float window[GESTURE_MAX_SAMPLES][GESTURE_CHANNELS];
+    int stored;
+    uint32_t stride; // only every stride-th pushed sample is stored once the window has been decimated
+    uint32_t pushed;
+};
+
+// Index of the sample used for resampled position i of a gesture with count samples
+int gestureResampleIndex(int i, int count);
+
+#endif
@@ -0,0 +1,20 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Weights of GestureClassificationNet for GestureClassifier.
+
+Placeholder without weights, GestureClassifier::available() is false and classify() returns -1. Replace it by
+exporting a trained model from the training directory:
+    python export_gesture_model.py models/<model>.pt
+
+The exported weights are static const arrays. Include this header from exactly one .cpp of a program,
+GestureClassifier.cpp, since every other .cpp that includes it gets its own copy of the weights. Host tests that need
+the GESTURE_MODEL_* macros are the only exception.
+*/
+
+#ifndef GESTURE_MODEL_WEIGHTS_H
+#define GESTURE_MODEL_WEIGHTS_H
+
+#define GESTURE_MODEL_EXPORTED 0
+
+#endif
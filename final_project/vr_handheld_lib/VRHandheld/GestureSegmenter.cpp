@@ -0,0 +1,108 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Gesture segmentation on the receiver.
+*/
+
+#include "GestureSegmenter.h"
+#include "SerialFrame.h"
+#include <string.h>
+
+GestureSegmenter::GestureSegmenter() :
+    next_number(0)
+{
+    reset();
+}
+
+void GestureSegmenter::reset()
+{
+    extractor.clear();
+    active = false;
+    last_us = 0;
+    memset(&gesture, 0, sizeof(gesture));
+}
+
+bool GestureSegmenter::update(const ImuSample &sample)
+{
+    if (sample.button_pressed)
+    {
+        if (!active)
+        {
+            active = true;
+            extractor.clear();
+            gesture.start_us = sample.timestamp_us;
+        }
+        last_us = sample.timestamp_us;
+        extractor.push(sample);
+        return false;
+    }
+
+    if (!active)
+    {
+        return false;
+    }
+    active = false;
+    uint32_t received = extractor.received();
+    if (received < GESTURE_MIN_SAMPLES)
+    {
+        return false;
+    }
+    gesture.number = next_number++;
+    gesture.duration_us = last_us - gesture.start_us;
+    gesture.num_samples = received < 0xFFFF ? received : 0xFFFF;
+    return true;
+}
+
+const GestureInfo &GestureSegmenter::info() const
+{
+    return gesture;
+}
+
+void GestureSegmenter::resample(float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH]) const
+{
+    extractor.extract(features);
+}
+
+static void writeU16(uint8_t *buffer, uint16_t value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+}
+
+static void writeU32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+    buffer[2] = (value >> 16) & 0xFF;
+    buffer[3] = (value >> 24) & 0xFF;
+}
+
+int encodeGestureRecord(const GestureInfo &info, uint8_t controller, const float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH], uint8_t *out)
+{
+    memcpy(out, GESTURE_RECORD_MAGIC, 4);
+    writeU16(out + 4, GESTURE_RECORD_PAYLOAD_LENGTH_BYTES);
+
+    uint8_t *payload = out + GESTURE_RECORD_HEADER_LENGTH_BYTES;
+    writeU16(payload, info.number);
+    writeU32(payload + 2, info.start_us);
+    writeU32(payload + 6, info.duration_us);
+    writeU16(payload + 10, info.num_samples);
+    payload[12] = GESTURE_CHANNELS;
+    writeU16(payload + 13, GESTURE_SIGNAL_LENGTH);
+    payload[15] = controller;
+
+    uint8_t *values = payload + GESTURE_RECORD_INFO_LENGTH_BYTES;
+    for (int channel = 0; channel < GESTURE_CHANNELS; channel++)
+    {
+        for (int i = 0; i < GESTURE_SIGNAL_LENGTH; i++)
+        {
+            uint32_t bits;
+            memcpy(&bits, &features[channel][i], sizeof(bits));
+            writeU32(values, bits);
+            values += 4;
+        }
+    }
+
+    writeU16(values, crc16Ccitt(payload, GESTURE_RECORD_PAYLOAD_LENGTH_BYTES));
+    return GESTURE_RECORD_LENGTH_BYTES;
+}
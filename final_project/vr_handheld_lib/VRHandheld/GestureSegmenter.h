@@ -0,0 +1,74 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Gesture segmentation on the receiver.
+
+A gesture is the sequence of samples received while the controller button is held. On release the samples are
+resampled to GESTURE_SIGNAL_LENGTH the same way the host did it before classification
+(torch.nn.functional.interpolate with the default nearest mode) and written out as one length prefixed record, so the
+host gets a ready to classify 9 x GESTURE_SIGNAL_LENGTH tensor per gesture.
+
+Record layout (little endian):
+    0   char[4] "GSTR"
+    4   uint16  payload length
+    6   payload:
+        0   uint16  gesture number, incremented per record
+        2   uint32  timestamp of the first sample in microseconds (controller clock)
+        6   uint32  duration in microseconds
+        10  uint16  number of samples received while the button was held
+        12  uint8   channels (GESTURE_CHANNELS)
+        13  uint16  signal length (GESTURE_SIGNAL_LENGTH)
+        15  uint8   controller id (receiver slot of the controller, as in SerialFrame.h)
+        16  float32 values, channel major: acc x,y,z, gyr x,y,z, mag x,y,z, each GESTURE_SIGNAL_LENGTH long
+    6+payload length    uint16  CRC-16/CCITT-FALSE of the payload
+*/
+
+#ifndef GESTURE_SEGMENTER_H
+#define GESTURE_SEGMENTER_H
+
+#include "GestureFeatures.h"
+
+// Shorter presses are ignored, the host scripts required more than 20 characters of the first field (~4 samples)
+#define GESTURE_MIN_SAMPLES 5
+
+#define GESTURE_RECORD_MAGIC "GSTR"
+#define GESTURE_RECORD_HEADER_LENGTH_BYTES 6
+#define GESTURE_RECORD_INFO_LENGTH_BYTES 16
+#define GESTURE_RECORD_PAYLOAD_LENGTH_BYTES (GESTURE_RECORD_INFO_LENGTH_BYTES + 4*GESTURE_CHANNELS*GESTURE_SIGNAL_LENGTH)
+#define GESTURE_RECORD_LENGTH_BYTES (GESTURE_RECORD_HEADER_LENGTH_BYTES + GESTURE_RECORD_PAYLOAD_LENGTH_BYTES + 2)
+
+struct GestureInfo {
+    uint16_t number;
+    uint32_t start_us;
+    uint32_t duration_us;
+    uint16_t num_samples;
+};
+
+class GestureSegmenter {
+public:
+    GestureSegmenter();
+
+    // Feeds the next received sample, returns true when the button was released after a complete gesture,
+    // which can then be read with info() and resample() until the next call
+    bool update(const ImuSample &sample);
+
+    const GestureInfo &info() const;
+
+    // Resamples the gesture to GESTURE_SIGNAL_LENGTH samples per channel
+    void resample(float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH]) const;
+
+    void reset();
+
+private:
+    GestureFeatureExtractor extractor;
+    bool active;
+    uint32_t last_us;
+    uint16_t next_number;
+    GestureInfo gesture;
+};
+
+// Writes the record of a resampled gesture of the given controller into out (GESTURE_RECORD_LENGTH_BYTES bytes),
+// returns its length
+int encodeGestureRecord(const GestureInfo &info, uint8_t controller, const float features[GESTURE_CHANNELS][GESTURE_SIGNAL_LENGTH], uint8_t *out);
+
+#endif
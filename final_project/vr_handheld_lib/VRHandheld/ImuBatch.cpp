@@ -0,0 +1,105 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Batches of IMU samples sent in a single BLE notification.
+*/
+
+#include "ImuBatch.h"
+
+int imuBatchCapacity(int att_mtu)
+{
+    int payload = att_mtu - ATT_HEADER_LENGTH_BYTES - IMU_BATCH_HEADER_LENGTH_BYTES;
+    if (payload < IMU_BATCH_SAMPLE_LENGTH_BYTES)
+    {
+        return 0;
+    }
+    int capacity = payload / IMU_BATCH_SAMPLE_LENGTH_BYTES;
+    return capacity < IMU_BATCH_MAX_SAMPLES ? capacity : IMU_BATCH_MAX_SAMPLES;
+}
+
+int imuBatchLength(int count)
+{
+    return IMU_BATCH_HEADER_LENGTH_BYTES + count*IMU_BATCH_SAMPLE_LENGTH_BYTES;
+}
+
+int packImuBatch(ImuSampleBuffer &buffer, int max_samples, uint8_t *out)
+{
+    if (max_samples > IMU_BATCH_MAX_SAMPLES)
+    {
+        max_samples = IMU_BATCH_MAX_SAMPLES;
+    }
+    if (buffer.size() == 0 || max_samples < 1)
+    {
+        return 0;
+    }
+
+    // Find how many samples can go into this batch before popping any
+    int n = 1;
+    while (n < max_samples && n < buffer.size())
+    {
+        const ImuSample &previous = buffer.peek(n - 1);
+        const ImuSample &next = buffer.peek(n);
+        if ((uint16_t)(previous.sequence + 1) != next.sequence || next.timestamp_us - previous.timestamp_us > 0xFFFF)
+        {
+            break;
+        }
+        n++;
+    }
+
+    ImuSample sample;
+    uint32_t previous_timestamp = buffer.peek(0).timestamp_us;
+    uint8_t buttons = 0;
+    for (int i = 0; i < n; i++)
+    {
+        buffer.pop(sample);
+        if (i == 0)
+        {
+            out[0] = sample.timestamp_us & 0xFF;
+            out[1] = (sample.timestamp_us >> 8) & 0xFF;
+            out[2] = (sample.timestamp_us >> 16) & 0xFF;
+            out[3] = (sample.timestamp_us >> 24) & 0xFF;
+            out[4] = sample.sequence & 0xFF;
+            out[5] = (sample.sequence >> 8) & 0xFF;
+        }
+        uint8_t *sample_out = out + IMU_BATCH_HEADER_LENGTH_BYTES + i*IMU_BATCH_SAMPLE_LENGTH_BYTES;
+        uint16_t dt = (uint16_t)(sample.timestamp_us - previous_timestamp);
+        sample_out[0] = dt & 0xFF;
+        sample_out[1] = (dt >> 8) & 0xFF;
+        packImuVectors(sample, sample_out + 2);
+        if (sample.button_pressed)
+        {
+            buttons |= 1 << i;
+        }
+        previous_timestamp = sample.timestamp_us;
+    }
+    out[6] = n;
+    out[7] = buttons;
+    return imuBatchLength(n);
+}
+
+int unpackImuBatch(const uint8_t *buffer, int length, ImuSample *samples)
+{
+    if (length < IMU_BATCH_HEADER_LENGTH_BYTES)
+    {
+        return -1;
+    }
+    int n = buffer[6];
+    if (n < 1 || n > IMU_BATCH_MAX_SAMPLES || length != imuBatchLength(n))
+    {
+        return -1;
+    }
+
+    uint32_t timestamp = (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+    uint16_t sequence = (uint16_t)(buffer[4] | (buffer[5] << 8));
+    uint8_t buttons = buffer[7];
+    for (int i = 0; i < n; i++)
+    {
+        const uint8_t *sample_in = buffer + IMU_BATCH_HEADER_LENGTH_BYTES + i*IMU_BATCH_SAMPLE_LENGTH_BYTES;
+        timestamp += (uint32_t)(sample_in[0] | (sample_in[1] << 8));
+        samples[i].timestamp_us = timestamp;
+        samples[i].sequence = sequence + i;
+        unpackImuVectors(sample_in + 2, samples[i]);
+        samples[i].button_pressed = (buttons >> i) & 1;
+    }
+    return n;
+}
@@ -0,0 +1,53 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Batches of IMU samples sent in a single BLE notification.
+
+At the LSM9DS1 output data rates one notification per sample is limited by the number of notifications per connection
+event, while most of each notification's payload goes unused. The controller instead queues samples in an
+ImuSampleBuffer and sends as many as fit into the negotiated ATT MTU at once.
+
+Layout (little endian, imuBatchLength(n) bytes):
+    0   uint32  timestamp of the first sample in microseconds
+    4   uint16  sequence number of the first sample, the others follow consecutively
+    6   uint8   number of samples n (1..IMU_BATCH_MAX_SAMPLES)
+    7   uint8   button pressed bits, bit i belongs to sample i
+    8   n times:
+        uint16  microseconds since the previous sample (0 for the first)
+        float32 acc x,y,z, gyr x,y,z, mag x,y,z (same units as ImuSample)
+*/
+
+#ifndef IMU_BATCH_H
+#define IMU_BATCH_H
+
+#include "ImuPacket.h"
+#include "RingBuffer.h"
+
+#define BLE_UUID_IMU_BATCH "91179b32-6815-4cce-98af-7d0b40f11128"
+
+#define IMU_BATCH_HEADER_LENGTH_BYTES 8
+#define IMU_BATCH_SAMPLE_LENGTH_BYTES (2 + IMU_VECTORS_LENGTH_BYTES)
+#define IMU_BATCH_MAX_SAMPLES 8 // limited by the button bits
+#define IMU_BATCH_MAX_LENGTH_BYTES (IMU_BATCH_HEADER_LENGTH_BYTES + IMU_BATCH_MAX_SAMPLES*IMU_BATCH_SAMPLE_LENGTH_BYTES)
+#define ATT_HEADER_LENGTH_BYTES 3 // opcode + attribute handle of a notification
+
+#define IMU_SAMPLE_BUFFER_SIZE 32
+
+// Samples waiting to be sent
+typedef RingBuffer<ImuSample, IMU_SAMPLE_BUFFER_SIZE> ImuSampleBuffer;
+
+// Number of samples fitting in one notification for the given ATT MTU (0 if not even one fits)
+int imuBatchCapacity(int att_mtu);
+
+// Length in bytes of a batch with count samples
+int imuBatchLength(int count);
+
+// Pops up to max_samples consecutive samples from buffer into out (which must hold imuBatchLength(max_samples) bytes).
+// The batch ends early at a sequence gap or when the time delta doesn't fit in 16 bits.
+// Returns the number of bytes written, 0 if buffer is empty.
+int packImuBatch(ImuSampleBuffer &buffer, int max_samples, uint8_t *out);
+
+// Unpacks a batch into samples (which must hold IMU_BATCH_MAX_SAMPLES), returns the sample count or -1 if malformed
+int unpackImuBatch(const uint8_t *buffer, int length, ImuSample *samples);
+
+#endif
@@ -0,0 +1,245 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Compact encoding of IMU sample batches for the BLE link.
+*/
+
+#include "ImuCodec.h"
+#include <math.h>
+
+#define VARINT32_MAX_LENGTH_BYTES 5
+#define SAMPLE_MAX_LENGTH_BYTES (VARINT32_MAX_LENGTH_BYTES + IMU_CODEC_VALUES*3) // deltas of int16 need up to 3 bytes
+
+static const float scales[IMU_CODEC_VALUES] = {
+    IMU_CODEC_ACC_SCALE, IMU_CODEC_ACC_SCALE, IMU_CODEC_ACC_SCALE,
+    IMU_CODEC_GYR_SCALE, IMU_CODEC_GYR_SCALE, IMU_CODEC_GYR_SCALE,
+    IMU_CODEC_MAG_SCALE, IMU_CODEC_MAG_SCALE, IMU_CODEC_MAG_SCALE
+};
+
+static int writeVarint(uint8_t *buffer, uint32_t value)
+{
+    int length = 0;
+    while (value >= 0x80)
+    {
+        buffer[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    buffer[length++] = value;
+    return length;
+}
+
+// Returns the number of bytes read, 0 if the varint runs past end
+static int readVarint(const uint8_t *buffer, const uint8_t *end, uint32_t &value)
+{
+    value = 0;
+    for (int i = 0; i < VARINT32_MAX_LENGTH_BYTES && buffer + i < end; i++)
+    {
+        value |= (uint32_t)(buffer[i] & 0x7F) << (7*i);
+        if (!(buffer[i] & 0x80))
+        {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t zigzag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// i-th value in the order acc x,y,z, gyr x,y,z, mag x,y,z
+static float &sampleValue(ImuSample &sample, int i)
+{
+    return i < IMU_AXES ? sample.acc[i] : i < 2*IMU_AXES ? sample.gyr[i - IMU_AXES] : sample.mag[i - 2*IMU_AXES];
+}
+
+static float sampleValue(const ImuSample &sample, int i)
+{
+    return i < IMU_AXES ? sample.acc[i] : i < 2*IMU_AXES ? sample.gyr[i - IMU_AXES] : sample.mag[i - 2*IMU_AXES];
+}
+
+void quantizeImuSample(const ImuSample &sample, int16_t raw[IMU_CODEC_VALUES])
+{
+    for (int i = 0; i < IMU_CODEC_VALUES; i++)
+    {
+        float value = roundf(sampleValue(sample, i) / scales[i]);
+        if (value > 32767.0f)
+        {
+            value = 32767.0f;
+        }
+        else if (value < -32768.0f)
+        {
+            value = -32768.0f;
+        }
+        raw[i] = (int16_t)value;
+    }
+}
+
+void dequantizeImuSample(const int16_t raw[IMU_CODEC_VALUES], ImuSample &sample)
+{
+    for (int i = 0; i < IMU_CODEC_VALUES; i++)
+    {
+        sampleValue(sample, i) = raw[i] * scales[i];
+    }
+}
+
+int imuCompactBatchCapacity(int max_length, bool delta)
+{
+    int sample_length = delta ? SAMPLE_MAX_LENGTH_BYTES : VARINT32_MAX_LENGTH_BYTES + 2*IMU_CODEC_VALUES;
+    int capacity = (max_length - IMU_CODEC_HEADER_LENGTH_BYTES) / sample_length;
+    if (capacity < 0)
+    {
+        return 0;
+    }
+    return capacity < IMU_CODEC_MAX_SAMPLES ? capacity : IMU_CODEC_MAX_SAMPLES;
+}
+
+int encodeImuBatch(ImuSampleBuffer &buffer, int max_length, bool delta, uint8_t *out)
+{
+    if (buffer.size() == 0)
+    {
+        return 0;
+    }
+
+    const ImuSample &first = buffer.peek(0);
+    out[0] = first.timestamp_us & 0xFF;
+    out[1] = (first.timestamp_us >> 8) & 0xFF;
+    out[2] = (first.timestamp_us >> 16) & 0xFF;
+    out[3] = (first.timestamp_us >> 24) & 0xFF;
+    out[4] = first.sequence & 0xFF;
+    out[5] = (first.sequence >> 8) & 0xFF;
+    out[7] = delta ? IMU_CODEC_FLAG_DELTA : 0;
+
+    int length = IMU_CODEC_HEADER_LENGTH_BYTES;
+    int n = 0;
+    uint16_t buttons = 0;
+    int16_t previous_raw[IMU_CODEC_VALUES];
+    uint32_t previous_timestamp = first.timestamp_us;
+    uint8_t encoded[SAMPLE_MAX_LENGTH_BYTES];
+    while (n < IMU_CODEC_MAX_SAMPLES && buffer.size() > 0)
+    {
+        const ImuSample &sample = buffer.peek(0);
+        if (n > 0 && sample.sequence != (uint16_t)(first.sequence + n))
+        {
+            break;
+        }
+
+        // Encode into a scratch buffer first so a sample that doesn't fit stays in the buffer
+        int16_t raw[IMU_CODEC_VALUES];
+        quantizeImuSample(sample, raw);
+        int encoded_length = writeVarint(encoded, sample.timestamp_us - previous_timestamp);
+        for (int i = 0; i < IMU_CODEC_VALUES; i++)
+        {
+            if (delta && n > 0)
+            {
+                encoded_length += writeVarint(encoded + encoded_length, zigzag((int32_t)raw[i] - previous_raw[i]));
+            }
+            else
+            {
+                encoded[encoded_length++] = (uint16_t)raw[i] & 0xFF;
+                encoded[encoded_length++] = ((uint16_t)raw[i] >> 8) & 0xFF;
+            }
+        }
+        if (length + encoded_length > max_length)
+        {
+            break;
+        }
+
+        for (int i = 0; i < encoded_length; i++)
+        {
+            out[length + i] = encoded[i];
+        }
+        length += encoded_length;
+        for (int i = 0; i < IMU_CODEC_VALUES; i++)
+        {
+            previous_raw[i] = raw[i];
+        }
+        if (sample.button_pressed)
+        {
+            buttons |= 1 << n;
+        }
+        previous_timestamp = sample.timestamp_us;
+        n++;
+
+        ImuSample popped;
+        buffer.pop(popped);
+    }
+
+    if (n == 0)
+    {
+        return 0;
+    }
+    out[6] = n;
+    out[8] = buttons & 0xFF;
+    out[9] = (buttons >> 8) & 0xFF;
+    return length;
+}
+
+int decodeImuBatch(const uint8_t *buffer, int length, ImuSample *samples)
+{
+    if (length < IMU_CODEC_HEADER_LENGTH_BYTES)
+    {
+        return -1;
+    }
+    int n = buffer[6];
+    if (n < 1 || n > IMU_CODEC_MAX_SAMPLES)
+    {
+        return -1;
+    }
+
+    uint32_t timestamp = (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+    uint16_t sequence = (uint16_t)(buffer[4] | (buffer[5] << 8));
+    bool delta = buffer[7] & IMU_CODEC_FLAG_DELTA;
+    uint16_t buttons = (uint16_t)(buffer[8] | (buffer[9] << 8));
+
+    const uint8_t *in = buffer + IMU_CODEC_HEADER_LENGTH_BYTES;
+    const uint8_t *end = buffer + length;
+    int16_t raw[IMU_CODEC_VALUES];
+    for (int n_decoded = 0; n_decoded < n; n_decoded++)
+    {
+        uint32_t value;
+        int read = readVarint(in, end, value);
+        if (read == 0)
+        {
+            return -1;
+        }
+        in += read;
+        timestamp += value;
+
+        for (int i = 0; i < IMU_CODEC_VALUES; i++)
+        {
+            if (delta && n_decoded > 0)
+            {
+                read = readVarint(in, end, value);
+                if (read == 0)
+                {
+                    return -1;
+                }
+                in += read;
+                raw[i] = (int16_t)(raw[i] + unzigzag(value));
+            }
+            else
+            {
+                if (end - in < 2)
+                {
+                    return -1;
+                }
+                raw[i] = (int16_t)(in[0] | (in[1] << 8));
+                in += 2;
+            }
+        }
+
+        ImuSample &sample = samples[n_decoded];
+        sample.timestamp_us = timestamp;
+        sample.sequence = sequence + n_decoded;
+        dequantizeImuSample(raw, sample);
+        sample.button_pressed = (buttons >> n_decoded) & 1;
+    }
+    return in == end ? n : -1;
+}
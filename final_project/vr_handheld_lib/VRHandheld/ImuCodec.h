@@ -0,0 +1,56 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Compact encoding of IMU sample batches for the BLE link.
+
+The LSM9DS1 delivers 16 bit samples which Arduino_LSM9DS1 scales to floats with a fixed full scale (4 g, 2000 dps,
+400 uT), so sending the values as int16 with the same scale loses nothing but halves the bytes per value. With delta
+encoding every sample after the first stores the zigzag varint difference to the previous sample, which for a
+slowly moving controller is 1 byte per value instead of 2.
+
+Layout (little endian):
+    0   uint32  timestamp of the first sample in microseconds
+    4   uint16  sequence number of the first sample, the others follow consecutively
+    6   uint8   number of samples n (1..IMU_CODEC_MAX_SAMPLES)
+    7   uint8   flags, IMU_CODEC_FLAG_DELTA if samples after the first are delta encoded
+    8   uint16  button pressed bits, bit i belongs to sample i
+    10  n times:
+        varint  microseconds since the previous sample (0 for the first)
+        acc x,y,z, gyr x,y,z, mag x,y,z, either int16 or (delta encoded samples) zigzag varint of the difference
+*/
+
+#ifndef IMU_CODEC_H
+#define IMU_CODEC_H
+
+#include "ImuPacket.h"
+#include "ImuBatch.h"
+
+#define BLE_UUID_IMU_COMPACT_BATCH "c0f68464-a21e-464f-b62d-46ab3043d8dc"
+
+// Full scale / 32768 as used by Arduino_LSM9DS1 to convert raw readings
+#define IMU_CODEC_ACC_SCALE (4.0f/32768.0f)    // g per LSB
+#define IMU_CODEC_GYR_SCALE (2000.0f/32768.0f) // deg/s per LSB
+#define IMU_CODEC_MAG_SCALE (400.0f/32768.0f)  // muT per LSB
+
+#define IMU_CODEC_VALUES (3*IMU_AXES)
+#define IMU_CODEC_HEADER_LENGTH_BYTES 10
+#define IMU_CODEC_MAX_SAMPLES 16 // limited by the button bits
+#define IMU_CODEC_MAX_LENGTH_BYTES 244 // notification payload at the largest ATT MTU (247) of the Nano 33 BLE
+#define IMU_CODEC_FLAG_DELTA 0x01
+
+// Converts acc, gyr and mag of sample to raw sensor units, saturating at the int16 range
+void quantizeImuSample(const ImuSample &sample, int16_t raw[IMU_CODEC_VALUES]);
+void dequantizeImuSample(const int16_t raw[IMU_CODEC_VALUES], ImuSample &sample);
+
+// Largest number of samples guaranteed to fit into a batch of max_length bytes (assumes worst case varints)
+int imuCompactBatchCapacity(int max_length, bool delta);
+
+// Pops consecutive samples from buffer and encodes them into out until the next one would not fit into
+// max_length bytes, there is a sequence gap or IMU_CODEC_MAX_SAMPLES is reached.
+// Returns the number of bytes written, 0 if buffer is empty or max_length is too small for one sample.
+int encodeImuBatch(ImuSampleBuffer &buffer, int max_length, bool delta, uint8_t *out);
+
+// Decodes a batch into samples (which must hold IMU_CODEC_MAX_SAMPLES), returns the sample count or -1 if malformed
+int decodeImuBatch(const uint8_t *buffer, int length, ImuSample *samples);
+
+#endif
@@ -0,0 +1,83 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project 
+
+Packed IMU sample shared by vr_handheld_controller and vr_handheld_controller_receiver.
+*/
+
+#include "ImuPacket.h"
+#include <string.h>
+
+static void writeU32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+    buffer[2] = (value >> 16) & 0xFF;
+    buffer[3] = (value >> 24) & 0xFF;
+}
+
+static uint32_t readU32(const uint8_t *buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+static void writeFloats(uint8_t *buffer, const float *values, int n)
+{
+    // Floats are sent in their native little endian IEEE 754 representation (same on the nRF52 and the host)
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t bits;
+        memcpy(&bits, &values[i], sizeof(bits));
+        writeU32(buffer + 4*i, bits);
+    }
+}
+
+static void readFloats(const uint8_t *buffer, float *values, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t bits = readU32(buffer + 4*i);
+        memcpy(&values[i], &bits, sizeof(bits));
+    }
+}
+
+void packImuVectors(const ImuSample &sample, uint8_t *buffer)
+{
+    writeFloats(buffer, sample.acc, IMU_AXES);
+    writeFloats(buffer + 12, sample.gyr, IMU_AXES);
+    writeFloats(buffer + 24, sample.mag, IMU_AXES);
+}
+
+void unpackImuVectors(const uint8_t *buffer, ImuSample &sample)
+{
+    readFloats(buffer, sample.acc, IMU_AXES);
+    readFloats(buffer + 12, sample.gyr, IMU_AXES);
+    readFloats(buffer + 24, sample.mag, IMU_AXES);
+}
+
+void packImuSample(const ImuSample &sample, uint8_t *buffer)
+{
+    writeU32(buffer, sample.timestamp_us);
+    buffer[4] = sample.sequence & 0xFF;
+    buffer[5] = (sample.sequence >> 8) & 0xFF;
+    packImuVectors(sample, buffer + 6);
+    buffer[42] = sample.button_pressed ? 1 : 0;
+}
+
+bool unpackImuSample(const uint8_t *buffer, int length, ImuSample &sample)
+{
+    if (length != IMU_SAMPLE_PACKET_LENGTH_BYTES)
+    {
+        return false;
+    }
+    sample.timestamp_us = readU32(buffer);
+    sample.sequence = (uint16_t)(buffer[4] | (buffer[5] << 8));
+    unpackImuVectors(buffer + 6, sample);
+    sample.button_pressed = buffer[42] != 0;
+    return true;
+}
+
+uint16_t imuSequenceGap(uint16_t last_sequence, uint16_t sequence)
+{
+    // Unsigned arithmetic handles the wrap around
+    return (uint16_t)(sequence - last_sequence - 1);
+}
@@ -0,0 +1,55 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project 
+
+Packed IMU sample shared by vr_handheld_controller and vr_handheld_controller_receiver.
+
+One notification of the packed sample characteristic carries a whole sample (timestamp, sequence number,
+accelerometer, gyroscope, magnetometer and button state) instead of one notification per sensor, so the
+receiver always sees values from the same instant and can detect dropped samples from the sequence number.
+
+Layout (little endian, IMU_SAMPLE_PACKET_LENGTH_BYTES bytes):
+    0   uint32  timestamp in microseconds (micros() on the controller)
+    4   uint16  sequence number, incremented per sample, wraps around
+    6   float32 acc x,y,z in g
+    18  float32 gyr x,y,z in deg/s
+    30  float32 mag x,y,z in muT
+    42  uint8   button pressed (0 or 1)
+
+The packet is larger than the 20 byte payload of the default 23 byte ATT MTU, so it needs a negotiated MTU of
+at least IMU_SAMPLE_PACKET_LENGTH_BYTES + 3.
+*/
+
+#ifndef IMU_PACKET_H
+#define IMU_PACKET_H
+
+#include <stdint.h>
+
+#define BLE_UUID_IMU_SAMPLE "c51744e8-c75a-4a04-97e3-adf5ee5bd0bd"
+
+#define IMU_AXES 3
+#define IMU_VECTORS_LENGTH_BYTES 36
+#define IMU_SAMPLE_PACKET_LENGTH_BYTES 43
+
+struct ImuSample {
+    uint32_t timestamp_us;
+    uint16_t sequence;
+    float acc[IMU_AXES]; // x,y,z g = 9.80665 m/s^2
+    float gyr[IMU_AXES]; // x,y,z deg/s
+    float mag[IMU_AXES]; // x,y,z muT (micro-Teslas)
+    bool button_pressed;
+};
+
+// Writes/reads acc, gyr and mag of sample (IMU_VECTORS_LENGTH_BYTES bytes), shared with the batch format
+void packImuVectors(const ImuSample &sample, uint8_t *buffer);
+void unpackImuVectors(const uint8_t *buffer, ImuSample &sample);
+
+// Writes sample into buffer, which must hold IMU_SAMPLE_PACKET_LENGTH_BYTES bytes
+void packImuSample(const ImuSample &sample, uint8_t *buffer);
+
+// Reads a sample from buffer, returns false if length doesn't match the packet length
+bool unpackImuSample(const uint8_t *buffer, int length, ImuSample &sample);
+
+// Number of samples lost between the last received sequence number and the one just received (0 if none)
+uint16_t imuSequenceGap(uint16_t last_sequence, uint16_t sequence);
+
+#endif
@@ -0,0 +1,89 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Histogram of latencies in microseconds with power of two buckets.
+*/
+
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram()
+{
+    clear();
+}
+
+void LatencyHistogram::add(uint32_t latency_us)
+{
+    int bucket = 0;
+    while (bucket < LATENCY_HISTOGRAM_BUCKETS - 1 && (latency_us >> (bucket + 1)) != 0)
+    {
+        bucket++;
+    }
+    buckets[bucket]++;
+    total++;
+    sum += latency_us;
+    if (latency_us > max)
+    {
+        max = latency_us;
+    }
+}
+
+void LatencyHistogram::clear()
+{
+    for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        buckets[i] = 0;
+    }
+    total = 0;
+    max = 0;
+    sum = 0;
+}
+
+uint32_t LatencyHistogram::count() const
+{
+    return total;
+}
+
+uint32_t LatencyHistogram::bucketCount(int bucket) const
+{
+    return buckets[bucket];
+}
+
+uint32_t LatencyHistogram::bucketLowerUs(int bucket) const
+{
+    return bucket == 0 ? 0 : (uint32_t)1 << bucket;
+}
+
+uint32_t LatencyHistogram::maxUs() const
+{
+    return max;
+}
+
+float LatencyHistogram::meanUs() const
+{
+    return total > 0 ? (float)sum / total : 0.0f;
+}
+
+uint32_t LatencyHistogram::percentileUs(float percentile) const
+{
+    if (total == 0)
+    {
+        return 0;
+    }
+    // Number of samples at or below the percentile, at least one
+    uint32_t rank = (uint32_t)(percentile / 100.0f * total + 0.5f);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+    uint32_t seen = 0;
+    for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS - 1; i++)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+        {
+            uint32_t upper = ((uint32_t)1 << (i + 1)) - 1;
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
@@ -0,0 +1,37 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Histogram of latencies in microseconds with power of two buckets: bucket 0 holds [0,2) us, bucket i > 0 holds
+[2^i, 2^(i+1)) us and the last bucket everything from 2^(LATENCY_HISTOGRAM_BUCKETS-1) us on.
+Percentiles are reported as the upper bound of the bucket they fall into, so they are accurate to a factor of 2.
+*/
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+
+#define LATENCY_HISTOGRAM_BUCKETS 21 // last bucket starts at ~1 s
+
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void add(uint32_t latency_us);
+    void clear();
+
+    uint32_t count() const;
+    uint32_t bucketCount(int bucket) const;
+    uint32_t bucketLowerUs(int bucket) const;
+    uint32_t maxUs() const;
+    float meanUs() const;
+    uint32_t percentileUs(float percentile) const; // percentile in [0,100]
+
+private:
+    uint32_t buckets[LATENCY_HISTOGRAM_BUCKETS];
+    uint32_t total;
+    uint32_t max;
+    uint64_t sum;
+};
+
+#endif
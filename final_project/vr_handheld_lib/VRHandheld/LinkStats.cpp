@@ -0,0 +1,209 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+One-way latency, jitter and loss of the samples a controller streams to the receiver.
+*/
+
+#include "LinkStats.h"
+#include <math.h>
+
+// Jitter estimate gain of RFC 3550
+#define JITTER_GAIN (1.0f/16.0f)
+
+ClockOffsetEstimator::ClockOffsetEstimator()
+{
+    clear();
+}
+
+void ClockOffsetEstimator::clear()
+{
+    started = false;
+    base_delay = 0;
+    block_count = 0;
+    next_block = 0;
+    fit_sender_us = 0;
+    fit_delay = 0.0f;
+    fit_slope = 0.0f;
+}
+
+int32_t ClockOffsetEstimator::delay(uint32_t sender_us, uint32_t receiver_us) const
+{
+    return (int32_t)(receiver_us - sender_us - base_delay);
+}
+
+void ClockOffsetEstimator::add(uint32_t sender_us, uint32_t receiver_us)
+{
+    if (!started)
+    {
+        started = true;
+        base_delay = receiver_us - sender_us;
+        current.sender_us = sender_us;
+        current.delay = 0;
+        current_start_us = sender_us;
+        fit();
+        return;
+    }
+    if (sender_us - current_start_us >= CLOCK_OFFSET_BLOCK_US)
+    {
+        blocks[next_block] = current;
+        next_block = (next_block + 1) % CLOCK_OFFSET_BLOCKS;
+        if (block_count < CLOCK_OFFSET_BLOCKS)
+        {
+            block_count++;
+        }
+        current.sender_us = sender_us;
+        current.delay = delay(sender_us, receiver_us);
+        current_start_us = sender_us;
+        fit();
+        return;
+    }
+    int32_t sample_delay = delay(sender_us, receiver_us);
+    if (sample_delay < current.delay)
+    {
+        current.sender_us = sender_us;
+        current.delay = sample_delay;
+        if (block_count == 0)
+        {
+            fit();
+        }
+    }
+}
+
+void ClockOffsetEstimator::fit()
+{
+    // Least squares line through the block minima, sender times relative to the newest one
+    if (block_count == 0)
+    {
+        fit_sender_us = current.sender_us;
+        fit_delay = current.delay;
+        fit_slope = 0.0f;
+        return;
+    }
+    int newest = (next_block + CLOCK_OFFSET_BLOCKS - 1) % CLOCK_OFFSET_BLOCKS;
+    fit_sender_us = blocks[newest].sender_us;
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+    for (int i = 0; i < block_count; i++)
+    {
+        double x = (int32_t)(blocks[i].sender_us - fit_sender_us);
+        double y = blocks[i].delay;
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x*x;
+        sum_xy += x*y;
+    }
+    double n = block_count;
+    double denominator = n*sum_xx - sum_x*sum_x;
+    double slope = block_count > 1 && denominator > 0.0 ? (n*sum_xy - sum_x*sum_y) / denominator : 0.0;
+    if (slope > CLOCK_OFFSET_MAX_DRIFT_PPM*1e-6)
+    {
+        slope = CLOCK_OFFSET_MAX_DRIFT_PPM*1e-6;
+    }
+    if (slope < -CLOCK_OFFSET_MAX_DRIFT_PPM*1e-6)
+    {
+        slope = -CLOCK_OFFSET_MAX_DRIFT_PPM*1e-6;
+    }
+    // Lowest line with that slope through a block minimum, so the fastest samples are at 0 rather than half of them
+    // below the line
+    double lowest = 0.0;
+    for (int i = 0; i < block_count; i++)
+    {
+        double intercept = blocks[i].delay - slope * (int32_t)(blocks[i].sender_us - fit_sender_us);
+        if (i == 0 || intercept < lowest)
+        {
+            lowest = intercept;
+        }
+    }
+    fit_slope = slope;
+    fit_delay = lowest;
+}
+
+bool ClockOffsetEstimator::settled() const
+{
+    return block_count > 0;
+}
+
+uint32_t ClockOffsetEstimator::latencyUs(uint32_t sender_us, uint32_t receiver_us) const
+{
+    float expected = fit_delay + fit_slope * (float)(int32_t)(sender_us - fit_sender_us);
+    float latency = delay(sender_us, receiver_us) - expected;
+    return latency > 0.0f ? (uint32_t)(latency + 0.5f) : 0;
+}
+
+float ClockOffsetEstimator::driftPpm() const
+{
+    return fit_slope * 1e6f;
+}
+
+LinkStats::LinkStats()
+{
+    clear();
+}
+
+void LinkStats::clear()
+{
+    clock.clear();
+    latencies.clear();
+    have_last = false;
+    jitter_us = 0.0f;
+    received_count = 0;
+    dropped_count = 0;
+}
+
+void LinkStats::add(const ImuSample &sample, uint32_t arrival_us)
+{
+    clock.add(sample.timestamp_us, arrival_us);
+    if (clock.settled())
+    {
+        latencies.add(clock.latencyUs(sample.timestamp_us, arrival_us));
+    }
+    if (have_last)
+    {
+        dropped_count += imuSequenceGap(last_sequence, sample.sequence);
+        if (arrival_us != last_arrival_us)
+        {
+            // Difference of the transit times of the first samples of consecutive notifications, the clock offset
+            // cancels out. Samples batched into the same notification only differ by their sample period.
+            float difference = (float)(int32_t)((arrival_us - last_arrival_us) - (sample.timestamp_us - first_sender_us));
+            jitter_us += (fabsf(difference) - jitter_us) * JITTER_GAIN;
+        }
+    }
+    if (!have_last || arrival_us != last_arrival_us)
+    {
+        first_sender_us = sample.timestamp_us;
+    }
+    have_last = true;
+    last_sequence = sample.sequence;
+    last_arrival_us = arrival_us;
+    received_count++;
+}
+
+const LatencyHistogram &LinkStats::latency() const
+{
+    return latencies;
+}
+
+float LinkStats::jitterUs() const
+{
+    return jitter_us;
+}
+
+uint32_t LinkStats::received() const
+{
+    return received_count;
+}
+
+uint32_t LinkStats::dropped() const
+{
+    return dropped_count;
+}
+
+float LinkStats::dropRate() const
+{
+    uint32_t total = received_count + dropped_count;
+    return total > 0 ? (float)dropped_count / total : 0.0f;
+}
+
+float LinkStats::driftPpm() const
+{
+    return clock.driftPpm();
+}
@@ -0,0 +1,99 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+One-way latency, jitter and loss of the samples a controller streams to the receiver.
+
+Every sample carries the controller's micros() at which it was taken and a sequence number. The receiver's clock is
+not synchronised with the controller's, so ClockOffsetEstimator follows the smallest delay (receiver time minus
+sender time) seen in blocks of CLOCK_OFFSET_BLOCK_US. The slope of a least squares line through the minima of the last
+CLOCK_OFFSET_BLOCKS blocks is the drift between the two crystals, the line is then lowered onto the fastest block.
+Latencies are reported above that line: the staleness a sample gains from batching, waiting for a connection event,
+retransmissions and the receiver. The fixed part common to all samples (radio and stack, ~1 ms) can't be
+seen from the timestamps alone.
+
+LinkStats feeds the estimator and keeps a histogram of those latencies, the interarrival jitter of the notifications
+(RFC 3550, with the timestamp of their first sample) and the samples lost according to the sequence numbers. Samples
+of one notification share its arrival time.
+
+Times are in microseconds, wrap around is handled with unsigned differences.
+*/
+
+#ifndef LINK_STATS_H
+#define LINK_STATS_H
+
+#include "ImuPacket.h"
+#include "LatencyHistogram.h"
+
+#define CLOCK_OFFSET_BLOCK_US 2000000
+#define CLOCK_OFFSET_BLOCKS 16
+#define CLOCK_OFFSET_MAX_DRIFT_PPM 100 // fitted drifts beyond this come from noisy minima, not crystals
+
+class ClockOffsetEstimator {
+public:
+    ClockOffsetEstimator();
+
+    // Adds the sender and receiver time of one sample
+    void add(uint32_t sender_us, uint32_t receiver_us);
+
+    void clear();
+
+    // true once a whole block has been seen, before that latencies are relative to the fastest sample so far
+    bool settled() const;
+
+    // Delay of a sample above the fitted minimum delay at its sender time, 0 if it was faster
+    uint32_t latencyUs(uint32_t sender_us, uint32_t receiver_us) const;
+
+    // Drift of the receiver clock against the sender clock in parts per million, 0 until two blocks were seen
+    float driftPpm() const;
+
+private:
+    int32_t delay(uint32_t sender_us, uint32_t receiver_us) const;
+    void fit();
+
+    struct Block {
+        uint32_t sender_us; // sender time of the fastest sample
+        int32_t delay;      // its delay relative to base_delay
+    };
+
+    bool started;
+    uint32_t base_delay; // receiver minus sender time of the first sample, delays are kept relative to it
+    Block blocks[CLOCK_OFFSET_BLOCKS];
+    int block_count;
+    int next_block;
+    Block current;
+    uint32_t current_start_us;
+    // Fitted minimum delay: fit_delay + fit_slope * (sender_us - fit_sender_us)
+    uint32_t fit_sender_us;
+    float fit_delay;
+    float fit_slope;
+};
+
+class LinkStats {
+public:
+    LinkStats();
+
+    // Adds a sample received at arrival_us (receiver clock)
+    void add(const ImuSample &sample, uint32_t arrival_us);
+
+    void clear();
+
+    const LatencyHistogram &latency() const; // latencies above the fastest samples, once the clock offset settled
+    float jitterUs() const;
+    uint32_t received() const;
+    uint32_t dropped() const;
+    float dropRate() const; // dropped / (received + dropped)
+    float driftPpm() const;
+
+private:
+    ClockOffsetEstimator clock;
+    LatencyHistogram latencies;
+    bool have_last;
+    uint16_t last_sequence;
+    uint32_t first_sender_us; // of the notification last_arrival_us belongs to
+    uint32_t last_arrival_us;
+    float jitter_us;
+    uint32_t received_count;
+    uint32_t dropped_count;
+};
+
+#endif
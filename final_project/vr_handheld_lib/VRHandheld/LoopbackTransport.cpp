@@ -0,0 +1,138 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+In-process stand-in for the BLE link between a SampleStreamer and a SampleSink.
+*/
+
+#include "LoopbackTransport.h"
+#include <string.h>
+
+LoopbackTransport::LoopbackTransport(const LoopbackLinkConfig &config) :
+    config(config),
+    sent_count(0),
+    lost_count(0),
+    refused_count(0),
+    delivered_count(0),
+    delivered_bytes(0)
+{
+    reset();
+}
+
+void LoopbackTransport::reset()
+{
+    packets.clear();
+    random_state = config.seed != 0 ? config.seed : 1; // xorshift never leaves 0
+    started = false;
+    last_event_packets = 0;
+}
+
+uint32_t LoopbackTransport::nextRandom()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+bool LoopbackTransport::send(int encoding, const uint8_t *data, int length, uint32_t now_us)
+{
+    if (packets.full() || length > SAMPLE_PACKET_MAX_LENGTH_BYTES)
+    {
+        refused_count++;
+        return false;
+    }
+    if (!started)
+    {
+        // Connection events are counted from the first notification
+        last_event_us = now_us;
+        last_arrival_us = now_us;
+        started = true;
+    }
+
+    // First connection event at or after now that still has room, never before the last notification's event
+    uint32_t event_us = now_us;
+    uint32_t interval_us = config.conn_interval_us;
+    if (interval_us > 0)
+    {
+        event_us = last_event_us;
+        if ((int32_t)(now_us - event_us) > 0)
+        {
+            event_us += (now_us - event_us + interval_us - 1) / interval_us * interval_us;
+        }
+        if (event_us == last_event_us && config.packets_per_event > 0 && last_event_packets >= config.packets_per_event)
+        {
+            event_us += interval_us;
+        }
+    }
+    if (event_us != last_event_us)
+    {
+        last_event_packets = 0;
+    }
+    last_event_us = event_us;
+    last_event_packets++;
+    sent_count++;
+
+    // 24 random bits compared with the loss probability
+    if ((nextRandom() >> 8) < (uint32_t)(config.loss * 16777216.0f))
+    {
+        lost_count++;
+        return true;
+    }
+    Packet packet;
+    packet.encoding = encoding;
+    packet.length = length;
+    packet.arrival_us = event_us + config.latency_us + (config.jitter_us > 0 ? nextRandom() % config.jitter_us : 0);
+    if ((int32_t)(packet.arrival_us - last_arrival_us) < 0)
+    {
+        packet.arrival_us = last_arrival_us;
+    }
+    last_arrival_us = packet.arrival_us;
+    memcpy(packet.data, data, length);
+    packets.push(packet);
+    return true;
+}
+
+int LoopbackTransport::deliver(uint32_t now_us, SampleSink &sink)
+{
+    int count = 0;
+    Packet packet;
+    while (packets.size() > 0 && (int32_t)(now_us - packets.peek(0).arrival_us) >= 0)
+    {
+        packets.pop(packet);
+        sink.receive(packet.encoding, packet.data, packet.length, packet.arrival_us);
+        delivered_count++;
+        delivered_bytes += packet.length;
+        count++;
+    }
+    return count;
+}
+
+int LoopbackTransport::inFlight() const
+{
+    return packets.size();
+}
+
+unsigned long LoopbackTransport::sent() const
+{
+    return sent_count;
+}
+
+unsigned long LoopbackTransport::lost() const
+{
+    return lost_count;
+}
+
+unsigned long LoopbackTransport::refused() const
+{
+    return refused_count;
+}
+
+unsigned long LoopbackTransport::delivered() const
+{
+    return delivered_count;
+}
+
+unsigned long LoopbackTransport::deliveredBytes() const
+{
+    return delivered_bytes;
+}
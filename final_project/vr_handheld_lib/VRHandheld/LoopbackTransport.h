@@ -0,0 +1,77 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+In-process stand-in for the BLE link between a SampleStreamer and a SampleSink (see SampleStream.h), so batching,
+buffering and loss handling can be tested and benchmarked on the host without radios.
+
+Notifications leave at the next connection event, at most packets_per_event per event like the link layer of the
+Nano 33 BLE, the others wait for later events. Each one arrives latency_us plus a uniform random [0, jitter_us)
+after its event, never before the one sent ahead of it since BLE delivers in order, and is lost with probability
+loss. Notifications sent but not delivered yet fill the transmit queue; when it is full send() refuses new ones like
+a full ArduinoBLE buffer. deliver() hands everything that arrived by now to the sink.
+
+The link has no clock of its own, times are whatever the caller passes in (microseconds, wrap around is handled).
+The random numbers come from a fixed seed so a run can be repeated.
+*/
+
+#ifndef LOOPBACK_TRANSPORT_H
+#define LOOPBACK_TRANSPORT_H
+
+#include "SampleStream.h"
+#include "RingBuffer.h"
+
+#define LOOPBACK_QUEUE_SIZE 32
+
+struct LoopbackLinkConfig {
+    uint32_t conn_interval_us; // 0: notifications leave right away
+    int packets_per_event;     // 0: no limit
+    uint32_t latency_us;
+    uint32_t jitter_us;
+    float loss;                // probability of losing a notification, 0..1
+    uint32_t seed;
+};
+
+class LoopbackTransport : public SampleTransport {
+public:
+    LoopbackTransport(const LoopbackLinkConfig &config);
+
+    bool send(int encoding, const uint8_t *data, int length, uint32_t now_us);
+
+    // Hands the notifications that arrived by now_us to sink in order, returns how many
+    int deliver(uint32_t now_us, SampleSink &sink);
+
+    // Drops notifications in flight and restarts the connection events and random numbers
+    void reset();
+
+    int inFlight() const;
+    unsigned long sent() const;      // accepted by send(), including lost ones
+    unsigned long lost() const;
+    unsigned long refused() const;   // queue was full
+    unsigned long delivered() const;
+    unsigned long deliveredBytes() const;
+
+private:
+    struct Packet {
+        int encoding;
+        int length;
+        uint32_t arrival_us;
+        uint8_t data[SAMPLE_PACKET_MAX_LENGTH_BYTES];
+    };
+
+    uint32_t nextRandom();
+
+    LoopbackLinkConfig config;
+    RingBuffer<Packet, LOOPBACK_QUEUE_SIZE> packets;
+    uint32_t random_state;
+    bool started;
+    uint32_t last_event_us;  // connection event of the last notification sent
+    int last_event_packets;  // notifications sent in that event
+    uint32_t last_arrival_us;
+    unsigned long sent_count;
+    unsigned long lost_count;
+    unsigned long refused_count;
+    unsigned long delivered_count;
+    unsigned long delivered_bytes;
+};
+
+#endif
@@ -0,0 +1,169 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Output data rate and hardware FIFO of the LSM9DS1 accelerometer/gyroscope on the controller.
+*/
+
+#include "Lsm9ds1Fifo.h"
+
+#define ODR_SHIFT 5
+#define ODR_MAX_BITS 6
+// Timestamps follow the measured drain times with this gain, so clock drift is tracked while the spacing stays even
+#define TIMESTAMP_GAIN_SHIFT 4
+// A drain further than this many periods from the expected time restarts the timestamps (e.g. after an overrun)
+#define TIMESTAMP_MAX_ERROR_PERIODS 4
+
+static const float ODR_HZ[ODR_MAX_BITS + 1] = {0.0f, 14.9f, 59.5f, 119.0f, 238.0f, 476.0f, 952.0f};
+
+uint8_t lsm9ds1OdrBits(float rate_hz)
+{
+    for (uint8_t bits = 1; bits < ODR_MAX_BITS; bits++)
+    {
+        if (ODR_HZ[bits] >= rate_hz)
+        {
+            return bits;
+        }
+    }
+    return ODR_MAX_BITS;
+}
+
+float lsm9ds1OdrHz(uint8_t odr_bits)
+{
+    return odr_bits <= ODR_MAX_BITS ? ODR_HZ[odr_bits] : 0.0f;
+}
+
+Lsm9ds1Fifo::Lsm9ds1Fifo(Lsm9ds1ReadRegisters read, Lsm9ds1WriteRegister write) :
+    read(read),
+    write(write),
+    odr_bits(0),
+    period_us(0),
+    last_timestamp_us(0),
+    timestamp_valid(false),
+    overrun_count(0)
+{
+}
+
+bool Lsm9ds1Fifo::begin(float rate_hz, int watermark)
+{
+    if (watermark < 1)
+    {
+        watermark = 1;
+    }
+    if (watermark > LSM9DS1_FIFO_SIZE - 1)
+    {
+        watermark = LSM9DS1_FIFO_SIZE - 1;
+    }
+    odr_bits = lsm9ds1OdrBits(rate_hz);
+    period_us = (uint32_t)(1000000.0f / lsm9ds1OdrHz(odr_bits) + 0.5f);
+    timestamp_valid = false;
+
+    // With the gyroscope on the accelerometer runs at the gyroscope rate, both are set for clarity. The FIFO is
+    // switched through bypass mode so samples from before the new rate are discarded.
+    return write(LSM9DS1_CTRL_REG1_G, (odr_bits << ODR_SHIFT) | LSM9DS1_FS_G_2000DPS) &&
+           write(LSM9DS1_CTRL_REG6_XL, (odr_bits << ODR_SHIFT) | LSM9DS1_FS_XL_4G) &&
+           write(LSM9DS1_CTRL_REG8, LSM9DS1_IF_ADD_INC) &&
+           write(LSM9DS1_FIFO_CTRL, LSM9DS1_FMODE_BYPASS) &&
+           write(LSM9DS1_CTRL_REG9, LSM9DS1_FIFO_EN) &&
+           write(LSM9DS1_FIFO_CTRL, LSM9DS1_FMODE_CONTINUOUS | watermark) &&
+           write(LSM9DS1_INT1_CTRL, LSM9DS1_INT1_FTH);
+}
+
+bool Lsm9ds1Fifo::end()
+{
+    return write(LSM9DS1_INT1_CTRL, 0) &&
+           write(LSM9DS1_FIFO_CTRL, LSM9DS1_FMODE_BYPASS) &&
+           write(LSM9DS1_CTRL_REG9, 0);
+}
+
+float Lsm9ds1Fifo::sampleRateHz() const
+{
+    return lsm9ds1OdrHz(odr_bits);
+}
+
+uint32_t Lsm9ds1Fifo::samplePeriodUs() const
+{
+    return period_us;
+}
+
+bool Lsm9ds1Fifo::watermarkReached()
+{
+    uint8_t source;
+    return read(LSM9DS1_FIFO_SRC, &source, 1) && (source & LSM9DS1_FIFO_SRC_FTH);
+}
+
+static void readVector(const uint8_t *data, float scale, float *out)
+{
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        out[i] = (int16_t)(data[2*i] | (data[2*i + 1] << 8)) * scale;
+    }
+}
+
+int Lsm9ds1Fifo::drain(ImuSample *samples, int max_samples, uint32_t now_us)
+{
+    uint8_t source;
+    if (!read(LSM9DS1_FIFO_SRC, &source, 1))
+    {
+        return -1;
+    }
+    if (source & LSM9DS1_FIFO_SRC_OVRN)
+    {
+        overrun_count++;
+        timestamp_valid = false;
+    }
+    int count = source & LSM9DS1_FIFO_SRC_FSS;
+    if (count > max_samples)
+    {
+        count = max_samples;
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Each FIFO slot holds one gyroscope and one accelerometer reading, the slot advances once both were read
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t data[2*IMU_AXES];
+        if (!read(LSM9DS1_OUT_X_L_G, data, sizeof(data)))
+        {
+            return -1;
+        }
+        readVector(data, LSM9DS1_GYR_SCALE, samples[i].gyr);
+        if (!read(LSM9DS1_OUT_X_L_XL, data, sizeof(data)))
+        {
+            return -1;
+        }
+        readVector(data, LSM9DS1_ACC_SCALE, samples[i].acc);
+    }
+
+    // The newest sample was taken on average half a period before the drain
+    uint32_t measured = now_us - period_us/2;
+    uint32_t newest = measured;
+    if (timestamp_valid)
+    {
+        uint32_t expected = last_timestamp_us + count*period_us;
+        int32_t error = (int32_t)(measured - expected);
+        if (error < (int32_t)(TIMESTAMP_MAX_ERROR_PERIODS*period_us) && error > -(int32_t)(TIMESTAMP_MAX_ERROR_PERIODS*period_us))
+        {
+            newest = expected + (error >> TIMESTAMP_GAIN_SHIFT);
+        }
+        // A sample can't be newer than the drain that read it
+        if ((int32_t)(now_us - newest) < 0)
+        {
+            newest = now_us;
+        }
+    }
+    for (int i = 0; i < count; i++)
+    {
+        samples[i].timestamp_us = newest - (count - 1 - i)*period_us;
+    }
+    last_timestamp_us = newest;
+    timestamp_valid = true;
+    return count;
+}
+
+unsigned long Lsm9ds1Fifo::overruns() const
+{
+    return overrun_count;
+}
@@ -0,0 +1,96 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Output data rate and hardware FIFO of the LSM9DS1 accelerometer/gyroscope on the controller.
+
+Arduino_LSM9DS1 fixes acc and gyr at 119 Hz and is read one sample at a time. Lsm9ds1Fifo reconfigures the
+accelerometer/gyroscope part of the chip (after IMU.begin(), with the same full scales: acc +/-4 g, gyr +/-2000 dps)
+for a higher output data rate and stores the samples in the 32 slot FIFO in continuous mode. The FIFO threshold
+(watermark) is routed to the INT1_A/G pin, so the MCU can sleep until a burst of samples is ready, drain it in one go
+and timestamp every sample at the output data rate.
+
+The magnetometer is a separate device on the same bus without a FIFO and is still read through Arduino_LSM9DS1.
+
+Register access goes through the two functions given to the constructor (Wire1 on the Nano 33 BLE), so this code
+only depends on the C standard library and can be tested on the host against a fake register map.
+*/
+
+#ifndef LSM9DS1_FIFO_H
+#define LSM9DS1_FIFO_H
+
+#include "ImuPacket.h"
+
+#define LSM9DS1_AG_ADDRESS 0x6B
+
+#define LSM9DS1_INT1_CTRL 0x0C
+#define LSM9DS1_CTRL_REG1_G 0x10
+#define LSM9DS1_OUT_X_L_G 0x18
+#define LSM9DS1_CTRL_REG6_XL 0x20
+#define LSM9DS1_CTRL_REG8 0x22
+#define LSM9DS1_CTRL_REG9 0x23
+#define LSM9DS1_OUT_X_L_XL 0x28
+#define LSM9DS1_FIFO_CTRL 0x2E
+#define LSM9DS1_FIFO_SRC 0x2F
+
+#define LSM9DS1_INT1_FTH 0x08           // INT1_CTRL: FIFO threshold on INT1_A/G
+#define LSM9DS1_FS_G_2000DPS 0x18       // CTRL_REG1_G
+#define LSM9DS1_FS_XL_4G 0x10           // CTRL_REG6_XL
+#define LSM9DS1_IF_ADD_INC 0x04         // CTRL_REG8: register address incremented during burst reads
+#define LSM9DS1_FIFO_EN 0x02            // CTRL_REG9
+#define LSM9DS1_FMODE_BYPASS 0x00       // FIFO_CTRL, bits 7..5
+#define LSM9DS1_FMODE_CONTINUOUS 0xC0
+#define LSM9DS1_FIFO_SRC_FTH 0x80       // FIFO_SRC: at least watermark samples unread
+#define LSM9DS1_FIFO_SRC_OVRN 0x40      // FIFO_SRC: the FIFO was full and the oldest sample overwritten
+#define LSM9DS1_FIFO_SRC_FSS 0x3F       // FIFO_SRC: number of unread samples
+
+#define LSM9DS1_FIFO_SIZE 32
+#define LSM9DS1_ACC_SCALE (4.0f/32768.0f)    // g per LSB, as Arduino_LSM9DS1
+#define LSM9DS1_GYR_SCALE (2000.0f/32768.0f) // deg/s per LSB, as Arduino_LSM9DS1
+
+// Register access on the accelerometer/gyroscope address, both return false if the bus transfer failed
+typedef bool (*Lsm9ds1ReadRegisters)(uint8_t reg, uint8_t *data, int length);
+typedef bool (*Lsm9ds1WriteRegister)(uint8_t reg, uint8_t value);
+
+// ODR field of CTRL_REG1_G for the lowest supported rate of at least rate_hz (14.9, 59.5, 119, 238, 476, 952 Hz)
+uint8_t lsm9ds1OdrBits(float rate_hz);
+
+// Rate in Hz of an ODR field value, 0 for power down
+float lsm9ds1OdrHz(uint8_t odr_bits);
+
+class Lsm9ds1Fifo {
+public:
+    Lsm9ds1Fifo(Lsm9ds1ReadRegisters read, Lsm9ds1WriteRegister write);
+
+    // Sets acc and gyr to the lowest supported rate of at least rate_hz and enables the FIFO in continuous mode with
+    // the given watermark (1..LSM9DS1_FIFO_SIZE - 1) signalled on INT1_A/G, returns false if the bus failed
+    bool begin(float rate_hz, int watermark);
+
+    // Disables the FIFO and its interrupt, the data registers then hold the latest sample again
+    bool end();
+
+    float sampleRateHz() const;
+    uint32_t samplePeriodUs() const;
+
+    // Reads FIFO_SRC, returns true if at least watermark samples are waiting (the level of INT1_A/G)
+    bool watermarkReached();
+
+    // Reads all unread samples, oldest first, into samples (at most max_samples). acc and gyr are filled in and the
+    // timestamps are spaced by the sample period, the newest one close to now_us (the time of the drain) and
+    // following it slowly across drains. Other fields are left for the caller. Returns the number of samples read,
+    // -1 if the bus failed.
+    int drain(ImuSample *samples, int max_samples, uint32_t now_us);
+
+    // Samples lost because the FIFO was full before it was drained (counted once per overrun, across begin() calls)
+    unsigned long overruns() const;
+
+private:
+    Lsm9ds1ReadRegisters read;
+    Lsm9ds1WriteRegister write;
+    uint8_t odr_bits;
+    uint32_t period_us;
+    uint32_t last_timestamp_us;
+    bool timestamp_valid;
+    unsigned long overrun_count;
+};
+
+#endif
@@ -0,0 +1,104 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Detects when the controller is put down, so it can save power until it is moved again.
+*/
+
+#include "MotionGate.h"
+#include <math.h>
+
+MotionGate::MotionGate(float still_variance, float wake_deviation, uint32_t still_us, uint32_t window_us) :
+    still_variance(still_variance),
+    wake_deviation(wake_deviation),
+    still_us(still_us),
+    window_us(window_us),
+    is_idle(false),
+    window_started(false),
+    window_start_us(0),
+    still_since_us(0),
+    window_count(0),
+    last_variance(0.0f)
+{
+}
+
+void MotionGate::startWindow(const float acc[IMU_AXES], uint32_t now_us)
+{
+    window_started = true;
+    window_start_us = now_us;
+    window_count = 0;
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        window_shift[i] = acc[i];
+        window_sum[i] = 0.0f;
+        window_sum_squares[i] = 0.0f;
+    }
+}
+
+bool MotionGate::update(const float acc[IMU_AXES], uint32_t now_us)
+{
+    if (is_idle)
+    {
+        for (int i = 0; i < IMU_AXES; i++)
+        {
+            if (fabsf(acc[i] - rest[i]) > wake_deviation)
+            {
+                return wake(now_us);
+            }
+        }
+        return false;
+    }
+
+    if (!window_started)
+    {
+        still_since_us = now_us;
+        startWindow(acc, now_us);
+    }
+    else if (now_us - window_start_us >= window_us && window_count > 1)
+    {
+        float variance = 0.0f;
+        for (int i = 0; i < IMU_AXES; i++)
+        {
+            float mean = window_sum[i] / window_count;
+            variance += window_sum_squares[i] / window_count - mean*mean;
+            rest[i] = window_shift[i] + mean;
+        }
+        last_variance = variance;
+        if (variance >= still_variance)
+        {
+            still_since_us = now_us;
+        }
+        startWindow(acc, now_us);
+        if (now_us - still_since_us >= still_us)
+        {
+            is_idle = true;
+            return true;
+        }
+    }
+    for (int i = 0; i < IMU_AXES; i++)
+    {
+        float value = acc[i] - window_shift[i];
+        window_sum[i] += value;
+        window_sum_squares[i] += value*value;
+    }
+    window_count++;
+    return false;
+}
+
+bool MotionGate::wake(uint32_t now_us)
+{
+    bool was_idle = is_idle;
+    is_idle = false;
+    window_started = false;
+    still_since_us = now_us;
+    return was_idle;
+}
+
+bool MotionGate::idle() const
+{
+    return is_idle;
+}
+
+float MotionGate::lastVariance() const
+{
+    return last_variance;
+}
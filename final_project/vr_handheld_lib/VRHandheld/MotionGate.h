@@ -0,0 +1,54 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Detects when the controller is put down, so it can save power until it is moved again.
+
+MotionGate splits the accelerometer samples into windows of window_us and sums the variances of the three axes in
+each window. Once every window for still_us stayed below still_variance the gate goes idle and keeps the mean
+acceleration of the last window as the rest reference. While idle a single sample that deviates from the reference
+by more than wake_deviation on any axis wakes it again, so it reacts to motion even at a low output data rate.
+Other wake sources, like the button, call wake().
+
+Times are in microseconds as returned by micros(), wrap around is handled with unsigned differences.
+*/
+
+#ifndef MOTION_GATE_H
+#define MOTION_GATE_H
+
+#include "ImuPacket.h"
+
+class MotionGate {
+public:
+    // still_variance in g^2 (sum over the axes), wake_deviation in g
+    MotionGate(float still_variance, float wake_deviation, uint32_t still_us, uint32_t window_us);
+
+    // Feeds an accelerometer sample in g, returns true if the gate went idle or woke up
+    bool update(const float acc[IMU_AXES], uint32_t now_us);
+
+    // Leaves idle and restarts the still time from now_us, returns true if the gate was idle
+    bool wake(uint32_t now_us);
+
+    bool idle() const;
+    float lastVariance() const; // of the last complete window
+
+private:
+    void startWindow(const float acc[IMU_AXES], uint32_t now_us);
+
+    float still_variance;
+    float wake_deviation;
+    uint32_t still_us;
+    uint32_t window_us;
+
+    bool is_idle;
+    bool window_started;
+    uint32_t window_start_us;
+    uint32_t still_since_us;
+    int window_count;
+    float window_shift[IMU_AXES]; // first sample of the window, sums are kept relative to it for precision
+    float window_sum[IMU_AXES];
+    float window_sum_squares[IMU_AXES];
+    float last_variance;
+    float rest[IMU_AXES];
+};
+
+#endif
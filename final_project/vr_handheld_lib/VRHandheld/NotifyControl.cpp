@@ -0,0 +1,72 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Helpers deciding when the controller sends a notification.
+*/
+
+#include "NotifyControl.h"
+
+ButtonDebouncer::ButtonDebouncer(uint32_t debounce_us) :
+    debounce_us(debounce_us),
+    state(false),
+    raw_state(false),
+    raw_change_us(0),
+    last_edge_us(0),
+    edges(0)
+{
+}
+
+bool ButtonDebouncer::update(bool raw_pressed, uint32_t now_us)
+{
+    if (raw_pressed != raw_state)
+    {
+        raw_state = raw_pressed;
+        raw_change_us = now_us;
+    }
+    if (raw_state != state && now_us - raw_change_us >= debounce_us)
+    {
+        state = raw_state;
+        last_edge_us = raw_change_us;
+        edges++;
+        return true;
+    }
+    return false;
+}
+
+bool ButtonDebouncer::pressed() const
+{
+    return state;
+}
+
+uint32_t ButtonDebouncer::lastEdgeUs() const
+{
+    return last_edge_us;
+}
+
+uint16_t ButtonDebouncer::edgeCount() const
+{
+    return edges;
+}
+
+NotifyRateLimiter::NotifyRateLimiter(float max_rate_hz) :
+    min_interval_us(max_rate_hz > 0 ? (uint32_t)(1000000.0f / max_rate_hz) : 0),
+    last_us(0),
+    sent(false)
+{
+}
+
+bool NotifyRateLimiter::allow(uint32_t now_us)
+{
+    if (sent && now_us - last_us < min_interval_us)
+    {
+        return false;
+    }
+    last_us = now_us;
+    sent = true;
+    return true;
+}
+
+void NotifyRateLimiter::reset()
+{
+    sent = false;
+}
@@ -0,0 +1,55 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Helpers deciding when the controller sends a notification, so airtime goes to IMU data instead of repeated values.
+
+ButtonDebouncer turns the raw button pin reading into debounced press/release edges with the time of the edge.
+NotifyRateLimiter enforces a maximum notification rate for one stream.
+
+All times are in microseconds as returned by micros(), differences are computed with unsigned arithmetic so the
+wrap around every ~71 minutes is handled.
+*/
+
+#ifndef NOTIFY_CONTROL_H
+#define NOTIFY_CONTROL_H
+
+#include <stdint.h>
+
+class ButtonDebouncer {
+public:
+    // The raw reading must be stable for debounce_us before it is accepted as the new state
+    ButtonDebouncer(uint32_t debounce_us);
+
+    // Feeds a raw reading, returns true if the debounced state changed (an edge)
+    bool update(bool raw_pressed, uint32_t now_us);
+
+    bool pressed() const;
+    uint32_t lastEdgeUs() const; // time the raw reading first showed the current debounced state
+    uint16_t edgeCount() const;
+
+private:
+    uint32_t debounce_us;
+    bool state;
+    bool raw_state;
+    uint32_t raw_change_us;
+    uint32_t last_edge_us;
+    uint16_t edges;
+};
+
+class NotifyRateLimiter {
+public:
+    // max_rate_hz of 0 disables the limit
+    NotifyRateLimiter(float max_rate_hz);
+
+    // Returns true and records the notification if one may be sent now
+    bool allow(uint32_t now_us);
+
+    void reset();
+
+private:
+    uint32_t min_interval_us;
+    uint32_t last_us;
+    bool sent;
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Fixed size FIFO used for samples waiting to be sent or printed, push fails (the element is dropped) when full.
+No locking, producer and consumer must run in the same context (e.g. ArduinoBLE event handlers run from BLE.poll()).
+*/
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+template <typename T, int N>
+class RingBuffer {
+public:
+    RingBuffer() : head(0), count(0) {}
+
+    bool push(const T &element)
+    {
+        if (count == N)
+        {
+            return false;
+        }
+        elements[(head + count) % N] = element;
+        count++;
+        return true;
+    }
+
+    bool pop(T &element)
+    {
+        if (count == 0)
+        {
+            return false;
+        }
+        element = elements[head];
+        head = (head + 1) % N;
+        count--;
+        return true;
+    }
+
+    // i-th oldest element, i < size()
+    const T &peek(int i) const { return elements[(head + i) % N]; }
+    int size() const { return count; }
+    bool full() const { return count == N; }
+    void clear() { head = 0; count = 0; }
+
+private:
+    T elements[N];
+    int head; // index of oldest element
+    int count;
+};
+
+#endif
@@ -0,0 +1,172 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+IMU sample streaming protocol between the controller and the receiver, independent of the radio.
+*/
+
+#include "SampleStream.h"
+#include "BleConnection.h"
+
+int decodeSamplePacket(int encoding, const uint8_t *data, int length, ImuSample *samples)
+{
+    switch (encoding)
+    {
+    case SAMPLE_ENCODING_PACKED:
+        return unpackImuSample(data, length, samples[0]) ? 1 : -1;
+    case SAMPLE_ENCODING_BATCH:
+        return unpackImuBatch(data, length, samples);
+    case SAMPLE_ENCODING_COMPACT_BATCH:
+        return decodeImuBatch(data, length, samples);
+    default:
+        return -1;
+    }
+}
+
+SampleStreamer::SampleStreamer(SampleTransport &transport, int encoding, bool delta, uint32_t max_delay_us) :
+    transport(transport),
+    sample_encoding(encoding),
+    delta(delta),
+    max_delay_us(max_delay_us),
+    next_sequence(0),
+    sent_count(0),
+    refused_count(0),
+    overflow_count(0)
+{
+    setMtu(BLE_ATT_DEFAULT_MTU);
+}
+
+void SampleStreamer::setMtu(int mtu)
+{
+    att_mtu = mtu;
+    compact_length = mtu - ATT_HEADER_LENGTH_BYTES;
+    if (compact_length > IMU_CODEC_MAX_LENGTH_BYTES)
+    {
+        compact_length = IMU_CODEC_MAX_LENGTH_BYTES;
+    }
+    if (sample_encoding == SAMPLE_ENCODING_BATCH)
+    {
+        batch_capacity = imuBatchCapacity(mtu);
+    }
+    else if (sample_encoding == SAMPLE_ENCODING_COMPACT_BATCH && !delta)
+    {
+        batch_capacity = imuCompactBatchCapacity(compact_length, false);
+    }
+    else if (sample_encoding == SAMPLE_ENCODING_COMPACT_BATCH)
+    {
+        // Typical delta encoded samples are much smaller than the worst case, fill the batch as far as it goes
+        batch_capacity = IMU_CODEC_MAX_SAMPLES;
+    }
+    else
+    {
+        batch_capacity = 1;
+    }
+    if (batch_capacity < 1)
+    {
+        batch_capacity = 1;
+    }
+}
+
+void SampleStreamer::setMaxDelay(uint32_t delay_us)
+{
+    max_delay_us = delay_us;
+}
+
+void SampleStreamer::reset()
+{
+    samples.clear();
+    next_sequence = 0;
+}
+
+bool SampleStreamer::push(const ImuSample &sample)
+{
+    ImuSample numbered = sample;
+    numbered.sequence = next_sequence++;
+    if (!samples.push(numbered))
+    {
+        overflow_count++;
+        return false;
+    }
+    return true;
+}
+
+bool SampleStreamer::due(uint32_t now_us, bool urgent) const
+{
+    if (samples.size() == 0)
+    {
+        return false;
+    }
+    return sample_encoding == SAMPLE_ENCODING_PACKED || urgent || samples.size() >= batch_capacity ||
+           now_us - samples.peek(0).timestamp_us >= max_delay_us;
+}
+
+int SampleStreamer::send(uint32_t now_us)
+{
+    int queued_before = samples.size();
+    int length = 0;
+    if (sample_encoding == SAMPLE_ENCODING_PACKED)
+    {
+        ImuSample sample;
+        if (samples.pop(sample))
+        {
+            packImuSample(sample, packet);
+            length = IMU_SAMPLE_PACKET_LENGTH_BYTES;
+        }
+    }
+    else if (sample_encoding == SAMPLE_ENCODING_BATCH)
+    {
+        length = packImuBatch(samples, batch_capacity, packet);
+    }
+    else
+    {
+        // Delta encoded samples have variable length, samples that don't fit stay queued for the next batch
+        length = encodeImuBatch(samples, compact_length, delta, packet);
+    }
+    if (length == 0)
+    {
+        return 0;
+    }
+    if (transport.send(sample_encoding, packet, length, now_us))
+    {
+        sent_count++;
+    }
+    else
+    {
+        refused_count++;
+    }
+    return queued_before - samples.size();
+}
+
+int SampleStreamer::encoding() const
+{
+    return sample_encoding;
+}
+
+int SampleStreamer::mtu() const
+{
+    return att_mtu;
+}
+
+int SampleStreamer::capacity() const
+{
+    return batch_capacity;
+}
+
+int SampleStreamer::queued() const
+{
+    return samples.size();
+}
+
+unsigned long SampleStreamer::sent() const
+{
+    return sent_count;
+}
+
+unsigned long SampleStreamer::refused() const
+{
+    return refused_count;
+}
+
+unsigned long SampleStreamer::overflowed() const
+{
+    return overflow_count;
+}
@@ -0,0 +1,99 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+IMU sample streaming protocol between the controller and the receiver, independent of the radio.
+
+SampleStreamer is the controller side: it numbers the samples, queues them, decides when a notification is due and
+encodes it in one of the sample encodings (one packed sample, a float batch or a compact batch). The notification
+then goes to a SampleTransport, which is the BLE characteristic of that encoding on the controller and
+LoopbackTransport (see LoopbackTransport.h) on the host. The receiver side hands every notification it gets to
+decodeSamplePacket(), the same on both.
+
+All times are in microseconds, wrap around is handled with unsigned differences.
+*/
+
+#ifndef SAMPLE_STREAM_H
+#define SAMPLE_STREAM_H
+
+#include "ImuPacket.h"
+#include "ImuBatch.h"
+#include "ImuCodec.h"
+
+// Encodings of a notification, each one is sent on its own characteristic
+#define SAMPLE_ENCODING_PACKED 0        // one sample (ImuPacket.h)
+#define SAMPLE_ENCODING_BATCH 1         // float batch (ImuBatch.h)
+#define SAMPLE_ENCODING_COMPACT_BATCH 2 // int16 or delta encoded batch (ImuCodec.h)
+
+#define SAMPLE_PACKET_MAX_LENGTH_BYTES IMU_BATCH_MAX_LENGTH_BYTES // float batches are the longest notifications
+#define SAMPLE_PACKET_MAX_SAMPLES IMU_CODEC_MAX_SAMPLES
+
+// Sends notifications from the controller to the receiver
+class SampleTransport {
+public:
+    virtual ~SampleTransport() {}
+
+    // Queues one notification of the given encoding, returns false if it was refused (its samples are lost)
+    virtual bool send(int encoding, const uint8_t *data, int length, uint32_t now_us) = 0;
+};
+
+// Receives notifications on the receiver side
+class SampleSink {
+public:
+    virtual ~SampleSink() {}
+
+    virtual void receive(int encoding, const uint8_t *data, int length, uint32_t arrival_us) = 0;
+};
+
+// Decodes a notification into samples (which must hold SAMPLE_PACKET_MAX_SAMPLES), returns the sample count or -1 if
+// malformed
+int decodeSamplePacket(int encoding, const uint8_t *data, int length, ImuSample *samples);
+
+class SampleStreamer {
+public:
+    // delta selects delta encoding of compact batches, max_delay_us bounds how long a batch waits to fill
+    SampleStreamer(SampleTransport &transport, int encoding, bool delta, uint32_t max_delay_us);
+
+    // Sizes batches for the ATT MTU of the connection, called when it starts and whenever the MTU changes
+    void setMtu(int att_mtu);
+    void setMaxDelay(uint32_t max_delay_us);
+
+    // Starts a new stream, queued samples are discarded and sequence numbers start at 0 again
+    void reset();
+
+    // Gives the sample the next sequence number and queues it. A full queue drops the sample, which the receiver
+    // sees as a gap in the sequence numbers. Returns false if it was dropped.
+    bool push(const ImuSample &sample);
+
+    // true if a notification should be sent now: a batch is full, its oldest sample is max_delay_us old or urgent is
+    // set (e.g. for a button edge). Packed samples are due as soon as one is queued.
+    bool due(uint32_t now_us, bool urgent) const;
+
+    // Encodes one notification from the queue and sends it, returns the number of samples it carried (0 if the
+    // queue was empty). Samples of a notification the transport refused are lost.
+    int send(uint32_t now_us);
+
+    int encoding() const;
+    int mtu() const;
+    int capacity() const; // samples per batch
+    int queued() const;
+    unsigned long sent() const;    // notifications accepted by the transport
+    unsigned long refused() const; // notifications refused by the transport
+    unsigned long overflowed() const; // samples dropped because the queue was full
+
+private:
+    SampleTransport &transport;
+    int sample_encoding;
+    bool delta;
+    uint32_t max_delay_us;
+    int att_mtu;
+    int batch_capacity;
+    int compact_length;
+    uint16_t next_sequence;
+    ImuSampleBuffer samples;
+    uint8_t packet[SAMPLE_PACKET_MAX_LENGTH_BYTES];
+    unsigned long sent_count;
+    unsigned long refused_count;
+    unsigned long overflow_count;
+};
+
+#endif
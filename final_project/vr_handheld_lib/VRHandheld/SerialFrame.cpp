@@ -0,0 +1,192 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Binary frames written by vr_handheld_controller_receiver to serial.
+*/
+
+#include "SerialFrame.h"
+#include "ImuCodec.h"
+#include <string.h>
+
+#define PAYLOAD_CRC_OFFSET (SERIAL_FRAME_PAYLOAD_LENGTH_BYTES - 2)
+
+uint16_t crc16Ccitt(const uint8_t *data, int length)
+{
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < length; i++)
+    {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+int cobsEncode(const uint8_t *data, int length, uint8_t *out)
+{
+    int code_index = 0;
+    int out_index = 1;
+    uint8_t code = 1;
+    for (int i = 0; i < length; i++)
+    {
+        if (data[i] == 0)
+        {
+            out[code_index] = code;
+            code_index = out_index++;
+            code = 1;
+        }
+        else
+        {
+            out[out_index++] = data[i];
+            code++;
+        }
+    }
+    out[code_index] = code;
+    return out_index;
+}
+
+int cobsDecode(const uint8_t *data, int length, uint8_t *out)
+{
+    int out_index = 0;
+    int i = 0;
+    while (i < length)
+    {
+        uint8_t code = data[i++];
+        if (code == 0 || i + code - 1 > length)
+        {
+            return -1;
+        }
+        for (int j = 1; j < code; j++)
+        {
+            if (data[i] == 0)
+            {
+                return -1;
+            }
+            out[out_index++] = data[i++];
+        }
+        // A code below 0xFF stands for a zero, except after the last block
+        if (code < 0xFF && i < length)
+        {
+            out[out_index++] = 0;
+        }
+    }
+    return out_index;
+}
+
+static void writeU32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+    buffer[2] = (value >> 16) & 0xFF;
+    buffer[3] = (value >> 24) & 0xFF;
+}
+
+static uint32_t readU32(const uint8_t *buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+static void finishFrame(uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES], uint8_t out[SERIAL_FRAME_LENGTH_BYTES])
+{
+    // Appends the CRC to the payload, COBS encodes it into out and adds the delimiter
+    uint16_t crc = crc16Ccitt(payload, PAYLOAD_CRC_OFFSET);
+    payload[PAYLOAD_CRC_OFFSET] = crc & 0xFF;
+    payload[PAYLOAD_CRC_OFFSET + 1] = (crc >> 8) & 0xFF;
+
+    cobsEncode(payload, SERIAL_FRAME_PAYLOAD_LENGTH_BYTES, out);
+    out[SERIAL_FRAME_LENGTH_BYTES - 1] = 0;
+}
+
+static bool openFrame(const uint8_t *frame, int length, uint8_t type, uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES])
+{
+    // Decodes a frame into payload, false on length, CRC or type mismatch
+    if (length != SERIAL_FRAME_LENGTH_BYTES - 1 || cobsDecode(frame, length, payload) != SERIAL_FRAME_PAYLOAD_LENGTH_BYTES)
+    {
+        return false;
+    }
+    uint16_t crc = (uint16_t)(payload[PAYLOAD_CRC_OFFSET] | (payload[PAYLOAD_CRC_OFFSET + 1] << 8));
+    return crc == crc16Ccitt(payload, PAYLOAD_CRC_OFFSET) && payload[0] == type;
+}
+
+void encodeSampleFrame(const ImuSample &sample, uint8_t controller, uint8_t out[SERIAL_FRAME_LENGTH_BYTES])
+{
+    uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES];
+    payload[0] = SERIAL_FRAME_TYPE_SAMPLE;
+    payload[1] = sample.sequence & 0xFF;
+    payload[2] = (sample.sequence >> 8) & 0xFF;
+    writeU32(payload + 3, sample.timestamp_us);
+    payload[7] = (uint8_t)((controller << 1) | (sample.button_pressed ? 1 : 0));
+
+    int16_t raw[IMU_CODEC_VALUES];
+    quantizeImuSample(sample, raw);
+    for (int i = 0; i < IMU_CODEC_VALUES; i++)
+    {
+        payload[8 + 2*i] = (uint16_t)raw[i] & 0xFF;
+        payload[9 + 2*i] = ((uint16_t)raw[i] >> 8) & 0xFF;
+    }
+
+    finishFrame(payload, out);
+}
+
+bool decodeSampleFrame(const uint8_t *frame, int length, ImuSample &sample, uint8_t &controller)
+{
+    uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES];
+    if (!openFrame(frame, length, SERIAL_FRAME_TYPE_SAMPLE, payload))
+    {
+        return false;
+    }
+
+    sample.sequence = (uint16_t)(payload[1] | (payload[2] << 8));
+    sample.timestamp_us = readU32(payload + 3);
+    sample.button_pressed = payload[7] & 1;
+    controller = payload[7] >> 1;
+    int16_t raw[IMU_CODEC_VALUES];
+    for (int i = 0; i < IMU_CODEC_VALUES; i++)
+    {
+        raw[i] = (int16_t)(payload[8 + 2*i] | (payload[9 + 2*i] << 8));
+    }
+    dequantizeImuSample(raw, sample);
+    return true;
+}
+
+void encodeGestureFrame(const GestureResult &result, uint8_t out[SERIAL_FRAME_LENGTH_BYTES])
+{
+    uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES];
+    memset(payload, 0, sizeof(payload));
+    payload[0] = SERIAL_FRAME_TYPE_GESTURE;
+    payload[1] = result.number & 0xFF;
+    payload[2] = (result.number >> 8) & 0xFF;
+    writeU32(payload + 3, result.start_us);
+    writeU32(payload + 7, result.duration_us);
+    payload[11] = result.num_samples & 0xFF;
+    payload[12] = (result.num_samples >> 8) & 0xFF;
+    payload[13] = (uint8_t)result.label;
+    uint32_t confidence_bits;
+    memcpy(&confidence_bits, &result.confidence, sizeof(confidence_bits));
+    writeU32(payload + 14, confidence_bits);
+    writeU32(payload + 18, result.inference_us);
+    payload[22] = result.controller;
+    finishFrame(payload, out);
+}
+
+bool decodeGestureFrame(const uint8_t *frame, int length, GestureResult &result)
+{
+    uint8_t payload[SERIAL_FRAME_PAYLOAD_LENGTH_BYTES];
+    if (!openFrame(frame, length, SERIAL_FRAME_TYPE_GESTURE, payload))
+    {
+        return false;
+    }
+
+    result.number = (uint16_t)(payload[1] | (payload[2] << 8));
+    result.start_us = readU32(payload + 3);
+    result.duration_us = readU32(payload + 7);
+    result.num_samples = (uint16_t)(payload[11] | (payload[12] << 8));
+    result.label = (int8_t)payload[13];
+    uint32_t confidence_bits = readU32(payload + 14);
+    memcpy(&result.confidence, &confidence_bits, sizeof(result.confidence));
+    result.inference_us = readU32(payload + 18);
+    result.controller = payload[22];
+    return true;
+}
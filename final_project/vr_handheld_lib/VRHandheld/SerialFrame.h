@@ -0,0 +1,75 @@
+/*
+Ryan Dalby- CS 6360 Virtual Reality Final Project
+
+Binary frames written by vr_handheld_controller_receiver to serial instead of the ';' separated text lines.
+
+Every frame has the same size: the payload below, COBS encoded (so it contains no zero bytes) and terminated by a
+zero byte. A reader can resync at any zero byte and drops chunks that don't have the frame length or fail the CRC,
+such as status text printed while (re)connecting.
+
+Sample payload (little endian, SERIAL_FRAME_PAYLOAD_LENGTH_BYTES bytes):
+    0   uint8   frame type, SERIAL_FRAME_TYPE_SAMPLE
+    1   uint16  sequence number of the sample
+    3   uint32  timestamp of the sample in microseconds (controller clock)
+    7   uint8   bit 0 button pressed, bits 1..7 controller id (receiver slot of the controller that sent the sample)
+    8   int16   acc x,y,z, gyr x,y,z, mag x,y,z in raw sensor units (scales in ImuCodec.h)
+    26  uint16  CRC-16/CCITT-FALSE of bytes 0..25
+
+Gesture payload, sent after the sample that released the button when the receiver classifies gestures itself
+(GestureClassifier.h):
+    0   uint8   frame type, SERIAL_FRAME_TYPE_GESTURE
+    1   uint16  gesture number
+    3   uint32  timestamp of the first sample of the gesture in microseconds (controller clock)
+    7   uint32  duration in microseconds
+    11  uint16  number of samples received while the button was held
+    13  int8    predicted zero-based label
+    14  float32 confidence (softmax probability of the label)
+    18  uint32  inference time in microseconds
+    22  uint8   controller id
+    26  uint16  CRC-16/CCITT-FALSE of bytes 0..25
+*/
+
+#ifndef SERIAL_FRAME_H
+#define SERIAL_FRAME_H
+
+#include "ImuPacket.h"
+
+#define SERIAL_FRAME_TYPE_SAMPLE 0x01
+#define SERIAL_FRAME_TYPE_GESTURE 0x02
+#define SERIAL_FRAME_PAYLOAD_LENGTH_BYTES 28
+#define SERIAL_FRAME_LENGTH_BYTES (SERIAL_FRAME_PAYLOAD_LENGTH_BYTES + 2) // COBS overhead byte + zero delimiter
+#define SERIAL_FRAME_MAX_CONTROLLER 127
+
+struct GestureResult {
+    uint16_t number;
+    uint32_t start_us;
+    uint32_t duration_us;
+    uint16_t num_samples;
+    int8_t label;
+    float confidence;
+    uint32_t inference_us;
+    uint8_t controller;
+};
+
+uint16_t crc16Ccitt(const uint8_t *data, int length);
+
+// COBS encodes length (< 254) bytes, returns the encoded length (length + 1), no delimiter is added
+int cobsEncode(const uint8_t *data, int length, uint8_t *out);
+
+// Decodes a COBS encoded block without its delimiter, returns the decoded length or -1 if malformed
+int cobsDecode(const uint8_t *data, int length, uint8_t *out);
+
+// Writes a complete frame of a sample from the given controller (0..SERIAL_FRAME_MAX_CONTROLLER) including the
+// delimiter into out
+void encodeSampleFrame(const ImuSample &sample, uint8_t controller, uint8_t out[SERIAL_FRAME_LENGTH_BYTES]);
+
+// Decodes a frame given without its delimiter, returns false on length, CRC or type mismatch
+bool decodeSampleFrame(const uint8_t *frame, int length, ImuSample &sample, uint8_t &controller);
+
+// Writes a complete gesture frame including the delimiter into out
+void encodeGestureFrame(const GestureResult &result, uint8_t out[SERIAL_FRAME_LENGTH_BYTES]);
+
+// Decodes a gesture frame given without its delimiter, returns false on length, CRC or type mismatch
+bool decodeGestureFrame(const uint8_t *frame, int length, GestureResult &result);
+
+#endif
@@ -54,6 +54,33 @@
 #define INT_ENABLE       0x38
 #define INT_STATUS       0x3A
 
+/***
+ * first register of the sensor output block. ACCEL_XOUT_H..GYRO_ZOUT_L are laid out
+ * back-to-back (acc, temperature, gyro), so all of them are fetched in a single
+ * 14 byte burst instead of one transaction per sensor. INT_STATUS sits right in
+ * front of the block, the non-blocking path reads it along with the data.
+ */
+#define ACCEL_XOUT_H     0x3B
+#define ACC_GYR_BURST_LENGTH 14
+
+/***
+ * I2C clock. the MPU9250 is only specified up to 400 kHz (fast mode). many
+ * parts run fine at 1000000L (fast-mode plus), which cuts the bus time of a
+ * burst read by more than half; define IMU_I2C_CLOCK to opt in and check that
+ * readings don't come back corrupted
+ */
+#ifndef IMU_I2C_CLOCK
+#define IMU_I2C_CLOCK 400000L
+#endif
+
+/***
+ * time the bus lines are held idle before they are checked in I2C_ClearBus().
+ * the IMU is ready for register access 100 ms after power up
+ */
+#ifndef I2C_CLEAR_BUS_DELAY_MS
+#define I2C_CLEAR_BUS_DELAY_MS 100
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // this is a utility function to help clear the I2C bus so as to avoid it getting stuck
@@ -77,11 +104,9 @@ int I2C_ClearBus() {
   pinMode(SDA, INPUT_PULLUP); // Make SDA (data) and SCL (clock) pins Inputs with pullup.
   pinMode(SCL, INPUT_PULLUP);
 
-  delay(2500);  // Wait 2.5 secs. This is strictly only necessary on the first power
-  // up of the DS3231 module to allow it to initialize properly,
-  // but is also assists in reliable programming of FioV3 boards as it gives the
-  // IDE a chance to start uploaded the program
-  // before existing sketch confuses the IDE by sending Serial data.
+  delay(I2C_CLEAR_BUS_DELAY_MS);  // Wait for the IMU to power up. The original routine waited
+  // 2.5 secs, which is only necessary on the first power up of the DS3231 module
+  // (and for programming FioV3 boards), not for the MPU9250.
 
   boolean SCL_LOW = (digitalRead(SCL) == LOW); // Check is SCL is Low.
   if (SCL_LOW) { //If it is held low Arduno cannot become the I2C master.
@@ -149,8 +174,13 @@ void Imu::init()
   delay(250);
 
   // initialize I2C contnection to IMU with Arduino being the master
+#if IMU_NONBLOCKING_I2C
+  Wire.begin(I2C_MASTER, 0x00, I2C_PINS_18_19, I2C_PULLUP_EXT, IMU_I2C_CLOCK);
+  Wire.setOpMode(I2C_OP_MODE_DMA); // let DMA service burst reads, falls back to ISR
+#else
   Wire.begin();
-  Wire.setClock(400000L); // set clock rate to 400 kHz for faster data transfer
+  Wire.setClock(IMU_I2C_CLOCK); // set clock rate (see IMU_I2C_CLOCK) for faster data transfer
+#endif
 
   /*
   // We can ping the IMU first thing and read out the WHO_AM_I_MPU9250 register. The returned value should
@@ -215,12 +245,83 @@ bool Imu::read() {
     return false;
   }
 
-  // all measurements are converted to 16 bits by the IMU-internal ADC
-  double max16BitValue = 32767.0;
+  // read acc, temperature and gyro in one burst
+  uint8_t Buf[ACC_GYR_BURST_LENGTH];
+
+  this->I2Cread(MPU9250_ADDRESS, ACCEL_XOUT_H, ACC_GYR_BURST_LENGTH, Buf);
+
+  this->convertAccGyr(Buf);
 
-  uint8_t Buf[14];
+  this->readMagnetometer();
 
-  this->I2Cread(MPU9250_ADDRESS, 0x3B, 14, Buf);
+  return true;
+}
+
+/***
+ *  non-blocking variant of read(): INT_STATUS and the sensor block are requested
+ *  in a single transfer, which runs in the background while the caller does
+ *  other work. call readComplete() later to pick up the values.
+ */
+bool Imu::startRead() {
+
+#if IMU_NONBLOCKING_I2C
+  if (this->_transferPending) {
+    return false;
+  }
+
+  Wire.beginTransmission(MPU9250_ADDRESS);
+  Wire.write(INT_STATUS);
+  Wire.endTransmission(I2C_NOSTOP);     // repeated start, keep the bus
+  Wire.sendRequest(MPU9250_ADDRESS, 1 + ACC_GYR_BURST_LENGTH, I2C_STOP);
+
+  this->_transferPending = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Imu::readComplete() {
+
+#if IMU_NONBLOCKING_I2C
+  if (!this->_transferPending || !Wire.done()) {
+    return false;
+  }
+
+  this->_transferPending = false;
+
+  if (Wire.getError()) {
+    return false;
+  }
+
+  uint8_t Buf[1 + ACC_GYR_BURST_LENGTH];
+  uint8_t index = 0;
+  while (Wire.available() && index < sizeof(Buf))
+    Buf[index++] = Wire.read();
+
+  // first byte is INT_STATUS, check if the data is new
+  if (index != sizeof(Buf) || (Buf[0] & 0x01) == false) {
+    return false;
+  }
+
+  this->convertAccGyr(Buf + 1);
+
+  // the magnetometer is rarely used, keep it blocking
+  this->readMagnetometer();
+
+  return true;
+#else
+  return this->read();
+#endif
+}
+
+/***
+ *  convert the raw burst starting at ACCEL_XOUT_H into metric units
+ */
+void Imu::convertAccGyr(const uint8_t *Buf) {
+
+  // all measurements are converted to 16 bits by the IMU-internal ADC
+  double max16BitValue = 32767.0;
 
   /////////////////////////////////////////////////////////////////////////////
   // Read accelerometer
@@ -269,11 +370,18 @@ bool Imu::read() {
   gyrX = double(gx) * gyrScale;
   gyrY = double(gy) * gyrScale;
   gyrZ = double(gz) * gyrScale;
+}
 
-  /////////////////////////////////////////////////////////////////////////////
+/***
+ *  read the magnetometer (separate chip) if a new measurement is available
+ */
+void Imu::readMagnetometer() {
 
   if (USE_MAGNETOMETER) {
 
+    // all measurements are converted to 16 bits by the IMU-internal ADC
+    double max16BitValue = 32767.0;
+
     // Read magnetometer
     uint8_t ST1;
     I2Cread(MAG_ADDRESS, 0x02, 1, &ST1);
@@ -302,8 +410,6 @@ bool Imu::read() {
       I2CwriteByte(MAG_ADDRESS, 0x0A, B00010001);
     }
   }
-
-  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -346,10 +452,11 @@ void Imu::I2CwriteByte(uint8_t Address, uint8_t Register, uint8_t Data)
 void Imu::I2Cread(uint8_t Address, uint8_t Register, uint8_t Nbytes,
                   uint8_t *Data)
 {
-  // Set register address
+  // Set register address, send a restart instead of a stop so the read
+  // follows without releasing the bus
   Wire.beginTransmission(Address);
   Wire.write(Register);
-  Wire.endTransmission();
+  Wire.endTransmission(false);
 
   // Read Nbytes
   Wire.requestFrom(Address, Nbytes);
@@ -11,8 +11,24 @@
 
 #include <Arduino.h>
 
+/***
+ * set to true to use the non-blocking i2c_t3 library instead of Wire. in this
+ * mode startRead() queues a burst read of the sensor registers (serviced by DMA
+ * on the Teensy 3.x) and readComplete() picks up the result once it landed.
+ * OrientationTracker then reads the IMU one sample behind, with the bus busy
+ * while the previous sample is processed.
+ * note: i2c_t3 and Wire cannot be included in the same sketch
+ */
+#ifndef IMU_NONBLOCKING_I2C
+#define IMU_NONBLOCKING_I2C false
+#endif
+
 /* for I2C and serial communication */
+#if IMU_NONBLOCKING_I2C
+#include <i2c_t3.h>
+#else
 #include <Wire.h>
+#endif
 
 class Imu {
 public:
@@ -28,8 +44,23 @@ public:
   //  returns true if data is different from last time read() was called and false otherwise
   bool read();
 
+  // start a non-blocking burst read of status, accelerometer and gyro
+  //  returns false if a transfer is still in flight
+  //  (only available if IMU_NONBLOCKING_I2C is set, blocking read() otherwise)
+  bool startRead();
+
+  // finish the transfer started by startRead()
+  //  returns true if new data arrived and the member values were updated
+  bool readComplete();
+
 private:
 
+  // convert a burst of ACCEL_XOUT_H..GYRO_ZOUT_L registers to metric units
+  void convertAccGyr(const uint8_t *Buf);
+
+  // read the magnetometer if a new measurement is available
+  void readMagnetometer();
+
   void initMPU9250(void);
 
   void I2Cread(
@@ -53,6 +84,9 @@ private:
          _magnetometerAdjustmentScaleY,
          _magnetometerAdjustmentScaleZ;
 
+  /* true while a non-blocking transfer is in flight */
+  bool _transferPending = false;
+
 };
 
 #endif // ifndef IMU_H
@@ -123,10 +123,20 @@ void OrientationTracker::updateImuVariablesFromSimulation() {
 bool OrientationTracker::updateImuVariables() {
 
   //sample imu values
+#if IMU_NONBLOCKING_I2C
+  //pick up the burst queued by the previous call and queue the next one,
+  //so the transfer runs while the filter and the lighthouse are processed
+  bool available = imu.readComplete();
+  imu.startRead();
+  if (!available) {
+    return false;
+  }
+#else
   if (!imu.read()) {
   // return false if there's no data
     return false;
   }
+#endif
 
   //call micros() to get current time in microseconds
   //update:
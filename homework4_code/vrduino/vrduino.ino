@@ -18,7 +18,6 @@
  */
 
 
-#include <Wire.h>
 #include "OrientationTracker.h"
 #include "TestOrientation.h"
 